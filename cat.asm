@@ -0,0 +1,1384 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 26                	jg     4f <main+0x4f>
+  29:	eb 52                	jmp    7d <main+0x7d>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+  33:	83 c6 01             	add    $0x1,%esi
+  36:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+  39:	50                   	push   %eax
+  3a:	e8 51 00 00 00       	call   90 <cat>
+    close(fd);
+  3f:	89 3c 24             	mov    %edi,(%esp)
+  42:	e8 b1 03 00 00       	call   3f8 <close>
+  for(i = 1; i < argc; i++){
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4d:	74 29                	je     78 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+  4f:	83 ec 08             	sub    $0x8,%esp
+  52:	6a 00                	push   $0x0
+  54:	ff 33                	push   (%ebx)
+  56:	e8 b5 03 00 00       	call   410 <open>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	89 c7                	mov    %eax,%edi
+  60:	85 c0                	test   %eax,%eax
+  62:	79 cc                	jns    30 <main+0x30>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  64:	50                   	push   %eax
+  65:	ff 33                	push   (%ebx)
+  67:	68 cb 08 00 00       	push   $0x8cb
+  6c:	6a 01                	push   $0x1
+  6e:	e8 0d 05 00 00       	call   580 <printf>
+      exit();
+  73:	e8 58 03 00 00       	call   3d0 <exit>
+  }
+  exit();
+  78:	e8 53 03 00 00       	call   3d0 <exit>
+    cat(0);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	6a 00                	push   $0x0
+  82:	e8 09 00 00 00       	call   90 <cat>
+    exit();
+  87:	e8 44 03 00 00       	call   3d0 <exit>
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <cat>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	56                   	push   %esi
+  94:	53                   	push   %ebx
+  95:	8b 75 08             	mov    0x8(%ebp),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  98:	eb 1d                	jmp    b7 <cat+0x27>
+  9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (write(1, buf, n) != n) {
+  a0:	83 ec 04             	sub    $0x4,%esp
+  a3:	53                   	push   %ebx
+  a4:	68 80 0c 00 00       	push   $0xc80
+  a9:	6a 01                	push   $0x1
+  ab:	e8 40 03 00 00       	call   3f0 <write>
+  b0:	83 c4 10             	add    $0x10,%esp
+  b3:	39 d8                	cmp    %ebx,%eax
+  b5:	75 25                	jne    dc <cat+0x4c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  b7:	83 ec 04             	sub    $0x4,%esp
+  ba:	68 00 02 00 00       	push   $0x200
+  bf:	68 80 0c 00 00       	push   $0xc80
+  c4:	56                   	push   %esi
+  c5:	e8 1e 03 00 00       	call   3e8 <read>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	89 c3                	mov    %eax,%ebx
+  cf:	85 c0                	test   %eax,%eax
+  d1:	7f cd                	jg     a0 <cat+0x10>
+  if(n < 0){
+  d3:	75 1b                	jne    f0 <cat+0x60>
+}
+  d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  d8:	5b                   	pop    %ebx
+  d9:	5e                   	pop    %esi
+  da:	5d                   	pop    %ebp
+  db:	c3                   	ret
+      printf(1, "cat: write error\n");
+  dc:	83 ec 08             	sub    $0x8,%esp
+  df:	68 a8 08 00 00       	push   $0x8a8
+  e4:	6a 01                	push   $0x1
+  e6:	e8 95 04 00 00       	call   580 <printf>
+      exit();
+  eb:	e8 e0 02 00 00       	call   3d0 <exit>
+    printf(1, "cat: read error\n");
+  f0:	50                   	push   %eax
+  f1:	50                   	push   %eax
+  f2:	68 ba 08 00 00       	push   $0x8ba
+  f7:	6a 01                	push   $0x1
+  f9:	e8 82 04 00 00       	call   580 <printf>
+    exit();
+  fe:	e8 cd 02 00 00       	call   3d0 <exit>
+ 103:	66 90                	xchg   %ax,%ax
+ 105:	66 90                	xchg   %ax,%ax
+ 107:	66 90                	xchg   %ax,%ax
+ 109:	66 90                	xchg   %ax,%ax
+ 10b:	66 90                	xchg   %ax,%ax
+ 10d:	66 90                	xchg   %ax,%ax
+ 10f:	90                   	nop
+
+00000110 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 110:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 111:	31 c0                	xor    %eax,%eax
+{
+ 113:	89 e5                	mov    %esp,%ebp
+ 115:	53                   	push   %ebx
+ 116:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 127:	83 c0 01             	add    $0x1,%eax
+ 12a:	84 d2                	test   %dl,%dl
+ 12c:	75 f2                	jne    120 <strcpy+0x10>
+    ;
+  return os;
+}
+ 12e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 131:	89 c8                	mov    %ecx,%eax
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+ 135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	53                   	push   %ebx
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+ 147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 14a:	0f b6 02             	movzbl (%edx),%eax
+ 14d:	84 c0                	test   %al,%al
+ 14f:	75 17                	jne    168 <strcmp+0x28>
+ 151:	eb 3a                	jmp    18d <strcmp+0x4d>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 15c:	83 c2 01             	add    $0x1,%edx
+ 15f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 162:	84 c0                	test   %al,%al
+ 164:	74 1a                	je     180 <strcmp+0x40>
+    p++, q++;
+ 166:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 168:	0f b6 19             	movzbl (%ecx),%ebx
+ 16b:	38 c3                	cmp    %al,%bl
+ 16d:	74 e9                	je     158 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 16f:	29 d8                	sub    %ebx,%eax
+}
+ 171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 174:	c9                   	leave
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 180:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 184:	31 c0                	xor    %eax,%eax
+ 186:	29 d8                	sub    %ebx,%eax
+}
+ 188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 18b:	c9                   	leave
+ 18c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 18d:	0f b6 19             	movzbl (%ecx),%ebx
+ 190:	31 c0                	xor    %eax,%eax
+ 192:	eb db                	jmp    16f <strcmp+0x2f>
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1a9:	74 15                	je     1c0 <strlen+0x20>
+ 1ab:	31 c0                	xor    %eax,%eax
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 1b0:	83 c0 01             	add    $0x1,%eax
+ 1b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1b7:	89 c1                	mov    %eax,%ecx
+ 1b9:	75 f5                	jne    1b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1bb:	89 c8                	mov    %ecx,%eax
+ 1bd:	5d                   	pop    %ebp
+ 1be:	c3                   	ret
+ 1bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1c0:	31 c9                	xor    %ecx,%ecx
+}
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	89 c8                	mov    %ecx,%eax
+ 1c5:	c3                   	ret
+ 1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1dd:	89 d7                	mov    %edx,%edi
+ 1df:	fc                   	cld
+ 1e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1e5:	89 d0                	mov    %edx,%eax
+ 1e7:	c9                   	leave
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1fa:	0f b6 10             	movzbl (%eax),%edx
+ 1fd:	84 d2                	test   %dl,%dl
+ 1ff:	75 12                	jne    213 <strchr+0x23>
+ 201:	eb 1d                	jmp    220 <strchr+0x30>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 20c:	83 c0 01             	add    $0x1,%eax
+ 20f:	84 d2                	test   %dl,%dl
+ 211:	74 0d                	je     220 <strchr+0x30>
+    if(*s == c)
+ 213:	38 d1                	cmp    %dl,%cl
+ 215:	75 f1                	jne    208 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 217:	5d                   	pop    %ebp
+ 218:	c3                   	ret
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 220:	31 c0                	xor    %eax,%eax
+}
+ 222:	5d                   	pop    %ebp
+ 223:	c3                   	ret
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 235:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 238:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 239:	31 db                	xor    %ebx,%ebx
+{
+ 23b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 23e:	eb 27                	jmp    267 <gets+0x37>
+    cc = read(0, &c, 1);
+ 240:	83 ec 04             	sub    $0x4,%esp
+ 243:	6a 01                	push   $0x1
+ 245:	56                   	push   %esi
+ 246:	6a 00                	push   $0x0
+ 248:	e8 9b 01 00 00       	call   3e8 <read>
+    if(cc < 1)
+ 24d:	83 c4 10             	add    $0x10,%esp
+ 250:	85 c0                	test   %eax,%eax
+ 252:	7e 1d                	jle    271 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 254:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 258:	8b 55 08             	mov    0x8(%ebp),%edx
+ 25b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 25f:	3c 0a                	cmp    $0xa,%al
+ 261:	74 10                	je     273 <gets+0x43>
+ 263:	3c 0d                	cmp    $0xd,%al
+ 265:	74 0c                	je     273 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 267:	89 df                	mov    %ebx,%edi
+ 269:	83 c3 01             	add    $0x1,%ebx
+ 26c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 26f:	7c cf                	jl     240 <gets+0x10>
+ 271:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 27a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27d:	5b                   	pop    %ebx
+ 27e:	5e                   	pop    %esi
+ 27f:	5f                   	pop    %edi
+ 280:	5d                   	pop    %ebp
+ 281:	c3                   	ret
+ 282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	56                   	push   %esi
+ 294:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 295:	83 ec 08             	sub    $0x8,%esp
+ 298:	6a 00                	push   $0x0
+ 29a:	ff 75 08             	push   0x8(%ebp)
+ 29d:	e8 6e 01 00 00       	call   410 <open>
+  if(fd < 0)
+ 2a2:	83 c4 10             	add    $0x10,%esp
+ 2a5:	85 c0                	test   %eax,%eax
+ 2a7:	78 27                	js     2d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2a9:	83 ec 08             	sub    $0x8,%esp
+ 2ac:	ff 75 0c             	push   0xc(%ebp)
+ 2af:	89 c3                	mov    %eax,%ebx
+ 2b1:	50                   	push   %eax
+ 2b2:	e8 71 01 00 00       	call   428 <fstat>
+  close(fd);
+ 2b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2bc:	e8 37 01 00 00       	call   3f8 <close>
+  return r;
+ 2c1:	83 c4 10             	add    $0x10,%esp
+}
+ 2c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2c7:	89 f0                	mov    %esi,%eax
+ 2c9:	5b                   	pop    %ebx
+ 2ca:	5e                   	pop    %esi
+ 2cb:	5d                   	pop    %ebp
+ 2cc:	c3                   	ret
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2d5:	eb ed                	jmp    2c4 <stat+0x34>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	53                   	push   %ebx
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2e7:	0f be 02             	movsbl (%edx),%eax
+ 2ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2f5:	77 1e                	ja     315 <atoi+0x35>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 300:	83 c2 01             	add    $0x1,%edx
+ 303:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 306:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 30a:	0f be 02             	movsbl (%edx),%eax
+ 30d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 310:	80 fb 09             	cmp    $0x9,%bl
+ 313:	76 eb                	jbe    300 <atoi+0x20>
+  return n;
+}
+ 315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 318:	89 c8                	mov    %ecx,%eax
+ 31a:	c9                   	leave
+ 31b:	c3                   	ret
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+ 325:	8b 45 10             	mov    0x10(%ebp),%eax
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 32e:	85 c0                	test   %eax,%eax
+ 330:	7e 13                	jle    345 <memmove+0x25>
+ 332:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 334:	89 d7                	mov    %edx,%edi
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 340:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 341:	39 f8                	cmp    %edi,%eax
+ 343:	75 fb                	jne    340 <memmove+0x20>
+  return vdst;
+}
+ 345:	5e                   	pop    %esi
+ 346:	89 d0                	mov    %edx,%eax
+ 348:	5f                   	pop    %edi
+ 349:	5d                   	pop    %ebp
+ 34a:	c3                   	ret
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <mutex_lock>:
+
+// Take and release m with atomic instructions, and enter the kernel
+// only to block while it is held or to wake a blocked thread.
+void
+mutex_lock(struct mutex *m)
+{
+ 350:	55                   	push   %ebp
+  uint s;
+
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 351:	31 c0                	xor    %eax,%eax
+ 353:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 358:	89 e5                	mov    %esp,%ebp
+ 35a:	56                   	push   %esi
+ 35b:	53                   	push   %ebx
+ 35c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 35f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 363:	85 c0                	test   %eax,%eax
+ 365:	74 30                	je     397 <mutex_lock+0x47>
+    return;
+  // Contended: mark it so the holder knows to wake us.
+  if(s != 2)
+ 367:	83 f8 02             	cmp    $0x2,%eax
+ 36a:	74 0c                	je     378 <mutex_lock+0x28>
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 36c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 371:	f0 87 03             	lock xchg %eax,(%ebx)
+    s = xchg(&m->state, 2);
+  while(s != 0){
+ 374:	85 c0                	test   %eax,%eax
+ 376:	74 1f                	je     397 <mutex_lock+0x47>
+ 378:	be 02 00 00 00       	mov    $0x2,%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+ 380:	83 ec 08             	sub    $0x8,%esp
+ 383:	6a 02                	push   $0x2
+ 385:	53                   	push   %ebx
+ 386:	e8 45 01 00 00       	call   4d0 <futex_wait>
+ 38b:	89 f0                	mov    %esi,%eax
+ 38d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(s != 0){
+ 390:	83 c4 10             	add    $0x10,%esp
+ 393:	85 c0                	test   %eax,%eax
+ 395:	75 e9                	jne    380 <mutex_lock+0x30>
+    s = xchg(&m->state, 2);
+  }
+}
+ 397:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 39a:	5b                   	pop    %ebx
+ 39b:	5e                   	pop    %esi
+ 39c:	5d                   	pop    %ebp
+ 39d:	c3                   	ret
+ 39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	31 c0                	xor    %eax,%eax
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	83 ec 08             	sub    $0x8,%esp
+ 3a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3ab:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 3ae:	83 f8 02             	cmp    $0x2,%eax
+ 3b1:	74 05                	je     3b8 <mutex_unlock+0x18>
+    futex_wake(&m->state, 1);
+}
+ 3b3:	c9                   	leave
+ 3b4:	c3                   	ret
+ 3b5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->state, 1);
+ 3b8:	83 ec 08             	sub    $0x8,%esp
+ 3bb:	6a 01                	push   $0x1
+ 3bd:	52                   	push   %edx
+ 3be:	e8 15 01 00 00       	call   4d8 <futex_wake>
+ 3c3:	83 c4 10             	add    $0x10,%esp
+}
+ 3c6:	c9                   	leave
+ 3c7:	c3                   	ret
+
+000003c8 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3c8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <exit>:
+SYSCALL(exit)
+ 3d0:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <wait>:
+SYSCALL(wait)
+ 3d8:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <pipe>:
+SYSCALL(pipe)
+ 3e0:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <read>:
+SYSCALL(read)
+ 3e8:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <write>:
+SYSCALL(write)
+ 3f0:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <close>:
+SYSCALL(close)
+ 3f8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <kill>:
+SYSCALL(kill)
+ 400:	b8 06 00 00 00       	mov    $0x6,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <exec>:
+SYSCALL(exec)
+ 408:	b8 07 00 00 00       	mov    $0x7,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <open>:
+SYSCALL(open)
+ 410:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <mknod>:
+SYSCALL(mknod)
+ 418:	b8 11 00 00 00       	mov    $0x11,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <unlink>:
+SYSCALL(unlink)
+ 420:	b8 12 00 00 00       	mov    $0x12,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <fstat>:
+SYSCALL(fstat)
+ 428:	b8 08 00 00 00       	mov    $0x8,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <link>:
+SYSCALL(link)
+ 430:	b8 13 00 00 00       	mov    $0x13,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <mkdir>:
+SYSCALL(mkdir)
+ 438:	b8 14 00 00 00       	mov    $0x14,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <chdir>:
+SYSCALL(chdir)
+ 440:	b8 09 00 00 00       	mov    $0x9,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <dup>:
+SYSCALL(dup)
+ 448:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <getpid>:
+SYSCALL(getpid)
+ 450:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <sbrk>:
+SYSCALL(sbrk)
+ 458:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <sleep>:
+SYSCALL(sleep)
+ 460:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <uptime>:
+SYSCALL(uptime)
+ 468:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <ps>:
+SYSCALL(ps)
+ 470:	b8 16 00 00 00       	mov    $0x16,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <getschedparams>:
+SYSCALL(getschedparams)
+ 478:	b8 17 00 00 00       	mov    $0x17,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <setschedparams>:
+SYSCALL(setschedparams)
+ 480:	b8 18 00 00 00       	mov    $0x18,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <getpinfo>:
+SYSCALL(getpinfo)
+ 488:	b8 19 00 00 00       	mov    $0x19,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <getlathist>:
+SYSCALL(getlathist)
+ 490:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <setpolicy>:
+SYSCALL(setpolicy)
+ 498:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <settickets>:
+SYSCALL(settickets)
+ 4a0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <setaffinity>:
+SYSCALL(setaffinity)
+ 4a8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <getaffinity>:
+SYSCALL(getaffinity)
+ 4b0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <setrt>:
+SYSCALL(setrt)
+ 4b8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <clone>:
+SYSCALL(clone)
+ 4c0:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <join>:
+SYSCALL(join)
+ 4c8:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <futex_wait>:
+SYSCALL(futex_wait)
+ 4d0:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <futex_wake>:
+SYSCALL(futex_wake)
+ 4d8:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+ 4e5:	53                   	push   %ebx
+ 4e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4e8:	89 d1                	mov    %edx,%ecx
+{
+ 4ea:	83 ec 3c             	sub    $0x3c,%esp
+ 4ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4f0:	85 d2                	test   %edx,%edx
+ 4f2:	0f 89 80 00 00 00    	jns    578 <printint+0x98>
+ 4f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4fc:	74 7a                	je     578 <printint+0x98>
+    x = -xx;
+ 4fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 500:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 505:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 508:	31 f6                	xor    %esi,%esi
+ 50a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 510:	89 c8                	mov    %ecx,%eax
+ 512:	31 d2                	xor    %edx,%edx
+ 514:	89 f7                	mov    %esi,%edi
+ 516:	f7 f3                	div    %ebx
+ 518:	8d 76 01             	lea    0x1(%esi),%esi
+ 51b:	0f b6 92 40 09 00 00 	movzbl 0x940(%edx),%edx
+ 522:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 526:	89 ca                	mov    %ecx,%edx
+ 528:	89 c1                	mov    %eax,%ecx
+ 52a:	39 da                	cmp    %ebx,%edx
+ 52c:	73 e2                	jae    510 <printint+0x30>
+  if(neg)
+ 52e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 531:	85 c0                	test   %eax,%eax
+ 533:	74 07                	je     53c <printint+0x5c>
+    buf[i++] = '-';
+ 535:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 53a:	89 f7                	mov    %esi,%edi
+ 53c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 53f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 542:	01 df                	add    %ebx,%edi
+ 544:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 548:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 54b:	83 ec 04             	sub    $0x4,%esp
+ 54e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 551:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 554:	6a 01                	push   $0x1
+ 556:	50                   	push   %eax
+ 557:	56                   	push   %esi
+ 558:	e8 93 fe ff ff       	call   3f0 <write>
+  while(--i >= 0)
+ 55d:	89 f8                	mov    %edi,%eax
+ 55f:	83 c4 10             	add    $0x10,%esp
+ 562:	83 ef 01             	sub    $0x1,%edi
+ 565:	39 d8                	cmp    %ebx,%eax
+ 567:	75 df                	jne    548 <printint+0x68>
+}
+ 569:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 56c:	5b                   	pop    %ebx
+ 56d:	5e                   	pop    %esi
+ 56e:	5f                   	pop    %edi
+ 56f:	5d                   	pop    %ebp
+ 570:	c3                   	ret
+ 571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 578:	31 c0                	xor    %eax,%eax
+ 57a:	eb 89                	jmp    505 <printint+0x25>
+ 57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	53                   	push   %ebx
+ 586:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 589:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 58c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 58f:	0f b6 1e             	movzbl (%esi),%ebx
+ 592:	83 c6 01             	add    $0x1,%esi
+ 595:	84 db                	test   %bl,%bl
+ 597:	74 67                	je     600 <printf+0x80>
+ 599:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 59c:	31 d2                	xor    %edx,%edx
+ 59e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5a1:	eb 34                	jmp    5d7 <printf+0x57>
+ 5a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5a7:	90                   	nop
+ 5a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5b0:	83 f8 25             	cmp    $0x25,%eax
+ 5b3:	74 18                	je     5cd <printf+0x4d>
+  write(fd, &c, 1);
+ 5b5:	83 ec 04             	sub    $0x4,%esp
+ 5b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5be:	6a 01                	push   $0x1
+ 5c0:	50                   	push   %eax
+ 5c1:	57                   	push   %edi
+ 5c2:	e8 29 fe ff ff       	call   3f0 <write>
+ 5c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 5d0:	83 c6 01             	add    $0x1,%esi
+ 5d3:	84 db                	test   %bl,%bl
+ 5d5:	74 29                	je     600 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5da:	85 d2                	test   %edx,%edx
+ 5dc:	74 ca                	je     5a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5de:	83 fa 25             	cmp    $0x25,%edx
+ 5e1:	75 ea                	jne    5cd <printf+0x4d>
+      if(c == 'd'){
+ 5e3:	83 f8 25             	cmp    $0x25,%eax
+ 5e6:	0f 84 24 01 00 00    	je     710 <printf+0x190>
+ 5ec:	83 e8 63             	sub    $0x63,%eax
+ 5ef:	83 f8 15             	cmp    $0x15,%eax
+ 5f2:	77 1c                	ja     610 <printf+0x90>
+ 5f4:	ff 24 85 e8 08 00 00 	jmp    *0x8e8(,%eax,4)
+ 5fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 600:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 603:	5b                   	pop    %ebx
+ 604:	5e                   	pop    %esi
+ 605:	5f                   	pop    %edi
+ 606:	5d                   	pop    %ebp
+ 607:	c3                   	ret
+ 608:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60f:	90                   	nop
+  write(fd, &c, 1);
+ 610:	83 ec 04             	sub    $0x4,%esp
+ 613:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 616:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 61a:	6a 01                	push   $0x1
+ 61c:	52                   	push   %edx
+ 61d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 620:	57                   	push   %edi
+ 621:	e8 ca fd ff ff       	call   3f0 <write>
+ 626:	83 c4 0c             	add    $0xc,%esp
+ 629:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 62c:	6a 01                	push   $0x1
+ 62e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 631:	52                   	push   %edx
+ 632:	57                   	push   %edi
+ 633:	e8 b8 fd ff ff       	call   3f0 <write>
+        putc(fd, c);
+ 638:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 63b:	31 d2                	xor    %edx,%edx
+ 63d:	eb 8e                	jmp    5cd <printf+0x4d>
+ 63f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 640:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 643:	83 ec 0c             	sub    $0xc,%esp
+ 646:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 64b:	8b 13                	mov    (%ebx),%edx
+ 64d:	6a 00                	push   $0x0
+ 64f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 651:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 654:	e8 87 fe ff ff       	call   4e0 <printint>
+        ap++;
+ 659:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 65c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 65f:	31 d2                	xor    %edx,%edx
+ 661:	e9 67 ff ff ff       	jmp    5cd <printf+0x4d>
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 670:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 673:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 675:	83 c0 04             	add    $0x4,%eax
+ 678:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 67b:	85 db                	test   %ebx,%ebx
+ 67d:	0f 84 9d 00 00 00    	je     720 <printf+0x1a0>
+        while(*s != 0){
+ 683:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 686:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 688:	84 c0                	test   %al,%al
+ 68a:	0f 84 3d ff ff ff    	je     5cd <printf+0x4d>
+ 690:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 693:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 696:	89 de                	mov    %ebx,%esi
+ 698:	89 d3                	mov    %edx,%ebx
+ 69a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6a0:	83 ec 04             	sub    $0x4,%esp
+ 6a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6a9:	6a 01                	push   $0x1
+ 6ab:	53                   	push   %ebx
+ 6ac:	57                   	push   %edi
+ 6ad:	e8 3e fd ff ff       	call   3f0 <write>
+        while(*s != 0){
+ 6b2:	0f b6 06             	movzbl (%esi),%eax
+ 6b5:	83 c4 10             	add    $0x10,%esp
+ 6b8:	84 c0                	test   %al,%al
+ 6ba:	75 e4                	jne    6a0 <printf+0x120>
+      state = 0;
+ 6bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6bf:	31 d2                	xor    %edx,%edx
+ 6c1:	e9 07 ff ff ff       	jmp    5cd <printf+0x4d>
+ 6c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6d3:	83 ec 0c             	sub    $0xc,%esp
+ 6d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6db:	8b 13                	mov    (%ebx),%edx
+ 6dd:	6a 01                	push   $0x1
+ 6df:	e9 6b ff ff ff       	jmp    64f <printf+0xcf>
+ 6e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6eb:	83 ec 04             	sub    $0x4,%esp
+ 6ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6f9:	6a 01                	push   $0x1
+ 6fb:	52                   	push   %edx
+ 6fc:	57                   	push   %edi
+ 6fd:	e8 ee fc ff ff       	call   3f0 <write>
+        ap++;
+ 702:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 705:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 708:	31 d2                	xor    %edx,%edx
+ 70a:	e9 be fe ff ff       	jmp    5cd <printf+0x4d>
+ 70f:	90                   	nop
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 716:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 719:	6a 01                	push   $0x1
+ 71b:	e9 11 ff ff ff       	jmp    631 <printf+0xb1>
+ 720:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 725:	bb e0 08 00 00       	mov    $0x8e0,%ebx
+ 72a:	e9 61 ff ff ff       	jmp    690 <printf+0x110>
+ 72f:	90                   	nop
+
+00000730 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 730:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 731:	a1 80 0e 00 00       	mov    0xe80,%eax
+{
+ 736:	89 e5                	mov    %esp,%ebp
+ 738:	57                   	push   %edi
+ 739:	56                   	push   %esi
+ 73a:	53                   	push   %ebx
+ 73b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 73e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 741:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 748:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 74a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 74c:	39 ca                	cmp    %ecx,%edx
+ 74e:	73 30                	jae    780 <free+0x50>
+ 750:	39 c1                	cmp    %eax,%ecx
+ 752:	72 04                	jb     758 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 754:	39 c2                	cmp    %eax,%edx
+ 756:	72 f0                	jb     748 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 758:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 75b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 75e:	39 f8                	cmp    %edi,%eax
+ 760:	74 2e                	je     790 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 762:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 765:	8b 42 04             	mov    0x4(%edx),%eax
+ 768:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 76b:	39 f1                	cmp    %esi,%ecx
+ 76d:	74 38                	je     7a7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 76f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 771:	5b                   	pop    %ebx
+  freep = p;
+ 772:	89 15 80 0e 00 00    	mov    %edx,0xe80
+}
+ 778:	5e                   	pop    %esi
+ 779:	5f                   	pop    %edi
+ 77a:	5d                   	pop    %ebp
+ 77b:	c3                   	ret
+ 77c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 780:	39 c1                	cmp    %eax,%ecx
+ 782:	72 d0                	jb     754 <free+0x24>
+ 784:	eb c2                	jmp    748 <free+0x18>
+ 786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 790:	03 70 04             	add    0x4(%eax),%esi
+ 793:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 796:	8b 02                	mov    (%edx),%eax
+ 798:	8b 00                	mov    (%eax),%eax
+ 79a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 79d:	8b 42 04             	mov    0x4(%edx),%eax
+ 7a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7a3:	39 f1                	cmp    %esi,%ecx
+ 7a5:	75 c8                	jne    76f <free+0x3f>
+    p->s.size += bp->s.size;
+ 7a7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 7aa:	89 15 80 0e 00 00    	mov    %edx,0xe80
+    p->s.size += bp->s.size;
+ 7b0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7b3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 7b6:	89 0a                	mov    %ecx,(%edx)
+}
+ 7b8:	5b                   	pop    %ebx
+ 7b9:	5e                   	pop    %esi
+ 7ba:	5f                   	pop    %edi
+ 7bb:	5d                   	pop    %ebp
+ 7bc:	c3                   	ret
+ 7bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007c0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	57                   	push   %edi
+ 7c4:	56                   	push   %esi
+ 7c5:	53                   	push   %ebx
+ 7c6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 7cc:	8b 15 80 0e 00 00    	mov    0xe80,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7d2:	8d 78 07             	lea    0x7(%eax),%edi
+ 7d5:	c1 ef 03             	shr    $0x3,%edi
+ 7d8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 7db:	85 d2                	test   %edx,%edx
+ 7dd:	0f 84 8d 00 00 00    	je     870 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7e3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7e5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7e8:	39 f9                	cmp    %edi,%ecx
+ 7ea:	73 64                	jae    850 <malloc+0x90>
+  if(nu < 4096)
+ 7ec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 7f1:	39 df                	cmp    %ebx,%edi
+ 7f3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 7f6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 7fd:	eb 0a                	jmp    809 <malloc+0x49>
+ 7ff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 800:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 802:	8b 48 04             	mov    0x4(%eax),%ecx
+ 805:	39 f9                	cmp    %edi,%ecx
+ 807:	73 47                	jae    850 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 809:	89 c2                	mov    %eax,%edx
+ 80b:	39 05 80 0e 00 00    	cmp    %eax,0xe80
+ 811:	75 ed                	jne    800 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 813:	83 ec 0c             	sub    $0xc,%esp
+ 816:	56                   	push   %esi
+ 817:	e8 3c fc ff ff       	call   458 <sbrk>
+  if(p == (char*)-1)
+ 81c:	83 c4 10             	add    $0x10,%esp
+ 81f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 822:	74 1c                	je     840 <malloc+0x80>
+  hp->s.size = nu;
+ 824:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 827:	83 ec 0c             	sub    $0xc,%esp
+ 82a:	83 c0 08             	add    $0x8,%eax
+ 82d:	50                   	push   %eax
+ 82e:	e8 fd fe ff ff       	call   730 <free>
+  return freep;
+ 833:	8b 15 80 0e 00 00    	mov    0xe80,%edx
+      if((p = morecore(nunits)) == 0)
+ 839:	83 c4 10             	add    $0x10,%esp
+ 83c:	85 d2                	test   %edx,%edx
+ 83e:	75 c0                	jne    800 <malloc+0x40>
+        return 0;
+  }
+}
+ 840:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 843:	31 c0                	xor    %eax,%eax
+}
+ 845:	5b                   	pop    %ebx
+ 846:	5e                   	pop    %esi
+ 847:	5f                   	pop    %edi
+ 848:	5d                   	pop    %ebp
+ 849:	c3                   	ret
+ 84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 850:	39 cf                	cmp    %ecx,%edi
+ 852:	74 4c                	je     8a0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 854:	29 f9                	sub    %edi,%ecx
+ 856:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 859:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 85c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 85f:	89 15 80 0e 00 00    	mov    %edx,0xe80
+}
+ 865:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 868:	83 c0 08             	add    $0x8,%eax
+}
+ 86b:	5b                   	pop    %ebx
+ 86c:	5e                   	pop    %esi
+ 86d:	5f                   	pop    %edi
+ 86e:	5d                   	pop    %ebp
+ 86f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 870:	c7 05 80 0e 00 00 84 	movl   $0xe84,0xe80
+ 877:	0e 00 00 
+    base.s.size = 0;
+ 87a:	b8 84 0e 00 00       	mov    $0xe84,%eax
+    base.s.ptr = freep = prevp = &base;
+ 87f:	c7 05 84 0e 00 00 84 	movl   $0xe84,0xe84
+ 886:	0e 00 00 
+    base.s.size = 0;
+ 889:	c7 05 88 0e 00 00 00 	movl   $0x0,0xe88
+ 890:	00 00 00 
+    if(p->s.size >= nunits){
+ 893:	e9 54 ff ff ff       	jmp    7ec <malloc+0x2c>
+ 898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8a0:	8b 08                	mov    (%eax),%ecx
+ 8a2:	89 0a                	mov    %ecx,(%edx)
+ 8a4:	eb b9                	jmp    85f <malloc+0x9f>
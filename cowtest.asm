@@ -0,0 +1,1931 @@
+
+_cowtest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "cow free test OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "cowtest starting\n");
+  11:	68 a8 0e 00 00       	push   $0xea8
+  16:	6a 01                	push   $0x1
+  18:	e8 c3 0a 00 00       	call   ae0 <printf>
+  cowtest();
+  1d:	e8 1e 00 00 00       	call   40 <cowtest>
+  cowsbrktest();
+  22:	e8 99 02 00 00       	call   2c0 <cowsbrktest>
+  cowfreetest();
+  27:	e8 b4 04 00 00       	call   4e0 <cowfreetest>
+  printf(1, "cowtest: all tests passed\n");
+  2c:	58                   	pop    %eax
+  2d:	5a                   	pop    %edx
+  2e:	68 ba 0e 00 00       	push   $0xeba
+  33:	6a 01                	push   $0x1
+  35:	e8 a6 0a 00 00       	call   ae0 <printf>
+  exit();
+  3a:	e8 f1 08 00 00       	call   930 <exit>
+  3f:	90                   	nop
+
+00000040 <cowtest>:
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	57                   	push   %edi
+  44:	56                   	push   %esi
+  45:	53                   	push   %ebx
+  46:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "cow test\n");
+  49:	68 08 0e 00 00       	push   $0xe08
+  4e:	6a 01                	push   $0x1
+  50:	e8 8b 0a 00 00       	call   ae0 <printf>
+  if((p = sbrk(COWSIZE)) == (char*)-1){
+  55:	c7 04 24 00 00 02 00 	movl   $0x20000,(%esp)
+  5c:	e8 57 09 00 00       	call   9b8 <sbrk>
+  61:	83 c4 10             	add    $0x10,%esp
+  64:	83 f8 ff             	cmp    $0xffffffff,%eax
+  67:	0f 84 6e 01 00 00    	je     1db <cowtest+0x19b>
+  memset(p, 'a', COWSIZE);
+  6d:	83 ec 04             	sub    $0x4,%esp
+  70:	89 c3                	mov    %eax,%ebx
+  72:	68 00 00 02 00       	push   $0x20000
+  77:	6a 61                	push   $0x61
+  79:	50                   	push   %eax
+  7a:	e8 b1 06 00 00       	call   730 <memset>
+  if(pipe(tochild) != 0 || pipe(toparent) != 0){
+  7f:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  82:	89 04 24             	mov    %eax,(%esp)
+  85:	e8 b6 08 00 00       	call   940 <pipe>
+  8a:	83 c4 10             	add    $0x10,%esp
+  8d:	85 c0                	test   %eax,%eax
+  8f:	0f 85 33 01 00 00    	jne    1c8 <cowtest+0x188>
+  95:	83 ec 0c             	sub    $0xc,%esp
+  98:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  9b:	50                   	push   %eax
+  9c:	e8 9f 08 00 00       	call   940 <pipe>
+  a1:	83 c4 10             	add    $0x10,%esp
+  a4:	85 c0                	test   %eax,%eax
+  a6:	0f 85 1c 01 00 00    	jne    1c8 <cowtest+0x188>
+  pid = fork();
+  ac:	e8 77 08 00 00       	call   928 <fork>
+  if(pid < 0){
+  b1:	85 c0                	test   %eax,%eax
+  b3:	0f 88 54 01 00 00    	js     20d <cowtest+0x1cd>
+  if(pid == 0){
+  b9:	0f 84 2f 01 00 00    	je     1ee <cowtest+0x1ae>
+  read(toparent[0], &ok, 1);
+  bf:	83 ec 04             	sub    $0x4,%esp
+  c2:	8d 45 d7             	lea    -0x29(%ebp),%eax
+  c5:	6a 01                	push   $0x1
+  c7:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  ca:	50                   	push   %eax
+  cb:	ff 75 e0             	push   -0x20(%ebp)
+  ce:	e8 75 08 00 00       	call   948 <read>
+  if(ok != 'y'){
+  d3:	83 c4 10             	add    $0x10,%esp
+  d6:	80 7d d7 79          	cmpb   $0x79,-0x29(%ebp)
+  da:	0f 85 ad 01 00 00    	jne    28d <cowtest+0x24d>
+  e0:	89 df                	mov    %ebx,%edi
+  e2:	8d b3 00 00 02 00    	lea    0x20000(%ebx),%esi
+  e8:	89 d8                	mov    %ebx,%eax
+  ea:	eb 0b                	jmp    f7 <cowtest+0xb7>
+  ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < n; i++)
+  f0:	83 c0 01             	add    $0x1,%eax
+  f3:	39 f0                	cmp    %esi,%eax
+  f5:	74 19                	je     110 <cowtest+0xd0>
+    if(p[i] != c)
+  f7:	80 38 61             	cmpb   $0x61,(%eax)
+  fa:	74 f4                	je     f0 <cowtest+0xb0>
+    printf(1, "cow: parent saw the child's write\n");
+  fc:	50                   	push   %eax
+  fd:	50                   	push   %eax
+  fe:	68 28 0f 00 00       	push   $0xf28
+ 103:	6a 01                	push   $0x1
+ 105:	e8 d6 09 00 00       	call   ae0 <printf>
+    exit();
+ 10a:	e8 21 08 00 00       	call   930 <exit>
+ 10f:	90                   	nop
+  memset(p, 'p', COWSIZE);
+ 110:	83 ec 04             	sub    $0x4,%esp
+ 113:	68 00 00 02 00       	push   $0x20000
+ 118:	6a 70                	push   $0x70
+ 11a:	53                   	push   %ebx
+ 11b:	e8 10 06 00 00       	call   730 <memset>
+  write(tochild[1], "x", 1);
+ 120:	83 c4 0c             	add    $0xc,%esp
+ 123:	6a 01                	push   $0x1
+ 125:	68 64 0e 00 00       	push   $0xe64
+ 12a:	ff 75 dc             	push   -0x24(%ebp)
+ 12d:	e8 1e 08 00 00       	call   950 <write>
+  read(toparent[0], &ok, 1);
+ 132:	83 c4 0c             	add    $0xc,%esp
+ 135:	6a 01                	push   $0x1
+ 137:	ff 75 c4             	push   -0x3c(%ebp)
+ 13a:	ff 75 e0             	push   -0x20(%ebp)
+ 13d:	e8 06 08 00 00       	call   948 <read>
+  if(ok != 'y'){
+ 142:	83 c4 10             	add    $0x10,%esp
+ 145:	80 7d d7 79          	cmpb   $0x79,-0x29(%ebp)
+ 149:	0f 85 51 01 00 00    	jne    2a0 <cowtest+0x260>
+  wait();
+ 14f:	e8 e4 07 00 00       	call   938 <wait>
+  for(i = 0; i < n; i++)
+ 154:	eb 11                	jmp    167 <cowtest+0x127>
+ 156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+ 160:	83 c7 01             	add    $0x1,%edi
+ 163:	39 f7                	cmp    %esi,%edi
+ 165:	74 19                	je     180 <cowtest+0x140>
+    if(p[i] != c)
+ 167:	80 3f 70             	cmpb   $0x70,(%edi)
+ 16a:	74 f4                	je     160 <cowtest+0x120>
+    printf(1, "cow: parent lost its write\n");
+ 16c:	52                   	push   %edx
+ 16d:	52                   	push   %edx
+ 16e:	68 48 0e 00 00       	push   $0xe48
+ 173:	6a 01                	push   $0x1
+ 175:	e8 66 09 00 00       	call   ae0 <printf>
+    exit();
+ 17a:	e8 b1 07 00 00       	call   930 <exit>
+ 17f:	90                   	nop
+  close(tochild[0]);
+ 180:	83 ec 0c             	sub    $0xc,%esp
+ 183:	ff 75 d8             	push   -0x28(%ebp)
+ 186:	e8 cd 07 00 00       	call   958 <close>
+  close(tochild[1]);
+ 18b:	59                   	pop    %ecx
+ 18c:	ff 75 dc             	push   -0x24(%ebp)
+ 18f:	e8 c4 07 00 00       	call   958 <close>
+  close(toparent[0]);
+ 194:	5b                   	pop    %ebx
+ 195:	ff 75 e0             	push   -0x20(%ebp)
+ 198:	e8 bb 07 00 00       	call   958 <close>
+  close(toparent[1]);
+ 19d:	5e                   	pop    %esi
+ 19e:	ff 75 e4             	push   -0x1c(%ebp)
+ 1a1:	e8 b2 07 00 00       	call   958 <close>
+  sbrk(-COWSIZE);
+ 1a6:	c7 04 24 00 00 fe ff 	movl   $0xfffe0000,(%esp)
+ 1ad:	e8 06 08 00 00       	call   9b8 <sbrk>
+  printf(1, "cow test OK\n");
+ 1b2:	5f                   	pop    %edi
+ 1b3:	58                   	pop    %eax
+ 1b4:	68 3b 0e 00 00       	push   $0xe3b
+ 1b9:	6a 01                	push   $0x1
+ 1bb:	e8 20 09 00 00       	call   ae0 <printf>
+}
+ 1c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1c3:	5b                   	pop    %ebx
+ 1c4:	5e                   	pop    %esi
+ 1c5:	5f                   	pop    %edi
+ 1c6:	5d                   	pop    %ebp
+ 1c7:	c3                   	ret
+    printf(1, "pipe() failed\n");
+ 1c8:	51                   	push   %ecx
+ 1c9:	51                   	push   %ecx
+ 1ca:	68 1f 0e 00 00       	push   $0xe1f
+ 1cf:	6a 01                	push   $0x1
+ 1d1:	e8 0a 09 00 00       	call   ae0 <printf>
+    exit();
+ 1d6:	e8 55 07 00 00       	call   930 <exit>
+    printf(1, "sbrk failed\n");
+ 1db:	53                   	push   %ebx
+ 1dc:	53                   	push   %ebx
+ 1dd:	68 12 0e 00 00       	push   $0xe12
+ 1e2:	6a 01                	push   $0x1
+ 1e4:	e8 f7 08 00 00       	call   ae0 <printf>
+    exit();
+ 1e9:	e8 42 07 00 00       	call   930 <exit>
+ 1ee:	89 df                	mov    %ebx,%edi
+ 1f0:	8d b3 00 00 02 00    	lea    0x20000(%ebx),%esi
+  if(pid == 0){
+ 1f6:	89 d8                	mov    %ebx,%eax
+ 1f8:	eb 07                	jmp    201 <cowtest+0x1c1>
+  for(i = 0; i < n; i++)
+ 1fa:	83 c0 01             	add    $0x1,%eax
+ 1fd:	39 f0                	cmp    %esi,%eax
+ 1ff:	74 1f                	je     220 <cowtest+0x1e0>
+    if(p[i] != c)
+ 201:	80 38 61             	cmpb   $0x61,(%eax)
+ 204:	74 f4                	je     1fa <cowtest+0x1ba>
+    ok = allequal(p, COWSIZE, 'a') ? 'y' : 'n';
+ 206:	b8 6e 00 00 00       	mov    $0x6e,%eax
+ 20b:	eb 18                	jmp    225 <cowtest+0x1e5>
+    printf(1, "fork failed\n");
+ 20d:	52                   	push   %edx
+ 20e:	52                   	push   %edx
+ 20f:	68 2e 0e 00 00       	push   $0xe2e
+ 214:	6a 01                	push   $0x1
+ 216:	e8 c5 08 00 00       	call   ae0 <printf>
+    exit();
+ 21b:	e8 10 07 00 00       	call   930 <exit>
+    ok = allequal(p, COWSIZE, 'a') ? 'y' : 'n';
+ 220:	b8 79 00 00 00       	mov    $0x79,%eax
+ 225:	88 45 d7             	mov    %al,-0x29(%ebp)
+    memset(p, 'c', COWSIZE);
+ 228:	50                   	push   %eax
+ 229:	68 00 00 02 00       	push   $0x20000
+ 22e:	6a 63                	push   $0x63
+ 230:	53                   	push   %ebx
+ 231:	e8 fa 04 00 00       	call   730 <memset>
+    write(toparent[1], &ok, 1);
+ 236:	83 c4 0c             	add    $0xc,%esp
+ 239:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 23c:	6a 01                	push   $0x1
+ 23e:	89 c3                	mov    %eax,%ebx
+ 240:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 243:	50                   	push   %eax
+ 244:	ff 75 e4             	push   -0x1c(%ebp)
+ 247:	e8 04 07 00 00       	call   950 <write>
+    read(tochild[0], &ok, 1);
+ 24c:	83 c4 0c             	add    $0xc,%esp
+ 24f:	6a 01                	push   $0x1
+ 251:	53                   	push   %ebx
+ 252:	ff 75 d8             	push   -0x28(%ebp)
+ 255:	e8 ee 06 00 00       	call   948 <read>
+ 25a:	83 c4 10             	add    $0x10,%esp
+ 25d:	eb 07                	jmp    266 <cowtest+0x226>
+  for(i = 0; i < n; i++)
+ 25f:	83 c7 01             	add    $0x1,%edi
+ 262:	39 f7                	cmp    %esi,%edi
+ 264:	74 0c                	je     272 <cowtest+0x232>
+    if(p[i] != c)
+ 266:	80 3f 63             	cmpb   $0x63,(%edi)
+ 269:	74 f4                	je     25f <cowtest+0x21f>
+    ok = allequal(p, COWSIZE, 'c') ? 'y' : 'n';
+ 26b:	b8 6e 00 00 00       	mov    $0x6e,%eax
+ 270:	eb 05                	jmp    277 <cowtest+0x237>
+ 272:	b8 79 00 00 00       	mov    $0x79,%eax
+ 277:	88 45 d7             	mov    %al,-0x29(%ebp)
+    write(toparent[1], &ok, 1);
+ 27a:	50                   	push   %eax
+ 27b:	6a 01                	push   $0x1
+ 27d:	ff 75 c4             	push   -0x3c(%ebp)
+ 280:	ff 75 e4             	push   -0x1c(%ebp)
+ 283:	e8 c8 06 00 00       	call   950 <write>
+    exit();
+ 288:	e8 a3 06 00 00       	call   930 <exit>
+    printf(1, "cow: child did not see the parent's memory\n");
+ 28d:	50                   	push   %eax
+ 28e:	50                   	push   %eax
+ 28f:	68 d8 0e 00 00       	push   $0xed8
+ 294:	6a 01                	push   $0x1
+ 296:	e8 45 08 00 00       	call   ae0 <printf>
+    exit();
+ 29b:	e8 90 06 00 00       	call   930 <exit>
+    printf(1, "cow: child saw the parent's write\n");
+ 2a0:	50                   	push   %eax
+ 2a1:	50                   	push   %eax
+ 2a2:	68 04 0f 00 00       	push   $0xf04
+ 2a7:	6a 01                	push   $0x1
+ 2a9:	e8 32 08 00 00       	call   ae0 <printf>
+    exit();
+ 2ae:	e8 7d 06 00 00       	call   930 <exit>
+ 2b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000002c0 <cowsbrktest>:
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	56                   	push   %esi
+ 2c4:	53                   	push   %ebx
+ 2c5:	83 ec 18             	sub    $0x18,%esp
+  printf(1, "cow sbrk test\n");
+ 2c8:	68 66 0e 00 00       	push   $0xe66
+ 2cd:	6a 01                	push   $0x1
+ 2cf:	e8 0c 08 00 00       	call   ae0 <printf>
+  if((p = sbrk(COWSIZE)) == (char*)-1){
+ 2d4:	c7 04 24 00 00 02 00 	movl   $0x20000,(%esp)
+ 2db:	e8 d8 06 00 00       	call   9b8 <sbrk>
+ 2e0:	83 c4 10             	add    $0x10,%esp
+ 2e3:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 2e6:	0f 84 54 01 00 00    	je     440 <cowsbrktest+0x180>
+  memset(p, 'a', COWSIZE);
+ 2ec:	83 ec 04             	sub    $0x4,%esp
+ 2ef:	89 c3                	mov    %eax,%ebx
+ 2f1:	68 00 00 02 00       	push   $0x20000
+ 2f6:	6a 61                	push   $0x61
+ 2f8:	50                   	push   %eax
+ 2f9:	e8 32 04 00 00       	call   730 <memset>
+  pid = fork();
+ 2fe:	e8 25 06 00 00       	call   928 <fork>
+  if(pid < 0){
+ 303:	83 c4 10             	add    $0x10,%esp
+ 306:	85 c0                	test   %eax,%eax
+ 308:	0f 88 1f 01 00 00    	js     42d <cowsbrktest+0x16d>
+  if(pid == 0){
+ 30e:	75 58                	jne    368 <cowsbrktest+0xa8>
+    sbrk(-COWSIZE);
+ 310:	83 ec 0c             	sub    $0xc,%esp
+ 313:	68 00 00 fe ff       	push   $0xfffe0000
+ 318:	e8 9b 06 00 00       	call   9b8 <sbrk>
+    if(sbrk(COWSIZE) != p || !allequal(p, COWSIZE, 0)){
+ 31d:	c7 04 24 00 00 02 00 	movl   $0x20000,(%esp)
+ 324:	e8 8f 06 00 00       	call   9b8 <sbrk>
+ 329:	83 c4 10             	add    $0x10,%esp
+ 32c:	39 c3                	cmp    %eax,%ebx
+ 32e:	75 20                	jne    350 <cowsbrktest+0x90>
+ 330:	89 da                	mov    %ebx,%edx
+ 332:	8d 83 00 00 02 00    	lea    0x20000(%ebx),%eax
+ 338:	eb 11                	jmp    34b <cowsbrktest+0x8b>
+ 33a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < n; i++)
+ 340:	83 c2 01             	add    $0x1,%edx
+ 343:	39 c2                	cmp    %eax,%edx
+ 345:	0f 84 cd 00 00 00    	je     418 <cowsbrktest+0x158>
+    if(p[i] != c)
+ 34b:	80 3a 00             	cmpb   $0x0,(%edx)
+ 34e:	74 f0                	je     340 <cowsbrktest+0x80>
+      printf(1, "cow sbrk: regrown memory is not zero\n");
+ 350:	83 ec 08             	sub    $0x8,%esp
+ 353:	68 4c 0f 00 00       	push   $0xf4c
+ 358:	6a 01                	push   $0x1
+ 35a:	e8 81 07 00 00       	call   ae0 <printf>
+      exit();
+ 35f:	e8 cc 05 00 00       	call   930 <exit>
+ 364:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+ 368:	e8 cb 05 00 00       	call   938 <wait>
+  for(i = 0; i < n; i++)
+ 36d:	8d b3 00 00 02 00    	lea    0x20000(%ebx),%esi
+  wait();
+ 373:	89 da                	mov    %ebx,%edx
+ 375:	eb 10                	jmp    387 <cowsbrktest+0xc7>
+ 377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37e:	66 90                	xchg   %ax,%ax
+  for(i = 0; i < n; i++)
+ 380:	83 c2 01             	add    $0x1,%edx
+ 383:	39 f2                	cmp    %esi,%edx
+ 385:	74 19                	je     3a0 <cowsbrktest+0xe0>
+    if(p[i] != c)
+ 387:	80 3a 61             	cmpb   $0x61,(%edx)
+ 38a:	74 f4                	je     380 <cowsbrktest+0xc0>
+    printf(1, "cow sbrk: child's shrink changed the parent\n");
+ 38c:	50                   	push   %eax
+ 38d:	50                   	push   %eax
+ 38e:	68 a4 0f 00 00       	push   $0xfa4
+ 393:	6a 01                	push   $0x1
+ 395:	e8 46 07 00 00       	call   ae0 <printf>
+    exit();
+ 39a:	e8 91 05 00 00       	call   930 <exit>
+ 39f:	90                   	nop
+  if(pipe(fds) != 0){
+ 3a0:	83 ec 0c             	sub    $0xc,%esp
+ 3a3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 3a6:	50                   	push   %eax
+ 3a7:	e8 94 05 00 00       	call   940 <pipe>
+ 3ac:	83 c4 10             	add    $0x10,%esp
+ 3af:	85 c0                	test   %eax,%eax
+ 3b1:	0f 85 d2 00 00 00    	jne    489 <cowsbrktest+0x1c9>
+  pid = fork();
+ 3b7:	e8 6c 05 00 00       	call   928 <fork>
+  if(pid < 0){
+ 3bc:	85 c0                	test   %eax,%eax
+ 3be:	78 6d                	js     42d <cowsbrktest+0x16d>
+  if(pid == 0){
+ 3c0:	0f 84 8d 00 00 00    	je     453 <cowsbrktest+0x193>
+  sbrk(-COWSIZE);
+ 3c6:	83 ec 0c             	sub    $0xc,%esp
+ 3c9:	68 00 00 fe ff       	push   $0xfffe0000
+ 3ce:	e8 e5 05 00 00       	call   9b8 <sbrk>
+  write(fds[1], "x", 1);
+ 3d3:	83 c4 0c             	add    $0xc,%esp
+ 3d6:	6a 01                	push   $0x1
+ 3d8:	68 64 0e 00 00       	push   $0xe64
+ 3dd:	ff 75 f4             	push   -0xc(%ebp)
+ 3e0:	e8 6b 05 00 00       	call   950 <write>
+  wait();
+ 3e5:	e8 4e 05 00 00       	call   938 <wait>
+  close(fds[0]);
+ 3ea:	59                   	pop    %ecx
+ 3eb:	ff 75 f0             	push   -0x10(%ebp)
+ 3ee:	e8 65 05 00 00       	call   958 <close>
+  close(fds[1]);
+ 3f3:	5b                   	pop    %ebx
+ 3f4:	ff 75 f4             	push   -0xc(%ebp)
+ 3f7:	e8 5c 05 00 00       	call   958 <close>
+  printf(1, "cow sbrk test OK\n");
+ 3fc:	5e                   	pop    %esi
+ 3fd:	58                   	pop    %eax
+ 3fe:	68 75 0e 00 00       	push   $0xe75
+ 403:	6a 01                	push   $0x1
+ 405:	e8 d6 06 00 00       	call   ae0 <printf>
+}
+ 40a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 40d:	5b                   	pop    %ebx
+ 40e:	5e                   	pop    %esi
+ 40f:	5d                   	pop    %ebp
+ 410:	c3                   	ret
+ 411:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(p, 'c', COWSIZE);
+ 418:	83 ec 04             	sub    $0x4,%esp
+ 41b:	68 00 00 02 00       	push   $0x20000
+ 420:	6a 63                	push   $0x63
+ 422:	53                   	push   %ebx
+ 423:	e8 08 03 00 00       	call   730 <memset>
+    exit();
+ 428:	e8 03 05 00 00       	call   930 <exit>
+    printf(1, "fork failed\n");
+ 42d:	50                   	push   %eax
+ 42e:	50                   	push   %eax
+ 42f:	68 2e 0e 00 00       	push   $0xe2e
+ 434:	6a 01                	push   $0x1
+ 436:	e8 a5 06 00 00       	call   ae0 <printf>
+    exit();
+ 43b:	e8 f0 04 00 00       	call   930 <exit>
+    printf(1, "sbrk failed\n");
+ 440:	50                   	push   %eax
+ 441:	50                   	push   %eax
+ 442:	68 12 0e 00 00       	push   $0xe12
+ 447:	6a 01                	push   $0x1
+ 449:	e8 92 06 00 00       	call   ae0 <printf>
+    exit();
+ 44e:	e8 dd 04 00 00       	call   930 <exit>
+    read(fds[0], &ok, 1);
+ 453:	50                   	push   %eax
+ 454:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 457:	6a 01                	push   $0x1
+ 459:	50                   	push   %eax
+ 45a:	ff 75 f0             	push   -0x10(%ebp)
+ 45d:	e8 e6 04 00 00       	call   948 <read>
+ 462:	83 c4 10             	add    $0x10,%esp
+ 465:	eb 07                	jmp    46e <cowsbrktest+0x1ae>
+  for(i = 0; i < n; i++)
+ 467:	83 c3 01             	add    $0x1,%ebx
+ 46a:	39 f3                	cmp    %esi,%ebx
+ 46c:	74 16                	je     484 <cowsbrktest+0x1c4>
+    if(p[i] != c)
+ 46e:	80 3b 61             	cmpb   $0x61,(%ebx)
+ 471:	74 f4                	je     467 <cowsbrktest+0x1a7>
+      printf(1, "cow sbrk: parent's shrink changed the child\n");
+ 473:	52                   	push   %edx
+ 474:	52                   	push   %edx
+ 475:	68 74 0f 00 00       	push   $0xf74
+ 47a:	6a 01                	push   $0x1
+ 47c:	e8 5f 06 00 00       	call   ae0 <printf>
+ 481:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 484:	e8 a7 04 00 00       	call   930 <exit>
+    printf(1, "pipe() failed\n");
+ 489:	50                   	push   %eax
+ 48a:	50                   	push   %eax
+ 48b:	68 1f 0e 00 00       	push   $0xe1f
+ 490:	6a 01                	push   $0x1
+ 492:	e8 49 06 00 00       	call   ae0 <printf>
+    exit();
+ 497:	e8 94 04 00 00       	call   930 <exit>
+ 49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <countfree>:
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	53                   	push   %ebx
+  for(n = 0; sbrk(4096) != (char*)-1; n++)
+ 4a4:	31 db                	xor    %ebx,%ebx
+{
+ 4a6:	83 ec 04             	sub    $0x4,%esp
+  for(n = 0; sbrk(4096) != (char*)-1; n++)
+ 4a9:	eb 08                	jmp    4b3 <countfree+0x13>
+ 4ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4af:	90                   	nop
+ 4b0:	83 c3 01             	add    $0x1,%ebx
+ 4b3:	83 ec 0c             	sub    $0xc,%esp
+ 4b6:	68 00 10 00 00       	push   $0x1000
+ 4bb:	e8 f8 04 00 00       	call   9b8 <sbrk>
+ 4c0:	83 c4 10             	add    $0x10,%esp
+ 4c3:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 4c6:	75 e8                	jne    4b0 <countfree+0x10>
+  sbrk(-n * 4096);
+ 4c8:	89 d8                	mov    %ebx,%eax
+ 4ca:	83 ec 0c             	sub    $0xc,%esp
+ 4cd:	f7 d8                	neg    %eax
+ 4cf:	c1 e0 0c             	shl    $0xc,%eax
+ 4d2:	50                   	push   %eax
+ 4d3:	e8 e0 04 00 00       	call   9b8 <sbrk>
+}
+ 4d8:	89 d8                	mov    %ebx,%eax
+ 4da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4dd:	c9                   	leave
+ 4de:	c3                   	ret
+ 4df:	90                   	nop
+
+000004e0 <cowfreetest>:
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+  for(n = 0; sbrk(4096) != (char*)-1; n++)
+ 4e5:	31 f6                	xor    %esi,%esi
+{
+ 4e7:	53                   	push   %ebx
+ 4e8:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "cow free test\n");
+ 4eb:	68 87 0e 00 00       	push   $0xe87
+ 4f0:	6a 01                	push   $0x1
+ 4f2:	e8 e9 05 00 00       	call   ae0 <printf>
+ 4f7:	83 c4 10             	add    $0x10,%esp
+ 4fa:	eb 07                	jmp    503 <cowfreetest+0x23>
+ 4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(n = 0; sbrk(4096) != (char*)-1; n++)
+ 500:	83 c6 01             	add    $0x1,%esi
+ 503:	83 ec 0c             	sub    $0xc,%esp
+ 506:	68 00 10 00 00       	push   $0x1000
+ 50b:	e8 a8 04 00 00       	call   9b8 <sbrk>
+ 510:	83 c4 10             	add    $0x10,%esp
+ 513:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 516:	75 e8                	jne    500 <cowfreetest+0x20>
+  sbrk(-n * 4096);
+ 518:	89 f0                	mov    %esi,%eax
+ 51a:	83 ec 0c             	sub    $0xc,%esp
+ 51d:	f7 d8                	neg    %eax
+ 51f:	c1 e0 0c             	shl    $0xc,%eax
+ 522:	50                   	push   %eax
+ 523:	e8 90 04 00 00       	call   9b8 <sbrk>
+  if((p = sbrk(COWSIZE)) == (char*)-1){
+ 528:	c7 04 24 00 00 02 00 	movl   $0x20000,(%esp)
+ 52f:	e8 84 04 00 00       	call   9b8 <sbrk>
+ 534:	83 c4 10             	add    $0x10,%esp
+ 537:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 53a:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 53d:	0f 84 ff 00 00 00    	je     642 <cowfreetest+0x162>
+  memset(p, 'a', COWSIZE);
+ 543:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < 50; i++){
+ 546:	31 db                	xor    %ebx,%ebx
+  memset(p, 'a', COWSIZE);
+ 548:	68 00 00 02 00       	push   $0x20000
+ 54d:	6a 61                	push   $0x61
+ 54f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 552:	57                   	push   %edi
+      memset(p + COWSIZE/2, 'p', COWSIZE/2);
+ 553:	8d bf 00 00 01 00    	lea    0x10000(%edi),%edi
+  memset(p, 'a', COWSIZE);
+ 559:	e8 d2 01 00 00       	call   730 <memset>
+ 55e:	83 c4 10             	add    $0x10,%esp
+ 561:	eb 12                	jmp    575 <cowfreetest+0x95>
+ 563:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 567:	90                   	nop
+    wait();
+ 568:	e8 cb 03 00 00       	call   938 <wait>
+  for(i = 0; i < 50; i++){
+ 56d:	83 c3 01             	add    $0x1,%ebx
+ 570:	83 fb 32             	cmp    $0x32,%ebx
+ 573:	74 38                	je     5ad <cowfreetest+0xcd>
+    pid = fork();
+ 575:	e8 ae 03 00 00       	call   928 <fork>
+    if(pid < 0){
+ 57a:	85 c0                	test   %eax,%eax
+ 57c:	0f 88 95 00 00 00    	js     617 <cowfreetest+0x137>
+    if(pid == 0){
+ 582:	0f 84 a3 00 00 00    	je     62b <cowfreetest+0x14b>
+    if(i % 2)
+ 588:	f6 c3 01             	test   $0x1,%bl
+ 58b:	74 db                	je     568 <cowfreetest+0x88>
+      memset(p + COWSIZE/2, 'p', COWSIZE/2);
+ 58d:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < 50; i++){
+ 590:	83 c3 01             	add    $0x1,%ebx
+      memset(p + COWSIZE/2, 'p', COWSIZE/2);
+ 593:	68 00 00 01 00       	push   $0x10000
+ 598:	6a 70                	push   $0x70
+ 59a:	57                   	push   %edi
+ 59b:	e8 90 01 00 00       	call   730 <memset>
+ 5a0:	83 c4 10             	add    $0x10,%esp
+    wait();
+ 5a3:	e8 90 03 00 00       	call   938 <wait>
+  for(i = 0; i < 50; i++){
+ 5a8:	83 fb 32             	cmp    $0x32,%ebx
+ 5ab:	75 c8                	jne    575 <cowfreetest+0x95>
+  sbrk(-COWSIZE);
+ 5ad:	83 ec 0c             	sub    $0xc,%esp
+  for(n = 0; sbrk(4096) != (char*)-1; n++)
+ 5b0:	31 db                	xor    %ebx,%ebx
+  sbrk(-COWSIZE);
+ 5b2:	68 00 00 fe ff       	push   $0xfffe0000
+ 5b7:	e8 fc 03 00 00       	call   9b8 <sbrk>
+ 5bc:	83 c4 10             	add    $0x10,%esp
+ 5bf:	eb 0a                	jmp    5cb <cowfreetest+0xeb>
+ 5c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(n = 0; sbrk(4096) != (char*)-1; n++)
+ 5c8:	83 c3 01             	add    $0x1,%ebx
+ 5cb:	83 ec 0c             	sub    $0xc,%esp
+ 5ce:	68 00 10 00 00       	push   $0x1000
+ 5d3:	e8 e0 03 00 00       	call   9b8 <sbrk>
+ 5d8:	83 c4 10             	add    $0x10,%esp
+ 5db:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 5de:	75 e8                	jne    5c8 <cowfreetest+0xe8>
+  sbrk(-n * 4096);
+ 5e0:	89 d8                	mov    %ebx,%eax
+ 5e2:	83 ec 0c             	sub    $0xc,%esp
+ 5e5:	f7 d8                	neg    %eax
+ 5e7:	c1 e0 0c             	shl    $0xc,%eax
+ 5ea:	50                   	push   %eax
+ 5eb:	e8 c8 03 00 00       	call   9b8 <sbrk>
+  if(after + CACHESLACK < before){
+ 5f0:	8d 83 00 04 00 00    	lea    0x400(%ebx),%eax
+ 5f6:	83 c4 10             	add    $0x10,%esp
+ 5f9:	39 f0                	cmp    %esi,%eax
+ 5fb:	7c 58                	jl     655 <cowfreetest+0x175>
+  printf(1, "cow free test OK\n");
+ 5fd:	83 ec 08             	sub    $0x8,%esp
+ 600:	68 96 0e 00 00       	push   $0xe96
+ 605:	6a 01                	push   $0x1
+ 607:	e8 d4 04 00 00       	call   ae0 <printf>
+}
+ 60c:	83 c4 10             	add    $0x10,%esp
+ 60f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 612:	5b                   	pop    %ebx
+ 613:	5e                   	pop    %esi
+ 614:	5f                   	pop    %edi
+ 615:	5d                   	pop    %ebp
+ 616:	c3                   	ret
+      printf(1, "fork failed\n");
+ 617:	83 ec 08             	sub    $0x8,%esp
+ 61a:	68 2e 0e 00 00       	push   $0xe2e
+ 61f:	6a 01                	push   $0x1
+ 621:	e8 ba 04 00 00       	call   ae0 <printf>
+      exit();
+ 626:	e8 05 03 00 00       	call   930 <exit>
+      memset(p, 'c', COWSIZE/2);
+ 62b:	83 ec 04             	sub    $0x4,%esp
+ 62e:	68 00 00 01 00       	push   $0x10000
+ 633:	6a 63                	push   $0x63
+ 635:	ff 75 e4             	push   -0x1c(%ebp)
+ 638:	e8 f3 00 00 00       	call   730 <memset>
+      exit();
+ 63d:	e8 ee 02 00 00       	call   930 <exit>
+    printf(1, "sbrk failed\n");
+ 642:	50                   	push   %eax
+ 643:	50                   	push   %eax
+ 644:	68 12 0e 00 00       	push   $0xe12
+ 649:	6a 01                	push   $0x1
+ 64b:	e8 90 04 00 00       	call   ae0 <printf>
+    exit();
+ 650:	e8 db 02 00 00       	call   930 <exit>
+    printf(1, "cow free: %d pages free before, %d after\n", before, after);
+ 655:	53                   	push   %ebx
+ 656:	56                   	push   %esi
+ 657:	68 d4 0f 00 00       	push   $0xfd4
+ 65c:	6a 01                	push   $0x1
+ 65e:	e8 7d 04 00 00       	call   ae0 <printf>
+    exit();
+ 663:	e8 c8 02 00 00       	call   930 <exit>
+ 668:	66 90                	xchg   %ax,%ax
+ 66a:	66 90                	xchg   %ax,%ax
+ 66c:	66 90                	xchg   %ax,%ax
+ 66e:	66 90                	xchg   %ax,%ax
+
+00000670 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 670:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 671:	31 c0                	xor    %eax,%eax
+{
+ 673:	89 e5                	mov    %esp,%ebp
+ 675:	53                   	push   %ebx
+ 676:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 679:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 67c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 680:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 684:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 687:	83 c0 01             	add    $0x1,%eax
+ 68a:	84 d2                	test   %dl,%dl
+ 68c:	75 f2                	jne    680 <strcpy+0x10>
+    ;
+  return os;
+}
+ 68e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 691:	89 c8                	mov    %ecx,%eax
+ 693:	c9                   	leave
+ 694:	c3                   	ret
+ 695:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	53                   	push   %ebx
+ 6a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 6aa:	0f b6 02             	movzbl (%edx),%eax
+ 6ad:	84 c0                	test   %al,%al
+ 6af:	75 17                	jne    6c8 <strcmp+0x28>
+ 6b1:	eb 3a                	jmp    6ed <strcmp+0x4d>
+ 6b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6b7:	90                   	nop
+ 6b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 6bc:	83 c2 01             	add    $0x1,%edx
+ 6bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 6c2:	84 c0                	test   %al,%al
+ 6c4:	74 1a                	je     6e0 <strcmp+0x40>
+    p++, q++;
+ 6c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 6c8:	0f b6 19             	movzbl (%ecx),%ebx
+ 6cb:	38 c3                	cmp    %al,%bl
+ 6cd:	74 e9                	je     6b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 6cf:	29 d8                	sub    %ebx,%eax
+}
+ 6d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6d4:	c9                   	leave
+ 6d5:	c3                   	ret
+ 6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 6e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 6e4:	31 c0                	xor    %eax,%eax
+ 6e6:	29 d8                	sub    %ebx,%eax
+}
+ 6e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 6eb:	c9                   	leave
+ 6ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 6ed:	0f b6 19             	movzbl (%ecx),%ebx
+ 6f0:	31 c0                	xor    %eax,%eax
+ 6f2:	eb db                	jmp    6cf <strcmp+0x2f>
+ 6f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6ff:	90                   	nop
+
+00000700 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 700:	55                   	push   %ebp
+ 701:	89 e5                	mov    %esp,%ebp
+ 703:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 706:	80 3a 00             	cmpb   $0x0,(%edx)
+ 709:	74 15                	je     720 <strlen+0x20>
+ 70b:	31 c0                	xor    %eax,%eax
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+ 710:	83 c0 01             	add    $0x1,%eax
+ 713:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 717:	89 c1                	mov    %eax,%ecx
+ 719:	75 f5                	jne    710 <strlen+0x10>
+    ;
+  return n;
+}
+ 71b:	89 c8                	mov    %ecx,%eax
+ 71d:	5d                   	pop    %ebp
+ 71e:	c3                   	ret
+ 71f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 720:	31 c9                	xor    %ecx,%ecx
+}
+ 722:	5d                   	pop    %ebp
+ 723:	89 c8                	mov    %ecx,%eax
+ 725:	c3                   	ret
+ 726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000730 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	57                   	push   %edi
+ 734:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 737:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 73a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 73d:	89 d7                	mov    %edx,%edi
+ 73f:	fc                   	cld
+ 740:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 742:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 745:	89 d0                	mov    %edx,%eax
+ 747:	c9                   	leave
+ 748:	c3                   	ret
+ 749:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000750 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	8b 45 08             	mov    0x8(%ebp),%eax
+ 756:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 75a:	0f b6 10             	movzbl (%eax),%edx
+ 75d:	84 d2                	test   %dl,%dl
+ 75f:	75 12                	jne    773 <strchr+0x23>
+ 761:	eb 1d                	jmp    780 <strchr+0x30>
+ 763:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 767:	90                   	nop
+ 768:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 76c:	83 c0 01             	add    $0x1,%eax
+ 76f:	84 d2                	test   %dl,%dl
+ 771:	74 0d                	je     780 <strchr+0x30>
+    if(*s == c)
+ 773:	38 d1                	cmp    %dl,%cl
+ 775:	75 f1                	jne    768 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 777:	5d                   	pop    %ebp
+ 778:	c3                   	ret
+ 779:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 780:	31 c0                	xor    %eax,%eax
+}
+ 782:	5d                   	pop    %ebp
+ 783:	c3                   	ret
+ 784:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 78f:	90                   	nop
+
+00000790 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 795:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 798:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 799:	31 db                	xor    %ebx,%ebx
+{
+ 79b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 79e:	eb 27                	jmp    7c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 7a0:	83 ec 04             	sub    $0x4,%esp
+ 7a3:	6a 01                	push   $0x1
+ 7a5:	56                   	push   %esi
+ 7a6:	6a 00                	push   $0x0
+ 7a8:	e8 9b 01 00 00       	call   948 <read>
+    if(cc < 1)
+ 7ad:	83 c4 10             	add    $0x10,%esp
+ 7b0:	85 c0                	test   %eax,%eax
+ 7b2:	7e 1d                	jle    7d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 7b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 7b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 7bf:	3c 0a                	cmp    $0xa,%al
+ 7c1:	74 10                	je     7d3 <gets+0x43>
+ 7c3:	3c 0d                	cmp    $0xd,%al
+ 7c5:	74 0c                	je     7d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 7c7:	89 df                	mov    %ebx,%edi
+ 7c9:	83 c3 01             	add    $0x1,%ebx
+ 7cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 7cf:	7c cf                	jl     7a0 <gets+0x10>
+ 7d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 7d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 7da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7dd:	5b                   	pop    %ebx
+ 7de:	5e                   	pop    %esi
+ 7df:	5f                   	pop    %edi
+ 7e0:	5d                   	pop    %ebp
+ 7e1:	c3                   	ret
+ 7e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	56                   	push   %esi
+ 7f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 7f5:	83 ec 08             	sub    $0x8,%esp
+ 7f8:	6a 00                	push   $0x0
+ 7fa:	ff 75 08             	push   0x8(%ebp)
+ 7fd:	e8 6e 01 00 00       	call   970 <open>
+  if(fd < 0)
+ 802:	83 c4 10             	add    $0x10,%esp
+ 805:	85 c0                	test   %eax,%eax
+ 807:	78 27                	js     830 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 809:	83 ec 08             	sub    $0x8,%esp
+ 80c:	ff 75 0c             	push   0xc(%ebp)
+ 80f:	89 c3                	mov    %eax,%ebx
+ 811:	50                   	push   %eax
+ 812:	e8 71 01 00 00       	call   988 <fstat>
+  close(fd);
+ 817:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 81a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 81c:	e8 37 01 00 00       	call   958 <close>
+  return r;
+ 821:	83 c4 10             	add    $0x10,%esp
+}
+ 824:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 827:	89 f0                	mov    %esi,%eax
+ 829:	5b                   	pop    %ebx
+ 82a:	5e                   	pop    %esi
+ 82b:	5d                   	pop    %ebp
+ 82c:	c3                   	ret
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 830:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 835:	eb ed                	jmp    824 <stat+0x34>
+ 837:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83e:	66 90                	xchg   %ax,%ax
+
+00000840 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	53                   	push   %ebx
+ 844:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 847:	0f be 02             	movsbl (%edx),%eax
+ 84a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 84d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 850:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 855:	77 1e                	ja     875 <atoi+0x35>
+ 857:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 860:	83 c2 01             	add    $0x1,%edx
+ 863:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 866:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 86a:	0f be 02             	movsbl (%edx),%eax
+ 86d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 870:	80 fb 09             	cmp    $0x9,%bl
+ 873:	76 eb                	jbe    860 <atoi+0x20>
+  return n;
+}
+ 875:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 878:	89 c8                	mov    %ecx,%eax
+ 87a:	c9                   	leave
+ 87b:	c3                   	ret
+ 87c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000880 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	57                   	push   %edi
+ 884:	56                   	push   %esi
+ 885:	8b 45 10             	mov    0x10(%ebp),%eax
+ 888:	8b 55 08             	mov    0x8(%ebp),%edx
+ 88b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 88e:	85 c0                	test   %eax,%eax
+ 890:	7e 13                	jle    8a5 <memmove+0x25>
+ 892:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 894:	89 d7                	mov    %edx,%edi
+ 896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 8a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 8a1:	39 f8                	cmp    %edi,%eax
+ 8a3:	75 fb                	jne    8a0 <memmove+0x20>
+  return vdst;
+}
+ 8a5:	5e                   	pop    %esi
+ 8a6:	89 d0                	mov    %edx,%eax
+ 8a8:	5f                   	pop    %edi
+ 8a9:	5d                   	pop    %ebp
+ 8aa:	c3                   	ret
+ 8ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+
+000008b0 <mutex_lock>:
+
+// Take and release m with atomic instructions, and enter the kernel
+// only to block while it is held or to wake a blocked thread.
+void
+mutex_lock(struct mutex *m)
+{
+ 8b0:	55                   	push   %ebp
+  uint s;
+
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 8b1:	31 c0                	xor    %eax,%eax
+ 8b3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 8b8:	89 e5                	mov    %esp,%ebp
+ 8ba:	56                   	push   %esi
+ 8bb:	53                   	push   %ebx
+ 8bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 8bf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 8c3:	85 c0                	test   %eax,%eax
+ 8c5:	74 30                	je     8f7 <mutex_lock+0x47>
+    return;
+  // Contended: mark it so the holder knows to wake us.
+  if(s != 2)
+ 8c7:	83 f8 02             	cmp    $0x2,%eax
+ 8ca:	74 0c                	je     8d8 <mutex_lock+0x28>
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 8cc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 8d1:	f0 87 03             	lock xchg %eax,(%ebx)
+    s = xchg(&m->state, 2);
+  while(s != 0){
+ 8d4:	85 c0                	test   %eax,%eax
+ 8d6:	74 1f                	je     8f7 <mutex_lock+0x47>
+ 8d8:	be 02 00 00 00       	mov    $0x2,%esi
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+ 8e0:	83 ec 08             	sub    $0x8,%esp
+ 8e3:	6a 02                	push   $0x2
+ 8e5:	53                   	push   %ebx
+ 8e6:	e8 45 01 00 00       	call   a30 <futex_wait>
+ 8eb:	89 f0                	mov    %esi,%eax
+ 8ed:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(s != 0){
+ 8f0:	83 c4 10             	add    $0x10,%esp
+ 8f3:	85 c0                	test   %eax,%eax
+ 8f5:	75 e9                	jne    8e0 <mutex_lock+0x30>
+    s = xchg(&m->state, 2);
+  }
+}
+ 8f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 8fa:	5b                   	pop    %ebx
+ 8fb:	5e                   	pop    %esi
+ 8fc:	5d                   	pop    %ebp
+ 8fd:	c3                   	ret
+ 8fe:	66 90                	xchg   %ax,%ax
+
+00000900 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 900:	55                   	push   %ebp
+ 901:	31 c0                	xor    %eax,%eax
+ 903:	89 e5                	mov    %esp,%ebp
+ 905:	83 ec 08             	sub    $0x8,%esp
+ 908:	8b 55 08             	mov    0x8(%ebp),%edx
+ 90b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 90e:	83 f8 02             	cmp    $0x2,%eax
+ 911:	74 05                	je     918 <mutex_unlock+0x18>
+    futex_wake(&m->state, 1);
+}
+ 913:	c9                   	leave
+ 914:	c3                   	ret
+ 915:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->state, 1);
+ 918:	83 ec 08             	sub    $0x8,%esp
+ 91b:	6a 01                	push   $0x1
+ 91d:	52                   	push   %edx
+ 91e:	e8 15 01 00 00       	call   a38 <futex_wake>
+ 923:	83 c4 10             	add    $0x10,%esp
+}
+ 926:	c9                   	leave
+ 927:	c3                   	ret
+
+00000928 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 928:	b8 01 00 00 00       	mov    $0x1,%eax
+ 92d:	cd 40                	int    $0x40
+ 92f:	c3                   	ret
+
+00000930 <exit>:
+SYSCALL(exit)
+ 930:	b8 02 00 00 00       	mov    $0x2,%eax
+ 935:	cd 40                	int    $0x40
+ 937:	c3                   	ret
+
+00000938 <wait>:
+SYSCALL(wait)
+ 938:	b8 03 00 00 00       	mov    $0x3,%eax
+ 93d:	cd 40                	int    $0x40
+ 93f:	c3                   	ret
+
+00000940 <pipe>:
+SYSCALL(pipe)
+ 940:	b8 04 00 00 00       	mov    $0x4,%eax
+ 945:	cd 40                	int    $0x40
+ 947:	c3                   	ret
+
+00000948 <read>:
+SYSCALL(read)
+ 948:	b8 05 00 00 00       	mov    $0x5,%eax
+ 94d:	cd 40                	int    $0x40
+ 94f:	c3                   	ret
+
+00000950 <write>:
+SYSCALL(write)
+ 950:	b8 10 00 00 00       	mov    $0x10,%eax
+ 955:	cd 40                	int    $0x40
+ 957:	c3                   	ret
+
+00000958 <close>:
+SYSCALL(close)
+ 958:	b8 15 00 00 00       	mov    $0x15,%eax
+ 95d:	cd 40                	int    $0x40
+ 95f:	c3                   	ret
+
+00000960 <kill>:
+SYSCALL(kill)
+ 960:	b8 06 00 00 00       	mov    $0x6,%eax
+ 965:	cd 40                	int    $0x40
+ 967:	c3                   	ret
+
+00000968 <exec>:
+SYSCALL(exec)
+ 968:	b8 07 00 00 00       	mov    $0x7,%eax
+ 96d:	cd 40                	int    $0x40
+ 96f:	c3                   	ret
+
+00000970 <open>:
+SYSCALL(open)
+ 970:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 975:	cd 40                	int    $0x40
+ 977:	c3                   	ret
+
+00000978 <mknod>:
+SYSCALL(mknod)
+ 978:	b8 11 00 00 00       	mov    $0x11,%eax
+ 97d:	cd 40                	int    $0x40
+ 97f:	c3                   	ret
+
+00000980 <unlink>:
+SYSCALL(unlink)
+ 980:	b8 12 00 00 00       	mov    $0x12,%eax
+ 985:	cd 40                	int    $0x40
+ 987:	c3                   	ret
+
+00000988 <fstat>:
+SYSCALL(fstat)
+ 988:	b8 08 00 00 00       	mov    $0x8,%eax
+ 98d:	cd 40                	int    $0x40
+ 98f:	c3                   	ret
+
+00000990 <link>:
+SYSCALL(link)
+ 990:	b8 13 00 00 00       	mov    $0x13,%eax
+ 995:	cd 40                	int    $0x40
+ 997:	c3                   	ret
+
+00000998 <mkdir>:
+SYSCALL(mkdir)
+ 998:	b8 14 00 00 00       	mov    $0x14,%eax
+ 99d:	cd 40                	int    $0x40
+ 99f:	c3                   	ret
+
+000009a0 <chdir>:
+SYSCALL(chdir)
+ 9a0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 9a5:	cd 40                	int    $0x40
+ 9a7:	c3                   	ret
+
+000009a8 <dup>:
+SYSCALL(dup)
+ 9a8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 9ad:	cd 40                	int    $0x40
+ 9af:	c3                   	ret
+
+000009b0 <getpid>:
+SYSCALL(getpid)
+ 9b0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 9b5:	cd 40                	int    $0x40
+ 9b7:	c3                   	ret
+
+000009b8 <sbrk>:
+SYSCALL(sbrk)
+ 9b8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 9bd:	cd 40                	int    $0x40
+ 9bf:	c3                   	ret
+
+000009c0 <sleep>:
+SYSCALL(sleep)
+ 9c0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 9c5:	cd 40                	int    $0x40
+ 9c7:	c3                   	ret
+
+000009c8 <uptime>:
+SYSCALL(uptime)
+ 9c8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 9cd:	cd 40                	int    $0x40
+ 9cf:	c3                   	ret
+
+000009d0 <ps>:
+SYSCALL(ps)
+ 9d0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 9d5:	cd 40                	int    $0x40
+ 9d7:	c3                   	ret
+
+000009d8 <getschedparams>:
+SYSCALL(getschedparams)
+ 9d8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 9dd:	cd 40                	int    $0x40
+ 9df:	c3                   	ret
+
+000009e0 <setschedparams>:
+SYSCALL(setschedparams)
+ 9e0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 9e5:	cd 40                	int    $0x40
+ 9e7:	c3                   	ret
+
+000009e8 <getpinfo>:
+SYSCALL(getpinfo)
+ 9e8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 9ed:	cd 40                	int    $0x40
+ 9ef:	c3                   	ret
+
+000009f0 <getlathist>:
+SYSCALL(getlathist)
+ 9f0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 9f5:	cd 40                	int    $0x40
+ 9f7:	c3                   	ret
+
+000009f8 <setpolicy>:
+SYSCALL(setpolicy)
+ 9f8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 9fd:	cd 40                	int    $0x40
+ 9ff:	c3                   	ret
+
+00000a00 <settickets>:
+SYSCALL(settickets)
+ a00:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ a05:	cd 40                	int    $0x40
+ a07:	c3                   	ret
+
+00000a08 <setaffinity>:
+SYSCALL(setaffinity)
+ a08:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ a0d:	cd 40                	int    $0x40
+ a0f:	c3                   	ret
+
+00000a10 <getaffinity>:
+SYSCALL(getaffinity)
+ a10:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ a15:	cd 40                	int    $0x40
+ a17:	c3                   	ret
+
+00000a18 <setrt>:
+SYSCALL(setrt)
+ a18:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ a1d:	cd 40                	int    $0x40
+ a1f:	c3                   	ret
+
+00000a20 <clone>:
+SYSCALL(clone)
+ a20:	b8 20 00 00 00       	mov    $0x20,%eax
+ a25:	cd 40                	int    $0x40
+ a27:	c3                   	ret
+
+00000a28 <join>:
+SYSCALL(join)
+ a28:	b8 21 00 00 00       	mov    $0x21,%eax
+ a2d:	cd 40                	int    $0x40
+ a2f:	c3                   	ret
+
+00000a30 <futex_wait>:
+SYSCALL(futex_wait)
+ a30:	b8 22 00 00 00       	mov    $0x22,%eax
+ a35:	cd 40                	int    $0x40
+ a37:	c3                   	ret
+
+00000a38 <futex_wake>:
+SYSCALL(futex_wake)
+ a38:	b8 23 00 00 00       	mov    $0x23,%eax
+ a3d:	cd 40                	int    $0x40
+ a3f:	c3                   	ret
+
+00000a40 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a40:	55                   	push   %ebp
+ a41:	89 e5                	mov    %esp,%ebp
+ a43:	57                   	push   %edi
+ a44:	56                   	push   %esi
+ a45:	53                   	push   %ebx
+ a46:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a48:	89 d1                	mov    %edx,%ecx
+{
+ a4a:	83 ec 3c             	sub    $0x3c,%esp
+ a4d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ a50:	85 d2                	test   %edx,%edx
+ a52:	0f 89 80 00 00 00    	jns    ad8 <printint+0x98>
+ a58:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a5c:	74 7a                	je     ad8 <printint+0x98>
+    x = -xx;
+ a5e:	f7 d9                	neg    %ecx
+    neg = 1;
+ a60:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a65:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a68:	31 f6                	xor    %esi,%esi
+ a6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a70:	89 c8                	mov    %ecx,%eax
+ a72:	31 d2                	xor    %edx,%edx
+ a74:	89 f7                	mov    %esi,%edi
+ a76:	f7 f3                	div    %ebx
+ a78:	8d 76 01             	lea    0x1(%esi),%esi
+ a7b:	0f b6 92 60 10 00 00 	movzbl 0x1060(%edx),%edx
+ a82:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ a86:	89 ca                	mov    %ecx,%edx
+ a88:	89 c1                	mov    %eax,%ecx
+ a8a:	39 da                	cmp    %ebx,%edx
+ a8c:	73 e2                	jae    a70 <printint+0x30>
+  if(neg)
+ a8e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a91:	85 c0                	test   %eax,%eax
+ a93:	74 07                	je     a9c <printint+0x5c>
+    buf[i++] = '-';
+ a95:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a9a:	89 f7                	mov    %esi,%edi
+ a9c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a9f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ aa2:	01 df                	add    %ebx,%edi
+ aa4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ aa8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ aab:	83 ec 04             	sub    $0x4,%esp
+ aae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ ab1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ ab4:	6a 01                	push   $0x1
+ ab6:	50                   	push   %eax
+ ab7:	56                   	push   %esi
+ ab8:	e8 93 fe ff ff       	call   950 <write>
+  while(--i >= 0)
+ abd:	89 f8                	mov    %edi,%eax
+ abf:	83 c4 10             	add    $0x10,%esp
+ ac2:	83 ef 01             	sub    $0x1,%edi
+ ac5:	39 d8                	cmp    %ebx,%eax
+ ac7:	75 df                	jne    aa8 <printint+0x68>
+}
+ ac9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ acc:	5b                   	pop    %ebx
+ acd:	5e                   	pop    %esi
+ ace:	5f                   	pop    %edi
+ acf:	5d                   	pop    %ebp
+ ad0:	c3                   	ret
+ ad1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ ad8:	31 c0                	xor    %eax,%eax
+ ada:	eb 89                	jmp    a65 <printint+0x25>
+ adc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ae0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ ae0:	55                   	push   %ebp
+ ae1:	89 e5                	mov    %esp,%ebp
+ ae3:	57                   	push   %edi
+ ae4:	56                   	push   %esi
+ ae5:	53                   	push   %ebx
+ ae6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ ae9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ aec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ aef:	0f b6 1e             	movzbl (%esi),%ebx
+ af2:	83 c6 01             	add    $0x1,%esi
+ af5:	84 db                	test   %bl,%bl
+ af7:	74 67                	je     b60 <printf+0x80>
+ af9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ afc:	31 d2                	xor    %edx,%edx
+ afe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ b01:	eb 34                	jmp    b37 <printf+0x57>
+ b03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b07:	90                   	nop
+ b08:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ b0b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ b10:	83 f8 25             	cmp    $0x25,%eax
+ b13:	74 18                	je     b2d <printf+0x4d>
+  write(fd, &c, 1);
+ b15:	83 ec 04             	sub    $0x4,%esp
+ b18:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ b1b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b1e:	6a 01                	push   $0x1
+ b20:	50                   	push   %eax
+ b21:	57                   	push   %edi
+ b22:	e8 29 fe ff ff       	call   950 <write>
+ b27:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ b2a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ b2d:	0f b6 1e             	movzbl (%esi),%ebx
+ b30:	83 c6 01             	add    $0x1,%esi
+ b33:	84 db                	test   %bl,%bl
+ b35:	74 29                	je     b60 <printf+0x80>
+    c = fmt[i] & 0xff;
+ b37:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b3a:	85 d2                	test   %edx,%edx
+ b3c:	74 ca                	je     b08 <printf+0x28>
+      }
+    } else if(state == '%'){
+ b3e:	83 fa 25             	cmp    $0x25,%edx
+ b41:	75 ea                	jne    b2d <printf+0x4d>
+      if(c == 'd'){
+ b43:	83 f8 25             	cmp    $0x25,%eax
+ b46:	0f 84 24 01 00 00    	je     c70 <printf+0x190>
+ b4c:	83 e8 63             	sub    $0x63,%eax
+ b4f:	83 f8 15             	cmp    $0x15,%eax
+ b52:	77 1c                	ja     b70 <printf+0x90>
+ b54:	ff 24 85 08 10 00 00 	jmp    *0x1008(,%eax,4)
+ b5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b5f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ b60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b63:	5b                   	pop    %ebx
+ b64:	5e                   	pop    %esi
+ b65:	5f                   	pop    %edi
+ b66:	5d                   	pop    %ebp
+ b67:	c3                   	ret
+ b68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6f:	90                   	nop
+  write(fd, &c, 1);
+ b70:	83 ec 04             	sub    $0x4,%esp
+ b73:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b76:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ b7a:	6a 01                	push   $0x1
+ b7c:	52                   	push   %edx
+ b7d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ b80:	57                   	push   %edi
+ b81:	e8 ca fd ff ff       	call   950 <write>
+ b86:	83 c4 0c             	add    $0xc,%esp
+ b89:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b8c:	6a 01                	push   $0x1
+ b8e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ b91:	52                   	push   %edx
+ b92:	57                   	push   %edi
+ b93:	e8 b8 fd ff ff       	call   950 <write>
+        putc(fd, c);
+ b98:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b9b:	31 d2                	xor    %edx,%edx
+ b9d:	eb 8e                	jmp    b2d <printf+0x4d>
+ b9f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ ba0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ba3:	83 ec 0c             	sub    $0xc,%esp
+ ba6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ bab:	8b 13                	mov    (%ebx),%edx
+ bad:	6a 00                	push   $0x0
+ baf:	89 f8                	mov    %edi,%eax
+        ap++;
+ bb1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ bb4:	e8 87 fe ff ff       	call   a40 <printint>
+        ap++;
+ bb9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ bbc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bbf:	31 d2                	xor    %edx,%edx
+ bc1:	e9 67 ff ff ff       	jmp    b2d <printf+0x4d>
+ bc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bcd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ bd0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ bd3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ bd5:	83 c0 04             	add    $0x4,%eax
+ bd8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ bdb:	85 db                	test   %ebx,%ebx
+ bdd:	0f 84 9d 00 00 00    	je     c80 <printf+0x1a0>
+        while(*s != 0){
+ be3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ be6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ be8:	84 c0                	test   %al,%al
+ bea:	0f 84 3d ff ff ff    	je     b2d <printf+0x4d>
+ bf0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ bf3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ bf6:	89 de                	mov    %ebx,%esi
+ bf8:	89 d3                	mov    %edx,%ebx
+ bfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ c00:	83 ec 04             	sub    $0x4,%esp
+ c03:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ c06:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ c09:	6a 01                	push   $0x1
+ c0b:	53                   	push   %ebx
+ c0c:	57                   	push   %edi
+ c0d:	e8 3e fd ff ff       	call   950 <write>
+        while(*s != 0){
+ c12:	0f b6 06             	movzbl (%esi),%eax
+ c15:	83 c4 10             	add    $0x10,%esp
+ c18:	84 c0                	test   %al,%al
+ c1a:	75 e4                	jne    c00 <printf+0x120>
+      state = 0;
+ c1c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ c1f:	31 d2                	xor    %edx,%edx
+ c21:	e9 07 ff ff ff       	jmp    b2d <printf+0x4d>
+ c26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ c30:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ c33:	83 ec 0c             	sub    $0xc,%esp
+ c36:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c3b:	8b 13                	mov    (%ebx),%edx
+ c3d:	6a 01                	push   $0x1
+ c3f:	e9 6b ff ff ff       	jmp    baf <printf+0xcf>
+ c44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ c48:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ c4b:	83 ec 04             	sub    $0x4,%esp
+ c4e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ c51:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ c53:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ c56:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ c59:	6a 01                	push   $0x1
+ c5b:	52                   	push   %edx
+ c5c:	57                   	push   %edi
+ c5d:	e8 ee fc ff ff       	call   950 <write>
+        ap++;
+ c62:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ c65:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c68:	31 d2                	xor    %edx,%edx
+ c6a:	e9 be fe ff ff       	jmp    b2d <printf+0x4d>
+ c6f:	90                   	nop
+  write(fd, &c, 1);
+ c70:	83 ec 04             	sub    $0x4,%esp
+ c73:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c76:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c79:	6a 01                	push   $0x1
+ c7b:	e9 11 ff ff ff       	jmp    b91 <printf+0xb1>
+ c80:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ c85:	bb fe 0f 00 00       	mov    $0xffe,%ebx
+ c8a:	e9 61 ff ff ff       	jmp    bf0 <printf+0x110>
+ c8f:	90                   	nop
+
+00000c90 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c90:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c91:	a1 00 14 00 00       	mov    0x1400,%eax
+{
+ c96:	89 e5                	mov    %esp,%ebp
+ c98:	57                   	push   %edi
+ c99:	56                   	push   %esi
+ c9a:	53                   	push   %ebx
+ c9b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c9e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ca1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ca8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ caa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cac:	39 ca                	cmp    %ecx,%edx
+ cae:	73 30                	jae    ce0 <free+0x50>
+ cb0:	39 c1                	cmp    %eax,%ecx
+ cb2:	72 04                	jb     cb8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cb4:	39 c2                	cmp    %eax,%edx
+ cb6:	72 f0                	jb     ca8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ cb8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ cbb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ cbe:	39 f8                	cmp    %edi,%eax
+ cc0:	74 2e                	je     cf0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cc2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ cc5:	8b 42 04             	mov    0x4(%edx),%eax
+ cc8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ccb:	39 f1                	cmp    %esi,%ecx
+ ccd:	74 38                	je     d07 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ ccf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ cd1:	5b                   	pop    %ebx
+  freep = p;
+ cd2:	89 15 00 14 00 00    	mov    %edx,0x1400
+}
+ cd8:	5e                   	pop    %esi
+ cd9:	5f                   	pop    %edi
+ cda:	5d                   	pop    %ebp
+ cdb:	c3                   	ret
+ cdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ce0:	39 c1                	cmp    %eax,%ecx
+ ce2:	72 d0                	jb     cb4 <free+0x24>
+ ce4:	eb c2                	jmp    ca8 <free+0x18>
+ ce6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ced:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ cf0:	03 70 04             	add    0x4(%eax),%esi
+ cf3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cf6:	8b 02                	mov    (%edx),%eax
+ cf8:	8b 00                	mov    (%eax),%eax
+ cfa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ cfd:	8b 42 04             	mov    0x4(%edx),%eax
+ d00:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d03:	39 f1                	cmp    %esi,%ecx
+ d05:	75 c8                	jne    ccf <free+0x3f>
+    p->s.size += bp->s.size;
+ d07:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d0a:	89 15 00 14 00 00    	mov    %edx,0x1400
+    p->s.size += bp->s.size;
+ d10:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d13:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d16:	89 0a                	mov    %ecx,(%edx)
+}
+ d18:	5b                   	pop    %ebx
+ d19:	5e                   	pop    %esi
+ d1a:	5f                   	pop    %edi
+ d1b:	5d                   	pop    %ebp
+ d1c:	c3                   	ret
+ d1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d20 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d20:	55                   	push   %ebp
+ d21:	89 e5                	mov    %esp,%ebp
+ d23:	57                   	push   %edi
+ d24:	56                   	push   %esi
+ d25:	53                   	push   %ebx
+ d26:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d29:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d2c:	8b 15 00 14 00 00    	mov    0x1400,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d32:	8d 78 07             	lea    0x7(%eax),%edi
+ d35:	c1 ef 03             	shr    $0x3,%edi
+ d38:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d3b:	85 d2                	test   %edx,%edx
+ d3d:	0f 84 8d 00 00 00    	je     dd0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d43:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d45:	8b 48 04             	mov    0x4(%eax),%ecx
+ d48:	39 f9                	cmp    %edi,%ecx
+ d4a:	73 64                	jae    db0 <malloc+0x90>
+  if(nu < 4096)
+ d4c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d51:	39 df                	cmp    %ebx,%edi
+ d53:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d56:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d5d:	eb 0a                	jmp    d69 <malloc+0x49>
+ d5f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d60:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d62:	8b 48 04             	mov    0x4(%eax),%ecx
+ d65:	39 f9                	cmp    %edi,%ecx
+ d67:	73 47                	jae    db0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d69:	89 c2                	mov    %eax,%edx
+ d6b:	39 05 00 14 00 00    	cmp    %eax,0x1400
+ d71:	75 ed                	jne    d60 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d73:	83 ec 0c             	sub    $0xc,%esp
+ d76:	56                   	push   %esi
+ d77:	e8 3c fc ff ff       	call   9b8 <sbrk>
+  if(p == (char*)-1)
+ d7c:	83 c4 10             	add    $0x10,%esp
+ d7f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d82:	74 1c                	je     da0 <malloc+0x80>
+  hp->s.size = nu;
+ d84:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d87:	83 ec 0c             	sub    $0xc,%esp
+ d8a:	83 c0 08             	add    $0x8,%eax
+ d8d:	50                   	push   %eax
+ d8e:	e8 fd fe ff ff       	call   c90 <free>
+  return freep;
+ d93:	8b 15 00 14 00 00    	mov    0x1400,%edx
+      if((p = morecore(nunits)) == 0)
+ d99:	83 c4 10             	add    $0x10,%esp
+ d9c:	85 d2                	test   %edx,%edx
+ d9e:	75 c0                	jne    d60 <malloc+0x40>
+        return 0;
+  }
+}
+ da0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ da3:	31 c0                	xor    %eax,%eax
+}
+ da5:	5b                   	pop    %ebx
+ da6:	5e                   	pop    %esi
+ da7:	5f                   	pop    %edi
+ da8:	5d                   	pop    %ebp
+ da9:	c3                   	ret
+ daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ db0:	39 cf                	cmp    %ecx,%edi
+ db2:	74 4c                	je     e00 <malloc+0xe0>
+        p->s.size -= nunits;
+ db4:	29 f9                	sub    %edi,%ecx
+ db6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ db9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ dbc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ dbf:	89 15 00 14 00 00    	mov    %edx,0x1400
+}
+ dc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ dc8:	83 c0 08             	add    $0x8,%eax
+}
+ dcb:	5b                   	pop    %ebx
+ dcc:	5e                   	pop    %esi
+ dcd:	5f                   	pop    %edi
+ dce:	5d                   	pop    %ebp
+ dcf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ dd0:	c7 05 00 14 00 00 04 	movl   $0x1404,0x1400
+ dd7:	14 00 00 
+    base.s.size = 0;
+ dda:	b8 04 14 00 00       	mov    $0x1404,%eax
+    base.s.ptr = freep = prevp = &base;
+ ddf:	c7 05 04 14 00 00 04 	movl   $0x1404,0x1404
+ de6:	14 00 00 
+    base.s.size = 0;
+ de9:	c7 05 08 14 00 00 00 	movl   $0x0,0x1408
+ df0:	00 00 00 
+    if(p->s.size >= nunits){
+ df3:	e9 54 ff ff ff       	jmp    d4c <malloc+0x2c>
+ df8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e00:	8b 08                	mov    (%eax),%ecx
+ e02:	89 0a                	mov    %ecx,(%edx)
+ e04:	eb b9                	jmp    dbf <malloc+0x9f>
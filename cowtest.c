@@ -0,0 +1,212 @@
+// Tests for copy-on-write fork().  Kept out of usertests, which is
+// as large as a file can be.
+
+#include "param.h"
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define COWSIZE (32*4096)
+
+// Does every byte of p[0..n-1] equal c?
+static int
+allequal(char *p, int n, char c)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    if(p[i] != c)
+      return 0;
+  return 1;
+}
+
+// After fork(), each side's writes stay its own.
+void
+cowtest(void)
+{
+  int tochild[2], toparent[2], pid;
+  char *p, ok;
+
+  printf(1, "cow test\n");
+
+  if((p = sbrk(COWSIZE)) == (char*)-1){
+    printf(1, "sbrk failed\n");
+    exit();
+  }
+  memset(p, 'a', COWSIZE);
+  if(pipe(tochild) != 0 || pipe(toparent) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    // Write first, then check after the parent has written.
+    ok = allequal(p, COWSIZE, 'a') ? 'y' : 'n';
+    memset(p, 'c', COWSIZE);
+    write(toparent[1], &ok, 1);
+    read(tochild[0], &ok, 1);
+    ok = allequal(p, COWSIZE, 'c') ? 'y' : 'n';
+    write(toparent[1], &ok, 1);
+    exit();
+  }
+  read(toparent[0], &ok, 1);
+  if(ok != 'y'){
+    printf(1, "cow: child did not see the parent's memory\n");
+    exit();
+  }
+  if(!allequal(p, COWSIZE, 'a')){
+    printf(1, "cow: parent saw the child's write\n");
+    exit();
+  }
+  memset(p, 'p', COWSIZE);
+  write(tochild[1], "x", 1);
+  read(toparent[0], &ok, 1);
+  if(ok != 'y'){
+    printf(1, "cow: child saw the parent's write\n");
+    exit();
+  }
+  wait();
+  if(!allequal(p, COWSIZE, 'p')){
+    printf(1, "cow: parent lost its write\n");
+    exit();
+  }
+  close(tochild[0]);
+  close(tochild[1]);
+  close(toparent[0]);
+  close(toparent[1]);
+  sbrk(-COWSIZE);
+
+  printf(1, "cow test OK\n");
+}
+
+// Shrinking memory after fork() leaves the other side's copy alone.
+void
+cowsbrktest(void)
+{
+  int fds[2], pid;
+  char *p, ok;
+
+  printf(1, "cow sbrk test\n");
+
+  if((p = sbrk(COWSIZE)) == (char*)-1){
+    printf(1, "sbrk failed\n");
+    exit();
+  }
+  memset(p, 'a', COWSIZE);
+
+  // The child shrinks, then grows again.
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    sbrk(-COWSIZE);
+    if(sbrk(COWSIZE) != p || !allequal(p, COWSIZE, 0)){
+      printf(1, "cow sbrk: regrown memory is not zero\n");
+      exit();
+    }
+    memset(p, 'c', COWSIZE);
+    exit();
+  }
+  wait();
+  if(!allequal(p, COWSIZE, 'a')){
+    printf(1, "cow sbrk: child's shrink changed the parent\n");
+    exit();
+  }
+
+  // The parent shrinks while the child still shares the pages.
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    read(fds[0], &ok, 1);
+    if(!allequal(p, COWSIZE, 'a'))
+      printf(1, "cow sbrk: parent's shrink changed the child\n");
+    exit();
+  }
+  sbrk(-COWSIZE);
+  write(fds[1], "x", 1);
+  wait();
+  close(fds[0]);
+  close(fds[1]);
+
+  printf(1, "cow sbrk test OK\n");
+}
+
+// Pages the kernel can still give us: grow until sbrk() fails, then
+// shrink back.
+int
+countfree(void)
+{
+  int n;
+
+  for(n = 0; sbrk(4096) != (char*)-1; n++)
+    ;
+  sbrk(-n * 4096);
+  return n;
+}
+
+// Free pages cached by the other CPUs, which our sbrk() cannot get:
+// kalloc.c keeps up to 64 of each kind, dirty and zeroed, per CPU.
+#define CACHESLACK (2*64*NCPU)
+
+// Shared pages are freed once their last owner lets go of them.
+void
+cowfreetest(void)
+{
+  int before, after, i, pid;
+  char *p;
+
+  printf(1, "cow free test\n");
+
+  before = countfree();
+  if((p = sbrk(COWSIZE)) == (char*)-1){
+    printf(1, "sbrk failed\n");
+    exit();
+  }
+  memset(p, 'a', COWSIZE);
+  for(i = 0; i < 50; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(1, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      memset(p, 'c', COWSIZE/2);
+      exit();
+    }
+    if(i % 2)
+      memset(p + COWSIZE/2, 'p', COWSIZE/2);
+    wait();
+  }
+  sbrk(-COWSIZE);
+  after = countfree();
+  if(after + CACHESLACK < before){
+    printf(1, "cow free: %d pages free before, %d after\n", before, after);
+    exit();
+  }
+
+  printf(1, "cow free test OK\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  printf(1, "cowtest starting\n");
+  cowtest();
+  cowsbrktest();
+  cowfreetest();
+  printf(1, "cowtest: all tests passed\n");
+  exit();
+}
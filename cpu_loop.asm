@@ -0,0 +1,1358 @@
+
+_cpu_loop:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  if(argc < 2){
+  12:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  15:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc < 2){
+  18:	7e 53                	jle    6d <main+0x6d>
+    // No argument: run forever so you can always see it in procdump (Ctrl+P)
+    spin_forever();
+    exit(); // never reaches
+  }
+
+  int n = atoi(argv[1]);
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	ff 70 04             	push   0x4(%eax)
+  20:	e8 6b 02 00 00       	call   290 <atoi>
+  if(n <= 0){
+  25:	83 c4 10             	add    $0x10,%esp
+  int n = atoi(argv[1]);
+  28:	89 c1                	mov    %eax,%ecx
+  if(n <= 0){
+  2a:	85 c0                	test   %eax,%eax
+  2c:	7e 5d                	jle    8b <main+0x8b>
+    printf(1, "Usage: cpu_loop <n>\n");
+    exit();
+  }
+
+  volatile uint x = 0;
+  2e:	31 db                	xor    %ebx,%ebx
+  for(int i = 0; i < n; i++){
+  30:	31 d2                	xor    %edx,%edx
+  volatile uint x = 0;
+  32:	89 5d f4             	mov    %ebx,-0xc(%ebp)
+  for(int i = 0; i < n; i++){
+  35:	8d 76 00             	lea    0x0(%esi),%esi
+    // Make each iteration non-trivial
+    x = x * 1664525 + 1013904223;
+  38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  for(int i = 0; i < n; i++){
+  3b:	83 c2 01             	add    $0x1,%edx
+    x = x * 1664525 + 1013904223;
+  3e:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  44:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  49:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    x ^= (x >> 16);
+  4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  4f:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+  52:	c1 e8 10             	shr    $0x10,%eax
+  55:	31 d8                	xor    %ebx,%eax
+  57:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(int i = 0; i < n; i++){
+  5a:	39 d1                	cmp    %edx,%ecx
+  5c:	75 da                	jne    38 <main+0x38>
+  }
+
+  // prevent unused warning / optimization
+  if(x == 0xdeadbeef)
+  5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  61:	3d ef be ad de       	cmp    $0xdeadbeef,%eax
+  66:	74 36                	je     9e <main+0x9e>
+    printf(1, "x=%d\n", x);
+
+  exit();
+  68:	e8 13 03 00 00       	call   380 <exit>
+  volatile uint x = 0;
+  6d:	31 c0                	xor    %eax,%eax
+  6f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    x = x * 1664525 + 1013904223; // some cheap arithmetic
+  78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  7b:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+  81:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  86:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(;;){
+  89:	eb ed                	jmp    78 <main+0x78>
+    printf(1, "Usage: cpu_loop <n>\n");
+  8b:	50                   	push   %eax
+  8c:	50                   	push   %eax
+  8d:	68 58 08 00 00       	push   $0x858
+  92:	6a 01                	push   $0x1
+  94:	e8 97 04 00 00       	call   530 <printf>
+    exit();
+  99:	e8 e2 02 00 00       	call   380 <exit>
+    printf(1, "x=%d\n", x);
+  9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  a1:	52                   	push   %edx
+  a2:	50                   	push   %eax
+  a3:	68 6d 08 00 00       	push   $0x86d
+  a8:	6a 01                	push   $0x1
+  aa:	e8 81 04 00 00       	call   530 <printf>
+  af:	83 c4 10             	add    $0x10,%esp
+  b2:	eb b4                	jmp    68 <main+0x68>
+  b4:	66 90                	xchg   %ax,%ax
+  b6:	66 90                	xchg   %ax,%ax
+  b8:	66 90                	xchg   %ax,%ax
+  ba:	66 90                	xchg   %ax,%ax
+  bc:	66 90                	xchg   %ax,%ax
+  be:	66 90                	xchg   %ax,%ax
+
+000000c0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  c1:	31 c0                	xor    %eax,%eax
+{
+  c3:	89 e5                	mov    %esp,%ebp
+  c5:	53                   	push   %ebx
+  c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  d7:	83 c0 01             	add    $0x1,%eax
+  da:	84 d2                	test   %dl,%dl
+  dc:	75 f2                	jne    d0 <strcpy+0x10>
+    ;
+  return os;
+}
+  de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e1:	89 c8                	mov    %ecx,%eax
+  e3:	c9                   	leave
+  e4:	c3                   	ret
+  e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	53                   	push   %ebx
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  fa:	0f b6 02             	movzbl (%edx),%eax
+  fd:	84 c0                	test   %al,%al
+  ff:	75 17                	jne    118 <strcmp+0x28>
+ 101:	eb 3a                	jmp    13d <strcmp+0x4d>
+ 103:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 107:	90                   	nop
+ 108:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 10c:	83 c2 01             	add    $0x1,%edx
+ 10f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 112:	84 c0                	test   %al,%al
+ 114:	74 1a                	je     130 <strcmp+0x40>
+    p++, q++;
+ 116:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 118:	0f b6 19             	movzbl (%ecx),%ebx
+ 11b:	38 c3                	cmp    %al,%bl
+ 11d:	74 e9                	je     108 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 11f:	29 d8                	sub    %ebx,%eax
+}
+ 121:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 124:	c9                   	leave
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 130:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 134:	31 c0                	xor    %eax,%eax
+ 136:	29 d8                	sub    %ebx,%eax
+}
+ 138:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 13b:	c9                   	leave
+ 13c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 13d:	0f b6 19             	movzbl (%ecx),%ebx
+ 140:	31 c0                	xor    %eax,%eax
+ 142:	eb db                	jmp    11f <strcmp+0x2f>
+ 144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 156:	80 3a 00             	cmpb   $0x0,(%edx)
+ 159:	74 15                	je     170 <strlen+0x20>
+ 15b:	31 c0                	xor    %eax,%eax
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+ 160:	83 c0 01             	add    $0x1,%eax
+ 163:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 167:	89 c1                	mov    %eax,%ecx
+ 169:	75 f5                	jne    160 <strlen+0x10>
+    ;
+  return n;
+}
+ 16b:	89 c8                	mov    %ecx,%eax
+ 16d:	5d                   	pop    %ebp
+ 16e:	c3                   	ret
+ 16f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 170:	31 c9                	xor    %ecx,%ecx
+}
+ 172:	5d                   	pop    %ebp
+ 173:	89 c8                	mov    %ecx,%eax
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000180 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 187:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 18a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18d:	89 d7                	mov    %edx,%edi
+ 18f:	fc                   	cld
+ 190:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 192:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 195:	89 d0                	mov    %edx,%eax
+ 197:	c9                   	leave
+ 198:	c3                   	ret
+ 199:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1aa:	0f b6 10             	movzbl (%eax),%edx
+ 1ad:	84 d2                	test   %dl,%dl
+ 1af:	75 12                	jne    1c3 <strchr+0x23>
+ 1b1:	eb 1d                	jmp    1d0 <strchr+0x30>
+ 1b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1b7:	90                   	nop
+ 1b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1bc:	83 c0 01             	add    $0x1,%eax
+ 1bf:	84 d2                	test   %dl,%dl
+ 1c1:	74 0d                	je     1d0 <strchr+0x30>
+    if(*s == c)
+ 1c3:	38 d1                	cmp    %dl,%cl
+ 1c5:	75 f1                	jne    1b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1c7:	5d                   	pop    %ebp
+ 1c8:	c3                   	ret
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1d0:	31 c0                	xor    %eax,%eax
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	c3                   	ret
+ 1d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+
+000001e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1e9:	31 db                	xor    %ebx,%ebx
+{
+ 1eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ee:	eb 27                	jmp    217 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1f0:	83 ec 04             	sub    $0x4,%esp
+ 1f3:	6a 01                	push   $0x1
+ 1f5:	56                   	push   %esi
+ 1f6:	6a 00                	push   $0x0
+ 1f8:	e8 9b 01 00 00       	call   398 <read>
+    if(cc < 1)
+ 1fd:	83 c4 10             	add    $0x10,%esp
+ 200:	85 c0                	test   %eax,%eax
+ 202:	7e 1d                	jle    221 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 204:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 208:	8b 55 08             	mov    0x8(%ebp),%edx
+ 20b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 20f:	3c 0a                	cmp    $0xa,%al
+ 211:	74 10                	je     223 <gets+0x43>
+ 213:	3c 0d                	cmp    $0xd,%al
+ 215:	74 0c                	je     223 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 217:	89 df                	mov    %ebx,%edi
+ 219:	83 c3 01             	add    $0x1,%ebx
+ 21c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 21f:	7c cf                	jl     1f0 <gets+0x10>
+ 221:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+ 226:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 22a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 22d:	5b                   	pop    %ebx
+ 22e:	5e                   	pop    %esi
+ 22f:	5f                   	pop    %edi
+ 230:	5d                   	pop    %ebp
+ 231:	c3                   	ret
+ 232:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	56                   	push   %esi
+ 244:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 245:	83 ec 08             	sub    $0x8,%esp
+ 248:	6a 00                	push   $0x0
+ 24a:	ff 75 08             	push   0x8(%ebp)
+ 24d:	e8 6e 01 00 00       	call   3c0 <open>
+  if(fd < 0)
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	78 27                	js     280 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 259:	83 ec 08             	sub    $0x8,%esp
+ 25c:	ff 75 0c             	push   0xc(%ebp)
+ 25f:	89 c3                	mov    %eax,%ebx
+ 261:	50                   	push   %eax
+ 262:	e8 71 01 00 00       	call   3d8 <fstat>
+  close(fd);
+ 267:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 26a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 26c:	e8 37 01 00 00       	call   3a8 <close>
+  return r;
+ 271:	83 c4 10             	add    $0x10,%esp
+}
+ 274:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 277:	89 f0                	mov    %esi,%eax
+ 279:	5b                   	pop    %ebx
+ 27a:	5e                   	pop    %esi
+ 27b:	5d                   	pop    %ebp
+ 27c:	c3                   	ret
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 280:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 285:	eb ed                	jmp    274 <stat+0x34>
+ 287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28e:	66 90                	xchg   %ax,%ax
+
+00000290 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	53                   	push   %ebx
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 297:	0f be 02             	movsbl (%edx),%eax
+ 29a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 29d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2a5:	77 1e                	ja     2c5 <atoi+0x35>
+ 2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2b0:	83 c2 01             	add    $0x1,%edx
+ 2b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2ba:	0f be 02             	movsbl (%edx),%eax
+ 2bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2c0:	80 fb 09             	cmp    $0x9,%bl
+ 2c3:	76 eb                	jbe    2b0 <atoi+0x20>
+  return n;
+}
+ 2c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2c8:	89 c8                	mov    %ecx,%eax
+ 2ca:	c9                   	leave
+ 2cb:	c3                   	ret
+ 2cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	57                   	push   %edi
+ 2d4:	56                   	push   %esi
+ 2d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2de:	85 c0                	test   %eax,%eax
+ 2e0:	7e 13                	jle    2f5 <memmove+0x25>
+ 2e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2e4:	89 d7                	mov    %edx,%edi
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2f1:	39 f8                	cmp    %edi,%eax
+ 2f3:	75 fb                	jne    2f0 <memmove+0x20>
+  return vdst;
+}
+ 2f5:	5e                   	pop    %esi
+ 2f6:	89 d0                	mov    %edx,%eax
+ 2f8:	5f                   	pop    %edi
+ 2f9:	5d                   	pop    %ebp
+ 2fa:	c3                   	ret
+ 2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+
+00000300 <mutex_lock>:
+
+// Take and release m with atomic instructions, and enter the kernel
+// only to block while it is held or to wake a blocked thread.
+void
+mutex_lock(struct mutex *m)
+{
+ 300:	55                   	push   %ebp
+  uint s;
+
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 301:	31 c0                	xor    %eax,%eax
+ 303:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 308:	89 e5                	mov    %esp,%ebp
+ 30a:	56                   	push   %esi
+ 30b:	53                   	push   %ebx
+ 30c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 30f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 313:	85 c0                	test   %eax,%eax
+ 315:	74 30                	je     347 <mutex_lock+0x47>
+    return;
+  // Contended: mark it so the holder knows to wake us.
+  if(s != 2)
+ 317:	83 f8 02             	cmp    $0x2,%eax
+ 31a:	74 0c                	je     328 <mutex_lock+0x28>
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 31c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 321:	f0 87 03             	lock xchg %eax,(%ebx)
+    s = xchg(&m->state, 2);
+  while(s != 0){
+ 324:	85 c0                	test   %eax,%eax
+ 326:	74 1f                	je     347 <mutex_lock+0x47>
+ 328:	be 02 00 00 00       	mov    $0x2,%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+ 330:	83 ec 08             	sub    $0x8,%esp
+ 333:	6a 02                	push   $0x2
+ 335:	53                   	push   %ebx
+ 336:	e8 45 01 00 00       	call   480 <futex_wait>
+ 33b:	89 f0                	mov    %esi,%eax
+ 33d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(s != 0){
+ 340:	83 c4 10             	add    $0x10,%esp
+ 343:	85 c0                	test   %eax,%eax
+ 345:	75 e9                	jne    330 <mutex_lock+0x30>
+    s = xchg(&m->state, 2);
+  }
+}
+ 347:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 34a:	5b                   	pop    %ebx
+ 34b:	5e                   	pop    %esi
+ 34c:	5d                   	pop    %ebp
+ 34d:	c3                   	ret
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 350:	55                   	push   %ebp
+ 351:	31 c0                	xor    %eax,%eax
+ 353:	89 e5                	mov    %esp,%ebp
+ 355:	83 ec 08             	sub    $0x8,%esp
+ 358:	8b 55 08             	mov    0x8(%ebp),%edx
+ 35b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 35e:	83 f8 02             	cmp    $0x2,%eax
+ 361:	74 05                	je     368 <mutex_unlock+0x18>
+    futex_wake(&m->state, 1);
+}
+ 363:	c9                   	leave
+ 364:	c3                   	ret
+ 365:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->state, 1);
+ 368:	83 ec 08             	sub    $0x8,%esp
+ 36b:	6a 01                	push   $0x1
+ 36d:	52                   	push   %edx
+ 36e:	e8 15 01 00 00       	call   488 <futex_wake>
+ 373:	83 c4 10             	add    $0x10,%esp
+}
+ 376:	c9                   	leave
+ 377:	c3                   	ret
+
+00000378 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 378:	b8 01 00 00 00       	mov    $0x1,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <exit>:
+SYSCALL(exit)
+ 380:	b8 02 00 00 00       	mov    $0x2,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <wait>:
+SYSCALL(wait)
+ 388:	b8 03 00 00 00       	mov    $0x3,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <pipe>:
+SYSCALL(pipe)
+ 390:	b8 04 00 00 00       	mov    $0x4,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <read>:
+SYSCALL(read)
+ 398:	b8 05 00 00 00       	mov    $0x5,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <write>:
+SYSCALL(write)
+ 3a0:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <close>:
+SYSCALL(close)
+ 3a8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <kill>:
+SYSCALL(kill)
+ 3b0:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <exec>:
+SYSCALL(exec)
+ 3b8:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <open>:
+SYSCALL(open)
+ 3c0:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <mknod>:
+SYSCALL(mknod)
+ 3c8:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <unlink>:
+SYSCALL(unlink)
+ 3d0:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <fstat>:
+SYSCALL(fstat)
+ 3d8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <link>:
+SYSCALL(link)
+ 3e0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <mkdir>:
+SYSCALL(mkdir)
+ 3e8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <chdir>:
+SYSCALL(chdir)
+ 3f0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <dup>:
+SYSCALL(dup)
+ 3f8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <getpid>:
+SYSCALL(getpid)
+ 400:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <sbrk>:
+SYSCALL(sbrk)
+ 408:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <sleep>:
+SYSCALL(sleep)
+ 410:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <uptime>:
+SYSCALL(uptime)
+ 418:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <ps>:
+SYSCALL(ps)
+ 420:	b8 16 00 00 00       	mov    $0x16,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <getschedparams>:
+SYSCALL(getschedparams)
+ 428:	b8 17 00 00 00       	mov    $0x17,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <setschedparams>:
+SYSCALL(setschedparams)
+ 430:	b8 18 00 00 00       	mov    $0x18,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <getpinfo>:
+SYSCALL(getpinfo)
+ 438:	b8 19 00 00 00       	mov    $0x19,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <getlathist>:
+SYSCALL(getlathist)
+ 440:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <setpolicy>:
+SYSCALL(setpolicy)
+ 448:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <settickets>:
+SYSCALL(settickets)
+ 450:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <setaffinity>:
+SYSCALL(setaffinity)
+ 458:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <getaffinity>:
+SYSCALL(getaffinity)
+ 460:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <setrt>:
+SYSCALL(setrt)
+ 468:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <clone>:
+SYSCALL(clone)
+ 470:	b8 20 00 00 00       	mov    $0x20,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <join>:
+SYSCALL(join)
+ 478:	b8 21 00 00 00       	mov    $0x21,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <futex_wait>:
+SYSCALL(futex_wait)
+ 480:	b8 22 00 00 00       	mov    $0x22,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <futex_wake>:
+SYSCALL(futex_wake)
+ 488:	b8 23 00 00 00       	mov    $0x23,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	53                   	push   %ebx
+ 496:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 498:	89 d1                	mov    %edx,%ecx
+{
+ 49a:	83 ec 3c             	sub    $0x3c,%esp
+ 49d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4a0:	85 d2                	test   %edx,%edx
+ 4a2:	0f 89 80 00 00 00    	jns    528 <printint+0x98>
+ 4a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4ac:	74 7a                	je     528 <printint+0x98>
+    x = -xx;
+ 4ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4b8:	31 f6                	xor    %esi,%esi
+ 4ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4c0:	89 c8                	mov    %ecx,%eax
+ 4c2:	31 d2                	xor    %edx,%edx
+ 4c4:	89 f7                	mov    %esi,%edi
+ 4c6:	f7 f3                	div    %ebx
+ 4c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4cb:	0f b6 92 d4 08 00 00 	movzbl 0x8d4(%edx),%edx
+ 4d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4d6:	89 ca                	mov    %ecx,%edx
+ 4d8:	89 c1                	mov    %eax,%ecx
+ 4da:	39 da                	cmp    %ebx,%edx
+ 4dc:	73 e2                	jae    4c0 <printint+0x30>
+  if(neg)
+ 4de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4e1:	85 c0                	test   %eax,%eax
+ 4e3:	74 07                	je     4ec <printint+0x5c>
+    buf[i++] = '-';
+ 4e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4ea:	89 f7                	mov    %esi,%edi
+ 4ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 4f2:	01 df                	add    %ebx,%edi
+ 4f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 4fb:	83 ec 04             	sub    $0x4,%esp
+ 4fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 501:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 504:	6a 01                	push   $0x1
+ 506:	50                   	push   %eax
+ 507:	56                   	push   %esi
+ 508:	e8 93 fe ff ff       	call   3a0 <write>
+  while(--i >= 0)
+ 50d:	89 f8                	mov    %edi,%eax
+ 50f:	83 c4 10             	add    $0x10,%esp
+ 512:	83 ef 01             	sub    $0x1,%edi
+ 515:	39 d8                	cmp    %ebx,%eax
+ 517:	75 df                	jne    4f8 <printint+0x68>
+}
+ 519:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 51c:	5b                   	pop    %ebx
+ 51d:	5e                   	pop    %esi
+ 51e:	5f                   	pop    %edi
+ 51f:	5d                   	pop    %ebp
+ 520:	c3                   	ret
+ 521:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 528:	31 c0                	xor    %eax,%eax
+ 52a:	eb 89                	jmp    4b5 <printint+0x25>
+ 52c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	56                   	push   %esi
+ 535:	53                   	push   %ebx
+ 536:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 539:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 53c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 53f:	0f b6 1e             	movzbl (%esi),%ebx
+ 542:	83 c6 01             	add    $0x1,%esi
+ 545:	84 db                	test   %bl,%bl
+ 547:	74 67                	je     5b0 <printf+0x80>
+ 549:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 54c:	31 d2                	xor    %edx,%edx
+ 54e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 551:	eb 34                	jmp    587 <printf+0x57>
+ 553:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 557:	90                   	nop
+ 558:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 55b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 560:	83 f8 25             	cmp    $0x25,%eax
+ 563:	74 18                	je     57d <printf+0x4d>
+  write(fd, &c, 1);
+ 565:	83 ec 04             	sub    $0x4,%esp
+ 568:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 56b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 56e:	6a 01                	push   $0x1
+ 570:	50                   	push   %eax
+ 571:	57                   	push   %edi
+ 572:	e8 29 fe ff ff       	call   3a0 <write>
+ 577:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 57a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 57d:	0f b6 1e             	movzbl (%esi),%ebx
+ 580:	83 c6 01             	add    $0x1,%esi
+ 583:	84 db                	test   %bl,%bl
+ 585:	74 29                	je     5b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 587:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 58a:	85 d2                	test   %edx,%edx
+ 58c:	74 ca                	je     558 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 58e:	83 fa 25             	cmp    $0x25,%edx
+ 591:	75 ea                	jne    57d <printf+0x4d>
+      if(c == 'd'){
+ 593:	83 f8 25             	cmp    $0x25,%eax
+ 596:	0f 84 24 01 00 00    	je     6c0 <printf+0x190>
+ 59c:	83 e8 63             	sub    $0x63,%eax
+ 59f:	83 f8 15             	cmp    $0x15,%eax
+ 5a2:	77 1c                	ja     5c0 <printf+0x90>
+ 5a4:	ff 24 85 7c 08 00 00 	jmp    *0x87c(,%eax,4)
+ 5ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5b3:	5b                   	pop    %ebx
+ 5b4:	5e                   	pop    %esi
+ 5b5:	5f                   	pop    %edi
+ 5b6:	5d                   	pop    %ebp
+ 5b7:	c3                   	ret
+ 5b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bf:	90                   	nop
+  write(fd, &c, 1);
+ 5c0:	83 ec 04             	sub    $0x4,%esp
+ 5c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5ca:	6a 01                	push   $0x1
+ 5cc:	52                   	push   %edx
+ 5cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5d0:	57                   	push   %edi
+ 5d1:	e8 ca fd ff ff       	call   3a0 <write>
+ 5d6:	83 c4 0c             	add    $0xc,%esp
+ 5d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5dc:	6a 01                	push   $0x1
+ 5de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5e1:	52                   	push   %edx
+ 5e2:	57                   	push   %edi
+ 5e3:	e8 b8 fd ff ff       	call   3a0 <write>
+        putc(fd, c);
+ 5e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5eb:	31 d2                	xor    %edx,%edx
+ 5ed:	eb 8e                	jmp    57d <printf+0x4d>
+ 5ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 5f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5f3:	83 ec 0c             	sub    $0xc,%esp
+ 5f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5fb:	8b 13                	mov    (%ebx),%edx
+ 5fd:	6a 00                	push   $0x0
+ 5ff:	89 f8                	mov    %edi,%eax
+        ap++;
+ 601:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 604:	e8 87 fe ff ff       	call   490 <printint>
+        ap++;
+ 609:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 60c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 60f:	31 d2                	xor    %edx,%edx
+ 611:	e9 67 ff ff ff       	jmp    57d <printf+0x4d>
+ 616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 620:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 623:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 625:	83 c0 04             	add    $0x4,%eax
+ 628:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 62b:	85 db                	test   %ebx,%ebx
+ 62d:	0f 84 9d 00 00 00    	je     6d0 <printf+0x1a0>
+        while(*s != 0){
+ 633:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 636:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 638:	84 c0                	test   %al,%al
+ 63a:	0f 84 3d ff ff ff    	je     57d <printf+0x4d>
+ 640:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 643:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 646:	89 de                	mov    %ebx,%esi
+ 648:	89 d3                	mov    %edx,%ebx
+ 64a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 650:	83 ec 04             	sub    $0x4,%esp
+ 653:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 656:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 659:	6a 01                	push   $0x1
+ 65b:	53                   	push   %ebx
+ 65c:	57                   	push   %edi
+ 65d:	e8 3e fd ff ff       	call   3a0 <write>
+        while(*s != 0){
+ 662:	0f b6 06             	movzbl (%esi),%eax
+ 665:	83 c4 10             	add    $0x10,%esp
+ 668:	84 c0                	test   %al,%al
+ 66a:	75 e4                	jne    650 <printf+0x120>
+      state = 0;
+ 66c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 66f:	31 d2                	xor    %edx,%edx
+ 671:	e9 07 ff ff ff       	jmp    57d <printf+0x4d>
+ 676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 680:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 683:	83 ec 0c             	sub    $0xc,%esp
+ 686:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 68b:	8b 13                	mov    (%ebx),%edx
+ 68d:	6a 01                	push   $0x1
+ 68f:	e9 6b ff ff ff       	jmp    5ff <printf+0xcf>
+ 694:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 698:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 69b:	83 ec 04             	sub    $0x4,%esp
+ 69e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6a9:	6a 01                	push   $0x1
+ 6ab:	52                   	push   %edx
+ 6ac:	57                   	push   %edi
+ 6ad:	e8 ee fc ff ff       	call   3a0 <write>
+        ap++;
+ 6b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6b8:	31 d2                	xor    %edx,%edx
+ 6ba:	e9 be fe ff ff       	jmp    57d <printf+0x4d>
+ 6bf:	90                   	nop
+  write(fd, &c, 1);
+ 6c0:	83 ec 04             	sub    $0x4,%esp
+ 6c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6c9:	6a 01                	push   $0x1
+ 6cb:	e9 11 ff ff ff       	jmp    5e1 <printf+0xb1>
+ 6d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6d5:	bb 73 08 00 00       	mov    $0x873,%ebx
+ 6da:	e9 61 ff ff ff       	jmp    640 <printf+0x110>
+ 6df:	90                   	nop
+
+000006e0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6e0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6e1:	a1 c4 0b 00 00       	mov    0xbc4,%eax
+{
+ 6e6:	89 e5                	mov    %esp,%ebp
+ 6e8:	57                   	push   %edi
+ 6e9:	56                   	push   %esi
+ 6ea:	53                   	push   %ebx
+ 6eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 6ee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6f8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6fa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6fc:	39 ca                	cmp    %ecx,%edx
+ 6fe:	73 30                	jae    730 <free+0x50>
+ 700:	39 c1                	cmp    %eax,%ecx
+ 702:	72 04                	jb     708 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 704:	39 c2                	cmp    %eax,%edx
+ 706:	72 f0                	jb     6f8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 708:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 70b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 70e:	39 f8                	cmp    %edi,%eax
+ 710:	74 2e                	je     740 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 712:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 715:	8b 42 04             	mov    0x4(%edx),%eax
+ 718:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 71b:	39 f1                	cmp    %esi,%ecx
+ 71d:	74 38                	je     757 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 71f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 721:	5b                   	pop    %ebx
+  freep = p;
+ 722:	89 15 c4 0b 00 00    	mov    %edx,0xbc4
+}
+ 728:	5e                   	pop    %esi
+ 729:	5f                   	pop    %edi
+ 72a:	5d                   	pop    %ebp
+ 72b:	c3                   	ret
+ 72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 730:	39 c1                	cmp    %eax,%ecx
+ 732:	72 d0                	jb     704 <free+0x24>
+ 734:	eb c2                	jmp    6f8 <free+0x18>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 740:	03 70 04             	add    0x4(%eax),%esi
+ 743:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 746:	8b 02                	mov    (%edx),%eax
+ 748:	8b 00                	mov    (%eax),%eax
+ 74a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 74d:	8b 42 04             	mov    0x4(%edx),%eax
+ 750:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 753:	39 f1                	cmp    %esi,%ecx
+ 755:	75 c8                	jne    71f <free+0x3f>
+    p->s.size += bp->s.size;
+ 757:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 75a:	89 15 c4 0b 00 00    	mov    %edx,0xbc4
+    p->s.size += bp->s.size;
+ 760:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 763:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 766:	89 0a                	mov    %ecx,(%edx)
+}
+ 768:	5b                   	pop    %ebx
+ 769:	5e                   	pop    %esi
+ 76a:	5f                   	pop    %edi
+ 76b:	5d                   	pop    %ebp
+ 76c:	c3                   	ret
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000770 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	57                   	push   %edi
+ 774:	56                   	push   %esi
+ 775:	53                   	push   %ebx
+ 776:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 779:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 77c:	8b 15 c4 0b 00 00    	mov    0xbc4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 782:	8d 78 07             	lea    0x7(%eax),%edi
+ 785:	c1 ef 03             	shr    $0x3,%edi
+ 788:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 78b:	85 d2                	test   %edx,%edx
+ 78d:	0f 84 8d 00 00 00    	je     820 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 793:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 795:	8b 48 04             	mov    0x4(%eax),%ecx
+ 798:	39 f9                	cmp    %edi,%ecx
+ 79a:	73 64                	jae    800 <malloc+0x90>
+  if(nu < 4096)
+ 79c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 7a1:	39 df                	cmp    %ebx,%edi
+ 7a3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 7a6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 7ad:	eb 0a                	jmp    7b9 <malloc+0x49>
+ 7af:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7b0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7b2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7b5:	39 f9                	cmp    %edi,%ecx
+ 7b7:	73 47                	jae    800 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 7b9:	89 c2                	mov    %eax,%edx
+ 7bb:	39 05 c4 0b 00 00    	cmp    %eax,0xbc4
+ 7c1:	75 ed                	jne    7b0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 7c3:	83 ec 0c             	sub    $0xc,%esp
+ 7c6:	56                   	push   %esi
+ 7c7:	e8 3c fc ff ff       	call   408 <sbrk>
+  if(p == (char*)-1)
+ 7cc:	83 c4 10             	add    $0x10,%esp
+ 7cf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7d2:	74 1c                	je     7f0 <malloc+0x80>
+  hp->s.size = nu;
+ 7d4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7d7:	83 ec 0c             	sub    $0xc,%esp
+ 7da:	83 c0 08             	add    $0x8,%eax
+ 7dd:	50                   	push   %eax
+ 7de:	e8 fd fe ff ff       	call   6e0 <free>
+  return freep;
+ 7e3:	8b 15 c4 0b 00 00    	mov    0xbc4,%edx
+      if((p = morecore(nunits)) == 0)
+ 7e9:	83 c4 10             	add    $0x10,%esp
+ 7ec:	85 d2                	test   %edx,%edx
+ 7ee:	75 c0                	jne    7b0 <malloc+0x40>
+        return 0;
+  }
+}
+ 7f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7f3:	31 c0                	xor    %eax,%eax
+}
+ 7f5:	5b                   	pop    %ebx
+ 7f6:	5e                   	pop    %esi
+ 7f7:	5f                   	pop    %edi
+ 7f8:	5d                   	pop    %ebp
+ 7f9:	c3                   	ret
+ 7fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 800:	39 cf                	cmp    %ecx,%edi
+ 802:	74 4c                	je     850 <malloc+0xe0>
+        p->s.size -= nunits;
+ 804:	29 f9                	sub    %edi,%ecx
+ 806:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 809:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 80c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 80f:	89 15 c4 0b 00 00    	mov    %edx,0xbc4
+}
+ 815:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 818:	83 c0 08             	add    $0x8,%eax
+}
+ 81b:	5b                   	pop    %ebx
+ 81c:	5e                   	pop    %esi
+ 81d:	5f                   	pop    %edi
+ 81e:	5d                   	pop    %ebp
+ 81f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 820:	c7 05 c4 0b 00 00 c8 	movl   $0xbc8,0xbc4
+ 827:	0b 00 00 
+    base.s.size = 0;
+ 82a:	b8 c8 0b 00 00       	mov    $0xbc8,%eax
+    base.s.ptr = freep = prevp = &base;
+ 82f:	c7 05 c8 0b 00 00 c8 	movl   $0xbc8,0xbc8
+ 836:	0b 00 00 
+    base.s.size = 0;
+ 839:	c7 05 cc 0b 00 00 00 	movl   $0x0,0xbcc
+ 840:	00 00 00 
+    if(p->s.size >= nunits){
+ 843:	e9 54 ff ff ff       	jmp    79c <malloc+0x2c>
+ 848:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 850:	8b 08                	mov    (%eax),%ecx
+ 852:	89 0a                	mov    %ecx,(%edx)
+ 854:	eb b9                	jmp    80f <malloc+0x9f>
@@ -5,10 +5,15 @@ struct inode;
 struct pipe;
 struct proc;
 struct rtcdate;
+struct schedparams;
+struct pinfo;
+struct lathist;
 struct spinlock;
 struct sleeplock;
 struct stat;
+struct slabcache;
 struct superblock;
+struct vmspace;
 
 
 // bio.c
@@ -54,6 +59,11 @@ int             readi(struct inode*, char*, uint, uint);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
 
+// futex.c
+void            futexinit(void);
+int             futex_wait(uint, uint);
+int             futex_wake(uint, int);
+
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
@@ -69,6 +79,12 @@ char*           kalloc(void);
 void            kfree(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+char*           kalloc_zeroed(void);
+char*           kalloc_pages(int);
+void            kfree_pages(char*, int);
+int             kzero_idle(void);
+void            kshare(char*);
+int             kshared(char*);
 
 // kbd.c
 void            kbdintr(void);
@@ -79,6 +95,11 @@ int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicsendipi(uchar, int);
+extern uint     tsc_per_tick;
+void            lapicperiodic(void);
+void            lapiconeshot(uint);
+uint            lapicelapsed(void);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
@@ -99,6 +120,7 @@ void            picenable(int);
 void            picinit(void);
 
 // pipe.c
+void            pipeinit(void);
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
@@ -106,10 +128,14 @@ int             pipewrite(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
 // proc.c
+int             clone(void(*)(void*, void*), void*, void*, void*);
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
+int             getlathist(struct lathist*, int);
+int             getpinfo(struct pinfo*, int);
 int             growproc(int);
+int             join(void**);
 int             kill(int);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
@@ -118,10 +144,29 @@ void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
 void            setproc(struct proc*);
+extern struct schedparams schedparams;
+int             setschedparams(struct schedparams*);
+int             setpolicy(int);
+int             setaffinity(int, uint);
+uint            getaffinity(int);
+int             settickets(int);
+int             setrt(int, int, int);
+int             sched_slice(struct proc*);
+void            sched_age(void);
+int             sched_effprio(struct proc*);
+void            sched_inherit(struct proc*, int);
+void            sched_uninherit(struct proc*);
+int             sched_tick(struct proc*);
 void            sleep(void*, struct spinlock*);
+void            tlbflushintr(void);
 void            userinit(void);
+struct vmspace* vmspace_get(pde_t*, uint);
+void            vmspace_put(struct vmspace*);
+void            vmspace_enter(struct proc*);
+void            vmspace_leave(struct proc*);
 int             wait(void);
 void            wakeup(void*);
+int             wakeupn(void*, int);
 void            yield(void);
 
 // swtch.S
@@ -136,6 +181,14 @@ void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
 
+// slab.c
+void            slabinit(void);
+struct slabcache* slab_create(char*, uint, void(*)(void*), int);
+void*           slab_alloc(struct slabcache*);
+void            slab_free(struct slabcache*, void*);
+void*           kmalloc(uint);
+void            kmfree(void*);
+
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
@@ -154,17 +207,23 @@ char*           strncpy(char*, const char*, int);
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argptrw(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
 void            syscall(void);
 
 // timer.c
-void            timerinit(void);
+uint            timernext(void);
+int             timersleep(uint);
+void            timertick(void);
 
 // trap.c
 void            idtinit(void);
 extern uint     ticks;
+void            timerarm(struct cpu*, struct proc*);
+void            timeridle(struct cpu*);
+void            timerwake(struct cpu*);
 void            tvinit(void);
 extern struct spinlock tickslock;
 
@@ -180,10 +239,15 @@ pde_t*          setupkvm(void);
 char*           uva2ka(pde_t*, char*);
 int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
+void            unmapuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint);
+pde_t*          cowuvm(pde_t*, uint);
+int             cowbreak(pde_t*, uint);
+int             cowbreakall(pde_t*, uint);
+int             cowfault(uint);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
@@ -0,0 +1,141 @@
+// Earliest-deadline-first real-time class.
+//
+// A process that called setrt() has a period, a budget and a relative
+// deadline, all in ticks.  Each job may run for budget ticks, should
+// be done deadline ticks after its release, and a new job is released
+// at most once per period.  Real-time processes are partitioned:
+// setrt() reserves budget/deadline of one CPU for the process and it
+// only ever runs there.  Each CPU keeps them in one list sorted by
+// absolute deadline, and proc.c runs that list before anything the
+// policy (schedclass) has queued.  A job that uses up its budget
+// sleeps until its next release (edf_throttle()).
+// The generic half (placement, admission, locking) is in proc.c.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "sched.h"
+
+// Tick numbers wrap; compare them as a signed distance.
+static int
+dl_before(uint a, uint b)
+{
+  return (int)(a - b) < 0;
+}
+
+// Share of a CPU, in per-mille, reserved for budget ticks out of
+// every deadline ticks.  Rounds up so admission stays conservative.
+int
+edf_util(int budget, int deadline)
+{
+  return (budget * 1000 + deadline - 1) / deadline;
+}
+
+// Start a new job if p's current period is over.
+static void
+edf_release(struct proc *p)
+{
+  if(dl_before(ticks, p->rtrelease + p->rtperiod))
+    return;
+  p->rtrelease = ticks;
+  p->rtdl = ticks + p->rtdeadline;
+  p->rtleft = p->rtbudget;
+}
+
+static void
+edf_enqueue(struct cpu *c, struct proc *p)
+{
+  struct edf *e = &c->rq.edf;
+  struct proc *prev, *next;
+
+  edf_release(p);
+
+  // Sorted insert, behind processes with an equal deadline.
+  prev = 0;
+  for(next = e->head; next && !dl_before(p->rtdl, next->rtdl); next = next->rqnext)
+    prev = next;
+  p->rqprev = prev;
+  p->rqnext = next;
+  if(prev)
+    prev->rqnext = p;
+  else
+    e->head = p;
+  if(next)
+    next->rqprev = p;
+}
+
+static void
+edf_dequeue(struct proc *p)
+{
+  struct edf *e = &cpus[p->rqcpu].rq.edf;
+
+  if(p->rqprev)
+    p->rqprev->rqnext = p->rqnext;
+  else
+    e->head = p->rqnext;
+  if(p->rqnext)
+    p->rqnext->rqprev = p->rqprev;
+  p->rqnext = p->rqprev = 0;
+}
+
+static struct proc*
+edf_pick(struct cpu *c)
+{
+  return c->rq.edf.head;
+}
+
+// Budget enforcement: give up the CPU once this job's budget is gone.
+static int
+edf_tick(struct proc *p)
+{
+  if(p->rtleft > 0)
+    p->rtleft--;
+  return p->rtleft == 0;
+}
+
+static int
+edf_slice(struct proc *p)
+{
+  return p->rtleft > 0 ? p->rtleft : 1;
+}
+
+// Should the earliest deadline queued on c take the CPU from p,
+// which is running there?
+int
+edf_preempts(struct cpu *c, struct proc *p)
+{
+  struct proc *h = c->rq.edf.head;
+
+  if(h == 0)
+    return 0;
+  return p->rtperiod == 0 || dl_before(h->rtdl, p->rtdl);
+}
+
+// The running process used up its budget: sit out the rest of the
+// period.  edf_release() refills it when it is queued again.
+void
+edf_throttle(void)
+{
+  struct proc *p = myproc();
+  int n = p->rtrelease + p->rtperiod - ticks;
+
+  if(n > 0)
+    timersleep(n);
+  else
+    yield();
+}
+
+struct sched_class edf_class = {
+  .name = "edf",
+  .enqueue = edf_enqueue,
+  .dequeue = edf_dequeue,
+  .pick = edf_pick,
+  .tick = edf_tick,
+  .slice = edf_slice,
+  .charge = 0,
+  .age = 0,
+};
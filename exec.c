@@ -16,7 +16,8 @@ exec(char *path, char **argv)
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
-  pde_t *pgdir, *oldpgdir;
+  pde_t *pgdir;
+  struct vmspace *vm, *oldvm;
   struct proc *curproc = myproc();
 
   begin_op();
@@ -93,14 +94,18 @@ exec(char *path, char **argv)
       last = s+1;
   safestrcpy(curproc->name, last, sizeof(curproc->name));
 
-  // Commit to the user image.
-  oldpgdir = curproc->pgdir;
-  curproc->pgdir = pgdir;
-  curproc->sz = sz;
+  // Commit to the user image.  It is a new address space of our own:
+  // threads sharing the old one keep running in it.
+  if((vm = vmspace_get(pgdir, sz)) == 0)
+    goto bad;
+  oldvm = curproc->vm;
+  vmspace_leave(curproc);
+  curproc->vm = vm;
+  vmspace_enter(curproc);
   curproc->tf->eip = elf.entry;  // main
   curproc->tf->esp = sp;
   switchuvm(curproc);
-  freevm(oldpgdir);
+  vmspace_put(oldvm);
   return 0;
 
  bad:
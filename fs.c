@@ -124,7 +124,9 @@ bfree(int dev, uint b)
 //   the number of in-memory pointers to the entry (open
 //   files and current directories). iget() finds or
 //   creates a cache entry and increments its ref; iput()
-//   decrements ref.
+//   decrements ref.  Entries come from kmalloc(), so there
+//   is no fixed limit on inodes in use; iput() keeps up to
+//   NINODE free entries for reuse and kmfree()s the rest.
 //
 // * Valid: the information (type, size, &c) in an inode
 //   cache entry is only correct when ip->valid is 1.
@@ -165,18 +167,14 @@ bfree(int dev, uint b)
 
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct inode *list;   // all entries, linked through next
+  int nfree;            // entries with ref 0
 } icache;
 
 void
 iinit(int dev)
 {
-  int i = 0;
-  
   initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
 
   readsb(dev, &sb);
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
@@ -247,7 +245,7 @@ iget(uint dev, uint inum)
 
   // Is the inode already cached?
   empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+  for(ip = icache.list; ip; ip = ip->next){
     if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
       ip->ref++;
       release(&icache.lock);
@@ -257,9 +255,16 @@ iget(uint dev, uint inum)
       empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
-    panic("iget: no inodes");
+  // Recycle an inode cache entry, or make a new one.
+  if(empty){
+    icache.nfree--;
+  } else {
+    if((empty = kmalloc(sizeof(*empty))) == 0)
+      panic("iget: no inodes");
+    initsleeplock(&empty->lock, "inode");
+    empty->next = icache.list;
+    icache.list = empty;
+  }
 
   ip = empty;
   ip->dev = dev;
@@ -271,6 +276,19 @@ iget(uint dev, uint inum)
   return ip;
 }
 
+// Unlink a free entry from the cache and give back its memory.
+// Caller holds icache.lock.
+static void
+ifree(struct inode *ip)
+{
+  struct inode **pp;
+
+  for(pp = &icache.list; *pp != ip; pp = &(*pp)->next)
+    ;
+  *pp = ip->next;
+  kmfree(ip);
+}
+
 // Increment reference count for ip.
 // Returns ip to enable ip = idup(ip1) idiom.
 struct inode*
@@ -347,7 +365,12 @@ iput(struct inode *ip)
   releasesleep(&ip->lock);
 
   acquire(&icache.lock);
-  ip->ref--;
+  if(--ip->ref == 0){
+    if(icache.nfree < NINODE)
+      icache.nfree++;
+    else
+      ifree(ip);
+  }
   release(&icache.lock);
 }
 
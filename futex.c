@@ -0,0 +1,92 @@
+// Futexes: blocking for user-space locks.
+//
+// A user lock lives in a word of user memory and is taken and
+// released there with atomic instructions; only contended operations
+// enter the kernel.  futex_wait(addr, val) sleeps as long as *addr
+// still holds val, and futex_wake(addr, n) wakes up to n processes
+// sleeping on addr.  Sleepers are keyed by the word's physical
+// address (through the kernel's direct map), so threads sharing an
+// address space meet on the same key however they reach it.
+//
+// The check of *addr and the sleep happen under the futex lock of the
+// key, which futex_wake() also takes, so a wake that follows a change
+// of *addr cannot slip in between them.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+
+#define NFUTEXLOCK 16   // power of 2
+
+static struct spinlock futexlock[NFUTEXLOCK];
+
+void
+futexinit(void)
+{
+  for(int i = 0; i < NFUTEXLOCK; i++)
+    initlock(&futexlock[i], "futex");
+}
+
+// Kernel address of the user word at addr, or 0 if it is not a
+// mapped, aligned word of the caller's memory.
+static uint*
+futex_key(uint addr)
+{
+  struct vmspace *vm = myproc()->vm;
+  char *pg;
+
+  if(addr & 3 || addr >= vm->sz || addr + 4 > vm->sz)
+    return 0;
+  if((pg = uva2ka(vm->pgdir, (char*)PGROUNDDOWN(addr))) == 0)
+    return 0;
+  return (uint*)(pg + (addr & (PGSIZE-1)));
+}
+
+static struct spinlock*
+futex_lock(uint *key)
+{
+  return &futexlock[((uint)key >> 2) & (NFUTEXLOCK-1)];
+}
+
+// Sleep until woken if *addr == val.  Returns 0 once woken, -1 if
+// *addr had already changed, addr is bad, or we were killed.
+int
+futex_wait(uint addr, uint val)
+{
+  struct spinlock *lk;
+  uint *key;
+
+  if((key = futex_key(addr)) == 0)
+    return -1;
+  lk = futex_lock(key);
+  acquire(lk);
+  if(*(volatile uint*)key != val || myproc()->killed){
+    release(lk);
+    return -1;
+  }
+  sleep(key, lk);
+  release(lk);
+  return myproc()->killed ? -1 : 0;
+}
+
+// Wake up to n processes waiting on addr.  Returns how many woke.
+int
+futex_wake(uint addr, int n)
+{
+  struct spinlock *lk;
+  uint *key;
+  int woken;
+
+  if((key = futex_key(addr)) == 0 || n < 0)
+    return -1;
+  lk = futex_lock(key);
+  acquire(lk);
+  woken = wakeupn(key, n);
+  release(lk);
+  return woken;
+}
@@ -0,0 +1,1316 @@
+
+_io_yielder:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 0c             	sub    $0xc,%esp
+  int i, n;
+
+  if(argc < 2){
+  13:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  16:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc < 2){
+  19:	7e 36                	jle    51 <main+0x51>
+    printf(1, "Usage: io_yielder <n>\n");
+    exit();
+  }
+
+  n = atoi(argv[1]);
+  1b:	83 ec 0c             	sub    $0xc,%esp
+  1e:	ff 70 04             	push   0x4(%eax)
+  21:	e8 1a 02 00 00       	call   240 <atoi>
+  for(i = 0; i < n; i++){
+  26:	83 c4 10             	add    $0x10,%esp
+  n = atoi(argv[1]);
+  29:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < n; i++){
+  2b:	85 c0                	test   %eax,%eax
+  2d:	7e 1d                	jle    4c <main+0x4c>
+  2f:	31 db                	xor    %ebx,%ebx
+  31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    sleep(1);   // nhường CPU cho process khác
+  38:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < n; i++){
+  3b:	83 c3 01             	add    $0x1,%ebx
+    sleep(1);   // nhường CPU cho process khác
+  3e:	6a 01                	push   $0x1
+  40:	e8 7b 03 00 00       	call   3c0 <sleep>
+  for(i = 0; i < n; i++){
+  45:	83 c4 10             	add    $0x10,%esp
+  48:	39 de                	cmp    %ebx,%esi
+  4a:	75 ec                	jne    38 <main+0x38>
+  }
+
+  exit();
+  4c:	e8 df 02 00 00       	call   330 <exit>
+    printf(1, "Usage: io_yielder <n>\n");
+  51:	50                   	push   %eax
+  52:	50                   	push   %eax
+  53:	68 08 08 00 00       	push   $0x808
+  58:	6a 01                	push   $0x1
+  5a:	e8 81 04 00 00       	call   4e0 <printf>
+    exit();
+  5f:	e8 cc 02 00 00       	call   330 <exit>
+  64:	66 90                	xchg   %ax,%ax
+  66:	66 90                	xchg   %ax,%ax
+  68:	66 90                	xchg   %ax,%ax
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  71:	31 c0                	xor    %eax,%eax
+{
+  73:	89 e5                	mov    %esp,%ebp
+  75:	53                   	push   %ebx
+  76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	84 d2                	test   %dl,%dl
+  8c:	75 f2                	jne    80 <strcpy+0x10>
+    ;
+  return os;
+}
+  8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  91:	89 c8                	mov    %ecx,%eax
+  93:	c9                   	leave
+  94:	c3                   	ret
+  95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	53                   	push   %ebx
+  a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  aa:	0f b6 02             	movzbl (%edx),%eax
+  ad:	84 c0                	test   %al,%al
+  af:	75 17                	jne    c8 <strcmp+0x28>
+  b1:	eb 3a                	jmp    ed <strcmp+0x4d>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+  b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  bc:	83 c2 01             	add    $0x1,%edx
+  bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  c2:	84 c0                	test   %al,%al
+  c4:	74 1a                	je     e0 <strcmp+0x40>
+    p++, q++;
+  c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  c8:	0f b6 19             	movzbl (%ecx),%ebx
+  cb:	38 c3                	cmp    %al,%bl
+  cd:	74 e9                	je     b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  cf:	29 d8                	sub    %ebx,%eax
+}
+  d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d4:	c9                   	leave
+  d5:	c3                   	ret
+  d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  e4:	31 c0                	xor    %eax,%eax
+  e6:	29 d8                	sub    %ebx,%eax
+}
+  e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  eb:	c9                   	leave
+  ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ed:	0f b6 19             	movzbl (%ecx),%ebx
+  f0:	31 c0                	xor    %eax,%eax
+  f2:	eb db                	jmp    cf <strcmp+0x2f>
+  f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+
+00000100 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 106:	80 3a 00             	cmpb   $0x0,(%edx)
+ 109:	74 15                	je     120 <strlen+0x20>
+ 10b:	31 c0                	xor    %eax,%eax
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+ 110:	83 c0 01             	add    $0x1,%eax
+ 113:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 117:	89 c1                	mov    %eax,%ecx
+ 119:	75 f5                	jne    110 <strlen+0x10>
+    ;
+  return n;
+}
+ 11b:	89 c8                	mov    %ecx,%eax
+ 11d:	5d                   	pop    %ebp
+ 11e:	c3                   	ret
+ 11f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 120:	31 c9                	xor    %ecx,%ecx
+}
+ 122:	5d                   	pop    %ebp
+ 123:	89 c8                	mov    %ecx,%eax
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 13a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13d:	89 d7                	mov    %edx,%edi
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 142:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 145:	89 d0                	mov    %edx,%eax
+ 147:	c9                   	leave
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 45 08             	mov    0x8(%ebp),%eax
+ 156:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 15a:	0f b6 10             	movzbl (%eax),%edx
+ 15d:	84 d2                	test   %dl,%dl
+ 15f:	75 12                	jne    173 <strchr+0x23>
+ 161:	eb 1d                	jmp    180 <strchr+0x30>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 16c:	83 c0 01             	add    $0x1,%eax
+ 16f:	84 d2                	test   %dl,%dl
+ 171:	74 0d                	je     180 <strchr+0x30>
+    if(*s == c)
+ 173:	38 d1                	cmp    %dl,%cl
+ 175:	75 f1                	jne    168 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 177:	5d                   	pop    %ebp
+ 178:	c3                   	ret
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 180:	31 c0                	xor    %eax,%eax
+}
+ 182:	5d                   	pop    %ebp
+ 183:	c3                   	ret
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 195:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 198:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 199:	31 db                	xor    %ebx,%ebx
+{
+ 19b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 19e:	eb 27                	jmp    1c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1a0:	83 ec 04             	sub    $0x4,%esp
+ 1a3:	6a 01                	push   $0x1
+ 1a5:	56                   	push   %esi
+ 1a6:	6a 00                	push   $0x0
+ 1a8:	e8 9b 01 00 00       	call   348 <read>
+    if(cc < 1)
+ 1ad:	83 c4 10             	add    $0x10,%esp
+ 1b0:	85 c0                	test   %eax,%eax
+ 1b2:	7e 1d                	jle    1d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1bf:	3c 0a                	cmp    $0xa,%al
+ 1c1:	74 10                	je     1d3 <gets+0x43>
+ 1c3:	3c 0d                	cmp    $0xd,%al
+ 1c5:	74 0c                	je     1d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1c7:	89 df                	mov    %ebx,%edi
+ 1c9:	83 c3 01             	add    $0x1,%ebx
+ 1cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1cf:	7c cf                	jl     1a0 <gets+0x10>
+ 1d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1dd:	5b                   	pop    %ebx
+ 1de:	5e                   	pop    %esi
+ 1df:	5f                   	pop    %edi
+ 1e0:	5d                   	pop    %ebp
+ 1e1:	c3                   	ret
+ 1e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	56                   	push   %esi
+ 1f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f5:	83 ec 08             	sub    $0x8,%esp
+ 1f8:	6a 00                	push   $0x0
+ 1fa:	ff 75 08             	push   0x8(%ebp)
+ 1fd:	e8 6e 01 00 00       	call   370 <open>
+  if(fd < 0)
+ 202:	83 c4 10             	add    $0x10,%esp
+ 205:	85 c0                	test   %eax,%eax
+ 207:	78 27                	js     230 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 209:	83 ec 08             	sub    $0x8,%esp
+ 20c:	ff 75 0c             	push   0xc(%ebp)
+ 20f:	89 c3                	mov    %eax,%ebx
+ 211:	50                   	push   %eax
+ 212:	e8 71 01 00 00       	call   388 <fstat>
+  close(fd);
+ 217:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 21a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 21c:	e8 37 01 00 00       	call   358 <close>
+  return r;
+ 221:	83 c4 10             	add    $0x10,%esp
+}
+ 224:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 227:	89 f0                	mov    %esi,%eax
+ 229:	5b                   	pop    %ebx
+ 22a:	5e                   	pop    %esi
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 235:	eb ed                	jmp    224 <stat+0x34>
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+
+00000240 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 247:	0f be 02             	movsbl (%edx),%eax
+ 24a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 24d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 255:	77 1e                	ja     275 <atoi+0x35>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 260:	83 c2 01             	add    $0x1,%edx
+ 263:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 266:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 26a:	0f be 02             	movsbl (%edx),%eax
+ 26d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 270:	80 fb 09             	cmp    $0x9,%bl
+ 273:	76 eb                	jbe    260 <atoi+0x20>
+  return n;
+}
+ 275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 278:	89 c8                	mov    %ecx,%eax
+ 27a:	c9                   	leave
+ 27b:	c3                   	ret
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	8b 45 10             	mov    0x10(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 28e:	85 c0                	test   %eax,%eax
+ 290:	7e 13                	jle    2a5 <memmove+0x25>
+ 292:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 294:	89 d7                	mov    %edx,%edi
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2a1:	39 f8                	cmp    %edi,%eax
+ 2a3:	75 fb                	jne    2a0 <memmove+0x20>
+  return vdst;
+}
+ 2a5:	5e                   	pop    %esi
+ 2a6:	89 d0                	mov    %edx,%eax
+ 2a8:	5f                   	pop    %edi
+ 2a9:	5d                   	pop    %ebp
+ 2aa:	c3                   	ret
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <mutex_lock>:
+
+// Take and release m with atomic instructions, and enter the kernel
+// only to block while it is held or to wake a blocked thread.
+void
+mutex_lock(struct mutex *m)
+{
+ 2b0:	55                   	push   %ebp
+  uint s;
+
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 2b1:	31 c0                	xor    %eax,%eax
+ 2b3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 2b8:	89 e5                	mov    %esp,%ebp
+ 2ba:	56                   	push   %esi
+ 2bb:	53                   	push   %ebx
+ 2bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 2bf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 2c3:	85 c0                	test   %eax,%eax
+ 2c5:	74 30                	je     2f7 <mutex_lock+0x47>
+    return;
+  // Contended: mark it so the holder knows to wake us.
+  if(s != 2)
+ 2c7:	83 f8 02             	cmp    $0x2,%eax
+ 2ca:	74 0c                	je     2d8 <mutex_lock+0x28>
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 2cc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2d1:	f0 87 03             	lock xchg %eax,(%ebx)
+    s = xchg(&m->state, 2);
+  while(s != 0){
+ 2d4:	85 c0                	test   %eax,%eax
+ 2d6:	74 1f                	je     2f7 <mutex_lock+0x47>
+ 2d8:	be 02 00 00 00       	mov    $0x2,%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+ 2e0:	83 ec 08             	sub    $0x8,%esp
+ 2e3:	6a 02                	push   $0x2
+ 2e5:	53                   	push   %ebx
+ 2e6:	e8 45 01 00 00       	call   430 <futex_wait>
+ 2eb:	89 f0                	mov    %esi,%eax
+ 2ed:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(s != 0){
+ 2f0:	83 c4 10             	add    $0x10,%esp
+ 2f3:	85 c0                	test   %eax,%eax
+ 2f5:	75 e9                	jne    2e0 <mutex_lock+0x30>
+    s = xchg(&m->state, 2);
+  }
+}
+ 2f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2fa:	5b                   	pop    %ebx
+ 2fb:	5e                   	pop    %esi
+ 2fc:	5d                   	pop    %ebp
+ 2fd:	c3                   	ret
+ 2fe:	66 90                	xchg   %ax,%ax
+
+00000300 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 300:	55                   	push   %ebp
+ 301:	31 c0                	xor    %eax,%eax
+ 303:	89 e5                	mov    %esp,%ebp
+ 305:	83 ec 08             	sub    $0x8,%esp
+ 308:	8b 55 08             	mov    0x8(%ebp),%edx
+ 30b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 30e:	83 f8 02             	cmp    $0x2,%eax
+ 311:	74 05                	je     318 <mutex_unlock+0x18>
+    futex_wake(&m->state, 1);
+}
+ 313:	c9                   	leave
+ 314:	c3                   	ret
+ 315:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->state, 1);
+ 318:	83 ec 08             	sub    $0x8,%esp
+ 31b:	6a 01                	push   $0x1
+ 31d:	52                   	push   %edx
+ 31e:	e8 15 01 00 00       	call   438 <futex_wake>
+ 323:	83 c4 10             	add    $0x10,%esp
+}
+ 326:	c9                   	leave
+ 327:	c3                   	ret
+
+00000328 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 328:	b8 01 00 00 00       	mov    $0x1,%eax
+ 32d:	cd 40                	int    $0x40
+ 32f:	c3                   	ret
+
+00000330 <exit>:
+SYSCALL(exit)
+ 330:	b8 02 00 00 00       	mov    $0x2,%eax
+ 335:	cd 40                	int    $0x40
+ 337:	c3                   	ret
+
+00000338 <wait>:
+SYSCALL(wait)
+ 338:	b8 03 00 00 00       	mov    $0x3,%eax
+ 33d:	cd 40                	int    $0x40
+ 33f:	c3                   	ret
+
+00000340 <pipe>:
+SYSCALL(pipe)
+ 340:	b8 04 00 00 00       	mov    $0x4,%eax
+ 345:	cd 40                	int    $0x40
+ 347:	c3                   	ret
+
+00000348 <read>:
+SYSCALL(read)
+ 348:	b8 05 00 00 00       	mov    $0x5,%eax
+ 34d:	cd 40                	int    $0x40
+ 34f:	c3                   	ret
+
+00000350 <write>:
+SYSCALL(write)
+ 350:	b8 10 00 00 00       	mov    $0x10,%eax
+ 355:	cd 40                	int    $0x40
+ 357:	c3                   	ret
+
+00000358 <close>:
+SYSCALL(close)
+ 358:	b8 15 00 00 00       	mov    $0x15,%eax
+ 35d:	cd 40                	int    $0x40
+ 35f:	c3                   	ret
+
+00000360 <kill>:
+SYSCALL(kill)
+ 360:	b8 06 00 00 00       	mov    $0x6,%eax
+ 365:	cd 40                	int    $0x40
+ 367:	c3                   	ret
+
+00000368 <exec>:
+SYSCALL(exec)
+ 368:	b8 07 00 00 00       	mov    $0x7,%eax
+ 36d:	cd 40                	int    $0x40
+ 36f:	c3                   	ret
+
+00000370 <open>:
+SYSCALL(open)
+ 370:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 375:	cd 40                	int    $0x40
+ 377:	c3                   	ret
+
+00000378 <mknod>:
+SYSCALL(mknod)
+ 378:	b8 11 00 00 00       	mov    $0x11,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <unlink>:
+SYSCALL(unlink)
+ 380:	b8 12 00 00 00       	mov    $0x12,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <fstat>:
+SYSCALL(fstat)
+ 388:	b8 08 00 00 00       	mov    $0x8,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <link>:
+SYSCALL(link)
+ 390:	b8 13 00 00 00       	mov    $0x13,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <mkdir>:
+SYSCALL(mkdir)
+ 398:	b8 14 00 00 00       	mov    $0x14,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <chdir>:
+SYSCALL(chdir)
+ 3a0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <dup>:
+SYSCALL(dup)
+ 3a8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <getpid>:
+SYSCALL(getpid)
+ 3b0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <sbrk>:
+SYSCALL(sbrk)
+ 3b8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <sleep>:
+SYSCALL(sleep)
+ 3c0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <uptime>:
+SYSCALL(uptime)
+ 3c8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <ps>:
+SYSCALL(ps)
+ 3d0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <getschedparams>:
+SYSCALL(getschedparams)
+ 3d8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <setschedparams>:
+SYSCALL(setschedparams)
+ 3e0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <getpinfo>:
+SYSCALL(getpinfo)
+ 3e8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <getlathist>:
+SYSCALL(getlathist)
+ 3f0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <setpolicy>:
+SYSCALL(setpolicy)
+ 3f8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <settickets>:
+SYSCALL(settickets)
+ 400:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <setaffinity>:
+SYSCALL(setaffinity)
+ 408:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <getaffinity>:
+SYSCALL(getaffinity)
+ 410:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <setrt>:
+SYSCALL(setrt)
+ 418:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <clone>:
+SYSCALL(clone)
+ 420:	b8 20 00 00 00       	mov    $0x20,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <join>:
+SYSCALL(join)
+ 428:	b8 21 00 00 00       	mov    $0x21,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <futex_wait>:
+SYSCALL(futex_wait)
+ 430:	b8 22 00 00 00       	mov    $0x22,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <futex_wake>:
+SYSCALL(futex_wake)
+ 438:	b8 23 00 00 00       	mov    $0x23,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	53                   	push   %ebx
+ 446:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 448:	89 d1                	mov    %edx,%ecx
+{
+ 44a:	83 ec 3c             	sub    $0x3c,%esp
+ 44d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 450:	85 d2                	test   %edx,%edx
+ 452:	0f 89 80 00 00 00    	jns    4d8 <printint+0x98>
+ 458:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 45c:	74 7a                	je     4d8 <printint+0x98>
+    x = -xx;
+ 45e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 460:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 465:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 468:	31 f6                	xor    %esi,%esi
+ 46a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 470:	89 c8                	mov    %ecx,%eax
+ 472:	31 d2                	xor    %edx,%edx
+ 474:	89 f7                	mov    %esi,%edi
+ 476:	f7 f3                	div    %ebx
+ 478:	8d 76 01             	lea    0x1(%esi),%esi
+ 47b:	0f b6 92 80 08 00 00 	movzbl 0x880(%edx),%edx
+ 482:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 486:	89 ca                	mov    %ecx,%edx
+ 488:	89 c1                	mov    %eax,%ecx
+ 48a:	39 da                	cmp    %ebx,%edx
+ 48c:	73 e2                	jae    470 <printint+0x30>
+  if(neg)
+ 48e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 491:	85 c0                	test   %eax,%eax
+ 493:	74 07                	je     49c <printint+0x5c>
+    buf[i++] = '-';
+ 495:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 49a:	89 f7                	mov    %esi,%edi
+ 49c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 49f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 4a2:	01 df                	add    %ebx,%edi
+ 4a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 4ab:	83 ec 04             	sub    $0x4,%esp
+ 4ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 4b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 4b4:	6a 01                	push   $0x1
+ 4b6:	50                   	push   %eax
+ 4b7:	56                   	push   %esi
+ 4b8:	e8 93 fe ff ff       	call   350 <write>
+  while(--i >= 0)
+ 4bd:	89 f8                	mov    %edi,%eax
+ 4bf:	83 c4 10             	add    $0x10,%esp
+ 4c2:	83 ef 01             	sub    $0x1,%edi
+ 4c5:	39 d8                	cmp    %ebx,%eax
+ 4c7:	75 df                	jne    4a8 <printint+0x68>
+}
+ 4c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4cc:	5b                   	pop    %ebx
+ 4cd:	5e                   	pop    %esi
+ 4ce:	5f                   	pop    %edi
+ 4cf:	5d                   	pop    %ebp
+ 4d0:	c3                   	ret
+ 4d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 4d8:	31 c0                	xor    %eax,%eax
+ 4da:	eb 89                	jmp    465 <printint+0x25>
+ 4dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+ 4e5:	53                   	push   %ebx
+ 4e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 4f2:	83 c6 01             	add    $0x1,%esi
+ 4f5:	84 db                	test   %bl,%bl
+ 4f7:	74 67                	je     560 <printf+0x80>
+ 4f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4fc:	31 d2                	xor    %edx,%edx
+ 4fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 501:	eb 34                	jmp    537 <printf+0x57>
+ 503:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 507:	90                   	nop
+ 508:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 50b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 510:	83 f8 25             	cmp    $0x25,%eax
+ 513:	74 18                	je     52d <printf+0x4d>
+  write(fd, &c, 1);
+ 515:	83 ec 04             	sub    $0x4,%esp
+ 518:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 51b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 51e:	6a 01                	push   $0x1
+ 520:	50                   	push   %eax
+ 521:	57                   	push   %edi
+ 522:	e8 29 fe ff ff       	call   350 <write>
+ 527:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 52a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 52d:	0f b6 1e             	movzbl (%esi),%ebx
+ 530:	83 c6 01             	add    $0x1,%esi
+ 533:	84 db                	test   %bl,%bl
+ 535:	74 29                	je     560 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 537:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 53a:	85 d2                	test   %edx,%edx
+ 53c:	74 ca                	je     508 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 53e:	83 fa 25             	cmp    $0x25,%edx
+ 541:	75 ea                	jne    52d <printf+0x4d>
+      if(c == 'd'){
+ 543:	83 f8 25             	cmp    $0x25,%eax
+ 546:	0f 84 24 01 00 00    	je     670 <printf+0x190>
+ 54c:	83 e8 63             	sub    $0x63,%eax
+ 54f:	83 f8 15             	cmp    $0x15,%eax
+ 552:	77 1c                	ja     570 <printf+0x90>
+ 554:	ff 24 85 28 08 00 00 	jmp    *0x828(,%eax,4)
+ 55b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 560:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 563:	5b                   	pop    %ebx
+ 564:	5e                   	pop    %esi
+ 565:	5f                   	pop    %edi
+ 566:	5d                   	pop    %ebp
+ 567:	c3                   	ret
+ 568:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56f:	90                   	nop
+  write(fd, &c, 1);
+ 570:	83 ec 04             	sub    $0x4,%esp
+ 573:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 576:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 57a:	6a 01                	push   $0x1
+ 57c:	52                   	push   %edx
+ 57d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 580:	57                   	push   %edi
+ 581:	e8 ca fd ff ff       	call   350 <write>
+ 586:	83 c4 0c             	add    $0xc,%esp
+ 589:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 58c:	6a 01                	push   $0x1
+ 58e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 591:	52                   	push   %edx
+ 592:	57                   	push   %edi
+ 593:	e8 b8 fd ff ff       	call   350 <write>
+        putc(fd, c);
+ 598:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 59b:	31 d2                	xor    %edx,%edx
+ 59d:	eb 8e                	jmp    52d <printf+0x4d>
+ 59f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 5a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5a3:	83 ec 0c             	sub    $0xc,%esp
+ 5a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5ab:	8b 13                	mov    (%ebx),%edx
+ 5ad:	6a 00                	push   $0x0
+ 5af:	89 f8                	mov    %edi,%eax
+        ap++;
+ 5b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 5b4:	e8 87 fe ff ff       	call   440 <printint>
+        ap++;
+ 5b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5bf:	31 d2                	xor    %edx,%edx
+ 5c1:	e9 67 ff ff ff       	jmp    52d <printf+0x4d>
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 5d5:	83 c0 04             	add    $0x4,%eax
+ 5d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 5db:	85 db                	test   %ebx,%ebx
+ 5dd:	0f 84 9d 00 00 00    	je     680 <printf+0x1a0>
+        while(*s != 0){
+ 5e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5e8:	84 c0                	test   %al,%al
+ 5ea:	0f 84 3d ff ff ff    	je     52d <printf+0x4d>
+ 5f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5f6:	89 de                	mov    %ebx,%esi
+ 5f8:	89 d3                	mov    %edx,%ebx
+ 5fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 600:	83 ec 04             	sub    $0x4,%esp
+ 603:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 606:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 609:	6a 01                	push   $0x1
+ 60b:	53                   	push   %ebx
+ 60c:	57                   	push   %edi
+ 60d:	e8 3e fd ff ff       	call   350 <write>
+        while(*s != 0){
+ 612:	0f b6 06             	movzbl (%esi),%eax
+ 615:	83 c4 10             	add    $0x10,%esp
+ 618:	84 c0                	test   %al,%al
+ 61a:	75 e4                	jne    600 <printf+0x120>
+      state = 0;
+ 61c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 61f:	31 d2                	xor    %edx,%edx
+ 621:	e9 07 ff ff ff       	jmp    52d <printf+0x4d>
+ 626:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 630:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 633:	83 ec 0c             	sub    $0xc,%esp
+ 636:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 63b:	8b 13                	mov    (%ebx),%edx
+ 63d:	6a 01                	push   $0x1
+ 63f:	e9 6b ff ff ff       	jmp    5af <printf+0xcf>
+ 644:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 648:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 64b:	83 ec 04             	sub    $0x4,%esp
+ 64e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 651:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 653:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 656:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 659:	6a 01                	push   $0x1
+ 65b:	52                   	push   %edx
+ 65c:	57                   	push   %edi
+ 65d:	e8 ee fc ff ff       	call   350 <write>
+        ap++;
+ 662:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 665:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 668:	31 d2                	xor    %edx,%edx
+ 66a:	e9 be fe ff ff       	jmp    52d <printf+0x4d>
+ 66f:	90                   	nop
+  write(fd, &c, 1);
+ 670:	83 ec 04             	sub    $0x4,%esp
+ 673:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 676:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 679:	6a 01                	push   $0x1
+ 67b:	e9 11 ff ff ff       	jmp    591 <printf+0xb1>
+ 680:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 685:	bb 1f 08 00 00       	mov    $0x81f,%ebx
+ 68a:	e9 61 ff ff ff       	jmp    5f0 <printf+0x110>
+ 68f:	90                   	nop
+
+00000690 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 690:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 691:	a1 74 0b 00 00       	mov    0xb74,%eax
+{
+ 696:	89 e5                	mov    %esp,%ebp
+ 698:	57                   	push   %edi
+ 699:	56                   	push   %esi
+ 69a:	53                   	push   %ebx
+ 69b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 69e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6a8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6aa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6ac:	39 ca                	cmp    %ecx,%edx
+ 6ae:	73 30                	jae    6e0 <free+0x50>
+ 6b0:	39 c1                	cmp    %eax,%ecx
+ 6b2:	72 04                	jb     6b8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6b4:	39 c2                	cmp    %eax,%edx
+ 6b6:	72 f0                	jb     6a8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6b8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6bb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 6be:	39 f8                	cmp    %edi,%eax
+ 6c0:	74 2e                	je     6f0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6c2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6c5:	8b 42 04             	mov    0x4(%edx),%eax
+ 6c8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6cb:	39 f1                	cmp    %esi,%ecx
+ 6cd:	74 38                	je     707 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6cf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 6d1:	5b                   	pop    %ebx
+  freep = p;
+ 6d2:	89 15 74 0b 00 00    	mov    %edx,0xb74
+}
+ 6d8:	5e                   	pop    %esi
+ 6d9:	5f                   	pop    %edi
+ 6da:	5d                   	pop    %ebp
+ 6db:	c3                   	ret
+ 6dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6e0:	39 c1                	cmp    %eax,%ecx
+ 6e2:	72 d0                	jb     6b4 <free+0x24>
+ 6e4:	eb c2                	jmp    6a8 <free+0x18>
+ 6e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ed:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 6f0:	03 70 04             	add    0x4(%eax),%esi
+ 6f3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6f6:	8b 02                	mov    (%edx),%eax
+ 6f8:	8b 00                	mov    (%eax),%eax
+ 6fa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 6fd:	8b 42 04             	mov    0x4(%edx),%eax
+ 700:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 703:	39 f1                	cmp    %esi,%ecx
+ 705:	75 c8                	jne    6cf <free+0x3f>
+    p->s.size += bp->s.size;
+ 707:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 70a:	89 15 74 0b 00 00    	mov    %edx,0xb74
+    p->s.size += bp->s.size;
+ 710:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 713:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 716:	89 0a                	mov    %ecx,(%edx)
+}
+ 718:	5b                   	pop    %ebx
+ 719:	5e                   	pop    %esi
+ 71a:	5f                   	pop    %edi
+ 71b:	5d                   	pop    %ebp
+ 71c:	c3                   	ret
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000720 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	57                   	push   %edi
+ 724:	56                   	push   %esi
+ 725:	53                   	push   %ebx
+ 726:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 729:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 72c:	8b 15 74 0b 00 00    	mov    0xb74,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 732:	8d 78 07             	lea    0x7(%eax),%edi
+ 735:	c1 ef 03             	shr    $0x3,%edi
+ 738:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 73b:	85 d2                	test   %edx,%edx
+ 73d:	0f 84 8d 00 00 00    	je     7d0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 743:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 745:	8b 48 04             	mov    0x4(%eax),%ecx
+ 748:	39 f9                	cmp    %edi,%ecx
+ 74a:	73 64                	jae    7b0 <malloc+0x90>
+  if(nu < 4096)
+ 74c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 751:	39 df                	cmp    %ebx,%edi
+ 753:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 756:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 75d:	eb 0a                	jmp    769 <malloc+0x49>
+ 75f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 760:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 762:	8b 48 04             	mov    0x4(%eax),%ecx
+ 765:	39 f9                	cmp    %edi,%ecx
+ 767:	73 47                	jae    7b0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 769:	89 c2                	mov    %eax,%edx
+ 76b:	39 05 74 0b 00 00    	cmp    %eax,0xb74
+ 771:	75 ed                	jne    760 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 773:	83 ec 0c             	sub    $0xc,%esp
+ 776:	56                   	push   %esi
+ 777:	e8 3c fc ff ff       	call   3b8 <sbrk>
+  if(p == (char*)-1)
+ 77c:	83 c4 10             	add    $0x10,%esp
+ 77f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 782:	74 1c                	je     7a0 <malloc+0x80>
+  hp->s.size = nu;
+ 784:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 787:	83 ec 0c             	sub    $0xc,%esp
+ 78a:	83 c0 08             	add    $0x8,%eax
+ 78d:	50                   	push   %eax
+ 78e:	e8 fd fe ff ff       	call   690 <free>
+  return freep;
+ 793:	8b 15 74 0b 00 00    	mov    0xb74,%edx
+      if((p = morecore(nunits)) == 0)
+ 799:	83 c4 10             	add    $0x10,%esp
+ 79c:	85 d2                	test   %edx,%edx
+ 79e:	75 c0                	jne    760 <malloc+0x40>
+        return 0;
+  }
+}
+ 7a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7a3:	31 c0                	xor    %eax,%eax
+}
+ 7a5:	5b                   	pop    %ebx
+ 7a6:	5e                   	pop    %esi
+ 7a7:	5f                   	pop    %edi
+ 7a8:	5d                   	pop    %ebp
+ 7a9:	c3                   	ret
+ 7aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 7b0:	39 cf                	cmp    %ecx,%edi
+ 7b2:	74 4c                	je     800 <malloc+0xe0>
+        p->s.size -= nunits;
+ 7b4:	29 f9                	sub    %edi,%ecx
+ 7b6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 7b9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 7bc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 7bf:	89 15 74 0b 00 00    	mov    %edx,0xb74
+}
+ 7c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 7c8:	83 c0 08             	add    $0x8,%eax
+}
+ 7cb:	5b                   	pop    %ebx
+ 7cc:	5e                   	pop    %esi
+ 7cd:	5f                   	pop    %edi
+ 7ce:	5d                   	pop    %ebp
+ 7cf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 7d0:	c7 05 74 0b 00 00 78 	movl   $0xb78,0xb74
+ 7d7:	0b 00 00 
+    base.s.size = 0;
+ 7da:	b8 78 0b 00 00       	mov    $0xb78,%eax
+    base.s.ptr = freep = prevp = &base;
+ 7df:	c7 05 78 0b 00 00 78 	movl   $0xb78,0xb78
+ 7e6:	0b 00 00 
+    base.s.size = 0;
+ 7e9:	c7 05 7c 0b 00 00 00 	movl   $0x0,0xb7c
+ 7f0:	00 00 00 
+    if(p->s.size >= nunits){
+ 7f3:	e9 54 ff ff ff       	jmp    74c <malloc+0x2c>
+ 7f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 800:	8b 08                	mov    (%eax),%ecx
+ 802:	89 0a                	mov    %ecx,(%edx)
+ 804:	eb b9                	jmp    7bf <malloc+0x9f>
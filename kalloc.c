@@ -1,6 +1,32 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
-// and pipe buffers. Allocates 4096-byte pages.
+// and pipe buffers. Allocates 4096-byte pages, and physically
+// contiguous blocks of 2^order pages with kalloc_pages().
+//
+// kmem keeps free memory in a buddy system: a free block of order k
+// is 2^k pages starting at a multiple of 2^k pages, on free list
+// area[k], and is merged with its buddy (the other half of the block
+// of order k+1) as soon as both are free.
+//
+// Single pages are also cached per CPU.  kalloc() and kfree()
+// normally touch only their own CPU's cache, with interrupts off
+// instead of a lock, and move PCP_BATCH pages at a time between it
+// and kmem when it runs dry or overflows.  At most NCPU*PCP_MAX pages
+// of each kind can sit in caches where another CPU's kalloc() does
+// not see them, and they do not merge until they are drained.
+// kalloc_pages() drains its own CPU's caches and the zeroed pool when
+// it finds no block; what the other CPUs cache stays unmerged, so a
+// large block can be unavailable while that much memory is free.
+//
+// There are two kinds of free page: dirty ones, as kfree() left
+// them, and zeroed ones, which CPUs with nothing to run clear ahead
+// of time (kzero_idle()) so that kalloc_zeroed() rarely has to.
+// Zeroed pages wait in kmem.zeroed, outside the buddy system.
+//
+// A page can have more than one owner, shared copy-on-write between
+// page tables after fork().  pageshare counts the owners beyond the
+// first; kfree() from a sharer just drops its share, and only the
+// last owner's kfree() frees the page.
 
 #include "types.h"
 #include "defs.h"
@@ -15,14 +41,167 @@ extern char end[]; // first address after kernel loaded from ELF file
 
 struct run {
   struct run *next;
+  struct run *prev;        // buddy free lists only
 };
 
+struct pagelist {
+  struct run *head;
+  int n;
+};
+
+enum { DIRTY, ZEROED, NKIND };
+
 struct {
   struct spinlock lock;
   int use_lock;
-  struct run *freelist;
+  struct run *area[KMAXORDER+1];  // free blocks of each order
+  struct pagelist zeroed;         // zeroed single pages
 } kmem;
 
+#define NPAGE (PHYSTOP / PGSIZE)
+
+// 1 + order at the first page of each block on an area list, else 0.
+static uchar freeorder[NPAGE];
+
+// Owners of each allocated page beyond the first, changed atomically.
+static uint pageshare[NPAGE];
+
+#define PCP_MAX   64    // most free pages of a kind a CPU keeps
+#define PCP_BATCH 16    // pages moved to or from kmem at once
+#define ZPOOL_MAX 256   // idle CPUs stop zeroing at this many in kmem
+
+// Per-CPU page caches, only touched by their CPU with interrupts off.
+static struct pcp {
+  struct pagelist free[NKIND];
+} pcp[NCPU];
+
+static void
+pl_push(struct pagelist *l, struct run *r)
+{
+  r->next = l->head;
+  l->head = r;
+  l->n++;
+}
+
+static struct run*
+pl_pop(struct pagelist *l)
+{
+  struct run *r;
+
+  if((r = l->head) != 0){
+    l->head = r->next;
+    l->n--;
+  }
+  return r;
+}
+
+static uint
+pfn(struct run *r)
+{
+  return V2P(r) / PGSIZE;
+}
+
+static struct run*
+pfnpage(uint n)
+{
+  return (struct run*)P2V(n * PGSIZE);
+}
+
+static void
+area_add(int k, struct run *r)
+{
+  r->prev = 0;
+  r->next = kmem.area[k];
+  if(r->next)
+    r->next->prev = r;
+  kmem.area[k] = r;
+  freeorder[pfn(r)] = k + 1;
+}
+
+static void
+area_del(int k, struct run *r)
+{
+  if(r->prev)
+    r->prev->next = r->next;
+  else
+    kmem.area[k] = r->next;
+  if(r->next)
+    r->next->prev = r->prev;
+  freeorder[pfn(r)] = 0;
+}
+
+// Take a block of 2^order pages, splitting a larger one if needed.
+// Caller holds kmem.lock.
+static struct run*
+buddy_alloc(int order)
+{
+  struct run *r;
+  int k;
+
+  for(k = order; k <= KMAXORDER && kmem.area[k] == 0; k++)
+    ;
+  if(k > KMAXORDER)
+    return 0;
+  r = kmem.area[k];
+  area_del(k, r);
+  while(k > order){
+    k--;
+    area_add(k, pfnpage(pfn(r) + (1 << k)));   // free the upper half
+  }
+  return r;
+}
+
+// Give back a block of 2^order pages, merging it with free buddies.
+// Caller holds kmem.lock.
+static void
+buddy_free(struct run *r, int order)
+{
+  uint n = pfn(r), b;
+
+  for(; order < KMAXORDER; order++){
+    b = n ^ (1 << order);
+    if(b >= NPAGE || freeorder[b] != order + 1)
+      break;
+    area_del(order, pfnpage(b));
+    n &= ~(1 << order);
+  }
+  area_add(order, pfnpage(n));
+}
+
+// Free-page store of kind z behind the per-CPU caches: the buddy
+// system for dirty pages, the zeroed pool for zeroed ones.  Caller
+// holds kmem.lock.
+static struct run*
+kmem_get(int z)
+{
+  return z == DIRTY ? buddy_alloc(0) : pl_pop(&kmem.zeroed);
+}
+
+static void
+kmem_put(int z, struct run *r)
+{
+  if(z == DIRTY)
+    buddy_free(r, 0);
+  else
+    pl_push(&kmem.zeroed, r);
+}
+
+// Give this CPU's cached pages and the zeroed pool back to the buddy
+// system so that they can merge.  Caller holds kmem.lock.
+static void
+kmem_drain(void)
+{
+  struct pcp *c = &pcp[cpuid()];
+  struct run *r;
+  int z;
+
+  for(z = 0; z < NKIND; z++)
+    while((r = pl_pop(&c->free[z])) != 0)
+      buddy_free(r, 0);
+  while((r = pl_pop(&kmem.zeroed)) != 0)
+    buddy_free(r, 0);
+}
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
@@ -52,6 +231,81 @@ freerange(void *vstart, void *vend)
     kfree(p);
 }
 //PAGEBREAK: 21
+// Take a free page of kind z, or 0.
+static struct run*
+getpage(int z)
+{
+  struct pagelist *c;
+  struct run *r;
+  int i;
+
+  if(!kmem.use_lock)   // still booting on one CPU
+    return kmem_get(z);
+
+  pushcli();
+  c = &pcp[cpuid()].free[z];
+  if(c->n == 0){
+    acquire(&kmem.lock);
+    for(i = 0; i < PCP_BATCH && (r = kmem_get(z)) != 0; i++)
+      pl_push(c, r);
+    release(&kmem.lock);
+  }
+  r = pl_pop(c);
+  popcli();
+  return r;
+}
+
+static void
+putpage(int z, struct run *r)
+{
+  struct pagelist *c;
+  int i;
+
+  if(!kmem.use_lock){
+    kmem_put(z, r);
+    return;
+  }
+
+  pushcli();
+  c = &pcp[cpuid()].free[z];
+  pl_push(c, r);
+  if(c->n > PCP_MAX){
+    acquire(&kmem.lock);
+    for(i = 0; i < PCP_BATCH; i++)
+      kmem_put(z, pl_pop(c));
+    release(&kmem.lock);
+  }
+  popcli();
+}
+
+// Give the page at v one more owner; each owner kfree()s it.
+void
+kshare(char *v)
+{
+  __sync_add_and_fetch(&pageshare[pfn((struct run*)v)], 1);
+}
+
+// Does the page at v have more than one owner?
+int
+kshared(char *v)
+{
+  return pageshare[pfn((struct run*)v)] != 0;
+}
+
+// Drop one owner's share of the page at v if it has others.
+// Returns 0 if the caller was the only owner.
+static int
+kunshare(char *v)
+{
+  uint *n = &pageshare[pfn((struct run*)v)];
+  uint old;
+
+  while((old = *n) > 0)
+    if(__sync_bool_compare_and_swap(n, old, old - 1))
+      return 1;
+  return 0;
+}
+
 // Free the page of physical memory pointed at by v,
 // which normally should have been returned by a
 // call to kalloc().  (The exception is when
@@ -59,21 +313,18 @@ freerange(void *vstart, void *vend)
 void
 kfree(char *v)
 {
-  struct run *r;
-
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
 
+  if(kunshare(v))
+    return;
+
+#ifdef KALLOC_JUNK
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
+#endif
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+  putpage(DIRTY, (struct run*)v);
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -84,13 +335,85 @@ kalloc(void)
 {
   struct run *r;
 
+  if((r = getpage(DIRTY)) == 0)
+    r = getpage(ZEROED);
+  return (char*)r;
+}
+
+// Like kalloc(), but the page is all zeroes.
+char*
+kalloc_zeroed(void)
+{
+  struct run *r;
+
+  if((r = getpage(ZEROED)) != 0){
+    r->next = 0;   // the only word the free list wrote
+    return (char*)r;
+  }
+  if((r = getpage(DIRTY)) != 0)
+    memset(r, 0, PGSIZE);
+  return (char*)r;
+}
+
+// Called by a CPU with nothing to run: zero one dirty page for
+// kalloc_zeroed().  Returns 1 if it did, 0 if there was nothing to do.
+int
+kzero_idle(void)
+{
+  struct run *r;
+
+  if(!kmem.use_lock || kmem.zeroed.n >= ZPOOL_MAX)
+    return 0;
+  if((r = getpage(DIRTY)) == 0)
+    return 0;
+  memset(r, 0, PGSIZE);
+  acquire(&kmem.lock);
+  kmem_put(ZEROED, r);
+  release(&kmem.lock);
+  return 1;
+}
+
+// Allocate 2^order physically contiguous pages, aligned to their
+// size.  Returns 0 if there is no free block that large.
+char*
+kalloc_pages(int order)
+{
+  struct run *r;
+
+  if(order < 0 || order > KMAXORDER)
+    return 0;
+  if(order == 0)
+    return kalloc();
   if(kmem.use_lock)
     acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
+  if((r = buddy_alloc(order)) == 0 && kmem.use_lock){
+    kmem_drain();
+    r = buddy_alloc(order);
+  }
   if(kmem.use_lock)
     release(&kmem.lock);
   return (char*)r;
 }
 
+// Free a block from kalloc_pages(order).
+void
+kfree_pages(char *v, int order)
+{
+  if(order == 0){
+    kfree(v);
+    return;
+  }
+  if(order < 0 || order > KMAXORDER || pfn((struct run*)v) & ((1 << order) - 1) ||
+     v < end || V2P(v) + (PGSIZE << order) > PHYSTOP)
+    panic("kfree_pages");
+
+#ifdef KALLOC_JUNK
+  memset(v, 1, PGSIZE << order);
+#endif
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  buddy_free((struct run*)v, order);
+  if(kmem.use_lock)
+    release(&kmem.lock);
+}
@@ -0,0 +1,1302 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 01 00 00 00       	mov    $0x1,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 27                	jle    4a <main+0x4a>
+  23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  27:	90                   	nop
+    printf(2, "usage: kill pid...\n");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    kill(atoi(argv[i]));
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+  2e:	83 c3 01             	add    $0x1,%ebx
+    kill(atoi(argv[i]));
+  31:	e8 fa 01 00 00       	call   230 <atoi>
+  36:	89 04 24             	mov    %eax,(%esp)
+  39:	e8 12 03 00 00       	call   350 <kill>
+  for(i=1; i<argc; i++)
+  3e:	83 c4 10             	add    $0x10,%esp
+  41:	39 de                	cmp    %ebx,%esi
+  43:	75 e3                	jne    28 <main+0x28>
+  exit();
+  45:	e8 d6 02 00 00       	call   320 <exit>
+    printf(2, "usage: kill pid...\n");
+  4a:	50                   	push   %eax
+  4b:	50                   	push   %eax
+  4c:	68 f8 07 00 00       	push   $0x7f8
+  51:	6a 02                	push   $0x2
+  53:	e8 78 04 00 00       	call   4d0 <printf>
+    exit();
+  58:	e8 c3 02 00 00       	call   320 <exit>
+  5d:	66 90                	xchg   %ax,%ax
+  5f:	90                   	nop
+
+00000060 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  60:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  61:	31 c0                	xor    %eax,%eax
+{
+  63:	89 e5                	mov    %esp,%ebp
+  65:	53                   	push   %ebx
+  66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  70:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  74:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  77:	83 c0 01             	add    $0x1,%eax
+  7a:	84 d2                	test   %dl,%dl
+  7c:	75 f2                	jne    70 <strcpy+0x10>
+    ;
+  return os;
+}
+  7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  81:	89 c8                	mov    %ecx,%eax
+  83:	c9                   	leave
+  84:	c3                   	ret
+  85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000090 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	53                   	push   %ebx
+  94:	8b 55 08             	mov    0x8(%ebp),%edx
+  97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  9a:	0f b6 02             	movzbl (%edx),%eax
+  9d:	84 c0                	test   %al,%al
+  9f:	75 17                	jne    b8 <strcmp+0x28>
+  a1:	eb 3a                	jmp    dd <strcmp+0x4d>
+  a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  a7:	90                   	nop
+  a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  ac:	83 c2 01             	add    $0x1,%edx
+  af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  b2:	84 c0                	test   %al,%al
+  b4:	74 1a                	je     d0 <strcmp+0x40>
+    p++, q++;
+  b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  b8:	0f b6 19             	movzbl (%ecx),%ebx
+  bb:	38 c3                	cmp    %al,%bl
+  bd:	74 e9                	je     a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  bf:	29 d8                	sub    %ebx,%eax
+}
+  c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c4:	c9                   	leave
+  c5:	c3                   	ret
+  c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  d4:	31 c0                	xor    %eax,%eax
+  d6:	29 d8                	sub    %ebx,%eax
+}
+  d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  db:	c9                   	leave
+  dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  dd:	0f b6 19             	movzbl (%ecx),%ebx
+  e0:	31 c0                	xor    %eax,%eax
+  e2:	eb db                	jmp    bf <strcmp+0x2f>
+  e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+
+000000f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  f6:	80 3a 00             	cmpb   $0x0,(%edx)
+  f9:	74 15                	je     110 <strlen+0x20>
+  fb:	31 c0                	xor    %eax,%eax
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 100:	83 c0 01             	add    $0x1,%eax
+ 103:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 107:	89 c1                	mov    %eax,%ecx
+ 109:	75 f5                	jne    100 <strlen+0x10>
+    ;
+  return n;
+}
+ 10b:	89 c8                	mov    %ecx,%eax
+ 10d:	5d                   	pop    %ebp
+ 10e:	c3                   	ret
+ 10f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 110:	31 c9                	xor    %ecx,%ecx
+}
+ 112:	5d                   	pop    %ebp
+ 113:	89 c8                	mov    %ecx,%eax
+ 115:	c3                   	ret
+ 116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000120 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 127:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 12a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12d:	89 d7                	mov    %edx,%edi
+ 12f:	fc                   	cld
+ 130:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 132:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 135:	89 d0                	mov    %edx,%eax
+ 137:	c9                   	leave
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+ 146:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 14a:	0f b6 10             	movzbl (%eax),%edx
+ 14d:	84 d2                	test   %dl,%dl
+ 14f:	75 12                	jne    163 <strchr+0x23>
+ 151:	eb 1d                	jmp    170 <strchr+0x30>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 15c:	83 c0 01             	add    $0x1,%eax
+ 15f:	84 d2                	test   %dl,%dl
+ 161:	74 0d                	je     170 <strchr+0x30>
+    if(*s == c)
+ 163:	38 d1                	cmp    %dl,%cl
+ 165:	75 f1                	jne    158 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 167:	5d                   	pop    %ebp
+ 168:	c3                   	ret
+ 169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 170:	31 c0                	xor    %eax,%eax
+}
+ 172:	5d                   	pop    %ebp
+ 173:	c3                   	ret
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 185:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 188:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 189:	31 db                	xor    %ebx,%ebx
+{
+ 18b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 18e:	eb 27                	jmp    1b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 190:	83 ec 04             	sub    $0x4,%esp
+ 193:	6a 01                	push   $0x1
+ 195:	56                   	push   %esi
+ 196:	6a 00                	push   $0x0
+ 198:	e8 9b 01 00 00       	call   338 <read>
+    if(cc < 1)
+ 19d:	83 c4 10             	add    $0x10,%esp
+ 1a0:	85 c0                	test   %eax,%eax
+ 1a2:	7e 1d                	jle    1c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1af:	3c 0a                	cmp    $0xa,%al
+ 1b1:	74 10                	je     1c3 <gets+0x43>
+ 1b3:	3c 0d                	cmp    $0xd,%al
+ 1b5:	74 0c                	je     1c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1b7:	89 df                	mov    %ebx,%edi
+ 1b9:	83 c3 01             	add    $0x1,%ebx
+ 1bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1bf:	7c cf                	jl     190 <gets+0x10>
+ 1c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1cd:	5b                   	pop    %ebx
+ 1ce:	5e                   	pop    %esi
+ 1cf:	5f                   	pop    %edi
+ 1d0:	5d                   	pop    %ebp
+ 1d1:	c3                   	ret
+ 1d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	56                   	push   %esi
+ 1e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	6a 00                	push   $0x0
+ 1ea:	ff 75 08             	push   0x8(%ebp)
+ 1ed:	e8 6e 01 00 00       	call   360 <open>
+  if(fd < 0)
+ 1f2:	83 c4 10             	add    $0x10,%esp
+ 1f5:	85 c0                	test   %eax,%eax
+ 1f7:	78 27                	js     220 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1f9:	83 ec 08             	sub    $0x8,%esp
+ 1fc:	ff 75 0c             	push   0xc(%ebp)
+ 1ff:	89 c3                	mov    %eax,%ebx
+ 201:	50                   	push   %eax
+ 202:	e8 71 01 00 00       	call   378 <fstat>
+  close(fd);
+ 207:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 20a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 20c:	e8 37 01 00 00       	call   348 <close>
+  return r;
+ 211:	83 c4 10             	add    $0x10,%esp
+}
+ 214:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 217:	89 f0                	mov    %esi,%eax
+ 219:	5b                   	pop    %ebx
+ 21a:	5e                   	pop    %esi
+ 21b:	5d                   	pop    %ebp
+ 21c:	c3                   	ret
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 220:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 225:	eb ed                	jmp    214 <stat+0x34>
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+
+00000230 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	53                   	push   %ebx
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 237:	0f be 02             	movsbl (%edx),%eax
+ 23a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 23d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 240:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 245:	77 1e                	ja     265 <atoi+0x35>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 250:	83 c2 01             	add    $0x1,%edx
+ 253:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 256:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 25a:	0f be 02             	movsbl (%edx),%eax
+ 25d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 260:	80 fb 09             	cmp    $0x9,%bl
+ 263:	76 eb                	jbe    250 <atoi+0x20>
+  return n;
+}
+ 265:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 268:	89 c8                	mov    %ecx,%eax
+ 26a:	c9                   	leave
+ 26b:	c3                   	ret
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+ 275:	8b 45 10             	mov    0x10(%ebp),%eax
+ 278:	8b 55 08             	mov    0x8(%ebp),%edx
+ 27b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 27e:	85 c0                	test   %eax,%eax
+ 280:	7e 13                	jle    295 <memmove+0x25>
+ 282:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 284:	89 d7                	mov    %edx,%edi
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 290:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 291:	39 f8                	cmp    %edi,%eax
+ 293:	75 fb                	jne    290 <memmove+0x20>
+  return vdst;
+}
+ 295:	5e                   	pop    %esi
+ 296:	89 d0                	mov    %edx,%eax
+ 298:	5f                   	pop    %edi
+ 299:	5d                   	pop    %ebp
+ 29a:	c3                   	ret
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <mutex_lock>:
+
+// Take and release m with atomic instructions, and enter the kernel
+// only to block while it is held or to wake a blocked thread.
+void
+mutex_lock(struct mutex *m)
+{
+ 2a0:	55                   	push   %ebp
+  uint s;
+
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 2a1:	31 c0                	xor    %eax,%eax
+ 2a3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 2a8:	89 e5                	mov    %esp,%ebp
+ 2aa:	56                   	push   %esi
+ 2ab:	53                   	push   %ebx
+ 2ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 2af:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 2b3:	85 c0                	test   %eax,%eax
+ 2b5:	74 30                	je     2e7 <mutex_lock+0x47>
+    return;
+  // Contended: mark it so the holder knows to wake us.
+  if(s != 2)
+ 2b7:	83 f8 02             	cmp    $0x2,%eax
+ 2ba:	74 0c                	je     2c8 <mutex_lock+0x28>
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 2bc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2c1:	f0 87 03             	lock xchg %eax,(%ebx)
+    s = xchg(&m->state, 2);
+  while(s != 0){
+ 2c4:	85 c0                	test   %eax,%eax
+ 2c6:	74 1f                	je     2e7 <mutex_lock+0x47>
+ 2c8:	be 02 00 00 00       	mov    $0x2,%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+ 2d0:	83 ec 08             	sub    $0x8,%esp
+ 2d3:	6a 02                	push   $0x2
+ 2d5:	53                   	push   %ebx
+ 2d6:	e8 45 01 00 00       	call   420 <futex_wait>
+ 2db:	89 f0                	mov    %esi,%eax
+ 2dd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(s != 0){
+ 2e0:	83 c4 10             	add    $0x10,%esp
+ 2e3:	85 c0                	test   %eax,%eax
+ 2e5:	75 e9                	jne    2d0 <mutex_lock+0x30>
+    s = xchg(&m->state, 2);
+  }
+}
+ 2e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2ea:	5b                   	pop    %ebx
+ 2eb:	5e                   	pop    %esi
+ 2ec:	5d                   	pop    %ebp
+ 2ed:	c3                   	ret
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	31 c0                	xor    %eax,%eax
+ 2f3:	89 e5                	mov    %esp,%ebp
+ 2f5:	83 ec 08             	sub    $0x8,%esp
+ 2f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2fb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 2fe:	83 f8 02             	cmp    $0x2,%eax
+ 301:	74 05                	je     308 <mutex_unlock+0x18>
+    futex_wake(&m->state, 1);
+}
+ 303:	c9                   	leave
+ 304:	c3                   	ret
+ 305:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->state, 1);
+ 308:	83 ec 08             	sub    $0x8,%esp
+ 30b:	6a 01                	push   $0x1
+ 30d:	52                   	push   %edx
+ 30e:	e8 15 01 00 00       	call   428 <futex_wake>
+ 313:	83 c4 10             	add    $0x10,%esp
+}
+ 316:	c9                   	leave
+ 317:	c3                   	ret
+
+00000318 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 318:	b8 01 00 00 00       	mov    $0x1,%eax
+ 31d:	cd 40                	int    $0x40
+ 31f:	c3                   	ret
+
+00000320 <exit>:
+SYSCALL(exit)
+ 320:	b8 02 00 00 00       	mov    $0x2,%eax
+ 325:	cd 40                	int    $0x40
+ 327:	c3                   	ret
+
+00000328 <wait>:
+SYSCALL(wait)
+ 328:	b8 03 00 00 00       	mov    $0x3,%eax
+ 32d:	cd 40                	int    $0x40
+ 32f:	c3                   	ret
+
+00000330 <pipe>:
+SYSCALL(pipe)
+ 330:	b8 04 00 00 00       	mov    $0x4,%eax
+ 335:	cd 40                	int    $0x40
+ 337:	c3                   	ret
+
+00000338 <read>:
+SYSCALL(read)
+ 338:	b8 05 00 00 00       	mov    $0x5,%eax
+ 33d:	cd 40                	int    $0x40
+ 33f:	c3                   	ret
+
+00000340 <write>:
+SYSCALL(write)
+ 340:	b8 10 00 00 00       	mov    $0x10,%eax
+ 345:	cd 40                	int    $0x40
+ 347:	c3                   	ret
+
+00000348 <close>:
+SYSCALL(close)
+ 348:	b8 15 00 00 00       	mov    $0x15,%eax
+ 34d:	cd 40                	int    $0x40
+ 34f:	c3                   	ret
+
+00000350 <kill>:
+SYSCALL(kill)
+ 350:	b8 06 00 00 00       	mov    $0x6,%eax
+ 355:	cd 40                	int    $0x40
+ 357:	c3                   	ret
+
+00000358 <exec>:
+SYSCALL(exec)
+ 358:	b8 07 00 00 00       	mov    $0x7,%eax
+ 35d:	cd 40                	int    $0x40
+ 35f:	c3                   	ret
+
+00000360 <open>:
+SYSCALL(open)
+ 360:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 365:	cd 40                	int    $0x40
+ 367:	c3                   	ret
+
+00000368 <mknod>:
+SYSCALL(mknod)
+ 368:	b8 11 00 00 00       	mov    $0x11,%eax
+ 36d:	cd 40                	int    $0x40
+ 36f:	c3                   	ret
+
+00000370 <unlink>:
+SYSCALL(unlink)
+ 370:	b8 12 00 00 00       	mov    $0x12,%eax
+ 375:	cd 40                	int    $0x40
+ 377:	c3                   	ret
+
+00000378 <fstat>:
+SYSCALL(fstat)
+ 378:	b8 08 00 00 00       	mov    $0x8,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <link>:
+SYSCALL(link)
+ 380:	b8 13 00 00 00       	mov    $0x13,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <mkdir>:
+SYSCALL(mkdir)
+ 388:	b8 14 00 00 00       	mov    $0x14,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <chdir>:
+SYSCALL(chdir)
+ 390:	b8 09 00 00 00       	mov    $0x9,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <dup>:
+SYSCALL(dup)
+ 398:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <getpid>:
+SYSCALL(getpid)
+ 3a0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <sbrk>:
+SYSCALL(sbrk)
+ 3a8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <sleep>:
+SYSCALL(sleep)
+ 3b0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <uptime>:
+SYSCALL(uptime)
+ 3b8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <ps>:
+SYSCALL(ps)
+ 3c0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <getschedparams>:
+SYSCALL(getschedparams)
+ 3c8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <setschedparams>:
+SYSCALL(setschedparams)
+ 3d0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <getpinfo>:
+SYSCALL(getpinfo)
+ 3d8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <getlathist>:
+SYSCALL(getlathist)
+ 3e0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <setpolicy>:
+SYSCALL(setpolicy)
+ 3e8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <settickets>:
+SYSCALL(settickets)
+ 3f0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <setaffinity>:
+SYSCALL(setaffinity)
+ 3f8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <getaffinity>:
+SYSCALL(getaffinity)
+ 400:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <setrt>:
+SYSCALL(setrt)
+ 408:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <clone>:
+SYSCALL(clone)
+ 410:	b8 20 00 00 00       	mov    $0x20,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <join>:
+SYSCALL(join)
+ 418:	b8 21 00 00 00       	mov    $0x21,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <futex_wait>:
+SYSCALL(futex_wait)
+ 420:	b8 22 00 00 00       	mov    $0x22,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <futex_wake>:
+SYSCALL(futex_wake)
+ 428:	b8 23 00 00 00       	mov    $0x23,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+ 435:	53                   	push   %ebx
+ 436:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 438:	89 d1                	mov    %edx,%ecx
+{
+ 43a:	83 ec 3c             	sub    $0x3c,%esp
+ 43d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 440:	85 d2                	test   %edx,%edx
+ 442:	0f 89 80 00 00 00    	jns    4c8 <printint+0x98>
+ 448:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 44c:	74 7a                	je     4c8 <printint+0x98>
+    x = -xx;
+ 44e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 450:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 455:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 458:	31 f6                	xor    %esi,%esi
+ 45a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 460:	89 c8                	mov    %ecx,%eax
+ 462:	31 d2                	xor    %edx,%edx
+ 464:	89 f7                	mov    %esi,%edi
+ 466:	f7 f3                	div    %ebx
+ 468:	8d 76 01             	lea    0x1(%esi),%esi
+ 46b:	0f b6 92 6c 08 00 00 	movzbl 0x86c(%edx),%edx
+ 472:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 476:	89 ca                	mov    %ecx,%edx
+ 478:	89 c1                	mov    %eax,%ecx
+ 47a:	39 da                	cmp    %ebx,%edx
+ 47c:	73 e2                	jae    460 <printint+0x30>
+  if(neg)
+ 47e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 481:	85 c0                	test   %eax,%eax
+ 483:	74 07                	je     48c <printint+0x5c>
+    buf[i++] = '-';
+ 485:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 48a:	89 f7                	mov    %esi,%edi
+ 48c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 48f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 492:	01 df                	add    %ebx,%edi
+ 494:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 498:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 49b:	83 ec 04             	sub    $0x4,%esp
+ 49e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 4a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 4a4:	6a 01                	push   $0x1
+ 4a6:	50                   	push   %eax
+ 4a7:	56                   	push   %esi
+ 4a8:	e8 93 fe ff ff       	call   340 <write>
+  while(--i >= 0)
+ 4ad:	89 f8                	mov    %edi,%eax
+ 4af:	83 c4 10             	add    $0x10,%esp
+ 4b2:	83 ef 01             	sub    $0x1,%edi
+ 4b5:	39 d8                	cmp    %ebx,%eax
+ 4b7:	75 df                	jne    498 <printint+0x68>
+}
+ 4b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4bc:	5b                   	pop    %ebx
+ 4bd:	5e                   	pop    %esi
+ 4be:	5f                   	pop    %edi
+ 4bf:	5d                   	pop    %ebp
+ 4c0:	c3                   	ret
+ 4c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 4c8:	31 c0                	xor    %eax,%eax
+ 4ca:	eb 89                	jmp    455 <printint+0x25>
+ 4cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	57                   	push   %edi
+ 4d4:	56                   	push   %esi
+ 4d5:	53                   	push   %ebx
+ 4d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4df:	0f b6 1e             	movzbl (%esi),%ebx
+ 4e2:	83 c6 01             	add    $0x1,%esi
+ 4e5:	84 db                	test   %bl,%bl
+ 4e7:	74 67                	je     550 <printf+0x80>
+ 4e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4ec:	31 d2                	xor    %edx,%edx
+ 4ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 4f1:	eb 34                	jmp    527 <printf+0x57>
+ 4f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4f7:	90                   	nop
+ 4f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 4fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 500:	83 f8 25             	cmp    $0x25,%eax
+ 503:	74 18                	je     51d <printf+0x4d>
+  write(fd, &c, 1);
+ 505:	83 ec 04             	sub    $0x4,%esp
+ 508:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 50b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 50e:	6a 01                	push   $0x1
+ 510:	50                   	push   %eax
+ 511:	57                   	push   %edi
+ 512:	e8 29 fe ff ff       	call   340 <write>
+ 517:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 51a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 51d:	0f b6 1e             	movzbl (%esi),%ebx
+ 520:	83 c6 01             	add    $0x1,%esi
+ 523:	84 db                	test   %bl,%bl
+ 525:	74 29                	je     550 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 527:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 52a:	85 d2                	test   %edx,%edx
+ 52c:	74 ca                	je     4f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 52e:	83 fa 25             	cmp    $0x25,%edx
+ 531:	75 ea                	jne    51d <printf+0x4d>
+      if(c == 'd'){
+ 533:	83 f8 25             	cmp    $0x25,%eax
+ 536:	0f 84 24 01 00 00    	je     660 <printf+0x190>
+ 53c:	83 e8 63             	sub    $0x63,%eax
+ 53f:	83 f8 15             	cmp    $0x15,%eax
+ 542:	77 1c                	ja     560 <printf+0x90>
+ 544:	ff 24 85 14 08 00 00 	jmp    *0x814(,%eax,4)
+ 54b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 54f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 550:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 553:	5b                   	pop    %ebx
+ 554:	5e                   	pop    %esi
+ 555:	5f                   	pop    %edi
+ 556:	5d                   	pop    %ebp
+ 557:	c3                   	ret
+ 558:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+  write(fd, &c, 1);
+ 560:	83 ec 04             	sub    $0x4,%esp
+ 563:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 566:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 56a:	6a 01                	push   $0x1
+ 56c:	52                   	push   %edx
+ 56d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 570:	57                   	push   %edi
+ 571:	e8 ca fd ff ff       	call   340 <write>
+ 576:	83 c4 0c             	add    $0xc,%esp
+ 579:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 57c:	6a 01                	push   $0x1
+ 57e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 581:	52                   	push   %edx
+ 582:	57                   	push   %edi
+ 583:	e8 b8 fd ff ff       	call   340 <write>
+        putc(fd, c);
+ 588:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 58b:	31 d2                	xor    %edx,%edx
+ 58d:	eb 8e                	jmp    51d <printf+0x4d>
+ 58f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 590:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 593:	83 ec 0c             	sub    $0xc,%esp
+ 596:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 59b:	8b 13                	mov    (%ebx),%edx
+ 59d:	6a 00                	push   $0x0
+ 59f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 5a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 5a4:	e8 87 fe ff ff       	call   430 <printint>
+        ap++;
+ 5a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5af:	31 d2                	xor    %edx,%edx
+ 5b1:	e9 67 ff ff ff       	jmp    51d <printf+0x4d>
+ 5b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 5c5:	83 c0 04             	add    $0x4,%eax
+ 5c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 5cb:	85 db                	test   %ebx,%ebx
+ 5cd:	0f 84 9d 00 00 00    	je     670 <printf+0x1a0>
+        while(*s != 0){
+ 5d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5d8:	84 c0                	test   %al,%al
+ 5da:	0f 84 3d ff ff ff    	je     51d <printf+0x4d>
+ 5e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5e6:	89 de                	mov    %ebx,%esi
+ 5e8:	89 d3                	mov    %edx,%ebx
+ 5ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 5f0:	83 ec 04             	sub    $0x4,%esp
+ 5f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 5f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 5f9:	6a 01                	push   $0x1
+ 5fb:	53                   	push   %ebx
+ 5fc:	57                   	push   %edi
+ 5fd:	e8 3e fd ff ff       	call   340 <write>
+        while(*s != 0){
+ 602:	0f b6 06             	movzbl (%esi),%eax
+ 605:	83 c4 10             	add    $0x10,%esp
+ 608:	84 c0                	test   %al,%al
+ 60a:	75 e4                	jne    5f0 <printf+0x120>
+      state = 0;
+ 60c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 60f:	31 d2                	xor    %edx,%edx
+ 611:	e9 07 ff ff ff       	jmp    51d <printf+0x4d>
+ 616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 620:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 623:	83 ec 0c             	sub    $0xc,%esp
+ 626:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 62b:	8b 13                	mov    (%ebx),%edx
+ 62d:	6a 01                	push   $0x1
+ 62f:	e9 6b ff ff ff       	jmp    59f <printf+0xcf>
+ 634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 638:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 63b:	83 ec 04             	sub    $0x4,%esp
+ 63e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 641:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 643:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 646:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 649:	6a 01                	push   $0x1
+ 64b:	52                   	push   %edx
+ 64c:	57                   	push   %edi
+ 64d:	e8 ee fc ff ff       	call   340 <write>
+        ap++;
+ 652:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 655:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 658:	31 d2                	xor    %edx,%edx
+ 65a:	e9 be fe ff ff       	jmp    51d <printf+0x4d>
+ 65f:	90                   	nop
+  write(fd, &c, 1);
+ 660:	83 ec 04             	sub    $0x4,%esp
+ 663:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 666:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 669:	6a 01                	push   $0x1
+ 66b:	e9 11 ff ff ff       	jmp    581 <printf+0xb1>
+ 670:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 675:	bb 0c 08 00 00       	mov    $0x80c,%ebx
+ 67a:	e9 61 ff ff ff       	jmp    5e0 <printf+0x110>
+ 67f:	90                   	nop
+
+00000680 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 680:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 681:	a1 68 0b 00 00       	mov    0xb68,%eax
+{
+ 686:	89 e5                	mov    %esp,%ebp
+ 688:	57                   	push   %edi
+ 689:	56                   	push   %esi
+ 68a:	53                   	push   %ebx
+ 68b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 68e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 698:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 69a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 69c:	39 ca                	cmp    %ecx,%edx
+ 69e:	73 30                	jae    6d0 <free+0x50>
+ 6a0:	39 c1                	cmp    %eax,%ecx
+ 6a2:	72 04                	jb     6a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6a4:	39 c2                	cmp    %eax,%edx
+ 6a6:	72 f0                	jb     698 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 6ae:	39 f8                	cmp    %edi,%eax
+ 6b0:	74 2e                	je     6e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6b5:	8b 42 04             	mov    0x4(%edx),%eax
+ 6b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6bb:	39 f1                	cmp    %esi,%ecx
+ 6bd:	74 38                	je     6f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 6c1:	5b                   	pop    %ebx
+  freep = p;
+ 6c2:	89 15 68 0b 00 00    	mov    %edx,0xb68
+}
+ 6c8:	5e                   	pop    %esi
+ 6c9:	5f                   	pop    %edi
+ 6ca:	5d                   	pop    %ebp
+ 6cb:	c3                   	ret
+ 6cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6d0:	39 c1                	cmp    %eax,%ecx
+ 6d2:	72 d0                	jb     6a4 <free+0x24>
+ 6d4:	eb c2                	jmp    698 <free+0x18>
+ 6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 6e0:	03 70 04             	add    0x4(%eax),%esi
+ 6e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6e6:	8b 02                	mov    (%edx),%eax
+ 6e8:	8b 00                	mov    (%eax),%eax
+ 6ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 6ed:	8b 42 04             	mov    0x4(%edx),%eax
+ 6f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6f3:	39 f1                	cmp    %esi,%ecx
+ 6f5:	75 c8                	jne    6bf <free+0x3f>
+    p->s.size += bp->s.size;
+ 6f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 6fa:	89 15 68 0b 00 00    	mov    %edx,0xb68
+    p->s.size += bp->s.size;
+ 700:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 703:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 706:	89 0a                	mov    %ecx,(%edx)
+}
+ 708:	5b                   	pop    %ebx
+ 709:	5e                   	pop    %esi
+ 70a:	5f                   	pop    %edi
+ 70b:	5d                   	pop    %ebp
+ 70c:	c3                   	ret
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000710 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	53                   	push   %ebx
+ 716:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 719:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 71c:	8b 15 68 0b 00 00    	mov    0xb68,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 722:	8d 78 07             	lea    0x7(%eax),%edi
+ 725:	c1 ef 03             	shr    $0x3,%edi
+ 728:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 72b:	85 d2                	test   %edx,%edx
+ 72d:	0f 84 8d 00 00 00    	je     7c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 733:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 735:	8b 48 04             	mov    0x4(%eax),%ecx
+ 738:	39 f9                	cmp    %edi,%ecx
+ 73a:	73 64                	jae    7a0 <malloc+0x90>
+  if(nu < 4096)
+ 73c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 741:	39 df                	cmp    %ebx,%edi
+ 743:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 746:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 74d:	eb 0a                	jmp    759 <malloc+0x49>
+ 74f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 750:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 752:	8b 48 04             	mov    0x4(%eax),%ecx
+ 755:	39 f9                	cmp    %edi,%ecx
+ 757:	73 47                	jae    7a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 759:	89 c2                	mov    %eax,%edx
+ 75b:	39 05 68 0b 00 00    	cmp    %eax,0xb68
+ 761:	75 ed                	jne    750 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 763:	83 ec 0c             	sub    $0xc,%esp
+ 766:	56                   	push   %esi
+ 767:	e8 3c fc ff ff       	call   3a8 <sbrk>
+  if(p == (char*)-1)
+ 76c:	83 c4 10             	add    $0x10,%esp
+ 76f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 772:	74 1c                	je     790 <malloc+0x80>
+  hp->s.size = nu;
+ 774:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 777:	83 ec 0c             	sub    $0xc,%esp
+ 77a:	83 c0 08             	add    $0x8,%eax
+ 77d:	50                   	push   %eax
+ 77e:	e8 fd fe ff ff       	call   680 <free>
+  return freep;
+ 783:	8b 15 68 0b 00 00    	mov    0xb68,%edx
+      if((p = morecore(nunits)) == 0)
+ 789:	83 c4 10             	add    $0x10,%esp
+ 78c:	85 d2                	test   %edx,%edx
+ 78e:	75 c0                	jne    750 <malloc+0x40>
+        return 0;
+  }
+}
+ 790:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 793:	31 c0                	xor    %eax,%eax
+}
+ 795:	5b                   	pop    %ebx
+ 796:	5e                   	pop    %esi
+ 797:	5f                   	pop    %edi
+ 798:	5d                   	pop    %ebp
+ 799:	c3                   	ret
+ 79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 7a0:	39 cf                	cmp    %ecx,%edi
+ 7a2:	74 4c                	je     7f0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 7a4:	29 f9                	sub    %edi,%ecx
+ 7a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 7a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 7ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 7af:	89 15 68 0b 00 00    	mov    %edx,0xb68
+}
+ 7b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 7b8:	83 c0 08             	add    $0x8,%eax
+}
+ 7bb:	5b                   	pop    %ebx
+ 7bc:	5e                   	pop    %esi
+ 7bd:	5f                   	pop    %edi
+ 7be:	5d                   	pop    %ebp
+ 7bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 7c0:	c7 05 68 0b 00 00 6c 	movl   $0xb6c,0xb68
+ 7c7:	0b 00 00 
+    base.s.size = 0;
+ 7ca:	b8 6c 0b 00 00       	mov    $0xb6c,%eax
+    base.s.ptr = freep = prevp = &base;
+ 7cf:	c7 05 6c 0b 00 00 6c 	movl   $0xb6c,0xb6c
+ 7d6:	0b 00 00 
+    base.s.size = 0;
+ 7d9:	c7 05 70 0b 00 00 00 	movl   $0x0,0xb70
+ 7e0:	00 00 00 
+    if(p->s.size >= nunits){
+ 7e3:	e9 54 ff ff ff       	jmp    73c <malloc+0x2c>
+ 7e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 7f0:	8b 08                	mov    (%eax),%ecx
+ 7f2:	89 0a                	mov    %ecx,(%edx)
+ 7f4:	eb b9                	jmp    7af <malloc+0x9f>
@@ -42,6 +42,7 @@
 #define TDCR    (0x03E0/4)   // Timer Divide Configuration
 
 volatile uint *lapic;  // Initialized in mp.c
+uint tsc_per_tick;     // TSC cycles per clock tick, set by lapicinit()
 
 //PAGEBREAK!
 static void
@@ -65,8 +66,20 @@ lapicinit(void)
   // If xv6 cared more about precise timekeeping,
   // TICR would be calibrated using an external time source.
   lapicw(TDCR, X1);
+
+  // Time one tick with the TSC, once, for sub-tick CPU accounting.
+  if(tsc_per_tick == 0){
+    uint64 t0;
+    lapicw(TIMER, MASKED | (T_IRQ0 + IRQ_TIMER));
+    lapicw(TICR, TICKCOUNT);
+    t0 = rdtsc();
+    while(lapic[TCCR] != 0)
+      ;
+    t0 = rdtsc() - t0;
+    tsc_per_tick = (t0 >> 32) ? 0xFFFFFFFF : t0 ? (uint)t0 : 1;
+  }
   lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  lapicw(TICR, TICKCOUNT);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -120,6 +133,53 @@ microdelay(int us)
 {
 }
 
+// Send a fixed interrupt with the given vector to one CPU.
+// Caller must have interrupts disabled.
+void
+lapicsendipi(uchar apicid, int vector)
+{
+  if(!lapic)
+    return;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
+// Tick every TICKCOUNT bus cycles.
+void
+lapicperiodic(void)
+{
+  if(!lapic)
+    return;
+  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+  lapicw(TICR, TICKCOUNT);
+}
+
+// Interrupt once after count bus cycles; 0 stops the timer.
+void
+lapiconeshot(uint count)
+{
+  if(!lapic)
+    return;
+  if(count == 0){
+    lapicw(TIMER, MASKED | (T_IRQ0 + IRQ_TIMER));
+    lapicw(TICR, 0);
+    return;
+  }
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, count);
+}
+
+// Bus cycles since the current one-shot was armed.
+uint
+lapicelapsed(void)
+{
+  if(!lapic)
+    return 0;
+  return lapic[TICR] - lapic[TCCR];
+}
+
 #define CMOS_PORT    0x70
 #define CMOS_RETURN  0x71
 
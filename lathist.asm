@@ -0,0 +1,1503 @@
+
+_lathist:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+      printf(1, "%s\t%d\t%d\t%d\n", cpu, lvl, b, h[b]);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec d8 00 00 00    	sub    $0xd8,%esp
+  17:	8b 31                	mov    (%ecx),%esi
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  struct lathist *lh;
+  uint sum[NLATBUCKET];
+  char cpu[4];
+  int i, c, lvl, b, ncpu, percpu, reset;
+
+  percpu = reset = 0;
+  1c:	c7 85 34 ff ff ff 00 	movl   $0x0,-0xcc(%ebp)
+  23:	00 00 00 
+  26:	c7 85 30 ff ff ff 00 	movl   $0x0,-0xd0(%ebp)
+  2d:	00 00 00 
+  for(i = 1; i < argc; i++){
+  30:	83 fe 01             	cmp    $0x1,%esi
+  33:	7e 5f                	jle    94 <main+0x94>
+  35:	bf 01 00 00 00       	mov    $0x1,%edi
+  3a:	eb 15                	jmp    51 <main+0x51>
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(strcmp(argv[i], "-c") == 0)
+      percpu = 1;
+  40:	c7 85 30 ff ff ff 01 	movl   $0x1,-0xd0(%ebp)
+  47:	00 00 00 
+  for(i = 1; i < argc; i++){
+  4a:	83 c7 01             	add    $0x1,%edi
+  4d:	39 fe                	cmp    %edi,%esi
+  4f:	74 43                	je     94 <main+0x94>
+    if(strcmp(argv[i], "-c") == 0)
+  51:	83 ec 08             	sub    $0x8,%esp
+  54:	68 08 0a 00 00       	push   $0xa08
+  59:	ff 34 bb             	push   (%ebx,%edi,4)
+  5c:	e8 3f 02 00 00       	call   2a0 <strcmp>
+  61:	83 c4 10             	add    $0x10,%esp
+  64:	85 c0                	test   %eax,%eax
+  66:	74 d8                	je     40 <main+0x40>
+    else if(strcmp(argv[i], "-z") == 0)
+  68:	83 ec 08             	sub    $0x8,%esp
+  6b:	68 0b 0a 00 00       	push   $0xa0b
+  70:	ff 34 bb             	push   (%ebx,%edi,4)
+  73:	e8 28 02 00 00       	call   2a0 <strcmp>
+  78:	83 c4 10             	add    $0x10,%esp
+  7b:	85 c0                	test   %eax,%eax
+  7d:	0f 85 cc 01 00 00    	jne    24f <main+0x24f>
+      reset = 1;
+  83:	c7 85 34 ff ff ff 01 	movl   $0x1,-0xcc(%ebp)
+  8a:	00 00 00 
+  for(i = 1; i < argc; i++){
+  8d:	83 c7 01             	add    $0x1,%edi
+  90:	39 fe                	cmp    %edi,%esi
+  92:	75 bd                	jne    51 <main+0x51>
+      printf(2, "Usage: lathist [-c] [-z]\n");
+      exit();
+    }
+  }
+
+  if((lh = malloc(sizeof(*lh))) == 0 || (ncpu = getlathist(lh, reset)) < 0){
+  94:	83 ec 0c             	sub    $0xc,%esp
+  97:	68 00 28 00 00       	push   $0x2800
+  9c:	e8 7f 08 00 00       	call   920 <malloc>
+  a1:	83 c4 10             	add    $0x10,%esp
+  a4:	89 c3                	mov    %eax,%ebx
+  a6:	85 c0                	test   %eax,%eax
+  a8:	74 1b                	je     c5 <main+0xc5>
+  aa:	57                   	push   %edi
+  ab:	57                   	push   %edi
+  ac:	ff b5 34 ff ff ff    	push   -0xcc(%ebp)
+  b2:	50                   	push   %eax
+  b3:	e8 38 05 00 00       	call   5f0 <getlathist>
+  b8:	83 c4 10             	add    $0x10,%esp
+  bb:	89 85 2c ff ff ff    	mov    %eax,-0xd4(%ebp)
+  c1:	85 c0                	test   %eax,%eax
+  c3:	79 13                	jns    d8 <main+0xd8>
+    printf(2, "lathist: cannot read histograms\n");
+  c5:	50                   	push   %eax
+  c6:	50                   	push   %eax
+  c7:	68 54 0a 00 00       	push   $0xa54
+  cc:	6a 02                	push   $0x2
+  ce:	e8 0d 06 00 00       	call   6e0 <printf>
+    exit();
+  d3:	e8 58 04 00 00       	call   530 <exit>
+  }
+
+  printf(1, "cpu\tlevel\tbucket\tcount\n");
+  d8:	56                   	push   %esi
+  d9:	56                   	push   %esi
+  for(lvl = 0; lvl < NMLFQ; lvl++){
+  da:	31 f6                	xor    %esi,%esi
+  printf(1, "cpu\tlevel\tbucket\tcount\n");
+  dc:	68 28 0a 00 00       	push   $0xa28
+  e1:	6a 01                	push   $0x1
+  e3:	e8 f8 05 00 00       	call   6e0 <printf>
+  for(lvl = 0; lvl < NMLFQ; lvl++){
+  e8:	89 9d 28 ff ff ff    	mov    %ebx,-0xd8(%ebp)
+  ee:	83 c4 10             	add    $0x10,%esp
+      printf(1, "%s\t%d\t%d\t%d\n", cpu, lvl, b, h[b]);
+  f1:	89 9d 24 ff ff ff    	mov    %ebx,-0xdc(%ebp)
+    if(percpu){
+  f7:	8b 8d 30 ff ff ff    	mov    -0xd0(%ebp),%ecx
+  fd:	85 c9                	test   %ecx,%ecx
+  ff:	0f 84 af 00 00 00    	je     1b4 <main+0x1b4>
+      for(c = 0; c < ncpu; c++){
+ 105:	8b 95 2c ff ff ff    	mov    -0xd4(%ebp),%edx
+ 10b:	85 d2                	test   %edx,%edx
+ 10d:	74 7b                	je     18a <main+0x18a>
+ 10f:	8b bd 28 ff ff ff    	mov    -0xd8(%ebp),%edi
+ 115:	31 d2                	xor    %edx,%edx
+ 117:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11e:	66 90                	xchg   %ax,%ax
+        cpu[0] = '0' + c;
+ 120:	8d 42 30             	lea    0x30(%edx),%eax
+        cpu[1] = 0;
+ 123:	c6 85 45 ff ff ff 00 	movb   $0x0,-0xbb(%ebp)
+  for(b = 0; b < NLATBUCKET; b++)
+ 12a:	31 db                	xor    %ebx,%ebx
+        cpu[0] = '0' + c;
+ 12c:	88 85 44 ff ff ff    	mov    %al,-0xbc(%ebp)
+  for(b = 0; b < NLATBUCKET; b++)
+ 132:	89 95 34 ff ff ff    	mov    %edx,-0xcc(%ebp)
+ 138:	eb 0e                	jmp    148 <main+0x148>
+ 13a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 140:	83 c3 01             	add    $0x1,%ebx
+ 143:	83 fb 28             	cmp    $0x28,%ebx
+ 146:	74 2b                	je     173 <main+0x173>
+    if(h[b])
+ 148:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+ 14b:	85 c0                	test   %eax,%eax
+ 14d:	74 f1                	je     140 <main+0x140>
+      printf(1, "%s\t%d\t%d\t%d\n", cpu, lvl, b, h[b]);
+ 14f:	83 ec 08             	sub    $0x8,%esp
+ 152:	50                   	push   %eax
+ 153:	8d 85 44 ff ff ff    	lea    -0xbc(%ebp),%eax
+ 159:	53                   	push   %ebx
+  for(b = 0; b < NLATBUCKET; b++)
+ 15a:	83 c3 01             	add    $0x1,%ebx
+      printf(1, "%s\t%d\t%d\t%d\n", cpu, lvl, b, h[b]);
+ 15d:	56                   	push   %esi
+ 15e:	50                   	push   %eax
+ 15f:	68 40 0a 00 00       	push   $0xa40
+ 164:	6a 01                	push   $0x1
+ 166:	e8 75 05 00 00       	call   6e0 <printf>
+ 16b:	83 c4 20             	add    $0x20,%esp
+  for(b = 0; b < NLATBUCKET; b++)
+ 16e:	83 fb 28             	cmp    $0x28,%ebx
+ 171:	75 d5                	jne    148 <main+0x148>
+      for(c = 0; c < ncpu; c++){
+ 173:	8b 95 34 ff ff ff    	mov    -0xcc(%ebp),%edx
+ 179:	81 c7 00 05 00 00    	add    $0x500,%edi
+ 17f:	83 c2 01             	add    $0x1,%edx
+ 182:	39 95 2c ff ff ff    	cmp    %edx,-0xd4(%ebp)
+ 188:	75 96                	jne    120 <main+0x120>
+  for(lvl = 0; lvl < NMLFQ; lvl++){
+ 18a:	81 85 28 ff ff ff a0 	addl   $0xa0,-0xd8(%ebp)
+ 191:	00 00 00 
+ 194:	83 c6 01             	add    $0x1,%esi
+ 197:	83 fe 08             	cmp    $0x8,%esi
+ 19a:	0f 85 57 ff ff ff    	jne    f7 <main+0xf7>
+    for(c = 0; c < ncpu; c++)
+      for(b = 0; b < NLATBUCKET; b++)
+        sum[b] += lh->hist[c][lvl][b];
+    print("all", lvl, sum);
+  }
+  free(lh);
+ 1a0:	8b 9d 24 ff ff ff    	mov    -0xdc(%ebp),%ebx
+ 1a6:	83 ec 0c             	sub    $0xc,%esp
+ 1a9:	53                   	push   %ebx
+ 1aa:	e8 e1 06 00 00       	call   890 <free>
+  exit();
+ 1af:	e8 7c 03 00 00       	call   530 <exit>
+    memset(sum, 0, sizeof(sum));
+ 1b4:	83 ec 04             	sub    $0x4,%esp
+ 1b7:	8d 9d 48 ff ff ff    	lea    -0xb8(%ebp),%ebx
+    for(c = 0; c < ncpu; c++)
+ 1bd:	31 ff                	xor    %edi,%edi
+    memset(sum, 0, sizeof(sum));
+ 1bf:	68 a0 00 00 00       	push   $0xa0
+ 1c4:	6a 00                	push   $0x0
+ 1c6:	53                   	push   %ebx
+ 1c7:	e8 64 01 00 00       	call   330 <memset>
+    for(c = 0; c < ncpu; c++)
+ 1cc:	8b 85 2c ff ff ff    	mov    -0xd4(%ebp),%eax
+ 1d2:	8b 8d 28 ff ff ff    	mov    -0xd8(%ebp),%ecx
+ 1d8:	83 c4 10             	add    $0x10,%esp
+ 1db:	85 c0                	test   %eax,%eax
+ 1dd:	74 3a                	je     219 <main+0x219>
+ 1df:	89 b5 34 ff ff ff    	mov    %esi,-0xcc(%ebp)
+ 1e5:	8b b5 2c ff ff ff    	mov    -0xd4(%ebp),%esi
+ 1eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+      for(b = 0; b < NLATBUCKET; b++)
+ 1f0:	31 c0                	xor    %eax,%eax
+ 1f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        sum[b] += lh->hist[c][lvl][b];
+ 1f8:	8b 14 81             	mov    (%ecx,%eax,4),%edx
+ 1fb:	01 14 83             	add    %edx,(%ebx,%eax,4)
+      for(b = 0; b < NLATBUCKET; b++)
+ 1fe:	83 c0 01             	add    $0x1,%eax
+ 201:	83 f8 28             	cmp    $0x28,%eax
+ 204:	75 f2                	jne    1f8 <main+0x1f8>
+    for(c = 0; c < ncpu; c++)
+ 206:	83 c7 01             	add    $0x1,%edi
+ 209:	81 c1 00 05 00 00    	add    $0x500,%ecx
+ 20f:	39 fe                	cmp    %edi,%esi
+ 211:	75 dd                	jne    1f0 <main+0x1f0>
+ 213:	8b b5 34 ff ff ff    	mov    -0xcc(%ebp),%esi
+  for(b = 0; b < NLATBUCKET; b++)
+ 219:	31 ff                	xor    %edi,%edi
+ 21b:	eb 0f                	jmp    22c <main+0x22c>
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+ 220:	83 c7 01             	add    $0x1,%edi
+ 223:	83 ff 28             	cmp    $0x28,%edi
+ 226:	0f 84 5e ff ff ff    	je     18a <main+0x18a>
+    if(h[b])
+ 22c:	8b 04 bb             	mov    (%ebx,%edi,4),%eax
+ 22f:	85 c0                	test   %eax,%eax
+ 231:	74 ed                	je     220 <main+0x220>
+      printf(1, "%s\t%d\t%d\t%d\n", cpu, lvl, b, h[b]);
+ 233:	83 ec 08             	sub    $0x8,%esp
+ 236:	50                   	push   %eax
+ 237:	57                   	push   %edi
+ 238:	56                   	push   %esi
+ 239:	68 4d 0a 00 00       	push   $0xa4d
+ 23e:	68 40 0a 00 00       	push   $0xa40
+ 243:	6a 01                	push   $0x1
+ 245:	e8 96 04 00 00       	call   6e0 <printf>
+ 24a:	83 c4 20             	add    $0x20,%esp
+ 24d:	eb d1                	jmp    220 <main+0x220>
+      printf(2, "Usage: lathist [-c] [-z]\n");
+ 24f:	50                   	push   %eax
+ 250:	50                   	push   %eax
+ 251:	68 0e 0a 00 00       	push   $0xa0e
+ 256:	6a 02                	push   $0x2
+ 258:	e8 83 04 00 00       	call   6e0 <printf>
+      exit();
+ 25d:	e8 ce 02 00 00       	call   530 <exit>
+ 262:	66 90                	xchg   %ax,%ax
+ 264:	66 90                	xchg   %ax,%ax
+ 266:	66 90                	xchg   %ax,%ax
+ 268:	66 90                	xchg   %ax,%ax
+ 26a:	66 90                	xchg   %ax,%ax
+ 26c:	66 90                	xchg   %ax,%ax
+ 26e:	66 90                	xchg   %ax,%ax
+
+00000270 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 270:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 271:	31 c0                	xor    %eax,%eax
+{
+ 273:	89 e5                	mov    %esp,%ebp
+ 275:	53                   	push   %ebx
+ 276:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 279:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 280:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 284:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 287:	83 c0 01             	add    $0x1,%eax
+ 28a:	84 d2                	test   %dl,%dl
+ 28c:	75 f2                	jne    280 <strcpy+0x10>
+    ;
+  return os;
+}
+ 28e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 291:	89 c8                	mov    %ecx,%eax
+ 293:	c9                   	leave
+ 294:	c3                   	ret
+ 295:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	53                   	push   %ebx
+ 2a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2aa:	0f b6 02             	movzbl (%edx),%eax
+ 2ad:	84 c0                	test   %al,%al
+ 2af:	75 17                	jne    2c8 <strcmp+0x28>
+ 2b1:	eb 3a                	jmp    2ed <strcmp+0x4d>
+ 2b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2b7:	90                   	nop
+ 2b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2bc:	83 c2 01             	add    $0x1,%edx
+ 2bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2c2:	84 c0                	test   %al,%al
+ 2c4:	74 1a                	je     2e0 <strcmp+0x40>
+    p++, q++;
+ 2c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2c8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2cb:	38 c3                	cmp    %al,%bl
+ 2cd:	74 e9                	je     2b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2cf:	29 d8                	sub    %ebx,%eax
+}
+ 2d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2d4:	c9                   	leave
+ 2d5:	c3                   	ret
+ 2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2e4:	31 c0                	xor    %eax,%eax
+ 2e6:	29 d8                	sub    %ebx,%eax
+}
+ 2e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2eb:	c9                   	leave
+ 2ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2ed:	0f b6 19             	movzbl (%ecx),%ebx
+ 2f0:	31 c0                	xor    %eax,%eax
+ 2f2:	eb db                	jmp    2cf <strcmp+0x2f>
+ 2f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+
+00000300 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 306:	80 3a 00             	cmpb   $0x0,(%edx)
+ 309:	74 15                	je     320 <strlen+0x20>
+ 30b:	31 c0                	xor    %eax,%eax
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+ 310:	83 c0 01             	add    $0x1,%eax
+ 313:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 317:	89 c1                	mov    %eax,%ecx
+ 319:	75 f5                	jne    310 <strlen+0x10>
+    ;
+  return n;
+}
+ 31b:	89 c8                	mov    %ecx,%eax
+ 31d:	5d                   	pop    %ebp
+ 31e:	c3                   	ret
+ 31f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 320:	31 c9                	xor    %ecx,%ecx
+}
+ 322:	5d                   	pop    %ebp
+ 323:	89 c8                	mov    %ecx,%eax
+ 325:	c3                   	ret
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000330 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 337:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 33a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 33d:	89 d7                	mov    %edx,%edi
+ 33f:	fc                   	cld
+ 340:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 342:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 345:	89 d0                	mov    %edx,%eax
+ 347:	c9                   	leave
+ 348:	c3                   	ret
+ 349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 35a:	0f b6 10             	movzbl (%eax),%edx
+ 35d:	84 d2                	test   %dl,%dl
+ 35f:	75 12                	jne    373 <strchr+0x23>
+ 361:	eb 1d                	jmp    380 <strchr+0x30>
+ 363:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 367:	90                   	nop
+ 368:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 36c:	83 c0 01             	add    $0x1,%eax
+ 36f:	84 d2                	test   %dl,%dl
+ 371:	74 0d                	je     380 <strchr+0x30>
+    if(*s == c)
+ 373:	38 d1                	cmp    %dl,%cl
+ 375:	75 f1                	jne    368 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 377:	5d                   	pop    %ebp
+ 378:	c3                   	ret
+ 379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 380:	31 c0                	xor    %eax,%eax
+}
+ 382:	5d                   	pop    %ebp
+ 383:	c3                   	ret
+ 384:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 38f:	90                   	nop
+
+00000390 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 395:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 398:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 399:	31 db                	xor    %ebx,%ebx
+{
+ 39b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 39e:	eb 27                	jmp    3c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3a0:	83 ec 04             	sub    $0x4,%esp
+ 3a3:	6a 01                	push   $0x1
+ 3a5:	56                   	push   %esi
+ 3a6:	6a 00                	push   $0x0
+ 3a8:	e8 9b 01 00 00       	call   548 <read>
+    if(cc < 1)
+ 3ad:	83 c4 10             	add    $0x10,%esp
+ 3b0:	85 c0                	test   %eax,%eax
+ 3b2:	7e 1d                	jle    3d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3bf:	3c 0a                	cmp    $0xa,%al
+ 3c1:	74 10                	je     3d3 <gets+0x43>
+ 3c3:	3c 0d                	cmp    $0xd,%al
+ 3c5:	74 0c                	je     3d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3c7:	89 df                	mov    %ebx,%edi
+ 3c9:	83 c3 01             	add    $0x1,%ebx
+ 3cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3cf:	7c cf                	jl     3a0 <gets+0x10>
+ 3d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3dd:	5b                   	pop    %ebx
+ 3de:	5e                   	pop    %esi
+ 3df:	5f                   	pop    %edi
+ 3e0:	5d                   	pop    %ebp
+ 3e1:	c3                   	ret
+ 3e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	56                   	push   %esi
+ 3f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3f5:	83 ec 08             	sub    $0x8,%esp
+ 3f8:	6a 00                	push   $0x0
+ 3fa:	ff 75 08             	push   0x8(%ebp)
+ 3fd:	e8 6e 01 00 00       	call   570 <open>
+  if(fd < 0)
+ 402:	83 c4 10             	add    $0x10,%esp
+ 405:	85 c0                	test   %eax,%eax
+ 407:	78 27                	js     430 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 409:	83 ec 08             	sub    $0x8,%esp
+ 40c:	ff 75 0c             	push   0xc(%ebp)
+ 40f:	89 c3                	mov    %eax,%ebx
+ 411:	50                   	push   %eax
+ 412:	e8 71 01 00 00       	call   588 <fstat>
+  close(fd);
+ 417:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 41a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 41c:	e8 37 01 00 00       	call   558 <close>
+  return r;
+ 421:	83 c4 10             	add    $0x10,%esp
+}
+ 424:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 427:	89 f0                	mov    %esi,%eax
+ 429:	5b                   	pop    %ebx
+ 42a:	5e                   	pop    %esi
+ 42b:	5d                   	pop    %ebp
+ 42c:	c3                   	ret
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 430:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 435:	eb ed                	jmp    424 <stat+0x34>
+ 437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43e:	66 90                	xchg   %ax,%ax
+
+00000440 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	53                   	push   %ebx
+ 444:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 447:	0f be 02             	movsbl (%edx),%eax
+ 44a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 44d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 450:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 455:	77 1e                	ja     475 <atoi+0x35>
+ 457:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 460:	83 c2 01             	add    $0x1,%edx
+ 463:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 466:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 46a:	0f be 02             	movsbl (%edx),%eax
+ 46d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 470:	80 fb 09             	cmp    $0x9,%bl
+ 473:	76 eb                	jbe    460 <atoi+0x20>
+  return n;
+}
+ 475:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 478:	89 c8                	mov    %ecx,%eax
+ 47a:	c9                   	leave
+ 47b:	c3                   	ret
+ 47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	8b 45 10             	mov    0x10(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 48e:	85 c0                	test   %eax,%eax
+ 490:	7e 13                	jle    4a5 <memmove+0x25>
+ 492:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 494:	89 d7                	mov    %edx,%edi
+ 496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4a1:	39 f8                	cmp    %edi,%eax
+ 4a3:	75 fb                	jne    4a0 <memmove+0x20>
+  return vdst;
+}
+ 4a5:	5e                   	pop    %esi
+ 4a6:	89 d0                	mov    %edx,%eax
+ 4a8:	5f                   	pop    %edi
+ 4a9:	5d                   	pop    %ebp
+ 4aa:	c3                   	ret
+ 4ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4af:	90                   	nop
+
+000004b0 <mutex_lock>:
+
+// Take and release m with atomic instructions, and enter the kernel
+// only to block while it is held or to wake a blocked thread.
+void
+mutex_lock(struct mutex *m)
+{
+ 4b0:	55                   	push   %ebp
+  uint s;
+
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 4b1:	31 c0                	xor    %eax,%eax
+ 4b3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 4b8:	89 e5                	mov    %esp,%ebp
+ 4ba:	56                   	push   %esi
+ 4bb:	53                   	push   %ebx
+ 4bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 4bf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 4c3:	85 c0                	test   %eax,%eax
+ 4c5:	74 30                	je     4f7 <mutex_lock+0x47>
+    return;
+  // Contended: mark it so the holder knows to wake us.
+  if(s != 2)
+ 4c7:	83 f8 02             	cmp    $0x2,%eax
+ 4ca:	74 0c                	je     4d8 <mutex_lock+0x28>
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 4cc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4d1:	f0 87 03             	lock xchg %eax,(%ebx)
+    s = xchg(&m->state, 2);
+  while(s != 0){
+ 4d4:	85 c0                	test   %eax,%eax
+ 4d6:	74 1f                	je     4f7 <mutex_lock+0x47>
+ 4d8:	be 02 00 00 00       	mov    $0x2,%esi
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+ 4e0:	83 ec 08             	sub    $0x8,%esp
+ 4e3:	6a 02                	push   $0x2
+ 4e5:	53                   	push   %ebx
+ 4e6:	e8 45 01 00 00       	call   630 <futex_wait>
+ 4eb:	89 f0                	mov    %esi,%eax
+ 4ed:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(s != 0){
+ 4f0:	83 c4 10             	add    $0x10,%esp
+ 4f3:	85 c0                	test   %eax,%eax
+ 4f5:	75 e9                	jne    4e0 <mutex_lock+0x30>
+    s = xchg(&m->state, 2);
+  }
+}
+ 4f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4fa:	5b                   	pop    %ebx
+ 4fb:	5e                   	pop    %esi
+ 4fc:	5d                   	pop    %ebp
+ 4fd:	c3                   	ret
+ 4fe:	66 90                	xchg   %ax,%ax
+
+00000500 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 500:	55                   	push   %ebp
+ 501:	31 c0                	xor    %eax,%eax
+ 503:	89 e5                	mov    %esp,%ebp
+ 505:	83 ec 08             	sub    $0x8,%esp
+ 508:	8b 55 08             	mov    0x8(%ebp),%edx
+ 50b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 50e:	83 f8 02             	cmp    $0x2,%eax
+ 511:	74 05                	je     518 <mutex_unlock+0x18>
+    futex_wake(&m->state, 1);
+}
+ 513:	c9                   	leave
+ 514:	c3                   	ret
+ 515:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->state, 1);
+ 518:	83 ec 08             	sub    $0x8,%esp
+ 51b:	6a 01                	push   $0x1
+ 51d:	52                   	push   %edx
+ 51e:	e8 15 01 00 00       	call   638 <futex_wake>
+ 523:	83 c4 10             	add    $0x10,%esp
+}
+ 526:	c9                   	leave
+ 527:	c3                   	ret
+
+00000528 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 528:	b8 01 00 00 00       	mov    $0x1,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <exit>:
+SYSCALL(exit)
+ 530:	b8 02 00 00 00       	mov    $0x2,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <wait>:
+SYSCALL(wait)
+ 538:	b8 03 00 00 00       	mov    $0x3,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <pipe>:
+SYSCALL(pipe)
+ 540:	b8 04 00 00 00       	mov    $0x4,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <read>:
+SYSCALL(read)
+ 548:	b8 05 00 00 00       	mov    $0x5,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <write>:
+SYSCALL(write)
+ 550:	b8 10 00 00 00       	mov    $0x10,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <close>:
+SYSCALL(close)
+ 558:	b8 15 00 00 00       	mov    $0x15,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <kill>:
+SYSCALL(kill)
+ 560:	b8 06 00 00 00       	mov    $0x6,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <exec>:
+SYSCALL(exec)
+ 568:	b8 07 00 00 00       	mov    $0x7,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <open>:
+SYSCALL(open)
+ 570:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <mknod>:
+SYSCALL(mknod)
+ 578:	b8 11 00 00 00       	mov    $0x11,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <unlink>:
+SYSCALL(unlink)
+ 580:	b8 12 00 00 00       	mov    $0x12,%eax
+ 585:	cd 40                	int    $0x40
+ 587:	c3                   	ret
+
+00000588 <fstat>:
+SYSCALL(fstat)
+ 588:	b8 08 00 00 00       	mov    $0x8,%eax
+ 58d:	cd 40                	int    $0x40
+ 58f:	c3                   	ret
+
+00000590 <link>:
+SYSCALL(link)
+ 590:	b8 13 00 00 00       	mov    $0x13,%eax
+ 595:	cd 40                	int    $0x40
+ 597:	c3                   	ret
+
+00000598 <mkdir>:
+SYSCALL(mkdir)
+ 598:	b8 14 00 00 00       	mov    $0x14,%eax
+ 59d:	cd 40                	int    $0x40
+ 59f:	c3                   	ret
+
+000005a0 <chdir>:
+SYSCALL(chdir)
+ 5a0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5a5:	cd 40                	int    $0x40
+ 5a7:	c3                   	ret
+
+000005a8 <dup>:
+SYSCALL(dup)
+ 5a8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5ad:	cd 40                	int    $0x40
+ 5af:	c3                   	ret
+
+000005b0 <getpid>:
+SYSCALL(getpid)
+ 5b0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5b5:	cd 40                	int    $0x40
+ 5b7:	c3                   	ret
+
+000005b8 <sbrk>:
+SYSCALL(sbrk)
+ 5b8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5bd:	cd 40                	int    $0x40
+ 5bf:	c3                   	ret
+
+000005c0 <sleep>:
+SYSCALL(sleep)
+ 5c0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5c5:	cd 40                	int    $0x40
+ 5c7:	c3                   	ret
+
+000005c8 <uptime>:
+SYSCALL(uptime)
+ 5c8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5cd:	cd 40                	int    $0x40
+ 5cf:	c3                   	ret
+
+000005d0 <ps>:
+SYSCALL(ps)
+ 5d0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5d5:	cd 40                	int    $0x40
+ 5d7:	c3                   	ret
+
+000005d8 <getschedparams>:
+SYSCALL(getschedparams)
+ 5d8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5dd:	cd 40                	int    $0x40
+ 5df:	c3                   	ret
+
+000005e0 <setschedparams>:
+SYSCALL(setschedparams)
+ 5e0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5e5:	cd 40                	int    $0x40
+ 5e7:	c3                   	ret
+
+000005e8 <getpinfo>:
+SYSCALL(getpinfo)
+ 5e8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5ed:	cd 40                	int    $0x40
+ 5ef:	c3                   	ret
+
+000005f0 <getlathist>:
+SYSCALL(getlathist)
+ 5f0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5f5:	cd 40                	int    $0x40
+ 5f7:	c3                   	ret
+
+000005f8 <setpolicy>:
+SYSCALL(setpolicy)
+ 5f8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5fd:	cd 40                	int    $0x40
+ 5ff:	c3                   	ret
+
+00000600 <settickets>:
+SYSCALL(settickets)
+ 600:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 605:	cd 40                	int    $0x40
+ 607:	c3                   	ret
+
+00000608 <setaffinity>:
+SYSCALL(setaffinity)
+ 608:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 60d:	cd 40                	int    $0x40
+ 60f:	c3                   	ret
+
+00000610 <getaffinity>:
+SYSCALL(getaffinity)
+ 610:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 615:	cd 40                	int    $0x40
+ 617:	c3                   	ret
+
+00000618 <setrt>:
+SYSCALL(setrt)
+ 618:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 61d:	cd 40                	int    $0x40
+ 61f:	c3                   	ret
+
+00000620 <clone>:
+SYSCALL(clone)
+ 620:	b8 20 00 00 00       	mov    $0x20,%eax
+ 625:	cd 40                	int    $0x40
+ 627:	c3                   	ret
+
+00000628 <join>:
+SYSCALL(join)
+ 628:	b8 21 00 00 00       	mov    $0x21,%eax
+ 62d:	cd 40                	int    $0x40
+ 62f:	c3                   	ret
+
+00000630 <futex_wait>:
+SYSCALL(futex_wait)
+ 630:	b8 22 00 00 00       	mov    $0x22,%eax
+ 635:	cd 40                	int    $0x40
+ 637:	c3                   	ret
+
+00000638 <futex_wake>:
+SYSCALL(futex_wake)
+ 638:	b8 23 00 00 00       	mov    $0x23,%eax
+ 63d:	cd 40                	int    $0x40
+ 63f:	c3                   	ret
+
+00000640 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	57                   	push   %edi
+ 644:	56                   	push   %esi
+ 645:	53                   	push   %ebx
+ 646:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 648:	89 d1                	mov    %edx,%ecx
+{
+ 64a:	83 ec 3c             	sub    $0x3c,%esp
+ 64d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 650:	85 d2                	test   %edx,%edx
+ 652:	0f 89 80 00 00 00    	jns    6d8 <printint+0x98>
+ 658:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 65c:	74 7a                	je     6d8 <printint+0x98>
+    x = -xx;
+ 65e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 660:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 665:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 668:	31 f6                	xor    %esi,%esi
+ 66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 670:	89 c8                	mov    %ecx,%eax
+ 672:	31 d2                	xor    %edx,%edx
+ 674:	89 f7                	mov    %esi,%edi
+ 676:	f7 f3                	div    %ebx
+ 678:	8d 76 01             	lea    0x1(%esi),%esi
+ 67b:	0f b6 92 d4 0a 00 00 	movzbl 0xad4(%edx),%edx
+ 682:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 686:	89 ca                	mov    %ecx,%edx
+ 688:	89 c1                	mov    %eax,%ecx
+ 68a:	39 da                	cmp    %ebx,%edx
+ 68c:	73 e2                	jae    670 <printint+0x30>
+  if(neg)
+ 68e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 691:	85 c0                	test   %eax,%eax
+ 693:	74 07                	je     69c <printint+0x5c>
+    buf[i++] = '-';
+ 695:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 69a:	89 f7                	mov    %esi,%edi
+ 69c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 69f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6a2:	01 df                	add    %ebx,%edi
+ 6a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6ab:	83 ec 04             	sub    $0x4,%esp
+ 6ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6b4:	6a 01                	push   $0x1
+ 6b6:	50                   	push   %eax
+ 6b7:	56                   	push   %esi
+ 6b8:	e8 93 fe ff ff       	call   550 <write>
+  while(--i >= 0)
+ 6bd:	89 f8                	mov    %edi,%eax
+ 6bf:	83 c4 10             	add    $0x10,%esp
+ 6c2:	83 ef 01             	sub    $0x1,%edi
+ 6c5:	39 d8                	cmp    %ebx,%eax
+ 6c7:	75 df                	jne    6a8 <printint+0x68>
+}
+ 6c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6cc:	5b                   	pop    %ebx
+ 6cd:	5e                   	pop    %esi
+ 6ce:	5f                   	pop    %edi
+ 6cf:	5d                   	pop    %ebp
+ 6d0:	c3                   	ret
+ 6d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6d8:	31 c0                	xor    %eax,%eax
+ 6da:	eb 89                	jmp    665 <printint+0x25>
+ 6dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	57                   	push   %edi
+ 6e4:	56                   	push   %esi
+ 6e5:	53                   	push   %ebx
+ 6e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 6f2:	83 c6 01             	add    $0x1,%esi
+ 6f5:	84 db                	test   %bl,%bl
+ 6f7:	74 67                	je     760 <printf+0x80>
+ 6f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 6fc:	31 d2                	xor    %edx,%edx
+ 6fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 701:	eb 34                	jmp    737 <printf+0x57>
+ 703:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 707:	90                   	nop
+ 708:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 70b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 710:	83 f8 25             	cmp    $0x25,%eax
+ 713:	74 18                	je     72d <printf+0x4d>
+  write(fd, &c, 1);
+ 715:	83 ec 04             	sub    $0x4,%esp
+ 718:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 71b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 71e:	6a 01                	push   $0x1
+ 720:	50                   	push   %eax
+ 721:	57                   	push   %edi
+ 722:	e8 29 fe ff ff       	call   550 <write>
+ 727:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 72a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 72d:	0f b6 1e             	movzbl (%esi),%ebx
+ 730:	83 c6 01             	add    $0x1,%esi
+ 733:	84 db                	test   %bl,%bl
+ 735:	74 29                	je     760 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 737:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 73a:	85 d2                	test   %edx,%edx
+ 73c:	74 ca                	je     708 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 73e:	83 fa 25             	cmp    $0x25,%edx
+ 741:	75 ea                	jne    72d <printf+0x4d>
+      if(c == 'd'){
+ 743:	83 f8 25             	cmp    $0x25,%eax
+ 746:	0f 84 24 01 00 00    	je     870 <printf+0x190>
+ 74c:	83 e8 63             	sub    $0x63,%eax
+ 74f:	83 f8 15             	cmp    $0x15,%eax
+ 752:	77 1c                	ja     770 <printf+0x90>
+ 754:	ff 24 85 7c 0a 00 00 	jmp    *0xa7c(,%eax,4)
+ 75b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 75f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 760:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 763:	5b                   	pop    %ebx
+ 764:	5e                   	pop    %esi
+ 765:	5f                   	pop    %edi
+ 766:	5d                   	pop    %ebp
+ 767:	c3                   	ret
+ 768:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76f:	90                   	nop
+  write(fd, &c, 1);
+ 770:	83 ec 04             	sub    $0x4,%esp
+ 773:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 776:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 77a:	6a 01                	push   $0x1
+ 77c:	52                   	push   %edx
+ 77d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 780:	57                   	push   %edi
+ 781:	e8 ca fd ff ff       	call   550 <write>
+ 786:	83 c4 0c             	add    $0xc,%esp
+ 789:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 78c:	6a 01                	push   $0x1
+ 78e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 791:	52                   	push   %edx
+ 792:	57                   	push   %edi
+ 793:	e8 b8 fd ff ff       	call   550 <write>
+        putc(fd, c);
+ 798:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 79b:	31 d2                	xor    %edx,%edx
+ 79d:	eb 8e                	jmp    72d <printf+0x4d>
+ 79f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7a3:	83 ec 0c             	sub    $0xc,%esp
+ 7a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7ab:	8b 13                	mov    (%ebx),%edx
+ 7ad:	6a 00                	push   $0x0
+ 7af:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7b4:	e8 87 fe ff ff       	call   640 <printint>
+        ap++;
+ 7b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7bf:	31 d2                	xor    %edx,%edx
+ 7c1:	e9 67 ff ff ff       	jmp    72d <printf+0x4d>
+ 7c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7d5:	83 c0 04             	add    $0x4,%eax
+ 7d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7db:	85 db                	test   %ebx,%ebx
+ 7dd:	0f 84 9d 00 00 00    	je     880 <printf+0x1a0>
+        while(*s != 0){
+ 7e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7e8:	84 c0                	test   %al,%al
+ 7ea:	0f 84 3d ff ff ff    	je     72d <printf+0x4d>
+ 7f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 7f6:	89 de                	mov    %ebx,%esi
+ 7f8:	89 d3                	mov    %edx,%ebx
+ 7fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 806:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 809:	6a 01                	push   $0x1
+ 80b:	53                   	push   %ebx
+ 80c:	57                   	push   %edi
+ 80d:	e8 3e fd ff ff       	call   550 <write>
+        while(*s != 0){
+ 812:	0f b6 06             	movzbl (%esi),%eax
+ 815:	83 c4 10             	add    $0x10,%esp
+ 818:	84 c0                	test   %al,%al
+ 81a:	75 e4                	jne    800 <printf+0x120>
+      state = 0;
+ 81c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 81f:	31 d2                	xor    %edx,%edx
+ 821:	e9 07 ff ff ff       	jmp    72d <printf+0x4d>
+ 826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 830:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 833:	83 ec 0c             	sub    $0xc,%esp
+ 836:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 83b:	8b 13                	mov    (%ebx),%edx
+ 83d:	6a 01                	push   $0x1
+ 83f:	e9 6b ff ff ff       	jmp    7af <printf+0xcf>
+ 844:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 848:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 84b:	83 ec 04             	sub    $0x4,%esp
+ 84e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 851:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 853:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 856:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 859:	6a 01                	push   $0x1
+ 85b:	52                   	push   %edx
+ 85c:	57                   	push   %edi
+ 85d:	e8 ee fc ff ff       	call   550 <write>
+        ap++;
+ 862:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 865:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 868:	31 d2                	xor    %edx,%edx
+ 86a:	e9 be fe ff ff       	jmp    72d <printf+0x4d>
+ 86f:	90                   	nop
+  write(fd, &c, 1);
+ 870:	83 ec 04             	sub    $0x4,%esp
+ 873:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 876:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 879:	6a 01                	push   $0x1
+ 87b:	e9 11 ff ff ff       	jmp    791 <printf+0xb1>
+ 880:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 885:	bb 75 0a 00 00       	mov    $0xa75,%ebx
+ 88a:	e9 61 ff ff ff       	jmp    7f0 <printf+0x110>
+ 88f:	90                   	nop
+
+00000890 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 890:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 891:	a1 cc 0d 00 00       	mov    0xdcc,%eax
+{
+ 896:	89 e5                	mov    %esp,%ebp
+ 898:	57                   	push   %edi
+ 899:	56                   	push   %esi
+ 89a:	53                   	push   %ebx
+ 89b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 89e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8a8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8aa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8ac:	39 ca                	cmp    %ecx,%edx
+ 8ae:	73 30                	jae    8e0 <free+0x50>
+ 8b0:	39 c1                	cmp    %eax,%ecx
+ 8b2:	72 04                	jb     8b8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8b4:	39 c2                	cmp    %eax,%edx
+ 8b6:	72 f0                	jb     8a8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8b8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8bb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8be:	39 f8                	cmp    %edi,%eax
+ 8c0:	74 2e                	je     8f0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8c2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8c5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8c8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8cb:	39 f1                	cmp    %esi,%ecx
+ 8cd:	74 38                	je     907 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8cf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8d1:	5b                   	pop    %ebx
+  freep = p;
+ 8d2:	89 15 cc 0d 00 00    	mov    %edx,0xdcc
+}
+ 8d8:	5e                   	pop    %esi
+ 8d9:	5f                   	pop    %edi
+ 8da:	5d                   	pop    %ebp
+ 8db:	c3                   	ret
+ 8dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8e0:	39 c1                	cmp    %eax,%ecx
+ 8e2:	72 d0                	jb     8b4 <free+0x24>
+ 8e4:	eb c2                	jmp    8a8 <free+0x18>
+ 8e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ed:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 8f0:	03 70 04             	add    0x4(%eax),%esi
+ 8f3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8f6:	8b 02                	mov    (%edx),%eax
+ 8f8:	8b 00                	mov    (%eax),%eax
+ 8fa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 8fd:	8b 42 04             	mov    0x4(%edx),%eax
+ 900:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 903:	39 f1                	cmp    %esi,%ecx
+ 905:	75 c8                	jne    8cf <free+0x3f>
+    p->s.size += bp->s.size;
+ 907:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 90a:	89 15 cc 0d 00 00    	mov    %edx,0xdcc
+    p->s.size += bp->s.size;
+ 910:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 913:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 916:	89 0a                	mov    %ecx,(%edx)
+}
+ 918:	5b                   	pop    %ebx
+ 919:	5e                   	pop    %esi
+ 91a:	5f                   	pop    %edi
+ 91b:	5d                   	pop    %ebp
+ 91c:	c3                   	ret
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000920 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	57                   	push   %edi
+ 924:	56                   	push   %esi
+ 925:	53                   	push   %ebx
+ 926:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 929:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 92c:	8b 15 cc 0d 00 00    	mov    0xdcc,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 932:	8d 78 07             	lea    0x7(%eax),%edi
+ 935:	c1 ef 03             	shr    $0x3,%edi
+ 938:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 93b:	85 d2                	test   %edx,%edx
+ 93d:	0f 84 8d 00 00 00    	je     9d0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 943:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 945:	8b 48 04             	mov    0x4(%eax),%ecx
+ 948:	39 f9                	cmp    %edi,%ecx
+ 94a:	73 64                	jae    9b0 <malloc+0x90>
+  if(nu < 4096)
+ 94c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 951:	39 df                	cmp    %ebx,%edi
+ 953:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 956:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 95d:	eb 0a                	jmp    969 <malloc+0x49>
+ 95f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 960:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 962:	8b 48 04             	mov    0x4(%eax),%ecx
+ 965:	39 f9                	cmp    %edi,%ecx
+ 967:	73 47                	jae    9b0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 969:	89 c2                	mov    %eax,%edx
+ 96b:	39 05 cc 0d 00 00    	cmp    %eax,0xdcc
+ 971:	75 ed                	jne    960 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 973:	83 ec 0c             	sub    $0xc,%esp
+ 976:	56                   	push   %esi
+ 977:	e8 3c fc ff ff       	call   5b8 <sbrk>
+  if(p == (char*)-1)
+ 97c:	83 c4 10             	add    $0x10,%esp
+ 97f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 982:	74 1c                	je     9a0 <malloc+0x80>
+  hp->s.size = nu;
+ 984:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 987:	83 ec 0c             	sub    $0xc,%esp
+ 98a:	83 c0 08             	add    $0x8,%eax
+ 98d:	50                   	push   %eax
+ 98e:	e8 fd fe ff ff       	call   890 <free>
+  return freep;
+ 993:	8b 15 cc 0d 00 00    	mov    0xdcc,%edx
+      if((p = morecore(nunits)) == 0)
+ 999:	83 c4 10             	add    $0x10,%esp
+ 99c:	85 d2                	test   %edx,%edx
+ 99e:	75 c0                	jne    960 <malloc+0x40>
+        return 0;
+  }
+}
+ 9a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9a3:	31 c0                	xor    %eax,%eax
+}
+ 9a5:	5b                   	pop    %ebx
+ 9a6:	5e                   	pop    %esi
+ 9a7:	5f                   	pop    %edi
+ 9a8:	5d                   	pop    %ebp
+ 9a9:	c3                   	ret
+ 9aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9b0:	39 cf                	cmp    %ecx,%edi
+ 9b2:	74 4c                	je     a00 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9b4:	29 f9                	sub    %edi,%ecx
+ 9b6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9b9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9bc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9bf:	89 15 cc 0d 00 00    	mov    %edx,0xdcc
+}
+ 9c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9c8:	83 c0 08             	add    $0x8,%eax
+}
+ 9cb:	5b                   	pop    %ebx
+ 9cc:	5e                   	pop    %esi
+ 9cd:	5f                   	pop    %edi
+ 9ce:	5d                   	pop    %ebp
+ 9cf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9d0:	c7 05 cc 0d 00 00 d0 	movl   $0xdd0,0xdcc
+ 9d7:	0d 00 00 
+    base.s.size = 0;
+ 9da:	b8 d0 0d 00 00       	mov    $0xdd0,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9df:	c7 05 d0 0d 00 00 d0 	movl   $0xdd0,0xdd0
+ 9e6:	0d 00 00 
+    base.s.size = 0;
+ 9e9:	c7 05 d4 0d 00 00 00 	movl   $0x0,0xdd4
+ 9f0:	00 00 00 
+    if(p->s.size >= nunits){
+ 9f3:	e9 54 ff ff ff       	jmp    94c <malloc+0x2c>
+ 9f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a00:	8b 08                	mov    (%eax),%ecx
+ a02:	89 0a                	mov    %ecx,(%edx)
+ a04:	eb b9                	jmp    9bf <malloc+0x9f>
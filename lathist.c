@@ -0,0 +1,69 @@
+#include "types.h"
+#include "stat.h"
+#include "param.h"
+#include "sched.h"
+#include "user.h"
+
+// Print wakeup-to-run latency histograms kept by the scheduler.
+// Each line is "cpu level bucket count": count wakeups at that level
+// waited between 2^bucket and 2^(bucket+1) TSC cycles before running.
+// Usage:
+//   lathist        -> summed over all CPUs (cpu column is "all")
+//   lathist -c     -> one histogram per CPU
+//   lathist -z     -> print, then reset the counters
+// Flags can be combined, e.g. "lathist -c -z".
+
+static void
+print(char *cpu, int lvl, uint *h)
+{
+  int b;
+
+  for(b = 0; b < NLATBUCKET; b++)
+    if(h[b])
+      printf(1, "%s\t%d\t%d\t%d\n", cpu, lvl, b, h[b]);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct lathist *lh;
+  uint sum[NLATBUCKET];
+  char cpu[4];
+  int i, c, lvl, b, ncpu, percpu, reset;
+
+  percpu = reset = 0;
+  for(i = 1; i < argc; i++){
+    if(strcmp(argv[i], "-c") == 0)
+      percpu = 1;
+    else if(strcmp(argv[i], "-z") == 0)
+      reset = 1;
+    else {
+      printf(2, "Usage: lathist [-c] [-z]\n");
+      exit();
+    }
+  }
+
+  if((lh = malloc(sizeof(*lh))) == 0 || (ncpu = getlathist(lh, reset)) < 0){
+    printf(2, "lathist: cannot read histograms\n");
+    exit();
+  }
+
+  printf(1, "cpu\tlevel\tbucket\tcount\n");
+  for(lvl = 0; lvl < NMLFQ; lvl++){
+    if(percpu){
+      for(c = 0; c < ncpu; c++){
+        cpu[0] = '0' + c;
+        cpu[1] = 0;
+        print(cpu, lvl, lh->hist[c][lvl]);
+      }
+      continue;
+    }
+    memset(sum, 0, sizeof(sum));
+    for(c = 0; c < ncpu; c++)
+      for(b = 0; b < NLATBUCKET; b++)
+        sum[b] += lh->hist[c][lvl][b];
+    print("all", lvl, sum);
+  }
+  free(lh);
+  exit();
+}
@@ -0,0 +1,1318 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: mkdir files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(mkdir(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 64 03 00 00       	call   3a8 <mkdir>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 2f 08 00 00       	push   $0x82f
+  53:	6a 02                	push   $0x2
+  55:	e8 96 04 00 00       	call   4f0 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 de 02 00 00       	call   340 <exit>
+    printf(2, "Usage: mkdir files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 18 08 00 00       	push   $0x818
+  69:	6a 02                	push   $0x2
+  6b:	e8 80 04 00 00       	call   4f0 <printf>
+    exit();
+  70:	e8 cb 02 00 00       	call   340 <exit>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  80:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  81:	31 c0                	xor    %eax,%eax
+{
+  83:	89 e5                	mov    %esp,%ebp
+  85:	53                   	push   %ebx
+  86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  90:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  94:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  97:	83 c0 01             	add    $0x1,%eax
+  9a:	84 d2                	test   %dl,%dl
+  9c:	75 f2                	jne    90 <strcpy+0x10>
+    ;
+  return os;
+}
+  9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a1:	89 c8                	mov    %ecx,%eax
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	53                   	push   %ebx
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ba:	0f b6 02             	movzbl (%edx),%eax
+  bd:	84 c0                	test   %al,%al
+  bf:	75 17                	jne    d8 <strcmp+0x28>
+  c1:	eb 3a                	jmp    fd <strcmp+0x4d>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  cc:	83 c2 01             	add    $0x1,%edx
+  cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  d2:	84 c0                	test   %al,%al
+  d4:	74 1a                	je     f0 <strcmp+0x40>
+    p++, q++;
+  d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  d8:	0f b6 19             	movzbl (%ecx),%ebx
+  db:	38 c3                	cmp    %al,%bl
+  dd:	74 e9                	je     c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  df:	29 d8                	sub    %ebx,%eax
+}
+  e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  f4:	31 c0                	xor    %eax,%eax
+  f6:	29 d8                	sub    %ebx,%eax
+}
+  f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  fb:	c9                   	leave
+  fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 100:	31 c0                	xor    %eax,%eax
+ 102:	eb db                	jmp    df <strcmp+0x2f>
+ 104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+
+00000110 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 116:	80 3a 00             	cmpb   $0x0,(%edx)
+ 119:	74 15                	je     130 <strlen+0x20>
+ 11b:	31 c0                	xor    %eax,%eax
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+ 120:	83 c0 01             	add    $0x1,%eax
+ 123:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 127:	89 c1                	mov    %eax,%ecx
+ 129:	75 f5                	jne    120 <strlen+0x10>
+    ;
+  return n;
+}
+ 12b:	89 c8                	mov    %ecx,%eax
+ 12d:	5d                   	pop    %ebp
+ 12e:	c3                   	ret
+ 12f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 130:	31 c9                	xor    %ecx,%ecx
+}
+ 132:	5d                   	pop    %ebp
+ 133:	89 c8                	mov    %ecx,%eax
+ 135:	c3                   	ret
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000140 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 147:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 14a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14d:	89 d7                	mov    %edx,%edi
+ 14f:	fc                   	cld
+ 150:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 152:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 155:	89 d0                	mov    %edx,%eax
+ 157:	c9                   	leave
+ 158:	c3                   	ret
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 16a:	0f b6 10             	movzbl (%eax),%edx
+ 16d:	84 d2                	test   %dl,%dl
+ 16f:	75 12                	jne    183 <strchr+0x23>
+ 171:	eb 1d                	jmp    190 <strchr+0x30>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 17c:	83 c0 01             	add    $0x1,%eax
+ 17f:	84 d2                	test   %dl,%dl
+ 181:	74 0d                	je     190 <strchr+0x30>
+    if(*s == c)
+ 183:	38 d1                	cmp    %dl,%cl
+ 185:	75 f1                	jne    178 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 187:	5d                   	pop    %ebp
+ 188:	c3                   	ret
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 190:	31 c0                	xor    %eax,%eax
+}
+ 192:	5d                   	pop    %ebp
+ 193:	c3                   	ret
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1a9:	31 db                	xor    %ebx,%ebx
+{
+ 1ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ae:	eb 27                	jmp    1d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1b0:	83 ec 04             	sub    $0x4,%esp
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	56                   	push   %esi
+ 1b6:	6a 00                	push   $0x0
+ 1b8:	e8 9b 01 00 00       	call   358 <read>
+    if(cc < 1)
+ 1bd:	83 c4 10             	add    $0x10,%esp
+ 1c0:	85 c0                	test   %eax,%eax
+ 1c2:	7e 1d                	jle    1e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1cf:	3c 0a                	cmp    $0xa,%al
+ 1d1:	74 10                	je     1e3 <gets+0x43>
+ 1d3:	3c 0d                	cmp    $0xd,%al
+ 1d5:	74 0c                	je     1e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1d7:	89 df                	mov    %ebx,%edi
+ 1d9:	83 c3 01             	add    $0x1,%ebx
+ 1dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1df:	7c cf                	jl     1b0 <gets+0x10>
+ 1e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ed:	5b                   	pop    %ebx
+ 1ee:	5e                   	pop    %esi
+ 1ef:	5f                   	pop    %edi
+ 1f0:	5d                   	pop    %ebp
+ 1f1:	c3                   	ret
+ 1f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	56                   	push   %esi
+ 204:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 205:	83 ec 08             	sub    $0x8,%esp
+ 208:	6a 00                	push   $0x0
+ 20a:	ff 75 08             	push   0x8(%ebp)
+ 20d:	e8 6e 01 00 00       	call   380 <open>
+  if(fd < 0)
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	85 c0                	test   %eax,%eax
+ 217:	78 27                	js     240 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 219:	83 ec 08             	sub    $0x8,%esp
+ 21c:	ff 75 0c             	push   0xc(%ebp)
+ 21f:	89 c3                	mov    %eax,%ebx
+ 221:	50                   	push   %eax
+ 222:	e8 71 01 00 00       	call   398 <fstat>
+  close(fd);
+ 227:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 22a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 22c:	e8 37 01 00 00       	call   368 <close>
+  return r;
+ 231:	83 c4 10             	add    $0x10,%esp
+}
+ 234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 237:	89 f0                	mov    %esi,%eax
+ 239:	5b                   	pop    %ebx
+ 23a:	5e                   	pop    %esi
+ 23b:	5d                   	pop    %ebp
+ 23c:	c3                   	ret
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 245:	eb ed                	jmp    234 <stat+0x34>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 257:	0f be 02             	movsbl (%edx),%eax
+ 25a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 25d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 265:	77 1e                	ja     285 <atoi+0x35>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 270:	83 c2 01             	add    $0x1,%edx
+ 273:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 276:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 27a:	0f be 02             	movsbl (%edx),%eax
+ 27d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 280:	80 fb 09             	cmp    $0x9,%bl
+ 283:	76 eb                	jbe    270 <atoi+0x20>
+  return n;
+}
+ 285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 288:	89 c8                	mov    %ecx,%eax
+ 28a:	c9                   	leave
+ 28b:	c3                   	ret
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	8b 45 10             	mov    0x10(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	7e 13                	jle    2b5 <memmove+0x25>
+ 2a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2a4:	89 d7                	mov    %edx,%edi
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2b1:	39 f8                	cmp    %edi,%eax
+ 2b3:	75 fb                	jne    2b0 <memmove+0x20>
+  return vdst;
+}
+ 2b5:	5e                   	pop    %esi
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	5f                   	pop    %edi
+ 2b9:	5d                   	pop    %ebp
+ 2ba:	c3                   	ret
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <mutex_lock>:
+
+// Take and release m with atomic instructions, and enter the kernel
+// only to block while it is held or to wake a blocked thread.
+void
+mutex_lock(struct mutex *m)
+{
+ 2c0:	55                   	push   %ebp
+  uint s;
+
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 2c1:	31 c0                	xor    %eax,%eax
+ 2c3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 2c8:	89 e5                	mov    %esp,%ebp
+ 2ca:	56                   	push   %esi
+ 2cb:	53                   	push   %ebx
+ 2cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 2cf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 2d3:	85 c0                	test   %eax,%eax
+ 2d5:	74 30                	je     307 <mutex_lock+0x47>
+    return;
+  // Contended: mark it so the holder knows to wake us.
+  if(s != 2)
+ 2d7:	83 f8 02             	cmp    $0x2,%eax
+ 2da:	74 0c                	je     2e8 <mutex_lock+0x28>
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 2dc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2e1:	f0 87 03             	lock xchg %eax,(%ebx)
+    s = xchg(&m->state, 2);
+  while(s != 0){
+ 2e4:	85 c0                	test   %eax,%eax
+ 2e6:	74 1f                	je     307 <mutex_lock+0x47>
+ 2e8:	be 02 00 00 00       	mov    $0x2,%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+ 2f0:	83 ec 08             	sub    $0x8,%esp
+ 2f3:	6a 02                	push   $0x2
+ 2f5:	53                   	push   %ebx
+ 2f6:	e8 45 01 00 00       	call   440 <futex_wait>
+ 2fb:	89 f0                	mov    %esi,%eax
+ 2fd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(s != 0){
+ 300:	83 c4 10             	add    $0x10,%esp
+ 303:	85 c0                	test   %eax,%eax
+ 305:	75 e9                	jne    2f0 <mutex_lock+0x30>
+    s = xchg(&m->state, 2);
+  }
+}
+ 307:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 30a:	5b                   	pop    %ebx
+ 30b:	5e                   	pop    %esi
+ 30c:	5d                   	pop    %ebp
+ 30d:	c3                   	ret
+ 30e:	66 90                	xchg   %ax,%ax
+
+00000310 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 310:	55                   	push   %ebp
+ 311:	31 c0                	xor    %eax,%eax
+ 313:	89 e5                	mov    %esp,%ebp
+ 315:	83 ec 08             	sub    $0x8,%esp
+ 318:	8b 55 08             	mov    0x8(%ebp),%edx
+ 31b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 31e:	83 f8 02             	cmp    $0x2,%eax
+ 321:	74 05                	je     328 <mutex_unlock+0x18>
+    futex_wake(&m->state, 1);
+}
+ 323:	c9                   	leave
+ 324:	c3                   	ret
+ 325:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->state, 1);
+ 328:	83 ec 08             	sub    $0x8,%esp
+ 32b:	6a 01                	push   $0x1
+ 32d:	52                   	push   %edx
+ 32e:	e8 15 01 00 00       	call   448 <futex_wake>
+ 333:	83 c4 10             	add    $0x10,%esp
+}
+ 336:	c9                   	leave
+ 337:	c3                   	ret
+
+00000338 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 338:	b8 01 00 00 00       	mov    $0x1,%eax
+ 33d:	cd 40                	int    $0x40
+ 33f:	c3                   	ret
+
+00000340 <exit>:
+SYSCALL(exit)
+ 340:	b8 02 00 00 00       	mov    $0x2,%eax
+ 345:	cd 40                	int    $0x40
+ 347:	c3                   	ret
+
+00000348 <wait>:
+SYSCALL(wait)
+ 348:	b8 03 00 00 00       	mov    $0x3,%eax
+ 34d:	cd 40                	int    $0x40
+ 34f:	c3                   	ret
+
+00000350 <pipe>:
+SYSCALL(pipe)
+ 350:	b8 04 00 00 00       	mov    $0x4,%eax
+ 355:	cd 40                	int    $0x40
+ 357:	c3                   	ret
+
+00000358 <read>:
+SYSCALL(read)
+ 358:	b8 05 00 00 00       	mov    $0x5,%eax
+ 35d:	cd 40                	int    $0x40
+ 35f:	c3                   	ret
+
+00000360 <write>:
+SYSCALL(write)
+ 360:	b8 10 00 00 00       	mov    $0x10,%eax
+ 365:	cd 40                	int    $0x40
+ 367:	c3                   	ret
+
+00000368 <close>:
+SYSCALL(close)
+ 368:	b8 15 00 00 00       	mov    $0x15,%eax
+ 36d:	cd 40                	int    $0x40
+ 36f:	c3                   	ret
+
+00000370 <kill>:
+SYSCALL(kill)
+ 370:	b8 06 00 00 00       	mov    $0x6,%eax
+ 375:	cd 40                	int    $0x40
+ 377:	c3                   	ret
+
+00000378 <exec>:
+SYSCALL(exec)
+ 378:	b8 07 00 00 00       	mov    $0x7,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <open>:
+SYSCALL(open)
+ 380:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <mknod>:
+SYSCALL(mknod)
+ 388:	b8 11 00 00 00       	mov    $0x11,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <unlink>:
+SYSCALL(unlink)
+ 390:	b8 12 00 00 00       	mov    $0x12,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <fstat>:
+SYSCALL(fstat)
+ 398:	b8 08 00 00 00       	mov    $0x8,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <link>:
+SYSCALL(link)
+ 3a0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <mkdir>:
+SYSCALL(mkdir)
+ 3a8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <chdir>:
+SYSCALL(chdir)
+ 3b0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <dup>:
+SYSCALL(dup)
+ 3b8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <getpid>:
+SYSCALL(getpid)
+ 3c0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <sbrk>:
+SYSCALL(sbrk)
+ 3c8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <sleep>:
+SYSCALL(sleep)
+ 3d0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <uptime>:
+SYSCALL(uptime)
+ 3d8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <ps>:
+SYSCALL(ps)
+ 3e0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <getschedparams>:
+SYSCALL(getschedparams)
+ 3e8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <setschedparams>:
+SYSCALL(setschedparams)
+ 3f0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <getpinfo>:
+SYSCALL(getpinfo)
+ 3f8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <getlathist>:
+SYSCALL(getlathist)
+ 400:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <setpolicy>:
+SYSCALL(setpolicy)
+ 408:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <settickets>:
+SYSCALL(settickets)
+ 410:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <setaffinity>:
+SYSCALL(setaffinity)
+ 418:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <getaffinity>:
+SYSCALL(getaffinity)
+ 420:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <setrt>:
+SYSCALL(setrt)
+ 428:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <clone>:
+SYSCALL(clone)
+ 430:	b8 20 00 00 00       	mov    $0x20,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <join>:
+SYSCALL(join)
+ 438:	b8 21 00 00 00       	mov    $0x21,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <futex_wait>:
+SYSCALL(futex_wait)
+ 440:	b8 22 00 00 00       	mov    $0x22,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <futex_wake>:
+SYSCALL(futex_wake)
+ 448:	b8 23 00 00 00       	mov    $0x23,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	57                   	push   %edi
+ 454:	56                   	push   %esi
+ 455:	53                   	push   %ebx
+ 456:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 458:	89 d1                	mov    %edx,%ecx
+{
+ 45a:	83 ec 3c             	sub    $0x3c,%esp
+ 45d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 460:	85 d2                	test   %edx,%edx
+ 462:	0f 89 80 00 00 00    	jns    4e8 <printint+0x98>
+ 468:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 46c:	74 7a                	je     4e8 <printint+0x98>
+    x = -xx;
+ 46e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 470:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 475:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 478:	31 f6                	xor    %esi,%esi
+ 47a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 480:	89 c8                	mov    %ecx,%eax
+ 482:	31 d2                	xor    %edx,%edx
+ 484:	89 f7                	mov    %esi,%edi
+ 486:	f7 f3                	div    %ebx
+ 488:	8d 76 01             	lea    0x1(%esi),%esi
+ 48b:	0f b6 92 ac 08 00 00 	movzbl 0x8ac(%edx),%edx
+ 492:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 496:	89 ca                	mov    %ecx,%edx
+ 498:	89 c1                	mov    %eax,%ecx
+ 49a:	39 da                	cmp    %ebx,%edx
+ 49c:	73 e2                	jae    480 <printint+0x30>
+  if(neg)
+ 49e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 4a1:	85 c0                	test   %eax,%eax
+ 4a3:	74 07                	je     4ac <printint+0x5c>
+    buf[i++] = '-';
+ 4a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 4aa:	89 f7                	mov    %esi,%edi
+ 4ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 4af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 4b2:	01 df                	add    %ebx,%edi
+ 4b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 4b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 4bb:	83 ec 04             	sub    $0x4,%esp
+ 4be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 4c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 4c4:	6a 01                	push   $0x1
+ 4c6:	50                   	push   %eax
+ 4c7:	56                   	push   %esi
+ 4c8:	e8 93 fe ff ff       	call   360 <write>
+  while(--i >= 0)
+ 4cd:	89 f8                	mov    %edi,%eax
+ 4cf:	83 c4 10             	add    $0x10,%esp
+ 4d2:	83 ef 01             	sub    $0x1,%edi
+ 4d5:	39 d8                	cmp    %ebx,%eax
+ 4d7:	75 df                	jne    4b8 <printint+0x68>
+}
+ 4d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4dc:	5b                   	pop    %ebx
+ 4dd:	5e                   	pop    %esi
+ 4de:	5f                   	pop    %edi
+ 4df:	5d                   	pop    %ebp
+ 4e0:	c3                   	ret
+ 4e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 4e8:	31 c0                	xor    %eax,%eax
+ 4ea:	eb 89                	jmp    475 <printint+0x25>
+ 4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+ 4f5:	53                   	push   %ebx
+ 4f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 502:	83 c6 01             	add    $0x1,%esi
+ 505:	84 db                	test   %bl,%bl
+ 507:	74 67                	je     570 <printf+0x80>
+ 509:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 50c:	31 d2                	xor    %edx,%edx
+ 50e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 511:	eb 34                	jmp    547 <printf+0x57>
+ 513:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 517:	90                   	nop
+ 518:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 51b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 520:	83 f8 25             	cmp    $0x25,%eax
+ 523:	74 18                	je     53d <printf+0x4d>
+  write(fd, &c, 1);
+ 525:	83 ec 04             	sub    $0x4,%esp
+ 528:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 52b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 52e:	6a 01                	push   $0x1
+ 530:	50                   	push   %eax
+ 531:	57                   	push   %edi
+ 532:	e8 29 fe ff ff       	call   360 <write>
+ 537:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 53a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 53d:	0f b6 1e             	movzbl (%esi),%ebx
+ 540:	83 c6 01             	add    $0x1,%esi
+ 543:	84 db                	test   %bl,%bl
+ 545:	74 29                	je     570 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 547:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 54a:	85 d2                	test   %edx,%edx
+ 54c:	74 ca                	je     518 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 54e:	83 fa 25             	cmp    $0x25,%edx
+ 551:	75 ea                	jne    53d <printf+0x4d>
+      if(c == 'd'){
+ 553:	83 f8 25             	cmp    $0x25,%eax
+ 556:	0f 84 24 01 00 00    	je     680 <printf+0x190>
+ 55c:	83 e8 63             	sub    $0x63,%eax
+ 55f:	83 f8 15             	cmp    $0x15,%eax
+ 562:	77 1c                	ja     580 <printf+0x90>
+ 564:	ff 24 85 54 08 00 00 	jmp    *0x854(,%eax,4)
+ 56b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 56f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 570:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 573:	5b                   	pop    %ebx
+ 574:	5e                   	pop    %esi
+ 575:	5f                   	pop    %edi
+ 576:	5d                   	pop    %ebp
+ 577:	c3                   	ret
+ 578:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57f:	90                   	nop
+  write(fd, &c, 1);
+ 580:	83 ec 04             	sub    $0x4,%esp
+ 583:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 586:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 58a:	6a 01                	push   $0x1
+ 58c:	52                   	push   %edx
+ 58d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 590:	57                   	push   %edi
+ 591:	e8 ca fd ff ff       	call   360 <write>
+ 596:	83 c4 0c             	add    $0xc,%esp
+ 599:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 59c:	6a 01                	push   $0x1
+ 59e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 5a1:	52                   	push   %edx
+ 5a2:	57                   	push   %edi
+ 5a3:	e8 b8 fd ff ff       	call   360 <write>
+        putc(fd, c);
+ 5a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5ab:	31 d2                	xor    %edx,%edx
+ 5ad:	eb 8e                	jmp    53d <printf+0x4d>
+ 5af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 5b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5b3:	83 ec 0c             	sub    $0xc,%esp
+ 5b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 5bb:	8b 13                	mov    (%ebx),%edx
+ 5bd:	6a 00                	push   $0x0
+ 5bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 5c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 5c4:	e8 87 fe ff ff       	call   450 <printint>
+        ap++;
+ 5c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 5cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 5cf:	31 d2                	xor    %edx,%edx
+ 5d1:	e9 67 ff ff ff       	jmp    53d <printf+0x4d>
+ 5d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 5e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 5e5:	83 c0 04             	add    $0x4,%eax
+ 5e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 5eb:	85 db                	test   %ebx,%ebx
+ 5ed:	0f 84 9d 00 00 00    	je     690 <printf+0x1a0>
+        while(*s != 0){
+ 5f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5f8:	84 c0                	test   %al,%al
+ 5fa:	0f 84 3d ff ff ff    	je     53d <printf+0x4d>
+ 600:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 603:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 606:	89 de                	mov    %ebx,%esi
+ 608:	89 d3                	mov    %edx,%ebx
+ 60a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 610:	83 ec 04             	sub    $0x4,%esp
+ 613:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 616:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 619:	6a 01                	push   $0x1
+ 61b:	53                   	push   %ebx
+ 61c:	57                   	push   %edi
+ 61d:	e8 3e fd ff ff       	call   360 <write>
+        while(*s != 0){
+ 622:	0f b6 06             	movzbl (%esi),%eax
+ 625:	83 c4 10             	add    $0x10,%esp
+ 628:	84 c0                	test   %al,%al
+ 62a:	75 e4                	jne    610 <printf+0x120>
+      state = 0;
+ 62c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 62f:	31 d2                	xor    %edx,%edx
+ 631:	e9 07 ff ff ff       	jmp    53d <printf+0x4d>
+ 636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 640:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 643:	83 ec 0c             	sub    $0xc,%esp
+ 646:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 64b:	8b 13                	mov    (%ebx),%edx
+ 64d:	6a 01                	push   $0x1
+ 64f:	e9 6b ff ff ff       	jmp    5bf <printf+0xcf>
+ 654:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 658:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 65b:	83 ec 04             	sub    $0x4,%esp
+ 65e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 661:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 663:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 666:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 669:	6a 01                	push   $0x1
+ 66b:	52                   	push   %edx
+ 66c:	57                   	push   %edi
+ 66d:	e8 ee fc ff ff       	call   360 <write>
+        ap++;
+ 672:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 675:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 678:	31 d2                	xor    %edx,%edx
+ 67a:	e9 be fe ff ff       	jmp    53d <printf+0x4d>
+ 67f:	90                   	nop
+  write(fd, &c, 1);
+ 680:	83 ec 04             	sub    $0x4,%esp
+ 683:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 686:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 689:	6a 01                	push   $0x1
+ 68b:	e9 11 ff ff ff       	jmp    5a1 <printf+0xb1>
+ 690:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 695:	bb 4b 08 00 00       	mov    $0x84b,%ebx
+ 69a:	e9 61 ff ff ff       	jmp    600 <printf+0x110>
+ 69f:	90                   	nop
+
+000006a0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6a1:	a1 a8 0b 00 00       	mov    0xba8,%eax
+{
+ 6a6:	89 e5                	mov    %esp,%ebp
+ 6a8:	57                   	push   %edi
+ 6a9:	56                   	push   %esi
+ 6aa:	53                   	push   %ebx
+ 6ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 6ae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6b8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6ba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6bc:	39 ca                	cmp    %ecx,%edx
+ 6be:	73 30                	jae    6f0 <free+0x50>
+ 6c0:	39 c1                	cmp    %eax,%ecx
+ 6c2:	72 04                	jb     6c8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6c4:	39 c2                	cmp    %eax,%edx
+ 6c6:	72 f0                	jb     6b8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6c8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 6cb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 6ce:	39 f8                	cmp    %edi,%eax
+ 6d0:	74 2e                	je     700 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6d2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 6d5:	8b 42 04             	mov    0x4(%edx),%eax
+ 6d8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6db:	39 f1                	cmp    %esi,%ecx
+ 6dd:	74 38                	je     717 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 6df:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 6e1:	5b                   	pop    %ebx
+  freep = p;
+ 6e2:	89 15 a8 0b 00 00    	mov    %edx,0xba8
+}
+ 6e8:	5e                   	pop    %esi
+ 6e9:	5f                   	pop    %edi
+ 6ea:	5d                   	pop    %ebp
+ 6eb:	c3                   	ret
+ 6ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6f0:	39 c1                	cmp    %eax,%ecx
+ 6f2:	72 d0                	jb     6c4 <free+0x24>
+ 6f4:	eb c2                	jmp    6b8 <free+0x18>
+ 6f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6fd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 700:	03 70 04             	add    0x4(%eax),%esi
+ 703:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 706:	8b 02                	mov    (%edx),%eax
+ 708:	8b 00                	mov    (%eax),%eax
+ 70a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 70d:	8b 42 04             	mov    0x4(%edx),%eax
+ 710:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 713:	39 f1                	cmp    %esi,%ecx
+ 715:	75 c8                	jne    6df <free+0x3f>
+    p->s.size += bp->s.size;
+ 717:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 71a:	89 15 a8 0b 00 00    	mov    %edx,0xba8
+    p->s.size += bp->s.size;
+ 720:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 723:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 726:	89 0a                	mov    %ecx,(%edx)
+}
+ 728:	5b                   	pop    %ebx
+ 729:	5e                   	pop    %esi
+ 72a:	5f                   	pop    %edi
+ 72b:	5d                   	pop    %ebp
+ 72c:	c3                   	ret
+ 72d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000730 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	57                   	push   %edi
+ 734:	56                   	push   %esi
+ 735:	53                   	push   %ebx
+ 736:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 739:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 73c:	8b 15 a8 0b 00 00    	mov    0xba8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 742:	8d 78 07             	lea    0x7(%eax),%edi
+ 745:	c1 ef 03             	shr    $0x3,%edi
+ 748:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 74b:	85 d2                	test   %edx,%edx
+ 74d:	0f 84 8d 00 00 00    	je     7e0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 753:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 755:	8b 48 04             	mov    0x4(%eax),%ecx
+ 758:	39 f9                	cmp    %edi,%ecx
+ 75a:	73 64                	jae    7c0 <malloc+0x90>
+  if(nu < 4096)
+ 75c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 761:	39 df                	cmp    %ebx,%edi
+ 763:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 766:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 76d:	eb 0a                	jmp    779 <malloc+0x49>
+ 76f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 770:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 772:	8b 48 04             	mov    0x4(%eax),%ecx
+ 775:	39 f9                	cmp    %edi,%ecx
+ 777:	73 47                	jae    7c0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 779:	89 c2                	mov    %eax,%edx
+ 77b:	39 05 a8 0b 00 00    	cmp    %eax,0xba8
+ 781:	75 ed                	jne    770 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 783:	83 ec 0c             	sub    $0xc,%esp
+ 786:	56                   	push   %esi
+ 787:	e8 3c fc ff ff       	call   3c8 <sbrk>
+  if(p == (char*)-1)
+ 78c:	83 c4 10             	add    $0x10,%esp
+ 78f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 792:	74 1c                	je     7b0 <malloc+0x80>
+  hp->s.size = nu;
+ 794:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 797:	83 ec 0c             	sub    $0xc,%esp
+ 79a:	83 c0 08             	add    $0x8,%eax
+ 79d:	50                   	push   %eax
+ 79e:	e8 fd fe ff ff       	call   6a0 <free>
+  return freep;
+ 7a3:	8b 15 a8 0b 00 00    	mov    0xba8,%edx
+      if((p = morecore(nunits)) == 0)
+ 7a9:	83 c4 10             	add    $0x10,%esp
+ 7ac:	85 d2                	test   %edx,%edx
+ 7ae:	75 c0                	jne    770 <malloc+0x40>
+        return 0;
+  }
+}
+ 7b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 7b3:	31 c0                	xor    %eax,%eax
+}
+ 7b5:	5b                   	pop    %ebx
+ 7b6:	5e                   	pop    %esi
+ 7b7:	5f                   	pop    %edi
+ 7b8:	5d                   	pop    %ebp
+ 7b9:	c3                   	ret
+ 7ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 7c0:	39 cf                	cmp    %ecx,%edi
+ 7c2:	74 4c                	je     810 <malloc+0xe0>
+        p->s.size -= nunits;
+ 7c4:	29 f9                	sub    %edi,%ecx
+ 7c6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 7c9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 7cc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 7cf:	89 15 a8 0b 00 00    	mov    %edx,0xba8
+}
+ 7d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 7d8:	83 c0 08             	add    $0x8,%eax
+}
+ 7db:	5b                   	pop    %ebx
+ 7dc:	5e                   	pop    %esi
+ 7dd:	5f                   	pop    %edi
+ 7de:	5d                   	pop    %ebp
+ 7df:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 7e0:	c7 05 a8 0b 00 00 ac 	movl   $0xbac,0xba8
+ 7e7:	0b 00 00 
+    base.s.size = 0;
+ 7ea:	b8 ac 0b 00 00       	mov    $0xbac,%eax
+    base.s.ptr = freep = prevp = &base;
+ 7ef:	c7 05 ac 0b 00 00 ac 	movl   $0xbac,0xbac
+ 7f6:	0b 00 00 
+    base.s.size = 0;
+ 7f9:	c7 05 b0 0b 00 00 00 	movl   $0x0,0xbb0
+ 800:	00 00 00 
+    if(p->s.size >= nunits){
+ 803:	e9 54 ff ff ff       	jmp    75c <malloc+0x2c>
+ 808:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 810:	8b 08                	mov    (%eax),%ecx
+ 812:	89 0a                	mov    %ecx,(%edx)
+ 814:	eb b9                	jmp    7cf <malloc+0x9f>
@@ -0,0 +1,161 @@
+// Multi-level feedback queue scheduling policy.
+//
+// Each CPU's run queue has schedparams.nlevels levels.  A level is a
+// doubly linked list threaded through struct proc and bit i of
+// nonempty is set iff level i has a process on it, so enqueue,
+// dequeue and pick are all O(1).  A process that uses up the quantum
+// of its level drops one level; one that waits too long on a lower
+// level moves up one (mlfq_age()).
+// The generic half (placement, stealing, locking) is in proc.c.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "sched.h"
+
+// Live tuning, read on every tick.  Written only by setschedparams()
+// with every run queue locked.
+struct schedparams schedparams = {
+  .nlevels = 3,
+  .quantum = { 1, 2, 4, 8, 16, 32, 64, 128 },  // level i: 2^i ticks
+  .boost_ticks = 100,
+};
+
+static void
+mlfq_enqueue(struct cpu *c, struct proc *p)
+{
+  struct mlfq *q = &c->rq.mlfq;
+  int lvl;
+
+  lvl = sched_effprio(p);   // may be raised by sleeplock inheritance
+  if(lvl < 0) lvl = 0;
+  if(lvl >= schedparams.nlevels) lvl = schedparams.nlevels - 1;
+
+  p->rqnext = 0;
+  p->rqprev = q->tail[lvl];
+  if(q->tail[lvl])
+    q->tail[lvl]->rqnext = p;
+  else
+    q->head[lvl] = p;
+  q->tail[lvl] = p;
+  q->nonempty |= 1 << lvl;
+  p->rqlevel = lvl;
+}
+
+static void
+mlfq_dequeue(struct proc *p)
+{
+  struct mlfq *q = &cpus[p->rqcpu].rq.mlfq;
+  int lvl = p->rqlevel;
+
+  if(p->rqprev)
+    p->rqprev->rqnext = p->rqnext;
+  else
+    q->head[lvl] = p->rqnext;
+  if(p->rqnext)
+    p->rqnext->rqprev = p->rqprev;
+  else
+    q->tail[lvl] = p->rqprev;
+  if(q->head[lvl] == 0)
+    q->nonempty &= ~(1 << lvl);
+  p->rqnext = p->rqprev = 0;
+}
+
+// Head of the highest non-empty level.
+static struct proc*
+mlfq_pick(struct cpu *c)
+{
+  struct mlfq *q = &c->rq.mlfq;
+
+  if(q->nonempty == 0)
+    return 0;
+  return q->head[__builtin_ctz(q->nonempty)];
+}
+
+// Allotment of level lvl in TSC cycles.
+static uint64
+allotment(int lvl)
+{
+  return (uint64)schedparams.quantum[lvl] * tsc_per_tick;
+}
+
+// Cycles p has used at its level, including the current run.
+static uint64
+used(struct proc *p)
+{
+  return p->allot + (rdtsc() - p->runstart);
+}
+
+// hết quantum -> yield; mlfq_charge() does the demotion
+static int
+mlfq_tick(struct proc *p)
+{
+  return used(p) >= allotment(p->priority);
+}
+
+// Ticks left in p's allotment, rounded up.
+static int
+mlfq_slice(struct proc *p)
+{
+  uint64 u = used(p), a = allotment(p->priority);
+
+  if(u >= a)
+    return 1;
+  if((a - u) >> 32)
+    return schedparams.quantum[p->priority];
+  return (uint)(a - u) / tsc_per_tick + 1;
+}
+
+// p left the CPU after running cycles.  The allotment is kept across
+// sleeps and yields, so giving the CPU back just before the quantum
+// ends no longer keeps a process on its level.
+static void
+mlfq_charge(struct proc *p, uint64 cycles)
+{
+  p->allot += cycles;
+  if(p->allot < allotment(p->priority))
+    return;
+  p->allot = 0;
+  if(p->priority < schedparams.nlevels - 1){
+    p->priority++;
+    p->ndemote++;
+  }
+}
+
+// Aging (chống starvation): the head of a level has waited longest on
+// it, so only heads need a look.  Raise the first one that has been
+// runnable for boost_ticks by one level and return it for requeueing.
+static struct proc*
+mlfq_age(struct cpu *c)
+{
+  struct mlfq *q = &c->rq.mlfq;
+  struct proc *p;
+  int lvl;
+
+  for(lvl = 1; lvl < schedparams.nlevels; lvl++){
+    p = q->head[lvl];
+    if(p == 0 || ticks - p->queuedat < schedparams.boost_ticks)
+      continue;
+    if(p->priority > 0)
+      p->priority--;
+    p->allot = 0;
+    p->nboost++;
+    return p;
+  }
+  return 0;
+}
+
+struct sched_class mlfq_class = {
+  .name = "mlfq",
+  .enqueue = mlfq_enqueue,
+  .dequeue = mlfq_dequeue,
+  .pick = mlfq_pick,
+  .tick = mlfq_tick,
+  .slice = mlfq_slice,
+  .charge = mlfq_charge,
+  .age = mlfq_age,
+};
@@ -1,14 +1,20 @@
-#define NPROC        64  // maximum number of processes
-#define KSTACKSIZE 4096  // size of per-process kernel stack
+#define NPROC      1000  // maximum number of live processes
+#define NPIDHASH     64  // pid hash buckets (power of 2)
+#define KSTACKORDER   1  // kernel stacks are 2^this pages, from kalloc_pages()
+#define KSTACKSIZE (4096 << KSTACKORDER)  // size of per-process kernel stack
+#define KMAXORDER    10  // largest kalloc_pages() block is 2^this pages
 #define NCPU          8  // maximum number of CPUs
+#define NMLFQ         8  // maximum MLFQ levels (how many are active is tunable)
+#define NLATBUCKET   40  // log2 buckets in wakeup latency histograms
+#define TICKCOUNT 10000000 // LAPIC timer counts per clock tick
+#define NWAITQ       64  // sleep channel hash buckets (power of 2)
 #define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define NINODE       50  // free i-node cache entries kept for reuse
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
 #define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define FSSIZE       2000  // size of file system in blocks
 
@@ -0,0 +1,1457 @@
+
+_parsum:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 19                	mov    (%ecx),%ebx
+  16:	8b 71 04             	mov    0x4(%ecx),%esi
+  void *stacks[MAXTHREADS], *stack;
+  int i, start;
+
+  if(argc < 2 || (nthreads = atoi(argv[1])) < 1 || nthreads > MAXTHREADS){
+  19:	83 fb 01             	cmp    $0x1,%ebx
+  1c:	7e 1b                	jle    39 <main+0x39>
+  1e:	83 ec 0c             	sub    $0xc,%esp
+  21:	ff 76 04             	push   0x4(%esi)
+  24:	e8 57 03 00 00       	call   380 <atoi>
+  29:	83 c4 10             	add    $0x10,%esp
+  2c:	a3 3c 0d 00 00       	mov    %eax,0xd3c
+  31:	83 e8 01             	sub    $0x1,%eax
+  34:	83 f8 0f             	cmp    $0xf,%eax
+  37:	76 16                	jbe    4f <main+0x4f>
+    printf(2, "Usage: parsum <nthreads 1..%d> [n]\n", MAXTHREADS);
+  39:	83 ec 04             	sub    $0x4,%esp
+  3c:	6a 10                	push   $0x10
+  3e:	68 48 09 00 00       	push   $0x948
+  43:	6a 02                	push   $0x2
+  45:	e8 d6 05 00 00       	call   620 <printf>
+    exit();
+  4a:	e8 21 04 00 00       	call   470 <exit>
+  }
+  n = argc > 2 ? atoi(argv[2]) : 50000;
+  4f:	b8 50 c3 00 00       	mov    $0xc350,%eax
+  54:	83 fb 02             	cmp    $0x2,%ebx
+  57:	74 0e                	je     67 <main+0x67>
+  59:	83 ec 0c             	sub    $0xc,%esp
+  5c:	ff 76 08             	push   0x8(%esi)
+  5f:	e8 1c 03 00 00       	call   380 <atoi>
+  64:	83 c4 10             	add    $0x10,%esp
+  67:	a3 38 0d 00 00       	mov    %eax,0xd38
+
+  start = uptime();
+  6c:	e8 97 04 00 00       	call   508 <uptime>
+  for(i = 0; i < nthreads; i++){
+  71:	83 3d 3c 0d 00 00 00 	cmpl   $0x0,0xd3c
+  start = uptime();
+  78:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < nthreads; i++){
+  7a:	0f 8e 92 00 00 00    	jle    112 <main+0x112>
+  80:	31 db                	xor    %ebx,%ebx
+  82:	eb 24                	jmp    a8 <main+0xa8>
+  84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    // Only this thread calls malloc(), which is not thread-safe.
+    if((stacks[i] = malloc(PGSIZE)) == 0 ||
+       clone(worker, (void*)i, 0, stacks[i]) < 0){
+  88:	50                   	push   %eax
+  89:	6a 00                	push   $0x0
+  8b:	53                   	push   %ebx
+  8c:	68 50 01 00 00       	push   $0x150
+  91:	e8 ca 04 00 00       	call   560 <clone>
+    if((stacks[i] = malloc(PGSIZE)) == 0 ||
+  96:	83 c4 10             	add    $0x10,%esp
+  99:	85 c0                	test   %eax,%eax
+  9b:	78 1f                	js     bc <main+0xbc>
+  for(i = 0; i < nthreads; i++){
+  9d:	83 c3 01             	add    $0x1,%ebx
+  a0:	39 1d 3c 0d 00 00    	cmp    %ebx,0xd3c
+  a6:	7e 27                	jle    cf <main+0xcf>
+    if((stacks[i] = malloc(PGSIZE)) == 0 ||
+  a8:	83 ec 0c             	sub    $0xc,%esp
+  ab:	68 00 10 00 00       	push   $0x1000
+  b0:	e8 ab 07 00 00       	call   860 <malloc>
+  b5:	83 c4 10             	add    $0x10,%esp
+  b8:	85 c0                	test   %eax,%eax
+  ba:	75 cc                	jne    88 <main+0x88>
+      printf(2, "parsum: clone failed\n");
+  bc:	53                   	push   %ebx
+  bd:	53                   	push   %ebx
+  be:	68 95 09 00 00       	push   $0x995
+  c3:	6a 02                	push   $0x2
+  c5:	e8 56 05 00 00       	call   620 <printf>
+      exit();
+  ca:	e8 a1 03 00 00       	call   470 <exit>
+    }
+  }
+  for(i = 0; i < nthreads; i++){
+  cf:	31 db                	xor    %ebx,%ebx
+    if(join(&stack) < 0){
+  d1:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+  d4:	eb 11                	jmp    e7 <main+0xe7>
+      printf(2, "parsum: join failed\n");
+      exit();
+    }
+    free(stack);
+  d6:	83 ec 0c             	sub    $0xc,%esp
+  d9:	ff 75 e4             	push   -0x1c(%ebp)
+  for(i = 0; i < nthreads; i++){
+  dc:	83 c3 01             	add    $0x1,%ebx
+    free(stack);
+  df:	e8 ec 06 00 00       	call   7d0 <free>
+  for(i = 0; i < nthreads; i++){
+  e4:	83 c4 10             	add    $0x10,%esp
+  e7:	39 1d 3c 0d 00 00    	cmp    %ebx,0xd3c
+  ed:	7e 23                	jle    112 <main+0x112>
+    if(join(&stack) < 0){
+  ef:	83 ec 0c             	sub    $0xc,%esp
+  f2:	57                   	push   %edi
+  f3:	e8 70 04 00 00       	call   568 <join>
+  f8:	83 c4 10             	add    $0x10,%esp
+  fb:	85 c0                	test   %eax,%eax
+  fd:	79 d7                	jns    d6 <main+0xd6>
+      printf(2, "parsum: join failed\n");
+  ff:	51                   	push   %ecx
+ 100:	51                   	push   %ecx
+ 101:	68 ab 09 00 00       	push   $0x9ab
+ 106:	6a 02                	push   $0x2
+ 108:	e8 13 05 00 00       	call   620 <printf>
+      exit();
+ 10d:	e8 5e 03 00 00       	call   470 <exit>
+  }
+
+  printf(1, "parsum: threads %d n %d sum %d ticks %d\n",
+         nthreads, n, sum, uptime() - start);
+ 112:	e8 f1 03 00 00       	call   508 <uptime>
+  printf(1, "parsum: threads %d n %d sum %d ticks %d\n",
+ 117:	29 f0                	sub    %esi,%eax
+ 119:	52                   	push   %edx
+ 11a:	52                   	push   %edx
+ 11b:	50                   	push   %eax
+ 11c:	ff 35 40 0d 00 00    	push   0xd40
+ 122:	ff 35 38 0d 00 00    	push   0xd38
+ 128:	ff 35 3c 0d 00 00    	push   0xd3c
+ 12e:	68 6c 09 00 00       	push   $0x96c
+ 133:	6a 01                	push   $0x1
+ 135:	e8 e6 04 00 00       	call   620 <printf>
+  exit();
+ 13a:	83 c4 20             	add    $0x20,%esp
+ 13d:	e8 2e 03 00 00       	call   470 <exit>
+ 142:	66 90                	xchg   %ax,%ax
+ 144:	66 90                	xchg   %ax,%ax
+ 146:	66 90                	xchg   %ax,%ax
+ 148:	66 90                	xchg   %ax,%ax
+ 14a:	66 90                	xchg   %ax,%ax
+ 14c:	66 90                	xchg   %ax,%ax
+ 14e:	66 90                	xchg   %ax,%ax
+
+00000150 <worker>:
+{
+ 150:	55                   	push   %ebp
+  int lo = n / nthreads * id;
+ 151:	8b 0d 38 0d 00 00    	mov    0xd38,%ecx
+ 157:	89 c8                	mov    %ecx,%eax
+{
+ 159:	89 e5                	mov    %esp,%ebp
+ 15b:	56                   	push   %esi
+  int lo = n / nthreads * id;
+ 15c:	99                   	cltd
+{
+ 15d:	53                   	push   %ebx
+  int lo = n / nthreads * id;
+ 15e:	8b 1d 3c 0d 00 00    	mov    0xd3c,%ebx
+{
+ 164:	8b 75 08             	mov    0x8(%ebp),%esi
+  int lo = n / nthreads * id;
+ 167:	f7 fb                	idiv   %ebx
+  int hi = id == nthreads - 1 ? n : lo + n / nthreads;
+ 169:	83 eb 01             	sub    $0x1,%ebx
+  int lo = n / nthreads * id;
+ 16c:	89 c2                	mov    %eax,%edx
+ 16e:	0f af d6             	imul   %esi,%edx
+  int hi = id == nthreads - 1 ? n : lo + n / nthreads;
+ 171:	01 d0                	add    %edx,%eax
+ 173:	39 de                	cmp    %ebx,%esi
+ 175:	0f 45 c8             	cmovne %eax,%ecx
+  uint s = 0;
+ 178:	31 db                	xor    %ebx,%ebx
+  for(int i = lo; i < hi; i++)
+ 17a:	39 d1                	cmp    %edx,%ecx
+ 17c:	7e 0b                	jle    189 <worker+0x39>
+ 17e:	66 90                	xchg   %ax,%ax
+    s += i;
+ 180:	01 d3                	add    %edx,%ebx
+  for(int i = lo; i < hi; i++)
+ 182:	83 c2 01             	add    $0x1,%edx
+ 185:	39 d1                	cmp    %edx,%ecx
+ 187:	75 f7                	jne    180 <worker+0x30>
+  mutex_lock(&lock);
+ 189:	83 ec 0c             	sub    $0xc,%esp
+ 18c:	68 44 0d 00 00       	push   $0xd44
+ 191:	e8 5a 02 00 00       	call   3f0 <mutex_lock>
+  mutex_unlock(&lock);
+ 196:	c7 04 24 44 0d 00 00 	movl   $0xd44,(%esp)
+  sum += s;
+ 19d:	01 1d 40 0d 00 00    	add    %ebx,0xd40
+  mutex_unlock(&lock);
+ 1a3:	e8 98 02 00 00       	call   440 <mutex_unlock>
+  exit();
+ 1a8:	e8 c3 02 00 00       	call   470 <exit>
+ 1ad:	66 90                	xchg   %ax,%ax
+ 1af:	90                   	nop
+
+000001b0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1b0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1b1:	31 c0                	xor    %eax,%eax
+{
+ 1b3:	89 e5                	mov    %esp,%ebp
+ 1b5:	53                   	push   %ebx
+ 1b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1c7:	83 c0 01             	add    $0x1,%eax
+ 1ca:	84 d2                	test   %dl,%dl
+ 1cc:	75 f2                	jne    1c0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1d1:	89 c8                	mov    %ecx,%eax
+ 1d3:	c9                   	leave
+ 1d4:	c3                   	ret
+ 1d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	53                   	push   %ebx
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1ea:	0f b6 02             	movzbl (%edx),%eax
+ 1ed:	84 c0                	test   %al,%al
+ 1ef:	75 17                	jne    208 <strcmp+0x28>
+ 1f1:	eb 3a                	jmp    22d <strcmp+0x4d>
+ 1f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1f7:	90                   	nop
+ 1f8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1fc:	83 c2 01             	add    $0x1,%edx
+ 1ff:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 202:	84 c0                	test   %al,%al
+ 204:	74 1a                	je     220 <strcmp+0x40>
+    p++, q++;
+ 206:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 208:	0f b6 19             	movzbl (%ecx),%ebx
+ 20b:	38 c3                	cmp    %al,%bl
+ 20d:	74 e9                	je     1f8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 20f:	29 d8                	sub    %ebx,%eax
+}
+ 211:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 214:	c9                   	leave
+ 215:	c3                   	ret
+ 216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 220:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 224:	31 c0                	xor    %eax,%eax
+ 226:	29 d8                	sub    %ebx,%eax
+}
+ 228:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 22b:	c9                   	leave
+ 22c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 22d:	0f b6 19             	movzbl (%ecx),%ebx
+ 230:	31 c0                	xor    %eax,%eax
+ 232:	eb db                	jmp    20f <strcmp+0x2f>
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 246:	80 3a 00             	cmpb   $0x0,(%edx)
+ 249:	74 15                	je     260 <strlen+0x20>
+ 24b:	31 c0                	xor    %eax,%eax
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+ 250:	83 c0 01             	add    $0x1,%eax
+ 253:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 257:	89 c1                	mov    %eax,%ecx
+ 259:	75 f5                	jne    250 <strlen+0x10>
+    ;
+  return n;
+}
+ 25b:	89 c8                	mov    %ecx,%eax
+ 25d:	5d                   	pop    %ebp
+ 25e:	c3                   	ret
+ 25f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 260:	31 c9                	xor    %ecx,%ecx
+}
+ 262:	5d                   	pop    %ebp
+ 263:	89 c8                	mov    %ecx,%eax
+ 265:	c3                   	ret
+ 266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000270 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 277:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 27a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 27d:	89 d7                	mov    %edx,%edi
+ 27f:	fc                   	cld
+ 280:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 282:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 285:	89 d0                	mov    %edx,%eax
+ 287:	c9                   	leave
+ 288:	c3                   	ret
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	8b 45 08             	mov    0x8(%ebp),%eax
+ 296:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 29a:	0f b6 10             	movzbl (%eax),%edx
+ 29d:	84 d2                	test   %dl,%dl
+ 29f:	75 12                	jne    2b3 <strchr+0x23>
+ 2a1:	eb 1d                	jmp    2c0 <strchr+0x30>
+ 2a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2a7:	90                   	nop
+ 2a8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2ac:	83 c0 01             	add    $0x1,%eax
+ 2af:	84 d2                	test   %dl,%dl
+ 2b1:	74 0d                	je     2c0 <strchr+0x30>
+    if(*s == c)
+ 2b3:	38 d1                	cmp    %dl,%cl
+ 2b5:	75 f1                	jne    2a8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2b7:	5d                   	pop    %ebp
+ 2b8:	c3                   	ret
+ 2b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2c0:	31 c0                	xor    %eax,%eax
+}
+ 2c2:	5d                   	pop    %ebp
+ 2c3:	c3                   	ret
+ 2c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2cf:	90                   	nop
+
+000002d0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	57                   	push   %edi
+ 2d4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2d5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2d8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2d9:	31 db                	xor    %ebx,%ebx
+{
+ 2db:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2de:	eb 27                	jmp    307 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2e0:	83 ec 04             	sub    $0x4,%esp
+ 2e3:	6a 01                	push   $0x1
+ 2e5:	56                   	push   %esi
+ 2e6:	6a 00                	push   $0x0
+ 2e8:	e8 9b 01 00 00       	call   488 <read>
+    if(cc < 1)
+ 2ed:	83 c4 10             	add    $0x10,%esp
+ 2f0:	85 c0                	test   %eax,%eax
+ 2f2:	7e 1d                	jle    311 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2f4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2fb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2ff:	3c 0a                	cmp    $0xa,%al
+ 301:	74 10                	je     313 <gets+0x43>
+ 303:	3c 0d                	cmp    $0xd,%al
+ 305:	74 0c                	je     313 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 307:	89 df                	mov    %ebx,%edi
+ 309:	83 c3 01             	add    $0x1,%ebx
+ 30c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 30f:	7c cf                	jl     2e0 <gets+0x10>
+ 311:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 313:	8b 45 08             	mov    0x8(%ebp),%eax
+ 316:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 31a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 31d:	5b                   	pop    %ebx
+ 31e:	5e                   	pop    %esi
+ 31f:	5f                   	pop    %edi
+ 320:	5d                   	pop    %ebp
+ 321:	c3                   	ret
+ 322:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	56                   	push   %esi
+ 334:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 335:	83 ec 08             	sub    $0x8,%esp
+ 338:	6a 00                	push   $0x0
+ 33a:	ff 75 08             	push   0x8(%ebp)
+ 33d:	e8 6e 01 00 00       	call   4b0 <open>
+  if(fd < 0)
+ 342:	83 c4 10             	add    $0x10,%esp
+ 345:	85 c0                	test   %eax,%eax
+ 347:	78 27                	js     370 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 349:	83 ec 08             	sub    $0x8,%esp
+ 34c:	ff 75 0c             	push   0xc(%ebp)
+ 34f:	89 c3                	mov    %eax,%ebx
+ 351:	50                   	push   %eax
+ 352:	e8 71 01 00 00       	call   4c8 <fstat>
+  close(fd);
+ 357:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 35a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 35c:	e8 37 01 00 00       	call   498 <close>
+  return r;
+ 361:	83 c4 10             	add    $0x10,%esp
+}
+ 364:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 367:	89 f0                	mov    %esi,%eax
+ 369:	5b                   	pop    %ebx
+ 36a:	5e                   	pop    %esi
+ 36b:	5d                   	pop    %ebp
+ 36c:	c3                   	ret
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 370:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 375:	eb ed                	jmp    364 <stat+0x34>
+ 377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37e:	66 90                	xchg   %ax,%ax
+
+00000380 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	53                   	push   %ebx
+ 384:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 387:	0f be 02             	movsbl (%edx),%eax
+ 38a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 38d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 390:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 395:	77 1e                	ja     3b5 <atoi+0x35>
+ 397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3a0:	83 c2 01             	add    $0x1,%edx
+ 3a3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3a6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3aa:	0f be 02             	movsbl (%edx),%eax
+ 3ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3b0:	80 fb 09             	cmp    $0x9,%bl
+ 3b3:	76 eb                	jbe    3a0 <atoi+0x20>
+  return n;
+}
+ 3b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3b8:	89 c8                	mov    %ecx,%eax
+ 3ba:	c9                   	leave
+ 3bb:	c3                   	ret
+ 3bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003c0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	57                   	push   %edi
+ 3c4:	56                   	push   %esi
+ 3c5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3cb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ce:	85 c0                	test   %eax,%eax
+ 3d0:	7e 13                	jle    3e5 <memmove+0x25>
+ 3d2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3d4:	89 d7                	mov    %edx,%edi
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3e0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3e1:	39 f8                	cmp    %edi,%eax
+ 3e3:	75 fb                	jne    3e0 <memmove+0x20>
+  return vdst;
+}
+ 3e5:	5e                   	pop    %esi
+ 3e6:	89 d0                	mov    %edx,%eax
+ 3e8:	5f                   	pop    %edi
+ 3e9:	5d                   	pop    %ebp
+ 3ea:	c3                   	ret
+ 3eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ef:	90                   	nop
+
+000003f0 <mutex_lock>:
+
+// Take and release m with atomic instructions, and enter the kernel
+// only to block while it is held or to wake a blocked thread.
+void
+mutex_lock(struct mutex *m)
+{
+ 3f0:	55                   	push   %ebp
+  uint s;
+
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 3f1:	31 c0                	xor    %eax,%eax
+ 3f3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 3f8:	89 e5                	mov    %esp,%ebp
+ 3fa:	56                   	push   %esi
+ 3fb:	53                   	push   %ebx
+ 3fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 3ff:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 403:	85 c0                	test   %eax,%eax
+ 405:	74 30                	je     437 <mutex_lock+0x47>
+    return;
+  // Contended: mark it so the holder knows to wake us.
+  if(s != 2)
+ 407:	83 f8 02             	cmp    $0x2,%eax
+ 40a:	74 0c                	je     418 <mutex_lock+0x28>
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 40c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 411:	f0 87 03             	lock xchg %eax,(%ebx)
+    s = xchg(&m->state, 2);
+  while(s != 0){
+ 414:	85 c0                	test   %eax,%eax
+ 416:	74 1f                	je     437 <mutex_lock+0x47>
+ 418:	be 02 00 00 00       	mov    $0x2,%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+ 420:	83 ec 08             	sub    $0x8,%esp
+ 423:	6a 02                	push   $0x2
+ 425:	53                   	push   %ebx
+ 426:	e8 45 01 00 00       	call   570 <futex_wait>
+ 42b:	89 f0                	mov    %esi,%eax
+ 42d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(s != 0){
+ 430:	83 c4 10             	add    $0x10,%esp
+ 433:	85 c0                	test   %eax,%eax
+ 435:	75 e9                	jne    420 <mutex_lock+0x30>
+    s = xchg(&m->state, 2);
+  }
+}
+ 437:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 43a:	5b                   	pop    %ebx
+ 43b:	5e                   	pop    %esi
+ 43c:	5d                   	pop    %ebp
+ 43d:	c3                   	ret
+ 43e:	66 90                	xchg   %ax,%ax
+
+00000440 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 440:	55                   	push   %ebp
+ 441:	31 c0                	xor    %eax,%eax
+ 443:	89 e5                	mov    %esp,%ebp
+ 445:	83 ec 08             	sub    $0x8,%esp
+ 448:	8b 55 08             	mov    0x8(%ebp),%edx
+ 44b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 44e:	83 f8 02             	cmp    $0x2,%eax
+ 451:	74 05                	je     458 <mutex_unlock+0x18>
+    futex_wake(&m->state, 1);
+}
+ 453:	c9                   	leave
+ 454:	c3                   	ret
+ 455:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->state, 1);
+ 458:	83 ec 08             	sub    $0x8,%esp
+ 45b:	6a 01                	push   $0x1
+ 45d:	52                   	push   %edx
+ 45e:	e8 15 01 00 00       	call   578 <futex_wake>
+ 463:	83 c4 10             	add    $0x10,%esp
+}
+ 466:	c9                   	leave
+ 467:	c3                   	ret
+
+00000468 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 468:	b8 01 00 00 00       	mov    $0x1,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <exit>:
+SYSCALL(exit)
+ 470:	b8 02 00 00 00       	mov    $0x2,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <wait>:
+SYSCALL(wait)
+ 478:	b8 03 00 00 00       	mov    $0x3,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <pipe>:
+SYSCALL(pipe)
+ 480:	b8 04 00 00 00       	mov    $0x4,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <read>:
+SYSCALL(read)
+ 488:	b8 05 00 00 00       	mov    $0x5,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <write>:
+SYSCALL(write)
+ 490:	b8 10 00 00 00       	mov    $0x10,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <close>:
+SYSCALL(close)
+ 498:	b8 15 00 00 00       	mov    $0x15,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <kill>:
+SYSCALL(kill)
+ 4a0:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <exec>:
+SYSCALL(exec)
+ 4a8:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <open>:
+SYSCALL(open)
+ 4b0:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <mknod>:
+SYSCALL(mknod)
+ 4b8:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <unlink>:
+SYSCALL(unlink)
+ 4c0:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <fstat>:
+SYSCALL(fstat)
+ 4c8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <link>:
+SYSCALL(link)
+ 4d0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <mkdir>:
+SYSCALL(mkdir)
+ 4d8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <chdir>:
+SYSCALL(chdir)
+ 4e0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+
+000004e8 <dup>:
+SYSCALL(dup)
+ 4e8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4ed:	cd 40                	int    $0x40
+ 4ef:	c3                   	ret
+
+000004f0 <getpid>:
+SYSCALL(getpid)
+ 4f0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4f5:	cd 40                	int    $0x40
+ 4f7:	c3                   	ret
+
+000004f8 <sbrk>:
+SYSCALL(sbrk)
+ 4f8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4fd:	cd 40                	int    $0x40
+ 4ff:	c3                   	ret
+
+00000500 <sleep>:
+SYSCALL(sleep)
+ 500:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 505:	cd 40                	int    $0x40
+ 507:	c3                   	ret
+
+00000508 <uptime>:
+SYSCALL(uptime)
+ 508:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <ps>:
+SYSCALL(ps)
+ 510:	b8 16 00 00 00       	mov    $0x16,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <getschedparams>:
+SYSCALL(getschedparams)
+ 518:	b8 17 00 00 00       	mov    $0x17,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <setschedparams>:
+SYSCALL(setschedparams)
+ 520:	b8 18 00 00 00       	mov    $0x18,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <getpinfo>:
+SYSCALL(getpinfo)
+ 528:	b8 19 00 00 00       	mov    $0x19,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <getlathist>:
+SYSCALL(getlathist)
+ 530:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <setpolicy>:
+SYSCALL(setpolicy)
+ 538:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <settickets>:
+SYSCALL(settickets)
+ 540:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <setaffinity>:
+SYSCALL(setaffinity)
+ 548:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <getaffinity>:
+SYSCALL(getaffinity)
+ 550:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <setrt>:
+SYSCALL(setrt)
+ 558:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <clone>:
+SYSCALL(clone)
+ 560:	b8 20 00 00 00       	mov    $0x20,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <join>:
+SYSCALL(join)
+ 568:	b8 21 00 00 00       	mov    $0x21,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <futex_wait>:
+SYSCALL(futex_wait)
+ 570:	b8 22 00 00 00       	mov    $0x22,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <futex_wake>:
+SYSCALL(futex_wake)
+ 578:	b8 23 00 00 00       	mov    $0x23,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	53                   	push   %ebx
+ 586:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 588:	89 d1                	mov    %edx,%ecx
+{
+ 58a:	83 ec 3c             	sub    $0x3c,%esp
+ 58d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 590:	85 d2                	test   %edx,%edx
+ 592:	0f 89 80 00 00 00    	jns    618 <printint+0x98>
+ 598:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 59c:	74 7a                	je     618 <printint+0x98>
+    x = -xx;
+ 59e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5a8:	31 f6                	xor    %esi,%esi
+ 5aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5b0:	89 c8                	mov    %ecx,%eax
+ 5b2:	31 d2                	xor    %edx,%edx
+ 5b4:	89 f7                	mov    %esi,%edi
+ 5b6:	f7 f3                	div    %ebx
+ 5b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5bb:	0f b6 92 20 0a 00 00 	movzbl 0xa20(%edx),%edx
+ 5c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5c6:	89 ca                	mov    %ecx,%edx
+ 5c8:	89 c1                	mov    %eax,%ecx
+ 5ca:	39 da                	cmp    %ebx,%edx
+ 5cc:	73 e2                	jae    5b0 <printint+0x30>
+  if(neg)
+ 5ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5d1:	85 c0                	test   %eax,%eax
+ 5d3:	74 07                	je     5dc <printint+0x5c>
+    buf[i++] = '-';
+ 5d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5da:	89 f7                	mov    %esi,%edi
+ 5dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5e2:	01 df                	add    %ebx,%edi
+ 5e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5eb:	83 ec 04             	sub    $0x4,%esp
+ 5ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5f4:	6a 01                	push   $0x1
+ 5f6:	50                   	push   %eax
+ 5f7:	56                   	push   %esi
+ 5f8:	e8 93 fe ff ff       	call   490 <write>
+  while(--i >= 0)
+ 5fd:	89 f8                	mov    %edi,%eax
+ 5ff:	83 c4 10             	add    $0x10,%esp
+ 602:	83 ef 01             	sub    $0x1,%edi
+ 605:	39 d8                	cmp    %ebx,%eax
+ 607:	75 df                	jne    5e8 <printint+0x68>
+}
+ 609:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 60c:	5b                   	pop    %ebx
+ 60d:	5e                   	pop    %esi
+ 60e:	5f                   	pop    %edi
+ 60f:	5d                   	pop    %ebp
+ 610:	c3                   	ret
+ 611:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 618:	31 c0                	xor    %eax,%eax
+ 61a:	eb 89                	jmp    5a5 <printint+0x25>
+ 61c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	56                   	push   %esi
+ 625:	53                   	push   %ebx
+ 626:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 629:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 62c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 62f:	0f b6 1e             	movzbl (%esi),%ebx
+ 632:	83 c6 01             	add    $0x1,%esi
+ 635:	84 db                	test   %bl,%bl
+ 637:	74 67                	je     6a0 <printf+0x80>
+ 639:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 63c:	31 d2                	xor    %edx,%edx
+ 63e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 641:	eb 34                	jmp    677 <printf+0x57>
+ 643:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 647:	90                   	nop
+ 648:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 64b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 650:	83 f8 25             	cmp    $0x25,%eax
+ 653:	74 18                	je     66d <printf+0x4d>
+  write(fd, &c, 1);
+ 655:	83 ec 04             	sub    $0x4,%esp
+ 658:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 65b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 65e:	6a 01                	push   $0x1
+ 660:	50                   	push   %eax
+ 661:	57                   	push   %edi
+ 662:	e8 29 fe ff ff       	call   490 <write>
+ 667:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 66a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 66d:	0f b6 1e             	movzbl (%esi),%ebx
+ 670:	83 c6 01             	add    $0x1,%esi
+ 673:	84 db                	test   %bl,%bl
+ 675:	74 29                	je     6a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 677:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 67a:	85 d2                	test   %edx,%edx
+ 67c:	74 ca                	je     648 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 67e:	83 fa 25             	cmp    $0x25,%edx
+ 681:	75 ea                	jne    66d <printf+0x4d>
+      if(c == 'd'){
+ 683:	83 f8 25             	cmp    $0x25,%eax
+ 686:	0f 84 24 01 00 00    	je     7b0 <printf+0x190>
+ 68c:	83 e8 63             	sub    $0x63,%eax
+ 68f:	83 f8 15             	cmp    $0x15,%eax
+ 692:	77 1c                	ja     6b0 <printf+0x90>
+ 694:	ff 24 85 c8 09 00 00 	jmp    *0x9c8(,%eax,4)
+ 69b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 69f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6a3:	5b                   	pop    %ebx
+ 6a4:	5e                   	pop    %esi
+ 6a5:	5f                   	pop    %edi
+ 6a6:	5d                   	pop    %ebp
+ 6a7:	c3                   	ret
+ 6a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6af:	90                   	nop
+  write(fd, &c, 1);
+ 6b0:	83 ec 04             	sub    $0x4,%esp
+ 6b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ba:	6a 01                	push   $0x1
+ 6bc:	52                   	push   %edx
+ 6bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6c0:	57                   	push   %edi
+ 6c1:	e8 ca fd ff ff       	call   490 <write>
+ 6c6:	83 c4 0c             	add    $0xc,%esp
+ 6c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6cc:	6a 01                	push   $0x1
+ 6ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6d1:	52                   	push   %edx
+ 6d2:	57                   	push   %edi
+ 6d3:	e8 b8 fd ff ff       	call   490 <write>
+        putc(fd, c);
+ 6d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6db:	31 d2                	xor    %edx,%edx
+ 6dd:	eb 8e                	jmp    66d <printf+0x4d>
+ 6df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6e3:	83 ec 0c             	sub    $0xc,%esp
+ 6e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6eb:	8b 13                	mov    (%ebx),%edx
+ 6ed:	6a 00                	push   $0x0
+ 6ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6f4:	e8 87 fe ff ff       	call   580 <printint>
+        ap++;
+ 6f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ff:	31 d2                	xor    %edx,%edx
+ 701:	e9 67 ff ff ff       	jmp    66d <printf+0x4d>
+ 706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 710:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 713:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 715:	83 c0 04             	add    $0x4,%eax
+ 718:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 71b:	85 db                	test   %ebx,%ebx
+ 71d:	0f 84 9d 00 00 00    	je     7c0 <printf+0x1a0>
+        while(*s != 0){
+ 723:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 726:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 728:	84 c0                	test   %al,%al
+ 72a:	0f 84 3d ff ff ff    	je     66d <printf+0x4d>
+ 730:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 733:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 736:	89 de                	mov    %ebx,%esi
+ 738:	89 d3                	mov    %edx,%ebx
+ 73a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 740:	83 ec 04             	sub    $0x4,%esp
+ 743:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 746:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 749:	6a 01                	push   $0x1
+ 74b:	53                   	push   %ebx
+ 74c:	57                   	push   %edi
+ 74d:	e8 3e fd ff ff       	call   490 <write>
+        while(*s != 0){
+ 752:	0f b6 06             	movzbl (%esi),%eax
+ 755:	83 c4 10             	add    $0x10,%esp
+ 758:	84 c0                	test   %al,%al
+ 75a:	75 e4                	jne    740 <printf+0x120>
+      state = 0;
+ 75c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 75f:	31 d2                	xor    %edx,%edx
+ 761:	e9 07 ff ff ff       	jmp    66d <printf+0x4d>
+ 766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 770:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 773:	83 ec 0c             	sub    $0xc,%esp
+ 776:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 77b:	8b 13                	mov    (%ebx),%edx
+ 77d:	6a 01                	push   $0x1
+ 77f:	e9 6b ff ff ff       	jmp    6ef <printf+0xcf>
+ 784:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 788:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 78b:	83 ec 04             	sub    $0x4,%esp
+ 78e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 791:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 793:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 796:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 799:	6a 01                	push   $0x1
+ 79b:	52                   	push   %edx
+ 79c:	57                   	push   %edi
+ 79d:	e8 ee fc ff ff       	call   490 <write>
+        ap++;
+ 7a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7a8:	31 d2                	xor    %edx,%edx
+ 7aa:	e9 be fe ff ff       	jmp    66d <printf+0x4d>
+ 7af:	90                   	nop
+  write(fd, &c, 1);
+ 7b0:	83 ec 04             	sub    $0x4,%esp
+ 7b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7b9:	6a 01                	push   $0x1
+ 7bb:	e9 11 ff ff ff       	jmp    6d1 <printf+0xb1>
+ 7c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7c5:	bb c0 09 00 00       	mov    $0x9c0,%ebx
+ 7ca:	e9 61 ff ff ff       	jmp    730 <printf+0x110>
+ 7cf:	90                   	nop
+
+000007d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7d1:	a1 48 0d 00 00       	mov    0xd48,%eax
+{
+ 7d6:	89 e5                	mov    %esp,%ebp
+ 7d8:	57                   	push   %edi
+ 7d9:	56                   	push   %esi
+ 7da:	53                   	push   %ebx
+ 7db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7ec:	39 ca                	cmp    %ecx,%edx
+ 7ee:	73 30                	jae    820 <free+0x50>
+ 7f0:	39 c1                	cmp    %eax,%ecx
+ 7f2:	72 04                	jb     7f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7f4:	39 c2                	cmp    %eax,%edx
+ 7f6:	72 f0                	jb     7e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7fe:	39 f8                	cmp    %edi,%eax
+ 800:	74 2e                	je     830 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 802:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 805:	8b 42 04             	mov    0x4(%edx),%eax
+ 808:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 80b:	39 f1                	cmp    %esi,%ecx
+ 80d:	74 38                	je     847 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 80f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 811:	5b                   	pop    %ebx
+  freep = p;
+ 812:	89 15 48 0d 00 00    	mov    %edx,0xd48
+}
+ 818:	5e                   	pop    %esi
+ 819:	5f                   	pop    %edi
+ 81a:	5d                   	pop    %ebp
+ 81b:	c3                   	ret
+ 81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 820:	39 c1                	cmp    %eax,%ecx
+ 822:	72 d0                	jb     7f4 <free+0x24>
+ 824:	eb c2                	jmp    7e8 <free+0x18>
+ 826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 830:	03 70 04             	add    0x4(%eax),%esi
+ 833:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 836:	8b 02                	mov    (%edx),%eax
+ 838:	8b 00                	mov    (%eax),%eax
+ 83a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 83d:	8b 42 04             	mov    0x4(%edx),%eax
+ 840:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 843:	39 f1                	cmp    %esi,%ecx
+ 845:	75 c8                	jne    80f <free+0x3f>
+    p->s.size += bp->s.size;
+ 847:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 84a:	89 15 48 0d 00 00    	mov    %edx,0xd48
+    p->s.size += bp->s.size;
+ 850:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 853:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 856:	89 0a                	mov    %ecx,(%edx)
+}
+ 858:	5b                   	pop    %ebx
+ 859:	5e                   	pop    %esi
+ 85a:	5f                   	pop    %edi
+ 85b:	5d                   	pop    %ebp
+ 85c:	c3                   	ret
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000860 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 860:	55                   	push   %ebp
+ 861:	89 e5                	mov    %esp,%ebp
+ 863:	57                   	push   %edi
+ 864:	56                   	push   %esi
+ 865:	53                   	push   %ebx
+ 866:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 869:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 86c:	8b 15 48 0d 00 00    	mov    0xd48,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 872:	8d 78 07             	lea    0x7(%eax),%edi
+ 875:	c1 ef 03             	shr    $0x3,%edi
+ 878:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 87b:	85 d2                	test   %edx,%edx
+ 87d:	0f 84 8d 00 00 00    	je     910 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 883:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 885:	8b 48 04             	mov    0x4(%eax),%ecx
+ 888:	39 f9                	cmp    %edi,%ecx
+ 88a:	73 64                	jae    8f0 <malloc+0x90>
+  if(nu < 4096)
+ 88c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 891:	39 df                	cmp    %ebx,%edi
+ 893:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 896:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 89d:	eb 0a                	jmp    8a9 <malloc+0x49>
+ 89f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8a0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8a2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8a5:	39 f9                	cmp    %edi,%ecx
+ 8a7:	73 47                	jae    8f0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8a9:	89 c2                	mov    %eax,%edx
+ 8ab:	39 05 48 0d 00 00    	cmp    %eax,0xd48
+ 8b1:	75 ed                	jne    8a0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8b3:	83 ec 0c             	sub    $0xc,%esp
+ 8b6:	56                   	push   %esi
+ 8b7:	e8 3c fc ff ff       	call   4f8 <sbrk>
+  if(p == (char*)-1)
+ 8bc:	83 c4 10             	add    $0x10,%esp
+ 8bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8c2:	74 1c                	je     8e0 <malloc+0x80>
+  hp->s.size = nu;
+ 8c4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8c7:	83 ec 0c             	sub    $0xc,%esp
+ 8ca:	83 c0 08             	add    $0x8,%eax
+ 8cd:	50                   	push   %eax
+ 8ce:	e8 fd fe ff ff       	call   7d0 <free>
+  return freep;
+ 8d3:	8b 15 48 0d 00 00    	mov    0xd48,%edx
+      if((p = morecore(nunits)) == 0)
+ 8d9:	83 c4 10             	add    $0x10,%esp
+ 8dc:	85 d2                	test   %edx,%edx
+ 8de:	75 c0                	jne    8a0 <malloc+0x40>
+        return 0;
+  }
+}
+ 8e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8e3:	31 c0                	xor    %eax,%eax
+}
+ 8e5:	5b                   	pop    %ebx
+ 8e6:	5e                   	pop    %esi
+ 8e7:	5f                   	pop    %edi
+ 8e8:	5d                   	pop    %ebp
+ 8e9:	c3                   	ret
+ 8ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8f0:	39 cf                	cmp    %ecx,%edi
+ 8f2:	74 4c                	je     940 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8f4:	29 f9                	sub    %edi,%ecx
+ 8f6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8f9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8fc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8ff:	89 15 48 0d 00 00    	mov    %edx,0xd48
+}
+ 905:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 908:	83 c0 08             	add    $0x8,%eax
+}
+ 90b:	5b                   	pop    %ebx
+ 90c:	5e                   	pop    %esi
+ 90d:	5f                   	pop    %edi
+ 90e:	5d                   	pop    %ebp
+ 90f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 910:	c7 05 48 0d 00 00 4c 	movl   $0xd4c,0xd48
+ 917:	0d 00 00 
+    base.s.size = 0;
+ 91a:	b8 4c 0d 00 00       	mov    $0xd4c,%eax
+    base.s.ptr = freep = prevp = &base;
+ 91f:	c7 05 4c 0d 00 00 4c 	movl   $0xd4c,0xd4c
+ 926:	0d 00 00 
+    base.s.size = 0;
+ 929:	c7 05 50 0d 00 00 00 	movl   $0x0,0xd50
+ 930:	00 00 00 
+    if(p->s.size >= nunits){
+ 933:	e9 54 ff ff ff       	jmp    88c <malloc+0x2c>
+ 938:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 940:	8b 08                	mov    (%eax),%ecx
+ 942:	89 0a                	mov    %ecx,(%edx)
+ 944:	eb b9                	jmp    8ff <malloc+0x9f>
@@ -0,0 +1,69 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+// Shared-memory parallel sum using clone()/join().
+// Usage:
+//   parsum <nthreads> [n]   -> sum 0..n-1 (default 50000) with
+//                              nthreads threads, each summing a slice
+//
+// The threads add their partial sums straight into the parent's
+// memory under a mutex, so nothing is copied or piped back.
+
+#define MAXTHREADS 16
+#define PGSIZE 4096
+
+static struct mutex lock;
+static uint sum;
+static int nthreads, n;
+
+static void
+worker(void *arg1, void *arg2)
+{
+  int id = (int)arg1;
+  int lo = n / nthreads * id;
+  int hi = id == nthreads - 1 ? n : lo + n / nthreads;
+  uint s = 0;
+
+  (void)arg2;
+  for(int i = lo; i < hi; i++)
+    s += i;
+  mutex_lock(&lock);
+  sum += s;
+  mutex_unlock(&lock);
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  void *stacks[MAXTHREADS], *stack;
+  int i, start;
+
+  if(argc < 2 || (nthreads = atoi(argv[1])) < 1 || nthreads > MAXTHREADS){
+    printf(2, "Usage: parsum <nthreads 1..%d> [n]\n", MAXTHREADS);
+    exit();
+  }
+  n = argc > 2 ? atoi(argv[2]) : 50000;
+
+  start = uptime();
+  for(i = 0; i < nthreads; i++){
+    // Only this thread calls malloc(), which is not thread-safe.
+    if((stacks[i] = malloc(PGSIZE)) == 0 ||
+       clone(worker, (void*)i, 0, stacks[i]) < 0){
+      printf(2, "parsum: clone failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < nthreads; i++){
+    if(join(&stack) < 0){
+      printf(2, "parsum: join failed\n");
+      exit();
+    }
+    free(stack);
+  }
+
+  printf(1, "parsum: threads %d n %d sum %d ticks %d\n",
+         nthreads, n, sum, uptime() - start);
+  exit();
+}
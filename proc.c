@@ -5,161 +5,386 @@
 #include "mmu.h"
 #include "x86.h"
 #include "proc.h"
+#include "traps.h"
 #include "spinlock.h"
+#include "sleeplock.h"
+#include "sched.h"
+#include "slab.h"
 
-static void wakeup1(void *chan);
+static void rt_drop(struct proc *p);
 
 // ===================== PTable =====================
+// struct procs come from a SLAB_KEEP slab cache, so their memory is
+// never used for anything else once it has held a proc.  Live processes are
+// on the all list (for the few walks over everyone), hashed by pid for
+// kill() and friends, and linked into their parent's child list for
+// wait() and exit().
+//
+// Locks, outermost first:
+//   wait_lock      parent/child links; wait() sleeps on it
+//   ptable.lock    all list, pid hash, nextpid
+//   p->lock        p->state, chan, killed; held across swtch
+//   c->rq.lock     CPU c's run queue
+// A sleep channel's condition lock comes before its waitq bucket
+// lock, which comes before p->lock.
 struct {
   struct spinlock lock;
-  struct proc proc[NPROC];
+  struct proc *all;
+  int nproc;                    // live processes, at most NPROC
+  struct proc *pidhash[NPIDHASH];
 } ptable;
 
+// Sleeping processes hashed by channel, each bucket with its own lock,
+// so wakeup() only looks at processes that might be sleeping on chan.
+// Each bucket is kept in sleep order, so wakeupn() wakes the longest
+// sleepers first.
+static struct waitq {
+  struct spinlock lock;
+  struct proc *head;
+  struct proc *tail;
+} waitq[NWAITQ];
+
+static struct spinlock wait_lock;
+
+static struct slabcache *proccache;
+static struct slabcache *vmcache;
+
 static struct proc *initproc;
 
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
-// ===================== MLFQ =====================
-// Global MLFQ object
-struct mlfq mlfq;
+// ===================== Run queues =====================
+// Every CPU has its own run queue in cpus[i].rq, ordered by the active
+// policy (schedclass: mlfq.c or stride.c).  A process sits on at most
+// one of them (p->rqcpu) and is taken off while it runs.  Processes
+// made runnable by someone else are placed on the least loaded CPU;
+// a CPU whose own queue is empty steals from the busiest one.
+//
+// A queued process belongs to its queue's lock: only a holder of that
+// lock takes it off.  Anyone else changing a process's rank (priority,
+// allot, inherited, tickets, rt*) holds p->lock and first takes it
+// off its queue with rq_remove(); a CPU aging its own queue does so
+// under the queue lock alone.
+
+#ifndef SCHEDPOLICY
+#define SCHEDPOLICY "mlfq"   // boot-time default; see Makefile
+#endif
+
+static struct sched_class *policies[] = {
+[SCHED_MLFQ]    &mlfq_class,
+[SCHED_STRIDE]  &stride_class,
+};
+
+struct sched_class *schedclass = &mlfq_class;
+
+// Real-time processes belong to the EDF class whatever the policy.
+static struct sched_class*
+class_of(struct proc *p)
+{
+  return p->rtperiod ? &edf_class : schedclass;
+}
 
-// Forward decl
-void mlfq_remove(struct proc *p);
+// Caller holds c->rq.lock.
+static void
+rq_add(struct cpu *c, struct proc *p)
+{
+  class_of(p)->enqueue(c, p);
+  c->rq.nrunnable++;
+  p->rqcpu = c - cpus;
+  p->queuedat = ticks;
+}
 
-// ----- Internal MLFQ helpers (circular queue, RR) -----
-static int
-mlfq_contains_level(int lvl, struct proc *p)
+// Caller holds the lock of the queue p is on.
+static void
+rq_del(struct proc *p)
 {
-  int h = mlfq.head[lvl], t = mlfq.tail[lvl];
-  for(int i = h; i != t; i = (i + 1) % QUEUE_SIZE){
-    if(mlfq.queue[lvl][i] == p) return 1;
-  }
-  return 0;
+  class_of(p)->dequeue(p);
+  cpus[p->rqcpu].rq.nrunnable--;
+  p->rqcpu = -1;
 }
 
 static void
-mlfq_push_level(int lvl, struct proc *p)
+rq_insert(struct cpu *c, struct proc *p)
 {
-  if(lvl < 0) lvl = 0;
-  if(lvl >= NQUEUE) lvl = NQUEUE - 1;
-  if(p == 0) return;
+  acquire(&c->rq.lock);
+  rq_add(c, p);
+  release(&c->rq.lock);
+}
 
-  // avoid duplicates
-  if(mlfq_contains_level(lvl, p)) return;
+// Take p off whatever queue holds it and return that CPU's index, or
+// -1 if it was on none.  Caller holds p->lock, so p cannot be queued
+// behind our back, but a scheduler may pop it: recheck under the lock.
+static int
+rq_remove(struct proc *p)
+{
+  int cpu;
 
-  int nt = (mlfq.tail[lvl] + 1) % QUEUE_SIZE;
-  if(nt == mlfq.head[lvl]){
-    // queue full -> ignore or panic
-    // panic("mlfq queue full");
-    return;
+  for(;;){
+    if((cpu = p->rqcpu) < 0)
+      return -1;
+    acquire(&cpus[cpu].rq.lock);
+    if(p->rqcpu == cpu){
+      rq_del(p);
+      release(&cpus[cpu].rq.lock);
+      return cpu;
+    }
+    release(&cpus[cpu].rq.lock);
   }
-  mlfq.queue[lvl][mlfq.tail[lvl]] = p;
-  mlfq.tail[lvl] = nt;
 }
 
-// Round-robin pick: pop head until find RUNNABLE.
-// If RUNNABLE: push back to tail (RR) and return it.
-// If not RUNNABLE: drop it (queue gets cleaned).
+// Remove and return the process c should run next: the earliest
+// real-time deadline, else whatever the policy prefers.
+// Caller holds c->rq.lock.
 static struct proc*
-mlfq_pick_rr_level(int lvl)
+rq_pop(struct cpu *c)
 {
-  while(mlfq.head[lvl] != mlfq.tail[lvl]){
-    struct proc *p = mlfq.queue[lvl][mlfq.head[lvl]];
-    mlfq.queue[lvl][mlfq.head[lvl]] = 0;
-    mlfq.head[lvl] = (mlfq.head[lvl] + 1) % QUEUE_SIZE;
+  struct proc *p = edf_class.pick(c);
 
-    if(p == 0) continue;
+  if(p == 0)
+    p = schedclass->pick(c);
 
-    if(p->state == RUNNABLE){
-      mlfq_push_level(lvl, p); // RR rotate
-      return p;
-    }
-    // else: drop (SLEEPING/ZOMBIE/UNUSED...)
-  }
-  return 0;
+  if(p)
+    rq_del(p);
+  return p;
 }
 
-// Rebuild-remove (safe with circular queue)
-void
-mlfq_remove(struct proc *p)
+// Lock every run queue, for changes to the policy or its parameters.
+static void
+rq_lockall(void)
+{
+  for(struct cpu *c = cpus; c < cpus+ncpu; c++)
+    acquire(&c->rq.lock);
+}
+
+static void
+rq_unlockall(void)
+{
+  for(struct cpu *c = cpus; c < cpus+ncpu; c++)
+    release(&c->rq.lock);
+}
+
+// Placement load: queued processes plus the one running there.
+static int
+rq_load(struct cpu *c)
 {
-  if(p == 0) return;
+  return c->rq.nrunnable + (c->proc != 0);
+}
 
-  for(int lvl = 0; lvl < NQUEUE; lvl++){
-    struct proc *tmp[QUEUE_SIZE];
-    int cnt = 0;
+// May p run on c?  A real-time process only runs where it is admitted.
+static int
+cpu_allowed(struct proc *p, struct cpu *c)
+{
+  if(p->rtperiod)
+    return p->rtcpu == c - cpus;
+  return (p->cpumask >> (c - cpus)) & 1;
+}
 
-    int h = mlfq.head[lvl], t = mlfq.tail[lvl];
-    int found = 0;
+// Pick a CPU for a process made runnable by someone else (fork,
+// wakeup, kill).  Stay where it last ran unless another allowed,
+// started CPU is strictly less loaded.  setaffinity() guarantees the
+// mask names at least one CPU; early in boot, before any CPU has
+// started, fall back to the first allowed one.
+static struct cpu*
+select_cpu(struct proc *p)
+{
+  struct cpu *c, *best = 0;
 
-    for(int i = h; i != t; i = (i + 1) % QUEUE_SIZE){
-      struct proc *x = mlfq.queue[lvl][i];
-      if(x == 0) continue;
-      if(x == p){ found = 1; continue; }
-      if(cnt < QUEUE_SIZE) tmp[cnt++] = x;
-    }
+  if(p->lastcpu >= 0 && p->lastcpu < ncpu && cpus[p->lastcpu].started &&
+     cpu_allowed(p, &cpus[p->lastcpu]))
+    best = &cpus[p->lastcpu];
+  for(c = cpus; c < cpus+ncpu; c++){
+    if(!c->started || !cpu_allowed(p, c))
+      continue;
+    if(best == 0 || rq_load(c) < rq_load(best))
+      best = c;
+  }
+  if(best == 0)
+    best = &cpus[__builtin_ctz(p->cpumask)];
+  return best;
+}
 
-    if(found){
-      // reset this level
-      mlfq.head[lvl] = 0;
-      mlfq.tail[lvl] = 0;
-      for(int k = 0; k < QUEUE_SIZE; k++)
-        mlfq.queue[lvl][k] = 0;
+// Bumped each time sched_enqueue() queues a process another CPU might
+// steal, so an idle CPU can tell whether its last failed sched_pick()
+// is still current (see cpu_idle()).
+static uint enqgen;
+
+// If c is halted in cpu_idle(), or runs something a newly queued
+// real-time process should preempt, kick it with a reschedule IPI.
+// The fence orders our queue update before the read of c->idle;
+// it pairs with the xchg in cpu_idle().
+static void
+kick_cpu(struct cpu *c)
+{
+  __sync_synchronize();
+  if(c == mycpu())
+    return;
+  if(c->idle || (c->proc && edf_preempts(c, c->proc)))
+    lapicsendipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
+}
 
-      // re-enqueue
-      for(int k = 0; k < cnt; k++)
-        mlfq_push_level(lvl, tmp[k]);
+// p was just queued on c.  If c has other work to get through first,
+// wake one halted CPU that may steal p.  Idle CPUs halt as soon as
+// nothing they may run is left, so work they could take only reaches
+// them this way.  Real-time processes are never stolen.
+static void
+kick_thief(struct proc *p, struct cpu *c)
+{
+  struct cpu *d;
 
+  if(p->rtperiod ||
+     c->rq.nrunnable + (c->proc != 0 && c->proc != p) <= 1)
+    return;
+  for(d = cpus; d < cpus+ncpu; d++){
+    if(d != c && d != mycpu() && d->started && d->idle &&
+       cpu_allowed(p, d)){
+      lapicsendipi(d->apicid, T_IRQ0 + IRQ_RESCHED);
       return;
     }
   }
 }
 
-// ----- Wrappers to match proc.h prototypes -----
-void
-mlfq_init(void)
+// Make RUNNABLE p eligible to run.  A process giving up its own CPU
+// stays on the local queue to keep its cache warm, unless its
+// affinity no longer allows it there; everyone else goes through
+// select_cpu().  Caller holds p->lock.
+static void
+sched_enqueue(struct proc *p)
 {
-  for(int i = 0; i < NQUEUE; i++){
-    mlfq.head[i] = 0;
-    mlfq.tail[i] = 0;
-    for(int j = 0; j < QUEUE_SIZE; j++)
-      mlfq.queue[i][j] = 0;
+  struct cpu *c = mycpu();
+
+  if(p == 0 || p->rqcpu >= 0) return;
+  if(c->proc != p || !cpu_allowed(p, c))
+    c = select_cpu(p);
+  rq_insert(c, p);
+  if(p->rtperiod == 0)
+    __sync_fetch_and_add(&enqgen, 1);
+  kick_cpu(c);
+  kick_thief(p, c);
+}
+
+// Best process on c's own queue; if that is empty, steal the best
+// process of the busiest other CPU whose best process may run on c.
+// Queue lengths are only hints: the victim is found holding one queue
+// lock at a time and its best process is rechecked before it is taken.
+static struct proc*
+sched_pick(struct cpu *c)
+{
+  struct cpu *v, *victim = 0;
+  struct proc *p;
+  int most = 0;
+
+  acquire(&c->rq.lock);
+  p = rq_pop(c);
+  release(&c->rq.lock);
+  if(p)
+    return p;
+
+  for(v = cpus; v < cpus+ncpu; v++){
+    if(v == c || v->rq.nrunnable <= most)
+      continue;
+    acquire(&v->rq.lock);
+    if((p = schedclass->pick(v)) != 0 && cpu_allowed(p, c)){
+      victim = v;
+      most = v->rq.nrunnable;
+    }
+    release(&v->rq.lock);
   }
+  if(victim == 0)
+    return 0;
+
+  acquire(&victim->rq.lock);
+  if((p = schedclass->pick(victim)) != 0 && cpu_allowed(p, c))
+    rq_del(p);
+  else
+    p = 0;
+  release(&victim->rq.lock);
+  return p;
 }
 
-void
-mlfq_enqueue(int level, struct proc *p)
+// Charge one wakeup-to-run latency of d TSC cycles to c's histogram
+// for level lvl.  Only c itself writes its histogram.
+static void
+lat_record(struct cpu *c, int lvl, uint64 d)
 {
-  mlfq_push_level(level, p);
+  uint hi = d >> 32, lo = d;
+  int b;
+
+  if(hi)
+    b = 32 + 31 - __builtin_clz(hi);
+  else if(lo)
+    b = 31 - __builtin_clz(lo);
+  else
+    b = 0;
+  if(b >= NLATBUCKET)
+    b = NLATBUCKET - 1;
+  c->lathist[lvl][b]++;
 }
 
-int
-in_mlfq(struct proc *p)
+// Lock-free hint: is anything queued anywhere?  Lets idle CPUs
+// stay off the queue locks while there is nothing to run.
+static int
+sched_has_work(void)
 {
-  for(int lvl = 0; lvl < NQUEUE; lvl++){
-    if(mlfq_contains_level(lvl, p)) return 1;
-  }
+  for(struct cpu *c = cpus; c < cpus+ncpu; c++)
+    if(c->rq.nrunnable > 0)
+      return 1;
   return 0;
 }
 
-struct proc*
-mlfq_pick_next(void)
+// Park this CPU until an interrupt arrives.  gen is enqgen as it was
+// before our last sched_pick() came back empty: unless our own queue
+// has work or something was queued since, nothing here is ours to
+// run, however long other queues are.  c->idle is published before
+// that last look, so anyone who queues work for us after it sees it
+// set and sends us a reschedule IPI.
+static void
+cpu_idle(struct cpu *c, uint gen)
 {
-  for(int lvl = 0; lvl < NQUEUE; lvl++){
-    struct proc *p = mlfq_pick_rr_level(lvl);
-    if(p) return p;
+  cli();
+  xchg(&c->idle, 1);
+  if(c->rq.nrunnable == 0 && enqgen == gen){
+    timeridle(c);
+    stihlt();
+    timerwake(c);
   }
-  return 0;
+  xchg(&c->idle, 0);
 }
 
 // ===================== Init =====================
+static void
+proc_ctor(void *obj)
+{
+  struct proc *p = obj;
+
+  memset(p, 0, sizeof(*p));
+  initlock(&p->lock, "proc");
+}
+
+static void
+vmspace_ctor(void *obj)
+{
+  struct vmspace *vm = obj;
+
+  memset(vm, 0, sizeof(*vm));
+  initsleeplock(&vm->lock, "vmspace");
+}
+
 void
 pinit(void)
 {
   initlock(&ptable.lock, "ptable");
-  mlfq_init();
+  initlock(&wait_lock, "wait");
+  proccache = slab_create("proc", sizeof(struct proc), proc_ctor, SLAB_KEEP);
+  vmcache = slab_create("vmspace", sizeof(struct vmspace), vmspace_ctor, 0);
+  for(int i = 0; i < NWAITQ; i++)
+    initlock(&waitq[i].lock, "waitq");
+  for(int i = 0; i < NCPU; i++)
+    initlock(&cpus[i].rq.lock, "rq");
+  for(int i = 0; i < NELEM(policies); i++)
+    if(strncmp(policies[i]->name, SCHEDPOLICY, 16) == 0)
+      schedclass = policies[i];
 }
 
 // ===================== CPU/Proc Utilities =====================
@@ -197,6 +422,193 @@ myproc(void)
   return p;
 }
 
+// ===================== Process table =====================
+// Caller holds ptable.lock for proc_get(), findproc() and proc_put(),
+// and wait_lock for the child list functions.
+
+// Allocate a struct proc and put it on the all list.
+static struct proc*
+proc_get(void)
+{
+  struct proc *p;
+
+  if(ptable.nproc >= NPROC || (p = slab_alloc(proccache)) == 0)
+    return 0;
+
+  p->allprev = 0;
+  p->allnext = ptable.all;
+  if(ptable.all)
+    ptable.all->allprev = p;
+  ptable.all = p;
+  ptable.nproc++;
+  return p;
+}
+
+static struct proc**
+pidbucket(int pid)
+{
+  return &ptable.pidhash[pid & (NPIDHASH-1)];
+}
+
+// Live process pid, or 0.
+static struct proc*
+findproc(int pid)
+{
+  struct proc *p;
+
+  for(p = *pidbucket(pid); p; p = p->hashnext)
+    if(p->pid == pid)
+      return p;
+  return 0;
+}
+
+// Unhash p, take it off the all list and free it.
+static void
+proc_put(struct proc *p)
+{
+  struct proc **pp;
+
+  for(pp = pidbucket(p->pid); *pp; pp = &(*pp)->hashnext)
+    if(*pp == p){
+      *pp = p->hashnext;
+      break;
+    }
+  if(p->allprev)
+    p->allprev->allnext = p->allnext;
+  else
+    ptable.all = p->allnext;
+  if(p->allnext)
+    p->allnext->allprev = p->allprev;
+  ptable.nproc--;
+
+  p->state = UNUSED;
+  p->pid = 0;
+  p->allnext = 0;
+  slab_free(proccache, p);
+}
+
+static void
+child_add(struct proc *parent, struct proc *p)
+{
+  p->parent = parent;
+  p->sibprev = 0;
+  p->sibling = parent->children;
+  if(parent->children)
+    parent->children->sibprev = p;
+  parent->children = p;
+}
+
+static void
+child_remove(struct proc *p)
+{
+  if(p->sibprev)
+    p->sibprev->sibling = p->sibling;
+  else
+    p->parent->children = p->sibling;
+  if(p->sibling)
+    p->sibling->sibprev = p->sibprev;
+  p->parent = 0;
+  p->sibling = p->sibprev = 0;
+}
+
+// ===================== Address spaces =====================
+// A new address space holding pgdir, with one reference.
+struct vmspace*
+vmspace_get(pde_t *pgdir, uint sz)
+{
+  struct vmspace *vm;
+
+  if((vm = slab_alloc(vmcache)) == 0)
+    return 0;
+
+  vm->ref = 1;
+  vm->pgdir = pgdir;
+  vm->sz = sz;
+  vm->busy = 0;
+  vm->cow = 0;
+  return vm;
+}
+
+// Drop a reference; the last one frees the user memory.
+void
+vmspace_put(struct vmspace *vm)
+{
+  if(__sync_sub_and_fetch(&vm->ref, 1) > 0)
+    return;
+  freevm(vm->pgdir);
+  vm->pgdir = 0;
+  slab_free(vmcache, vm);
+}
+
+// p starts or finishes a system call.  A user address it checked
+// stays in use until the call is over, so growproc() must not take
+// memory away from a vmspace while another of its threads is busy.
+void
+vmspace_enter(struct proc *p)
+{
+  p->insyscall = 1;
+  __sync_add_and_fetch(&p->vm->busy, 1);   // a full fence too
+}
+
+void
+vmspace_leave(struct proc *p)
+{
+  if(!p->insyscall)
+    return;
+  p->insyscall = 0;
+  __sync_sub_and_fetch(&p->vm->busy, 1);
+}
+
+// Take p's vm->lock from a system call that uses no user address it
+// checked.  It stops counting as busy first, since the holder may be a
+// thread shrinking the vmspace, waiting for the busy ones to finish.
+static void
+vmspace_lock(struct proc *p)
+{
+  vmspace_leave(p);
+  acquiresleep(&p->vm->lock);
+}
+
+// vm lost mappings that other CPUs may still have cached: make every
+// other CPU running a thread of vm reload %cr3 and wait until it has.
+// A CPU that switches to vm later loads %cr3 anyway.  Caller holds
+// vm->lock and no spinlocks, so the CPUs we wait for can take our IPI.
+static void
+vm_shootdown(struct vmspace *vm)
+{
+  uint want[NCPU];
+  struct cpu *c, *me;
+  struct proc *p;
+
+  pushcli();
+  me = mycpu();
+  for(c = cpus; c < cpus+ncpu; c++){
+    want[c - cpus] = 0;
+    p = c->proc;
+    if(c == me || p == 0 || p->vm != vm)
+      continue;
+    want[c - cpus] = __sync_add_and_fetch(&c->tlbreq, 1);
+    lapicsendipi(c->apicid, T_IRQ0 + IRQ_TLB);
+  }
+  popcli();
+
+  for(c = cpus; c < cpus+ncpu; c++)
+    while(want[c - cpus] && (int)(c->tlbdone - want[c - cpus]) < 0)
+      ;
+}
+
+// IRQ_TLB handler.  Requests read before the flush are covered by it;
+// later ones come with an IPI of their own.
+void
+tlbflushintr(void)
+{
+  struct cpu *c = mycpu();
+  uint req = c->tlbreq;
+
+  lcr3(rcr3());
+  c->tlbdone = req;
+}
+
 // ===================== allocproc =====================
 static struct proc*
 allocproc(void)
@@ -205,26 +617,51 @@ allocproc(void)
   char *sp;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == UNUSED)
-      goto found;
-
-  release(&ptable.lock);
-  return 0;
+  if((p = proc_get()) == 0){
+    release(&ptable.lock);
+    return 0;
+  }
 
-found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->parent = 0;
+  p->children = 0;
+  p->killed = 0;
+  p->chan = 0;
+  p->vm = 0;
+  p->ustack = 0;
+  p->insyscall = 0;
 
   // MLFQ init per-proc
   p->priority = 0;
-  p->ticks = 0;
-
+  p->allot = 0;
+  p->rqcpu = -1;
+  p->rqnext = p->rqprev = 0;
+  p->lastcpu = -1;
+  p->cpumask = ~0;
+  p->rtperiod = 0;         // children are never real-time
+  p->rtcpu = -1;
+  p->rtutil = 0;
+  p->inherited = NQUEUE;
+  p->heldlocks = 0;
+  p->tmlinked = 0;
+  stride_settickets(p, STRIDE_DEFTICKETS);
+  p->pass = 0;
+  memset(p->lvticks, 0, sizeof(p->lvticks));
+  p->nsched = 0;
+  p->waitticks = 0;
+  p->ndemote = 0;
+  p->nboost = 0;
+  p->wakets = 0;
+
+  // Visible to kill() from here on.
+  p->hashnext = *pidbucket(p->pid);
+  *pidbucket(p->pid) = p;
   release(&ptable.lock);
 
-  if((p->kstack = kalloc()) == 0){
+  if((p->kstack = kalloc_pages(KSTACKORDER)) == 0){
     acquire(&ptable.lock);
-    p->state = UNUSED;
+    proc_put(p);
     release(&ptable.lock);
     return 0;
   }
@@ -252,16 +689,16 @@ void
 userinit(void)
 {
   struct proc *p;
+  pde_t *pgdir;
   extern char _binary_initcode_start[], _binary_initcode_size[];
 
   p = allocproc();
   initproc = p;
 
-  if((p->pgdir = setupkvm()) == 0)
+  if((pgdir = setupkvm()) == 0 || (p->vm = vmspace_get(pgdir, PGSIZE)) == 0)
     panic("userinit: out of memory");
 
-  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
-  p->sz = PGSIZE;
+  inituvm(pgdir, _binary_initcode_start, (int)_binary_initcode_size);
   memset(p->tf, 0, sizeof(*p->tf));
   p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
   p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
@@ -274,72 +711,206 @@ userinit(void)
   safestrcpy(p->name, "initcode", sizeof(p->name));
   p->cwd = namei("/");
 
-  acquire(&ptable.lock);
+  acquire(&p->lock);
   p->state = RUNNABLE;
-  mlfq_enqueue(p->priority, p);
-  release(&ptable.lock);
+  sched_enqueue(p);
+  release(&p->lock);
 }
 
 // ===================== growproc =====================
+// Take the memory above newsz away from the threads sharing vm, before
+// the caller frees it: no thread may reach it through an address it
+// checked, nor through a stale TLB entry.  Threads in a system call
+// may be using such an address, blocked or not, so wait a tick at a
+// time until none is; fails only if we are killed meanwhile.
+// Caller holds vm->lock and is not counted in vm->busy.
+static int
+vm_shrinkshared(struct vmspace *vm, uint newsz)
+{
+  uint oldsz = vm->sz;
+
+  if(newsz >= oldsz)
+    return 0;
+  vm->sz = newsz;          // threads entering the kernel check against this
+  __sync_synchronize();    // pairs with the fence in vmspace_enter()
+  while(vm->busy > 0){
+    if(timersleep(1) < 0){
+      vm->sz = oldsz;
+      return -1;
+    }
+  }
+  unmapuvm(vm->pgdir, oldsz, newsz);
+  vm_shootdown(vm);
+  return 0;
+}
+
+// Grow or shrink user memory by n bytes and return the old size, or
+// -1.  Threads sharing the address space may call this concurrently.
+// Shrinking memory shared with other threads waits until none of
+// them is in a system call.
 int
 growproc(int n)
 {
-  uint sz;
+  uint sz, oldsz;
   struct proc *curproc = myproc();
+  struct vmspace *vm = curproc->vm;
 
-  sz = curproc->sz;
+  vmspace_lock(curproc);
+  sz = oldsz = vm->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    if((sz = allocuvm(vm->pgdir, sz, sz + n)) == 0){
+      releasesleep(&vm->lock);
       return -1;
+    }
   } else if(n < 0){
-    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    // New mappings cannot be cached stale, removed ones can.
+    if(vm->ref > 1 && vm_shrinkshared(vm, sz + n) < 0){
+      releasesleep(&vm->lock);
+      return -1;
+    }
+    if((sz = deallocuvm(vm->pgdir, sz, sz + n)) == 0){
+      releasesleep(&vm->lock);
       return -1;
+    }
   }
-  curproc->sz = sz;
+  vm->sz = sz;
+  releasesleep(&vm->lock);
   switchuvm(curproc);
-  return 0;
+  return oldsz;
+}
+
+// ===================== fork / clone =====================
+// Undo allocproc() for a child that never ran.
+static void
+abandonproc(struct proc *np)
+{
+  kfree_pages(np->kstack, KSTACKORDER);
+  np->kstack = 0;
+  acquire(&ptable.lock);
+  proc_put(np);
+  release(&ptable.lock);
+}
+
+// Finish a child of the caller whose memory and registers are set
+// up: give it the caller's files and settings, and start it.
+static int
+startchild(struct proc *np)
+{
+  int i, pid;
+  struct proc *curproc = myproc();
+
+  for(i = 0; i < NOFILE; i++)
+    if(curproc->ofile[i])
+      np->ofile[i] = filedup(curproc->ofile[i]);
+  np->cwd = idup(curproc->cwd);
+
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+  stride_settickets(np, curproc->tickets);
+  np->cpumask = curproc->cpumask;
+
+  pid = np->pid;
+
+  acquire(&wait_lock);
+  child_add(curproc, np);
+  release(&wait_lock);
+
+  acquire(&np->lock);
+  np->state = RUNNABLE;
+  sched_enqueue(np);
+  release(&np->lock);
+
+  return pid;
 }
 
-// ===================== fork =====================
 int
 fork(void)
 {
-  int i, pid;
   struct proc *np;
   struct proc *curproc = myproc();
+  struct vmspace *vm = curproc->vm;
+  pde_t *pgdir;
+  uint sz;
+  int cow;
 
   if((np = allocproc()) == 0)
     return -1;
 
-  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
-    kfree(np->kstack);
-    np->kstack = 0;
-    acquire(&ptable.lock);
-    np->state = UNUSED;
-    release(&ptable.lock);
+  // Share the pages copy-on-write if we have no threads.  With
+  // threads, breaking a copy-on-write page would take a TLB
+  // shootdown from the fault handler, so copy them all up front.
+  vmspace_lock(curproc);     // our threads may be resizing it
+  sz = vm->sz;
+  cow = vm->ref == 1;
+  if(cow){
+    pgdir = cowuvm(vm->pgdir, sz);
+    vm->cow = 1;             // even if cowuvm failed partway
+    lcr3(V2P(vm->pgdir));    // our pages are read-only now
+  } else
+    pgdir = copyuvm(vm->pgdir, sz);
+  releasesleep(&vm->lock);
+  if(pgdir == 0){
+    abandonproc(np);
+    return -1;
+  }
+  if((np->vm = vmspace_get(pgdir, sz)) == 0){
+    freevm(pgdir);
+    abandonproc(np);
     return -1;
   }
+  np->vm->cow = cow;
 
-  np->sz = curproc->sz;
-  np->parent = curproc;
   *np->tf = *curproc->tf;
   np->tf->eax = 0;
 
-  for(i = 0; i < NOFILE; i++)
-    if(curproc->ofile[i])
-      np->ofile[i] = filedup(curproc->ofile[i]);
-  np->cwd = idup(curproc->cwd);
+  return startchild(np);
+}
 
-  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+// Start a thread in the caller's address space, running
+// fcn(arg1, arg2) on the page-sized user stack at stack.  Like fork()
+// the thread gets its own copies of the open file descriptors; unlike
+// fork() it shares memory, and is reaped with join(), not wait().
+int
+clone(void (*fcn)(void*, void*), void *arg1, void *arg2, void *stack)
+{
+  struct proc *np;
+  struct proc *curproc = myproc();
+  uint sp, ustack[3];
 
-  pid = np->pid;
+  if((np = allocproc()) == 0)
+    return -1;
 
-  acquire(&ptable.lock);
-  np->state = RUNNABLE;
-  mlfq_enqueue(np->priority, np);
-  release(&ptable.lock);
+  // Threads don't share copy-on-write pages: see fork().
+  np->vm = curproc->vm;
+  vmspace_lock(curproc);
+  if(np->vm->cow){
+    if(cowbreakall(np->vm->pgdir, np->vm->sz) < 0){
+      releasesleep(&np->vm->lock);
+      abandonproc(np);
+      return -1;
+    }
+    np->vm->cow = 0;
+  }
+  __sync_add_and_fetch(&np->vm->ref, 1);
+  releasesleep(&np->vm->lock);
+
+  // fcn's frame: a fake return PC and the two arguments.
+  ustack[0] = 0xffffffff;
+  ustack[1] = (uint)arg1;
+  ustack[2] = (uint)arg2;
+  sp = (uint)stack + PGSIZE - sizeof(ustack);
+  if(copyout(np->vm->pgdir, sp, ustack, sizeof(ustack)) < 0){
+    vmspace_put(np->vm);
+    abandonproc(np);
+    return -1;
+  }
 
-  return pid;
+  *np->tf = *curproc->tf;
+  np->tf->eax = 0;
+  np->tf->esp = sp;
+  np->tf->eip = (uint)fcn;
+  np->ustack = stack;
+
+  return startchild(np);
 }
 
 // ===================== exit =====================
@@ -352,70 +923,104 @@ exit(void)
   if(curproc == initproc)
     panic("init exiting");
 
-  acquire(&ptable.lock);
+  vmspace_leave(curproc);   // if exiting from a system call
+
+  acquire(&wait_lock);
 
   // reparent children to init
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == curproc){
-      p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
-    }
+  while((p = curproc->children) != 0){
+    child_remove(p);
+    child_add(initproc, p);
+    if(p->state == ZOMBIE)
+      wakeup(initproc);
   }
 
-  // remove from MLFQ
-  mlfq_remove(curproc);
+  // The parent cannot look at us before wait_lock is dropped, by
+  // which time we are a ZOMBIE.
+  wakeup(curproc->parent);
 
+  acquire(&curproc->lock);
+  rt_drop(curproc);
   curproc->state = ZOMBIE;
-  wakeup1(curproc->parent);
+  release(&wait_lock);
+
   sched();
   panic("zombie exit");
 }
 
-// ===================== wait =====================
-int
-wait(void)
+// ===================== wait / join =====================
+// Reap an exited child: a thread sharing our memory if threads is
+// set (join), else a process (wait).  Returns its pid, or -1 if we
+// have no such children or were killed.  *ustack gets a thread's
+// clone() stack.
+static int
+reap(int threads, void **ustack)
 {
   struct proc *p;
   int havekids, pid;
   struct proc *curproc = myproc();
 
-  acquire(&ptable.lock);
+  acquire(&wait_lock);
   for(;;){
     havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
+    for(p = curproc->children; p; p = p->sibling){
+      if((p->vm == curproc->vm) != threads)
         continue;
-
       havekids = 1;
+      // p->lock is held until p has switched away for good, so a
+      // ZOMBIE seen under it is off its kernel stack.
+      acquire(&p->lock);
       if(p->state == ZOMBIE){
         pid = p->pid;
-        kfree(p->kstack);
+        if(ustack)
+          *ustack = p->ustack;
+        kfree_pages(p->kstack, KSTACKORDER);
         p->kstack = 0;
-        freevm(p->pgdir);
-
-        mlfq_remove(p);
-
-        p->state = UNUSED;
-        p->pid = 0;
-        p->parent = 0;
+        vmspace_put(p->vm);
+        p->vm = 0;
+        child_remove(p);
         p->name[0] = 0;
         p->killed = 0;
+        release(&p->lock);
 
+        acquire(&ptable.lock);
+        proc_put(p);
         release(&ptable.lock);
+
+        release(&wait_lock);
         return pid;
       }
+      release(&p->lock);
     }
 
     if(!havekids || curproc->killed){
-      release(&ptable.lock);
+      release(&wait_lock);
       return -1;
     }
 
-    sleep(curproc, &ptable.lock);
+    sleep(curproc, &wait_lock);
   }
 }
 
+int
+wait(void)
+{
+  return reap(0, 0);
+}
+
+// Wait for a thread started with clone() to exit; *stack gets the
+// stack it was given so the caller can free it.
+int
+join(void **stack)
+{
+  void *ustack;
+  int pid;
+
+  if((pid = reap(1, &ustack)) >= 0)
+    *stack = ustack;
+  return pid;
+}
+
 // ===================== scheduler =====================
 void
 scheduler(void)
@@ -425,35 +1030,48 @@ scheduler(void)
 
   for(;;){
     sti();
-    acquire(&ptable.lock);
 
-    struct proc *p = mlfq_pick_next();
+    // Stay off the queue locks while no run queue has work.
+    uint gen = enqgen;
+    struct proc *p = sched_has_work() ? sched_pick(c) : 0;
 
     if(p){
+      // p is off every queue now, so nobody else will pick it, but the
+      // CPU that queued it may still be finishing its switch away from
+      // p under p->lock.  We hold p->lock from here until p is back on
+      // this side of swtch(); p releases it in yield(), sleep() or
+      // forkret() and takes it again before it switches out.
+      acquire(&p->lock);
       c->proc = p;
       p->state = RUNNING;
+      p->lastcpu = c - cpus;
+      p->nsched++;
+      p->waitticks += ticks - p->queuedat;
+      if(p->wakets){
+        lat_record(c, p->priority, rdtsc() - p->wakets);
+        p->wakets = 0;
+      }
+      timerarm(c, p);
+      p->runstart = rdtsc();
 
       switchuvm(p);
       swtch(&c->scheduler, p->context);
       switchkvm();
 
-      // If it became RUNNABLE again, ensure demote + enqueue.
-      if(p->state == RUNNABLE){
-        p->ticks++;
-
-        // demote (đếm theo lần được schedule; chuẩn hơn là theo timer tick ở trap.c)
-        if(p->ticks >= (1 << p->priority) && p->priority < NQUEUE - 1){
-          p->ticks = 0;
-          mlfq_remove(p);
-          p->priority++;
-        }
-        mlfq_enqueue(p->priority, p);
-      }
+      // The one place CPU use is charged, however p gave up the CPU.
+      if(schedclass->charge)
+        schedclass->charge(p, rdtsc() - p->runstart);
+
+      // If it became RUNNABLE again, make sure it is queued.
+      if(p->state == RUNNABLE)
+        sched_enqueue(p);
 
       c->proc = 0;
+      release(&p->lock);
+    } else if(!kzero_idle()){
+      // Nothing we may run: zero pages for kalloc_zeroed(), then halt.
+      cpu_idle(c, gen);
     }
-
-    release(&ptable.lock);
   }
 }
 
@@ -464,8 +1082,8 @@ sched(void)
   int intena;
   struct proc *p = myproc();
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(&p->lock))
+    panic("sched p->lock");
   if(mycpu()->ncli != 1)
     panic("sched locks");
   if(p->state == RUNNING)
@@ -481,12 +1099,12 @@ sched(void)
 void
 yield(void)
 {
-  acquire(&ptable.lock);
   struct proc *p = myproc();
-  p->state = RUNNABLE;
-  mlfq_enqueue(p->priority, p);
+
+  acquire(&p->lock);
+  p->state = RUNNABLE;   // scheduler() charges and requeues it
   sched();
-  release(&ptable.lock);
+  release(&p->lock);
 }
 
 // ===================== forkret =====================
@@ -494,7 +1112,7 @@ void
 forkret(void)
 {
   static int first = 1;
-  release(&ptable.lock);
+  release(&myproc()->lock);   // taken by scheduler()
 
   if(first){
     first = 0;
@@ -504,51 +1122,112 @@ forkret(void)
 }
 
 // ===================== sleep / wakeup =====================
+// A process is on the bucket of p->chan from sleep() until either
+// wakeup() or the process itself (after being woken by kill()) takes
+// it off; p->chan is non-zero exactly while it is linked and is
+// protected by the bucket lock.
+static struct waitq*
+waitq_bucket(void *chan)
+{
+  return &waitq[(((uint)chan * 2654435761U) >> 16) & (NWAITQ-1)];
+}
+
+static void
+waitq_insert(struct waitq *b, struct proc *p)
+{
+  p->wqnext = 0;
+  p->wqprev = b->tail;
+  if(b->tail)
+    b->tail->wqnext = p;
+  else
+    b->head = p;
+  b->tail = p;
+}
+
+static void
+waitq_remove(struct waitq *b, struct proc *p)
+{
+  if(p->wqprev)
+    p->wqprev->wqnext = p->wqnext;
+  else
+    b->head = p->wqnext;
+  if(p->wqnext)
+    p->wqnext->wqprev = p->wqprev;
+  else
+    b->tail = p->wqprev;
+  p->wqnext = p->wqprev = 0;
+  p->chan = 0;
+}
+
+// Make SLEEPING p runnable.  Caller holds p->lock.
+static void
+wakeproc(struct proc *p)
+{
+  p->state = RUNNABLE;
+  p->wakets = rdtsc();
+  sched_enqueue(p);
+}
+
 void
 sleep(void *chan, struct spinlock *lk)
 {
   struct proc *p = myproc();
+  struct waitq *b = waitq_bucket(chan);
 
   if(p == 0 || lk == 0)
     panic("sleep");
 
-  if(lk != &ptable.lock){
-    acquire(&ptable.lock);
-    release(lk);
-  }
-
-  // leaving runnable queue
-  mlfq_remove(p);
-
+  // A waker changes the condition under lk and then needs the bucket
+  // lock, so taking the bucket lock before dropping lk means it cannot
+  // look for us before we are on the queue.
+  acquire(&b->lock);
+  release(lk);
+  acquire(&p->lock);
   p->chan = chan;
   p->state = SLEEPING;
+  waitq_insert(b, p);
+  release(&b->lock);
+
   sched();
-  p->chan = 0;
 
-  if(lk != &ptable.lock){
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  release(&p->lock);
+  acquire(&b->lock);
+  if(p->chan)            // woken by kill(), still linked
+    waitq_remove(b, p);
+  release(&b->lock);
+  acquire(lk);
 }
 
-static void
-wakeup1(void *chan)
+// Wake at most n processes sleeping on chan, longest sleeping first.
+// Returns how many were woken.
+int
+wakeupn(void *chan, int n)
 {
-  struct proc *p;
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->state == SLEEPING && p->chan == chan){
-      p->state = RUNNABLE;
-      mlfq_enqueue(p->priority, p);
+  struct waitq *b = waitq_bucket(chan);
+  struct proc *p, *next;
+  int woken = 0;
+
+  acquire(&b->lock);
+  for(p = b->head; p && woken < n; p = next){
+    next = p->wqnext;
+    if(p->chan != chan)
+      continue;
+    acquire(&p->lock);   // waits until p has switched away in sleep()
+    waitq_remove(b, p);
+    if(p->state == SLEEPING){
+      wakeproc(p);
+      woken++;
     }
+    release(&p->lock);
   }
+  release(&b->lock);
+  return woken;
 }
 
 void
 wakeup(void *chan)
 {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+  wakeupn(chan, NPROC);
 }
 
 // ===================== kill =====================
@@ -558,16 +1237,14 @@ kill(int pid)
   struct proc *p;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      if(p->state == SLEEPING){
-        p->state = RUNNABLE;
-        mlfq_enqueue(p->priority, p);
-      }
-      release(&ptable.lock);
-      return 0;
-    }
+  if((p = findproc(pid)) != 0){
+    acquire(&p->lock);
+    p->killed = 1;
+    if(p->state == SLEEPING)
+      wakeproc(p);       // it unlinks itself from its wait queue
+    release(&p->lock);
+    release(&ptable.lock);
+    return 0;
   }
   release(&ptable.lock);
   return -1;
@@ -586,34 +1263,394 @@ procdump(void)
     [ZOMBIE]   "zombie"
   };
 
+  // No lock, as before; proc memory stays type-stable (SLAB_KEEP) and
+  // proc_put() clears allnext, so a racing walk at worst stops early.
   struct proc *p;
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+  for(p = ptable.all; p; p = p->allnext){
     if(p->state == UNUSED)
       continue;
     cprintf("%d %s %s pri:%d ticks:%d\n",
-            p->pid, states[p->state], p->name, p->priority, p->ticks);
+            p->pid, states[p->state], p->name, p->priority,
+            p->lvticks[p->priority]);
   }
 }
-// Boost tất cả process về level 0 để chống starvation
-void
-mlfq_boost_all(void)
+// Copy scheduler statistics of up to n live processes to the user
+// array upi (already checked by the caller).  Returns how many were
+// copied.  The all list may change once the lock is dropped, so it is
+// held for the whole walk.
+int
+getpinfo(struct pinfo *upi, int n)
 {
+  struct proc *p;
+  struct pinfo pi;
+  int k = 0;
+
   acquire(&ptable.lock);
+  for(p = ptable.all; p && k < n; p = p->allnext){
+    pi.pid = p->pid;
+    pi.state = p->state;
+    safestrcpy(pi.name, p->name, sizeof(pi.name));
+    pi.priority = p->priority;
+    pi.cpu = p->lastcpu;
+    pi.tickets = p->tickets;
+    memmove(pi.ticks, p->lvticks, sizeof(pi.ticks));
+    pi.nsched = p->nsched;
+    pi.waitticks = p->waitticks;
+    if(p->state == RUNNABLE)
+      pi.waitticks += ticks - p->queuedat;
+    pi.ndemote = p->ndemote;
+    pi.nboost = p->nboost;
+    upi[k++] = pi;
+  }
+  release(&ptable.lock);
+  return k;
+}
 
-  for(struct proc *p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->state == UNUSED || p->state == ZOMBIE)
-      continue;
+// Copy every CPU's wakeup latency histograms to the user buffer ulh
+// (already checked by the caller) and clear them if reset is set.
+// Counters are updated without a lock, so a concurrent copy or reset
+// may be off by the few wakeups in flight.  Returns ncpu.
+int
+getlathist(struct lathist *ulh, int reset)
+{
+  int i;
+
+  for(i = 0; i < NCPU; i++){
+    if(i < ncpu)
+      memmove(ulh->hist[i], cpus[i].lathist, sizeof(ulh->hist[i]));
+    else
+      memset(ulh->hist[i], 0, sizeof(ulh->hist[i]));
+    if(reset)
+      memset(cpus[i].lathist, 0, sizeof(cpus[i].lathist));
+  }
+  return ncpu;
+}
 
-    // reset về top
-    p->priority = 0;
-    p->ticks = 0;
+// Restrict process pid (0 = caller) to the CPUs in mask.  A queued
+// process on a CPU it may no longer use moves right away, the caller
+// moves before returning, and any other running process moves the
+// next time it is preempted.
+int
+setaffinity(int pid, uint mask)
+{
+  struct proc *p;
+  int move;
 
-    // nếu đang RUNNABLE thì đảm bảo nó nằm trong queue level 0
-    if(p->state == RUNNABLE){
-      mlfq_enqueue(0, p);
-    }
+  mask &= (1U << ncpu) - 1;
+  if(mask == 0)
+    return -1;
+
+  acquire(&ptable.lock);
+  p = pid ? findproc(pid) : myproc();
+  if(p == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  acquire(&p->lock);
+  if(p->rtperiod && !((mask >> p->rtcpu) & 1)){
+    // would strand its real-time reservation
+    release(&p->lock);
+    release(&ptable.lock);
+    return -1;
   }
+  p->cpumask = mask;
+  // If a scheduler popped p meanwhile, it is about to run it anyway.
+  if(p->rqcpu >= 0 && !cpu_allowed(p, &cpus[p->rqcpu]) && rq_remove(p) >= 0)
+    sched_enqueue(p);
+  move = p == myproc() && !cpu_allowed(p, mycpu());
+  release(&p->lock);
+  release(&ptable.lock);
+  if(move)
+    yield();
+  return 0;
+}
 
+// CPU mask of process pid (0 = caller), or 0 if there is none.
+uint
+getaffinity(int pid)
+{
+  struct proc *p;
+  uint mask = 0;
+
+  acquire(&ptable.lock);
+  if((p = pid ? findproc(pid) : myproc()) != 0)
+    mask = p->cpumask;
   release(&ptable.lock);
+  return mask;
+}
+
+// ----- Sleeplock priority inheritance (see sleeplock.c) -----
+// p->inherited is the best MLFQ level lent to p by processes waiting
+// for sleeplocks it holds; the MLFQ queues p at the better of that and
+// its own level.
+
+// The level p currently competes at, which is also what it lends.
+int
+sched_effprio(struct proc *p)
+{
+  return p->priority < p->inherited ? p->priority : p->inherited;
+}
+
+// A waiter at level lvl is blocked on a lock p holds.
+void
+sched_inherit(struct proc *p, int lvl)
+{
+  int cpu;
+
+  acquire(&p->lock);
+  if(lvl < p->inherited){
+    cpu = rq_remove(p);
+    p->inherited = lvl;
+    if(cpu >= 0)
+      rq_insert(&cpus[cpu], p);
+  }
+  release(&p->lock);
+}
+
+// p released a lock: recompute what its remaining locks still lend.
+// Done under p->lock so it cannot undo a concurrent sched_inherit().
+void
+sched_uninherit(struct proc *p)
+{
+  struct sleeplock *lk;
+  int lvl = NQUEUE, cpu;
+
+  acquire(&p->lock);
+  for(lk = p->heldlocks; lk; lk = lk->nextheld)
+    if(lk->waitprio < lvl)
+      lvl = lk->waitprio;
+  cpu = rq_remove(p);
+  p->inherited = lvl;
+  if(cpu >= 0)
+    rq_insert(&cpus[cpu], p);
+  release(&p->lock);
+}
+
+// Timer tick for the running process p (no locks held): charge it
+// to the policy.  Returns 1 if p should give up the CPU.
+int
+sched_tick(struct proc *p)
+{
+  p->lvticks[p->priority]++;
+  if(class_of(p)->tick(p))
+    return 1;
+  return edf_preempts(mycpu(), p);
+}
+
+// Ticks until sched_tick() would next preempt p, for one-shot timers.
+int
+sched_slice(struct proc *p)
+{
+  struct sched_class *cl = class_of(p);
+
+  return cl->slice ? cl->slice(p) : 1;
+}
+
+// Anti-starvation, run by each CPU on its own queue every tick: the
+// policy picks out processes that have waited too long and raises
+// them, and they are requeued so the new rank applies.  No sweep over
+// the process table, and nobody else's rank changes.
+void
+sched_age(void)
+{
+  struct cpu *c = mycpu();   // called from trap(), interrupts are off
+  struct proc *p;
+
+  if(schedclass->age == 0 || schedparams.boost_ticks == 0 ||
+     c->rq.nrunnable == 0)
+    return;
+
+  acquire(&c->rq.lock);
+  while((p = schedclass->age(c)) != 0){
+    p->waitticks += ticks - p->queuedat;   // rq_add() restarts the wait
+    rq_del(p);
+    rq_add(c, p);
+  }
+  release(&c->rq.lock);
+}
+
+// Switch every CPU to scheduling policy id.  Queued processes are
+// moved from the old policy's queues to the new one's on the same CPU.
+// Returns the previous policy; a negative id only queries it.
+int
+setpolicy(int id)
+{
+  struct sched_class *old;
+  struct cpu *c;
+  struct proc *p;
+  int oldid;
+
+  rq_lockall();
+  old = schedclass;
+  for(oldid = 0; policies[oldid] != old; oldid++)
+    ;
+  if(id < 0 || id == oldid){
+    rq_unlockall();
+    return oldid;
+  }
+  if(id >= NELEM(policies)){
+    rq_unlockall();
+    return -1;
+  }
+
+  for(c = cpus; c < cpus+ncpu; c++){
+    while((p = old->pick(c)) != 0){
+      old->dequeue(p);
+      policies[id]->enqueue(c, p);
+    }
+  }
+  schedclass = policies[id];
+  rq_unlockall();
+  return oldid;
+}
+
+// Give up the reservation of p, which is running and holds p->lock.
+static void
+rt_drop(struct proc *p)
+{
+  struct cpu *c;
+
+  if(p->rtperiod == 0)
+    return;
+  c = &cpus[p->rtcpu];
+  acquire(&c->rq.lock);
+  c->rq.edf.util -= p->rtutil;
+  release(&c->rq.lock);
+  p->rtperiod = 0;
+  p->rtcpu = -1;
+  p->rtutil = 0;
+}
+
+// Utilization c could still give p, counting p's own reservation
+// there as free since a new one replaces it.
+static int
+rt_room(struct proc *p, struct cpu *c)
+{
+  int room = RT_MAXUTIL - c->rq.edf.util;
+
+  if(p->rtperiod && p->rtcpu == c - cpus)
+    room += p->rtutil;
+  return room;
 }
 
+// Make the caller a real-time process: every period ticks it may run
+// for budget ticks, to be done deadline ticks (0 = period) after the
+// release.  Admission control reserves budget/deadline of the
+// allowed CPU with the most room left and fails if none has enough.
+// A period of 0 makes the caller an ordinary process again.
+int
+setrt(int period, int budget, int deadline)
+{
+  struct proc *p = myproc();
+  struct cpu *c, *best;
+  int util, room, bestroom, move;
+
+  if(period == 0){
+    acquire(&p->lock);
+    rt_drop(p);
+    release(&p->lock);
+    return 0;
+  }
+  if(deadline == 0)
+    deadline = period;
+  if(budget < 1 || budget > deadline || deadline > period ||
+     period > RT_MAXPERIOD)
+    return -1;
+  util = edf_util(budget, deadline);
+
+  // Reservations are read without their locks to choose a CPU, so
+  // the choice is rechecked under its lock; try again if we lost.
+  acquire(&p->lock);
+  for(;;){
+    best = 0;
+    bestroom = 0;
+    for(c = cpus; c < cpus+ncpu; c++){
+      if(!c->started || !((p->cpumask >> (c - cpus)) & 1))
+        continue;
+      room = rt_room(p, c);
+      if(room >= util && (best == 0 || room > bestroom)){
+        best = c;
+        bestroom = room;
+      }
+    }
+    if(best == 0){
+      release(&p->lock);
+      return -1;
+    }
+    acquire(&best->rq.lock);
+    if(rt_room(p, best) >= util)
+      break;
+    release(&best->rq.lock);
+  }
+  if(p->rtperiod && p->rtcpu == best - cpus){
+    best->rq.edf.util -= p->rtutil;
+    p->rtperiod = 0;
+  }
+  best->rq.edf.util += util;
+  release(&best->rq.lock);
+  rt_drop(p);   // old reservation elsewhere, if any
+
+  p->rtperiod = period;
+  p->rtbudget = budget;
+  p->rtdeadline = deadline;
+  p->rtcpu = best - cpus;
+  p->rtutil = util;
+  p->rtrelease = ticks;
+  p->rtdl = ticks + deadline;
+  p->rtleft = budget;
+  move = best != mycpu();
+  release(&p->lock);
+  if(move)
+    yield();
+  return 0;
+}
+
+// Give the calling process n stride tickets; children inherit them.
+int
+settickets(int n)
+{
+  struct proc *p = myproc();
+
+  if(n < 1 || n > STRIDE_MAXTICKETS)
+    return -1;
+  acquire(&p->lock);
+  stride_settickets(p, n);
+  release(&p->lock);
+  return 0;
+}
+
+// Install new tuning parameters.  Processes sitting on levels that
+// are no longer active are moved to the new lowest level.
+int
+setschedparams(struct schedparams *sp)
+{
+  int i, cpu;
+
+  if(sp->nlevels < 1 || sp->nlevels > NQUEUE || sp->boost_ticks < 0 ||
+     (sp->tickless != 0 && sp->tickless != 1))
+    return -1;
+  for(i = 0; i < sp->nlevels; i++)
+    if(sp->quantum[i] < 1)
+      return -1;
+
+  rq_lockall();
+  schedparams = *sp;
+  for(i = sp->nlevels; i < NQUEUE; i++)
+    schedparams.quantum[i] = sp->quantum[sp->nlevels - 1];
+  rq_unlockall();
+
+  acquire(&ptable.lock);
+  for(struct proc *p = ptable.all; p; p = p->allnext){
+    acquire(&p->lock);
+    if(p->priority >= sp->nlevels){
+      cpu = rq_remove(p);
+      p->priority = sp->nlevels - 1;
+      p->allot = 0;
+      if(cpu >= 0)
+        rq_insert(&cpus[cpu], p);
+    }
+    release(&p->lock);
+  }
+  release(&ptable.lock);
+  return 0;
+}
@@ -1,10 +1,51 @@
 #ifndef PROC_H
 #define PROC_H
 
-// ---------------- Per-CPU state ----------------
+#include "spinlock.h"   // embedded in struct rq and struct proc
+#include "sleeplock.h"  // embedded in struct vmspace
+
+// ---------------- MLFQ config ----------------
+// Queues are sized for NMLFQ levels; schedparams.nlevels of them are
+// in use.  See sched.h and setschedparams().
+#define NQUEUE NMLFQ
+
 struct context; // forward
+struct proc;    // forward
+
+// ---------------- Per-CPU run queue ----------------
+// Every CPU owns one of these, protected by its own lock.  Only the
+// part belonging to the active policy (schedclass) is in use.
+// nrunnable and the list heads may be read without the lock as hints.
+
+// MLFQ (mlfq.c): each level is a doubly linked list threaded through
+// struct proc, and bit i of nonempty is set iff level i is non-empty.
+struct mlfq {
+  struct proc *head[NQUEUE];
+  struct proc *tail[NQUEUE];
+  uint nonempty;                // bitmap of non-empty levels
+};
+
+// Stride (stride.c): one list sorted by pass, lowest first.
+struct stride {
+  struct proc *head;
+  uint vtime;                   // pass of the last process picked here
+};
+
+// EDF real-time class (edf.c): one list sorted by absolute deadline.
+struct edf {
+  struct proc *head;
+  int util;                     // reserved by admitted processes, per-mille
+};
+
+struct rq {
+  struct spinlock lock;
+  volatile int nrunnable;       // processes queued here
+  struct edf edf;               // runs before the policy's queues
+  struct mlfq mlfq;
+  struct stride stride;
+};
 
-// Per-CPU state
+// ---------------- Per-CPU state ----------------
 struct cpu {
   uchar apicid;                 // Local APIC ID
   struct context *scheduler;    // swtch() here to enter scheduler
@@ -14,6 +55,13 @@ struct cpu {
   int ncli;                     // Depth of pushcli nesting.
   int intena;                   // Were interrupts enabled before pushcli?
   struct proc *proc;            // The process running on this cpu or null
+  struct rq rq;                 // This CPU's run queue
+  volatile uint idle;           // Halted in scheduler, needs an IPI to wake
+  uint lathist[NQUEUE][NLATBUCKET]; // wakeup-to-run latency, see getlathist()
+  volatile int tmode;           // LAPIC timer state (TM_* in trap.c)
+  uint tslice;                  // ticks the pending one-shot stands for
+  volatile uint tlbreq;         // TLB flushes asked of this CPU
+  volatile uint tlbdone;        // tlbreq as of its last flush
 };
 
 // Make cpus and ncpu available to C files
@@ -29,25 +77,49 @@ struct context {
   uint eip;
 };
 
+// ---------------- Address spaces ----------------
+// A user address space, shared by a process and the threads it
+// creates with clone().  lock serializes changes to its size (and
+// fork's copy of it); the last reference frees the page table.
+struct vmspace {
+  struct sleeplock lock;
+  int ref;                 // processes using it, changed atomically
+  pde_t *pgdir;            // page table
+  uint sz;                 // size of user memory (bytes)
+  int busy;                // its processes in a system call, changed atomically
+  int cow;                 // may have copy-on-write pages (ref is 1)
+};
+
 // ---------------- Process states ----------------
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
-// ---------------- MLFQ config ----------------
-#define MLFQ_LEVELS 3
-#define QUEUE_SIZE 64
-#define NQUEUE MLFQ_LEVELS
-
 // ---------------- Per-process structure ----------------
+// p->lock protects state, chan and killed, and is held across the
+// switch into and out of the process (see scheduler()).
 struct proc {
-  uint sz;                 // Size of process memory (bytes)
-  pde_t* pgdir;            // Page table
+  struct spinlock lock;
+  struct vmspace *vm;      // user memory, shared with our threads
+  void *ustack;            // user stack passed to clone(), for join()
+  int insyscall;           // counted in vm->busy
   char *kstack;            // Bottom of kernel stack
   enum procstate state;    // Process state
   int pid;                 // Process ID
   struct proc *parent;     // Parent process
+  struct proc *children;   // our children, linked through sibling
+  struct proc *sibling;
+  struct proc *sibprev;
+  struct proc *allnext;    // ptable.all
+  struct proc *allprev;
+  struct proc *hashnext;   // pid hash chain
   struct trapframe *tf;    // Trap frame for current syscall
   struct context *context; // swtch() here to run process
-  void *chan;              // If non-zero, sleeping on chan
+  void *chan;              // If non-zero, on chan's wait queue
+  struct proc *wqnext;     // links on chan's wait queue bucket
+  struct proc *wqprev;
+  uint deadline;           // timersleep() wake-up tick
+  int tmlinked;            // on the timer wheel (timer.c)
+  struct proc *tmnext;     // timer wheel slot links
+  struct proc *tmprev;
   int killed;              // If non-zero, have been killed
   struct file *ofile[NOFILE]; // Open files
   struct inode *cwd;       // Current directory
@@ -55,25 +127,71 @@ struct proc {
 
   // ---------- MLFQ fields ----------
   int priority;            // 0 = highest
-  int ticks;               // ticks used in current queue
-};
+  uint64 allot;            // TSC cycles used at this level, see mlfq_charge()
+  int rqlevel;             // level we are queued on
 
-// ---------------- MLFQ struct ----------------
-struct mlfq {
-  struct proc *queue[NQUEUE][QUEUE_SIZE];
-  int head[NQUEUE];
-  int tail[NQUEUE];
+  // ---------- Stride fields ----------
+  int tickets;             // CPU share, 1..STRIDE_MAXTICKETS
+  uint stride;             // pass advance per tick
+  uint pass;               // lowest pass runs next
+
+  // ---------- EDF real-time fields (period 0 = not real-time) ----------
+  int rtperiod;            // ticks between job releases
+  int rtbudget;            // ticks each job may run
+  int rtdeadline;          // job deadline, ticks after its release
+  int rtcpu;               // CPU holding our reservation, -1 if none
+  int rtutil;              // that reservation, per-mille
+  uint rtrelease;          // tick the current job was released
+  uint rtdl;               // its absolute deadline
+  int rtleft;              // budget left in the current job
+
+  // ---------- Run queue placement ----------
+  int rqcpu;               // CPU whose run queue holds us, -1 if none
+  struct proc *rqnext;     // run queue links, owned by the policy
+  struct proc *rqprev;
+  int lastcpu;             // CPU we last ran on (placement hint)
+  uint cpumask;            // CPUs we may run on, bit i = cpus[i]
+
+  // ---------- Sleeplock priority inheritance ----------
+  int inherited;           // best level lent by waiters, NQUEUE if none
+  struct sleeplock *heldlocks; // sleeplocks we hold (sleeplock.c)
+
+  // ---------- Scheduler statistics (see struct pinfo) ----------
+  int lvticks[NQUEUE];     // ticks used at each level
+  uint nsched;             // times picked by scheduler()
+  uint waitticks;          // ticks spent queued but not running
+  uint queuedat;           // ticks when last put on a run queue
+  uint ndemote;
+  uint nboost;
+  uint64 wakets;           // TSC when last woken, 0 if not pending
+  uint64 runstart;         // TSC when last switched in
 };
 
-extern struct mlfq mlfq;
+// ---------------- Scheduling policies ----------------
+// A policy orders the processes on each CPU's run queue.  Queue hooks
+// (enqueue, dequeue, pick, age) run with that CPU's rq.lock held;
+// charge runs with p->lock held as p leaves the CPU; tick and slice
+// are called for the running process without locks.  p->rqcpu and
+// rq.nrunnable are kept by proc.c.
+struct sched_class {
+  char *name;
+  void (*enqueue)(struct cpu *c, struct proc *p); // queue runnable p on c
+  void (*dequeue)(struct proc *p);                // unlink p from its queue
+  struct proc* (*pick)(struct cpu *c);            // best on c, left queued
+  int  (*tick)(struct proc *p);                   // p ran a tick; 1 = preempt
+  int  (*slice)(struct proc *p);                  // ticks until tick() preempts
+  void (*charge)(struct proc *p, uint64 cycles);  // p ran cycles, may be 0
+  struct proc* (*age)(struct cpu *c);             // promote a starved one, may be 0
+};
 
-// ---------------- MLFQ helper functions ----------------
-void mlfq_init(void);
-void mlfq_enqueue(int level, struct proc *p);
-void mlfq_remove(struct proc *p);
-int  in_mlfq(struct proc *p);
-struct proc* mlfq_pick_next(void);
-void mlfq_boost_all(void);
+extern struct sched_class *schedclass;
+extern struct sched_class mlfq_class;    // mlfq.c
+extern struct sched_class stride_class;  // stride.c
+extern struct sched_class edf_class;     // edf.c, above schedclass
+void stride_settickets(struct proc *p, int tickets);
+int  edf_util(int budget, int deadline);
+int  edf_preempts(struct cpu *c, struct proc *p);
+void edf_throttle(void);
 
 
 #endif // PROC_H
@@ -0,0 +1,1450 @@
+
+_ps:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return pi;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	31 ff                	xor    %edi,%edi
+  10:	56                   	push   %esi
+  11:	53                   	push   %ebx
+  12:	51                   	push   %ecx
+  13:	83 ec 58             	sub    $0x58,%esp
+  struct schedparams sp;
+  struct pinfo *pi, *p;
+  int i, n, raw;
+
+  raw = argc > 1 && strcmp(argv[1], "-r") == 0;
+  16:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  19:	8b 41 04             	mov    0x4(%ecx),%eax
+  raw = argc > 1 && strcmp(argv[1], "-r") == 0;
+  1c:	7e 1c                	jle    3a <main+0x3a>
+  1e:	53                   	push   %ebx
+  1f:	53                   	push   %ebx
+  20:	68 60 09 00 00       	push   $0x960
+  25:	ff 70 04             	push   0x4(%eax)
+  28:	e8 c3 01 00 00       	call   1f0 <strcmp>
+  2d:	83 c4 10             	add    $0x10,%esp
+  30:	85 c0                	test   %eax,%eax
+  32:	0f 94 c0             	sete   %al
+  35:	0f b6 c0             	movzbl %al,%eax
+  38:	89 c7                	mov    %eax,%edi
+  if(getschedparams(&sp) < 0 || (pi = snapshot(&n)) == 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	8d 45 bc             	lea    -0x44(%ebp),%eax
+  for(max = NPROC; ; max *= 2){
+  40:	be e8 03 00 00       	mov    $0x3e8,%esi
+  if(getschedparams(&sp) < 0 || (pi = snapshot(&n)) == 0){
+  45:	50                   	push   %eax
+  46:	e8 dd 04 00 00       	call   528 <getschedparams>
+  4b:	83 c4 10             	add    $0x10,%esp
+  4e:	85 c0                	test   %eax,%eax
+  50:	79 2d                	jns    7f <main+0x7f>
+  52:	eb 40                	jmp    94 <main+0x94>
+  54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((n = getpinfo(pi, max)) < 0){
+  58:	83 ec 08             	sub    $0x8,%esp
+  5b:	56                   	push   %esi
+  5c:	50                   	push   %eax
+  5d:	e8 d6 04 00 00       	call   538 <getpinfo>
+  62:	83 c4 10             	add    $0x10,%esp
+  65:	85 c0                	test   %eax,%eax
+  67:	0f 88 24 01 00 00    	js     191 <main+0x191>
+    if(n < max)
+  6d:	39 c6                	cmp    %eax,%esi
+  6f:	7f 36                	jg     a7 <main+0xa7>
+    free(pi);
+  71:	83 ec 0c             	sub    $0xc,%esp
+  for(max = NPROC; ; max *= 2){
+  74:	01 f6                	add    %esi,%esi
+    free(pi);
+  76:	53                   	push   %ebx
+  77:	e8 64 07 00 00       	call   7e0 <free>
+    if((pi = malloc(max * sizeof(*pi))) == 0)
+  7c:	83 c4 10             	add    $0x10,%esp
+  7f:	6b c6 54             	imul   $0x54,%esi,%eax
+  82:	83 ec 0c             	sub    $0xc,%esp
+  85:	50                   	push   %eax
+  86:	e8 e5 07 00 00       	call   870 <malloc>
+  8b:	83 c4 10             	add    $0x10,%esp
+  8e:	89 c3                	mov    %eax,%ebx
+  90:	85 c0                	test   %eax,%eax
+  92:	75 c4                	jne    58 <main+0x58>
+    printf(2, "ps: cannot read process info\n");
+  94:	51                   	push   %ecx
+  95:	51                   	push   %ecx
+  96:	68 63 09 00 00       	push   $0x963
+  9b:	6a 02                	push   $0x2
+  9d:	e8 8e 05 00 00       	call   630 <printf>
+    exit();
+  a2:	e8 d9 03 00 00       	call   480 <exit>
+  }
+
+  if(!raw)
+  a7:	85 ff                	test   %edi,%edi
+  a9:	0f 84 f3 00 00 00    	je     1a2 <main+0x1a2>
+    printf(1, "pid\tstate\tlevel\ttickets\tcpu\tsched\twait\tdemote\tboost\tname\tticks\n");
+  for(p = pi; p < pi + n; p++){
+  af:	6b f0 54             	imul   $0x54,%eax,%esi
+    if((pi = malloc(max * sizeof(*pi))) == 0)
+  b2:	89 df                	mov    %ebx,%edi
+  for(p = pi; p < pi + n; p++){
+  b4:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  b7:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  ba:	39 c3                	cmp    %eax,%ebx
+  bc:	0f 83 c1 00 00 00    	jae    183 <main+0x183>
+  c2:	89 5d 9c             	mov    %ebx,-0x64(%ebp)
+  c5:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%d\t%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%s\t",
+  c8:	8b 47 4c             	mov    0x4c(%edi),%eax
+           p->pid,
+           (uint)p->state < NSTATE ? states[p->state] : "???",
+  cb:	8b 57 04             	mov    0x4(%edi),%edx
+           p->priority, p->tickets, p->cpu, p->nsched, p->waitticks,
+           p->ndemote, p->nboost, p->name);
+  ce:	8d 77 08             	lea    0x8(%edi),%esi
+    printf(1, "%d\t%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%s\t",
+  d1:	8b 5f 50             	mov    0x50(%edi),%ebx
+  d4:	8b 4f 18             	mov    0x18(%edi),%ecx
+  d7:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  da:	8b 47 48             	mov    0x48(%edi),%eax
+  dd:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  e0:	8b 47 44             	mov    0x44(%edi),%eax
+  e3:	89 45 ac             	mov    %eax,-0x54(%ebp)
+  e6:	8b 47 1c             	mov    0x1c(%edi),%eax
+  e9:	89 45 a8             	mov    %eax,-0x58(%ebp)
+  ec:	8b 47 20             	mov    0x20(%edi),%eax
+  ef:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  f2:	b8 58 09 00 00       	mov    $0x958,%eax
+  f7:	83 fa 05             	cmp    $0x5,%edx
+  fa:	77 07                	ja     103 <main+0x103>
+  fc:	8b 04 95 08 0a 00 00 	mov    0xa08(,%edx,4),%eax
+ 103:	56                   	push   %esi
+ 104:	53                   	push   %ebx
+ 105:	ff 75 b4             	push   -0x4c(%ebp)
+ 108:	ff 75 b0             	push   -0x50(%ebp)
+ 10b:	ff 75 ac             	push   -0x54(%ebp)
+ 10e:	ff 75 a8             	push   -0x58(%ebp)
+ 111:	ff 75 a4             	push   -0x5c(%ebp)
+ 114:	51                   	push   %ecx
+ 115:	50                   	push   %eax
+ 116:	ff 37                	push   (%edi)
+ 118:	68 e8 09 00 00       	push   $0x9e8
+ 11d:	6a 01                	push   $0x1
+ 11f:	e8 0c 05 00 00       	call   630 <printf>
+    for(i = 0; i < sp.nlevels; i++)
+ 124:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 127:	83 c4 30             	add    $0x30,%esp
+ 12a:	85 c0                	test   %eax,%eax
+ 12c:	7e 32                	jle    160 <main+0x160>
+      printf(1, i ? " %d" : "%d", p->ticks[i]);
+ 12e:	8b 57 24             	mov    0x24(%edi),%edx
+ 131:	31 db                	xor    %ebx,%ebx
+ 133:	b8 5d 09 00 00       	mov    $0x95d,%eax
+ 138:	eb 0f                	jmp    149 <main+0x149>
+ 13a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 140:	8b 54 9f 24          	mov    0x24(%edi,%ebx,4),%edx
+ 144:	b8 5c 09 00 00       	mov    $0x95c,%eax
+ 149:	83 ec 04             	sub    $0x4,%esp
+    for(i = 0; i < sp.nlevels; i++)
+ 14c:	83 c3 01             	add    $0x1,%ebx
+      printf(1, i ? " %d" : "%d", p->ticks[i]);
+ 14f:	52                   	push   %edx
+ 150:	50                   	push   %eax
+ 151:	6a 01                	push   $0x1
+ 153:	e8 d8 04 00 00       	call   630 <printf>
+    for(i = 0; i < sp.nlevels; i++)
+ 158:	83 c4 10             	add    $0x10,%esp
+ 15b:	39 5d bc             	cmp    %ebx,-0x44(%ebp)
+ 15e:	7f e0                	jg     140 <main+0x140>
+    printf(1, "\n");
+ 160:	83 ec 08             	sub    $0x8,%esp
+  for(p = pi; p < pi + n; p++){
+ 163:	83 c7 54             	add    $0x54,%edi
+    printf(1, "\n");
+ 166:	68 7f 09 00 00       	push   $0x97f
+ 16b:	6a 01                	push   $0x1
+ 16d:	e8 be 04 00 00       	call   630 <printf>
+  for(p = pi; p < pi + n; p++){
+ 172:	8b 45 a0             	mov    -0x60(%ebp),%eax
+ 175:	83 c4 10             	add    $0x10,%esp
+ 178:	39 c7                	cmp    %eax,%edi
+ 17a:	0f 82 48 ff ff ff    	jb     c8 <main+0xc8>
+ 180:	8b 5d 9c             	mov    -0x64(%ebp),%ebx
+  }
+  free(pi);
+ 183:	83 ec 0c             	sub    $0xc,%esp
+ 186:	53                   	push   %ebx
+ 187:	e8 54 06 00 00       	call   7e0 <free>
+  exit();
+ 18c:	e8 ef 02 00 00       	call   480 <exit>
+      free(pi);
+ 191:	83 ec 0c             	sub    $0xc,%esp
+ 194:	53                   	push   %ebx
+ 195:	e8 46 06 00 00       	call   7e0 <free>
+ 19a:	83 c4 10             	add    $0x10,%esp
+ 19d:	e9 f2 fe ff ff       	jmp    94 <main+0x94>
+ 1a2:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+    printf(1, "pid\tstate\tlevel\ttickets\tcpu\tsched\twait\tdemote\tboost\tname\tticks\n");
+ 1a5:	52                   	push   %edx
+ 1a6:	52                   	push   %edx
+ 1a7:	68 a8 09 00 00       	push   $0x9a8
+ 1ac:	6a 01                	push   $0x1
+ 1ae:	e8 7d 04 00 00       	call   630 <printf>
+ 1b3:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+ 1b6:	83 c4 10             	add    $0x10,%esp
+ 1b9:	e9 f1 fe ff ff       	jmp    af <main+0xaf>
+ 1be:	66 90                	xchg   %ax,%ax
+
+000001c0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1c1:	31 c0                	xor    %eax,%eax
+{
+ 1c3:	89 e5                	mov    %esp,%ebp
+ 1c5:	53                   	push   %ebx
+ 1c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1d7:	83 c0 01             	add    $0x1,%eax
+ 1da:	84 d2                	test   %dl,%dl
+ 1dc:	75 f2                	jne    1d0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e1:	89 c8                	mov    %ecx,%eax
+ 1e3:	c9                   	leave
+ 1e4:	c3                   	ret
+ 1e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	53                   	push   %ebx
+ 1f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1fa:	0f b6 02             	movzbl (%edx),%eax
+ 1fd:	84 c0                	test   %al,%al
+ 1ff:	75 17                	jne    218 <strcmp+0x28>
+ 201:	eb 3a                	jmp    23d <strcmp+0x4d>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 20c:	83 c2 01             	add    $0x1,%edx
+ 20f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 212:	84 c0                	test   %al,%al
+ 214:	74 1a                	je     230 <strcmp+0x40>
+    p++, q++;
+ 216:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 218:	0f b6 19             	movzbl (%ecx),%ebx
+ 21b:	38 c3                	cmp    %al,%bl
+ 21d:	74 e9                	je     208 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 21f:	29 d8                	sub    %ebx,%eax
+}
+ 221:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 224:	c9                   	leave
+ 225:	c3                   	ret
+ 226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 230:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 234:	31 c0                	xor    %eax,%eax
+ 236:	29 d8                	sub    %ebx,%eax
+}
+ 238:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 23b:	c9                   	leave
+ 23c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 23d:	0f b6 19             	movzbl (%ecx),%ebx
+ 240:	31 c0                	xor    %eax,%eax
+ 242:	eb db                	jmp    21f <strcmp+0x2f>
+ 244:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+
+00000250 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 256:	80 3a 00             	cmpb   $0x0,(%edx)
+ 259:	74 15                	je     270 <strlen+0x20>
+ 25b:	31 c0                	xor    %eax,%eax
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+ 260:	83 c0 01             	add    $0x1,%eax
+ 263:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 267:	89 c1                	mov    %eax,%ecx
+ 269:	75 f5                	jne    260 <strlen+0x10>
+    ;
+  return n;
+}
+ 26b:	89 c8                	mov    %ecx,%eax
+ 26d:	5d                   	pop    %ebp
+ 26e:	c3                   	ret
+ 26f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 270:	31 c9                	xor    %ecx,%ecx
+}
+ 272:	5d                   	pop    %ebp
+ 273:	89 c8                	mov    %ecx,%eax
+ 275:	c3                   	ret
+ 276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000280 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 287:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 28a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 28d:	89 d7                	mov    %edx,%edi
+ 28f:	fc                   	cld
+ 290:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 292:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 295:	89 d0                	mov    %edx,%eax
+ 297:	c9                   	leave
+ 298:	c3                   	ret
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2aa:	0f b6 10             	movzbl (%eax),%edx
+ 2ad:	84 d2                	test   %dl,%dl
+ 2af:	75 12                	jne    2c3 <strchr+0x23>
+ 2b1:	eb 1d                	jmp    2d0 <strchr+0x30>
+ 2b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2b7:	90                   	nop
+ 2b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2bc:	83 c0 01             	add    $0x1,%eax
+ 2bf:	84 d2                	test   %dl,%dl
+ 2c1:	74 0d                	je     2d0 <strchr+0x30>
+    if(*s == c)
+ 2c3:	38 d1                	cmp    %dl,%cl
+ 2c5:	75 f1                	jne    2b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2c7:	5d                   	pop    %ebp
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2d0:	31 c0                	xor    %eax,%eax
+}
+ 2d2:	5d                   	pop    %ebp
+ 2d3:	c3                   	ret
+ 2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+
+000002e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2e9:	31 db                	xor    %ebx,%ebx
+{
+ 2eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ee:	eb 27                	jmp    317 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2f0:	83 ec 04             	sub    $0x4,%esp
+ 2f3:	6a 01                	push   $0x1
+ 2f5:	56                   	push   %esi
+ 2f6:	6a 00                	push   $0x0
+ 2f8:	e8 9b 01 00 00       	call   498 <read>
+    if(cc < 1)
+ 2fd:	83 c4 10             	add    $0x10,%esp
+ 300:	85 c0                	test   %eax,%eax
+ 302:	7e 1d                	jle    321 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 304:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 308:	8b 55 08             	mov    0x8(%ebp),%edx
+ 30b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 30f:	3c 0a                	cmp    $0xa,%al
+ 311:	74 10                	je     323 <gets+0x43>
+ 313:	3c 0d                	cmp    $0xd,%al
+ 315:	74 0c                	je     323 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 317:	89 df                	mov    %ebx,%edi
+ 319:	83 c3 01             	add    $0x1,%ebx
+ 31c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 31f:	7c cf                	jl     2f0 <gets+0x10>
+ 321:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 323:	8b 45 08             	mov    0x8(%ebp),%eax
+ 326:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 32a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 32d:	5b                   	pop    %ebx
+ 32e:	5e                   	pop    %esi
+ 32f:	5f                   	pop    %edi
+ 330:	5d                   	pop    %ebp
+ 331:	c3                   	ret
+ 332:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	56                   	push   %esi
+ 344:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 345:	83 ec 08             	sub    $0x8,%esp
+ 348:	6a 00                	push   $0x0
+ 34a:	ff 75 08             	push   0x8(%ebp)
+ 34d:	e8 6e 01 00 00       	call   4c0 <open>
+  if(fd < 0)
+ 352:	83 c4 10             	add    $0x10,%esp
+ 355:	85 c0                	test   %eax,%eax
+ 357:	78 27                	js     380 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 359:	83 ec 08             	sub    $0x8,%esp
+ 35c:	ff 75 0c             	push   0xc(%ebp)
+ 35f:	89 c3                	mov    %eax,%ebx
+ 361:	50                   	push   %eax
+ 362:	e8 71 01 00 00       	call   4d8 <fstat>
+  close(fd);
+ 367:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 36a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 36c:	e8 37 01 00 00       	call   4a8 <close>
+  return r;
+ 371:	83 c4 10             	add    $0x10,%esp
+}
+ 374:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 377:	89 f0                	mov    %esi,%eax
+ 379:	5b                   	pop    %ebx
+ 37a:	5e                   	pop    %esi
+ 37b:	5d                   	pop    %ebp
+ 37c:	c3                   	ret
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 380:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 385:	eb ed                	jmp    374 <stat+0x34>
+ 387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38e:	66 90                	xchg   %ax,%ax
+
+00000390 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	53                   	push   %ebx
+ 394:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 397:	0f be 02             	movsbl (%edx),%eax
+ 39a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 39d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3a5:	77 1e                	ja     3c5 <atoi+0x35>
+ 3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3b0:	83 c2 01             	add    $0x1,%edx
+ 3b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ba:	0f be 02             	movsbl (%edx),%eax
+ 3bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3c0:	80 fb 09             	cmp    $0x9,%bl
+ 3c3:	76 eb                	jbe    3b0 <atoi+0x20>
+  return n;
+}
+ 3c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c8:	89 c8                	mov    %ecx,%eax
+ 3ca:	c9                   	leave
+ 3cb:	c3                   	ret
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3de:	85 c0                	test   %eax,%eax
+ 3e0:	7e 13                	jle    3f5 <memmove+0x25>
+ 3e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3e4:	89 d7                	mov    %edx,%edi
+ 3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3f1:	39 f8                	cmp    %edi,%eax
+ 3f3:	75 fb                	jne    3f0 <memmove+0x20>
+  return vdst;
+}
+ 3f5:	5e                   	pop    %esi
+ 3f6:	89 d0                	mov    %edx,%eax
+ 3f8:	5f                   	pop    %edi
+ 3f9:	5d                   	pop    %ebp
+ 3fa:	c3                   	ret
+ 3fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <mutex_lock>:
+
+// Take and release m with atomic instructions, and enter the kernel
+// only to block while it is held or to wake a blocked thread.
+void
+mutex_lock(struct mutex *m)
+{
+ 400:	55                   	push   %ebp
+  uint s;
+
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 401:	31 c0                	xor    %eax,%eax
+ 403:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 408:	89 e5                	mov    %esp,%ebp
+ 40a:	56                   	push   %esi
+ 40b:	53                   	push   %ebx
+ 40c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 40f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 413:	85 c0                	test   %eax,%eax
+ 415:	74 30                	je     447 <mutex_lock+0x47>
+    return;
+  // Contended: mark it so the holder knows to wake us.
+  if(s != 2)
+ 417:	83 f8 02             	cmp    $0x2,%eax
+ 41a:	74 0c                	je     428 <mutex_lock+0x28>
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 41c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 421:	f0 87 03             	lock xchg %eax,(%ebx)
+    s = xchg(&m->state, 2);
+  while(s != 0){
+ 424:	85 c0                	test   %eax,%eax
+ 426:	74 1f                	je     447 <mutex_lock+0x47>
+ 428:	be 02 00 00 00       	mov    $0x2,%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+ 430:	83 ec 08             	sub    $0x8,%esp
+ 433:	6a 02                	push   $0x2
+ 435:	53                   	push   %ebx
+ 436:	e8 45 01 00 00       	call   580 <futex_wait>
+ 43b:	89 f0                	mov    %esi,%eax
+ 43d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(s != 0){
+ 440:	83 c4 10             	add    $0x10,%esp
+ 443:	85 c0                	test   %eax,%eax
+ 445:	75 e9                	jne    430 <mutex_lock+0x30>
+    s = xchg(&m->state, 2);
+  }
+}
+ 447:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 44a:	5b                   	pop    %ebx
+ 44b:	5e                   	pop    %esi
+ 44c:	5d                   	pop    %ebp
+ 44d:	c3                   	ret
+ 44e:	66 90                	xchg   %ax,%ax
+
+00000450 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 450:	55                   	push   %ebp
+ 451:	31 c0                	xor    %eax,%eax
+ 453:	89 e5                	mov    %esp,%ebp
+ 455:	83 ec 08             	sub    $0x8,%esp
+ 458:	8b 55 08             	mov    0x8(%ebp),%edx
+ 45b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 45e:	83 f8 02             	cmp    $0x2,%eax
+ 461:	74 05                	je     468 <mutex_unlock+0x18>
+    futex_wake(&m->state, 1);
+}
+ 463:	c9                   	leave
+ 464:	c3                   	ret
+ 465:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->state, 1);
+ 468:	83 ec 08             	sub    $0x8,%esp
+ 46b:	6a 01                	push   $0x1
+ 46d:	52                   	push   %edx
+ 46e:	e8 15 01 00 00       	call   588 <futex_wake>
+ 473:	83 c4 10             	add    $0x10,%esp
+}
+ 476:	c9                   	leave
+ 477:	c3                   	ret
+
+00000478 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 478:	b8 01 00 00 00       	mov    $0x1,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <exit>:
+SYSCALL(exit)
+ 480:	b8 02 00 00 00       	mov    $0x2,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <wait>:
+SYSCALL(wait)
+ 488:	b8 03 00 00 00       	mov    $0x3,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <pipe>:
+SYSCALL(pipe)
+ 490:	b8 04 00 00 00       	mov    $0x4,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <read>:
+SYSCALL(read)
+ 498:	b8 05 00 00 00       	mov    $0x5,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <write>:
+SYSCALL(write)
+ 4a0:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <close>:
+SYSCALL(close)
+ 4a8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <kill>:
+SYSCALL(kill)
+ 4b0:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <exec>:
+SYSCALL(exec)
+ 4b8:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <open>:
+SYSCALL(open)
+ 4c0:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <mknod>:
+SYSCALL(mknod)
+ 4c8:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <unlink>:
+SYSCALL(unlink)
+ 4d0:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <fstat>:
+SYSCALL(fstat)
+ 4d8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <link>:
+SYSCALL(link)
+ 4e0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+
+000004e8 <mkdir>:
+SYSCALL(mkdir)
+ 4e8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4ed:	cd 40                	int    $0x40
+ 4ef:	c3                   	ret
+
+000004f0 <chdir>:
+SYSCALL(chdir)
+ 4f0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4f5:	cd 40                	int    $0x40
+ 4f7:	c3                   	ret
+
+000004f8 <dup>:
+SYSCALL(dup)
+ 4f8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4fd:	cd 40                	int    $0x40
+ 4ff:	c3                   	ret
+
+00000500 <getpid>:
+SYSCALL(getpid)
+ 500:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 505:	cd 40                	int    $0x40
+ 507:	c3                   	ret
+
+00000508 <sbrk>:
+SYSCALL(sbrk)
+ 508:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <sleep>:
+SYSCALL(sleep)
+ 510:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <uptime>:
+SYSCALL(uptime)
+ 518:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <ps>:
+SYSCALL(ps)
+ 520:	b8 16 00 00 00       	mov    $0x16,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <getschedparams>:
+SYSCALL(getschedparams)
+ 528:	b8 17 00 00 00       	mov    $0x17,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <setschedparams>:
+SYSCALL(setschedparams)
+ 530:	b8 18 00 00 00       	mov    $0x18,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <getpinfo>:
+SYSCALL(getpinfo)
+ 538:	b8 19 00 00 00       	mov    $0x19,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <getlathist>:
+SYSCALL(getlathist)
+ 540:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <setpolicy>:
+SYSCALL(setpolicy)
+ 548:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <settickets>:
+SYSCALL(settickets)
+ 550:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <setaffinity>:
+SYSCALL(setaffinity)
+ 558:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <getaffinity>:
+SYSCALL(getaffinity)
+ 560:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 565:	cd 40                	int    $0x40
+ 567:	c3                   	ret
+
+00000568 <setrt>:
+SYSCALL(setrt)
+ 568:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 56d:	cd 40                	int    $0x40
+ 56f:	c3                   	ret
+
+00000570 <clone>:
+SYSCALL(clone)
+ 570:	b8 20 00 00 00       	mov    $0x20,%eax
+ 575:	cd 40                	int    $0x40
+ 577:	c3                   	ret
+
+00000578 <join>:
+SYSCALL(join)
+ 578:	b8 21 00 00 00       	mov    $0x21,%eax
+ 57d:	cd 40                	int    $0x40
+ 57f:	c3                   	ret
+
+00000580 <futex_wait>:
+SYSCALL(futex_wait)
+ 580:	b8 22 00 00 00       	mov    $0x22,%eax
+ 585:	cd 40                	int    $0x40
+ 587:	c3                   	ret
+
+00000588 <futex_wake>:
+SYSCALL(futex_wake)
+ 588:	b8 23 00 00 00       	mov    $0x23,%eax
+ 58d:	cd 40                	int    $0x40
+ 58f:	c3                   	ret
+
+00000590 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	56                   	push   %esi
+ 595:	53                   	push   %ebx
+ 596:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 598:	89 d1                	mov    %edx,%ecx
+{
+ 59a:	83 ec 3c             	sub    $0x3c,%esp
+ 59d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5a0:	85 d2                	test   %edx,%edx
+ 5a2:	0f 89 80 00 00 00    	jns    628 <printint+0x98>
+ 5a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5ac:	74 7a                	je     628 <printint+0x98>
+    x = -xx;
+ 5ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5b8:	31 f6                	xor    %esi,%esi
+ 5ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5c0:	89 c8                	mov    %ecx,%eax
+ 5c2:	31 d2                	xor    %edx,%edx
+ 5c4:	89 f7                	mov    %esi,%edi
+ 5c6:	f7 f3                	div    %ebx
+ 5c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5cb:	0f b6 92 80 0a 00 00 	movzbl 0xa80(%edx),%edx
+ 5d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5d6:	89 ca                	mov    %ecx,%edx
+ 5d8:	89 c1                	mov    %eax,%ecx
+ 5da:	39 da                	cmp    %ebx,%edx
+ 5dc:	73 e2                	jae    5c0 <printint+0x30>
+  if(neg)
+ 5de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5e1:	85 c0                	test   %eax,%eax
+ 5e3:	74 07                	je     5ec <printint+0x5c>
+    buf[i++] = '-';
+ 5e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5ea:	89 f7                	mov    %esi,%edi
+ 5ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5f2:	01 df                	add    %ebx,%edi
+ 5f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5fb:	83 ec 04             	sub    $0x4,%esp
+ 5fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 601:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 604:	6a 01                	push   $0x1
+ 606:	50                   	push   %eax
+ 607:	56                   	push   %esi
+ 608:	e8 93 fe ff ff       	call   4a0 <write>
+  while(--i >= 0)
+ 60d:	89 f8                	mov    %edi,%eax
+ 60f:	83 c4 10             	add    $0x10,%esp
+ 612:	83 ef 01             	sub    $0x1,%edi
+ 615:	39 d8                	cmp    %ebx,%eax
+ 617:	75 df                	jne    5f8 <printint+0x68>
+}
+ 619:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 61c:	5b                   	pop    %ebx
+ 61d:	5e                   	pop    %esi
+ 61e:	5f                   	pop    %edi
+ 61f:	5d                   	pop    %ebp
+ 620:	c3                   	ret
+ 621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 628:	31 c0                	xor    %eax,%eax
+ 62a:	eb 89                	jmp    5b5 <printint+0x25>
+ 62c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000630 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	57                   	push   %edi
+ 634:	56                   	push   %esi
+ 635:	53                   	push   %ebx
+ 636:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 639:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 63c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 63f:	0f b6 1e             	movzbl (%esi),%ebx
+ 642:	83 c6 01             	add    $0x1,%esi
+ 645:	84 db                	test   %bl,%bl
+ 647:	74 67                	je     6b0 <printf+0x80>
+ 649:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 64c:	31 d2                	xor    %edx,%edx
+ 64e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 651:	eb 34                	jmp    687 <printf+0x57>
+ 653:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 657:	90                   	nop
+ 658:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 65b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 660:	83 f8 25             	cmp    $0x25,%eax
+ 663:	74 18                	je     67d <printf+0x4d>
+  write(fd, &c, 1);
+ 665:	83 ec 04             	sub    $0x4,%esp
+ 668:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 66b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 66e:	6a 01                	push   $0x1
+ 670:	50                   	push   %eax
+ 671:	57                   	push   %edi
+ 672:	e8 29 fe ff ff       	call   4a0 <write>
+ 677:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 67a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 67d:	0f b6 1e             	movzbl (%esi),%ebx
+ 680:	83 c6 01             	add    $0x1,%esi
+ 683:	84 db                	test   %bl,%bl
+ 685:	74 29                	je     6b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 687:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 68a:	85 d2                	test   %edx,%edx
+ 68c:	74 ca                	je     658 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 68e:	83 fa 25             	cmp    $0x25,%edx
+ 691:	75 ea                	jne    67d <printf+0x4d>
+      if(c == 'd'){
+ 693:	83 f8 25             	cmp    $0x25,%eax
+ 696:	0f 84 24 01 00 00    	je     7c0 <printf+0x190>
+ 69c:	83 e8 63             	sub    $0x63,%eax
+ 69f:	83 f8 15             	cmp    $0x15,%eax
+ 6a2:	77 1c                	ja     6c0 <printf+0x90>
+ 6a4:	ff 24 85 28 0a 00 00 	jmp    *0xa28(,%eax,4)
+ 6ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6b3:	5b                   	pop    %ebx
+ 6b4:	5e                   	pop    %esi
+ 6b5:	5f                   	pop    %edi
+ 6b6:	5d                   	pop    %ebp
+ 6b7:	c3                   	ret
+ 6b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bf:	90                   	nop
+  write(fd, &c, 1);
+ 6c0:	83 ec 04             	sub    $0x4,%esp
+ 6c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ca:	6a 01                	push   $0x1
+ 6cc:	52                   	push   %edx
+ 6cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6d0:	57                   	push   %edi
+ 6d1:	e8 ca fd ff ff       	call   4a0 <write>
+ 6d6:	83 c4 0c             	add    $0xc,%esp
+ 6d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6dc:	6a 01                	push   $0x1
+ 6de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6e1:	52                   	push   %edx
+ 6e2:	57                   	push   %edi
+ 6e3:	e8 b8 fd ff ff       	call   4a0 <write>
+        putc(fd, c);
+ 6e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6eb:	31 d2                	xor    %edx,%edx
+ 6ed:	eb 8e                	jmp    67d <printf+0x4d>
+ 6ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6f3:	83 ec 0c             	sub    $0xc,%esp
+ 6f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6fb:	8b 13                	mov    (%ebx),%edx
+ 6fd:	6a 00                	push   $0x0
+ 6ff:	89 f8                	mov    %edi,%eax
+        ap++;
+ 701:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 704:	e8 87 fe ff ff       	call   590 <printint>
+        ap++;
+ 709:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 70c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 70f:	31 d2                	xor    %edx,%edx
+ 711:	e9 67 ff ff ff       	jmp    67d <printf+0x4d>
+ 716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 720:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 723:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 725:	83 c0 04             	add    $0x4,%eax
+ 728:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 72b:	85 db                	test   %ebx,%ebx
+ 72d:	0f 84 9d 00 00 00    	je     7d0 <printf+0x1a0>
+        while(*s != 0){
+ 733:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 736:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 738:	84 c0                	test   %al,%al
+ 73a:	0f 84 3d ff ff ff    	je     67d <printf+0x4d>
+ 740:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 743:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 746:	89 de                	mov    %ebx,%esi
+ 748:	89 d3                	mov    %edx,%ebx
+ 74a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 756:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 759:	6a 01                	push   $0x1
+ 75b:	53                   	push   %ebx
+ 75c:	57                   	push   %edi
+ 75d:	e8 3e fd ff ff       	call   4a0 <write>
+        while(*s != 0){
+ 762:	0f b6 06             	movzbl (%esi),%eax
+ 765:	83 c4 10             	add    $0x10,%esp
+ 768:	84 c0                	test   %al,%al
+ 76a:	75 e4                	jne    750 <printf+0x120>
+      state = 0;
+ 76c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 76f:	31 d2                	xor    %edx,%edx
+ 771:	e9 07 ff ff ff       	jmp    67d <printf+0x4d>
+ 776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 780:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 783:	83 ec 0c             	sub    $0xc,%esp
+ 786:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 78b:	8b 13                	mov    (%ebx),%edx
+ 78d:	6a 01                	push   $0x1
+ 78f:	e9 6b ff ff ff       	jmp    6ff <printf+0xcf>
+ 794:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 798:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 79b:	83 ec 04             	sub    $0x4,%esp
+ 79e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7a9:	6a 01                	push   $0x1
+ 7ab:	52                   	push   %edx
+ 7ac:	57                   	push   %edi
+ 7ad:	e8 ee fc ff ff       	call   4a0 <write>
+        ap++;
+ 7b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7b8:	31 d2                	xor    %edx,%edx
+ 7ba:	e9 be fe ff ff       	jmp    67d <printf+0x4d>
+ 7bf:	90                   	nop
+  write(fd, &c, 1);
+ 7c0:	83 ec 04             	sub    $0x4,%esp
+ 7c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7c9:	6a 01                	push   $0x1
+ 7cb:	e9 11 ff ff ff       	jmp    6e1 <printf+0xb1>
+ 7d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7d5:	bb 20 0a 00 00       	mov    $0xa20,%ebx
+ 7da:	e9 61 ff ff ff       	jmp    740 <printf+0x110>
+ 7df:	90                   	nop
+
+000007e0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7e0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7e1:	a1 7c 0d 00 00       	mov    0xd7c,%eax
+{
+ 7e6:	89 e5                	mov    %esp,%ebp
+ 7e8:	57                   	push   %edi
+ 7e9:	56                   	push   %esi
+ 7ea:	53                   	push   %ebx
+ 7eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7ee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7f8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7fa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7fc:	39 ca                	cmp    %ecx,%edx
+ 7fe:	73 30                	jae    830 <free+0x50>
+ 800:	39 c1                	cmp    %eax,%ecx
+ 802:	72 04                	jb     808 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 804:	39 c2                	cmp    %eax,%edx
+ 806:	72 f0                	jb     7f8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 808:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 80b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 80e:	39 f8                	cmp    %edi,%eax
+ 810:	74 2e                	je     840 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 812:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 815:	8b 42 04             	mov    0x4(%edx),%eax
+ 818:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 81b:	39 f1                	cmp    %esi,%ecx
+ 81d:	74 38                	je     857 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 81f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 821:	5b                   	pop    %ebx
+  freep = p;
+ 822:	89 15 7c 0d 00 00    	mov    %edx,0xd7c
+}
+ 828:	5e                   	pop    %esi
+ 829:	5f                   	pop    %edi
+ 82a:	5d                   	pop    %ebp
+ 82b:	c3                   	ret
+ 82c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 830:	39 c1                	cmp    %eax,%ecx
+ 832:	72 d0                	jb     804 <free+0x24>
+ 834:	eb c2                	jmp    7f8 <free+0x18>
+ 836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 840:	03 70 04             	add    0x4(%eax),%esi
+ 843:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 846:	8b 02                	mov    (%edx),%eax
+ 848:	8b 00                	mov    (%eax),%eax
+ 84a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 84d:	8b 42 04             	mov    0x4(%edx),%eax
+ 850:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 853:	39 f1                	cmp    %esi,%ecx
+ 855:	75 c8                	jne    81f <free+0x3f>
+    p->s.size += bp->s.size;
+ 857:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 85a:	89 15 7c 0d 00 00    	mov    %edx,0xd7c
+    p->s.size += bp->s.size;
+ 860:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 863:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 866:	89 0a                	mov    %ecx,(%edx)
+}
+ 868:	5b                   	pop    %ebx
+ 869:	5e                   	pop    %esi
+ 86a:	5f                   	pop    %edi
+ 86b:	5d                   	pop    %ebp
+ 86c:	c3                   	ret
+ 86d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000870 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 870:	55                   	push   %ebp
+ 871:	89 e5                	mov    %esp,%ebp
+ 873:	57                   	push   %edi
+ 874:	56                   	push   %esi
+ 875:	53                   	push   %ebx
+ 876:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 879:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 87c:	8b 15 7c 0d 00 00    	mov    0xd7c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 882:	8d 78 07             	lea    0x7(%eax),%edi
+ 885:	c1 ef 03             	shr    $0x3,%edi
+ 888:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 88b:	85 d2                	test   %edx,%edx
+ 88d:	0f 84 8d 00 00 00    	je     920 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 893:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 895:	8b 48 04             	mov    0x4(%eax),%ecx
+ 898:	39 f9                	cmp    %edi,%ecx
+ 89a:	73 64                	jae    900 <malloc+0x90>
+  if(nu < 4096)
+ 89c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8a1:	39 df                	cmp    %ebx,%edi
+ 8a3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8a6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8ad:	eb 0a                	jmp    8b9 <malloc+0x49>
+ 8af:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8b0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8b2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8b5:	39 f9                	cmp    %edi,%ecx
+ 8b7:	73 47                	jae    900 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8b9:	89 c2                	mov    %eax,%edx
+ 8bb:	39 05 7c 0d 00 00    	cmp    %eax,0xd7c
+ 8c1:	75 ed                	jne    8b0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8c3:	83 ec 0c             	sub    $0xc,%esp
+ 8c6:	56                   	push   %esi
+ 8c7:	e8 3c fc ff ff       	call   508 <sbrk>
+  if(p == (char*)-1)
+ 8cc:	83 c4 10             	add    $0x10,%esp
+ 8cf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8d2:	74 1c                	je     8f0 <malloc+0x80>
+  hp->s.size = nu;
+ 8d4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8d7:	83 ec 0c             	sub    $0xc,%esp
+ 8da:	83 c0 08             	add    $0x8,%eax
+ 8dd:	50                   	push   %eax
+ 8de:	e8 fd fe ff ff       	call   7e0 <free>
+  return freep;
+ 8e3:	8b 15 7c 0d 00 00    	mov    0xd7c,%edx
+      if((p = morecore(nunits)) == 0)
+ 8e9:	83 c4 10             	add    $0x10,%esp
+ 8ec:	85 d2                	test   %edx,%edx
+ 8ee:	75 c0                	jne    8b0 <malloc+0x40>
+        return 0;
+  }
+}
+ 8f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8f3:	31 c0                	xor    %eax,%eax
+}
+ 8f5:	5b                   	pop    %ebx
+ 8f6:	5e                   	pop    %esi
+ 8f7:	5f                   	pop    %edi
+ 8f8:	5d                   	pop    %ebp
+ 8f9:	c3                   	ret
+ 8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 900:	39 cf                	cmp    %ecx,%edi
+ 902:	74 4c                	je     950 <malloc+0xe0>
+        p->s.size -= nunits;
+ 904:	29 f9                	sub    %edi,%ecx
+ 906:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 909:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 90c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 90f:	89 15 7c 0d 00 00    	mov    %edx,0xd7c
+}
+ 915:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 918:	83 c0 08             	add    $0x8,%eax
+}
+ 91b:	5b                   	pop    %ebx
+ 91c:	5e                   	pop    %esi
+ 91d:	5f                   	pop    %edi
+ 91e:	5d                   	pop    %ebp
+ 91f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 920:	c7 05 7c 0d 00 00 80 	movl   $0xd80,0xd7c
+ 927:	0d 00 00 
+    base.s.size = 0;
+ 92a:	b8 80 0d 00 00       	mov    $0xd80,%eax
+    base.s.ptr = freep = prevp = &base;
+ 92f:	c7 05 80 0d 00 00 80 	movl   $0xd80,0xd80
+ 936:	0d 00 00 
+    base.s.size = 0;
+ 939:	c7 05 84 0d 00 00 00 	movl   $0x0,0xd84
+ 940:	00 00 00 
+    if(p->s.size >= nunits){
+ 943:	e9 54 ff ff ff       	jmp    89c <malloc+0x2c>
+ 948:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 950:	8b 08                	mov    (%eax),%ecx
+ 952:	89 0a                	mov    %ecx,(%edx)
+ 954:	eb b9                	jmp    90f <malloc+0x9f>
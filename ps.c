@@ -1,11 +1,69 @@
 #include "types.h"
 #include "stat.h"
+#include "param.h"
+#include "sched.h"
 #include "user.h"
 
+// List processes with their MLFQ statistics, one line each:
+//   pid state level tickets cpu sched wait demote boost name  ticks: l0 l1 ...
+// (boost counts promotions by aging)
+// Usage:
+//   ps          -> table with a header
+//   ps -r       -> raw lines only, no header (for scripts)
+
+// Indexed by enum procstate in proc.h.
+static char *states[] = {
+  "unused", "embryo", "sleep", "runble", "run", "zombie"
+};
+#define NSTATE (sizeof(states)/sizeof(states[0]))
+
+static struct pinfo*
+snapshot(int *np)
+{
+  struct pinfo *pi;
+  int n, max;
+
+  // Grow the buffer until it holds every process.
+  for(max = NPROC; ; max *= 2){
+    if((pi = malloc(max * sizeof(*pi))) == 0)
+      return 0;
+    if((n = getpinfo(pi, max)) < 0){
+      free(pi);
+      return 0;
+    }
+    if(n < max)
+      break;
+    free(pi);
+  }
+  *np = n;
+  return pi;
+}
+
 int
-main(void)
+main(int argc, char *argv[])
 {
-  ps(); // gọi syscall ps
+  struct schedparams sp;
+  struct pinfo *pi, *p;
+  int i, n, raw;
+
+  raw = argc > 1 && strcmp(argv[1], "-r") == 0;
+  if(getschedparams(&sp) < 0 || (pi = snapshot(&n)) == 0){
+    printf(2, "ps: cannot read process info\n");
+    exit();
+  }
+
+  if(!raw)
+    printf(1, "pid\tstate\tlevel\ttickets\tcpu\tsched\twait\tdemote\tboost\tname\tticks\n");
+  for(p = pi; p < pi + n; p++){
+    printf(1, "%d\t%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%s\t",
+           p->pid,
+           (uint)p->state < NSTATE ? states[p->state] : "???",
+           p->priority, p->tickets, p->cpu, p->nsched, p->waitticks,
+           p->ndemote, p->nboost, p->name);
+    for(i = 0; i < sp.nlevels; i++)
+      printf(1, i ? " %d" : "%d", p->ticks[i]);
+    printf(1, "\n");
+  }
+  free(pi);
   exit();
 }
-
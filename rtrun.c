@@ -0,0 +1,30 @@
+#include "types.h"
+#include "stat.h"
+#include "param.h"
+#include "sched.h"
+#include "user.h"
+
+// Run a command as an EDF real-time process.  Times are in ticks.
+// Usage:
+//   rtrun <period> <budget> <deadline> <cmd> [args...]
+// A deadline of 0 means the end of the period.  Fails if no allowed
+// CPU has budget/deadline of its time left to reserve
+// (see RT_MAXUTIL in sched.h).
+// Example: 2 ticks of every 10, done within 5:
+//   rtrun 10 2 5 cpu_loop &
+
+int
+main(int argc, char *argv[])
+{
+  if(argc < 5){
+    printf(2, "Usage: rtrun period budget deadline cmd [args...]\n");
+    exit();
+  }
+  if(setrt(atoi(argv[1]), atoi(argv[2]), atoi(argv[3])) < 0){
+    printf(2, "rtrun: cannot admit %s/%s/%s\n", argv[1], argv[2], argv[3]);
+    exit();
+  }
+  exec(argv[4], argv + 4);
+  printf(2, "rtrun: exec %s failed\n", argv[4]);
+  exit();
+}
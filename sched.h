@@ -0,0 +1,43 @@
+// Scheduler tuning parameters and statistics, shared by the kernel
+// and user programs.  Sizes come from param.h.
+
+// Scheduling policies, see setpolicy().
+#define SCHED_MLFQ    0
+#define SCHED_STRIDE  1
+
+#define STRIDE_DEFTICKETS  100  // tickets of the first process
+#define STRIDE_MAXTICKETS 1000  // settickets() accepts 1..this
+
+// setrt() limits.  Real-time processes may reserve up to RT_MAXUTIL
+// per-mille of a CPU, leaving the rest to the policy.
+#define RT_MAXPERIOD     10000  // ticks
+#define RT_MAXUTIL         900
+
+struct schedparams {
+  int nlevels;             // active MLFQ levels, 1..NMLFQ
+  int quantum[NMLFQ];      // time slice of each level, in ticks
+  int boost_ticks;         // ticks runnable before moving up a level, 0 = never
+  int tickless;            // 1 = one-shot timer, see "Dynamic ticks" in trap.c
+};
+
+// One process as reported by getpinfo().
+struct pinfo {
+  int pid;
+  int state;               // enum procstate (proc.h): 2 sleep, 3 runnable, ...
+  char name[16];
+  int priority;            // current MLFQ level
+  int cpu;                 // CPU it last ran on, -1 if never
+  int tickets;             // stride share
+  int ticks[NMLFQ];        // ticks used at each level
+  uint nsched;             // times picked by the scheduler
+  uint waitticks;          // ticks spent runnable but not running
+  uint ndemote;            // demotions
+  uint nboost;             // promotions by aging
+};
+
+// Wakeup-to-run latency, as returned by getlathist().  Bucket b of
+// hist[cpu][level] counts processes that waited between 2^b and
+// 2^(b+1) TSC cycles from being woken until scheduler() ran them.
+struct lathist {
+  uint hist[NCPU][NMLFQ][NLATBUCKET];
+};
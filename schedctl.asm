@@ -0,0 +1,1627 @@
+
+_schedctl:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    printf(1, "  level %d: quantum %d\n", i, sp->quantum[i]);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 54             	sub    $0x54,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  19:	8b 41 04             	mov    0x4(%ecx),%eax
+  1c:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  struct schedparams sp;
+  int i, lvl, id, policy;
+
+  if(getschedparams(&sp) < 0){
+  1f:	8d 45 bc             	lea    -0x44(%ebp),%eax
+  22:	50                   	push   %eax
+  23:	e8 00 07 00 00       	call   728 <getschedparams>
+  28:	83 c4 10             	add    $0x10,%esp
+  2b:	85 c0                	test   %eax,%eax
+  2d:	0f 88 a4 02 00 00    	js     2d7 <main+0x2d7>
+    printf(2, "schedctl: getschedparams failed\n");
+    exit();
+  }
+  if(argc < 2){
+  33:	83 7d b4 01          	cmpl   $0x1,-0x4c(%ebp)
+    show(&sp);
+    exit();
+  }
+
+  policy = -1;
+  37:	c7 45 a8 ff ff ff ff 	movl   $0xffffffff,-0x58(%ebp)
+  for(i = 1; i < argc; i++){
+  3e:	be 01 00 00 00       	mov    $0x1,%esi
+  if(argc < 2){
+  43:	0f 8e a1 02 00 00    	jle    2ea <main+0x2ea>
+  49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strcmp(argv[i], "policy") == 0 && i+1 < argc){
+  50:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  53:	8d 3c b5 00 00 00 00 	lea    0x0(,%esi,4),%edi
+  5a:	83 ec 08             	sub    $0x8,%esp
+  5d:	68 35 0c 00 00       	push   $0xc35
+  62:	8d 1c 38             	lea    (%eax,%edi,1),%ebx
+  65:	ff 33                	push   (%ebx)
+  67:	e8 84 03 00 00       	call   3f0 <strcmp>
+  6c:	83 c4 10             	add    $0x10,%esp
+  6f:	85 c0                	test   %eax,%eax
+  71:	0f 85 89 00 00 00    	jne    100 <main+0x100>
+  77:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  7a:	8d 56 01             	lea    0x1(%esi),%edx
+  7d:	39 c2                	cmp    %eax,%edx
+  7f:	0f 8c 1b 01 00 00    	jl     1a0 <main+0x1a0>
+      for(id = 0; id < NPOLICY; id++)
+        if(strcmp(argv[i], policies[id]) == 0)
+          policy = id;
+      if(policy < 0)
+        usage();
+    } else if(strcmp(argv[i], "levels") == 0 && i+1 < argc){
+  85:	83 ec 08             	sub    $0x8,%esp
+  88:	68 48 0c 00 00       	push   $0xc48
+  8d:	ff 33                	push   (%ebx)
+  8f:	e8 5c 03 00 00       	call   3f0 <strcmp>
+  94:	83 c4 10             	add    $0x10,%esp
+      sp.nlevels = atoi(argv[++i]);
+    } else if(strcmp(argv[i], "quantum") == 0 && i+2 < argc){
+  97:	83 ec 08             	sub    $0x8,%esp
+  9a:	68 4f 0c 00 00       	push   $0xc4f
+  9f:	ff 33                	push   (%ebx)
+  a1:	e8 4a 03 00 00       	call   3f0 <strcmp>
+  a6:	83 c4 10             	add    $0x10,%esp
+  a9:	85 c0                	test   %eax,%eax
+  ab:	75 0e                	jne    bb <main+0xbb>
+  ad:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  b0:	8d 56 02             	lea    0x2(%esi),%edx
+  b3:	39 c2                	cmp    %eax,%edx
+  b5:	0f 8c 85 01 00 00    	jl     240 <main+0x240>
+      lvl = atoi(argv[++i]);
+      if(lvl < 0 || lvl >= NMLFQ)
+        usage();
+      sp.quantum[lvl] = atoi(argv[++i]);
+    } else if(strcmp(argv[i], "boost") == 0 && i+1 < argc){
+  bb:	83 ec 08             	sub    $0x8,%esp
+  be:	68 57 0c 00 00       	push   $0xc57
+  c3:	ff 33                	push   (%ebx)
+  c5:	e8 26 03 00 00       	call   3f0 <strcmp>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	85 c0                	test   %eax,%eax
+  cf:	0f 85 1b 01 00 00    	jne    1f0 <main+0x1f0>
+  d5:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  d8:	8d 56 01             	lea    0x1(%esi),%edx
+  db:	39 c2                	cmp    %eax,%edx
+  dd:	0f 8c 9d 01 00 00    	jl     280 <main+0x280>
+      sp.boost_ticks = atoi(argv[++i]);
+    } else if(strcmp(argv[i], "tickless") == 0 && i+1 < argc){
+  e3:	83 ec 08             	sub    $0x8,%esp
+  e6:	68 5d 0c 00 00       	push   $0xc5d
+  eb:	ff 33                	push   (%ebx)
+  ed:	e8 fe 02 00 00       	call   3f0 <strcmp>
+  f2:	83 c4 10             	add    $0x10,%esp
+        usage();
+  f5:	e8 26 02 00 00       	call   320 <usage>
+  fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(strcmp(argv[i], "levels") == 0 && i+1 < argc){
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	68 48 0c 00 00       	push   $0xc48
+ 108:	ff 33                	push   (%ebx)
+ 10a:	e8 e1 02 00 00       	call   3f0 <strcmp>
+ 10f:	83 c4 10             	add    $0x10,%esp
+ 112:	85 c0                	test   %eax,%eax
+ 114:	0f 85 7d ff ff ff    	jne    97 <main+0x97>
+ 11a:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+ 11d:	8d 56 01             	lea    0x1(%esi),%edx
+ 120:	89 55 ac             	mov    %edx,-0x54(%ebp)
+ 123:	39 c2                	cmp    %eax,%edx
+ 125:	0f 8d 6c ff ff ff    	jge    97 <main+0x97>
+      sp.nlevels = atoi(argv[++i]);
+ 12b:	8b 45 b0             	mov    -0x50(%ebp),%eax
+ 12e:	83 ec 0c             	sub    $0xc,%esp
+ 131:	ff 74 38 04          	push   0x4(%eax,%edi,1)
+ 135:	e8 56 04 00 00       	call   590 <atoi>
+ 13a:	8b 55 ac             	mov    -0x54(%ebp),%edx
+ 13d:	83 c4 10             	add    $0x10,%esp
+ 140:	89 45 bc             	mov    %eax,-0x44(%ebp)
+ 143:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 147:	90                   	nop
+  for(i = 1; i < argc; i++){
+ 148:	8d 72 01             	lea    0x1(%edx),%esi
+ 14b:	39 75 b4             	cmp    %esi,-0x4c(%ebp)
+ 14e:	0f 8f fc fe ff ff    	jg     50 <main+0x50>
+    } else {
+      usage();
+    }
+  }
+
+  if(setschedparams(&sp) < 0){
+ 154:	83 ec 0c             	sub    $0xc,%esp
+ 157:	8d 45 bc             	lea    -0x44(%ebp),%eax
+ 15a:	50                   	push   %eax
+ 15b:	e8 d0 05 00 00       	call   730 <setschedparams>
+ 160:	83 c4 10             	add    $0x10,%esp
+ 163:	85 c0                	test   %eax,%eax
+ 165:	0f 88 8c 01 00 00    	js     2f7 <main+0x2f7>
+    printf(2, "schedctl: invalid parameters\n");
+    exit();
+  }
+  if(policy >= 0 && setpolicy(policy) < 0){
+ 16b:	8b 45 a8             	mov    -0x58(%ebp),%eax
+ 16e:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 171:	74 14                	je     187 <main+0x187>
+ 173:	83 ec 0c             	sub    $0xc,%esp
+ 176:	50                   	push   %eax
+ 177:	e8 cc 05 00 00       	call   748 <setpolicy>
+ 17c:	83 c4 10             	add    $0x10,%esp
+ 17f:	85 c0                	test   %eax,%eax
+ 181:	0f 88 83 01 00 00    	js     30a <main+0x30a>
+    printf(2, "schedctl: cannot switch policy\n");
+    exit();
+  }
+  getschedparams(&sp);
+ 187:	83 ec 0c             	sub    $0xc,%esp
+ 18a:	8d 45 bc             	lea    -0x44(%ebp),%eax
+ 18d:	50                   	push   %eax
+ 18e:	e8 95 05 00 00       	call   728 <getschedparams>
+  show(&sp);
+ 193:	8d 45 bc             	lea    -0x44(%ebp),%eax
+ 196:	e8 a5 01 00 00       	call   340 <show>
+  exit();
+ 19b:	e8 e0 04 00 00       	call   680 <exit>
+        if(strcmp(argv[i], policies[id]) == 0)
+ 1a0:	8b 45 b0             	mov    -0x50(%ebp),%eax
+ 1a3:	83 ec 08             	sub    $0x8,%esp
+ 1a6:	89 55 ac             	mov    %edx,-0x54(%ebp)
+ 1a9:	68 3c 0c 00 00       	push   $0xc3c
+ 1ae:	8d 5c 38 04          	lea    0x4(%eax,%edi,1),%ebx
+ 1b2:	ff 33                	push   (%ebx)
+ 1b4:	e8 37 02 00 00       	call   3f0 <strcmp>
+ 1b9:	83 c4 10             	add    $0x10,%esp
+ 1bc:	8b 55 ac             	mov    -0x54(%ebp),%edx
+ 1bf:	85 c0                	test   %eax,%eax
+ 1c1:	0f 85 d9 00 00 00    	jne    2a0 <main+0x2a0>
+ 1c7:	83 ec 08             	sub    $0x8,%esp
+ 1ca:	68 41 0c 00 00       	push   $0xc41
+ 1cf:	ff 33                	push   (%ebx)
+ 1d1:	e8 1a 02 00 00       	call   3f0 <strcmp>
+ 1d6:	83 c4 10             	add    $0x10,%esp
+ 1d9:	8b 55 ac             	mov    -0x54(%ebp),%edx
+ 1dc:	85 c0                	test   %eax,%eax
+ 1de:	0f 94 c0             	sete   %al
+ 1e1:	0f b6 c0             	movzbl %al,%eax
+ 1e4:	89 45 a8             	mov    %eax,-0x58(%ebp)
+ 1e7:	e9 5c ff ff ff       	jmp    148 <main+0x148>
+ 1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if(strcmp(argv[i], "tickless") == 0 && i+1 < argc){
+ 1f0:	83 ec 08             	sub    $0x8,%esp
+ 1f3:	68 5d 0c 00 00       	push   $0xc5d
+ 1f8:	ff 33                	push   (%ebx)
+ 1fa:	e8 f1 01 00 00       	call   3f0 <strcmp>
+ 1ff:	83 c4 10             	add    $0x10,%esp
+ 202:	85 c0                	test   %eax,%eax
+ 204:	0f 85 eb fe ff ff    	jne    f5 <main+0xf5>
+ 20a:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+ 20d:	8d 56 01             	lea    0x1(%esi),%edx
+ 210:	89 55 ac             	mov    %edx,-0x54(%ebp)
+ 213:	39 c2                	cmp    %eax,%edx
+ 215:	0f 8d da fe ff ff    	jge    f5 <main+0xf5>
+      sp.tickless = atoi(argv[++i]);
+ 21b:	8b 45 b0             	mov    -0x50(%ebp),%eax
+ 21e:	83 ec 0c             	sub    $0xc,%esp
+ 221:	ff 74 38 04          	push   0x4(%eax,%edi,1)
+ 225:	e8 66 03 00 00       	call   590 <atoi>
+ 22a:	8b 55 ac             	mov    -0x54(%ebp),%edx
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 233:	e9 10 ff ff ff       	jmp    148 <main+0x148>
+ 238:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+      lvl = atoi(argv[++i]);
+ 240:	8b 75 b0             	mov    -0x50(%ebp),%esi
+ 243:	83 ec 0c             	sub    $0xc,%esp
+ 246:	89 55 ac             	mov    %edx,-0x54(%ebp)
+ 249:	ff 74 3e 04          	push   0x4(%esi,%edi,1)
+ 24d:	e8 3e 03 00 00       	call   590 <atoi>
+      if(lvl < 0 || lvl >= NMLFQ)
+ 252:	83 c4 10             	add    $0x10,%esp
+      lvl = atoi(argv[++i]);
+ 255:	89 c3                	mov    %eax,%ebx
+      if(lvl < 0 || lvl >= NMLFQ)
+ 257:	83 f8 07             	cmp    $0x7,%eax
+ 25a:	0f 87 95 fe ff ff    	ja     f5 <main+0xf5>
+      sp.quantum[lvl] = atoi(argv[++i]);
+ 260:	83 ec 0c             	sub    $0xc,%esp
+ 263:	ff 74 3e 08          	push   0x8(%esi,%edi,1)
+ 267:	e8 24 03 00 00       	call   590 <atoi>
+ 26c:	8b 55 ac             	mov    -0x54(%ebp),%edx
+ 26f:	83 c4 10             	add    $0x10,%esp
+ 272:	89 44 9d c0          	mov    %eax,-0x40(%ebp,%ebx,4)
+ 276:	e9 cd fe ff ff       	jmp    148 <main+0x148>
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+      sp.boost_ticks = atoi(argv[++i]);
+ 280:	8b 45 b0             	mov    -0x50(%ebp),%eax
+ 283:	89 55 ac             	mov    %edx,-0x54(%ebp)
+ 286:	83 ec 0c             	sub    $0xc,%esp
+ 289:	ff 74 38 04          	push   0x4(%eax,%edi,1)
+ 28d:	e8 fe 02 00 00       	call   590 <atoi>
+ 292:	8b 55 ac             	mov    -0x54(%ebp),%edx
+ 295:	83 c4 10             	add    $0x10,%esp
+ 298:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 29b:	e9 a8 fe ff ff       	jmp    148 <main+0x148>
+        if(strcmp(argv[i], policies[id]) == 0)
+ 2a0:	83 ec 08             	sub    $0x8,%esp
+ 2a3:	89 55 ac             	mov    %edx,-0x54(%ebp)
+ 2a6:	68 41 0c 00 00       	push   $0xc41
+ 2ab:	ff 33                	push   (%ebx)
+ 2ad:	e8 3e 01 00 00       	call   3f0 <strcmp>
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	8b 55 ac             	mov    -0x54(%ebp),%edx
+ 2b8:	85 c0                	test   %eax,%eax
+ 2ba:	74 0f                	je     2cb <main+0x2cb>
+      if(policy < 0)
+ 2bc:	83 7d a8 ff          	cmpl   $0xffffffff,-0x58(%ebp)
+ 2c0:	0f 85 82 fe ff ff    	jne    148 <main+0x148>
+ 2c6:	e9 2a fe ff ff       	jmp    f5 <main+0xf5>
+      for(id = 0; id < NPOLICY; id++)
+ 2cb:	c7 45 a8 01 00 00 00 	movl   $0x1,-0x58(%ebp)
+ 2d2:	e9 71 fe ff ff       	jmp    148 <main+0x148>
+    printf(2, "schedctl: getschedparams failed\n");
+ 2d7:	51                   	push   %ecx
+ 2d8:	51                   	push   %ecx
+ 2d9:	68 cc 0b 00 00       	push   $0xbcc
+ 2de:	6a 02                	push   $0x2
+ 2e0:	e8 4b 05 00 00       	call   830 <printf>
+    exit();
+ 2e5:	e8 96 03 00 00       	call   680 <exit>
+    show(&sp);
+ 2ea:	8d 45 bc             	lea    -0x44(%ebp),%eax
+ 2ed:	e8 4e 00 00 00       	call   340 <show>
+    exit();
+ 2f2:	e8 89 03 00 00       	call   680 <exit>
+    printf(2, "schedctl: invalid parameters\n");
+ 2f7:	52                   	push   %edx
+ 2f8:	52                   	push   %edx
+ 2f9:	68 66 0c 00 00       	push   $0xc66
+ 2fe:	6a 02                	push   $0x2
+ 300:	e8 2b 05 00 00       	call   830 <printf>
+    exit();
+ 305:	e8 76 03 00 00       	call   680 <exit>
+    printf(2, "schedctl: cannot switch policy\n");
+ 30a:	50                   	push   %eax
+ 30b:	50                   	push   %eax
+ 30c:	68 f0 0b 00 00       	push   $0xbf0
+ 311:	6a 02                	push   $0x2
+ 313:	e8 18 05 00 00       	call   830 <printf>
+    exit();
+ 318:	e8 63 03 00 00       	call   680 <exit>
+ 31d:	66 90                	xchg   %ax,%ax
+ 31f:	90                   	nop
+
+00000320 <usage>:
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	83 ec 10             	sub    $0x10,%esp
+  printf(2, "Usage: schedctl [policy name] [levels n] [quantum lvl t] [boost t] [tickless 0|1]\n");
+ 326:	68 58 0b 00 00       	push   $0xb58
+ 32b:	6a 02                	push   $0x2
+ 32d:	e8 fe 04 00 00       	call   830 <printf>
+  exit();
+ 332:	e8 49 03 00 00       	call   680 <exit>
+ 337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33e:	66 90                	xchg   %ax,%ax
+
+00000340 <show>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	56                   	push   %esi
+ 344:	89 c6                	mov    %eax,%esi
+ 346:	53                   	push   %ebx
+  id = setpolicy(-1);
+ 347:	83 ec 0c             	sub    $0xc,%esp
+ 34a:	6a ff                	push   $0xffffffff
+ 34c:	e8 f7 03 00 00       	call   748 <setpolicy>
+  printf(1, "policy %s\n", (uint)id < NPOLICY ? policies[id] : "?");
+ 351:	83 c4 10             	add    $0x10,%esp
+ 354:	ba 10 0c 00 00       	mov    $0xc10,%edx
+ 359:	83 f8 01             	cmp    $0x1,%eax
+ 35c:	77 07                	ja     365 <show+0x25>
+ 35e:	8b 14 85 84 0c 00 00 	mov    0xc84(,%eax,4),%edx
+ 365:	83 ec 04             	sub    $0x4,%esp
+ 368:	52                   	push   %edx
+ 369:	68 12 0c 00 00       	push   $0xc12
+ 36e:	6a 01                	push   $0x1
+ 370:	e8 bb 04 00 00       	call   830 <printf>
+  printf(1, "levels %d boost %d tickless %d\n", sp->nlevels, sp->boost_ticks,
+ 375:	58                   	pop    %eax
+ 376:	ff 76 28             	push   0x28(%esi)
+ 379:	ff 76 24             	push   0x24(%esi)
+ 37c:	ff 36                	push   (%esi)
+ 37e:	68 ac 0b 00 00       	push   $0xbac
+ 383:	6a 01                	push   $0x1
+ 385:	e8 a6 04 00 00       	call   830 <printf>
+  for(i = 0; i < sp->nlevels; i++)
+ 38a:	8b 16                	mov    (%esi),%edx
+ 38c:	83 c4 20             	add    $0x20,%esp
+ 38f:	85 d2                	test   %edx,%edx
+ 391:	7e 20                	jle    3b3 <show+0x73>
+ 393:	31 db                	xor    %ebx,%ebx
+ 395:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "  level %d: quantum %d\n", i, sp->quantum[i]);
+ 398:	ff 74 9e 04          	push   0x4(%esi,%ebx,4)
+ 39c:	53                   	push   %ebx
+  for(i = 0; i < sp->nlevels; i++)
+ 39d:	83 c3 01             	add    $0x1,%ebx
+    printf(1, "  level %d: quantum %d\n", i, sp->quantum[i]);
+ 3a0:	68 1d 0c 00 00       	push   $0xc1d
+ 3a5:	6a 01                	push   $0x1
+ 3a7:	e8 84 04 00 00       	call   830 <printf>
+  for(i = 0; i < sp->nlevels; i++)
+ 3ac:	83 c4 10             	add    $0x10,%esp
+ 3af:	39 1e                	cmp    %ebx,(%esi)
+ 3b1:	7f e5                	jg     398 <show+0x58>
+}
+ 3b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3b6:	5b                   	pop    %ebx
+ 3b7:	5e                   	pop    %esi
+ 3b8:	5d                   	pop    %ebp
+ 3b9:	c3                   	ret
+ 3ba:	66 90                	xchg   %ax,%ax
+ 3bc:	66 90                	xchg   %ax,%ax
+ 3be:	66 90                	xchg   %ax,%ax
+
+000003c0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3c1:	31 c0                	xor    %eax,%eax
+{
+ 3c3:	89 e5                	mov    %esp,%ebp
+ 3c5:	53                   	push   %ebx
+ 3c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3d7:	83 c0 01             	add    $0x1,%eax
+ 3da:	84 d2                	test   %dl,%dl
+ 3dc:	75 f2                	jne    3d0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3e1:	89 c8                	mov    %ecx,%eax
+ 3e3:	c9                   	leave
+ 3e4:	c3                   	ret
+ 3e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	53                   	push   %ebx
+ 3f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3fa:	0f b6 02             	movzbl (%edx),%eax
+ 3fd:	84 c0                	test   %al,%al
+ 3ff:	75 17                	jne    418 <strcmp+0x28>
+ 401:	eb 3a                	jmp    43d <strcmp+0x4d>
+ 403:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 407:	90                   	nop
+ 408:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 40c:	83 c2 01             	add    $0x1,%edx
+ 40f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 412:	84 c0                	test   %al,%al
+ 414:	74 1a                	je     430 <strcmp+0x40>
+    p++, q++;
+ 416:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 418:	0f b6 19             	movzbl (%ecx),%ebx
+ 41b:	38 c3                	cmp    %al,%bl
+ 41d:	74 e9                	je     408 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 41f:	29 d8                	sub    %ebx,%eax
+}
+ 421:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 424:	c9                   	leave
+ 425:	c3                   	ret
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 430:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 434:	31 c0                	xor    %eax,%eax
+ 436:	29 d8                	sub    %ebx,%eax
+}
+ 438:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 43b:	c9                   	leave
+ 43c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 43d:	0f b6 19             	movzbl (%ecx),%ebx
+ 440:	31 c0                	xor    %eax,%eax
+ 442:	eb db                	jmp    41f <strcmp+0x2f>
+ 444:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 44f:	90                   	nop
+
+00000450 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 456:	80 3a 00             	cmpb   $0x0,(%edx)
+ 459:	74 15                	je     470 <strlen+0x20>
+ 45b:	31 c0                	xor    %eax,%eax
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+ 460:	83 c0 01             	add    $0x1,%eax
+ 463:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 467:	89 c1                	mov    %eax,%ecx
+ 469:	75 f5                	jne    460 <strlen+0x10>
+    ;
+  return n;
+}
+ 46b:	89 c8                	mov    %ecx,%eax
+ 46d:	5d                   	pop    %ebp
+ 46e:	c3                   	ret
+ 46f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 470:	31 c9                	xor    %ecx,%ecx
+}
+ 472:	5d                   	pop    %ebp
+ 473:	89 c8                	mov    %ecx,%eax
+ 475:	c3                   	ret
+ 476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000480 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 487:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 48a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 48d:	89 d7                	mov    %edx,%edi
+ 48f:	fc                   	cld
+ 490:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 492:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 495:	89 d0                	mov    %edx,%eax
+ 497:	c9                   	leave
+ 498:	c3                   	ret
+ 499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 4aa:	0f b6 10             	movzbl (%eax),%edx
+ 4ad:	84 d2                	test   %dl,%dl
+ 4af:	75 12                	jne    4c3 <strchr+0x23>
+ 4b1:	eb 1d                	jmp    4d0 <strchr+0x30>
+ 4b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4b7:	90                   	nop
+ 4b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4bc:	83 c0 01             	add    $0x1,%eax
+ 4bf:	84 d2                	test   %dl,%dl
+ 4c1:	74 0d                	je     4d0 <strchr+0x30>
+    if(*s == c)
+ 4c3:	38 d1                	cmp    %dl,%cl
+ 4c5:	75 f1                	jne    4b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4c7:	5d                   	pop    %ebp
+ 4c8:	c3                   	ret
+ 4c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4d0:	31 c0                	xor    %eax,%eax
+}
+ 4d2:	5d                   	pop    %ebp
+ 4d3:	c3                   	ret
+ 4d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4df:	90                   	nop
+
+000004e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4e9:	31 db                	xor    %ebx,%ebx
+{
+ 4eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4ee:	eb 27                	jmp    517 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4f0:	83 ec 04             	sub    $0x4,%esp
+ 4f3:	6a 01                	push   $0x1
+ 4f5:	56                   	push   %esi
+ 4f6:	6a 00                	push   $0x0
+ 4f8:	e8 9b 01 00 00       	call   698 <read>
+    if(cc < 1)
+ 4fd:	83 c4 10             	add    $0x10,%esp
+ 500:	85 c0                	test   %eax,%eax
+ 502:	7e 1d                	jle    521 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 504:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 508:	8b 55 08             	mov    0x8(%ebp),%edx
+ 50b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 50f:	3c 0a                	cmp    $0xa,%al
+ 511:	74 10                	je     523 <gets+0x43>
+ 513:	3c 0d                	cmp    $0xd,%al
+ 515:	74 0c                	je     523 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 517:	89 df                	mov    %ebx,%edi
+ 519:	83 c3 01             	add    $0x1,%ebx
+ 51c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 51f:	7c cf                	jl     4f0 <gets+0x10>
+ 521:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 523:	8b 45 08             	mov    0x8(%ebp),%eax
+ 526:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 52a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 52d:	5b                   	pop    %ebx
+ 52e:	5e                   	pop    %esi
+ 52f:	5f                   	pop    %edi
+ 530:	5d                   	pop    %ebp
+ 531:	c3                   	ret
+ 532:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 539:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	56                   	push   %esi
+ 544:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 545:	83 ec 08             	sub    $0x8,%esp
+ 548:	6a 00                	push   $0x0
+ 54a:	ff 75 08             	push   0x8(%ebp)
+ 54d:	e8 6e 01 00 00       	call   6c0 <open>
+  if(fd < 0)
+ 552:	83 c4 10             	add    $0x10,%esp
+ 555:	85 c0                	test   %eax,%eax
+ 557:	78 27                	js     580 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 559:	83 ec 08             	sub    $0x8,%esp
+ 55c:	ff 75 0c             	push   0xc(%ebp)
+ 55f:	89 c3                	mov    %eax,%ebx
+ 561:	50                   	push   %eax
+ 562:	e8 71 01 00 00       	call   6d8 <fstat>
+  close(fd);
+ 567:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 56a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 56c:	e8 37 01 00 00       	call   6a8 <close>
+  return r;
+ 571:	83 c4 10             	add    $0x10,%esp
+}
+ 574:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 577:	89 f0                	mov    %esi,%eax
+ 579:	5b                   	pop    %ebx
+ 57a:	5e                   	pop    %esi
+ 57b:	5d                   	pop    %ebp
+ 57c:	c3                   	ret
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 580:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 585:	eb ed                	jmp    574 <stat+0x34>
+ 587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58e:	66 90                	xchg   %ax,%ax
+
+00000590 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	53                   	push   %ebx
+ 594:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 597:	0f be 02             	movsbl (%edx),%eax
+ 59a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 59d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 5a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 5a5:	77 1e                	ja     5c5 <atoi+0x35>
+ 5a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 5b0:	83 c2 01             	add    $0x1,%edx
+ 5b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 5b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 5ba:	0f be 02             	movsbl (%edx),%eax
+ 5bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5c0:	80 fb 09             	cmp    $0x9,%bl
+ 5c3:	76 eb                	jbe    5b0 <atoi+0x20>
+  return n;
+}
+ 5c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5c8:	89 c8                	mov    %ecx,%eax
+ 5ca:	c9                   	leave
+ 5cb:	c3                   	ret
+ 5cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	56                   	push   %esi
+ 5d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5de:	85 c0                	test   %eax,%eax
+ 5e0:	7e 13                	jle    5f5 <memmove+0x25>
+ 5e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5e4:	89 d7                	mov    %edx,%edi
+ 5e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5f1:	39 f8                	cmp    %edi,%eax
+ 5f3:	75 fb                	jne    5f0 <memmove+0x20>
+  return vdst;
+}
+ 5f5:	5e                   	pop    %esi
+ 5f6:	89 d0                	mov    %edx,%eax
+ 5f8:	5f                   	pop    %edi
+ 5f9:	5d                   	pop    %ebp
+ 5fa:	c3                   	ret
+ 5fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ff:	90                   	nop
+
+00000600 <mutex_lock>:
+
+// Take and release m with atomic instructions, and enter the kernel
+// only to block while it is held or to wake a blocked thread.
+void
+mutex_lock(struct mutex *m)
+{
+ 600:	55                   	push   %ebp
+  uint s;
+
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 601:	31 c0                	xor    %eax,%eax
+ 603:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 608:	89 e5                	mov    %esp,%ebp
+ 60a:	56                   	push   %esi
+ 60b:	53                   	push   %ebx
+ 60c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 60f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 613:	85 c0                	test   %eax,%eax
+ 615:	74 30                	je     647 <mutex_lock+0x47>
+    return;
+  // Contended: mark it so the holder knows to wake us.
+  if(s != 2)
+ 617:	83 f8 02             	cmp    $0x2,%eax
+ 61a:	74 0c                	je     628 <mutex_lock+0x28>
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 61c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 621:	f0 87 03             	lock xchg %eax,(%ebx)
+    s = xchg(&m->state, 2);
+  while(s != 0){
+ 624:	85 c0                	test   %eax,%eax
+ 626:	74 1f                	je     647 <mutex_lock+0x47>
+ 628:	be 02 00 00 00       	mov    $0x2,%esi
+ 62d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+ 630:	83 ec 08             	sub    $0x8,%esp
+ 633:	6a 02                	push   $0x2
+ 635:	53                   	push   %ebx
+ 636:	e8 45 01 00 00       	call   780 <futex_wait>
+ 63b:	89 f0                	mov    %esi,%eax
+ 63d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(s != 0){
+ 640:	83 c4 10             	add    $0x10,%esp
+ 643:	85 c0                	test   %eax,%eax
+ 645:	75 e9                	jne    630 <mutex_lock+0x30>
+    s = xchg(&m->state, 2);
+  }
+}
+ 647:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 64a:	5b                   	pop    %ebx
+ 64b:	5e                   	pop    %esi
+ 64c:	5d                   	pop    %ebp
+ 64d:	c3                   	ret
+ 64e:	66 90                	xchg   %ax,%ax
+
+00000650 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 650:	55                   	push   %ebp
+ 651:	31 c0                	xor    %eax,%eax
+ 653:	89 e5                	mov    %esp,%ebp
+ 655:	83 ec 08             	sub    $0x8,%esp
+ 658:	8b 55 08             	mov    0x8(%ebp),%edx
+ 65b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 65e:	83 f8 02             	cmp    $0x2,%eax
+ 661:	74 05                	je     668 <mutex_unlock+0x18>
+    futex_wake(&m->state, 1);
+}
+ 663:	c9                   	leave
+ 664:	c3                   	ret
+ 665:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->state, 1);
+ 668:	83 ec 08             	sub    $0x8,%esp
+ 66b:	6a 01                	push   $0x1
+ 66d:	52                   	push   %edx
+ 66e:	e8 15 01 00 00       	call   788 <futex_wake>
+ 673:	83 c4 10             	add    $0x10,%esp
+}
+ 676:	c9                   	leave
+ 677:	c3                   	ret
+
+00000678 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 678:	b8 01 00 00 00       	mov    $0x1,%eax
+ 67d:	cd 40                	int    $0x40
+ 67f:	c3                   	ret
+
+00000680 <exit>:
+SYSCALL(exit)
+ 680:	b8 02 00 00 00       	mov    $0x2,%eax
+ 685:	cd 40                	int    $0x40
+ 687:	c3                   	ret
+
+00000688 <wait>:
+SYSCALL(wait)
+ 688:	b8 03 00 00 00       	mov    $0x3,%eax
+ 68d:	cd 40                	int    $0x40
+ 68f:	c3                   	ret
+
+00000690 <pipe>:
+SYSCALL(pipe)
+ 690:	b8 04 00 00 00       	mov    $0x4,%eax
+ 695:	cd 40                	int    $0x40
+ 697:	c3                   	ret
+
+00000698 <read>:
+SYSCALL(read)
+ 698:	b8 05 00 00 00       	mov    $0x5,%eax
+ 69d:	cd 40                	int    $0x40
+ 69f:	c3                   	ret
+
+000006a0 <write>:
+SYSCALL(write)
+ 6a0:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6a5:	cd 40                	int    $0x40
+ 6a7:	c3                   	ret
+
+000006a8 <close>:
+SYSCALL(close)
+ 6a8:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6ad:	cd 40                	int    $0x40
+ 6af:	c3                   	ret
+
+000006b0 <kill>:
+SYSCALL(kill)
+ 6b0:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6b5:	cd 40                	int    $0x40
+ 6b7:	c3                   	ret
+
+000006b8 <exec>:
+SYSCALL(exec)
+ 6b8:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6bd:	cd 40                	int    $0x40
+ 6bf:	c3                   	ret
+
+000006c0 <open>:
+SYSCALL(open)
+ 6c0:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6c5:	cd 40                	int    $0x40
+ 6c7:	c3                   	ret
+
+000006c8 <mknod>:
+SYSCALL(mknod)
+ 6c8:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6cd:	cd 40                	int    $0x40
+ 6cf:	c3                   	ret
+
+000006d0 <unlink>:
+SYSCALL(unlink)
+ 6d0:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6d5:	cd 40                	int    $0x40
+ 6d7:	c3                   	ret
+
+000006d8 <fstat>:
+SYSCALL(fstat)
+ 6d8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6dd:	cd 40                	int    $0x40
+ 6df:	c3                   	ret
+
+000006e0 <link>:
+SYSCALL(link)
+ 6e0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6e5:	cd 40                	int    $0x40
+ 6e7:	c3                   	ret
+
+000006e8 <mkdir>:
+SYSCALL(mkdir)
+ 6e8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6ed:	cd 40                	int    $0x40
+ 6ef:	c3                   	ret
+
+000006f0 <chdir>:
+SYSCALL(chdir)
+ 6f0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6f5:	cd 40                	int    $0x40
+ 6f7:	c3                   	ret
+
+000006f8 <dup>:
+SYSCALL(dup)
+ 6f8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6fd:	cd 40                	int    $0x40
+ 6ff:	c3                   	ret
+
+00000700 <getpid>:
+SYSCALL(getpid)
+ 700:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 705:	cd 40                	int    $0x40
+ 707:	c3                   	ret
+
+00000708 <sbrk>:
+SYSCALL(sbrk)
+ 708:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 70d:	cd 40                	int    $0x40
+ 70f:	c3                   	ret
+
+00000710 <sleep>:
+SYSCALL(sleep)
+ 710:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 715:	cd 40                	int    $0x40
+ 717:	c3                   	ret
+
+00000718 <uptime>:
+SYSCALL(uptime)
+ 718:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 71d:	cd 40                	int    $0x40
+ 71f:	c3                   	ret
+
+00000720 <ps>:
+SYSCALL(ps)
+ 720:	b8 16 00 00 00       	mov    $0x16,%eax
+ 725:	cd 40                	int    $0x40
+ 727:	c3                   	ret
+
+00000728 <getschedparams>:
+SYSCALL(getschedparams)
+ 728:	b8 17 00 00 00       	mov    $0x17,%eax
+ 72d:	cd 40                	int    $0x40
+ 72f:	c3                   	ret
+
+00000730 <setschedparams>:
+SYSCALL(setschedparams)
+ 730:	b8 18 00 00 00       	mov    $0x18,%eax
+ 735:	cd 40                	int    $0x40
+ 737:	c3                   	ret
+
+00000738 <getpinfo>:
+SYSCALL(getpinfo)
+ 738:	b8 19 00 00 00       	mov    $0x19,%eax
+ 73d:	cd 40                	int    $0x40
+ 73f:	c3                   	ret
+
+00000740 <getlathist>:
+SYSCALL(getlathist)
+ 740:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 745:	cd 40                	int    $0x40
+ 747:	c3                   	ret
+
+00000748 <setpolicy>:
+SYSCALL(setpolicy)
+ 748:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 74d:	cd 40                	int    $0x40
+ 74f:	c3                   	ret
+
+00000750 <settickets>:
+SYSCALL(settickets)
+ 750:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 755:	cd 40                	int    $0x40
+ 757:	c3                   	ret
+
+00000758 <setaffinity>:
+SYSCALL(setaffinity)
+ 758:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 75d:	cd 40                	int    $0x40
+ 75f:	c3                   	ret
+
+00000760 <getaffinity>:
+SYSCALL(getaffinity)
+ 760:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 765:	cd 40                	int    $0x40
+ 767:	c3                   	ret
+
+00000768 <setrt>:
+SYSCALL(setrt)
+ 768:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 76d:	cd 40                	int    $0x40
+ 76f:	c3                   	ret
+
+00000770 <clone>:
+SYSCALL(clone)
+ 770:	b8 20 00 00 00       	mov    $0x20,%eax
+ 775:	cd 40                	int    $0x40
+ 777:	c3                   	ret
+
+00000778 <join>:
+SYSCALL(join)
+ 778:	b8 21 00 00 00       	mov    $0x21,%eax
+ 77d:	cd 40                	int    $0x40
+ 77f:	c3                   	ret
+
+00000780 <futex_wait>:
+SYSCALL(futex_wait)
+ 780:	b8 22 00 00 00       	mov    $0x22,%eax
+ 785:	cd 40                	int    $0x40
+ 787:	c3                   	ret
+
+00000788 <futex_wake>:
+SYSCALL(futex_wake)
+ 788:	b8 23 00 00 00       	mov    $0x23,%eax
+ 78d:	cd 40                	int    $0x40
+ 78f:	c3                   	ret
+
+00000790 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	56                   	push   %esi
+ 795:	53                   	push   %ebx
+ 796:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 798:	89 d1                	mov    %edx,%ecx
+{
+ 79a:	83 ec 3c             	sub    $0x3c,%esp
+ 79d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 7a0:	85 d2                	test   %edx,%edx
+ 7a2:	0f 89 80 00 00 00    	jns    828 <printint+0x98>
+ 7a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7ac:	74 7a                	je     828 <printint+0x98>
+    x = -xx;
+ 7ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7b8:	31 f6                	xor    %esi,%esi
+ 7ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7c0:	89 c8                	mov    %ecx,%eax
+ 7c2:	31 d2                	xor    %edx,%edx
+ 7c4:	89 f7                	mov    %esi,%edi
+ 7c6:	f7 f3                	div    %ebx
+ 7c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7cb:	0f b6 92 ec 0c 00 00 	movzbl 0xcec(%edx),%edx
+ 7d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7d6:	89 ca                	mov    %ecx,%edx
+ 7d8:	89 c1                	mov    %eax,%ecx
+ 7da:	39 da                	cmp    %ebx,%edx
+ 7dc:	73 e2                	jae    7c0 <printint+0x30>
+  if(neg)
+ 7de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7e1:	85 c0                	test   %eax,%eax
+ 7e3:	74 07                	je     7ec <printint+0x5c>
+    buf[i++] = '-';
+ 7e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7ea:	89 f7                	mov    %esi,%edi
+ 7ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7f2:	01 df                	add    %ebx,%edi
+ 7f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7fb:	83 ec 04             	sub    $0x4,%esp
+ 7fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 801:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 804:	6a 01                	push   $0x1
+ 806:	50                   	push   %eax
+ 807:	56                   	push   %esi
+ 808:	e8 93 fe ff ff       	call   6a0 <write>
+  while(--i >= 0)
+ 80d:	89 f8                	mov    %edi,%eax
+ 80f:	83 c4 10             	add    $0x10,%esp
+ 812:	83 ef 01             	sub    $0x1,%edi
+ 815:	39 d8                	cmp    %ebx,%eax
+ 817:	75 df                	jne    7f8 <printint+0x68>
+}
+ 819:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 81c:	5b                   	pop    %ebx
+ 81d:	5e                   	pop    %esi
+ 81e:	5f                   	pop    %edi
+ 81f:	5d                   	pop    %ebp
+ 820:	c3                   	ret
+ 821:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 828:	31 c0                	xor    %eax,%eax
+ 82a:	eb 89                	jmp    7b5 <printint+0x25>
+ 82c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000830 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	57                   	push   %edi
+ 834:	56                   	push   %esi
+ 835:	53                   	push   %ebx
+ 836:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 839:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 83c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 83f:	0f b6 1e             	movzbl (%esi),%ebx
+ 842:	83 c6 01             	add    $0x1,%esi
+ 845:	84 db                	test   %bl,%bl
+ 847:	74 67                	je     8b0 <printf+0x80>
+ 849:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 84c:	31 d2                	xor    %edx,%edx
+ 84e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 851:	eb 34                	jmp    887 <printf+0x57>
+ 853:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 857:	90                   	nop
+ 858:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 85b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 860:	83 f8 25             	cmp    $0x25,%eax
+ 863:	74 18                	je     87d <printf+0x4d>
+  write(fd, &c, 1);
+ 865:	83 ec 04             	sub    $0x4,%esp
+ 868:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 86b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 86e:	6a 01                	push   $0x1
+ 870:	50                   	push   %eax
+ 871:	57                   	push   %edi
+ 872:	e8 29 fe ff ff       	call   6a0 <write>
+ 877:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 87a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 87d:	0f b6 1e             	movzbl (%esi),%ebx
+ 880:	83 c6 01             	add    $0x1,%esi
+ 883:	84 db                	test   %bl,%bl
+ 885:	74 29                	je     8b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 887:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 88a:	85 d2                	test   %edx,%edx
+ 88c:	74 ca                	je     858 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 88e:	83 fa 25             	cmp    $0x25,%edx
+ 891:	75 ea                	jne    87d <printf+0x4d>
+      if(c == 'd'){
+ 893:	83 f8 25             	cmp    $0x25,%eax
+ 896:	0f 84 24 01 00 00    	je     9c0 <printf+0x190>
+ 89c:	83 e8 63             	sub    $0x63,%eax
+ 89f:	83 f8 15             	cmp    $0x15,%eax
+ 8a2:	77 1c                	ja     8c0 <printf+0x90>
+ 8a4:	ff 24 85 94 0c 00 00 	jmp    *0xc94(,%eax,4)
+ 8ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8b3:	5b                   	pop    %ebx
+ 8b4:	5e                   	pop    %esi
+ 8b5:	5f                   	pop    %edi
+ 8b6:	5d                   	pop    %ebp
+ 8b7:	c3                   	ret
+ 8b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bf:	90                   	nop
+  write(fd, &c, 1);
+ 8c0:	83 ec 04             	sub    $0x4,%esp
+ 8c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8ca:	6a 01                	push   $0x1
+ 8cc:	52                   	push   %edx
+ 8cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8d0:	57                   	push   %edi
+ 8d1:	e8 ca fd ff ff       	call   6a0 <write>
+ 8d6:	83 c4 0c             	add    $0xc,%esp
+ 8d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8dc:	6a 01                	push   $0x1
+ 8de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8e1:	52                   	push   %edx
+ 8e2:	57                   	push   %edi
+ 8e3:	e8 b8 fd ff ff       	call   6a0 <write>
+        putc(fd, c);
+ 8e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8eb:	31 d2                	xor    %edx,%edx
+ 8ed:	eb 8e                	jmp    87d <printf+0x4d>
+ 8ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8f3:	83 ec 0c             	sub    $0xc,%esp
+ 8f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8fb:	8b 13                	mov    (%ebx),%edx
+ 8fd:	6a 00                	push   $0x0
+ 8ff:	89 f8                	mov    %edi,%eax
+        ap++;
+ 901:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 904:	e8 87 fe ff ff       	call   790 <printint>
+        ap++;
+ 909:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 90c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 90f:	31 d2                	xor    %edx,%edx
+ 911:	e9 67 ff ff ff       	jmp    87d <printf+0x4d>
+ 916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 920:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 923:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 925:	83 c0 04             	add    $0x4,%eax
+ 928:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 92b:	85 db                	test   %ebx,%ebx
+ 92d:	0f 84 9d 00 00 00    	je     9d0 <printf+0x1a0>
+        while(*s != 0){
+ 933:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 936:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 938:	84 c0                	test   %al,%al
+ 93a:	0f 84 3d ff ff ff    	je     87d <printf+0x4d>
+ 940:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 943:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 946:	89 de                	mov    %ebx,%esi
+ 948:	89 d3                	mov    %edx,%ebx
+ 94a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 950:	83 ec 04             	sub    $0x4,%esp
+ 953:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 956:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 959:	6a 01                	push   $0x1
+ 95b:	53                   	push   %ebx
+ 95c:	57                   	push   %edi
+ 95d:	e8 3e fd ff ff       	call   6a0 <write>
+        while(*s != 0){
+ 962:	0f b6 06             	movzbl (%esi),%eax
+ 965:	83 c4 10             	add    $0x10,%esp
+ 968:	84 c0                	test   %al,%al
+ 96a:	75 e4                	jne    950 <printf+0x120>
+      state = 0;
+ 96c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 96f:	31 d2                	xor    %edx,%edx
+ 971:	e9 07 ff ff ff       	jmp    87d <printf+0x4d>
+ 976:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 980:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 983:	83 ec 0c             	sub    $0xc,%esp
+ 986:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 98b:	8b 13                	mov    (%ebx),%edx
+ 98d:	6a 01                	push   $0x1
+ 98f:	e9 6b ff ff ff       	jmp    8ff <printf+0xcf>
+ 994:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 998:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 99b:	83 ec 04             	sub    $0x4,%esp
+ 99e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 9a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 9a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 9a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 9a9:	6a 01                	push   $0x1
+ 9ab:	52                   	push   %edx
+ 9ac:	57                   	push   %edi
+ 9ad:	e8 ee fc ff ff       	call   6a0 <write>
+        ap++;
+ 9b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9b8:	31 d2                	xor    %edx,%edx
+ 9ba:	e9 be fe ff ff       	jmp    87d <printf+0x4d>
+ 9bf:	90                   	nop
+  write(fd, &c, 1);
+ 9c0:	83 ec 04             	sub    $0x4,%esp
+ 9c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9c9:	6a 01                	push   $0x1
+ 9cb:	e9 11 ff ff ff       	jmp    8e1 <printf+0xb1>
+ 9d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9d5:	bb 8c 0c 00 00       	mov    $0xc8c,%ebx
+ 9da:	e9 61 ff ff ff       	jmp    940 <printf+0x110>
+ 9df:	90                   	nop
+
+000009e0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9e0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9e1:	a1 2c 10 00 00       	mov    0x102c,%eax
+{
+ 9e6:	89 e5                	mov    %esp,%ebp
+ 9e8:	57                   	push   %edi
+ 9e9:	56                   	push   %esi
+ 9ea:	53                   	push   %ebx
+ 9eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9ee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9f8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9fa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9fc:	39 ca                	cmp    %ecx,%edx
+ 9fe:	73 30                	jae    a30 <free+0x50>
+ a00:	39 c1                	cmp    %eax,%ecx
+ a02:	72 04                	jb     a08 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a04:	39 c2                	cmp    %eax,%edx
+ a06:	72 f0                	jb     9f8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a08:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a0b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a0e:	39 f8                	cmp    %edi,%eax
+ a10:	74 2e                	je     a40 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a12:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a15:	8b 42 04             	mov    0x4(%edx),%eax
+ a18:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a1b:	39 f1                	cmp    %esi,%ecx
+ a1d:	74 38                	je     a57 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a1f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a21:	5b                   	pop    %ebx
+  freep = p;
+ a22:	89 15 2c 10 00 00    	mov    %edx,0x102c
+}
+ a28:	5e                   	pop    %esi
+ a29:	5f                   	pop    %edi
+ a2a:	5d                   	pop    %ebp
+ a2b:	c3                   	ret
+ a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a30:	39 c1                	cmp    %eax,%ecx
+ a32:	72 d0                	jb     a04 <free+0x24>
+ a34:	eb c2                	jmp    9f8 <free+0x18>
+ a36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a3d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a40:	03 70 04             	add    0x4(%eax),%esi
+ a43:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a46:	8b 02                	mov    (%edx),%eax
+ a48:	8b 00                	mov    (%eax),%eax
+ a4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a4d:	8b 42 04             	mov    0x4(%edx),%eax
+ a50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a53:	39 f1                	cmp    %esi,%ecx
+ a55:	75 c8                	jne    a1f <free+0x3f>
+    p->s.size += bp->s.size;
+ a57:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a5a:	89 15 2c 10 00 00    	mov    %edx,0x102c
+    p->s.size += bp->s.size;
+ a60:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a63:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a66:	89 0a                	mov    %ecx,(%edx)
+}
+ a68:	5b                   	pop    %ebx
+ a69:	5e                   	pop    %esi
+ a6a:	5f                   	pop    %edi
+ a6b:	5d                   	pop    %ebp
+ a6c:	c3                   	ret
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a70 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a70:	55                   	push   %ebp
+ a71:	89 e5                	mov    %esp,%ebp
+ a73:	57                   	push   %edi
+ a74:	56                   	push   %esi
+ a75:	53                   	push   %ebx
+ a76:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a79:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a7c:	8b 15 2c 10 00 00    	mov    0x102c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a82:	8d 78 07             	lea    0x7(%eax),%edi
+ a85:	c1 ef 03             	shr    $0x3,%edi
+ a88:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a8b:	85 d2                	test   %edx,%edx
+ a8d:	0f 84 8d 00 00 00    	je     b20 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a93:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a95:	8b 48 04             	mov    0x4(%eax),%ecx
+ a98:	39 f9                	cmp    %edi,%ecx
+ a9a:	73 64                	jae    b00 <malloc+0x90>
+  if(nu < 4096)
+ a9c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ aa1:	39 df                	cmp    %ebx,%edi
+ aa3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ aa6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ aad:	eb 0a                	jmp    ab9 <malloc+0x49>
+ aaf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ab0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ab2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ab5:	39 f9                	cmp    %edi,%ecx
+ ab7:	73 47                	jae    b00 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ab9:	89 c2                	mov    %eax,%edx
+ abb:	39 05 2c 10 00 00    	cmp    %eax,0x102c
+ ac1:	75 ed                	jne    ab0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ac3:	83 ec 0c             	sub    $0xc,%esp
+ ac6:	56                   	push   %esi
+ ac7:	e8 3c fc ff ff       	call   708 <sbrk>
+  if(p == (char*)-1)
+ acc:	83 c4 10             	add    $0x10,%esp
+ acf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ad2:	74 1c                	je     af0 <malloc+0x80>
+  hp->s.size = nu;
+ ad4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ad7:	83 ec 0c             	sub    $0xc,%esp
+ ada:	83 c0 08             	add    $0x8,%eax
+ add:	50                   	push   %eax
+ ade:	e8 fd fe ff ff       	call   9e0 <free>
+  return freep;
+ ae3:	8b 15 2c 10 00 00    	mov    0x102c,%edx
+      if((p = morecore(nunits)) == 0)
+ ae9:	83 c4 10             	add    $0x10,%esp
+ aec:	85 d2                	test   %edx,%edx
+ aee:	75 c0                	jne    ab0 <malloc+0x40>
+        return 0;
+  }
+}
+ af0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ af3:	31 c0                	xor    %eax,%eax
+}
+ af5:	5b                   	pop    %ebx
+ af6:	5e                   	pop    %esi
+ af7:	5f                   	pop    %edi
+ af8:	5d                   	pop    %ebp
+ af9:	c3                   	ret
+ afa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b00:	39 cf                	cmp    %ecx,%edi
+ b02:	74 4c                	je     b50 <malloc+0xe0>
+        p->s.size -= nunits;
+ b04:	29 f9                	sub    %edi,%ecx
+ b06:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b09:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b0c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b0f:	89 15 2c 10 00 00    	mov    %edx,0x102c
+}
+ b15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b18:	83 c0 08             	add    $0x8,%eax
+}
+ b1b:	5b                   	pop    %ebx
+ b1c:	5e                   	pop    %esi
+ b1d:	5f                   	pop    %edi
+ b1e:	5d                   	pop    %ebp
+ b1f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b20:	c7 05 2c 10 00 00 30 	movl   $0x1030,0x102c
+ b27:	10 00 00 
+    base.s.size = 0;
+ b2a:	b8 30 10 00 00       	mov    $0x1030,%eax
+    base.s.ptr = freep = prevp = &base;
+ b2f:	c7 05 30 10 00 00 30 	movl   $0x1030,0x1030
+ b36:	10 00 00 
+    base.s.size = 0;
+ b39:	c7 05 34 10 00 00 00 	movl   $0x0,0x1034
+ b40:	00 00 00 
+    if(p->s.size >= nunits){
+ b43:	e9 54 ff ff ff       	jmp    a9c <malloc+0x2c>
+ b48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b50:	8b 08                	mov    (%eax),%ecx
+ b52:	89 0a                	mov    %ecx,(%edx)
+ b54:	eb b9                	jmp    b0f <malloc+0x9f>
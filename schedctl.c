@@ -0,0 +1,96 @@
+#include "types.h"
+#include "stat.h"
+#include "param.h"
+#include "sched.h"
+#include "user.h"
+
+// Show or change the scheduler of the running kernel.
+// Usage:
+//   schedctl                      -> print current parameters
+//   schedctl policy mlfq|stride   -> switch scheduling policy
+//   schedctl levels <n>           -> use n levels (1..NMLFQ)
+//   schedctl quantum <lvl> <t>    -> level lvl gets a t-tick slice
+//   schedctl boost <t>            -> move up a level after waiting t ticks
+//                                    (0 = never)
+//   schedctl tickless 0|1         -> periodic or one-shot timer
+// Several settings can be given at once, e.g.
+//   schedctl levels 4 quantum 3 8 boost 200
+
+static char *policies[] = {
+[SCHED_MLFQ]    "mlfq",
+[SCHED_STRIDE]  "stride",
+};
+#define NPOLICY (sizeof(policies)/sizeof(policies[0]))
+
+static void
+usage(void)
+{
+  printf(2, "Usage: schedctl [policy name] [levels n] [quantum lvl t] [boost t] [tickless 0|1]\n");
+  exit();
+}
+
+static void
+show(struct schedparams *sp)
+{
+  int i, id;
+
+  id = setpolicy(-1);
+  printf(1, "policy %s\n", (uint)id < NPOLICY ? policies[id] : "?");
+  printf(1, "levels %d boost %d tickless %d\n", sp->nlevels, sp->boost_ticks,
+         sp->tickless);
+  for(i = 0; i < sp->nlevels; i++)
+    printf(1, "  level %d: quantum %d\n", i, sp->quantum[i]);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct schedparams sp;
+  int i, lvl, id, policy;
+
+  if(getschedparams(&sp) < 0){
+    printf(2, "schedctl: getschedparams failed\n");
+    exit();
+  }
+  if(argc < 2){
+    show(&sp);
+    exit();
+  }
+
+  policy = -1;
+  for(i = 1; i < argc; i++){
+    if(strcmp(argv[i], "policy") == 0 && i+1 < argc){
+      i++;
+      for(id = 0; id < NPOLICY; id++)
+        if(strcmp(argv[i], policies[id]) == 0)
+          policy = id;
+      if(policy < 0)
+        usage();
+    } else if(strcmp(argv[i], "levels") == 0 && i+1 < argc){
+      sp.nlevels = atoi(argv[++i]);
+    } else if(strcmp(argv[i], "quantum") == 0 && i+2 < argc){
+      lvl = atoi(argv[++i]);
+      if(lvl < 0 || lvl >= NMLFQ)
+        usage();
+      sp.quantum[lvl] = atoi(argv[++i]);
+    } else if(strcmp(argv[i], "boost") == 0 && i+1 < argc){
+      sp.boost_ticks = atoi(argv[++i]);
+    } else if(strcmp(argv[i], "tickless") == 0 && i+1 < argc){
+      sp.tickless = atoi(argv[++i]);
+    } else {
+      usage();
+    }
+  }
+
+  if(setschedparams(&sp) < 0){
+    printf(2, "schedctl: invalid parameters\n");
+    exit();
+  }
+  if(policy >= 0 && setpolicy(policy) < 0){
+    printf(2, "schedctl: cannot switch policy\n");
+    exit();
+  }
+  getschedparams(&sp);
+  show(&sp);
+  exit();
+}
@@ -0,0 +1,226 @@
+// Slab allocator for small kernel objects.
+//
+// A slab cache hands out objects of one size, packed into slabs of
+// one kalloc() page each.  A slab starts with a struct slab header;
+// the rest of the page is object slots, and free slots are linked
+// through a pointer stored in the slot.  Each cache keeps its slabs
+// with free slots on a partial list and its full slabs on another,
+// so allocation is a pop from the first partial slab.
+//
+// A constructor, if the cache has one, runs once per slot when its
+// slab is created, and objects are expected back in that constructed
+// state (a lock initialized, say).  For such caches the free link is
+// kept just past the object so it does not clobber it.
+//
+// kmalloc() and kmfree() are the general interface, backed by caches
+// of power-of-two sizes up to KMALLOC_MAX; larger buffers come from
+// kalloc_pages().
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "slab.h"
+
+#define NSLABCACHE 16
+#define KMALLOC_MIN 16
+
+struct slab {
+  struct slabcache *cache;
+  struct slab *next;       // on the cache's partial or full list
+  struct slab *prev;
+  void *free;              // free slots
+  int inuse;               // allocated objects
+};
+
+struct slabcache {
+  struct spinlock lock;
+  char *name;
+  uint size;               // object size
+  uint slot;               // bytes per slot, including any free link
+  uint link;               // offset of the free link in a slot
+  int perslab;             // slots per slab
+  int flags;
+  void (*ctor)(void*);
+  struct slab *partial;    // slabs with free slots
+  struct slab *full;
+  int nfree;               // free slots in all partial slabs
+};
+
+static struct slabcache caches[NSLABCACHE];
+static int ncaches;
+
+static struct slabcache *kmalloc_caches[8];   // KMALLOC_MIN << i
+static char *kmalloc_names[] = {
+  "kmalloc-16", "kmalloc-32", "kmalloc-64", "kmalloc-128",
+  "kmalloc-256", "kmalloc-512", "kmalloc-1024", "kmalloc-2048",
+};
+
+// Slots start after the header, 8-byte aligned.
+#define SLAB_FIRST  ((sizeof(struct slab) + 7) & ~7)
+
+// Make a cache of size-byte objects.  Caches are created at boot and
+// never destroyed.
+struct slabcache*
+slab_create(char *name, uint size, void (*ctor)(void*), int flags)
+{
+  struct slabcache *c;
+
+  if(ncaches >= NSLABCACHE || size == 0)
+    panic("slab_create");
+  c = &caches[ncaches++];
+  initlock(&c->lock, "slab");
+  c->name = name;
+  c->size = size;
+  c->ctor = ctor;
+  c->flags = flags;
+  if(ctor){
+    c->link = (size + 3) & ~3;
+    c->slot = c->link + sizeof(void*);
+  } else {
+    c->link = 0;
+    c->slot = size < sizeof(void*) ? sizeof(void*) : size;
+  }
+  c->slot = (c->slot + 7) & ~7;
+  c->perslab = (PGSIZE - SLAB_FIRST) / c->slot;
+  if(c->perslab < 1)
+    panic("slab_create: object too big");
+  return c;
+}
+
+static void**
+linkof(struct slabcache *c, char *obj)
+{
+  return (void**)(obj + c->link);
+}
+
+static void
+list_add(struct slab **head, struct slab *s)
+{
+  s->prev = 0;
+  s->next = *head;
+  if(*head)
+    (*head)->prev = s;
+  *head = s;
+}
+
+static void
+list_del(struct slab **head, struct slab *s)
+{
+  if(s->prev)
+    s->prev->next = s->next;
+  else
+    *head = s->next;
+  if(s->next)
+    s->next->prev = s->prev;
+}
+
+// Carve a fresh page into a slab of constructed, free slots.
+static struct slab*
+slab_grow(struct slabcache *c)
+{
+  struct slab *s;
+  char *obj;
+  int i;
+
+  if((s = (struct slab*)kalloc()) == 0)
+    return 0;
+  s->cache = c;
+  s->inuse = 0;
+  s->free = 0;
+  for(i = c->perslab - 1; i >= 0; i--){
+    obj = (char*)s + SLAB_FIRST + i * c->slot;
+    if(c->ctor)
+      c->ctor(obj);
+    *linkof(c, obj) = s->free;
+    s->free = obj;
+  }
+  return s;
+}
+
+// Allocate an object from c, or return 0 if out of memory.  Objects
+// of caches without a constructor come back uninitialized.
+void*
+slab_alloc(struct slabcache *c)
+{
+  struct slab *s;
+  char *obj;
+
+  acquire(&c->lock);
+  if((s = c->partial) == 0){
+    // kalloc() does not sleep, so growing under the lock is fine.
+    if((s = slab_grow(c)) == 0){
+      release(&c->lock);
+      return 0;
+    }
+    list_add(&c->partial, s);
+    c->nfree += c->perslab;
+  }
+  obj = s->free;
+  s->free = *linkof(c, obj);
+  s->inuse++;
+  c->nfree--;
+  if(s->free == 0){
+    list_del(&c->partial, s);
+    list_add(&c->full, s);
+  }
+  release(&c->lock);
+  return obj;
+}
+
+// Return obj to c.  An empty slab goes back to kalloc() once the cache
+// has a slab's worth of free slots elsewhere, unless c is SLAB_KEEP.
+void
+slab_free(struct slabcache *c, void *obj)
+{
+  struct slab *s = (struct slab*)PGROUNDDOWN((uint)obj);
+
+  if(s->cache != c || ((char*)obj - (char*)s - SLAB_FIRST) % c->slot)
+    panic("slab_free");
+
+  acquire(&c->lock);
+  if(s->free == 0){
+    list_del(&c->full, s);
+    list_add(&c->partial, s);
+  }
+  *linkof(c, obj) = s->free;
+  s->free = obj;
+  s->inuse--;
+  c->nfree++;
+  if(s->inuse == 0 && !(c->flags & SLAB_KEEP) &&
+     c->nfree - c->perslab >= c->perslab){
+    list_del(&c->partial, s);
+    c->nfree -= c->perslab;
+    kfree((char*)s);
+  }
+  release(&c->lock);
+}
+
+void
+slabinit(void)
+{
+  for(int i = 0; i < NELEM(kmalloc_caches); i++)
+    kmalloc_caches[i] = slab_create(kmalloc_names[i], KMALLOC_MIN << i, 0, 0);
+}
+
+// Allocate n bytes, up to KMALLOC_MAX, or return 0.
+void*
+kmalloc(uint n)
+{
+  int i;
+
+  for(i = 0; i < NELEM(kmalloc_caches); i++)
+    if(n <= KMALLOC_MIN << i)
+      return slab_alloc(kmalloc_caches[i]);
+  return 0;
+}
+
+void
+kmfree(void *p)
+{
+  struct slab *s = (struct slab*)PGROUNDDOWN((uint)p);
+
+  slab_free(s->cache, p);
+}
@@ -0,0 +1,6 @@
+// Slab allocator interface, see slab.c.
+
+#define KMALLOC_MAX 2048   // largest kmalloc(); use kalloc_pages() above
+
+// slab_create() flags
+#define SLAB_KEEP   1      // never give slabs back: objects stay type-stable
@@ -1,4 +1,11 @@
 // Sleeping locks
+//
+// A process waiting for a sleeplock lends its MLFQ level to the
+// holder (priority inheritance), so a demoted holder cannot keep an
+// interactive waiter stuck behind CPU-bound work.  The holder keeps
+// the best level lent through any lock it holds until it releases
+// that lock.  Inheritance is one level deep: a holder that later
+// blocks on another lock passes its inherited level on at that point.
 
 #include "types.h"
 #include "defs.h"
@@ -17,26 +24,59 @@ initsleeplock(struct sleeplock *lk, char *name)
   lk->name = name;
   lk->locked = 0;
   lk->pid = 0;
+  lk->holder = 0;
+  lk->waitprio = NMLFQ;
+  lk->nextheld = 0;
 }
 
 void
 acquiresleep(struct sleeplock *lk)
 {
+  struct proc *p = myproc();
+  int prio;
+
   acquire(&lk->lk);
   while (lk->locked) {
+    prio = sched_effprio(p);
+    if(prio < lk->waitprio){
+      lk->waitprio = prio;
+      sched_inherit(lk->holder, prio);
+    }
     sleep(lk, &lk->lk);
   }
   lk->locked = 1;
-  lk->pid = myproc()->pid;
+  lk->pid = p->pid;
+  lk->holder = p;
+  lk->nextheld = p->heldlocks;
+  p->heldlocks = lk;
   release(&lk->lk);
 }
 
 void
 releasesleep(struct sleeplock *lk)
 {
+  struct proc *p;
+  struct sleeplock **pp;
+
   acquire(&lk->lk);
+  if((p = lk->holder) != 0){
+    for(pp = &p->heldlocks; *pp; pp = &(*pp)->nextheld){
+      if(*pp == lk){
+        *pp = lk->nextheld;
+        break;
+      }
+    }
+  }
   lk->locked = 0;
   lk->pid = 0;
+  lk->holder = 0;
+  lk->nextheld = 0;
+  lk->waitprio = NMLFQ;  // waiters that lose the race lend again
+
+  // Keep only what is still lent through the locks p holds.
+  if(p && p->inherited < NMLFQ)
+    sched_uninherit(p);
+
   wakeup(lk);
   release(&lk->lk);
 }
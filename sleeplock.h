@@ -1,10 +1,19 @@
+#ifndef SLEEPLOCK_H
+#define SLEEPLOCK_H
+
 // Long-term locks for processes
 struct sleeplock {
   uint locked;       // Is the lock held?
   struct spinlock lk; // spinlock protecting this sleep lock
+
+  // Priority inheritance:
+  struct proc *holder;         // Process holding lock
+  int waitprio;                // Best MLFQ level among waiters, NMLFQ if none
+  struct sleeplock *nextheld;  // Next lock on holder's heldlocks list
   
   // For debugging:
   char *name;        // Name of lock.
   int pid;           // Process holding lock
 };
 
+#endif // SLEEPLOCK_H
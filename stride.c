@@ -0,0 +1,106 @@
+// Stride (proportional-share) scheduling policy.
+//
+// Every process holds p->tickets and advances its pass by
+// STRIDE1/tickets for each tick it runs; the process with the lowest
+// pass runs next, so CPU time is split in proportion to tickets.
+// Each CPU keeps its runnable processes in one list sorted by pass.
+// The generic half (placement, stealing, locking) is in proc.c.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "sched.h"
+
+#define STRIDE1 (1 << 16)
+
+// Passes wrap; compare them as a signed distance.
+static int
+pass_before(uint a, uint b)
+{
+  return (int)(a - b) < 0;
+}
+
+void
+stride_settickets(struct proc *p, int tickets)
+{
+  p->tickets = tickets;
+  p->stride = STRIDE1 / tickets;
+}
+
+static void
+stride_enqueue(struct cpu *c, struct proc *p)
+{
+  struct stride *s = &c->rq.stride;
+  struct proc *prev, *next;
+
+  // Anyone arriving from sleep, fork or another CPU starts no earlier
+  // than this CPU's virtual time, so sleeping cannot bank credit.
+  if(c->proc != p && pass_before(p->pass, s->vtime))
+    p->pass = s->vtime;
+
+  // Sorted insert, behind processes with an equal pass.
+  prev = 0;
+  for(next = s->head; next && !pass_before(p->pass, next->pass); next = next->rqnext)
+    prev = next;
+  p->rqprev = prev;
+  p->rqnext = next;
+  if(prev)
+    prev->rqnext = p;
+  else
+    s->head = p;
+  if(next)
+    next->rqprev = p;
+}
+
+static void
+stride_dequeue(struct proc *p)
+{
+  struct stride *s = &cpus[p->rqcpu].rq.stride;
+
+  if(p->rqprev)
+    p->rqprev->rqnext = p->rqnext;
+  else
+    s->head = p->rqnext;
+  if(p->rqnext)
+    p->rqnext->rqprev = p->rqprev;
+  p->rqnext = p->rqprev = 0;
+}
+
+static struct proc*
+stride_pick(struct cpu *c)
+{
+  struct stride *s = &c->rq.stride;
+
+  if(s->head)
+    s->vtime = s->head->pass;
+  return s->head;
+}
+
+// Charge the tick and let the lowest pass run next.
+static int
+stride_tick(struct proc *p)
+{
+  p->pass += p->stride;
+  return 1;
+}
+
+// Every tick is a scheduling decision.
+static int
+stride_slice(struct proc *p)
+{
+  return 1;
+}
+
+struct sched_class stride_class = {
+  .name = "stride",
+  .enqueue = stride_enqueue,
+  .dequeue = stride_dequeue,
+  .pick = stride_pick,
+  .tick = stride_tick,
+  .slice = stride_slice,
+  .age = 0,
+};
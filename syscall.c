@@ -19,7 +19,7 @@ fetchint(uint addr, int *ip)
 {
   struct proc *curproc = myproc();
 
-  if(addr >= curproc->sz || addr+4 > curproc->sz)
+  if(addr >= curproc->vm->sz || addr+4 > curproc->vm->sz)
     return -1;
   *ip = *(int*)(addr);
   return 0;
@@ -34,10 +34,10 @@ fetchstr(uint addr, char **pp)
   char *s, *ep;
   struct proc *curproc = myproc();
 
-  if(addr >= curproc->sz)
+  if(addr >= curproc->vm->sz)
     return -1;
   *pp = (char*)addr;
-  ep = (char*)curproc->sz;
+  ep = (char*)curproc->vm->sz;
   for(s = *pp; s < ep; s++){
     if(*s == 0)
       return s - *pp;
@@ -63,12 +63,29 @@ argptr(int n, char **pp, int size)
  
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+  if(size < 0 || (uint)i >= curproc->vm->sz || (uint)i+size > curproc->vm->sz)
     return -1;
   *pp = (char*)i;
   return 0;
 }
 
+// Like argptr, for a block the kernel is going to write: give the
+// process its own copy of any copy-on-write page in it now, while the
+// call can still fail, instead of in the page fault handler, which
+// can only panic if it is out of memory.
+int
+argptrw(int n, char **pp, int size)
+{
+  uint a;
+
+  if(argptr(n, pp, size) < 0)
+    return -1;
+  for(a = PGROUNDDOWN((uint)*pp); a < (uint)*pp + size; a += PGSIZE)
+    if(cowbreak(myproc()->vm->pgdir, a) < 0)
+      return -1;
+  return 0;
+}
+
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
 // (There is no shared writable memory, so the string can't change
@@ -104,6 +121,19 @@ extern int sys_wait(void);
 extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_ps(void);
+extern int sys_getschedparams(void);
+extern int sys_setschedparams(void);
+extern int sys_getpinfo(void);
+extern int sys_getlathist(void);
+extern int sys_setpolicy(void);
+extern int sys_settickets(void);
+extern int sys_setaffinity(void);
+extern int sys_getaffinity(void);
+extern int sys_setrt(void);
+extern int sys_clone(void);
+extern int sys_join(void);
+extern int sys_futex_wait(void);
+extern int sys_futex_wake(void);
 
 
 static int (*syscalls[])(void) = {
@@ -129,6 +159,19 @@ static int (*syscalls[])(void) = {
 [SYS_mkdir]   sys_mkdir,
 [SYS_close]   sys_close,
 [SYS_ps] sys_ps,
+[SYS_getschedparams] sys_getschedparams,
+[SYS_setschedparams] sys_setschedparams,
+[SYS_getpinfo] sys_getpinfo,
+[SYS_getlathist] sys_getlathist,
+[SYS_setpolicy] sys_setpolicy,
+[SYS_settickets] sys_settickets,
+[SYS_setaffinity] sys_setaffinity,
+[SYS_getaffinity] sys_getaffinity,
+[SYS_setrt]   sys_setrt,
+[SYS_clone]   sys_clone,
+[SYS_join]    sys_join,
+[SYS_futex_wait] sys_futex_wait,
+[SYS_futex_wake] sys_futex_wake,
 
 };
 
@@ -140,7 +183,9 @@ syscall(void)
 
   num = curproc->tf->eax;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+    vmspace_enter(curproc);
     curproc->tf->eax = syscalls[num]();
+    vmspace_leave(curproc);
   } else {
     cprintf("%d %s: unknown sys call %d\n",
             curproc->pid, curproc->name, num);
@@ -21,3 +21,16 @@
 #define SYS_mkdir  20
 #define SYS_close  21
 #define SYS_ps 22
+#define SYS_getschedparams 23
+#define SYS_setschedparams 24
+#define SYS_getpinfo 25
+#define SYS_getlathist 26
+#define SYS_setpolicy 27
+#define SYS_settickets 28
+#define SYS_setaffinity 29
+#define SYS_getaffinity 30
+#define SYS_setrt  31
+#define SYS_clone  32
+#define SYS_join   33
+#define SYS_futex_wait 34
+#define SYS_futex_wake 35
@@ -6,6 +6,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "sched.h"
 
 int
 sys_fork(void)
@@ -50,8 +51,7 @@ sys_sbrk(void)
 
   if(argint(0, &n) < 0)
     return -1;
-  addr = myproc()->sz;
-  if(growproc(n) < 0)
+  if((addr = growproc(n)) < 0)
     return -1;
   return addr;
 }
@@ -60,21 +60,10 @@ int
 sys_sleep(void)
 {
   int n;
-  uint ticks0;
 
   if(argint(0, &n) < 0)
     return -1;
-  acquire(&tickslock);
-  ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(myproc()->killed){
-      release(&tickslock);
-      return -1;
-    }
-    sleep(&ticks, &tickslock);
-  }
-  release(&tickslock);
-  return 0;
+  return timersleep(n);
 }
 
 // return how many clock tick interrupts have occurred
@@ -98,3 +87,157 @@ sys_ps(void)
   return 0;
 }
 
+int
+sys_getschedparams(void)
+{
+  struct schedparams *sp;
+
+  if(argptrw(0, (void*)&sp, sizeof(*sp)) < 0)
+    return -1;
+  *sp = schedparams;
+  return 0;
+}
+
+int
+sys_setschedparams(void)
+{
+  struct schedparams *usp, sp;
+
+  if(argptr(0, (void*)&usp, sizeof(*usp)) < 0)
+    return -1;
+  sp = *usp;
+  return setschedparams(&sp);
+}
+
+// getpinfo(struct pinfo *buf, int n): fill buf with up to n
+// per-process records; returns the number filled.
+int
+sys_getpinfo(void)
+{
+  struct pinfo *upi;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0 || n > 0x10000)
+    return -1;
+  if(argptrw(0, (void*)&upi, n*sizeof(*upi)) < 0)
+    return -1;
+  return getpinfo(upi, n);
+}
+
+// getlathist(struct lathist *buf, int reset): copy the wakeup-to-run
+// latency histograms, optionally clearing them; returns ncpu.
+int
+sys_getlathist(void)
+{
+  struct lathist *ulh;
+  int reset;
+
+  if(argptrw(0, (void*)&ulh, sizeof(*ulh)) < 0 || argint(1, &reset) < 0)
+    return -1;
+  return getlathist(ulh, reset);
+}
+
+// setpolicy(int id): switch scheduling policy (SCHED_* in sched.h);
+// returns the previous one.  A negative id only queries.
+int
+sys_setpolicy(void)
+{
+  int id;
+
+  if(argint(0, &id) < 0)
+    return -1;
+  return setpolicy(id);
+}
+
+int
+sys_settickets(void)
+{
+  int n;
+
+  if(argint(0, &n) < 0)
+    return -1;
+  return settickets(n);
+}
+
+// setrt(int period, int budget, int deadline), all in ticks;
+// period 0 leaves the real-time class.
+int
+sys_setrt(void)
+{
+  int period, budget, deadline;
+
+  if(argint(0, &period) < 0 || argint(1, &budget) < 0 ||
+     argint(2, &deadline) < 0)
+    return -1;
+  return setrt(period, budget, deadline);
+}
+
+// clone(void (*fcn)(void*, void*), void *arg1, void *arg2, void *stack):
+// stack is one page of the caller's memory.
+int
+sys_clone(void)
+{
+  int fcn, arg1, arg2;
+  char *stack;
+
+  if(argint(0, &fcn) < 0 || argint(1, &arg1) < 0 || argint(2, &arg2) < 0 ||
+     argptr(3, &stack, PGSIZE) < 0)
+    return -1;
+  return clone((void(*)(void*, void*))fcn, (void*)arg1, (void*)arg2, stack);
+}
+
+// join(void **stack)
+int
+sys_join(void)
+{
+  char *stack;
+
+  if(argptrw(0, &stack, sizeof(void*)) < 0)
+    return -1;
+  return join((void**)stack);
+}
+
+// futex_wait(uint *addr, uint val)
+int
+sys_futex_wait(void)
+{
+  int addr, val;
+
+  if(argint(0, &addr) < 0 || argint(1, &val) < 0)
+    return -1;
+  return futex_wait(addr, val);
+}
+
+// futex_wake(uint *addr, int n)
+int
+sys_futex_wake(void)
+{
+  int addr, n;
+
+  if(argint(0, &addr) < 0 || argint(1, &n) < 0)
+    return -1;
+  return futex_wake(addr, n);
+}
+
+// setaffinity(int pid, uint mask): bit i of mask allows cpu i;
+// pid 0 means the caller.
+int
+sys_setaffinity(void)
+{
+  int pid, mask;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+    return -1;
+  return setaffinity(pid, mask);
+}
+
+// getaffinity(int pid): CPU mask of pid (0 = caller), 0 if no such process.
+int
+sys_getaffinity(void)
+{
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  return getaffinity(pid);
+}
@@ -0,0 +1,1455 @@
+
+_taskset:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  int pid;
+
+  if(argc < 3)
+  19:	83 fe 02             	cmp    $0x2,%esi
+  1c:	7f 13                	jg     31 <main+0x31>
+  printf(2, "Usage: taskset mask cmd [args...] | taskset -p pid [mask]\n");
+  1e:	50                   	push   %eax
+  1f:	50                   	push   %eax
+  20:	68 28 09 00 00       	push   $0x928
+  25:	6a 02                	push   $0x2
+  27:	e8 d4 05 00 00       	call   600 <printf>
+  exit();
+  2c:	e8 1f 04 00 00       	call   450 <exit>
+    usage();
+
+  if(strcmp(argv[1], "-p") == 0){
+  31:	57                   	push   %edi
+  32:	57                   	push   %edi
+  33:	68 84 09 00 00       	push   $0x984
+  38:	ff 73 04             	push   0x4(%ebx)
+  3b:	e8 80 01 00 00       	call   1c0 <strcmp>
+  40:	83 c4 10             	add    $0x10,%esp
+  43:	85 c0                	test   %eax,%eax
+  45:	75 4c                	jne    93 <main+0x93>
+    pid = atoi(argv[2]);
+  47:	83 ec 0c             	sub    $0xc,%esp
+  4a:	ff 73 08             	push   0x8(%ebx)
+  4d:	e8 0e 03 00 00       	call   360 <atoi>
+    if(argc > 3 && setaffinity(pid, hextoi(argv[3])) < 0){
+  52:	83 c4 10             	add    $0x10,%esp
+    pid = atoi(argv[2]);
+  55:	89 c7                	mov    %eax,%edi
+    if(argc > 3 && setaffinity(pid, hextoi(argv[3])) < 0){
+  57:	83 fe 03             	cmp    $0x3,%esi
+  5a:	74 18                	je     74 <main+0x74>
+  5c:	8b 43 0c             	mov    0xc(%ebx),%eax
+  5f:	e8 9c 00 00 00       	call   100 <hextoi>
+  64:	56                   	push   %esi
+  65:	56                   	push   %esi
+  66:	50                   	push   %eax
+  67:	57                   	push   %edi
+  68:	e8 bb 04 00 00       	call   528 <setaffinity>
+  6d:	83 c4 10             	add    $0x10,%esp
+  70:	85 c0                	test   %eax,%eax
+  72:	78 72                	js     e6 <main+0xe6>
+      printf(2, "taskset: cannot set mask of %d\n", pid);
+      exit();
+    }
+    printf(1, "pid %d mask %x\n", pid, getaffinity(pid));
+  74:	83 ec 0c             	sub    $0xc,%esp
+  77:	57                   	push   %edi
+  78:	e8 b3 04 00 00       	call   530 <getaffinity>
+  7d:	50                   	push   %eax
+  7e:	57                   	push   %edi
+  7f:	68 87 09 00 00       	push   $0x987
+  84:	6a 01                	push   $0x1
+  86:	e8 75 05 00 00       	call   600 <printf>
+    exit();
+  8b:	83 c4 20             	add    $0x20,%esp
+  8e:	e8 bd 03 00 00       	call   450 <exit>
+  }
+
+  if(setaffinity(0, hextoi(argv[1])) < 0){
+  93:	8b 43 04             	mov    0x4(%ebx),%eax
+  96:	e8 65 00 00 00       	call   100 <hextoi>
+  9b:	51                   	push   %ecx
+  9c:	51                   	push   %ecx
+  9d:	50                   	push   %eax
+  9e:	6a 00                	push   $0x0
+  a0:	e8 83 04 00 00       	call   528 <setaffinity>
+  a5:	83 c4 10             	add    $0x10,%esp
+  a8:	85 c0                	test   %eax,%eax
+  aa:	78 25                	js     d1 <main+0xd1>
+    printf(2, "taskset: bad mask %s\n", argv[1]);
+    exit();
+  }
+  exec(argv[2], argv + 2);
+  ac:	50                   	push   %eax
+  ad:	50                   	push   %eax
+  ae:	8d 43 08             	lea    0x8(%ebx),%eax
+  b1:	50                   	push   %eax
+  b2:	ff 73 08             	push   0x8(%ebx)
+  b5:	e8 ce 03 00 00       	call   488 <exec>
+  printf(2, "taskset: exec %s failed\n", argv[2]);
+  ba:	83 c4 0c             	add    $0xc,%esp
+  bd:	ff 73 08             	push   0x8(%ebx)
+  c0:	68 ad 09 00 00       	push   $0x9ad
+  c5:	6a 02                	push   $0x2
+  c7:	e8 34 05 00 00       	call   600 <printf>
+  exit();
+  cc:	e8 7f 03 00 00       	call   450 <exit>
+    printf(2, "taskset: bad mask %s\n", argv[1]);
+  d1:	52                   	push   %edx
+  d2:	ff 73 04             	push   0x4(%ebx)
+  d5:	68 97 09 00 00       	push   $0x997
+  da:	6a 02                	push   $0x2
+  dc:	e8 1f 05 00 00       	call   600 <printf>
+    exit();
+  e1:	e8 6a 03 00 00       	call   450 <exit>
+      printf(2, "taskset: cannot set mask of %d\n", pid);
+  e6:	53                   	push   %ebx
+  e7:	57                   	push   %edi
+  e8:	68 64 09 00 00       	push   $0x964
+  ed:	6a 02                	push   $0x2
+  ef:	e8 0c 05 00 00       	call   600 <printf>
+      exit();
+  f4:	e8 57 03 00 00       	call   450 <exit>
+  f9:	66 90                	xchg   %ax,%ax
+  fb:	66 90                	xchg   %ax,%ax
+  fd:	66 90                	xchg   %ax,%ax
+  ff:	90                   	nop
+
+00000100 <hextoi>:
+  if(s[0] == '0' && s[1] == 'x')
+ 100:	80 38 30             	cmpb   $0x30,(%eax)
+{
+ 103:	89 c1                	mov    %eax,%ecx
+  if(s[0] == '0' && s[1] == 'x')
+ 105:	74 6a                	je     171 <hextoi+0x71>
+  for(; *s; s++){
+ 107:	0f be 11             	movsbl (%ecx),%edx
+ 10a:	84 d2                	test   %dl,%dl
+ 10c:	74 73                	je     181 <hextoi+0x81>
+{
+ 10e:	55                   	push   %ebp
+ 10f:	31 c0                	xor    %eax,%eax
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	53                   	push   %ebx
+ 114:	eb 1c                	jmp    132 <hextoi+0x32>
+ 116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+      n = n*16 + *s - '0';
+ 120:	c1 e0 04             	shl    $0x4,%eax
+ 123:	8d 44 10 d0          	lea    -0x30(%eax,%edx,1),%eax
+  for(; *s; s++){
+ 127:	0f be 51 01          	movsbl 0x1(%ecx),%edx
+ 12b:	83 c1 01             	add    $0x1,%ecx
+ 12e:	84 d2                	test   %dl,%dl
+ 130:	74 21                	je     153 <hextoi+0x53>
+    if(*s >= '0' && *s <= '9')
+ 132:	8d 5a d0             	lea    -0x30(%edx),%ebx
+ 135:	80 fb 09             	cmp    $0x9,%bl
+ 138:	76 e6                	jbe    120 <hextoi+0x20>
+    else if(*s >= 'a' && *s <= 'f')
+ 13a:	8d 5a 9f             	lea    -0x61(%edx),%ebx
+ 13d:	80 fb 05             	cmp    $0x5,%bl
+ 140:	77 1e                	ja     160 <hextoi+0x60>
+      n = n*16 + *s - 'a' + 10;
+ 142:	c1 e0 04             	shl    $0x4,%eax
+  for(; *s; s++){
+ 145:	83 c1 01             	add    $0x1,%ecx
+      n = n*16 + *s - 'a' + 10;
+ 148:	8d 44 10 a9          	lea    -0x57(%eax,%edx,1),%eax
+  for(; *s; s++){
+ 14c:	0f be 11             	movsbl (%ecx),%edx
+ 14f:	84 d2                	test   %dl,%dl
+ 151:	75 df                	jne    132 <hextoi+0x32>
+}
+ 153:	5b                   	pop    %ebx
+ 154:	5d                   	pop    %ebp
+ 155:	c3                   	ret
+ 156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+    else if(*s >= 'A' && *s <= 'F')
+ 160:	8d 5a bf             	lea    -0x41(%edx),%ebx
+ 163:	80 fb 05             	cmp    $0x5,%bl
+ 166:	77 eb                	ja     153 <hextoi+0x53>
+      n = n*16 + *s - 'A' + 10;
+ 168:	c1 e0 04             	shl    $0x4,%eax
+ 16b:	8d 44 10 c9          	lea    -0x37(%eax,%edx,1),%eax
+ 16f:	eb b6                	jmp    127 <hextoi+0x27>
+  if(s[0] == '0' && s[1] == 'x')
+ 171:	80 78 01 78          	cmpb   $0x78,0x1(%eax)
+  for(; *s; s++){
+ 175:	ba 30 00 00 00       	mov    $0x30,%edx
+  if(s[0] == '0' && s[1] == 'x')
+ 17a:	75 92                	jne    10e <hextoi+0xe>
+    s += 2;
+ 17c:	83 c1 02             	add    $0x2,%ecx
+ 17f:	eb 86                	jmp    107 <hextoi+0x7>
+  for(; *s; s++){
+ 181:	31 c0                	xor    %eax,%eax
+}
+ 183:	c3                   	ret
+ 184:	66 90                	xchg   %ax,%ax
+ 186:	66 90                	xchg   %ax,%ax
+ 188:	66 90                	xchg   %ax,%ax
+ 18a:	66 90                	xchg   %ax,%ax
+ 18c:	66 90                	xchg   %ax,%ax
+ 18e:	66 90                	xchg   %ax,%ax
+
+00000190 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 190:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 191:	31 c0                	xor    %eax,%eax
+{
+ 193:	89 e5                	mov    %esp,%ebp
+ 195:	53                   	push   %ebx
+ 196:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 199:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 19c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1a7:	83 c0 01             	add    $0x1,%eax
+ 1aa:	84 d2                	test   %dl,%dl
+ 1ac:	75 f2                	jne    1a0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1b1:	89 c8                	mov    %ecx,%eax
+ 1b3:	c9                   	leave
+ 1b4:	c3                   	ret
+ 1b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	53                   	push   %ebx
+ 1c4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1ca:	0f b6 02             	movzbl (%edx),%eax
+ 1cd:	84 c0                	test   %al,%al
+ 1cf:	75 17                	jne    1e8 <strcmp+0x28>
+ 1d1:	eb 3a                	jmp    20d <strcmp+0x4d>
+ 1d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1d7:	90                   	nop
+ 1d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1dc:	83 c2 01             	add    $0x1,%edx
+ 1df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1e2:	84 c0                	test   %al,%al
+ 1e4:	74 1a                	je     200 <strcmp+0x40>
+    p++, q++;
+ 1e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1e8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1eb:	38 c3                	cmp    %al,%bl
+ 1ed:	74 e9                	je     1d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1ef:	29 d8                	sub    %ebx,%eax
+}
+ 1f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1f4:	c9                   	leave
+ 1f5:	c3                   	ret
+ 1f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 200:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 204:	31 c0                	xor    %eax,%eax
+ 206:	29 d8                	sub    %ebx,%eax
+}
+ 208:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 20b:	c9                   	leave
+ 20c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 20d:	0f b6 19             	movzbl (%ecx),%ebx
+ 210:	31 c0                	xor    %eax,%eax
+ 212:	eb db                	jmp    1ef <strcmp+0x2f>
+ 214:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 21f:	90                   	nop
+
+00000220 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 226:	80 3a 00             	cmpb   $0x0,(%edx)
+ 229:	74 15                	je     240 <strlen+0x20>
+ 22b:	31 c0                	xor    %eax,%eax
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+ 230:	83 c0 01             	add    $0x1,%eax
+ 233:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 237:	89 c1                	mov    %eax,%ecx
+ 239:	75 f5                	jne    230 <strlen+0x10>
+    ;
+  return n;
+}
+ 23b:	89 c8                	mov    %ecx,%eax
+ 23d:	5d                   	pop    %ebp
+ 23e:	c3                   	ret
+ 23f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 240:	31 c9                	xor    %ecx,%ecx
+}
+ 242:	5d                   	pop    %ebp
+ 243:	89 c8                	mov    %ecx,%eax
+ 245:	c3                   	ret
+ 246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000250 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	57                   	push   %edi
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 257:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 25a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 25d:	89 d7                	mov    %edx,%edi
+ 25f:	fc                   	cld
+ 260:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 262:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 265:	89 d0                	mov    %edx,%eax
+ 267:	c9                   	leave
+ 268:	c3                   	ret
+ 269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 27a:	0f b6 10             	movzbl (%eax),%edx
+ 27d:	84 d2                	test   %dl,%dl
+ 27f:	75 12                	jne    293 <strchr+0x23>
+ 281:	eb 1d                	jmp    2a0 <strchr+0x30>
+ 283:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 287:	90                   	nop
+ 288:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 28c:	83 c0 01             	add    $0x1,%eax
+ 28f:	84 d2                	test   %dl,%dl
+ 291:	74 0d                	je     2a0 <strchr+0x30>
+    if(*s == c)
+ 293:	38 d1                	cmp    %dl,%cl
+ 295:	75 f1                	jne    288 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 297:	5d                   	pop    %ebp
+ 298:	c3                   	ret
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2a0:	31 c0                	xor    %eax,%eax
+}
+ 2a2:	5d                   	pop    %ebp
+ 2a3:	c3                   	ret
+ 2a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2b5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2b8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2b9:	31 db                	xor    %ebx,%ebx
+{
+ 2bb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2be:	eb 27                	jmp    2e7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	6a 01                	push   $0x1
+ 2c5:	56                   	push   %esi
+ 2c6:	6a 00                	push   $0x0
+ 2c8:	e8 9b 01 00 00       	call   468 <read>
+    if(cc < 1)
+ 2cd:	83 c4 10             	add    $0x10,%esp
+ 2d0:	85 c0                	test   %eax,%eax
+ 2d2:	7e 1d                	jle    2f1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2d4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2db:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2df:	3c 0a                	cmp    $0xa,%al
+ 2e1:	74 10                	je     2f3 <gets+0x43>
+ 2e3:	3c 0d                	cmp    $0xd,%al
+ 2e5:	74 0c                	je     2f3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2e7:	89 df                	mov    %ebx,%edi
+ 2e9:	83 c3 01             	add    $0x1,%ebx
+ 2ec:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2ef:	7c cf                	jl     2c0 <gets+0x10>
+ 2f1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2fd:	5b                   	pop    %ebx
+ 2fe:	5e                   	pop    %esi
+ 2ff:	5f                   	pop    %edi
+ 300:	5d                   	pop    %ebp
+ 301:	c3                   	ret
+ 302:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	56                   	push   %esi
+ 314:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 315:	83 ec 08             	sub    $0x8,%esp
+ 318:	6a 00                	push   $0x0
+ 31a:	ff 75 08             	push   0x8(%ebp)
+ 31d:	e8 6e 01 00 00       	call   490 <open>
+  if(fd < 0)
+ 322:	83 c4 10             	add    $0x10,%esp
+ 325:	85 c0                	test   %eax,%eax
+ 327:	78 27                	js     350 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 329:	83 ec 08             	sub    $0x8,%esp
+ 32c:	ff 75 0c             	push   0xc(%ebp)
+ 32f:	89 c3                	mov    %eax,%ebx
+ 331:	50                   	push   %eax
+ 332:	e8 71 01 00 00       	call   4a8 <fstat>
+  close(fd);
+ 337:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 33a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 33c:	e8 37 01 00 00       	call   478 <close>
+  return r;
+ 341:	83 c4 10             	add    $0x10,%esp
+}
+ 344:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 347:	89 f0                	mov    %esi,%eax
+ 349:	5b                   	pop    %ebx
+ 34a:	5e                   	pop    %esi
+ 34b:	5d                   	pop    %ebp
+ 34c:	c3                   	ret
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 350:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 355:	eb ed                	jmp    344 <stat+0x34>
+ 357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35e:	66 90                	xchg   %ax,%ax
+
+00000360 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	53                   	push   %ebx
+ 364:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 367:	0f be 02             	movsbl (%edx),%eax
+ 36a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 36d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 370:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 375:	77 1e                	ja     395 <atoi+0x35>
+ 377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 380:	83 c2 01             	add    $0x1,%edx
+ 383:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 386:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 38a:	0f be 02             	movsbl (%edx),%eax
+ 38d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 390:	80 fb 09             	cmp    $0x9,%bl
+ 393:	76 eb                	jbe    380 <atoi+0x20>
+  return n;
+}
+ 395:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 398:	89 c8                	mov    %ecx,%eax
+ 39a:	c9                   	leave
+ 39b:	c3                   	ret
+ 39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	56                   	push   %esi
+ 3a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ae:	85 c0                	test   %eax,%eax
+ 3b0:	7e 13                	jle    3c5 <memmove+0x25>
+ 3b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3b4:	89 d7                	mov    %edx,%edi
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3c1:	39 f8                	cmp    %edi,%eax
+ 3c3:	75 fb                	jne    3c0 <memmove+0x20>
+  return vdst;
+}
+ 3c5:	5e                   	pop    %esi
+ 3c6:	89 d0                	mov    %edx,%eax
+ 3c8:	5f                   	pop    %edi
+ 3c9:	5d                   	pop    %ebp
+ 3ca:	c3                   	ret
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <mutex_lock>:
+
+// Take and release m with atomic instructions, and enter the kernel
+// only to block while it is held or to wake a blocked thread.
+void
+mutex_lock(struct mutex *m)
+{
+ 3d0:	55                   	push   %ebp
+  uint s;
+
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 3d1:	31 c0                	xor    %eax,%eax
+ 3d3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 3d8:	89 e5                	mov    %esp,%ebp
+ 3da:	56                   	push   %esi
+ 3db:	53                   	push   %ebx
+ 3dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 3df:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 3e3:	85 c0                	test   %eax,%eax
+ 3e5:	74 30                	je     417 <mutex_lock+0x47>
+    return;
+  // Contended: mark it so the holder knows to wake us.
+  if(s != 2)
+ 3e7:	83 f8 02             	cmp    $0x2,%eax
+ 3ea:	74 0c                	je     3f8 <mutex_lock+0x28>
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 3ec:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3f1:	f0 87 03             	lock xchg %eax,(%ebx)
+    s = xchg(&m->state, 2);
+  while(s != 0){
+ 3f4:	85 c0                	test   %eax,%eax
+ 3f6:	74 1f                	je     417 <mutex_lock+0x47>
+ 3f8:	be 02 00 00 00       	mov    $0x2,%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+ 400:	83 ec 08             	sub    $0x8,%esp
+ 403:	6a 02                	push   $0x2
+ 405:	53                   	push   %ebx
+ 406:	e8 45 01 00 00       	call   550 <futex_wait>
+ 40b:	89 f0                	mov    %esi,%eax
+ 40d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(s != 0){
+ 410:	83 c4 10             	add    $0x10,%esp
+ 413:	85 c0                	test   %eax,%eax
+ 415:	75 e9                	jne    400 <mutex_lock+0x30>
+    s = xchg(&m->state, 2);
+  }
+}
+ 417:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 41a:	5b                   	pop    %ebx
+ 41b:	5e                   	pop    %esi
+ 41c:	5d                   	pop    %ebp
+ 41d:	c3                   	ret
+ 41e:	66 90                	xchg   %ax,%ax
+
+00000420 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 420:	55                   	push   %ebp
+ 421:	31 c0                	xor    %eax,%eax
+ 423:	89 e5                	mov    %esp,%ebp
+ 425:	83 ec 08             	sub    $0x8,%esp
+ 428:	8b 55 08             	mov    0x8(%ebp),%edx
+ 42b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 42e:	83 f8 02             	cmp    $0x2,%eax
+ 431:	74 05                	je     438 <mutex_unlock+0x18>
+    futex_wake(&m->state, 1);
+}
+ 433:	c9                   	leave
+ 434:	c3                   	ret
+ 435:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->state, 1);
+ 438:	83 ec 08             	sub    $0x8,%esp
+ 43b:	6a 01                	push   $0x1
+ 43d:	52                   	push   %edx
+ 43e:	e8 15 01 00 00       	call   558 <futex_wake>
+ 443:	83 c4 10             	add    $0x10,%esp
+}
+ 446:	c9                   	leave
+ 447:	c3                   	ret
+
+00000448 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 448:	b8 01 00 00 00       	mov    $0x1,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <exit>:
+SYSCALL(exit)
+ 450:	b8 02 00 00 00       	mov    $0x2,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <wait>:
+SYSCALL(wait)
+ 458:	b8 03 00 00 00       	mov    $0x3,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <pipe>:
+SYSCALL(pipe)
+ 460:	b8 04 00 00 00       	mov    $0x4,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <read>:
+SYSCALL(read)
+ 468:	b8 05 00 00 00       	mov    $0x5,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <write>:
+SYSCALL(write)
+ 470:	b8 10 00 00 00       	mov    $0x10,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <close>:
+SYSCALL(close)
+ 478:	b8 15 00 00 00       	mov    $0x15,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <kill>:
+SYSCALL(kill)
+ 480:	b8 06 00 00 00       	mov    $0x6,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <exec>:
+SYSCALL(exec)
+ 488:	b8 07 00 00 00       	mov    $0x7,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <open>:
+SYSCALL(open)
+ 490:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <mknod>:
+SYSCALL(mknod)
+ 498:	b8 11 00 00 00       	mov    $0x11,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <unlink>:
+SYSCALL(unlink)
+ 4a0:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <fstat>:
+SYSCALL(fstat)
+ 4a8:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <link>:
+SYSCALL(link)
+ 4b0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <mkdir>:
+SYSCALL(mkdir)
+ 4b8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <chdir>:
+SYSCALL(chdir)
+ 4c0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <dup>:
+SYSCALL(dup)
+ 4c8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <getpid>:
+SYSCALL(getpid)
+ 4d0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <sbrk>:
+SYSCALL(sbrk)
+ 4d8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <sleep>:
+SYSCALL(sleep)
+ 4e0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+
+000004e8 <uptime>:
+SYSCALL(uptime)
+ 4e8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4ed:	cd 40                	int    $0x40
+ 4ef:	c3                   	ret
+
+000004f0 <ps>:
+SYSCALL(ps)
+ 4f0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4f5:	cd 40                	int    $0x40
+ 4f7:	c3                   	ret
+
+000004f8 <getschedparams>:
+SYSCALL(getschedparams)
+ 4f8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4fd:	cd 40                	int    $0x40
+ 4ff:	c3                   	ret
+
+00000500 <setschedparams>:
+SYSCALL(setschedparams)
+ 500:	b8 18 00 00 00       	mov    $0x18,%eax
+ 505:	cd 40                	int    $0x40
+ 507:	c3                   	ret
+
+00000508 <getpinfo>:
+SYSCALL(getpinfo)
+ 508:	b8 19 00 00 00       	mov    $0x19,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <getlathist>:
+SYSCALL(getlathist)
+ 510:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <setpolicy>:
+SYSCALL(setpolicy)
+ 518:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <settickets>:
+SYSCALL(settickets)
+ 520:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <setaffinity>:
+SYSCALL(setaffinity)
+ 528:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <getaffinity>:
+SYSCALL(getaffinity)
+ 530:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <setrt>:
+SYSCALL(setrt)
+ 538:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <clone>:
+SYSCALL(clone)
+ 540:	b8 20 00 00 00       	mov    $0x20,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <join>:
+SYSCALL(join)
+ 548:	b8 21 00 00 00       	mov    $0x21,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <futex_wait>:
+SYSCALL(futex_wait)
+ 550:	b8 22 00 00 00       	mov    $0x22,%eax
+ 555:	cd 40                	int    $0x40
+ 557:	c3                   	ret
+
+00000558 <futex_wake>:
+SYSCALL(futex_wake)
+ 558:	b8 23 00 00 00       	mov    $0x23,%eax
+ 55d:	cd 40                	int    $0x40
+ 55f:	c3                   	ret
+
+00000560 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	57                   	push   %edi
+ 564:	56                   	push   %esi
+ 565:	53                   	push   %ebx
+ 566:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 568:	89 d1                	mov    %edx,%ecx
+{
+ 56a:	83 ec 3c             	sub    $0x3c,%esp
+ 56d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 570:	85 d2                	test   %edx,%edx
+ 572:	0f 89 80 00 00 00    	jns    5f8 <printint+0x98>
+ 578:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 57c:	74 7a                	je     5f8 <printint+0x98>
+    x = -xx;
+ 57e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 580:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 585:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 588:	31 f6                	xor    %esi,%esi
+ 58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 590:	89 c8                	mov    %ecx,%eax
+ 592:	31 d2                	xor    %edx,%edx
+ 594:	89 f7                	mov    %esi,%edi
+ 596:	f7 f3                	div    %ebx
+ 598:	8d 76 01             	lea    0x1(%esi),%esi
+ 59b:	0f b6 92 28 0a 00 00 	movzbl 0xa28(%edx),%edx
+ 5a2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5a6:	89 ca                	mov    %ecx,%edx
+ 5a8:	89 c1                	mov    %eax,%ecx
+ 5aa:	39 da                	cmp    %ebx,%edx
+ 5ac:	73 e2                	jae    590 <printint+0x30>
+  if(neg)
+ 5ae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5b1:	85 c0                	test   %eax,%eax
+ 5b3:	74 07                	je     5bc <printint+0x5c>
+    buf[i++] = '-';
+ 5b5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5ba:	89 f7                	mov    %esi,%edi
+ 5bc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5bf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5c2:	01 df                	add    %ebx,%edi
+ 5c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5c8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5cb:	83 ec 04             	sub    $0x4,%esp
+ 5ce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5d1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5d4:	6a 01                	push   $0x1
+ 5d6:	50                   	push   %eax
+ 5d7:	56                   	push   %esi
+ 5d8:	e8 93 fe ff ff       	call   470 <write>
+  while(--i >= 0)
+ 5dd:	89 f8                	mov    %edi,%eax
+ 5df:	83 c4 10             	add    $0x10,%esp
+ 5e2:	83 ef 01             	sub    $0x1,%edi
+ 5e5:	39 d8                	cmp    %ebx,%eax
+ 5e7:	75 df                	jne    5c8 <printint+0x68>
+}
+ 5e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ec:	5b                   	pop    %ebx
+ 5ed:	5e                   	pop    %esi
+ 5ee:	5f                   	pop    %edi
+ 5ef:	5d                   	pop    %ebp
+ 5f0:	c3                   	ret
+ 5f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5f8:	31 c0                	xor    %eax,%eax
+ 5fa:	eb 89                	jmp    585 <printint+0x25>
+ 5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	56                   	push   %esi
+ 605:	53                   	push   %ebx
+ 606:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 609:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 60c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 60f:	0f b6 1e             	movzbl (%esi),%ebx
+ 612:	83 c6 01             	add    $0x1,%esi
+ 615:	84 db                	test   %bl,%bl
+ 617:	74 67                	je     680 <printf+0x80>
+ 619:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 61c:	31 d2                	xor    %edx,%edx
+ 61e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 621:	eb 34                	jmp    657 <printf+0x57>
+ 623:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 627:	90                   	nop
+ 628:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 62b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 630:	83 f8 25             	cmp    $0x25,%eax
+ 633:	74 18                	je     64d <printf+0x4d>
+  write(fd, &c, 1);
+ 635:	83 ec 04             	sub    $0x4,%esp
+ 638:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 63b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 63e:	6a 01                	push   $0x1
+ 640:	50                   	push   %eax
+ 641:	57                   	push   %edi
+ 642:	e8 29 fe ff ff       	call   470 <write>
+ 647:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 64a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 64d:	0f b6 1e             	movzbl (%esi),%ebx
+ 650:	83 c6 01             	add    $0x1,%esi
+ 653:	84 db                	test   %bl,%bl
+ 655:	74 29                	je     680 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 657:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 65a:	85 d2                	test   %edx,%edx
+ 65c:	74 ca                	je     628 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 65e:	83 fa 25             	cmp    $0x25,%edx
+ 661:	75 ea                	jne    64d <printf+0x4d>
+      if(c == 'd'){
+ 663:	83 f8 25             	cmp    $0x25,%eax
+ 666:	0f 84 24 01 00 00    	je     790 <printf+0x190>
+ 66c:	83 e8 63             	sub    $0x63,%eax
+ 66f:	83 f8 15             	cmp    $0x15,%eax
+ 672:	77 1c                	ja     690 <printf+0x90>
+ 674:	ff 24 85 d0 09 00 00 	jmp    *0x9d0(,%eax,4)
+ 67b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 680:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 683:	5b                   	pop    %ebx
+ 684:	5e                   	pop    %esi
+ 685:	5f                   	pop    %edi
+ 686:	5d                   	pop    %ebp
+ 687:	c3                   	ret
+ 688:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68f:	90                   	nop
+  write(fd, &c, 1);
+ 690:	83 ec 04             	sub    $0x4,%esp
+ 693:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 696:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 69a:	6a 01                	push   $0x1
+ 69c:	52                   	push   %edx
+ 69d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6a0:	57                   	push   %edi
+ 6a1:	e8 ca fd ff ff       	call   470 <write>
+ 6a6:	83 c4 0c             	add    $0xc,%esp
+ 6a9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ac:	6a 01                	push   $0x1
+ 6ae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6b1:	52                   	push   %edx
+ 6b2:	57                   	push   %edi
+ 6b3:	e8 b8 fd ff ff       	call   470 <write>
+        putc(fd, c);
+ 6b8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6bb:	31 d2                	xor    %edx,%edx
+ 6bd:	eb 8e                	jmp    64d <printf+0x4d>
+ 6bf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6c3:	83 ec 0c             	sub    $0xc,%esp
+ 6c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6cb:	8b 13                	mov    (%ebx),%edx
+ 6cd:	6a 00                	push   $0x0
+ 6cf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6d1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6d4:	e8 87 fe ff ff       	call   560 <printint>
+        ap++;
+ 6d9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6dc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6df:	31 d2                	xor    %edx,%edx
+ 6e1:	e9 67 ff ff ff       	jmp    64d <printf+0x4d>
+ 6e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6f0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6f3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6f5:	83 c0 04             	add    $0x4,%eax
+ 6f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6fb:	85 db                	test   %ebx,%ebx
+ 6fd:	0f 84 9d 00 00 00    	je     7a0 <printf+0x1a0>
+        while(*s != 0){
+ 703:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 706:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 708:	84 c0                	test   %al,%al
+ 70a:	0f 84 3d ff ff ff    	je     64d <printf+0x4d>
+ 710:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 713:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 716:	89 de                	mov    %ebx,%esi
+ 718:	89 d3                	mov    %edx,%ebx
+ 71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 720:	83 ec 04             	sub    $0x4,%esp
+ 723:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 726:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 729:	6a 01                	push   $0x1
+ 72b:	53                   	push   %ebx
+ 72c:	57                   	push   %edi
+ 72d:	e8 3e fd ff ff       	call   470 <write>
+        while(*s != 0){
+ 732:	0f b6 06             	movzbl (%esi),%eax
+ 735:	83 c4 10             	add    $0x10,%esp
+ 738:	84 c0                	test   %al,%al
+ 73a:	75 e4                	jne    720 <printf+0x120>
+      state = 0;
+ 73c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 73f:	31 d2                	xor    %edx,%edx
+ 741:	e9 07 ff ff ff       	jmp    64d <printf+0x4d>
+ 746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 750:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 753:	83 ec 0c             	sub    $0xc,%esp
+ 756:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 75b:	8b 13                	mov    (%ebx),%edx
+ 75d:	6a 01                	push   $0x1
+ 75f:	e9 6b ff ff ff       	jmp    6cf <printf+0xcf>
+ 764:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 768:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 76b:	83 ec 04             	sub    $0x4,%esp
+ 76e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 771:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 773:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 776:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 779:	6a 01                	push   $0x1
+ 77b:	52                   	push   %edx
+ 77c:	57                   	push   %edi
+ 77d:	e8 ee fc ff ff       	call   470 <write>
+        ap++;
+ 782:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 785:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 788:	31 d2                	xor    %edx,%edx
+ 78a:	e9 be fe ff ff       	jmp    64d <printf+0x4d>
+ 78f:	90                   	nop
+  write(fd, &c, 1);
+ 790:	83 ec 04             	sub    $0x4,%esp
+ 793:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 796:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 799:	6a 01                	push   $0x1
+ 79b:	e9 11 ff ff ff       	jmp    6b1 <printf+0xb1>
+ 7a0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7a5:	bb c6 09 00 00       	mov    $0x9c6,%ebx
+ 7aa:	e9 61 ff ff ff       	jmp    710 <printf+0x110>
+ 7af:	90                   	nop
+
+000007b0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7b0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7b1:	a1 50 0d 00 00       	mov    0xd50,%eax
+{
+ 7b6:	89 e5                	mov    %esp,%ebp
+ 7b8:	57                   	push   %edi
+ 7b9:	56                   	push   %esi
+ 7ba:	53                   	push   %ebx
+ 7bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7be:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7c8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7ca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7cc:	39 ca                	cmp    %ecx,%edx
+ 7ce:	73 30                	jae    800 <free+0x50>
+ 7d0:	39 c1                	cmp    %eax,%ecx
+ 7d2:	72 04                	jb     7d8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7d4:	39 c2                	cmp    %eax,%edx
+ 7d6:	72 f0                	jb     7c8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7d8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7db:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7de:	39 f8                	cmp    %edi,%eax
+ 7e0:	74 2e                	je     810 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7e2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7e5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7e8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7eb:	39 f1                	cmp    %esi,%ecx
+ 7ed:	74 38                	je     827 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7ef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7f1:	5b                   	pop    %ebx
+  freep = p;
+ 7f2:	89 15 50 0d 00 00    	mov    %edx,0xd50
+}
+ 7f8:	5e                   	pop    %esi
+ 7f9:	5f                   	pop    %edi
+ 7fa:	5d                   	pop    %ebp
+ 7fb:	c3                   	ret
+ 7fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 800:	39 c1                	cmp    %eax,%ecx
+ 802:	72 d0                	jb     7d4 <free+0x24>
+ 804:	eb c2                	jmp    7c8 <free+0x18>
+ 806:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 810:	03 70 04             	add    0x4(%eax),%esi
+ 813:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 816:	8b 02                	mov    (%edx),%eax
+ 818:	8b 00                	mov    (%eax),%eax
+ 81a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 81d:	8b 42 04             	mov    0x4(%edx),%eax
+ 820:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 823:	39 f1                	cmp    %esi,%ecx
+ 825:	75 c8                	jne    7ef <free+0x3f>
+    p->s.size += bp->s.size;
+ 827:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 82a:	89 15 50 0d 00 00    	mov    %edx,0xd50
+    p->s.size += bp->s.size;
+ 830:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 833:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 836:	89 0a                	mov    %ecx,(%edx)
+}
+ 838:	5b                   	pop    %ebx
+ 839:	5e                   	pop    %esi
+ 83a:	5f                   	pop    %edi
+ 83b:	5d                   	pop    %ebp
+ 83c:	c3                   	ret
+ 83d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000840 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	57                   	push   %edi
+ 844:	56                   	push   %esi
+ 845:	53                   	push   %ebx
+ 846:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 849:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 84c:	8b 15 50 0d 00 00    	mov    0xd50,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 852:	8d 78 07             	lea    0x7(%eax),%edi
+ 855:	c1 ef 03             	shr    $0x3,%edi
+ 858:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 85b:	85 d2                	test   %edx,%edx
+ 85d:	0f 84 8d 00 00 00    	je     8f0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 863:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 865:	8b 48 04             	mov    0x4(%eax),%ecx
+ 868:	39 f9                	cmp    %edi,%ecx
+ 86a:	73 64                	jae    8d0 <malloc+0x90>
+  if(nu < 4096)
+ 86c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 871:	39 df                	cmp    %ebx,%edi
+ 873:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 876:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 87d:	eb 0a                	jmp    889 <malloc+0x49>
+ 87f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 880:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 882:	8b 48 04             	mov    0x4(%eax),%ecx
+ 885:	39 f9                	cmp    %edi,%ecx
+ 887:	73 47                	jae    8d0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 889:	89 c2                	mov    %eax,%edx
+ 88b:	39 05 50 0d 00 00    	cmp    %eax,0xd50
+ 891:	75 ed                	jne    880 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 893:	83 ec 0c             	sub    $0xc,%esp
+ 896:	56                   	push   %esi
+ 897:	e8 3c fc ff ff       	call   4d8 <sbrk>
+  if(p == (char*)-1)
+ 89c:	83 c4 10             	add    $0x10,%esp
+ 89f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8a2:	74 1c                	je     8c0 <malloc+0x80>
+  hp->s.size = nu;
+ 8a4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8a7:	83 ec 0c             	sub    $0xc,%esp
+ 8aa:	83 c0 08             	add    $0x8,%eax
+ 8ad:	50                   	push   %eax
+ 8ae:	e8 fd fe ff ff       	call   7b0 <free>
+  return freep;
+ 8b3:	8b 15 50 0d 00 00    	mov    0xd50,%edx
+      if((p = morecore(nunits)) == 0)
+ 8b9:	83 c4 10             	add    $0x10,%esp
+ 8bc:	85 d2                	test   %edx,%edx
+ 8be:	75 c0                	jne    880 <malloc+0x40>
+        return 0;
+  }
+}
+ 8c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8c3:	31 c0                	xor    %eax,%eax
+}
+ 8c5:	5b                   	pop    %ebx
+ 8c6:	5e                   	pop    %esi
+ 8c7:	5f                   	pop    %edi
+ 8c8:	5d                   	pop    %ebp
+ 8c9:	c3                   	ret
+ 8ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8d0:	39 cf                	cmp    %ecx,%edi
+ 8d2:	74 4c                	je     920 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8d4:	29 f9                	sub    %edi,%ecx
+ 8d6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8d9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8dc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8df:	89 15 50 0d 00 00    	mov    %edx,0xd50
+}
+ 8e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8e8:	83 c0 08             	add    $0x8,%eax
+}
+ 8eb:	5b                   	pop    %ebx
+ 8ec:	5e                   	pop    %esi
+ 8ed:	5f                   	pop    %edi
+ 8ee:	5d                   	pop    %ebp
+ 8ef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8f0:	c7 05 50 0d 00 00 54 	movl   $0xd54,0xd50
+ 8f7:	0d 00 00 
+    base.s.size = 0;
+ 8fa:	b8 54 0d 00 00       	mov    $0xd54,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8ff:	c7 05 54 0d 00 00 54 	movl   $0xd54,0xd54
+ 906:	0d 00 00 
+    base.s.size = 0;
+ 909:	c7 05 58 0d 00 00 00 	movl   $0x0,0xd58
+ 910:	00 00 00 
+    if(p->s.size >= nunits){
+ 913:	e9 54 ff ff ff       	jmp    86c <malloc+0x2c>
+ 918:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 920:	8b 08                	mov    (%eax),%ecx
+ 922:	89 0a                	mov    %ecx,(%edx)
+ 924:	eb b9                	jmp    8df <malloc+0x9f>
@@ -0,0 +1,65 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+// Pin processes to CPUs.  Masks are hex, bit i = cpu i.
+// Usage:
+//   taskset <mask> <cmd> [args...]   -> run cmd restricted to mask
+//   taskset -p <pid>                 -> print pid's mask
+//   taskset -p <pid> <mask>          -> change pid's mask
+// Example: keep cpu_loop off cpu 1 on a 2-CPU machine:
+//   taskset 1 cpu_loop &
+
+static uint
+hextoi(char *s)
+{
+  uint n = 0;
+
+  if(s[0] == '0' && s[1] == 'x')
+    s += 2;
+  for(; *s; s++){
+    if(*s >= '0' && *s <= '9')
+      n = n*16 + *s - '0';
+    else if(*s >= 'a' && *s <= 'f')
+      n = n*16 + *s - 'a' + 10;
+    else if(*s >= 'A' && *s <= 'F')
+      n = n*16 + *s - 'A' + 10;
+    else
+      break;
+  }
+  return n;
+}
+
+static void
+usage(void)
+{
+  printf(2, "Usage: taskset mask cmd [args...] | taskset -p pid [mask]\n");
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int pid;
+
+  if(argc < 3)
+    usage();
+
+  if(strcmp(argv[1], "-p") == 0){
+    pid = atoi(argv[2]);
+    if(argc > 3 && setaffinity(pid, hextoi(argv[3])) < 0){
+      printf(2, "taskset: cannot set mask of %d\n", pid);
+      exit();
+    }
+    printf(1, "pid %d mask %x\n", pid, getaffinity(pid));
+    exit();
+  }
+
+  if(setaffinity(0, hextoi(argv[1])) < 0){
+    printf(2, "taskset: bad mask %s\n", argv[1]);
+    exit();
+  }
+  exec(argv[2], argv + 2);
+  printf(2, "taskset: exec %s failed\n", argv[2]);
+  exit();
+}
@@ -0,0 +1,113 @@
+// Timer wheel for sleep deadlines.
+//
+// A process in timersleep() is linked into slot deadline % NWHEEL of
+// the wheel.  Each tick the timer interrupt calls timertick(), which
+// looks at one slot and wakes only the processes whose deadline has
+// passed; entries more than NWHEEL ticks out stay put and are seen
+// again one revolution later.  Deadlines are absolute tick counts, so
+// finer-grained sleeps only need a finer clock feeding timertick().
+//
+// The wheel is protected by tickslock.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+
+#define NWHEEL 64
+
+static struct proc *wheel[NWHEEL];
+
+// Has deadline d been reached at tick t?  Safe across wraparound.
+static int
+expired(uint d, uint t)
+{
+  return (int)(t - d) >= 0;
+}
+
+static void
+wheel_insert(struct proc *p)
+{
+  struct proc **slot = &wheel[p->deadline % NWHEEL];
+
+  p->tmprev = 0;
+  p->tmnext = *slot;
+  if(*slot)
+    (*slot)->tmprev = p;
+  *slot = p;
+  p->tmlinked = 1;
+}
+
+static void
+wheel_remove(struct proc *p)
+{
+  if(p->tmprev)
+    p->tmprev->tmnext = p->tmnext;
+  else
+    wheel[p->deadline % NWHEEL] = p->tmnext;
+  if(p->tmnext)
+    p->tmnext->tmprev = p->tmprev;
+  p->tmnext = p->tmprev = 0;
+  p->tmlinked = 0;
+}
+
+// Sleep until n ticks have passed.  Returns -1 if killed first.
+int
+timersleep(uint n)
+{
+  struct proc *p = myproc();
+  uint ticks0;
+
+  acquire(&tickslock);
+  ticks0 = ticks;
+  while(ticks - ticks0 < n){
+    if(p->killed){
+      release(&tickslock);
+      return -1;
+    }
+    p->deadline = ticks0 + n;
+    wheel_insert(p);
+    sleep(&p->deadline, &tickslock);
+    if(p->tmlinked)      // woken early, e.g. by kill()
+      wheel_remove(p);
+  }
+  release(&tickslock);
+  return 0;
+}
+
+// Called with tickslock held right after ticks advanced: wake the
+// sleepers due now.
+void
+timertick(void)
+{
+  struct proc *p, *next;
+
+  if(!holding(&tickslock))
+    panic("timertick");
+  for(p = wheel[ticks % NWHEEL]; p; p = next){
+    next = p->tmnext;
+    if(expired(p->deadline, ticks)){
+      wheel_remove(p);
+      wakeup(&p->deadline);
+    }
+  }
+}
+
+// Earliest pending deadline, or ticks + NWHEEL if there is none that
+// close.  Caller holds tickslock.
+uint
+timernext(void)
+{
+  struct proc *p;
+  uint t;
+
+  for(t = ticks + 1; t != ticks + NWHEEL; t++)
+    for(p = wheel[t % NWHEEL]; p; p = p->tmnext)
+      if(expired(p->deadline, t))
+        return t;
+  return ticks + NWHEEL;
+}
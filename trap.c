@@ -7,16 +7,11 @@
 #include "x86.h"
 #include "traps.h"
 #include "spinlock.h"
+#include "sched.h"
 
 // ===== MLFQ tuning =====
-#define BOOST_TICKS 100   // mỗi 100 ticks boost 1 lần (đổi 50/200 tuỳ bạn)
-
-static inline int
-quantum_for_level(int lvl)
-{
-  // level 0: 1 tick, level 1: 2 ticks, level 2: 4 ticks, ...
-  return 1 << lvl;
-}
+// Quanta and the aging threshold live in schedparams (mlfq.c) and can
+// be changed at runtime with setschedparams().
 
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
@@ -42,6 +37,171 @@ idtinit(void)
   lidt(idt, sizeof(idt));
 }
 
+// ===== Dynamic ticks =====
+// With schedparams.tickless set, CPUs stop taking an interrupt on
+// every tick.  An AP arms a one-shot for the end of the running
+// process's slice and stops its timer while idle (the reschedule IPI
+// wakes it).  CPU0 keeps the clock: it ticks periodically while any
+// CPU runs a process, and when the whole machine is idle it sleeps
+// until the next sleeper deadline, then catches ticks up
+// from the LAPIC counter.  Nothing else bounds that sleep: sched_age()
+// runs on each CPU's own ticks, and it is paused while the machine is
+// idle.  That is harmless because a CPU only halts with its own run
+// queue empty, so there is nothing to promote.
+#define NOHZ_MAXTICKS 100   // longest one-shot; TICR is 32 bits
+
+enum { TM_PERIODIC, TM_ONESHOT, TM_STOPPED, TM_IDLE, TM_ALIGN };
+
+// Advance the clock by one tick.  CPU0 only.
+static void
+clocktick(void)
+{
+  acquire(&tickslock);
+  ticks++;
+  timertick();    // wake only sleepers whose deadline has passed
+  release(&tickslock);
+}
+
+// Program c's timer before it switches to p.  Interrupts are off.
+void
+timerarm(struct cpu *c, struct proc *p)
+{
+  uint n;
+
+  if(!schedparams.tickless || c == &cpus[0]){
+    if(c->tmode != TM_PERIODIC && c->tmode != TM_ALIGN){
+      lapicperiodic();
+      c->tmode = TM_PERIODIC;
+    }
+    return;
+  }
+
+  n = sched_slice(p);
+  if(n > NOHZ_MAXTICKS)
+    n = NOHZ_MAXTICKS;
+  c->tslice = n;
+  c->tmode = TM_ONESHOT;
+  lapiconeshot(n * TICKCOUNT);
+
+  // Someone is running again: get the clock off its long sleep.
+  // Pairs with the fence in timeridle().
+  __sync_synchronize();
+  if(cpus[0].tmode == TM_IDLE)
+    lapicsendipi(cpus[0].apicid, T_IRQ0 + IRQ_RESCHED);
+}
+
+// CPU0 decided not to sleep after all: go back to mode old, which
+// timerwake() may have left as TM_ALIGN with a short one-shot armed.
+// From any mode but that or TM_PERIODIC, restart the periodic tick.
+static void
+timerkeep(struct cpu *c, int old)
+{
+  if(old == TM_ALIGN || old == TM_PERIODIC){
+    c->tmode = old;
+    return;
+  }
+  lapicperiodic();
+  c->tmode = TM_PERIODIC;
+}
+
+// c is about to halt with nothing to run.  Interrupts are off.
+void
+timeridle(struct cpu *c)
+{
+  uint n, next;
+  int i, old;
+
+  if(!schedparams.tickless)
+    return;
+  if(c != &cpus[0]){
+    lapiconeshot(0);
+    c->tmode = TM_IDLE;
+    return;
+  }
+
+  // Publish TM_IDLE before looking at the other CPUs, so one that
+  // starts a process after the look sees it and kicks us.
+  old = c->tmode;
+  c->tmode = TM_IDLE;
+  __sync_synchronize();
+  for(i = 1; i < ncpu; i++)
+    if(cpus[i].proc){
+      timerkeep(c, old);
+      return;
+    }
+
+  acquire(&tickslock);
+  next = timernext();
+  release(&tickslock);
+  n = next - ticks;
+  if(n > NOHZ_MAXTICKS)
+    n = NOHZ_MAXTICKS;
+  if(n <= 1){
+    timerkeep(c, old);
+    return;
+  }
+  c->tslice = n;
+  lapiconeshot(n * TICKCOUNT);
+}
+
+// c came out of hlt.  CPU0 credits the ticks it slept through and
+// lines the next tick up with the old period.
+void
+timerwake(struct cpu *c)
+{
+  uint e, k;
+
+  pushcli();
+  if(c->tmode != TM_IDLE){
+    popcli();
+    return;
+  }
+  if(c != &cpus[0]){
+    c->tmode = TM_STOPPED;   // timerarm() restarts it
+    popcli();
+    return;
+  }
+
+  e = lapicelapsed();
+  if(e >= c->tslice * TICKCOUNT){
+    lapicperiodic();
+    c->tmode = TM_PERIODIC;
+    k = c->tslice;
+  } else {
+    lapiconeshot(TICKCOUNT - e % TICKCOUNT);
+    c->tmode = TM_ALIGN;
+    k = e / TICKCOUNT;
+  }
+  while(k-- > 0)
+    clocktick();
+  popcli();
+}
+
+// Timer bookkeeping on c.  Returns the ticks to charge to the
+// running process.
+static int
+timerintr(struct cpu *c)
+{
+  int n = 1;
+
+  switch(c->tmode){
+  case TM_IDLE:       // CPU0's long one-shot ran out; timerwake() counts it
+  case TM_STOPPED:
+    return 0;
+  case TM_ALIGN:
+    lapicperiodic();
+    c->tmode = TM_PERIODIC;
+    break;
+  case TM_ONESHOT:
+    c->tmode = TM_STOPPED;
+    n = c->tslice;
+    break;
+  }
+  if(c == &cpus[0])
+    clocktick();
+  return n;
+}
+
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf)
@@ -58,37 +218,49 @@ trap(struct trapframe *tf)
 
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER: {
-    // update global ticks on CPU0
-    if(cpuid() == 0){
-      acquire(&tickslock);
-      ticks++;
-      wakeup(&ticks);
-      release(&tickslock);
-
-      // periodic priority boost (chống starvation)
-      if((ticks % BOOST_TICKS) == 0){
-        mlfq_boost_all();  // <-- hàm này bạn thêm trong proc.c
-      }
-    }
+    // update global ticks on CPU0 (see timerintr)
+    struct cpu *c = mycpu();
+    int n = timerintr(c);
+    int ticked = n > 0;
 
-    // ===== MLFQ accounting theo timer tick =====
+    // ===== Per-tick accounting; the policy decides whether to preempt =====
+    // A one-shot on an AP stands for a whole slice of ticks.
     struct proc *p = myproc();
-    if(p && p->state == RUNNING){
-      p->ticks++;
-
-      // hết quantum -> demote + yield
-      if(p->ticks >= quantum_for_level(p->priority)){
-        p->ticks = 0;
-        if(p->priority < NQUEUE - 1)
-          p->priority++;
+    int preempt = 0;
+    if(p && p->state == RUNNING)
+      while(n-- > 0 && !(preempt = sched_tick(p)))
+        ;
+    if(p && !preempt && c->tmode == TM_STOPPED)
+      timerarm(c, p);
+    if(ticked)
+      sched_age();   // this CPU's queue only
+
+    // EOI before yield: the LAPIC holds back further timer interrupts
+    // on this CPU until it sees one.
+    lapiceoi();
+    if(preempt){
+      if(p->rtperiod && p->rtleft == 0)
+        edf_throttle();   // budget gone until its next release
+      else
         yield();
-      }
     }
+    break;
+  }
 
+  case T_IRQ0 + IRQ_RESCHED: {
+    // Pulls a halted CPU out of hlt (scheduler() rechecks), or tells a
+    // busy one that a real-time process with an earlier deadline is
+    // queued here (see kick_cpu).
+    struct proc *p = myproc();
     lapiceoi();
+    if(p && p->state == RUNNING && edf_preempts(mycpu(), p))
+      yield();
     break;
   }
-
+  case T_IRQ0 + IRQ_TLB:
+    tlbflushintr();
+    lapiceoi();
+    break;
   case T_IRQ0 + IRQ_IDE:
     ideintr();
     lapiceoi();
@@ -110,6 +282,13 @@ trap(struct trapframe *tf)
             cpuid(), tf->cs, tf->eip);
     lapiceoi();
     break;
+  case T_PGFLT:
+    // A write to a copy-on-write page, from user space or from the
+    // kernel writing user memory.  Anything else, or running out of
+    // memory for the copy, is handled like other faults below.
+    if((tf->err & FEC_WR) && cowfault(rcr2()))
+      break;
+    // fall through
 
   //PAGEBREAK: 13
   default:
@@ -34,5 +34,7 @@
 #define IRQ_COM1         4
 #define IRQ_IDE         14
 #define IRQ_ERROR       19
+#define IRQ_RESCHED     24      // reschedule IPI (above any IOAPIC input)
+#define IRQ_TLB         25      // TLB shootdown IPI, see vm_shootdown()
 #define IRQ_SPURIOUS    31
 
@@ -104,3 +104,28 @@ memmove(void *vdst, const void *vsrc, int n)
     *dst++ = *src++;
   return vdst;
 }
+
+// Take and release m with atomic instructions, and enter the kernel
+// only to block while it is held or to wake a blocked thread.
+void
+mutex_lock(struct mutex *m)
+{
+  uint s;
+
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    return;
+  // Contended: mark it so the holder knows to wake us.
+  if(s != 2)
+    s = xchg(&m->state, 2);
+  while(s != 0){
+    futex_wait(&m->state, 2);
+    s = xchg(&m->state, 2);
+  }
+}
+
+void
+mutex_unlock(struct mutex *m)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake(&m->state, 1);
+}
@@ -1,5 +1,8 @@
 struct stat;
 struct rtcdate;
+struct schedparams;
+struct pinfo;
+struct lathist;
 
 // system calls
 int fork(void);
@@ -24,6 +27,19 @@ char* sbrk(int);
 int sleep(int);
 int uptime(void);
 int ps(void);
+int getschedparams(struct schedparams*);
+int setschedparams(struct schedparams*);
+int getpinfo(struct pinfo*, int);
+int getlathist(struct lathist*, int);
+int setpolicy(int);
+int settickets(int);
+int setaffinity(int, uint);
+uint getaffinity(int);
+int setrt(int, int, int);
+int clone(void(*)(void*, void*), void*, void*, void*);
+int join(void**);
+int futex_wait(volatile uint*, uint);
+int futex_wake(volatile uint*, int);
 
 
 // ulib.c
@@ -39,3 +55,11 @@ void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+
+// A lock for threads sharing memory: 0 free, 1 held, 2 held with
+// waiters.  Initialize to 0.
+struct mutex {
+  volatile uint state;
+};
+void mutex_lock(struct mutex*);
+void mutex_unlock(struct mutex*);
@@ -0,0 +1,7216 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 6c 53 00 00       	push   $0x536c
+      16:	6a 01                	push   $0x1
+      18:	e8 93 3f 00 00       	call   3fb0 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 80 53 00 00       	push   $0x5380
+      26:	e8 15 3e 00 00       	call   3e40 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 f4 5b 00 00       	push   $0x5bf4
+      39:	6a 01                	push   $0x1
+      3b:	e8 70 3f 00 00       	call   3fb0 <printf>
+    exit();
+      40:	e8 bb 3d 00 00       	call   3e00 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 80 53 00 00       	push   $0x5380
+      51:	e8 ea 3d 00 00       	call   3e40 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 ca 3d 00 00       	call   3e28 <close>
+
+  argptest();
+      5e:	e8 4d 3a 00 00       	call   3ab0 <argptest>
+  createdelete();
+      63:	e8 58 12 00 00       	call   12c0 <createdelete>
+  linkunlink();
+      68:	e8 f3 1a 00 00       	call   1b60 <linkunlink>
+  concreate();
+      6d:	e8 ee 17 00 00       	call   1860 <concreate>
+  fourfiles();
+      72:	e8 49 10 00 00       	call   10c0 <fourfiles>
+  sharedfd();
+      77:	e8 84 0e 00 00       	call   f00 <sharedfd>
+
+  bigargtest();
+      7c:	e8 ef 36 00 00       	call   3770 <bigargtest>
+  bigwrite();
+      81:	e8 fa 23 00 00       	call   2480 <bigwrite>
+  bigargtest();
+      86:	e8 e5 36 00 00       	call   3770 <bigargtest>
+  bsstest();
+      8b:	e8 70 36 00 00       	call   3700 <bsstest>
+  sbrktest();
+      90:	e8 6b 31 00 00       	call   3200 <sbrktest>
+  validatetest();
+      95:	e8 b6 35 00 00       	call   3650 <validatetest>
+
+  opentest();
+      9a:	e8 f1 03 00 00       	call   490 <opentest>
+  writetest();
+      9f:	e8 7c 04 00 00       	call   520 <writetest>
+  writetest1();
+      a4:	e8 57 06 00 00       	call   700 <writetest1>
+  createtest();
+      a9:	e8 22 08 00 00       	call   8d0 <createtest>
+
+  openiputtest();
+      ae:	e8 dd 02 00 00       	call   390 <openiputtest>
+  exitiputtest();
+      b3:	e8 d8 01 00 00       	call   290 <exitiputtest>
+  iputtest();
+      b8:	e8 f3 00 00 00       	call   1b0 <iputtest>
+
+  mem();
+      bd:	e8 6e 0d 00 00       	call   e30 <mem>
+  pipe1();
+      c2:	e8 e9 09 00 00       	call   ab0 <pipe1>
+  preempt();
+      c7:	e8 84 0b 00 00       	call   c50 <preempt>
+  exitwait();
+      cc:	e8 df 0c 00 00       	call   db0 <exitwait>
+
+  rmdot();
+      d1:	e8 9a 27 00 00       	call   2870 <rmdot>
+  fourteen();
+      d6:	e8 55 26 00 00       	call   2730 <fourteen>
+  bigfile();
+      db:	e8 80 24 00 00       	call   2560 <bigfile>
+  subdir();
+      e0:	e8 bb 1c 00 00       	call   1da0 <subdir>
+  linktest();
+      e5:	e8 66 15 00 00       	call   1650 <linktest>
+  unlinkread();
+      ea:	e8 d1 13 00 00       	call   14c0 <unlinkread>
+  dirfile();
+      ef:	e8 fc 28 00 00       	call   29f0 <dirfile>
+  iref();
+      f4:	e8 f7 2a 00 00       	call   2bf0 <iref>
+  forktest();
+      f9:	e8 12 2c 00 00       	call   2d10 <forktest>
+  clonetest();
+      fe:	e8 bd 2c 00 00       	call   2dc0 <clonetest>
+  clonesbrktest();
+     103:	e8 18 2e 00 00       	call   2f20 <clonesbrktest>
+  futextest();
+     108:	e8 a3 2f 00 00       	call   30b0 <futextest>
+  bigdir(); // slow
+     10d:	e8 5e 1b 00 00       	call   1c70 <bigdir>
+
+  uio();
+     112:	e8 29 39 00 00       	call   3a40 <uio>
+
+  exectest();
+     117:	e8 44 09 00 00       	call   a60 <exectest>
+
+  exit();
+     11c:	e8 df 3c 00 00       	call   3e00 <exit>
+     121:	66 90                	xchg   %ax,%ax
+     123:	66 90                	xchg   %ax,%ax
+     125:	66 90                	xchg   %ax,%ax
+     127:	66 90                	xchg   %ax,%ax
+     129:	66 90                	xchg   %ax,%ax
+     12b:	66 90                	xchg   %ax,%ax
+     12d:	66 90                	xchg   %ax,%ax
+     12f:	90                   	nop
+
+00000130 <threadadd>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	83 ec 08             	sub    $0x8,%esp
+  threadval += (int)arg1 + (int)arg2;
+     136:	8b 15 6c ae 00 00    	mov    0xae6c,%edx
+     13c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     13f:	03 45 08             	add    0x8(%ebp),%eax
+     142:	01 d0                	add    %edx,%eax
+     144:	a3 6c ae 00 00       	mov    %eax,0xae6c
+  exit();
+     149:	e8 b2 3c 00 00       	call   3e00 <exit>
+     14e:	66 90                	xchg   %ax,%ax
+
+00000150 <threadread>:
+{
+     150:	55                   	push   %ebp
+     151:	89 e5                	mov    %esp,%ebp
+     153:	83 ec 1c             	sub    $0x1c,%esp
+  read(sbrkfds[0], &c, 1);
+     156:	8d 45 f7             	lea    -0x9(%ebp),%eax
+     159:	6a 01                	push   $0x1
+     15b:	50                   	push   %eax
+     15c:	ff 35 64 ae 00 00    	push   0xae64
+     162:	e8 b1 3c 00 00       	call   3e18 <read>
+  exit();
+     167:	e8 94 3c 00 00       	call   3e00 <exit>
+     16c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000170 <futexwaiter>:
+{
+     170:	55                   	push   %ebp
+     171:	89 e5                	mov    %esp,%ebp
+     173:	83 ec 08             	sub    $0x8,%esp
+  while(futexword == 0)
+     176:	a1 60 ae 00 00       	mov    0xae60,%eax
+     17b:	85 c0                	test   %eax,%eax
+     17d:	75 1c                	jne    19b <futexwaiter+0x2b>
+     17f:	90                   	nop
+    futex_wait(&futexword, 0);
+     180:	83 ec 08             	sub    $0x8,%esp
+     183:	6a 00                	push   $0x0
+     185:	68 60 ae 00 00       	push   $0xae60
+     18a:	e8 71 3d 00 00       	call   3f00 <futex_wait>
+  while(futexword == 0)
+     18f:	a1 60 ae 00 00       	mov    0xae60,%eax
+     194:	83 c4 10             	add    $0x10,%esp
+     197:	85 c0                	test   %eax,%eax
+     199:	74 e5                	je     180 <futexwaiter+0x10>
+  futexword = 2;
+     19b:	c7 05 60 ae 00 00 02 	movl   $0x2,0xae60
+     1a2:	00 00 00 
+  exit();
+     1a5:	e8 56 3c 00 00       	call   3e00 <exit>
+     1aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000001b0 <iputtest>:
+{
+     1b0:	55                   	push   %ebp
+     1b1:	89 e5                	mov    %esp,%ebp
+     1b3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     1b6:	68 6c 43 00 00       	push   $0x436c
+     1bb:	ff 35 90 66 00 00    	push   0x6690
+     1c1:	e8 ea 3d 00 00       	call   3fb0 <printf>
+  if(mkdir("iputdir") < 0){
+     1c6:	c7 04 24 ff 42 00 00 	movl   $0x42ff,(%esp)
+     1cd:	e8 96 3c 00 00       	call   3e68 <mkdir>
+     1d2:	83 c4 10             	add    $0x10,%esp
+     1d5:	85 c0                	test   %eax,%eax
+     1d7:	78 58                	js     231 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     1d9:	83 ec 0c             	sub    $0xc,%esp
+     1dc:	68 ff 42 00 00       	push   $0x42ff
+     1e1:	e8 8a 3c 00 00       	call   3e70 <chdir>
+     1e6:	83 c4 10             	add    $0x10,%esp
+     1e9:	85 c0                	test   %eax,%eax
+     1eb:	0f 88 85 00 00 00    	js     276 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     1f1:	83 ec 0c             	sub    $0xc,%esp
+     1f4:	68 fc 42 00 00       	push   $0x42fc
+     1f9:	e8 52 3c 00 00       	call   3e50 <unlink>
+     1fe:	83 c4 10             	add    $0x10,%esp
+     201:	85 c0                	test   %eax,%eax
+     203:	78 5a                	js     25f <iputtest+0xaf>
+  if(chdir("/") < 0){
+     205:	83 ec 0c             	sub    $0xc,%esp
+     208:	68 21 43 00 00       	push   $0x4321
+     20d:	e8 5e 3c 00 00       	call   3e70 <chdir>
+     212:	83 c4 10             	add    $0x10,%esp
+     215:	85 c0                	test   %eax,%eax
+     217:	78 2f                	js     248 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     219:	83 ec 08             	sub    $0x8,%esp
+     21c:	68 a4 43 00 00       	push   $0x43a4
+     221:	ff 35 90 66 00 00    	push   0x6690
+     227:	e8 84 3d 00 00       	call   3fb0 <printf>
+}
+     22c:	83 c4 10             	add    $0x10,%esp
+     22f:	c9                   	leave
+     230:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     231:	50                   	push   %eax
+     232:	50                   	push   %eax
+     233:	68 d8 42 00 00       	push   $0x42d8
+     238:	ff 35 90 66 00 00    	push   0x6690
+     23e:	e8 6d 3d 00 00       	call   3fb0 <printf>
+    exit();
+     243:	e8 b8 3b 00 00       	call   3e00 <exit>
+    printf(stdout, "chdir / failed\n");
+     248:	50                   	push   %eax
+     249:	50                   	push   %eax
+     24a:	68 23 43 00 00       	push   $0x4323
+     24f:	ff 35 90 66 00 00    	push   0x6690
+     255:	e8 56 3d 00 00       	call   3fb0 <printf>
+    exit();
+     25a:	e8 a1 3b 00 00       	call   3e00 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     25f:	52                   	push   %edx
+     260:	52                   	push   %edx
+     261:	68 07 43 00 00       	push   $0x4307
+     266:	ff 35 90 66 00 00    	push   0x6690
+     26c:	e8 3f 3d 00 00       	call   3fb0 <printf>
+    exit();
+     271:	e8 8a 3b 00 00       	call   3e00 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     276:	51                   	push   %ecx
+     277:	51                   	push   %ecx
+     278:	68 e6 42 00 00       	push   $0x42e6
+     27d:	ff 35 90 66 00 00    	push   0x6690
+     283:	e8 28 3d 00 00       	call   3fb0 <printf>
+    exit();
+     288:	e8 73 3b 00 00       	call   3e00 <exit>
+     28d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000290 <exitiputtest>:
+{
+     290:	55                   	push   %ebp
+     291:	89 e5                	mov    %esp,%ebp
+     293:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     296:	68 33 43 00 00       	push   $0x4333
+     29b:	ff 35 90 66 00 00    	push   0x6690
+     2a1:	e8 0a 3d 00 00       	call   3fb0 <printf>
+  pid = fork();
+     2a6:	e8 4d 3b 00 00       	call   3df8 <fork>
+  if(pid < 0){
+     2ab:	83 c4 10             	add    $0x10,%esp
+     2ae:	85 c0                	test   %eax,%eax
+     2b0:	0f 88 8a 00 00 00    	js     340 <exitiputtest+0xb0>
+  if(pid == 0){
+     2b6:	75 50                	jne    308 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     2b8:	83 ec 0c             	sub    $0xc,%esp
+     2bb:	68 ff 42 00 00       	push   $0x42ff
+     2c0:	e8 a3 3b 00 00       	call   3e68 <mkdir>
+     2c5:	83 c4 10             	add    $0x10,%esp
+     2c8:	85 c0                	test   %eax,%eax
+     2ca:	0f 88 87 00 00 00    	js     357 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     2d0:	83 ec 0c             	sub    $0xc,%esp
+     2d3:	68 ff 42 00 00       	push   $0x42ff
+     2d8:	e8 93 3b 00 00       	call   3e70 <chdir>
+     2dd:	83 c4 10             	add    $0x10,%esp
+     2e0:	85 c0                	test   %eax,%eax
+     2e2:	0f 88 86 00 00 00    	js     36e <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     2e8:	83 ec 0c             	sub    $0xc,%esp
+     2eb:	68 fc 42 00 00       	push   $0x42fc
+     2f0:	e8 5b 3b 00 00       	call   3e50 <unlink>
+     2f5:	83 c4 10             	add    $0x10,%esp
+     2f8:	85 c0                	test   %eax,%eax
+     2fa:	78 2c                	js     328 <exitiputtest+0x98>
+    exit();
+     2fc:	e8 ff 3a 00 00       	call   3e00 <exit>
+     301:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     308:	e8 fb 3a 00 00       	call   3e08 <wait>
+  printf(stdout, "exitiput test ok\n");
+     30d:	83 ec 08             	sub    $0x8,%esp
+     310:	68 56 43 00 00       	push   $0x4356
+     315:	ff 35 90 66 00 00    	push   0x6690
+     31b:	e8 90 3c 00 00       	call   3fb0 <printf>
+}
+     320:	83 c4 10             	add    $0x10,%esp
+     323:	c9                   	leave
+     324:	c3                   	ret
+     325:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     328:	83 ec 08             	sub    $0x8,%esp
+     32b:	68 07 43 00 00       	push   $0x4307
+     330:	ff 35 90 66 00 00    	push   0x6690
+     336:	e8 75 3c 00 00       	call   3fb0 <printf>
+      exit();
+     33b:	e8 c0 3a 00 00       	call   3e00 <exit>
+    printf(stdout, "fork failed\n");
+     340:	51                   	push   %ecx
+     341:	51                   	push   %ecx
+     342:	68 bf 52 00 00       	push   $0x52bf
+     347:	ff 35 90 66 00 00    	push   0x6690
+     34d:	e8 5e 3c 00 00       	call   3fb0 <printf>
+    exit();
+     352:	e8 a9 3a 00 00       	call   3e00 <exit>
+      printf(stdout, "mkdir failed\n");
+     357:	52                   	push   %edx
+     358:	52                   	push   %edx
+     359:	68 d8 42 00 00       	push   $0x42d8
+     35e:	ff 35 90 66 00 00    	push   0x6690
+     364:	e8 47 3c 00 00       	call   3fb0 <printf>
+      exit();
+     369:	e8 92 3a 00 00       	call   3e00 <exit>
+      printf(stdout, "child chdir failed\n");
+     36e:	50                   	push   %eax
+     36f:	50                   	push   %eax
+     370:	68 42 43 00 00       	push   $0x4342
+     375:	ff 35 90 66 00 00    	push   0x6690
+     37b:	e8 30 3c 00 00       	call   3fb0 <printf>
+      exit();
+     380:	e8 7b 3a 00 00       	call   3e00 <exit>
+     385:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <openiputtest>:
+{
+     390:	55                   	push   %ebp
+     391:	89 e5                	mov    %esp,%ebp
+     393:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     396:	68 68 43 00 00       	push   $0x4368
+     39b:	ff 35 90 66 00 00    	push   0x6690
+     3a1:	e8 0a 3c 00 00       	call   3fb0 <printf>
+  if(mkdir("oidir") < 0){
+     3a6:	c7 04 24 77 43 00 00 	movl   $0x4377,(%esp)
+     3ad:	e8 b6 3a 00 00       	call   3e68 <mkdir>
+     3b2:	83 c4 10             	add    $0x10,%esp
+     3b5:	85 c0                	test   %eax,%eax
+     3b7:	0f 88 9f 00 00 00    	js     45c <openiputtest+0xcc>
+  pid = fork();
+     3bd:	e8 36 3a 00 00       	call   3df8 <fork>
+  if(pid < 0){
+     3c2:	85 c0                	test   %eax,%eax
+     3c4:	78 7f                	js     445 <openiputtest+0xb5>
+  if(pid == 0){
+     3c6:	75 38                	jne    400 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     3c8:	83 ec 08             	sub    $0x8,%esp
+     3cb:	6a 02                	push   $0x2
+     3cd:	68 77 43 00 00       	push   $0x4377
+     3d2:	e8 69 3a 00 00       	call   3e40 <open>
+    if(fd >= 0){
+     3d7:	83 c4 10             	add    $0x10,%esp
+     3da:	85 c0                	test   %eax,%eax
+     3dc:	78 62                	js     440 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     3de:	83 ec 08             	sub    $0x8,%esp
+     3e1:	68 a0 53 00 00       	push   $0x53a0
+     3e6:	ff 35 90 66 00 00    	push   0x6690
+     3ec:	e8 bf 3b 00 00       	call   3fb0 <printf>
+      exit();
+     3f1:	e8 0a 3a 00 00       	call   3e00 <exit>
+     3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fd:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     400:	83 ec 0c             	sub    $0xc,%esp
+     403:	6a 01                	push   $0x1
+     405:	e8 86 3a 00 00       	call   3e90 <sleep>
+  if(unlink("oidir") != 0){
+     40a:	c7 04 24 77 43 00 00 	movl   $0x4377,(%esp)
+     411:	e8 3a 3a 00 00       	call   3e50 <unlink>
+     416:	83 c4 10             	add    $0x10,%esp
+     419:	85 c0                	test   %eax,%eax
+     41b:	75 56                	jne    473 <openiputtest+0xe3>
+  wait();
+     41d:	e8 e6 39 00 00       	call   3e08 <wait>
+  printf(stdout, "openiput test ok\n");
+     422:	83 ec 08             	sub    $0x8,%esp
+     425:	68 a0 43 00 00       	push   $0x43a0
+     42a:	ff 35 90 66 00 00    	push   0x6690
+     430:	e8 7b 3b 00 00       	call   3fb0 <printf>
+}
+     435:	83 c4 10             	add    $0x10,%esp
+     438:	c9                   	leave
+     439:	c3                   	ret
+     43a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     440:	e8 bb 39 00 00       	call   3e00 <exit>
+    printf(stdout, "fork failed\n");
+     445:	52                   	push   %edx
+     446:	52                   	push   %edx
+     447:	68 bf 52 00 00       	push   $0x52bf
+     44c:	ff 35 90 66 00 00    	push   0x6690
+     452:	e8 59 3b 00 00       	call   3fb0 <printf>
+    exit();
+     457:	e8 a4 39 00 00       	call   3e00 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     45c:	51                   	push   %ecx
+     45d:	51                   	push   %ecx
+     45e:	68 7d 43 00 00       	push   $0x437d
+     463:	ff 35 90 66 00 00    	push   0x6690
+     469:	e8 42 3b 00 00       	call   3fb0 <printf>
+    exit();
+     46e:	e8 8d 39 00 00       	call   3e00 <exit>
+    printf(stdout, "unlink failed\n");
+     473:	50                   	push   %eax
+     474:	50                   	push   %eax
+     475:	68 91 43 00 00       	push   $0x4391
+     47a:	ff 35 90 66 00 00    	push   0x6690
+     480:	e8 2b 3b 00 00       	call   3fb0 <printf>
+    exit();
+     485:	e8 76 39 00 00       	call   3e00 <exit>
+     48a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000490 <opentest>:
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     496:	68 b2 43 00 00       	push   $0x43b2
+     49b:	ff 35 90 66 00 00    	push   0x6690
+     4a1:	e8 0a 3b 00 00       	call   3fb0 <printf>
+  fd = open("echo", 0);
+     4a6:	58                   	pop    %eax
+     4a7:	5a                   	pop    %edx
+     4a8:	6a 00                	push   $0x0
+     4aa:	68 bd 43 00 00       	push   $0x43bd
+     4af:	e8 8c 39 00 00       	call   3e40 <open>
+  if(fd < 0){
+     4b4:	83 c4 10             	add    $0x10,%esp
+     4b7:	85 c0                	test   %eax,%eax
+     4b9:	78 36                	js     4f1 <opentest+0x61>
+  close(fd);
+     4bb:	83 ec 0c             	sub    $0xc,%esp
+     4be:	50                   	push   %eax
+     4bf:	e8 64 39 00 00       	call   3e28 <close>
+  fd = open("doesnotexist", 0);
+     4c4:	5a                   	pop    %edx
+     4c5:	59                   	pop    %ecx
+     4c6:	6a 00                	push   $0x0
+     4c8:	68 d5 43 00 00       	push   $0x43d5
+     4cd:	e8 6e 39 00 00       	call   3e40 <open>
+  if(fd >= 0){
+     4d2:	83 c4 10             	add    $0x10,%esp
+     4d5:	85 c0                	test   %eax,%eax
+     4d7:	79 2f                	jns    508 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     4d9:	83 ec 08             	sub    $0x8,%esp
+     4dc:	68 00 44 00 00       	push   $0x4400
+     4e1:	ff 35 90 66 00 00    	push   0x6690
+     4e7:	e8 c4 3a 00 00       	call   3fb0 <printf>
+}
+     4ec:	83 c4 10             	add    $0x10,%esp
+     4ef:	c9                   	leave
+     4f0:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     4f1:	50                   	push   %eax
+     4f2:	50                   	push   %eax
+     4f3:	68 c2 43 00 00       	push   $0x43c2
+     4f8:	ff 35 90 66 00 00    	push   0x6690
+     4fe:	e8 ad 3a 00 00       	call   3fb0 <printf>
+    exit();
+     503:	e8 f8 38 00 00       	call   3e00 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     508:	50                   	push   %eax
+     509:	50                   	push   %eax
+     50a:	68 e2 43 00 00       	push   $0x43e2
+     50f:	ff 35 90 66 00 00    	push   0x6690
+     515:	e8 96 3a 00 00       	call   3fb0 <printf>
+    exit();
+     51a:	e8 e1 38 00 00       	call   3e00 <exit>
+     51f:	90                   	nop
+
+00000520 <writetest>:
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	56                   	push   %esi
+     524:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     525:	83 ec 08             	sub    $0x8,%esp
+     528:	68 0e 44 00 00       	push   $0x440e
+     52d:	ff 35 90 66 00 00    	push   0x6690
+     533:	e8 78 3a 00 00       	call   3fb0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     538:	58                   	pop    %eax
+     539:	5a                   	pop    %edx
+     53a:	68 02 02 00 00       	push   $0x202
+     53f:	68 1f 44 00 00       	push   $0x441f
+     544:	e8 f7 38 00 00       	call   3e40 <open>
+  if(fd >= 0){
+     549:	83 c4 10             	add    $0x10,%esp
+     54c:	85 c0                	test   %eax,%eax
+     54e:	0f 88 88 01 00 00    	js     6dc <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     554:	83 ec 08             	sub    $0x8,%esp
+     557:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     559:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     55b:	68 25 44 00 00       	push   $0x4425
+     560:	ff 35 90 66 00 00    	push   0x6690
+     566:	e8 45 3a 00 00       	call   3fb0 <printf>
+     56b:	83 c4 10             	add    $0x10,%esp
+     56e:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     570:	83 ec 04             	sub    $0x4,%esp
+     573:	6a 0a                	push   $0xa
+     575:	68 5c 44 00 00       	push   $0x445c
+     57a:	56                   	push   %esi
+     57b:	e8 a0 38 00 00       	call   3e20 <write>
+     580:	83 c4 10             	add    $0x10,%esp
+     583:	83 f8 0a             	cmp    $0xa,%eax
+     586:	0f 85 d9 00 00 00    	jne    665 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     58c:	83 ec 04             	sub    $0x4,%esp
+     58f:	6a 0a                	push   $0xa
+     591:	68 67 44 00 00       	push   $0x4467
+     596:	56                   	push   %esi
+     597:	e8 84 38 00 00       	call   3e20 <write>
+     59c:	83 c4 10             	add    $0x10,%esp
+     59f:	83 f8 0a             	cmp    $0xa,%eax
+     5a2:	0f 85 d6 00 00 00    	jne    67e <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     5a8:	83 c3 01             	add    $0x1,%ebx
+     5ab:	83 fb 64             	cmp    $0x64,%ebx
+     5ae:	75 c0                	jne    570 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     5b0:	83 ec 08             	sub    $0x8,%esp
+     5b3:	68 72 44 00 00       	push   $0x4472
+     5b8:	ff 35 90 66 00 00    	push   0x6690
+     5be:	e8 ed 39 00 00       	call   3fb0 <printf>
+  close(fd);
+     5c3:	89 34 24             	mov    %esi,(%esp)
+     5c6:	e8 5d 38 00 00       	call   3e28 <close>
+  fd = open("small", O_RDONLY);
+     5cb:	5b                   	pop    %ebx
+     5cc:	5e                   	pop    %esi
+     5cd:	6a 00                	push   $0x0
+     5cf:	68 1f 44 00 00       	push   $0x441f
+     5d4:	e8 67 38 00 00       	call   3e40 <open>
+  if(fd >= 0){
+     5d9:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     5dc:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     5de:	85 c0                	test   %eax,%eax
+     5e0:	0f 88 b1 00 00 00    	js     697 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     5e6:	83 ec 08             	sub    $0x8,%esp
+     5e9:	68 7d 44 00 00       	push   $0x447d
+     5ee:	ff 35 90 66 00 00    	push   0x6690
+     5f4:	e8 b7 39 00 00       	call   3fb0 <printf>
+  i = read(fd, buf, 2000);
+     5f9:	83 c4 0c             	add    $0xc,%esp
+     5fc:	68 d0 07 00 00       	push   $0x7d0
+     601:	68 e0 8d 00 00       	push   $0x8de0
+     606:	53                   	push   %ebx
+     607:	e8 0c 38 00 00       	call   3e18 <read>
+  if(i == 2000){
+     60c:	83 c4 10             	add    $0x10,%esp
+     60f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     614:	0f 85 94 00 00 00    	jne    6ae <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     61a:	83 ec 08             	sub    $0x8,%esp
+     61d:	68 b1 44 00 00       	push   $0x44b1
+     622:	ff 35 90 66 00 00    	push   0x6690
+     628:	e8 83 39 00 00       	call   3fb0 <printf>
+  close(fd);
+     62d:	89 1c 24             	mov    %ebx,(%esp)
+     630:	e8 f3 37 00 00       	call   3e28 <close>
+  if(unlink("small") < 0){
+     635:	c7 04 24 1f 44 00 00 	movl   $0x441f,(%esp)
+     63c:	e8 0f 38 00 00       	call   3e50 <unlink>
+     641:	83 c4 10             	add    $0x10,%esp
+     644:	85 c0                	test   %eax,%eax
+     646:	78 7d                	js     6c5 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     648:	83 ec 08             	sub    $0x8,%esp
+     64b:	68 d9 44 00 00       	push   $0x44d9
+     650:	ff 35 90 66 00 00    	push   0x6690
+     656:	e8 55 39 00 00       	call   3fb0 <printf>
+}
+     65b:	83 c4 10             	add    $0x10,%esp
+     65e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     661:	5b                   	pop    %ebx
+     662:	5e                   	pop    %esi
+     663:	5d                   	pop    %ebp
+     664:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     665:	83 ec 04             	sub    $0x4,%esp
+     668:	53                   	push   %ebx
+     669:	68 c4 53 00 00       	push   $0x53c4
+     66e:	ff 35 90 66 00 00    	push   0x6690
+     674:	e8 37 39 00 00       	call   3fb0 <printf>
+      exit();
+     679:	e8 82 37 00 00       	call   3e00 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     67e:	83 ec 04             	sub    $0x4,%esp
+     681:	53                   	push   %ebx
+     682:	68 e8 53 00 00       	push   $0x53e8
+     687:	ff 35 90 66 00 00    	push   0x6690
+     68d:	e8 1e 39 00 00       	call   3fb0 <printf>
+      exit();
+     692:	e8 69 37 00 00       	call   3e00 <exit>
+    printf(stdout, "error: open small failed!\n");
+     697:	51                   	push   %ecx
+     698:	51                   	push   %ecx
+     699:	68 96 44 00 00       	push   $0x4496
+     69e:	ff 35 90 66 00 00    	push   0x6690
+     6a4:	e8 07 39 00 00       	call   3fb0 <printf>
+    exit();
+     6a9:	e8 52 37 00 00       	call   3e00 <exit>
+    printf(stdout, "read failed\n");
+     6ae:	52                   	push   %edx
+     6af:	52                   	push   %edx
+     6b0:	68 dd 47 00 00       	push   $0x47dd
+     6b5:	ff 35 90 66 00 00    	push   0x6690
+     6bb:	e8 f0 38 00 00       	call   3fb0 <printf>
+    exit();
+     6c0:	e8 3b 37 00 00       	call   3e00 <exit>
+    printf(stdout, "unlink small failed\n");
+     6c5:	50                   	push   %eax
+     6c6:	50                   	push   %eax
+     6c7:	68 c4 44 00 00       	push   $0x44c4
+     6cc:	ff 35 90 66 00 00    	push   0x6690
+     6d2:	e8 d9 38 00 00       	call   3fb0 <printf>
+    exit();
+     6d7:	e8 24 37 00 00       	call   3e00 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     6dc:	50                   	push   %eax
+     6dd:	50                   	push   %eax
+     6de:	68 40 44 00 00       	push   $0x4440
+     6e3:	ff 35 90 66 00 00    	push   0x6690
+     6e9:	e8 c2 38 00 00       	call   3fb0 <printf>
+    exit();
+     6ee:	e8 0d 37 00 00       	call   3e00 <exit>
+     6f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000700 <writetest1>:
+{
+     700:	55                   	push   %ebp
+     701:	89 e5                	mov    %esp,%ebp
+     703:	56                   	push   %esi
+     704:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     705:	83 ec 08             	sub    $0x8,%esp
+     708:	68 ed 44 00 00       	push   $0x44ed
+     70d:	ff 35 90 66 00 00    	push   0x6690
+     713:	e8 98 38 00 00       	call   3fb0 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     718:	58                   	pop    %eax
+     719:	5a                   	pop    %edx
+     71a:	68 02 02 00 00       	push   $0x202
+     71f:	68 67 45 00 00       	push   $0x4567
+     724:	e8 17 37 00 00       	call   3e40 <open>
+  if(fd < 0){
+     729:	83 c4 10             	add    $0x10,%esp
+     72c:	85 c0                	test   %eax,%eax
+     72e:	0f 88 61 01 00 00    	js     895 <writetest1+0x195>
+     734:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < MAXFILE; i++){
+     736:	31 db                	xor    %ebx,%ebx
+     738:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     73f:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     740:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     743:	89 1d e0 8d 00 00    	mov    %ebx,0x8de0
+    if(write(fd, buf, 512) != 512){
+     749:	68 00 02 00 00       	push   $0x200
+     74e:	68 e0 8d 00 00       	push   $0x8de0
+     753:	56                   	push   %esi
+     754:	e8 c7 36 00 00       	call   3e20 <write>
+     759:	83 c4 10             	add    $0x10,%esp
+     75c:	3d 00 02 00 00       	cmp    $0x200,%eax
+     761:	0f 85 b3 00 00 00    	jne    81a <writetest1+0x11a>
+  for(i = 0; i < MAXFILE; i++){
+     767:	83 c3 01             	add    $0x1,%ebx
+     76a:	81 fb 8c 00 00 00    	cmp    $0x8c,%ebx
+     770:	75 ce                	jne    740 <writetest1+0x40>
+  close(fd);
+     772:	83 ec 0c             	sub    $0xc,%esp
+     775:	56                   	push   %esi
+     776:	e8 ad 36 00 00       	call   3e28 <close>
+  fd = open("big", O_RDONLY);
+     77b:	5b                   	pop    %ebx
+     77c:	5e                   	pop    %esi
+     77d:	6a 00                	push   $0x0
+     77f:	68 67 45 00 00       	push   $0x4567
+     784:	e8 b7 36 00 00       	call   3e40 <open>
+  if(fd < 0){
+     789:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     78c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     78e:	85 c0                	test   %eax,%eax
+     790:	0f 88 e8 00 00 00    	js     87e <writetest1+0x17e>
+  n = 0;
+     796:	31 f6                	xor    %esi,%esi
+     798:	eb 1d                	jmp    7b7 <writetest1+0xb7>
+     79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     7a0:	3d 00 02 00 00       	cmp    $0x200,%eax
+     7a5:	0f 85 9f 00 00 00    	jne    84a <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     7ab:	a1 e0 8d 00 00       	mov    0x8de0,%eax
+     7b0:	39 f0                	cmp    %esi,%eax
+     7b2:	75 7f                	jne    833 <writetest1+0x133>
+    n++;
+     7b4:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     7b7:	83 ec 04             	sub    $0x4,%esp
+     7ba:	68 00 02 00 00       	push   $0x200
+     7bf:	68 e0 8d 00 00       	push   $0x8de0
+     7c4:	53                   	push   %ebx
+     7c5:	e8 4e 36 00 00       	call   3e18 <read>
+    if(i == 0){
+     7ca:	83 c4 10             	add    $0x10,%esp
+     7cd:	85 c0                	test   %eax,%eax
+     7cf:	75 cf                	jne    7a0 <writetest1+0xa0>
+      if(n == MAXFILE - 1){
+     7d1:	81 fe 8b 00 00 00    	cmp    $0x8b,%esi
+     7d7:	0f 84 86 00 00 00    	je     863 <writetest1+0x163>
+  close(fd);
+     7dd:	83 ec 0c             	sub    $0xc,%esp
+     7e0:	53                   	push   %ebx
+     7e1:	e8 42 36 00 00       	call   3e28 <close>
+  if(unlink("big") < 0){
+     7e6:	c7 04 24 67 45 00 00 	movl   $0x4567,(%esp)
+     7ed:	e8 5e 36 00 00       	call   3e50 <unlink>
+     7f2:	83 c4 10             	add    $0x10,%esp
+     7f5:	85 c0                	test   %eax,%eax
+     7f7:	0f 88 af 00 00 00    	js     8ac <writetest1+0x1ac>
+  printf(stdout, "big files ok\n");
+     7fd:	83 ec 08             	sub    $0x8,%esp
+     800:	68 8e 45 00 00       	push   $0x458e
+     805:	ff 35 90 66 00 00    	push   0x6690
+     80b:	e8 a0 37 00 00       	call   3fb0 <printf>
+}
+     810:	83 c4 10             	add    $0x10,%esp
+     813:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     816:	5b                   	pop    %ebx
+     817:	5e                   	pop    %esi
+     818:	5d                   	pop    %ebp
+     819:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     81a:	83 ec 04             	sub    $0x4,%esp
+     81d:	53                   	push   %ebx
+     81e:	68 17 45 00 00       	push   $0x4517
+     823:	ff 35 90 66 00 00    	push   0x6690
+     829:	e8 82 37 00 00       	call   3fb0 <printf>
+      exit();
+     82e:	e8 cd 35 00 00       	call   3e00 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     833:	50                   	push   %eax
+     834:	56                   	push   %esi
+     835:	68 0c 54 00 00       	push   $0x540c
+     83a:	ff 35 90 66 00 00    	push   0x6690
+     840:	e8 6b 37 00 00       	call   3fb0 <printf>
+      exit();
+     845:	e8 b6 35 00 00       	call   3e00 <exit>
+      printf(stdout, "read failed %d\n", i);
+     84a:	83 ec 04             	sub    $0x4,%esp
+     84d:	50                   	push   %eax
+     84e:	68 6b 45 00 00       	push   $0x456b
+     853:	ff 35 90 66 00 00    	push   0x6690
+     859:	e8 52 37 00 00       	call   3fb0 <printf>
+      exit();
+     85e:	e8 9d 35 00 00       	call   3e00 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     863:	52                   	push   %edx
+     864:	68 8b 00 00 00       	push   $0x8b
+     869:	68 4e 45 00 00       	push   $0x454e
+     86e:	ff 35 90 66 00 00    	push   0x6690
+     874:	e8 37 37 00 00       	call   3fb0 <printf>
+        exit();
+     879:	e8 82 35 00 00       	call   3e00 <exit>
+    printf(stdout, "error: open big failed!\n");
+     87e:	51                   	push   %ecx
+     87f:	51                   	push   %ecx
+     880:	68 35 45 00 00       	push   $0x4535
+     885:	ff 35 90 66 00 00    	push   0x6690
+     88b:	e8 20 37 00 00       	call   3fb0 <printf>
+    exit();
+     890:	e8 6b 35 00 00       	call   3e00 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     895:	50                   	push   %eax
+     896:	50                   	push   %eax
+     897:	68 fd 44 00 00       	push   $0x44fd
+     89c:	ff 35 90 66 00 00    	push   0x6690
+     8a2:	e8 09 37 00 00       	call   3fb0 <printf>
+    exit();
+     8a7:	e8 54 35 00 00       	call   3e00 <exit>
+    printf(stdout, "unlink big failed\n");
+     8ac:	50                   	push   %eax
+     8ad:	50                   	push   %eax
+     8ae:	68 7b 45 00 00       	push   $0x457b
+     8b3:	ff 35 90 66 00 00    	push   0x6690
+     8b9:	e8 f2 36 00 00       	call   3fb0 <printf>
+    exit();
+     8be:	e8 3d 35 00 00       	call   3e00 <exit>
+     8c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008d0 <createtest>:
+{
+     8d0:	55                   	push   %ebp
+     8d1:	89 e5                	mov    %esp,%ebp
+     8d3:	53                   	push   %ebx
+  name[2] = '\0';
+     8d4:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     8d9:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     8dc:	68 2c 54 00 00       	push   $0x542c
+     8e1:	ff 35 90 66 00 00    	push   0x6690
+     8e7:	e8 c4 36 00 00       	call   3fb0 <printf>
+  name[0] = 'a';
+     8ec:	c6 05 d0 8d 00 00 61 	movb   $0x61,0x8dd0
+  name[2] = '\0';
+     8f3:	83 c4 10             	add    $0x10,%esp
+     8f6:	c6 05 d2 8d 00 00 00 	movb   $0x0,0x8dd2
+  for(i = 0; i < 52; i++){
+     8fd:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     900:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     903:	88 1d d1 8d 00 00    	mov    %bl,0x8dd1
+  for(i = 0; i < 52; i++){
+     909:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     90c:	68 02 02 00 00       	push   $0x202
+     911:	68 d0 8d 00 00       	push   $0x8dd0
+     916:	e8 25 35 00 00       	call   3e40 <open>
+    close(fd);
+     91b:	89 04 24             	mov    %eax,(%esp)
+     91e:	e8 05 35 00 00       	call   3e28 <close>
+  for(i = 0; i < 52; i++){
+     923:	83 c4 10             	add    $0x10,%esp
+     926:	80 fb 64             	cmp    $0x64,%bl
+     929:	75 d5                	jne    900 <createtest+0x30>
+  name[0] = 'a';
+     92b:	c6 05 d0 8d 00 00 61 	movb   $0x61,0x8dd0
+  name[2] = '\0';
+     932:	bb 30 00 00 00       	mov    $0x30,%ebx
+     937:	c6 05 d2 8d 00 00 00 	movb   $0x0,0x8dd2
+  for(i = 0; i < 52; i++){
+     93e:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     940:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     943:	88 1d d1 8d 00 00    	mov    %bl,0x8dd1
+  for(i = 0; i < 52; i++){
+     949:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     94c:	68 d0 8d 00 00       	push   $0x8dd0
+     951:	e8 fa 34 00 00       	call   3e50 <unlink>
+  for(i = 0; i < 52; i++){
+     956:	83 c4 10             	add    $0x10,%esp
+     959:	80 fb 64             	cmp    $0x64,%bl
+     95c:	75 e2                	jne    940 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     95e:	83 ec 08             	sub    $0x8,%esp
+     961:	68 54 54 00 00       	push   $0x5454
+     966:	ff 35 90 66 00 00    	push   0x6690
+     96c:	e8 3f 36 00 00       	call   3fb0 <printf>
+}
+     971:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     974:	83 c4 10             	add    $0x10,%esp
+     977:	c9                   	leave
+     978:	c3                   	ret
+     979:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000980 <dirtest>:
+{
+     980:	55                   	push   %ebp
+     981:	89 e5                	mov    %esp,%ebp
+     983:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     986:	68 9c 45 00 00       	push   $0x459c
+     98b:	ff 35 90 66 00 00    	push   0x6690
+     991:	e8 1a 36 00 00       	call   3fb0 <printf>
+  if(mkdir("dir0") < 0){
+     996:	c7 04 24 a8 45 00 00 	movl   $0x45a8,(%esp)
+     99d:	e8 c6 34 00 00       	call   3e68 <mkdir>
+     9a2:	83 c4 10             	add    $0x10,%esp
+     9a5:	85 c0                	test   %eax,%eax
+     9a7:	78 58                	js     a01 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     9a9:	83 ec 0c             	sub    $0xc,%esp
+     9ac:	68 a8 45 00 00       	push   $0x45a8
+     9b1:	e8 ba 34 00 00       	call   3e70 <chdir>
+     9b6:	83 c4 10             	add    $0x10,%esp
+     9b9:	85 c0                	test   %eax,%eax
+     9bb:	0f 88 85 00 00 00    	js     a46 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     9c1:	83 ec 0c             	sub    $0xc,%esp
+     9c4:	68 4d 4b 00 00       	push   $0x4b4d
+     9c9:	e8 a2 34 00 00       	call   3e70 <chdir>
+     9ce:	83 c4 10             	add    $0x10,%esp
+     9d1:	85 c0                	test   %eax,%eax
+     9d3:	78 5a                	js     a2f <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     9d5:	83 ec 0c             	sub    $0xc,%esp
+     9d8:	68 a8 45 00 00       	push   $0x45a8
+     9dd:	e8 6e 34 00 00       	call   3e50 <unlink>
+     9e2:	83 c4 10             	add    $0x10,%esp
+     9e5:	85 c0                	test   %eax,%eax
+     9e7:	78 2f                	js     a18 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     9e9:	83 ec 08             	sub    $0x8,%esp
+     9ec:	68 e5 45 00 00       	push   $0x45e5
+     9f1:	ff 35 90 66 00 00    	push   0x6690
+     9f7:	e8 b4 35 00 00       	call   3fb0 <printf>
+}
+     9fc:	83 c4 10             	add    $0x10,%esp
+     9ff:	c9                   	leave
+     a00:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     a01:	50                   	push   %eax
+     a02:	50                   	push   %eax
+     a03:	68 d8 42 00 00       	push   $0x42d8
+     a08:	ff 35 90 66 00 00    	push   0x6690
+     a0e:	e8 9d 35 00 00       	call   3fb0 <printf>
+    exit();
+     a13:	e8 e8 33 00 00       	call   3e00 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     a18:	50                   	push   %eax
+     a19:	50                   	push   %eax
+     a1a:	68 d1 45 00 00       	push   $0x45d1
+     a1f:	ff 35 90 66 00 00    	push   0x6690
+     a25:	e8 86 35 00 00       	call   3fb0 <printf>
+    exit();
+     a2a:	e8 d1 33 00 00       	call   3e00 <exit>
+    printf(stdout, "chdir .. failed\n");
+     a2f:	52                   	push   %edx
+     a30:	52                   	push   %edx
+     a31:	68 c0 45 00 00       	push   $0x45c0
+     a36:	ff 35 90 66 00 00    	push   0x6690
+     a3c:	e8 6f 35 00 00       	call   3fb0 <printf>
+    exit();
+     a41:	e8 ba 33 00 00       	call   3e00 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     a46:	51                   	push   %ecx
+     a47:	51                   	push   %ecx
+     a48:	68 ad 45 00 00       	push   $0x45ad
+     a4d:	ff 35 90 66 00 00    	push   0x6690
+     a53:	e8 58 35 00 00       	call   3fb0 <printf>
+    exit();
+     a58:	e8 a3 33 00 00       	call   3e00 <exit>
+     a5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a60 <exectest>:
+{
+     a60:	55                   	push   %ebp
+     a61:	89 e5                	mov    %esp,%ebp
+     a63:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     a66:	68 f4 45 00 00       	push   $0x45f4
+     a6b:	ff 35 90 66 00 00    	push   0x6690
+     a71:	e8 3a 35 00 00       	call   3fb0 <printf>
+  if(exec("echo", echoargv) < 0){
+     a76:	5a                   	pop    %edx
+     a77:	59                   	pop    %ecx
+     a78:	68 94 66 00 00       	push   $0x6694
+     a7d:	68 bd 43 00 00       	push   $0x43bd
+     a82:	e8 b1 33 00 00       	call   3e38 <exec>
+     a87:	83 c4 10             	add    $0x10,%esp
+     a8a:	85 c0                	test   %eax,%eax
+     a8c:	78 02                	js     a90 <exectest+0x30>
+}
+     a8e:	c9                   	leave
+     a8f:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     a90:	50                   	push   %eax
+     a91:	50                   	push   %eax
+     a92:	68 ff 45 00 00       	push   $0x45ff
+     a97:	ff 35 90 66 00 00    	push   0x6690
+     a9d:	e8 0e 35 00 00       	call   3fb0 <printf>
+    exit();
+     aa2:	e8 59 33 00 00       	call   3e00 <exit>
+     aa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aae:	66 90                	xchg   %ax,%ax
+
+00000ab0 <pipe1>:
+{
+     ab0:	55                   	push   %ebp
+     ab1:	89 e5                	mov    %esp,%ebp
+     ab3:	57                   	push   %edi
+     ab4:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     ab5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     ab8:	53                   	push   %ebx
+     ab9:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     abc:	50                   	push   %eax
+     abd:	e8 4e 33 00 00       	call   3e10 <pipe>
+     ac2:	83 c4 10             	add    $0x10,%esp
+     ac5:	85 c0                	test   %eax,%eax
+     ac7:	0f 85 41 01 00 00    	jne    c0e <pipe1+0x15e>
+     acd:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     acf:	e8 24 33 00 00       	call   3df8 <fork>
+  if(pid == 0){
+     ad4:	85 c0                	test   %eax,%eax
+     ad6:	0f 84 92 00 00 00    	je     b6e <pipe1+0xbe>
+  } else if(pid > 0){
+     adc:	0f 8e 3f 01 00 00    	jle    c21 <pipe1+0x171>
+    close(fds[1]);
+     ae2:	83 ec 0c             	sub    $0xc,%esp
+     ae5:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     ae8:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     aea:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     aef:	e8 34 33 00 00       	call   3e28 <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     af4:	83 c4 10             	add    $0x10,%esp
+     af7:	83 ec 04             	sub    $0x4,%esp
+     afa:	57                   	push   %edi
+     afb:	68 e0 8d 00 00       	push   $0x8de0
+     b00:	ff 75 e0             	push   -0x20(%ebp)
+     b03:	e8 10 33 00 00       	call   3e18 <read>
+     b08:	83 c4 10             	add    $0x10,%esp
+     b0b:	89 c1                	mov    %eax,%ecx
+     b0d:	85 c0                	test   %eax,%eax
+     b0f:	0f 8e b8 00 00 00    	jle    bcd <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     b15:	89 f0                	mov    %esi,%eax
+     b17:	32 05 e0 8d 00 00    	xor    0x8de0,%al
+     b1d:	0f b6 c0             	movzbl %al,%eax
+     b20:	85 c0                	test   %eax,%eax
+     b22:	75 30                	jne    b54 <pipe1+0xa4>
+     b24:	83 c6 01             	add    $0x1,%esi
+     b27:	eb 0f                	jmp    b38 <pipe1+0x88>
+     b29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b30:	38 90 e0 8d 00 00    	cmp    %dl,0x8de0(%eax)
+     b36:	75 1c                	jne    b54 <pipe1+0xa4>
+     b38:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     b3b:	83 c0 01             	add    $0x1,%eax
+     b3e:	39 c1                	cmp    %eax,%ecx
+     b40:	75 ee                	jne    b30 <pipe1+0x80>
+      cc = cc * 2;
+     b42:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     b44:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     b49:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     b4b:	89 d6                	mov    %edx,%esi
+     b4d:	39 c7                	cmp    %eax,%edi
+     b4f:	0f 4f f8             	cmovg  %eax,%edi
+     b52:	eb a3                	jmp    af7 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     b54:	83 ec 08             	sub    $0x8,%esp
+     b57:	68 2e 46 00 00       	push   $0x462e
+     b5c:	6a 01                	push   $0x1
+     b5e:	e8 4d 34 00 00       	call   3fb0 <printf>
+     b63:	83 c4 10             	add    $0x10,%esp
+}
+     b66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b69:	5b                   	pop    %ebx
+     b6a:	5e                   	pop    %esi
+     b6b:	5f                   	pop    %edi
+     b6c:	5d                   	pop    %ebp
+     b6d:	c3                   	ret
+    close(fds[0]);
+     b6e:	83 ec 0c             	sub    $0xc,%esp
+     b71:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     b74:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     b76:	e8 ad 32 00 00       	call   3e28 <close>
+     b7b:	83 c4 10             	add    $0x10,%esp
+     b7e:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     b80:	31 c0                	xor    %eax,%eax
+     b82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     b88:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     b8b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     b8e:	88 90 df 8d 00 00    	mov    %dl,0x8ddf(%eax)
+      for(i = 0; i < 1033; i++)
+     b94:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b99:	75 ed                	jne    b88 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     b9b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     b9e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     ba4:	68 09 04 00 00       	push   $0x409
+     ba9:	68 e0 8d 00 00       	push   $0x8de0
+     bae:	ff 75 e4             	push   -0x1c(%ebp)
+     bb1:	e8 6a 32 00 00       	call   3e20 <write>
+     bb6:	83 c4 10             	add    $0x10,%esp
+     bb9:	3d 09 04 00 00       	cmp    $0x409,%eax
+     bbe:	75 74                	jne    c34 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     bc0:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     bc6:	75 b8                	jne    b80 <pipe1+0xd0>
+    exit();
+     bc8:	e8 33 32 00 00       	call   3e00 <exit>
+    if(total != 5 * 1033){
+     bcd:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     bd3:	75 26                	jne    bfb <pipe1+0x14b>
+    close(fds[0]);
+     bd5:	83 ec 0c             	sub    $0xc,%esp
+     bd8:	ff 75 e0             	push   -0x20(%ebp)
+     bdb:	e8 48 32 00 00       	call   3e28 <close>
+    wait();
+     be0:	e8 23 32 00 00       	call   3e08 <wait>
+  printf(1, "pipe1 ok\n");
+     be5:	5a                   	pop    %edx
+     be6:	59                   	pop    %ecx
+     be7:	68 53 46 00 00       	push   $0x4653
+     bec:	6a 01                	push   $0x1
+     bee:	e8 bd 33 00 00       	call   3fb0 <printf>
+     bf3:	83 c4 10             	add    $0x10,%esp
+     bf6:	e9 6b ff ff ff       	jmp    b66 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     bfb:	56                   	push   %esi
+     bfc:	53                   	push   %ebx
+     bfd:	68 3c 46 00 00       	push   $0x463c
+     c02:	6a 01                	push   $0x1
+     c04:	e8 a7 33 00 00       	call   3fb0 <printf>
+      exit();
+     c09:	e8 f2 31 00 00       	call   3e00 <exit>
+    printf(1, "pipe() failed\n");
+     c0e:	50                   	push   %eax
+     c0f:	50                   	push   %eax
+     c10:	68 11 46 00 00       	push   $0x4611
+     c15:	6a 01                	push   $0x1
+     c17:	e8 94 33 00 00       	call   3fb0 <printf>
+    exit();
+     c1c:	e8 df 31 00 00       	call   3e00 <exit>
+    printf(1, "fork() failed\n");
+     c21:	50                   	push   %eax
+     c22:	50                   	push   %eax
+     c23:	68 5d 46 00 00       	push   $0x465d
+     c28:	6a 01                	push   $0x1
+     c2a:	e8 81 33 00 00       	call   3fb0 <printf>
+    exit();
+     c2f:	e8 cc 31 00 00       	call   3e00 <exit>
+        printf(1, "pipe1 oops 1\n");
+     c34:	57                   	push   %edi
+     c35:	57                   	push   %edi
+     c36:	68 20 46 00 00       	push   $0x4620
+     c3b:	6a 01                	push   $0x1
+     c3d:	e8 6e 33 00 00       	call   3fb0 <printf>
+        exit();
+     c42:	e8 b9 31 00 00       	call   3e00 <exit>
+     c47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c4e:	66 90                	xchg   %ax,%ax
+
+00000c50 <preempt>:
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	57                   	push   %edi
+     c54:	56                   	push   %esi
+     c55:	53                   	push   %ebx
+     c56:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+     c59:	68 6c 46 00 00       	push   $0x466c
+     c5e:	6a 01                	push   $0x1
+     c60:	e8 4b 33 00 00       	call   3fb0 <printf>
+  pid1 = fork();
+     c65:	e8 8e 31 00 00       	call   3df8 <fork>
+  if(pid1 == 0)
+     c6a:	83 c4 10             	add    $0x10,%esp
+     c6d:	85 c0                	test   %eax,%eax
+     c6f:	75 07                	jne    c78 <preempt+0x28>
+    for(;;)
+     c71:	eb fe                	jmp    c71 <preempt+0x21>
+     c73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c77:	90                   	nop
+     c78:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+     c7a:	e8 79 31 00 00       	call   3df8 <fork>
+     c7f:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+     c81:	85 c0                	test   %eax,%eax
+     c83:	75 0b                	jne    c90 <preempt+0x40>
+    for(;;)
+     c85:	eb fe                	jmp    c85 <preempt+0x35>
+     c87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c8e:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+     c90:	83 ec 0c             	sub    $0xc,%esp
+     c93:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     c96:	50                   	push   %eax
+     c97:	e8 74 31 00 00       	call   3e10 <pipe>
+  pid3 = fork();
+     c9c:	e8 57 31 00 00       	call   3df8 <fork>
+  if(pid3 == 0){
+     ca1:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     ca4:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+     ca6:	85 c0                	test   %eax,%eax
+     ca8:	75 3e                	jne    ce8 <preempt+0x98>
+    close(pfds[0]);
+     caa:	83 ec 0c             	sub    $0xc,%esp
+     cad:	ff 75 e0             	push   -0x20(%ebp)
+     cb0:	e8 73 31 00 00       	call   3e28 <close>
+    if(write(pfds[1], "x", 1) != 1)
+     cb5:	83 c4 0c             	add    $0xc,%esp
+     cb8:	6a 01                	push   $0x1
+     cba:	68 31 4c 00 00       	push   $0x4c31
+     cbf:	ff 75 e4             	push   -0x1c(%ebp)
+     cc2:	e8 59 31 00 00       	call   3e20 <write>
+     cc7:	83 c4 10             	add    $0x10,%esp
+     cca:	83 f8 01             	cmp    $0x1,%eax
+     ccd:	0f 85 b8 00 00 00    	jne    d8b <preempt+0x13b>
+    close(pfds[1]);
+     cd3:	83 ec 0c             	sub    $0xc,%esp
+     cd6:	ff 75 e4             	push   -0x1c(%ebp)
+     cd9:	e8 4a 31 00 00       	call   3e28 <close>
+     cde:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     ce1:	eb fe                	jmp    ce1 <preempt+0x91>
+     ce3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ce7:	90                   	nop
+  close(pfds[1]);
+     ce8:	83 ec 0c             	sub    $0xc,%esp
+     ceb:	ff 75 e4             	push   -0x1c(%ebp)
+     cee:	e8 35 31 00 00       	call   3e28 <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     cf3:	83 c4 0c             	add    $0xc,%esp
+     cf6:	68 00 20 00 00       	push   $0x2000
+     cfb:	68 e0 8d 00 00       	push   $0x8de0
+     d00:	ff 75 e0             	push   -0x20(%ebp)
+     d03:	e8 10 31 00 00       	call   3e18 <read>
+     d08:	83 c4 10             	add    $0x10,%esp
+     d0b:	83 f8 01             	cmp    $0x1,%eax
+     d0e:	75 67                	jne    d77 <preempt+0x127>
+  close(pfds[0]);
+     d10:	83 ec 0c             	sub    $0xc,%esp
+     d13:	ff 75 e0             	push   -0x20(%ebp)
+     d16:	e8 0d 31 00 00       	call   3e28 <close>
+  printf(1, "kill... ");
+     d1b:	58                   	pop    %eax
+     d1c:	5a                   	pop    %edx
+     d1d:	68 9d 46 00 00       	push   $0x469d
+     d22:	6a 01                	push   $0x1
+     d24:	e8 87 32 00 00       	call   3fb0 <printf>
+  kill(pid1);
+     d29:	89 1c 24             	mov    %ebx,(%esp)
+     d2c:	e8 ff 30 00 00       	call   3e30 <kill>
+  kill(pid2);
+     d31:	89 34 24             	mov    %esi,(%esp)
+     d34:	e8 f7 30 00 00       	call   3e30 <kill>
+  kill(pid3);
+     d39:	89 3c 24             	mov    %edi,(%esp)
+     d3c:	e8 ef 30 00 00       	call   3e30 <kill>
+  printf(1, "wait... ");
+     d41:	59                   	pop    %ecx
+     d42:	5b                   	pop    %ebx
+     d43:	68 a6 46 00 00       	push   $0x46a6
+     d48:	6a 01                	push   $0x1
+     d4a:	e8 61 32 00 00       	call   3fb0 <printf>
+  wait();
+     d4f:	e8 b4 30 00 00       	call   3e08 <wait>
+  wait();
+     d54:	e8 af 30 00 00       	call   3e08 <wait>
+  wait();
+     d59:	e8 aa 30 00 00       	call   3e08 <wait>
+  printf(1, "preempt ok\n");
+     d5e:	5e                   	pop    %esi
+     d5f:	5f                   	pop    %edi
+     d60:	68 af 46 00 00       	push   $0x46af
+     d65:	6a 01                	push   $0x1
+     d67:	e8 44 32 00 00       	call   3fb0 <printf>
+     d6c:	83 c4 10             	add    $0x10,%esp
+}
+     d6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d72:	5b                   	pop    %ebx
+     d73:	5e                   	pop    %esi
+     d74:	5f                   	pop    %edi
+     d75:	5d                   	pop    %ebp
+     d76:	c3                   	ret
+    printf(1, "preempt read error");
+     d77:	83 ec 08             	sub    $0x8,%esp
+     d7a:	68 8a 46 00 00       	push   $0x468a
+     d7f:	6a 01                	push   $0x1
+     d81:	e8 2a 32 00 00       	call   3fb0 <printf>
+     d86:	83 c4 10             	add    $0x10,%esp
+     d89:	eb e4                	jmp    d6f <preempt+0x11f>
+      printf(1, "preempt write error");
+     d8b:	83 ec 08             	sub    $0x8,%esp
+     d8e:	68 76 46 00 00       	push   $0x4676
+     d93:	6a 01                	push   $0x1
+     d95:	e8 16 32 00 00       	call   3fb0 <printf>
+     d9a:	83 c4 10             	add    $0x10,%esp
+     d9d:	e9 31 ff ff ff       	jmp    cd3 <preempt+0x83>
+     da2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     da9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000db0 <exitwait>:
+{
+     db0:	55                   	push   %ebp
+     db1:	89 e5                	mov    %esp,%ebp
+     db3:	56                   	push   %esi
+     db4:	be 64 00 00 00       	mov    $0x64,%esi
+     db9:	53                   	push   %ebx
+     dba:	eb 14                	jmp    dd0 <exitwait+0x20>
+     dbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+     dc0:	74 68                	je     e2a <exitwait+0x7a>
+      if(wait() != pid){
+     dc2:	e8 41 30 00 00       	call   3e08 <wait>
+     dc7:	39 d8                	cmp    %ebx,%eax
+     dc9:	75 2d                	jne    df8 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+     dcb:	83 ee 01             	sub    $0x1,%esi
+     dce:	74 41                	je     e11 <exitwait+0x61>
+    pid = fork();
+     dd0:	e8 23 30 00 00       	call   3df8 <fork>
+     dd5:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     dd7:	85 c0                	test   %eax,%eax
+     dd9:	79 e5                	jns    dc0 <exitwait+0x10>
+      printf(1, "fork failed\n");
+     ddb:	83 ec 08             	sub    $0x8,%esp
+     dde:	68 bf 52 00 00       	push   $0x52bf
+     de3:	6a 01                	push   $0x1
+     de5:	e8 c6 31 00 00       	call   3fb0 <printf>
+      return;
+     dea:	83 c4 10             	add    $0x10,%esp
+}
+     ded:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     df0:	5b                   	pop    %ebx
+     df1:	5e                   	pop    %esi
+     df2:	5d                   	pop    %ebp
+     df3:	c3                   	ret
+     df4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+     df8:	83 ec 08             	sub    $0x8,%esp
+     dfb:	68 bb 46 00 00       	push   $0x46bb
+     e00:	6a 01                	push   $0x1
+     e02:	e8 a9 31 00 00       	call   3fb0 <printf>
+        return;
+     e07:	83 c4 10             	add    $0x10,%esp
+}
+     e0a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e0d:	5b                   	pop    %ebx
+     e0e:	5e                   	pop    %esi
+     e0f:	5d                   	pop    %ebp
+     e10:	c3                   	ret
+  printf(1, "exitwait ok\n");
+     e11:	83 ec 08             	sub    $0x8,%esp
+     e14:	68 cb 46 00 00       	push   $0x46cb
+     e19:	6a 01                	push   $0x1
+     e1b:	e8 90 31 00 00       	call   3fb0 <printf>
+     e20:	83 c4 10             	add    $0x10,%esp
+}
+     e23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e26:	5b                   	pop    %ebx
+     e27:	5e                   	pop    %esi
+     e28:	5d                   	pop    %ebp
+     e29:	c3                   	ret
+      exit();
+     e2a:	e8 d1 2f 00 00       	call   3e00 <exit>
+     e2f:	90                   	nop
+
+00000e30 <mem>:
+{
+     e30:	55                   	push   %ebp
+     e31:	89 e5                	mov    %esp,%ebp
+     e33:	56                   	push   %esi
+     e34:	31 f6                	xor    %esi,%esi
+     e36:	53                   	push   %ebx
+  printf(1, "mem test\n");
+     e37:	83 ec 08             	sub    $0x8,%esp
+     e3a:	68 d8 46 00 00       	push   $0x46d8
+     e3f:	6a 01                	push   $0x1
+     e41:	e8 6a 31 00 00       	call   3fb0 <printf>
+  ppid = getpid();
+     e46:	e8 35 30 00 00       	call   3e80 <getpid>
+     e4b:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+     e4d:	e8 a6 2f 00 00       	call   3df8 <fork>
+     e52:	83 c4 10             	add    $0x10,%esp
+     e55:	85 c0                	test   %eax,%eax
+     e57:	74 0b                	je     e64 <mem+0x34>
+     e59:	e9 8a 00 00 00       	jmp    ee8 <mem+0xb8>
+     e5e:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+     e60:	89 30                	mov    %esi,(%eax)
+     e62:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+     e64:	83 ec 0c             	sub    $0xc,%esp
+     e67:	68 11 27 00 00       	push   $0x2711
+     e6c:	e8 7f 33 00 00       	call   41f0 <malloc>
+     e71:	83 c4 10             	add    $0x10,%esp
+     e74:	85 c0                	test   %eax,%eax
+     e76:	75 e8                	jne    e60 <mem+0x30>
+    while(m1){
+     e78:	85 f6                	test   %esi,%esi
+     e7a:	74 18                	je     e94 <mem+0x64>
+     e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+     e80:	89 f0                	mov    %esi,%eax
+      free(m1);
+     e82:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+     e85:	8b 36                	mov    (%esi),%esi
+      free(m1);
+     e87:	50                   	push   %eax
+     e88:	e8 d3 32 00 00       	call   4160 <free>
+    while(m1){
+     e8d:	83 c4 10             	add    $0x10,%esp
+     e90:	85 f6                	test   %esi,%esi
+     e92:	75 ec                	jne    e80 <mem+0x50>
+    m1 = malloc(1024*20);
+     e94:	83 ec 0c             	sub    $0xc,%esp
+     e97:	68 00 50 00 00       	push   $0x5000
+     e9c:	e8 4f 33 00 00       	call   41f0 <malloc>
+    if(m1 == 0){
+     ea1:	83 c4 10             	add    $0x10,%esp
+     ea4:	85 c0                	test   %eax,%eax
+     ea6:	74 20                	je     ec8 <mem+0x98>
+    free(m1);
+     ea8:	83 ec 0c             	sub    $0xc,%esp
+     eab:	50                   	push   %eax
+     eac:	e8 af 32 00 00       	call   4160 <free>
+    printf(1, "mem ok\n");
+     eb1:	58                   	pop    %eax
+     eb2:	5a                   	pop    %edx
+     eb3:	68 fc 46 00 00       	push   $0x46fc
+     eb8:	6a 01                	push   $0x1
+     eba:	e8 f1 30 00 00       	call   3fb0 <printf>
+    exit();
+     ebf:	e8 3c 2f 00 00       	call   3e00 <exit>
+     ec4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+     ec8:	83 ec 08             	sub    $0x8,%esp
+     ecb:	68 e2 46 00 00       	push   $0x46e2
+     ed0:	6a 01                	push   $0x1
+     ed2:	e8 d9 30 00 00       	call   3fb0 <printf>
+      kill(ppid);
+     ed7:	89 1c 24             	mov    %ebx,(%esp)
+     eda:	e8 51 2f 00 00       	call   3e30 <kill>
+      exit();
+     edf:	e8 1c 2f 00 00       	call   3e00 <exit>
+     ee4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+     ee8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     eeb:	5b                   	pop    %ebx
+     eec:	5e                   	pop    %esi
+     eed:	5d                   	pop    %ebp
+    wait();
+     eee:	e9 15 2f 00 00       	jmp    3e08 <wait>
+     ef3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     efa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000f00 <sharedfd>:
+{
+     f00:	55                   	push   %ebp
+     f01:	89 e5                	mov    %esp,%ebp
+     f03:	57                   	push   %edi
+     f04:	56                   	push   %esi
+     f05:	53                   	push   %ebx
+     f06:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+     f09:	68 04 47 00 00       	push   $0x4704
+     f0e:	6a 01                	push   $0x1
+     f10:	e8 9b 30 00 00       	call   3fb0 <printf>
+  unlink("sharedfd");
+     f15:	c7 04 24 13 47 00 00 	movl   $0x4713,(%esp)
+     f1c:	e8 2f 2f 00 00       	call   3e50 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     f21:	5b                   	pop    %ebx
+     f22:	5e                   	pop    %esi
+     f23:	68 02 02 00 00       	push   $0x202
+     f28:	68 13 47 00 00       	push   $0x4713
+     f2d:	e8 0e 2f 00 00       	call   3e40 <open>
+  if(fd < 0){
+     f32:	83 c4 10             	add    $0x10,%esp
+     f35:	85 c0                	test   %eax,%eax
+     f37:	0f 88 2a 01 00 00    	js     1067 <sharedfd+0x167>
+     f3d:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     f3f:	8d 75 de             	lea    -0x22(%ebp),%esi
+     f42:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+     f47:	e8 ac 2e 00 00       	call   3df8 <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     f4c:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+     f4f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     f52:	19 c0                	sbb    %eax,%eax
+     f54:	83 ec 04             	sub    $0x4,%esp
+     f57:	83 e0 f3             	and    $0xfffffff3,%eax
+     f5a:	6a 0a                	push   $0xa
+     f5c:	83 c0 70             	add    $0x70,%eax
+     f5f:	50                   	push   %eax
+     f60:	56                   	push   %esi
+     f61:	e8 9a 2c 00 00       	call   3c00 <memset>
+     f66:	83 c4 10             	add    $0x10,%esp
+     f69:	eb 0a                	jmp    f75 <sharedfd+0x75>
+     f6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f6f:	90                   	nop
+  for(i = 0; i < 1000; i++){
+     f70:	83 eb 01             	sub    $0x1,%ebx
+     f73:	74 26                	je     f9b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     f75:	83 ec 04             	sub    $0x4,%esp
+     f78:	6a 0a                	push   $0xa
+     f7a:	56                   	push   %esi
+     f7b:	57                   	push   %edi
+     f7c:	e8 9f 2e 00 00       	call   3e20 <write>
+     f81:	83 c4 10             	add    $0x10,%esp
+     f84:	83 f8 0a             	cmp    $0xa,%eax
+     f87:	74 e7                	je     f70 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+     f89:	83 ec 08             	sub    $0x8,%esp
+     f8c:	68 a8 54 00 00       	push   $0x54a8
+     f91:	6a 01                	push   $0x1
+     f93:	e8 18 30 00 00       	call   3fb0 <printf>
+      break;
+     f98:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+     f9b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     f9e:	85 c9                	test   %ecx,%ecx
+     fa0:	0f 84 f5 00 00 00    	je     109b <sharedfd+0x19b>
+    wait();
+     fa6:	e8 5d 2e 00 00       	call   3e08 <wait>
+  close(fd);
+     fab:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+     fae:	31 db                	xor    %ebx,%ebx
+  close(fd);
+     fb0:	57                   	push   %edi
+     fb1:	8d 7d e8             	lea    -0x18(%ebp),%edi
+     fb4:	e8 6f 2e 00 00       	call   3e28 <close>
+  fd = open("sharedfd", 0);
+     fb9:	58                   	pop    %eax
+     fba:	5a                   	pop    %edx
+     fbb:	6a 00                	push   $0x0
+     fbd:	68 13 47 00 00       	push   $0x4713
+     fc2:	e8 79 2e 00 00       	call   3e40 <open>
+  if(fd < 0){
+     fc7:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+     fca:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+     fcc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+     fcf:	85 c0                	test   %eax,%eax
+     fd1:	0f 88 aa 00 00 00    	js     1081 <sharedfd+0x181>
+     fd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fde:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     fe0:	83 ec 04             	sub    $0x4,%esp
+     fe3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     fe6:	6a 0a                	push   $0xa
+     fe8:	56                   	push   %esi
+     fe9:	ff 75 d0             	push   -0x30(%ebp)
+     fec:	e8 27 2e 00 00       	call   3e18 <read>
+     ff1:	83 c4 10             	add    $0x10,%esp
+     ff4:	85 c0                	test   %eax,%eax
+     ff6:	7e 28                	jle    1020 <sharedfd+0x120>
+     ff8:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     ffb:	89 f0                	mov    %esi,%eax
+     ffd:	eb 13                	jmp    1012 <sharedfd+0x112>
+     fff:	90                   	nop
+        np++;
+    1000:	80 f9 70             	cmp    $0x70,%cl
+    1003:	0f 94 c1             	sete   %cl
+    1006:	0f b6 c9             	movzbl %cl,%ecx
+    1009:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    100b:	83 c0 01             	add    $0x1,%eax
+    100e:	39 f8                	cmp    %edi,%eax
+    1010:	74 ce                	je     fe0 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    1012:	0f b6 08             	movzbl (%eax),%ecx
+    1015:	80 f9 63             	cmp    $0x63,%cl
+    1018:	75 e6                	jne    1000 <sharedfd+0x100>
+        nc++;
+    101a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    101d:	eb ec                	jmp    100b <sharedfd+0x10b>
+    101f:	90                   	nop
+  close(fd);
+    1020:	83 ec 0c             	sub    $0xc,%esp
+    1023:	ff 75 d0             	push   -0x30(%ebp)
+    1026:	e8 fd 2d 00 00       	call   3e28 <close>
+  unlink("sharedfd");
+    102b:	c7 04 24 13 47 00 00 	movl   $0x4713,(%esp)
+    1032:	e8 19 2e 00 00       	call   3e50 <unlink>
+  if(nc == 10000 && np == 10000){
+    1037:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    103a:	83 c4 10             	add    $0x10,%esp
+    103d:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    1043:	75 5b                	jne    10a0 <sharedfd+0x1a0>
+    1045:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    104b:	75 53                	jne    10a0 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    104d:	83 ec 08             	sub    $0x8,%esp
+    1050:	68 1c 47 00 00       	push   $0x471c
+    1055:	6a 01                	push   $0x1
+    1057:	e8 54 2f 00 00       	call   3fb0 <printf>
+    105c:	83 c4 10             	add    $0x10,%esp
+}
+    105f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1062:	5b                   	pop    %ebx
+    1063:	5e                   	pop    %esi
+    1064:	5f                   	pop    %edi
+    1065:	5d                   	pop    %ebp
+    1066:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    1067:	83 ec 08             	sub    $0x8,%esp
+    106a:	68 7c 54 00 00       	push   $0x547c
+    106f:	6a 01                	push   $0x1
+    1071:	e8 3a 2f 00 00       	call   3fb0 <printf>
+    return;
+    1076:	83 c4 10             	add    $0x10,%esp
+}
+    1079:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    107c:	5b                   	pop    %ebx
+    107d:	5e                   	pop    %esi
+    107e:	5f                   	pop    %edi
+    107f:	5d                   	pop    %ebp
+    1080:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1081:	83 ec 08             	sub    $0x8,%esp
+    1084:	68 c8 54 00 00       	push   $0x54c8
+    1089:	6a 01                	push   $0x1
+    108b:	e8 20 2f 00 00       	call   3fb0 <printf>
+    return;
+    1090:	83 c4 10             	add    $0x10,%esp
+}
+    1093:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1096:	5b                   	pop    %ebx
+    1097:	5e                   	pop    %esi
+    1098:	5f                   	pop    %edi
+    1099:	5d                   	pop    %ebp
+    109a:	c3                   	ret
+    exit();
+    109b:	e8 60 2d 00 00       	call   3e00 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    10a0:	53                   	push   %ebx
+    10a1:	52                   	push   %edx
+    10a2:	68 29 47 00 00       	push   $0x4729
+    10a7:	6a 01                	push   $0x1
+    10a9:	e8 02 2f 00 00       	call   3fb0 <printf>
+    exit();
+    10ae:	e8 4d 2d 00 00       	call   3e00 <exit>
+    10b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000010c0 <fourfiles>:
+{
+    10c0:	55                   	push   %ebp
+    10c1:	89 e5                	mov    %esp,%ebp
+    10c3:	57                   	push   %edi
+    10c4:	56                   	push   %esi
+    10c5:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    10c6:	31 db                	xor    %ebx,%ebx
+{
+    10c8:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    10cb:	c7 45 d8 3e 47 00 00 	movl   $0x473e,-0x28(%ebp)
+    10d2:	c7 45 dc 87 48 00 00 	movl   $0x4887,-0x24(%ebp)
+    10d9:	c7 45 e0 8b 48 00 00 	movl   $0x488b,-0x20(%ebp)
+    10e0:	c7 45 e4 41 47 00 00 	movl   $0x4741,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    10e7:	68 44 47 00 00       	push   $0x4744
+    10ec:	6a 01                	push   $0x1
+    10ee:	e8 bd 2e 00 00       	call   3fb0 <printf>
+    10f3:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    10f6:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    10fa:	83 ec 0c             	sub    $0xc,%esp
+    10fd:	56                   	push   %esi
+    10fe:	e8 4d 2d 00 00       	call   3e50 <unlink>
+    pid = fork();
+    1103:	e8 f0 2c 00 00       	call   3df8 <fork>
+    if(pid < 0){
+    1108:	83 c4 10             	add    $0x10,%esp
+    110b:	85 c0                	test   %eax,%eax
+    110d:	0f 88 65 01 00 00    	js     1278 <fourfiles+0x1b8>
+    if(pid == 0){
+    1113:	0f 84 eb 00 00 00    	je     1204 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    1119:	83 c3 01             	add    $0x1,%ebx
+    111c:	83 fb 04             	cmp    $0x4,%ebx
+    111f:	75 d5                	jne    10f6 <fourfiles+0x36>
+    wait();
+    1121:	e8 e2 2c 00 00       	call   3e08 <wait>
+  for(i = 0; i < 2; i++){
+    1126:	31 f6                	xor    %esi,%esi
+    wait();
+    1128:	e8 db 2c 00 00       	call   3e08 <wait>
+    112d:	e8 d6 2c 00 00       	call   3e08 <wait>
+    1132:	e8 d1 2c 00 00       	call   3e08 <wait>
+    fname = names[i];
+    1137:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    113b:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    113e:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    1140:	6a 00                	push   $0x0
+    1142:	53                   	push   %ebx
+    1143:	e8 f8 2c 00 00       	call   3e40 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1148:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    114b:	83 c4 10             	add    $0x10,%esp
+    114e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    1151:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1158:	83 ec 04             	sub    $0x4,%esp
+    115b:	68 00 20 00 00       	push   $0x2000
+    1160:	68 e0 8d 00 00       	push   $0x8de0
+    1165:	ff 75 d4             	push   -0x2c(%ebp)
+    1168:	e8 ab 2c 00 00       	call   3e18 <read>
+    116d:	83 c4 10             	add    $0x10,%esp
+    1170:	89 c3                	mov    %eax,%ebx
+    1172:	85 c0                	test   %eax,%eax
+    1174:	7e 28                	jle    119e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    1176:	31 c0                	xor    %eax,%eax
+    1178:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    117f:	90                   	nop
+        if(buf[j] != '0'+i){
+    1180:	83 fe 01             	cmp    $0x1,%esi
+    1183:	0f be 88 e0 8d 00 00 	movsbl 0x8de0(%eax),%ecx
+    118a:	19 d2                	sbb    %edx,%edx
+    118c:	83 c2 31             	add    $0x31,%edx
+    118f:	39 d1                	cmp    %edx,%ecx
+    1191:	75 5d                	jne    11f0 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    1193:	83 c0 01             	add    $0x1,%eax
+    1196:	39 c3                	cmp    %eax,%ebx
+    1198:	75 e6                	jne    1180 <fourfiles+0xc0>
+      total += n;
+    119a:	01 df                	add    %ebx,%edi
+    119c:	eb ba                	jmp    1158 <fourfiles+0x98>
+    close(fd);
+    119e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    11a1:	83 ec 0c             	sub    $0xc,%esp
+    11a4:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    11a7:	51                   	push   %ecx
+    11a8:	e8 7b 2c 00 00       	call   3e28 <close>
+    if(total != 12*500){
+    11ad:	83 c4 10             	add    $0x10,%esp
+    11b0:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    11b6:	0f 85 d0 00 00 00    	jne    128c <fourfiles+0x1cc>
+    unlink(fname);
+    11bc:	83 ec 0c             	sub    $0xc,%esp
+    11bf:	53                   	push   %ebx
+    11c0:	e8 8b 2c 00 00       	call   3e50 <unlink>
+  for(i = 0; i < 2; i++){
+    11c5:	83 c4 10             	add    $0x10,%esp
+    11c8:	85 f6                	test   %esi,%esi
+    11ca:	75 0a                	jne    11d6 <fourfiles+0x116>
+    11cc:	be 01 00 00 00       	mov    $0x1,%esi
+    11d1:	e9 61 ff ff ff       	jmp    1137 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    11d6:	83 ec 08             	sub    $0x8,%esp
+    11d9:	68 82 47 00 00       	push   $0x4782
+    11de:	6a 01                	push   $0x1
+    11e0:	e8 cb 2d 00 00       	call   3fb0 <printf>
+}
+    11e5:	83 c4 10             	add    $0x10,%esp
+    11e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11eb:	5b                   	pop    %ebx
+    11ec:	5e                   	pop    %esi
+    11ed:	5f                   	pop    %edi
+    11ee:	5d                   	pop    %ebp
+    11ef:	c3                   	ret
+          printf(1, "wrong char\n");
+    11f0:	83 ec 08             	sub    $0x8,%esp
+    11f3:	68 65 47 00 00       	push   $0x4765
+    11f8:	6a 01                	push   $0x1
+    11fa:	e8 b1 2d 00 00       	call   3fb0 <printf>
+          exit();
+    11ff:	e8 fc 2b 00 00       	call   3e00 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    1204:	83 ec 08             	sub    $0x8,%esp
+    1207:	68 02 02 00 00       	push   $0x202
+    120c:	56                   	push   %esi
+    120d:	e8 2e 2c 00 00       	call   3e40 <open>
+      if(fd < 0){
+    1212:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    1215:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    1217:	85 c0                	test   %eax,%eax
+    1219:	78 45                	js     1260 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    121b:	83 ec 04             	sub    $0x4,%esp
+    121e:	83 c3 30             	add    $0x30,%ebx
+    1221:	68 00 02 00 00       	push   $0x200
+    1226:	53                   	push   %ebx
+    1227:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    122c:	68 e0 8d 00 00       	push   $0x8de0
+    1231:	e8 ca 29 00 00       	call   3c00 <memset>
+    1236:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    1239:	83 ec 04             	sub    $0x4,%esp
+    123c:	68 f4 01 00 00       	push   $0x1f4
+    1241:	68 e0 8d 00 00       	push   $0x8de0
+    1246:	56                   	push   %esi
+    1247:	e8 d4 2b 00 00       	call   3e20 <write>
+    124c:	83 c4 10             	add    $0x10,%esp
+    124f:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    1254:	75 49                	jne    129f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    1256:	83 eb 01             	sub    $0x1,%ebx
+    1259:	75 de                	jne    1239 <fourfiles+0x179>
+      exit();
+    125b:	e8 a0 2b 00 00       	call   3e00 <exit>
+        printf(1, "create failed\n");
+    1260:	51                   	push   %ecx
+    1261:	51                   	push   %ecx
+    1262:	68 df 49 00 00       	push   $0x49df
+    1267:	6a 01                	push   $0x1
+    1269:	e8 42 2d 00 00       	call   3fb0 <printf>
+        exit();
+    126e:	e8 8d 2b 00 00       	call   3e00 <exit>
+    1273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1277:	90                   	nop
+      printf(1, "fork failed\n");
+    1278:	83 ec 08             	sub    $0x8,%esp
+    127b:	68 bf 52 00 00       	push   $0x52bf
+    1280:	6a 01                	push   $0x1
+    1282:	e8 29 2d 00 00       	call   3fb0 <printf>
+      exit();
+    1287:	e8 74 2b 00 00       	call   3e00 <exit>
+      printf(1, "wrong length %d\n", total);
+    128c:	50                   	push   %eax
+    128d:	57                   	push   %edi
+    128e:	68 71 47 00 00       	push   $0x4771
+    1293:	6a 01                	push   $0x1
+    1295:	e8 16 2d 00 00       	call   3fb0 <printf>
+      exit();
+    129a:	e8 61 2b 00 00       	call   3e00 <exit>
+          printf(1, "write failed %d\n", n);
+    129f:	52                   	push   %edx
+    12a0:	50                   	push   %eax
+    12a1:	68 54 47 00 00       	push   $0x4754
+    12a6:	6a 01                	push   $0x1
+    12a8:	e8 03 2d 00 00       	call   3fb0 <printf>
+          exit();
+    12ad:	e8 4e 2b 00 00       	call   3e00 <exit>
+    12b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000012c0 <createdelete>:
+{
+    12c0:	55                   	push   %ebp
+    12c1:	89 e5                	mov    %esp,%ebp
+    12c3:	57                   	push   %edi
+    12c4:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    12c5:	31 f6                	xor    %esi,%esi
+{
+    12c7:	53                   	push   %ebx
+    12c8:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    12cb:	68 90 47 00 00       	push   $0x4790
+    12d0:	6a 01                	push   $0x1
+    12d2:	e8 d9 2c 00 00       	call   3fb0 <printf>
+    12d7:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    12da:	e8 19 2b 00 00       	call   3df8 <fork>
+    12df:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    12e1:	85 c0                	test   %eax,%eax
+    12e3:	0f 88 ac 01 00 00    	js     1495 <createdelete+0x1d5>
+    if(pid == 0){
+    12e9:	0f 84 01 01 00 00    	je     13f0 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    12ef:	83 c6 01             	add    $0x1,%esi
+    12f2:	83 fe 04             	cmp    $0x4,%esi
+    12f5:	75 e3                	jne    12da <createdelete+0x1a>
+    wait();
+    12f7:	e8 0c 2b 00 00       	call   3e08 <wait>
+  for(i = 0; i < N; i++){
+    12fc:	31 ff                	xor    %edi,%edi
+    12fe:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    1301:	e8 02 2b 00 00       	call   3e08 <wait>
+    1306:	e8 fd 2a 00 00       	call   3e08 <wait>
+    130b:	e8 f8 2a 00 00       	call   3e08 <wait>
+  name[0] = name[1] = name[2] = 0;
+    1310:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    1314:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    1318:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    131a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    131d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    1322:	0f 94 c2             	sete   %dl
+    1325:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    1328:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    132b:	0f 9f c0             	setg   %al
+    132e:	09 c2                	or     %eax,%edx
+    1330:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    1333:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    1337:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    133a:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    133d:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    1340:	6a 00                	push   $0x0
+    1342:	56                   	push   %esi
+    1343:	e8 f8 2a 00 00       	call   3e40 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    1348:	83 c4 10             	add    $0x10,%esp
+    134b:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    134f:	74 7f                	je     13d0 <createdelete+0x110>
+    1351:	85 c0                	test   %eax,%eax
+    1353:	0f 88 27 01 00 00    	js     1480 <createdelete+0x1c0>
+        close(fd);
+    1359:	83 ec 0c             	sub    $0xc,%esp
+    135c:	50                   	push   %eax
+    135d:	e8 c6 2a 00 00       	call   3e28 <close>
+    1362:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    1365:	83 c3 01             	add    $0x1,%ebx
+    1368:	80 fb 74             	cmp    $0x74,%bl
+    136b:	75 c6                	jne    1333 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    136d:	83 c7 01             	add    $0x1,%edi
+    1370:	83 ff 14             	cmp    $0x14,%edi
+    1373:	75 a3                	jne    1318 <createdelete+0x58>
+    1375:	bf 70 00 00 00       	mov    $0x70,%edi
+    137a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    1380:	8d 47 c0             	lea    -0x40(%edi),%eax
+    1383:	bb 04 00 00 00       	mov    $0x4,%ebx
+    1388:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    138b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    138d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    1390:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1393:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1397:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    139a:	56                   	push   %esi
+    139b:	e8 b0 2a 00 00       	call   3e50 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    13a0:	83 c4 10             	add    $0x10,%esp
+    13a3:	83 eb 01             	sub    $0x1,%ebx
+    13a6:	75 e3                	jne    138b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    13a8:	83 c7 01             	add    $0x1,%edi
+    13ab:	89 f8                	mov    %edi,%eax
+    13ad:	3c 84                	cmp    $0x84,%al
+    13af:	75 cf                	jne    1380 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    13b1:	83 ec 08             	sub    $0x8,%esp
+    13b4:	68 a3 47 00 00       	push   $0x47a3
+    13b9:	6a 01                	push   $0x1
+    13bb:	e8 f0 2b 00 00       	call   3fb0 <printf>
+}
+    13c0:	83 c4 10             	add    $0x10,%esp
+    13c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13c6:	5b                   	pop    %ebx
+    13c7:	5e                   	pop    %esi
+    13c8:	5f                   	pop    %edi
+    13c9:	5d                   	pop    %ebp
+    13ca:	c3                   	ret
+    13cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13cf:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    13d0:	85 c0                	test   %eax,%eax
+    13d2:	78 91                	js     1365 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    13d4:	50                   	push   %eax
+    13d5:	56                   	push   %esi
+    13d6:	68 18 55 00 00       	push   $0x5518
+    13db:	6a 01                	push   $0x1
+    13dd:	e8 ce 2b 00 00       	call   3fb0 <printf>
+        exit();
+    13e2:	e8 19 2a 00 00       	call   3e00 <exit>
+    13e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    13ee:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    13f0:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    13f3:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    13f7:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    13fa:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    13fd:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    1400:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    1403:	8d 43 30             	lea    0x30(%ebx),%eax
+    1406:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1409:	68 02 02 00 00       	push   $0x202
+    140e:	56                   	push   %esi
+    140f:	e8 2c 2a 00 00       	call   3e40 <open>
+        if(fd < 0){
+    1414:	83 c4 10             	add    $0x10,%esp
+    1417:	85 c0                	test   %eax,%eax
+    1419:	0f 88 8a 00 00 00    	js     14a9 <createdelete+0x1e9>
+        close(fd);
+    141f:	83 ec 0c             	sub    $0xc,%esp
+    1422:	50                   	push   %eax
+    1423:	e8 00 2a 00 00       	call   3e28 <close>
+        if(i > 0 && (i % 2 ) == 0){
+    1428:	83 c4 10             	add    $0x10,%esp
+    142b:	85 db                	test   %ebx,%ebx
+    142d:	74 19                	je     1448 <createdelete+0x188>
+    142f:	f6 c3 01             	test   $0x1,%bl
+    1432:	74 1b                	je     144f <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    1434:	83 c3 01             	add    $0x1,%ebx
+    1437:	83 fb 14             	cmp    $0x14,%ebx
+    143a:	75 c4                	jne    1400 <createdelete+0x140>
+      exit();
+    143c:	e8 bf 29 00 00       	call   3e00 <exit>
+    1441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    1448:	bb 01 00 00 00       	mov    $0x1,%ebx
+    144d:	eb b1                	jmp    1400 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    144f:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    1451:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    1454:	d1 f8                	sar    %eax
+    1456:	83 c0 30             	add    $0x30,%eax
+    1459:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    145c:	56                   	push   %esi
+    145d:	e8 ee 29 00 00       	call   3e50 <unlink>
+    1462:	83 c4 10             	add    $0x10,%esp
+    1465:	85 c0                	test   %eax,%eax
+    1467:	79 cb                	jns    1434 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    1469:	52                   	push   %edx
+    146a:	52                   	push   %edx
+    146b:	68 91 43 00 00       	push   $0x4391
+    1470:	6a 01                	push   $0x1
+    1472:	e8 39 2b 00 00       	call   3fb0 <printf>
+            exit();
+    1477:	e8 84 29 00 00       	call   3e00 <exit>
+    147c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1480:	83 ec 04             	sub    $0x4,%esp
+    1483:	56                   	push   %esi
+    1484:	68 f4 54 00 00       	push   $0x54f4
+    1489:	6a 01                	push   $0x1
+    148b:	e8 20 2b 00 00       	call   3fb0 <printf>
+        exit();
+    1490:	e8 6b 29 00 00       	call   3e00 <exit>
+      printf(1, "fork failed\n");
+    1495:	83 ec 08             	sub    $0x8,%esp
+    1498:	68 bf 52 00 00       	push   $0x52bf
+    149d:	6a 01                	push   $0x1
+    149f:	e8 0c 2b 00 00       	call   3fb0 <printf>
+      exit();
+    14a4:	e8 57 29 00 00       	call   3e00 <exit>
+          printf(1, "create failed\n");
+    14a9:	83 ec 08             	sub    $0x8,%esp
+    14ac:	68 df 49 00 00       	push   $0x49df
+    14b1:	6a 01                	push   $0x1
+    14b3:	e8 f8 2a 00 00       	call   3fb0 <printf>
+          exit();
+    14b8:	e8 43 29 00 00       	call   3e00 <exit>
+    14bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000014c0 <unlinkread>:
+{
+    14c0:	55                   	push   %ebp
+    14c1:	89 e5                	mov    %esp,%ebp
+    14c3:	56                   	push   %esi
+    14c4:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    14c5:	83 ec 08             	sub    $0x8,%esp
+    14c8:	68 b4 47 00 00       	push   $0x47b4
+    14cd:	6a 01                	push   $0x1
+    14cf:	e8 dc 2a 00 00       	call   3fb0 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    14d4:	5b                   	pop    %ebx
+    14d5:	5e                   	pop    %esi
+    14d6:	68 02 02 00 00       	push   $0x202
+    14db:	68 c5 47 00 00       	push   $0x47c5
+    14e0:	e8 5b 29 00 00       	call   3e40 <open>
+  if(fd < 0){
+    14e5:	83 c4 10             	add    $0x10,%esp
+    14e8:	85 c0                	test   %eax,%eax
+    14ea:	0f 88 e6 00 00 00    	js     15d6 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    14f0:	83 ec 04             	sub    $0x4,%esp
+    14f3:	89 c3                	mov    %eax,%ebx
+    14f5:	6a 05                	push   $0x5
+    14f7:	68 ea 47 00 00       	push   $0x47ea
+    14fc:	50                   	push   %eax
+    14fd:	e8 1e 29 00 00       	call   3e20 <write>
+  close(fd);
+    1502:	89 1c 24             	mov    %ebx,(%esp)
+    1505:	e8 1e 29 00 00       	call   3e28 <close>
+  fd = open("unlinkread", O_RDWR);
+    150a:	58                   	pop    %eax
+    150b:	5a                   	pop    %edx
+    150c:	6a 02                	push   $0x2
+    150e:	68 c5 47 00 00       	push   $0x47c5
+    1513:	e8 28 29 00 00       	call   3e40 <open>
+  if(fd < 0){
+    1518:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    151b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    151d:	85 c0                	test   %eax,%eax
+    151f:	0f 88 10 01 00 00    	js     1635 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    1525:	83 ec 0c             	sub    $0xc,%esp
+    1528:	68 c5 47 00 00       	push   $0x47c5
+    152d:	e8 1e 29 00 00       	call   3e50 <unlink>
+    1532:	83 c4 10             	add    $0x10,%esp
+    1535:	85 c0                	test   %eax,%eax
+    1537:	0f 85 e5 00 00 00    	jne    1622 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    153d:	83 ec 08             	sub    $0x8,%esp
+    1540:	68 02 02 00 00       	push   $0x202
+    1545:	68 c5 47 00 00       	push   $0x47c5
+    154a:	e8 f1 28 00 00       	call   3e40 <open>
+  write(fd1, "yyy", 3);
+    154f:	83 c4 0c             	add    $0xc,%esp
+    1552:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1554:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    1556:	68 22 48 00 00       	push   $0x4822
+    155b:	50                   	push   %eax
+    155c:	e8 bf 28 00 00       	call   3e20 <write>
+  close(fd1);
+    1561:	89 34 24             	mov    %esi,(%esp)
+    1564:	e8 bf 28 00 00       	call   3e28 <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1569:	83 c4 0c             	add    $0xc,%esp
+    156c:	68 00 20 00 00       	push   $0x2000
+    1571:	68 e0 8d 00 00       	push   $0x8de0
+    1576:	53                   	push   %ebx
+    1577:	e8 9c 28 00 00       	call   3e18 <read>
+    157c:	83 c4 10             	add    $0x10,%esp
+    157f:	83 f8 05             	cmp    $0x5,%eax
+    1582:	0f 85 87 00 00 00    	jne    160f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    1588:	80 3d e0 8d 00 00 68 	cmpb   $0x68,0x8de0
+    158f:	75 6b                	jne    15fc <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    1591:	83 ec 04             	sub    $0x4,%esp
+    1594:	6a 0a                	push   $0xa
+    1596:	68 e0 8d 00 00       	push   $0x8de0
+    159b:	53                   	push   %ebx
+    159c:	e8 7f 28 00 00       	call   3e20 <write>
+    15a1:	83 c4 10             	add    $0x10,%esp
+    15a4:	83 f8 0a             	cmp    $0xa,%eax
+    15a7:	75 40                	jne    15e9 <unlinkread+0x129>
+  close(fd);
+    15a9:	83 ec 0c             	sub    $0xc,%esp
+    15ac:	53                   	push   %ebx
+    15ad:	e8 76 28 00 00       	call   3e28 <close>
+  unlink("unlinkread");
+    15b2:	c7 04 24 c5 47 00 00 	movl   $0x47c5,(%esp)
+    15b9:	e8 92 28 00 00       	call   3e50 <unlink>
+  printf(1, "unlinkread ok\n");
+    15be:	58                   	pop    %eax
+    15bf:	5a                   	pop    %edx
+    15c0:	68 6d 48 00 00       	push   $0x486d
+    15c5:	6a 01                	push   $0x1
+    15c7:	e8 e4 29 00 00       	call   3fb0 <printf>
+}
+    15cc:	83 c4 10             	add    $0x10,%esp
+    15cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    15d2:	5b                   	pop    %ebx
+    15d3:	5e                   	pop    %esi
+    15d4:	5d                   	pop    %ebp
+    15d5:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    15d6:	51                   	push   %ecx
+    15d7:	51                   	push   %ecx
+    15d8:	68 d0 47 00 00       	push   $0x47d0
+    15dd:	6a 01                	push   $0x1
+    15df:	e8 cc 29 00 00       	call   3fb0 <printf>
+    exit();
+    15e4:	e8 17 28 00 00       	call   3e00 <exit>
+    printf(1, "unlinkread write failed\n");
+    15e9:	51                   	push   %ecx
+    15ea:	51                   	push   %ecx
+    15eb:	68 54 48 00 00       	push   $0x4854
+    15f0:	6a 01                	push   $0x1
+    15f2:	e8 b9 29 00 00       	call   3fb0 <printf>
+    exit();
+    15f7:	e8 04 28 00 00       	call   3e00 <exit>
+    printf(1, "unlinkread wrong data\n");
+    15fc:	53                   	push   %ebx
+    15fd:	53                   	push   %ebx
+    15fe:	68 3d 48 00 00       	push   $0x483d
+    1603:	6a 01                	push   $0x1
+    1605:	e8 a6 29 00 00       	call   3fb0 <printf>
+    exit();
+    160a:	e8 f1 27 00 00       	call   3e00 <exit>
+    printf(1, "unlinkread read failed");
+    160f:	56                   	push   %esi
+    1610:	56                   	push   %esi
+    1611:	68 26 48 00 00       	push   $0x4826
+    1616:	6a 01                	push   $0x1
+    1618:	e8 93 29 00 00       	call   3fb0 <printf>
+    exit();
+    161d:	e8 de 27 00 00       	call   3e00 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1622:	50                   	push   %eax
+    1623:	50                   	push   %eax
+    1624:	68 08 48 00 00       	push   $0x4808
+    1629:	6a 01                	push   $0x1
+    162b:	e8 80 29 00 00       	call   3fb0 <printf>
+    exit();
+    1630:	e8 cb 27 00 00       	call   3e00 <exit>
+    printf(1, "open unlinkread failed\n");
+    1635:	50                   	push   %eax
+    1636:	50                   	push   %eax
+    1637:	68 f0 47 00 00       	push   $0x47f0
+    163c:	6a 01                	push   $0x1
+    163e:	e8 6d 29 00 00       	call   3fb0 <printf>
+    exit();
+    1643:	e8 b8 27 00 00       	call   3e00 <exit>
+    1648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    164f:	90                   	nop
+
+00001650 <linktest>:
+{
+    1650:	55                   	push   %ebp
+    1651:	89 e5                	mov    %esp,%ebp
+    1653:	53                   	push   %ebx
+    1654:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    1657:	68 7c 48 00 00       	push   $0x487c
+    165c:	6a 01                	push   $0x1
+    165e:	e8 4d 29 00 00       	call   3fb0 <printf>
+  unlink("lf1");
+    1663:	c7 04 24 86 48 00 00 	movl   $0x4886,(%esp)
+    166a:	e8 e1 27 00 00       	call   3e50 <unlink>
+  unlink("lf2");
+    166f:	c7 04 24 8a 48 00 00 	movl   $0x488a,(%esp)
+    1676:	e8 d5 27 00 00       	call   3e50 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    167b:	58                   	pop    %eax
+    167c:	5a                   	pop    %edx
+    167d:	68 02 02 00 00       	push   $0x202
+    1682:	68 86 48 00 00       	push   $0x4886
+    1687:	e8 b4 27 00 00       	call   3e40 <open>
+  if(fd < 0){
+    168c:	83 c4 10             	add    $0x10,%esp
+    168f:	85 c0                	test   %eax,%eax
+    1691:	0f 88 1e 01 00 00    	js     17b5 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    1697:	83 ec 04             	sub    $0x4,%esp
+    169a:	89 c3                	mov    %eax,%ebx
+    169c:	6a 05                	push   $0x5
+    169e:	68 ea 47 00 00       	push   $0x47ea
+    16a3:	50                   	push   %eax
+    16a4:	e8 77 27 00 00       	call   3e20 <write>
+    16a9:	83 c4 10             	add    $0x10,%esp
+    16ac:	83 f8 05             	cmp    $0x5,%eax
+    16af:	0f 85 98 01 00 00    	jne    184d <linktest+0x1fd>
+  close(fd);
+    16b5:	83 ec 0c             	sub    $0xc,%esp
+    16b8:	53                   	push   %ebx
+    16b9:	e8 6a 27 00 00       	call   3e28 <close>
+  if(link("lf1", "lf2") < 0){
+    16be:	5b                   	pop    %ebx
+    16bf:	58                   	pop    %eax
+    16c0:	68 8a 48 00 00       	push   $0x488a
+    16c5:	68 86 48 00 00       	push   $0x4886
+    16ca:	e8 91 27 00 00       	call   3e60 <link>
+    16cf:	83 c4 10             	add    $0x10,%esp
+    16d2:	85 c0                	test   %eax,%eax
+    16d4:	0f 88 60 01 00 00    	js     183a <linktest+0x1ea>
+  unlink("lf1");
+    16da:	83 ec 0c             	sub    $0xc,%esp
+    16dd:	68 86 48 00 00       	push   $0x4886
+    16e2:	e8 69 27 00 00       	call   3e50 <unlink>
+  if(open("lf1", 0) >= 0){
+    16e7:	58                   	pop    %eax
+    16e8:	5a                   	pop    %edx
+    16e9:	6a 00                	push   $0x0
+    16eb:	68 86 48 00 00       	push   $0x4886
+    16f0:	e8 4b 27 00 00       	call   3e40 <open>
+    16f5:	83 c4 10             	add    $0x10,%esp
+    16f8:	85 c0                	test   %eax,%eax
+    16fa:	0f 89 27 01 00 00    	jns    1827 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    1700:	83 ec 08             	sub    $0x8,%esp
+    1703:	6a 00                	push   $0x0
+    1705:	68 8a 48 00 00       	push   $0x488a
+    170a:	e8 31 27 00 00       	call   3e40 <open>
+  if(fd < 0){
+    170f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    1712:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1714:	85 c0                	test   %eax,%eax
+    1716:	0f 88 f8 00 00 00    	js     1814 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    171c:	83 ec 04             	sub    $0x4,%esp
+    171f:	68 00 20 00 00       	push   $0x2000
+    1724:	68 e0 8d 00 00       	push   $0x8de0
+    1729:	50                   	push   %eax
+    172a:	e8 e9 26 00 00       	call   3e18 <read>
+    172f:	83 c4 10             	add    $0x10,%esp
+    1732:	83 f8 05             	cmp    $0x5,%eax
+    1735:	0f 85 c6 00 00 00    	jne    1801 <linktest+0x1b1>
+  close(fd);
+    173b:	83 ec 0c             	sub    $0xc,%esp
+    173e:	53                   	push   %ebx
+    173f:	e8 e4 26 00 00       	call   3e28 <close>
+  if(link("lf2", "lf2") >= 0){
+    1744:	58                   	pop    %eax
+    1745:	5a                   	pop    %edx
+    1746:	68 8a 48 00 00       	push   $0x488a
+    174b:	68 8a 48 00 00       	push   $0x488a
+    1750:	e8 0b 27 00 00       	call   3e60 <link>
+    1755:	83 c4 10             	add    $0x10,%esp
+    1758:	85 c0                	test   %eax,%eax
+    175a:	0f 89 8e 00 00 00    	jns    17ee <linktest+0x19e>
+  unlink("lf2");
+    1760:	83 ec 0c             	sub    $0xc,%esp
+    1763:	68 8a 48 00 00       	push   $0x488a
+    1768:	e8 e3 26 00 00       	call   3e50 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    176d:	59                   	pop    %ecx
+    176e:	5b                   	pop    %ebx
+    176f:	68 86 48 00 00       	push   $0x4886
+    1774:	68 8a 48 00 00       	push   $0x488a
+    1779:	e8 e2 26 00 00       	call   3e60 <link>
+    177e:	83 c4 10             	add    $0x10,%esp
+    1781:	85 c0                	test   %eax,%eax
+    1783:	79 56                	jns    17db <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    1785:	83 ec 08             	sub    $0x8,%esp
+    1788:	68 86 48 00 00       	push   $0x4886
+    178d:	68 4e 4b 00 00       	push   $0x4b4e
+    1792:	e8 c9 26 00 00       	call   3e60 <link>
+    1797:	83 c4 10             	add    $0x10,%esp
+    179a:	85 c0                	test   %eax,%eax
+    179c:	79 2a                	jns    17c8 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    179e:	83 ec 08             	sub    $0x8,%esp
+    17a1:	68 24 49 00 00       	push   $0x4924
+    17a6:	6a 01                	push   $0x1
+    17a8:	e8 03 28 00 00       	call   3fb0 <printf>
+}
+    17ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    17b0:	83 c4 10             	add    $0x10,%esp
+    17b3:	c9                   	leave
+    17b4:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    17b5:	50                   	push   %eax
+    17b6:	50                   	push   %eax
+    17b7:	68 8e 48 00 00       	push   $0x488e
+    17bc:	6a 01                	push   $0x1
+    17be:	e8 ed 27 00 00       	call   3fb0 <printf>
+    exit();
+    17c3:	e8 38 26 00 00       	call   3e00 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    17c8:	50                   	push   %eax
+    17c9:	50                   	push   %eax
+    17ca:	68 08 49 00 00       	push   $0x4908
+    17cf:	6a 01                	push   $0x1
+    17d1:	e8 da 27 00 00       	call   3fb0 <printf>
+    exit();
+    17d6:	e8 25 26 00 00       	call   3e00 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    17db:	52                   	push   %edx
+    17dc:	52                   	push   %edx
+    17dd:	68 60 55 00 00       	push   $0x5560
+    17e2:	6a 01                	push   $0x1
+    17e4:	e8 c7 27 00 00       	call   3fb0 <printf>
+    exit();
+    17e9:	e8 12 26 00 00       	call   3e00 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    17ee:	50                   	push   %eax
+    17ef:	50                   	push   %eax
+    17f0:	68 ea 48 00 00       	push   $0x48ea
+    17f5:	6a 01                	push   $0x1
+    17f7:	e8 b4 27 00 00       	call   3fb0 <printf>
+    exit();
+    17fc:	e8 ff 25 00 00       	call   3e00 <exit>
+    printf(1, "read lf2 failed\n");
+    1801:	51                   	push   %ecx
+    1802:	51                   	push   %ecx
+    1803:	68 d9 48 00 00       	push   $0x48d9
+    1808:	6a 01                	push   $0x1
+    180a:	e8 a1 27 00 00       	call   3fb0 <printf>
+    exit();
+    180f:	e8 ec 25 00 00       	call   3e00 <exit>
+    printf(1, "open lf2 failed\n");
+    1814:	53                   	push   %ebx
+    1815:	53                   	push   %ebx
+    1816:	68 c8 48 00 00       	push   $0x48c8
+    181b:	6a 01                	push   $0x1
+    181d:	e8 8e 27 00 00       	call   3fb0 <printf>
+    exit();
+    1822:	e8 d9 25 00 00       	call   3e00 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1827:	50                   	push   %eax
+    1828:	50                   	push   %eax
+    1829:	68 38 55 00 00       	push   $0x5538
+    182e:	6a 01                	push   $0x1
+    1830:	e8 7b 27 00 00       	call   3fb0 <printf>
+    exit();
+    1835:	e8 c6 25 00 00       	call   3e00 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    183a:	51                   	push   %ecx
+    183b:	51                   	push   %ecx
+    183c:	68 b3 48 00 00       	push   $0x48b3
+    1841:	6a 01                	push   $0x1
+    1843:	e8 68 27 00 00       	call   3fb0 <printf>
+    exit();
+    1848:	e8 b3 25 00 00       	call   3e00 <exit>
+    printf(1, "write lf1 failed\n");
+    184d:	50                   	push   %eax
+    184e:	50                   	push   %eax
+    184f:	68 a1 48 00 00       	push   $0x48a1
+    1854:	6a 01                	push   $0x1
+    1856:	e8 55 27 00 00       	call   3fb0 <printf>
+    exit();
+    185b:	e8 a0 25 00 00       	call   3e00 <exit>
+
+00001860 <concreate>:
+{
+    1860:	55                   	push   %ebp
+    1861:	89 e5                	mov    %esp,%ebp
+    1863:	57                   	push   %edi
+    1864:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    1865:	31 f6                	xor    %esi,%esi
+{
+    1867:	53                   	push   %ebx
+    1868:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    186b:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    186e:	68 31 49 00 00       	push   $0x4931
+    1873:	6a 01                	push   $0x1
+    1875:	e8 36 27 00 00       	call   3fb0 <printf>
+  file[0] = 'C';
+    187a:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    187e:	83 c4 10             	add    $0x10,%esp
+    1881:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    1885:	eb 4c                	jmp    18d3 <concreate+0x73>
+    1887:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    188e:	66 90                	xchg   %ax,%ax
+    1890:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    1896:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    189b:	0f 83 8f 00 00 00    	jae    1930 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    18a1:	83 ec 08             	sub    $0x8,%esp
+    18a4:	68 02 02 00 00       	push   $0x202
+    18a9:	53                   	push   %ebx
+    18aa:	e8 91 25 00 00       	call   3e40 <open>
+      if(fd < 0){
+    18af:	83 c4 10             	add    $0x10,%esp
+    18b2:	85 c0                	test   %eax,%eax
+    18b4:	78 63                	js     1919 <concreate+0xb9>
+      close(fd);
+    18b6:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    18b9:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    18bc:	50                   	push   %eax
+    18bd:	e8 66 25 00 00       	call   3e28 <close>
+    18c2:	83 c4 10             	add    $0x10,%esp
+      wait();
+    18c5:	e8 3e 25 00 00       	call   3e08 <wait>
+  for(i = 0; i < 40; i++){
+    18ca:	83 fe 28             	cmp    $0x28,%esi
+    18cd:	0f 84 7f 00 00 00    	je     1952 <concreate+0xf2>
+    unlink(file);
+    18d3:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    18d6:	8d 46 30             	lea    0x30(%esi),%eax
+    18d9:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    18dc:	53                   	push   %ebx
+    18dd:	e8 6e 25 00 00       	call   3e50 <unlink>
+    pid = fork();
+    18e2:	e8 11 25 00 00       	call   3df8 <fork>
+    if(pid && (i % 3) == 1){
+    18e7:	83 c4 10             	add    $0x10,%esp
+    18ea:	85 c0                	test   %eax,%eax
+    18ec:	75 a2                	jne    1890 <concreate+0x30>
+      link("C0", file);
+    18ee:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    18f4:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    18fa:	0f 83 d0 00 00 00    	jae    19d0 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    1900:	83 ec 08             	sub    $0x8,%esp
+    1903:	68 02 02 00 00       	push   $0x202
+    1908:	53                   	push   %ebx
+    1909:	e8 32 25 00 00       	call   3e40 <open>
+      if(fd < 0){
+    190e:	83 c4 10             	add    $0x10,%esp
+    1911:	85 c0                	test   %eax,%eax
+    1913:	0f 89 ea 01 00 00    	jns    1b03 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    1919:	83 ec 04             	sub    $0x4,%esp
+    191c:	53                   	push   %ebx
+    191d:	68 44 49 00 00       	push   $0x4944
+    1922:	6a 01                	push   $0x1
+    1924:	e8 87 26 00 00       	call   3fb0 <printf>
+        exit();
+    1929:	e8 d2 24 00 00       	call   3e00 <exit>
+    192e:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    1930:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    1933:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    1936:	53                   	push   %ebx
+    1937:	68 41 49 00 00       	push   $0x4941
+    193c:	e8 1f 25 00 00       	call   3e60 <link>
+    1941:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1944:	e8 bf 24 00 00       	call   3e08 <wait>
+  for(i = 0; i < 40; i++){
+    1949:	83 fe 28             	cmp    $0x28,%esi
+    194c:	0f 85 81 ff ff ff    	jne    18d3 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    1952:	83 ec 04             	sub    $0x4,%esp
+    1955:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    1958:	6a 28                	push   $0x28
+    195a:	6a 00                	push   $0x0
+    195c:	50                   	push   %eax
+    195d:	e8 9e 22 00 00       	call   3c00 <memset>
+  fd = open(".", 0);
+    1962:	5e                   	pop    %esi
+    1963:	5f                   	pop    %edi
+    1964:	6a 00                	push   $0x0
+    1966:	68 4e 4b 00 00       	push   $0x4b4e
+    196b:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    196e:	e8 cd 24 00 00       	call   3e40 <open>
+  n = 0;
+    1973:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    197a:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    197d:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    197f:	90                   	nop
+    1980:	83 ec 04             	sub    $0x4,%esp
+    1983:	6a 10                	push   $0x10
+    1985:	57                   	push   %edi
+    1986:	56                   	push   %esi
+    1987:	e8 8c 24 00 00       	call   3e18 <read>
+    198c:	83 c4 10             	add    $0x10,%esp
+    198f:	85 c0                	test   %eax,%eax
+    1991:	7e 5d                	jle    19f0 <concreate+0x190>
+    if(de.inum == 0)
+    1993:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    1998:	74 e6                	je     1980 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    199a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    199e:	75 e0                	jne    1980 <concreate+0x120>
+    19a0:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    19a4:	75 da                	jne    1980 <concreate+0x120>
+      i = de.name[1] - '0';
+    19a6:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    19aa:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    19ad:	83 f8 27             	cmp    $0x27,%eax
+    19b0:	0f 87 5e 01 00 00    	ja     1b14 <concreate+0x2b4>
+      if(fa[i]){
+    19b6:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    19bb:	0f 85 7e 01 00 00    	jne    1b3f <concreate+0x2df>
+      n++;
+    19c1:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    19c5:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    19ca:	eb b4                	jmp    1980 <concreate+0x120>
+    19cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    19d0:	83 ec 08             	sub    $0x8,%esp
+    19d3:	53                   	push   %ebx
+    19d4:	68 41 49 00 00       	push   $0x4941
+    19d9:	e8 82 24 00 00       	call   3e60 <link>
+    19de:	83 c4 10             	add    $0x10,%esp
+      exit();
+    19e1:	e8 1a 24 00 00       	call   3e00 <exit>
+    19e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    19ed:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    19f0:	83 ec 0c             	sub    $0xc,%esp
+    19f3:	56                   	push   %esi
+    19f4:	e8 2f 24 00 00       	call   3e28 <close>
+  if(n != 40){
+    19f9:	83 c4 10             	add    $0x10,%esp
+    19fc:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    1a00:	0f 85 26 01 00 00    	jne    1b2c <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    1a06:	31 f6                	xor    %esi,%esi
+    1a08:	eb 48                	jmp    1a52 <concreate+0x1f2>
+    1a0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    1a10:	85 ff                	test   %edi,%edi
+    1a12:	74 05                	je     1a19 <concreate+0x1b9>
+    1a14:	83 f8 01             	cmp    $0x1,%eax
+    1a17:	74 68                	je     1a81 <concreate+0x221>
+      unlink(file);
+    1a19:	83 ec 0c             	sub    $0xc,%esp
+    1a1c:	53                   	push   %ebx
+    1a1d:	e8 2e 24 00 00       	call   3e50 <unlink>
+      unlink(file);
+    1a22:	89 1c 24             	mov    %ebx,(%esp)
+    1a25:	e8 26 24 00 00       	call   3e50 <unlink>
+      unlink(file);
+    1a2a:	89 1c 24             	mov    %ebx,(%esp)
+    1a2d:	e8 1e 24 00 00       	call   3e50 <unlink>
+      unlink(file);
+    1a32:	89 1c 24             	mov    %ebx,(%esp)
+    1a35:	e8 16 24 00 00       	call   3e50 <unlink>
+    1a3a:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    1a3d:	85 ff                	test   %edi,%edi
+    1a3f:	74 a0                	je     19e1 <concreate+0x181>
+      wait();
+    1a41:	e8 c2 23 00 00       	call   3e08 <wait>
+  for(i = 0; i < 40; i++){
+    1a46:	83 c6 01             	add    $0x1,%esi
+    1a49:	83 fe 28             	cmp    $0x28,%esi
+    1a4c:	0f 84 86 00 00 00    	je     1ad8 <concreate+0x278>
+    file[1] = '0' + i;
+    1a52:	8d 46 30             	lea    0x30(%esi),%eax
+    1a55:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    1a58:	e8 9b 23 00 00       	call   3df8 <fork>
+    1a5d:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    1a5f:	85 c0                	test   %eax,%eax
+    1a61:	0f 88 88 00 00 00    	js     1aef <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    1a67:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    1a6c:	f7 e6                	mul    %esi
+    1a6e:	89 d0                	mov    %edx,%eax
+    1a70:	83 e2 fe             	and    $0xfffffffe,%edx
+    1a73:	d1 e8                	shr    %eax
+    1a75:	01 c2                	add    %eax,%edx
+    1a77:	89 f0                	mov    %esi,%eax
+    1a79:	29 d0                	sub    %edx,%eax
+    1a7b:	89 c1                	mov    %eax,%ecx
+    1a7d:	09 f9                	or     %edi,%ecx
+    1a7f:	75 8f                	jne    1a10 <concreate+0x1b0>
+      close(open(file, 0));
+    1a81:	83 ec 08             	sub    $0x8,%esp
+    1a84:	6a 00                	push   $0x0
+    1a86:	53                   	push   %ebx
+    1a87:	e8 b4 23 00 00       	call   3e40 <open>
+    1a8c:	89 04 24             	mov    %eax,(%esp)
+    1a8f:	e8 94 23 00 00       	call   3e28 <close>
+      close(open(file, 0));
+    1a94:	58                   	pop    %eax
+    1a95:	5a                   	pop    %edx
+    1a96:	6a 00                	push   $0x0
+    1a98:	53                   	push   %ebx
+    1a99:	e8 a2 23 00 00       	call   3e40 <open>
+    1a9e:	89 04 24             	mov    %eax,(%esp)
+    1aa1:	e8 82 23 00 00       	call   3e28 <close>
+      close(open(file, 0));
+    1aa6:	59                   	pop    %ecx
+    1aa7:	58                   	pop    %eax
+    1aa8:	6a 00                	push   $0x0
+    1aaa:	53                   	push   %ebx
+    1aab:	e8 90 23 00 00       	call   3e40 <open>
+    1ab0:	89 04 24             	mov    %eax,(%esp)
+    1ab3:	e8 70 23 00 00       	call   3e28 <close>
+      close(open(file, 0));
+    1ab8:	58                   	pop    %eax
+    1ab9:	5a                   	pop    %edx
+    1aba:	6a 00                	push   $0x0
+    1abc:	53                   	push   %ebx
+    1abd:	e8 7e 23 00 00       	call   3e40 <open>
+    1ac2:	89 04 24             	mov    %eax,(%esp)
+    1ac5:	e8 5e 23 00 00       	call   3e28 <close>
+    1aca:	83 c4 10             	add    $0x10,%esp
+    1acd:	e9 6b ff ff ff       	jmp    1a3d <concreate+0x1dd>
+    1ad2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1ad8:	83 ec 08             	sub    $0x8,%esp
+    1adb:	68 96 49 00 00       	push   $0x4996
+    1ae0:	6a 01                	push   $0x1
+    1ae2:	e8 c9 24 00 00       	call   3fb0 <printf>
+}
+    1ae7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1aea:	5b                   	pop    %ebx
+    1aeb:	5e                   	pop    %esi
+    1aec:	5f                   	pop    %edi
+    1aed:	5d                   	pop    %ebp
+    1aee:	c3                   	ret
+      printf(1, "fork failed\n");
+    1aef:	83 ec 08             	sub    $0x8,%esp
+    1af2:	68 bf 52 00 00       	push   $0x52bf
+    1af7:	6a 01                	push   $0x1
+    1af9:	e8 b2 24 00 00       	call   3fb0 <printf>
+      exit();
+    1afe:	e8 fd 22 00 00       	call   3e00 <exit>
+      close(fd);
+    1b03:	83 ec 0c             	sub    $0xc,%esp
+    1b06:	50                   	push   %eax
+    1b07:	e8 1c 23 00 00       	call   3e28 <close>
+    1b0c:	83 c4 10             	add    $0x10,%esp
+    1b0f:	e9 cd fe ff ff       	jmp    19e1 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    1b14:	83 ec 04             	sub    $0x4,%esp
+    1b17:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1b1a:	50                   	push   %eax
+    1b1b:	68 60 49 00 00       	push   $0x4960
+    1b20:	6a 01                	push   $0x1
+    1b22:	e8 89 24 00 00       	call   3fb0 <printf>
+        exit();
+    1b27:	e8 d4 22 00 00       	call   3e00 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    1b2c:	51                   	push   %ecx
+    1b2d:	51                   	push   %ecx
+    1b2e:	68 84 55 00 00       	push   $0x5584
+    1b33:	6a 01                	push   $0x1
+    1b35:	e8 76 24 00 00       	call   3fb0 <printf>
+    exit();
+    1b3a:	e8 c1 22 00 00       	call   3e00 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1b3f:	83 ec 04             	sub    $0x4,%esp
+    1b42:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1b45:	50                   	push   %eax
+    1b46:	68 79 49 00 00       	push   $0x4979
+    1b4b:	6a 01                	push   $0x1
+    1b4d:	e8 5e 24 00 00       	call   3fb0 <printf>
+        exit();
+    1b52:	e8 a9 22 00 00       	call   3e00 <exit>
+    1b57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1b5e:	66 90                	xchg   %ax,%ax
+
+00001b60 <linkunlink>:
+{
+    1b60:	55                   	push   %ebp
+    1b61:	89 e5                	mov    %esp,%ebp
+    1b63:	57                   	push   %edi
+    1b64:	56                   	push   %esi
+    1b65:	53                   	push   %ebx
+    1b66:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    1b69:	68 a4 49 00 00       	push   $0x49a4
+    1b6e:	6a 01                	push   $0x1
+    1b70:	e8 3b 24 00 00       	call   3fb0 <printf>
+  unlink("x");
+    1b75:	c7 04 24 31 4c 00 00 	movl   $0x4c31,(%esp)
+    1b7c:	e8 cf 22 00 00       	call   3e50 <unlink>
+  pid = fork();
+    1b81:	e8 72 22 00 00       	call   3df8 <fork>
+  if(pid < 0){
+    1b86:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1b89:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    1b8c:	85 c0                	test   %eax,%eax
+    1b8e:	0f 88 b6 00 00 00    	js     1c4a <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    1b94:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    1b98:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    1b9d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    1ba2:	19 ff                	sbb    %edi,%edi
+    1ba4:	83 e7 60             	and    $0x60,%edi
+    1ba7:	83 c7 01             	add    $0x1,%edi
+    1baa:	eb 1e                	jmp    1bca <linkunlink+0x6a>
+    1bac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    1bb0:	83 f8 01             	cmp    $0x1,%eax
+    1bb3:	74 7b                	je     1c30 <linkunlink+0xd0>
+      unlink("x");
+    1bb5:	83 ec 0c             	sub    $0xc,%esp
+    1bb8:	68 31 4c 00 00       	push   $0x4c31
+    1bbd:	e8 8e 22 00 00       	call   3e50 <unlink>
+    1bc2:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1bc5:	83 eb 01             	sub    $0x1,%ebx
+    1bc8:	74 41                	je     1c0b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    1bca:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    1bd0:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    1bd6:	89 f8                	mov    %edi,%eax
+    1bd8:	f7 e6                	mul    %esi
+    1bda:	89 d0                	mov    %edx,%eax
+    1bdc:	83 e2 fe             	and    $0xfffffffe,%edx
+    1bdf:	d1 e8                	shr    %eax
+    1be1:	01 c2                	add    %eax,%edx
+    1be3:	89 f8                	mov    %edi,%eax
+    1be5:	29 d0                	sub    %edx,%eax
+    1be7:	75 c7                	jne    1bb0 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    1be9:	83 ec 08             	sub    $0x8,%esp
+    1bec:	68 02 02 00 00       	push   $0x202
+    1bf1:	68 31 4c 00 00       	push   $0x4c31
+    1bf6:	e8 45 22 00 00       	call   3e40 <open>
+    1bfb:	89 04 24             	mov    %eax,(%esp)
+    1bfe:	e8 25 22 00 00       	call   3e28 <close>
+    1c03:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1c06:	83 eb 01             	sub    $0x1,%ebx
+    1c09:	75 bf                	jne    1bca <linkunlink+0x6a>
+  if(pid)
+    1c0b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1c0e:	85 c0                	test   %eax,%eax
+    1c10:	74 4b                	je     1c5d <linkunlink+0xfd>
+    wait();
+    1c12:	e8 f1 21 00 00       	call   3e08 <wait>
+  printf(1, "linkunlink ok\n");
+    1c17:	83 ec 08             	sub    $0x8,%esp
+    1c1a:	68 b9 49 00 00       	push   $0x49b9
+    1c1f:	6a 01                	push   $0x1
+    1c21:	e8 8a 23 00 00       	call   3fb0 <printf>
+}
+    1c26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c29:	5b                   	pop    %ebx
+    1c2a:	5e                   	pop    %esi
+    1c2b:	5f                   	pop    %edi
+    1c2c:	5d                   	pop    %ebp
+    1c2d:	c3                   	ret
+    1c2e:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    1c30:	83 ec 08             	sub    $0x8,%esp
+    1c33:	68 31 4c 00 00       	push   $0x4c31
+    1c38:	68 b5 49 00 00       	push   $0x49b5
+    1c3d:	e8 1e 22 00 00       	call   3e60 <link>
+    1c42:	83 c4 10             	add    $0x10,%esp
+    1c45:	e9 7b ff ff ff       	jmp    1bc5 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    1c4a:	52                   	push   %edx
+    1c4b:	52                   	push   %edx
+    1c4c:	68 bf 52 00 00       	push   $0x52bf
+    1c51:	6a 01                	push   $0x1
+    1c53:	e8 58 23 00 00       	call   3fb0 <printf>
+    exit();
+    1c58:	e8 a3 21 00 00       	call   3e00 <exit>
+    exit();
+    1c5d:	e8 9e 21 00 00       	call   3e00 <exit>
+    1c62:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1c69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001c70 <bigdir>:
+{
+    1c70:	55                   	push   %ebp
+    1c71:	89 e5                	mov    %esp,%ebp
+    1c73:	57                   	push   %edi
+    1c74:	56                   	push   %esi
+    1c75:	53                   	push   %ebx
+    1c76:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    1c79:	68 c8 49 00 00       	push   $0x49c8
+    1c7e:	6a 01                	push   $0x1
+    1c80:	e8 2b 23 00 00       	call   3fb0 <printf>
+  unlink("bd");
+    1c85:	c7 04 24 d5 49 00 00 	movl   $0x49d5,(%esp)
+    1c8c:	e8 bf 21 00 00       	call   3e50 <unlink>
+  fd = open("bd", O_CREATE);
+    1c91:	5a                   	pop    %edx
+    1c92:	59                   	pop    %ecx
+    1c93:	68 00 02 00 00       	push   $0x200
+    1c98:	68 d5 49 00 00       	push   $0x49d5
+    1c9d:	e8 9e 21 00 00       	call   3e40 <open>
+  if(fd < 0){
+    1ca2:	83 c4 10             	add    $0x10,%esp
+    1ca5:	85 c0                	test   %eax,%eax
+    1ca7:	0f 88 de 00 00 00    	js     1d8b <bigdir+0x11b>
+  close(fd);
+    1cad:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    1cb0:	31 f6                	xor    %esi,%esi
+    1cb2:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    1cb5:	50                   	push   %eax
+    1cb6:	e8 6d 21 00 00       	call   3e28 <close>
+    1cbb:	83 c4 10             	add    $0x10,%esp
+    1cbe:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    1cc0:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    1cc2:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    1cc5:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1cc9:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1ccc:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1cd0:	83 c0 30             	add    $0x30,%eax
+    1cd3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1cd6:	89 f0                	mov    %esi,%eax
+    1cd8:	83 e0 3f             	and    $0x3f,%eax
+    1cdb:	83 c0 30             	add    $0x30,%eax
+    1cde:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    1ce1:	57                   	push   %edi
+    1ce2:	68 d5 49 00 00       	push   $0x49d5
+    1ce7:	e8 74 21 00 00       	call   3e60 <link>
+    1cec:	83 c4 10             	add    $0x10,%esp
+    1cef:	89 c3                	mov    %eax,%ebx
+    1cf1:	85 c0                	test   %eax,%eax
+    1cf3:	75 6e                	jne    1d63 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    1cf5:	83 c6 01             	add    $0x1,%esi
+    1cf8:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1cfe:	75 c0                	jne    1cc0 <bigdir+0x50>
+  unlink("bd");
+    1d00:	83 ec 0c             	sub    $0xc,%esp
+    1d03:	68 d5 49 00 00       	push   $0x49d5
+    1d08:	e8 43 21 00 00       	call   3e50 <unlink>
+    1d0d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    1d10:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    1d12:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    1d15:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1d19:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1d1c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1d20:	83 c0 30             	add    $0x30,%eax
+    1d23:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1d26:	89 d8                	mov    %ebx,%eax
+    1d28:	83 e0 3f             	and    $0x3f,%eax
+    1d2b:	83 c0 30             	add    $0x30,%eax
+    1d2e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    1d31:	57                   	push   %edi
+    1d32:	e8 19 21 00 00       	call   3e50 <unlink>
+    1d37:	83 c4 10             	add    $0x10,%esp
+    1d3a:	85 c0                	test   %eax,%eax
+    1d3c:	75 39                	jne    1d77 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    1d3e:	83 c3 01             	add    $0x1,%ebx
+    1d41:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1d47:	75 c7                	jne    1d10 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    1d49:	83 ec 08             	sub    $0x8,%esp
+    1d4c:	68 17 4a 00 00       	push   $0x4a17
+    1d51:	6a 01                	push   $0x1
+    1d53:	e8 58 22 00 00       	call   3fb0 <printf>
+    1d58:	83 c4 10             	add    $0x10,%esp
+}
+    1d5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1d5e:	5b                   	pop    %ebx
+    1d5f:	5e                   	pop    %esi
+    1d60:	5f                   	pop    %edi
+    1d61:	5d                   	pop    %ebp
+    1d62:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    1d63:	83 ec 08             	sub    $0x8,%esp
+    1d66:	68 ee 49 00 00       	push   $0x49ee
+    1d6b:	6a 01                	push   $0x1
+    1d6d:	e8 3e 22 00 00       	call   3fb0 <printf>
+      exit();
+    1d72:	e8 89 20 00 00       	call   3e00 <exit>
+      printf(1, "bigdir unlink failed");
+    1d77:	83 ec 08             	sub    $0x8,%esp
+    1d7a:	68 02 4a 00 00       	push   $0x4a02
+    1d7f:	6a 01                	push   $0x1
+    1d81:	e8 2a 22 00 00       	call   3fb0 <printf>
+      exit();
+    1d86:	e8 75 20 00 00       	call   3e00 <exit>
+    printf(1, "bigdir create failed\n");
+    1d8b:	50                   	push   %eax
+    1d8c:	50                   	push   %eax
+    1d8d:	68 d8 49 00 00       	push   $0x49d8
+    1d92:	6a 01                	push   $0x1
+    1d94:	e8 17 22 00 00       	call   3fb0 <printf>
+    exit();
+    1d99:	e8 62 20 00 00       	call   3e00 <exit>
+    1d9e:	66 90                	xchg   %ax,%ax
+
+00001da0 <subdir>:
+{
+    1da0:	55                   	push   %ebp
+    1da1:	89 e5                	mov    %esp,%ebp
+    1da3:	53                   	push   %ebx
+    1da4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    1da7:	68 22 4a 00 00       	push   $0x4a22
+    1dac:	6a 01                	push   $0x1
+    1dae:	e8 fd 21 00 00       	call   3fb0 <printf>
+  unlink("ff");
+    1db3:	c7 04 24 ab 4a 00 00 	movl   $0x4aab,(%esp)
+    1dba:	e8 91 20 00 00       	call   3e50 <unlink>
+  if(mkdir("dd") != 0){
+    1dbf:	c7 04 24 48 4b 00 00 	movl   $0x4b48,(%esp)
+    1dc6:	e8 9d 20 00 00       	call   3e68 <mkdir>
+    1dcb:	83 c4 10             	add    $0x10,%esp
+    1dce:	85 c0                	test   %eax,%eax
+    1dd0:	0f 85 b3 05 00 00    	jne    2389 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1dd6:	83 ec 08             	sub    $0x8,%esp
+    1dd9:	68 02 02 00 00       	push   $0x202
+    1dde:	68 81 4a 00 00       	push   $0x4a81
+    1de3:	e8 58 20 00 00       	call   3e40 <open>
+  if(fd < 0){
+    1de8:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    1deb:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1ded:	85 c0                	test   %eax,%eax
+    1def:	0f 88 81 05 00 00    	js     2376 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    1df5:	83 ec 04             	sub    $0x4,%esp
+    1df8:	6a 02                	push   $0x2
+    1dfa:	68 ab 4a 00 00       	push   $0x4aab
+    1dff:	50                   	push   %eax
+    1e00:	e8 1b 20 00 00       	call   3e20 <write>
+  close(fd);
+    1e05:	89 1c 24             	mov    %ebx,(%esp)
+    1e08:	e8 1b 20 00 00       	call   3e28 <close>
+  if(unlink("dd") >= 0){
+    1e0d:	c7 04 24 48 4b 00 00 	movl   $0x4b48,(%esp)
+    1e14:	e8 37 20 00 00       	call   3e50 <unlink>
+    1e19:	83 c4 10             	add    $0x10,%esp
+    1e1c:	85 c0                	test   %eax,%eax
+    1e1e:	0f 89 3f 05 00 00    	jns    2363 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    1e24:	83 ec 0c             	sub    $0xc,%esp
+    1e27:	68 5c 4a 00 00       	push   $0x4a5c
+    1e2c:	e8 37 20 00 00       	call   3e68 <mkdir>
+    1e31:	83 c4 10             	add    $0x10,%esp
+    1e34:	85 c0                	test   %eax,%eax
+    1e36:	0f 85 14 05 00 00    	jne    2350 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1e3c:	83 ec 08             	sub    $0x8,%esp
+    1e3f:	68 02 02 00 00       	push   $0x202
+    1e44:	68 7e 4a 00 00       	push   $0x4a7e
+    1e49:	e8 f2 1f 00 00       	call   3e40 <open>
+  if(fd < 0){
+    1e4e:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1e51:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1e53:	85 c0                	test   %eax,%eax
+    1e55:	0f 88 24 04 00 00    	js     227f <subdir+0x4df>
+  write(fd, "FF", 2);
+    1e5b:	83 ec 04             	sub    $0x4,%esp
+    1e5e:	6a 02                	push   $0x2
+    1e60:	68 9f 4a 00 00       	push   $0x4a9f
+    1e65:	50                   	push   %eax
+    1e66:	e8 b5 1f 00 00       	call   3e20 <write>
+  close(fd);
+    1e6b:	89 1c 24             	mov    %ebx,(%esp)
+    1e6e:	e8 b5 1f 00 00       	call   3e28 <close>
+  fd = open("dd/dd/../ff", 0);
+    1e73:	58                   	pop    %eax
+    1e74:	5a                   	pop    %edx
+    1e75:	6a 00                	push   $0x0
+    1e77:	68 a2 4a 00 00       	push   $0x4aa2
+    1e7c:	e8 bf 1f 00 00       	call   3e40 <open>
+  if(fd < 0){
+    1e81:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    1e84:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1e86:	85 c0                	test   %eax,%eax
+    1e88:	0f 88 de 03 00 00    	js     226c <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    1e8e:	83 ec 04             	sub    $0x4,%esp
+    1e91:	68 00 20 00 00       	push   $0x2000
+    1e96:	68 e0 8d 00 00       	push   $0x8de0
+    1e9b:	50                   	push   %eax
+    1e9c:	e8 77 1f 00 00       	call   3e18 <read>
+  if(cc != 2 || buf[0] != 'f'){
+    1ea1:	83 c4 10             	add    $0x10,%esp
+    1ea4:	83 f8 02             	cmp    $0x2,%eax
+    1ea7:	0f 85 3a 03 00 00    	jne    21e7 <subdir+0x447>
+    1ead:	80 3d e0 8d 00 00 66 	cmpb   $0x66,0x8de0
+    1eb4:	0f 85 2d 03 00 00    	jne    21e7 <subdir+0x447>
+  close(fd);
+    1eba:	83 ec 0c             	sub    $0xc,%esp
+    1ebd:	53                   	push   %ebx
+    1ebe:	e8 65 1f 00 00       	call   3e28 <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    1ec3:	59                   	pop    %ecx
+    1ec4:	5b                   	pop    %ebx
+    1ec5:	68 e2 4a 00 00       	push   $0x4ae2
+    1eca:	68 7e 4a 00 00       	push   $0x4a7e
+    1ecf:	e8 8c 1f 00 00       	call   3e60 <link>
+    1ed4:	83 c4 10             	add    $0x10,%esp
+    1ed7:	85 c0                	test   %eax,%eax
+    1ed9:	0f 85 c6 03 00 00    	jne    22a5 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    1edf:	83 ec 0c             	sub    $0xc,%esp
+    1ee2:	68 7e 4a 00 00       	push   $0x4a7e
+    1ee7:	e8 64 1f 00 00       	call   3e50 <unlink>
+    1eec:	83 c4 10             	add    $0x10,%esp
+    1eef:	85 c0                	test   %eax,%eax
+    1ef1:	0f 85 16 03 00 00    	jne    220d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1ef7:	83 ec 08             	sub    $0x8,%esp
+    1efa:	6a 00                	push   $0x0
+    1efc:	68 7e 4a 00 00       	push   $0x4a7e
+    1f01:	e8 3a 1f 00 00       	call   3e40 <open>
+    1f06:	83 c4 10             	add    $0x10,%esp
+    1f09:	85 c0                	test   %eax,%eax
+    1f0b:	0f 89 2c 04 00 00    	jns    233d <subdir+0x59d>
+  if(chdir("dd") != 0){
+    1f11:	83 ec 0c             	sub    $0xc,%esp
+    1f14:	68 48 4b 00 00       	push   $0x4b48
+    1f19:	e8 52 1f 00 00       	call   3e70 <chdir>
+    1f1e:	83 c4 10             	add    $0x10,%esp
+    1f21:	85 c0                	test   %eax,%eax
+    1f23:	0f 85 01 04 00 00    	jne    232a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    1f29:	83 ec 0c             	sub    $0xc,%esp
+    1f2c:	68 16 4b 00 00       	push   $0x4b16
+    1f31:	e8 3a 1f 00 00       	call   3e70 <chdir>
+    1f36:	83 c4 10             	add    $0x10,%esp
+    1f39:	85 c0                	test   %eax,%eax
+    1f3b:	0f 85 b9 02 00 00    	jne    21fa <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    1f41:	83 ec 0c             	sub    $0xc,%esp
+    1f44:	68 3c 4b 00 00       	push   $0x4b3c
+    1f49:	e8 22 1f 00 00       	call   3e70 <chdir>
+    1f4e:	83 c4 10             	add    $0x10,%esp
+    1f51:	85 c0                	test   %eax,%eax
+    1f53:	0f 85 a1 02 00 00    	jne    21fa <subdir+0x45a>
+  if(chdir("./..") != 0){
+    1f59:	83 ec 0c             	sub    $0xc,%esp
+    1f5c:	68 4b 4b 00 00       	push   $0x4b4b
+    1f61:	e8 0a 1f 00 00       	call   3e70 <chdir>
+    1f66:	83 c4 10             	add    $0x10,%esp
+    1f69:	85 c0                	test   %eax,%eax
+    1f6b:	0f 85 21 03 00 00    	jne    2292 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    1f71:	83 ec 08             	sub    $0x8,%esp
+    1f74:	6a 00                	push   $0x0
+    1f76:	68 e2 4a 00 00       	push   $0x4ae2
+    1f7b:	e8 c0 1e 00 00       	call   3e40 <open>
+  if(fd < 0){
+    1f80:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    1f83:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1f85:	85 c0                	test   %eax,%eax
+    1f87:	0f 88 e0 04 00 00    	js     246d <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    1f8d:	83 ec 04             	sub    $0x4,%esp
+    1f90:	68 00 20 00 00       	push   $0x2000
+    1f95:	68 e0 8d 00 00       	push   $0x8de0
+    1f9a:	50                   	push   %eax
+    1f9b:	e8 78 1e 00 00       	call   3e18 <read>
+    1fa0:	83 c4 10             	add    $0x10,%esp
+    1fa3:	83 f8 02             	cmp    $0x2,%eax
+    1fa6:	0f 85 ae 04 00 00    	jne    245a <subdir+0x6ba>
+  close(fd);
+    1fac:	83 ec 0c             	sub    $0xc,%esp
+    1faf:	53                   	push   %ebx
+    1fb0:	e8 73 1e 00 00       	call   3e28 <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    1fb5:	58                   	pop    %eax
+    1fb6:	5a                   	pop    %edx
+    1fb7:	6a 00                	push   $0x0
+    1fb9:	68 7e 4a 00 00       	push   $0x4a7e
+    1fbe:	e8 7d 1e 00 00       	call   3e40 <open>
+    1fc3:	83 c4 10             	add    $0x10,%esp
+    1fc6:	85 c0                	test   %eax,%eax
+    1fc8:	0f 89 65 02 00 00    	jns    2233 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    1fce:	83 ec 08             	sub    $0x8,%esp
+    1fd1:	68 02 02 00 00       	push   $0x202
+    1fd6:	68 96 4b 00 00       	push   $0x4b96
+    1fdb:	e8 60 1e 00 00       	call   3e40 <open>
+    1fe0:	83 c4 10             	add    $0x10,%esp
+    1fe3:	85 c0                	test   %eax,%eax
+    1fe5:	0f 89 35 02 00 00    	jns    2220 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    1feb:	83 ec 08             	sub    $0x8,%esp
+    1fee:	68 02 02 00 00       	push   $0x202
+    1ff3:	68 bb 4b 00 00       	push   $0x4bbb
+    1ff8:	e8 43 1e 00 00       	call   3e40 <open>
+    1ffd:	83 c4 10             	add    $0x10,%esp
+    2000:	85 c0                	test   %eax,%eax
+    2002:	0f 89 0f 03 00 00    	jns    2317 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    2008:	83 ec 08             	sub    $0x8,%esp
+    200b:	68 00 02 00 00       	push   $0x200
+    2010:	68 48 4b 00 00       	push   $0x4b48
+    2015:	e8 26 1e 00 00       	call   3e40 <open>
+    201a:	83 c4 10             	add    $0x10,%esp
+    201d:	85 c0                	test   %eax,%eax
+    201f:	0f 89 df 02 00 00    	jns    2304 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    2025:	83 ec 08             	sub    $0x8,%esp
+    2028:	6a 02                	push   $0x2
+    202a:	68 48 4b 00 00       	push   $0x4b48
+    202f:	e8 0c 1e 00 00       	call   3e40 <open>
+    2034:	83 c4 10             	add    $0x10,%esp
+    2037:	85 c0                	test   %eax,%eax
+    2039:	0f 89 b2 02 00 00    	jns    22f1 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    203f:	83 ec 08             	sub    $0x8,%esp
+    2042:	6a 01                	push   $0x1
+    2044:	68 48 4b 00 00       	push   $0x4b48
+    2049:	e8 f2 1d 00 00       	call   3e40 <open>
+    204e:	83 c4 10             	add    $0x10,%esp
+    2051:	85 c0                	test   %eax,%eax
+    2053:	0f 89 85 02 00 00    	jns    22de <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    2059:	83 ec 08             	sub    $0x8,%esp
+    205c:	68 2a 4c 00 00       	push   $0x4c2a
+    2061:	68 96 4b 00 00       	push   $0x4b96
+    2066:	e8 f5 1d 00 00       	call   3e60 <link>
+    206b:	83 c4 10             	add    $0x10,%esp
+    206e:	85 c0                	test   %eax,%eax
+    2070:	0f 84 55 02 00 00    	je     22cb <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2076:	83 ec 08             	sub    $0x8,%esp
+    2079:	68 2a 4c 00 00       	push   $0x4c2a
+    207e:	68 bb 4b 00 00       	push   $0x4bbb
+    2083:	e8 d8 1d 00 00       	call   3e60 <link>
+    2088:	83 c4 10             	add    $0x10,%esp
+    208b:	85 c0                	test   %eax,%eax
+    208d:	0f 84 25 02 00 00    	je     22b8 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2093:	83 ec 08             	sub    $0x8,%esp
+    2096:	68 e2 4a 00 00       	push   $0x4ae2
+    209b:	68 81 4a 00 00       	push   $0x4a81
+    20a0:	e8 bb 1d 00 00       	call   3e60 <link>
+    20a5:	83 c4 10             	add    $0x10,%esp
+    20a8:	85 c0                	test   %eax,%eax
+    20aa:	0f 84 a9 01 00 00    	je     2259 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    20b0:	83 ec 0c             	sub    $0xc,%esp
+    20b3:	68 96 4b 00 00       	push   $0x4b96
+    20b8:	e8 ab 1d 00 00       	call   3e68 <mkdir>
+    20bd:	83 c4 10             	add    $0x10,%esp
+    20c0:	85 c0                	test   %eax,%eax
+    20c2:	0f 84 7e 01 00 00    	je     2246 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    20c8:	83 ec 0c             	sub    $0xc,%esp
+    20cb:	68 bb 4b 00 00       	push   $0x4bbb
+    20d0:	e8 93 1d 00 00       	call   3e68 <mkdir>
+    20d5:	83 c4 10             	add    $0x10,%esp
+    20d8:	85 c0                	test   %eax,%eax
+    20da:	0f 84 67 03 00 00    	je     2447 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    20e0:	83 ec 0c             	sub    $0xc,%esp
+    20e3:	68 e2 4a 00 00       	push   $0x4ae2
+    20e8:	e8 7b 1d 00 00       	call   3e68 <mkdir>
+    20ed:	83 c4 10             	add    $0x10,%esp
+    20f0:	85 c0                	test   %eax,%eax
+    20f2:	0f 84 3c 03 00 00    	je     2434 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    20f8:	83 ec 0c             	sub    $0xc,%esp
+    20fb:	68 bb 4b 00 00       	push   $0x4bbb
+    2100:	e8 4b 1d 00 00       	call   3e50 <unlink>
+    2105:	83 c4 10             	add    $0x10,%esp
+    2108:	85 c0                	test   %eax,%eax
+    210a:	0f 84 11 03 00 00    	je     2421 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    2110:	83 ec 0c             	sub    $0xc,%esp
+    2113:	68 96 4b 00 00       	push   $0x4b96
+    2118:	e8 33 1d 00 00       	call   3e50 <unlink>
+    211d:	83 c4 10             	add    $0x10,%esp
+    2120:	85 c0                	test   %eax,%eax
+    2122:	0f 84 e6 02 00 00    	je     240e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    2128:	83 ec 0c             	sub    $0xc,%esp
+    212b:	68 81 4a 00 00       	push   $0x4a81
+    2130:	e8 3b 1d 00 00       	call   3e70 <chdir>
+    2135:	83 c4 10             	add    $0x10,%esp
+    2138:	85 c0                	test   %eax,%eax
+    213a:	0f 84 bb 02 00 00    	je     23fb <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    2140:	83 ec 0c             	sub    $0xc,%esp
+    2143:	68 2d 4c 00 00       	push   $0x4c2d
+    2148:	e8 23 1d 00 00       	call   3e70 <chdir>
+    214d:	83 c4 10             	add    $0x10,%esp
+    2150:	85 c0                	test   %eax,%eax
+    2152:	0f 84 90 02 00 00    	je     23e8 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    2158:	83 ec 0c             	sub    $0xc,%esp
+    215b:	68 e2 4a 00 00       	push   $0x4ae2
+    2160:	e8 eb 1c 00 00       	call   3e50 <unlink>
+    2165:	83 c4 10             	add    $0x10,%esp
+    2168:	85 c0                	test   %eax,%eax
+    216a:	0f 85 9d 00 00 00    	jne    220d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    2170:	83 ec 0c             	sub    $0xc,%esp
+    2173:	68 81 4a 00 00       	push   $0x4a81
+    2178:	e8 d3 1c 00 00       	call   3e50 <unlink>
+    217d:	83 c4 10             	add    $0x10,%esp
+    2180:	85 c0                	test   %eax,%eax
+    2182:	0f 85 4d 02 00 00    	jne    23d5 <subdir+0x635>
+  if(unlink("dd") == 0){
+    2188:	83 ec 0c             	sub    $0xc,%esp
+    218b:	68 48 4b 00 00       	push   $0x4b48
+    2190:	e8 bb 1c 00 00       	call   3e50 <unlink>
+    2195:	83 c4 10             	add    $0x10,%esp
+    2198:	85 c0                	test   %eax,%eax
+    219a:	0f 84 22 02 00 00    	je     23c2 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    21a0:	83 ec 0c             	sub    $0xc,%esp
+    21a3:	68 5d 4a 00 00       	push   $0x4a5d
+    21a8:	e8 a3 1c 00 00       	call   3e50 <unlink>
+    21ad:	83 c4 10             	add    $0x10,%esp
+    21b0:	85 c0                	test   %eax,%eax
+    21b2:	0f 88 f7 01 00 00    	js     23af <subdir+0x60f>
+  if(unlink("dd") < 0){
+    21b8:	83 ec 0c             	sub    $0xc,%esp
+    21bb:	68 48 4b 00 00       	push   $0x4b48
+    21c0:	e8 8b 1c 00 00       	call   3e50 <unlink>
+    21c5:	83 c4 10             	add    $0x10,%esp
+    21c8:	85 c0                	test   %eax,%eax
+    21ca:	0f 88 cc 01 00 00    	js     239c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    21d0:	83 ec 08             	sub    $0x8,%esp
+    21d3:	68 2a 4d 00 00       	push   $0x4d2a
+    21d8:	6a 01                	push   $0x1
+    21da:	e8 d1 1d 00 00       	call   3fb0 <printf>
+}
+    21df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    21e2:	83 c4 10             	add    $0x10,%esp
+    21e5:	c9                   	leave
+    21e6:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    21e7:	50                   	push   %eax
+    21e8:	50                   	push   %eax
+    21e9:	68 c7 4a 00 00       	push   $0x4ac7
+    21ee:	6a 01                	push   $0x1
+    21f0:	e8 bb 1d 00 00       	call   3fb0 <printf>
+    exit();
+    21f5:	e8 06 1c 00 00       	call   3e00 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    21fa:	50                   	push   %eax
+    21fb:	50                   	push   %eax
+    21fc:	68 22 4b 00 00       	push   $0x4b22
+    2201:	6a 01                	push   $0x1
+    2203:	e8 a8 1d 00 00       	call   3fb0 <printf>
+    exit();
+    2208:	e8 f3 1b 00 00       	call   3e00 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    220d:	50                   	push   %eax
+    220e:	50                   	push   %eax
+    220f:	68 ed 4a 00 00       	push   $0x4aed
+    2214:	6a 01                	push   $0x1
+    2216:	e8 95 1d 00 00       	call   3fb0 <printf>
+    exit();
+    221b:	e8 e0 1b 00 00       	call   3e00 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2220:	51                   	push   %ecx
+    2221:	51                   	push   %ecx
+    2222:	68 9f 4b 00 00       	push   $0x4b9f
+    2227:	6a 01                	push   $0x1
+    2229:	e8 82 1d 00 00       	call   3fb0 <printf>
+    exit();
+    222e:	e8 cd 1b 00 00       	call   3e00 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2233:	53                   	push   %ebx
+    2234:	53                   	push   %ebx
+    2235:	68 28 56 00 00       	push   $0x5628
+    223a:	6a 01                	push   $0x1
+    223c:	e8 6f 1d 00 00       	call   3fb0 <printf>
+    exit();
+    2241:	e8 ba 1b 00 00       	call   3e00 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    2246:	51                   	push   %ecx
+    2247:	51                   	push   %ecx
+    2248:	68 33 4c 00 00       	push   $0x4c33
+    224d:	6a 01                	push   $0x1
+    224f:	e8 5c 1d 00 00       	call   3fb0 <printf>
+    exit();
+    2254:	e8 a7 1b 00 00       	call   3e00 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    2259:	53                   	push   %ebx
+    225a:	53                   	push   %ebx
+    225b:	68 98 56 00 00       	push   $0x5698
+    2260:	6a 01                	push   $0x1
+    2262:	e8 49 1d 00 00       	call   3fb0 <printf>
+    exit();
+    2267:	e8 94 1b 00 00       	call   3e00 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    226c:	50                   	push   %eax
+    226d:	50                   	push   %eax
+    226e:	68 ae 4a 00 00       	push   $0x4aae
+    2273:	6a 01                	push   $0x1
+    2275:	e8 36 1d 00 00       	call   3fb0 <printf>
+    exit();
+    227a:	e8 81 1b 00 00       	call   3e00 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    227f:	51                   	push   %ecx
+    2280:	51                   	push   %ecx
+    2281:	68 87 4a 00 00       	push   $0x4a87
+    2286:	6a 01                	push   $0x1
+    2288:	e8 23 1d 00 00       	call   3fb0 <printf>
+    exit();
+    228d:	e8 6e 1b 00 00       	call   3e00 <exit>
+    printf(1, "chdir ./.. failed\n");
+    2292:	50                   	push   %eax
+    2293:	50                   	push   %eax
+    2294:	68 50 4b 00 00       	push   $0x4b50
+    2299:	6a 01                	push   $0x1
+    229b:	e8 10 1d 00 00       	call   3fb0 <printf>
+    exit();
+    22a0:	e8 5b 1b 00 00       	call   3e00 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    22a5:	52                   	push   %edx
+    22a6:	52                   	push   %edx
+    22a7:	68 e0 55 00 00       	push   $0x55e0
+    22ac:	6a 01                	push   $0x1
+    22ae:	e8 fd 1c 00 00       	call   3fb0 <printf>
+    exit();
+    22b3:	e8 48 1b 00 00       	call   3e00 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    22b8:	50                   	push   %eax
+    22b9:	50                   	push   %eax
+    22ba:	68 74 56 00 00       	push   $0x5674
+    22bf:	6a 01                	push   $0x1
+    22c1:	e8 ea 1c 00 00       	call   3fb0 <printf>
+    exit();
+    22c6:	e8 35 1b 00 00       	call   3e00 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    22cb:	50                   	push   %eax
+    22cc:	50                   	push   %eax
+    22cd:	68 50 56 00 00       	push   $0x5650
+    22d2:	6a 01                	push   $0x1
+    22d4:	e8 d7 1c 00 00       	call   3fb0 <printf>
+    exit();
+    22d9:	e8 22 1b 00 00       	call   3e00 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    22de:	50                   	push   %eax
+    22df:	50                   	push   %eax
+    22e0:	68 0f 4c 00 00       	push   $0x4c0f
+    22e5:	6a 01                	push   $0x1
+    22e7:	e8 c4 1c 00 00       	call   3fb0 <printf>
+    exit();
+    22ec:	e8 0f 1b 00 00       	call   3e00 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    22f1:	50                   	push   %eax
+    22f2:	50                   	push   %eax
+    22f3:	68 f6 4b 00 00       	push   $0x4bf6
+    22f8:	6a 01                	push   $0x1
+    22fa:	e8 b1 1c 00 00       	call   3fb0 <printf>
+    exit();
+    22ff:	e8 fc 1a 00 00       	call   3e00 <exit>
+    printf(1, "create dd succeeded!\n");
+    2304:	50                   	push   %eax
+    2305:	50                   	push   %eax
+    2306:	68 e0 4b 00 00       	push   $0x4be0
+    230b:	6a 01                	push   $0x1
+    230d:	e8 9e 1c 00 00       	call   3fb0 <printf>
+    exit();
+    2312:	e8 e9 1a 00 00       	call   3e00 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2317:	52                   	push   %edx
+    2318:	52                   	push   %edx
+    2319:	68 c4 4b 00 00       	push   $0x4bc4
+    231e:	6a 01                	push   $0x1
+    2320:	e8 8b 1c 00 00       	call   3fb0 <printf>
+    exit();
+    2325:	e8 d6 1a 00 00       	call   3e00 <exit>
+    printf(1, "chdir dd failed\n");
+    232a:	50                   	push   %eax
+    232b:	50                   	push   %eax
+    232c:	68 05 4b 00 00       	push   $0x4b05
+    2331:	6a 01                	push   $0x1
+    2333:	e8 78 1c 00 00       	call   3fb0 <printf>
+    exit();
+    2338:	e8 c3 1a 00 00       	call   3e00 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    233d:	50                   	push   %eax
+    233e:	50                   	push   %eax
+    233f:	68 04 56 00 00       	push   $0x5604
+    2344:	6a 01                	push   $0x1
+    2346:	e8 65 1c 00 00       	call   3fb0 <printf>
+    exit();
+    234b:	e8 b0 1a 00 00       	call   3e00 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    2350:	53                   	push   %ebx
+    2351:	53                   	push   %ebx
+    2352:	68 63 4a 00 00       	push   $0x4a63
+    2357:	6a 01                	push   $0x1
+    2359:	e8 52 1c 00 00       	call   3fb0 <printf>
+    exit();
+    235e:	e8 9d 1a 00 00       	call   3e00 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    2363:	50                   	push   %eax
+    2364:	50                   	push   %eax
+    2365:	68 b8 55 00 00       	push   $0x55b8
+    236a:	6a 01                	push   $0x1
+    236c:	e8 3f 1c 00 00       	call   3fb0 <printf>
+    exit();
+    2371:	e8 8a 1a 00 00       	call   3e00 <exit>
+    printf(1, "create dd/ff failed\n");
+    2376:	50                   	push   %eax
+    2377:	50                   	push   %eax
+    2378:	68 47 4a 00 00       	push   $0x4a47
+    237d:	6a 01                	push   $0x1
+    237f:	e8 2c 1c 00 00       	call   3fb0 <printf>
+    exit();
+    2384:	e8 77 1a 00 00       	call   3e00 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    2389:	50                   	push   %eax
+    238a:	50                   	push   %eax
+    238b:	68 2f 4a 00 00       	push   $0x4a2f
+    2390:	6a 01                	push   $0x1
+    2392:	e8 19 1c 00 00       	call   3fb0 <printf>
+    exit();
+    2397:	e8 64 1a 00 00       	call   3e00 <exit>
+    printf(1, "unlink dd failed\n");
+    239c:	50                   	push   %eax
+    239d:	50                   	push   %eax
+    239e:	68 18 4d 00 00       	push   $0x4d18
+    23a3:	6a 01                	push   $0x1
+    23a5:	e8 06 1c 00 00       	call   3fb0 <printf>
+    exit();
+    23aa:	e8 51 1a 00 00       	call   3e00 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    23af:	52                   	push   %edx
+    23b0:	52                   	push   %edx
+    23b1:	68 03 4d 00 00       	push   $0x4d03
+    23b6:	6a 01                	push   $0x1
+    23b8:	e8 f3 1b 00 00       	call   3fb0 <printf>
+    exit();
+    23bd:	e8 3e 1a 00 00       	call   3e00 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    23c2:	51                   	push   %ecx
+    23c3:	51                   	push   %ecx
+    23c4:	68 bc 56 00 00       	push   $0x56bc
+    23c9:	6a 01                	push   $0x1
+    23cb:	e8 e0 1b 00 00       	call   3fb0 <printf>
+    exit();
+    23d0:	e8 2b 1a 00 00       	call   3e00 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    23d5:	53                   	push   %ebx
+    23d6:	53                   	push   %ebx
+    23d7:	68 ee 4c 00 00       	push   $0x4cee
+    23dc:	6a 01                	push   $0x1
+    23de:	e8 cd 1b 00 00       	call   3fb0 <printf>
+    exit();
+    23e3:	e8 18 1a 00 00       	call   3e00 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    23e8:	50                   	push   %eax
+    23e9:	50                   	push   %eax
+    23ea:	68 d6 4c 00 00       	push   $0x4cd6
+    23ef:	6a 01                	push   $0x1
+    23f1:	e8 ba 1b 00 00       	call   3fb0 <printf>
+    exit();
+    23f6:	e8 05 1a 00 00       	call   3e00 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    23fb:	50                   	push   %eax
+    23fc:	50                   	push   %eax
+    23fd:	68 be 4c 00 00       	push   $0x4cbe
+    2402:	6a 01                	push   $0x1
+    2404:	e8 a7 1b 00 00       	call   3fb0 <printf>
+    exit();
+    2409:	e8 f2 19 00 00       	call   3e00 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    240e:	50                   	push   %eax
+    240f:	50                   	push   %eax
+    2410:	68 a2 4c 00 00       	push   $0x4ca2
+    2415:	6a 01                	push   $0x1
+    2417:	e8 94 1b 00 00       	call   3fb0 <printf>
+    exit();
+    241c:	e8 df 19 00 00       	call   3e00 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    2421:	50                   	push   %eax
+    2422:	50                   	push   %eax
+    2423:	68 86 4c 00 00       	push   $0x4c86
+    2428:	6a 01                	push   $0x1
+    242a:	e8 81 1b 00 00       	call   3fb0 <printf>
+    exit();
+    242f:	e8 cc 19 00 00       	call   3e00 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    2434:	50                   	push   %eax
+    2435:	50                   	push   %eax
+    2436:	68 69 4c 00 00       	push   $0x4c69
+    243b:	6a 01                	push   $0x1
+    243d:	e8 6e 1b 00 00       	call   3fb0 <printf>
+    exit();
+    2442:	e8 b9 19 00 00       	call   3e00 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    2447:	52                   	push   %edx
+    2448:	52                   	push   %edx
+    2449:	68 4e 4c 00 00       	push   $0x4c4e
+    244e:	6a 01                	push   $0x1
+    2450:	e8 5b 1b 00 00       	call   3fb0 <printf>
+    exit();
+    2455:	e8 a6 19 00 00       	call   3e00 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    245a:	51                   	push   %ecx
+    245b:	51                   	push   %ecx
+    245c:	68 7b 4b 00 00       	push   $0x4b7b
+    2461:	6a 01                	push   $0x1
+    2463:	e8 48 1b 00 00       	call   3fb0 <printf>
+    exit();
+    2468:	e8 93 19 00 00       	call   3e00 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    246d:	53                   	push   %ebx
+    246e:	53                   	push   %ebx
+    246f:	68 63 4b 00 00       	push   $0x4b63
+    2474:	6a 01                	push   $0x1
+    2476:	e8 35 1b 00 00       	call   3fb0 <printf>
+    exit();
+    247b:	e8 80 19 00 00       	call   3e00 <exit>
+
+00002480 <bigwrite>:
+{
+    2480:	55                   	push   %ebp
+    2481:	89 e5                	mov    %esp,%ebp
+    2483:	56                   	push   %esi
+    2484:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    2485:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    248a:	83 ec 08             	sub    $0x8,%esp
+    248d:	68 35 4d 00 00       	push   $0x4d35
+    2492:	6a 01                	push   $0x1
+    2494:	e8 17 1b 00 00       	call   3fb0 <printf>
+  unlink("bigwrite");
+    2499:	c7 04 24 44 4d 00 00 	movl   $0x4d44,(%esp)
+    24a0:	e8 ab 19 00 00       	call   3e50 <unlink>
+    24a5:	83 c4 10             	add    $0x10,%esp
+    24a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    24af:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    24b0:	83 ec 08             	sub    $0x8,%esp
+    24b3:	68 02 02 00 00       	push   $0x202
+    24b8:	68 44 4d 00 00       	push   $0x4d44
+    24bd:	e8 7e 19 00 00       	call   3e40 <open>
+    if(fd < 0){
+    24c2:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    24c5:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    24c7:	85 c0                	test   %eax,%eax
+    24c9:	78 7e                	js     2549 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    24cb:	83 ec 04             	sub    $0x4,%esp
+    24ce:	53                   	push   %ebx
+    24cf:	68 e0 8d 00 00       	push   $0x8de0
+    24d4:	50                   	push   %eax
+    24d5:	e8 46 19 00 00       	call   3e20 <write>
+      if(cc != sz){
+    24da:	83 c4 10             	add    $0x10,%esp
+    24dd:	39 d8                	cmp    %ebx,%eax
+    24df:	75 55                	jne    2536 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    24e1:	83 ec 04             	sub    $0x4,%esp
+    24e4:	53                   	push   %ebx
+    24e5:	68 e0 8d 00 00       	push   $0x8de0
+    24ea:	56                   	push   %esi
+    24eb:	e8 30 19 00 00       	call   3e20 <write>
+      if(cc != sz){
+    24f0:	83 c4 10             	add    $0x10,%esp
+    24f3:	39 c3                	cmp    %eax,%ebx
+    24f5:	75 3f                	jne    2536 <bigwrite+0xb6>
+    close(fd);
+    24f7:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    24fa:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    2500:	56                   	push   %esi
+    2501:	e8 22 19 00 00       	call   3e28 <close>
+    unlink("bigwrite");
+    2506:	c7 04 24 44 4d 00 00 	movl   $0x4d44,(%esp)
+    250d:	e8 3e 19 00 00       	call   3e50 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2512:	83 c4 10             	add    $0x10,%esp
+    2515:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    251b:	75 93                	jne    24b0 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    251d:	83 ec 08             	sub    $0x8,%esp
+    2520:	68 77 4d 00 00       	push   $0x4d77
+    2525:	6a 01                	push   $0x1
+    2527:	e8 84 1a 00 00       	call   3fb0 <printf>
+}
+    252c:	83 c4 10             	add    $0x10,%esp
+    252f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2532:	5b                   	pop    %ebx
+    2533:	5e                   	pop    %esi
+    2534:	5d                   	pop    %ebp
+    2535:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2536:	50                   	push   %eax
+    2537:	53                   	push   %ebx
+    2538:	68 65 4d 00 00       	push   $0x4d65
+    253d:	6a 01                	push   $0x1
+    253f:	e8 6c 1a 00 00       	call   3fb0 <printf>
+        exit();
+    2544:	e8 b7 18 00 00       	call   3e00 <exit>
+      printf(1, "cannot create bigwrite\n");
+    2549:	83 ec 08             	sub    $0x8,%esp
+    254c:	68 4d 4d 00 00       	push   $0x4d4d
+    2551:	6a 01                	push   $0x1
+    2553:	e8 58 1a 00 00       	call   3fb0 <printf>
+      exit();
+    2558:	e8 a3 18 00 00       	call   3e00 <exit>
+    255d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00002560 <bigfile>:
+{
+    2560:	55                   	push   %ebp
+    2561:	89 e5                	mov    %esp,%ebp
+    2563:	57                   	push   %edi
+    2564:	56                   	push   %esi
+    2565:	53                   	push   %ebx
+    2566:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    2569:	68 84 4d 00 00       	push   $0x4d84
+    256e:	6a 01                	push   $0x1
+    2570:	e8 3b 1a 00 00       	call   3fb0 <printf>
+  unlink("bigfile");
+    2575:	c7 04 24 a0 4d 00 00 	movl   $0x4da0,(%esp)
+    257c:	e8 cf 18 00 00       	call   3e50 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2581:	58                   	pop    %eax
+    2582:	5a                   	pop    %edx
+    2583:	68 02 02 00 00       	push   $0x202
+    2588:	68 a0 4d 00 00       	push   $0x4da0
+    258d:	e8 ae 18 00 00       	call   3e40 <open>
+  if(fd < 0){
+    2592:	83 c4 10             	add    $0x10,%esp
+    2595:	85 c0                	test   %eax,%eax
+    2597:	0f 88 5e 01 00 00    	js     26fb <bigfile+0x19b>
+    259d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    259f:	31 db                	xor    %ebx,%ebx
+    25a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    25a8:	83 ec 04             	sub    $0x4,%esp
+    25ab:	68 58 02 00 00       	push   $0x258
+    25b0:	53                   	push   %ebx
+    25b1:	68 e0 8d 00 00       	push   $0x8de0
+    25b6:	e8 45 16 00 00       	call   3c00 <memset>
+    if(write(fd, buf, 600) != 600){
+    25bb:	83 c4 0c             	add    $0xc,%esp
+    25be:	68 58 02 00 00       	push   $0x258
+    25c3:	68 e0 8d 00 00       	push   $0x8de0
+    25c8:	56                   	push   %esi
+    25c9:	e8 52 18 00 00       	call   3e20 <write>
+    25ce:	83 c4 10             	add    $0x10,%esp
+    25d1:	3d 58 02 00 00       	cmp    $0x258,%eax
+    25d6:	0f 85 f8 00 00 00    	jne    26d4 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    25dc:	83 c3 01             	add    $0x1,%ebx
+    25df:	83 fb 14             	cmp    $0x14,%ebx
+    25e2:	75 c4                	jne    25a8 <bigfile+0x48>
+  close(fd);
+    25e4:	83 ec 0c             	sub    $0xc,%esp
+    25e7:	56                   	push   %esi
+    25e8:	e8 3b 18 00 00       	call   3e28 <close>
+  fd = open("bigfile", 0);
+    25ed:	5e                   	pop    %esi
+    25ee:	5f                   	pop    %edi
+    25ef:	6a 00                	push   $0x0
+    25f1:	68 a0 4d 00 00       	push   $0x4da0
+    25f6:	e8 45 18 00 00       	call   3e40 <open>
+  if(fd < 0){
+    25fb:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    25fe:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    2600:	85 c0                	test   %eax,%eax
+    2602:	0f 88 e0 00 00 00    	js     26e8 <bigfile+0x188>
+  total = 0;
+    2608:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    260a:	31 ff                	xor    %edi,%edi
+    260c:	eb 30                	jmp    263e <bigfile+0xde>
+    260e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    2610:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    2615:	0f 85 91 00 00 00    	jne    26ac <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    261b:	89 fa                	mov    %edi,%edx
+    261d:	0f be 05 e0 8d 00 00 	movsbl 0x8de0,%eax
+    2624:	d1 fa                	sar    %edx
+    2626:	39 d0                	cmp    %edx,%eax
+    2628:	75 6e                	jne    2698 <bigfile+0x138>
+    262a:	0f be 15 0b 8f 00 00 	movsbl 0x8f0b,%edx
+    2631:	39 d0                	cmp    %edx,%eax
+    2633:	75 63                	jne    2698 <bigfile+0x138>
+    total += cc;
+    2635:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    263b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    263e:	83 ec 04             	sub    $0x4,%esp
+    2641:	68 2c 01 00 00       	push   $0x12c
+    2646:	68 e0 8d 00 00       	push   $0x8de0
+    264b:	56                   	push   %esi
+    264c:	e8 c7 17 00 00       	call   3e18 <read>
+    if(cc < 0){
+    2651:	83 c4 10             	add    $0x10,%esp
+    2654:	85 c0                	test   %eax,%eax
+    2656:	78 68                	js     26c0 <bigfile+0x160>
+    if(cc == 0)
+    2658:	75 b6                	jne    2610 <bigfile+0xb0>
+  close(fd);
+    265a:	83 ec 0c             	sub    $0xc,%esp
+    265d:	56                   	push   %esi
+    265e:	e8 c5 17 00 00       	call   3e28 <close>
+  if(total != 20*600){
+    2663:	83 c4 10             	add    $0x10,%esp
+    2666:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    266c:	0f 85 9c 00 00 00    	jne    270e <bigfile+0x1ae>
+  unlink("bigfile");
+    2672:	83 ec 0c             	sub    $0xc,%esp
+    2675:	68 a0 4d 00 00       	push   $0x4da0
+    267a:	e8 d1 17 00 00       	call   3e50 <unlink>
+  printf(1, "bigfile test ok\n");
+    267f:	58                   	pop    %eax
+    2680:	5a                   	pop    %edx
+    2681:	68 2f 4e 00 00       	push   $0x4e2f
+    2686:	6a 01                	push   $0x1
+    2688:	e8 23 19 00 00       	call   3fb0 <printf>
+}
+    268d:	83 c4 10             	add    $0x10,%esp
+    2690:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2693:	5b                   	pop    %ebx
+    2694:	5e                   	pop    %esi
+    2695:	5f                   	pop    %edi
+    2696:	5d                   	pop    %ebp
+    2697:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    2698:	83 ec 08             	sub    $0x8,%esp
+    269b:	68 fc 4d 00 00       	push   $0x4dfc
+    26a0:	6a 01                	push   $0x1
+    26a2:	e8 09 19 00 00       	call   3fb0 <printf>
+      exit();
+    26a7:	e8 54 17 00 00       	call   3e00 <exit>
+      printf(1, "short read bigfile\n");
+    26ac:	83 ec 08             	sub    $0x8,%esp
+    26af:	68 e8 4d 00 00       	push   $0x4de8
+    26b4:	6a 01                	push   $0x1
+    26b6:	e8 f5 18 00 00       	call   3fb0 <printf>
+      exit();
+    26bb:	e8 40 17 00 00       	call   3e00 <exit>
+      printf(1, "read bigfile failed\n");
+    26c0:	83 ec 08             	sub    $0x8,%esp
+    26c3:	68 d3 4d 00 00       	push   $0x4dd3
+    26c8:	6a 01                	push   $0x1
+    26ca:	e8 e1 18 00 00       	call   3fb0 <printf>
+      exit();
+    26cf:	e8 2c 17 00 00       	call   3e00 <exit>
+      printf(1, "write bigfile failed\n");
+    26d4:	83 ec 08             	sub    $0x8,%esp
+    26d7:	68 a8 4d 00 00       	push   $0x4da8
+    26dc:	6a 01                	push   $0x1
+    26de:	e8 cd 18 00 00       	call   3fb0 <printf>
+      exit();
+    26e3:	e8 18 17 00 00       	call   3e00 <exit>
+    printf(1, "cannot open bigfile\n");
+    26e8:	53                   	push   %ebx
+    26e9:	53                   	push   %ebx
+    26ea:	68 be 4d 00 00       	push   $0x4dbe
+    26ef:	6a 01                	push   $0x1
+    26f1:	e8 ba 18 00 00       	call   3fb0 <printf>
+    exit();
+    26f6:	e8 05 17 00 00       	call   3e00 <exit>
+    printf(1, "cannot create bigfile");
+    26fb:	50                   	push   %eax
+    26fc:	50                   	push   %eax
+    26fd:	68 92 4d 00 00       	push   $0x4d92
+    2702:	6a 01                	push   $0x1
+    2704:	e8 a7 18 00 00       	call   3fb0 <printf>
+    exit();
+    2709:	e8 f2 16 00 00       	call   3e00 <exit>
+    printf(1, "read bigfile wrong total\n");
+    270e:	51                   	push   %ecx
+    270f:	51                   	push   %ecx
+    2710:	68 15 4e 00 00       	push   $0x4e15
+    2715:	6a 01                	push   $0x1
+    2717:	e8 94 18 00 00       	call   3fb0 <printf>
+    exit();
+    271c:	e8 df 16 00 00       	call   3e00 <exit>
+    2721:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2728:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    272f:	90                   	nop
+
+00002730 <fourteen>:
+{
+    2730:	55                   	push   %ebp
+    2731:	89 e5                	mov    %esp,%ebp
+    2733:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    2736:	68 40 4e 00 00       	push   $0x4e40
+    273b:	6a 01                	push   $0x1
+    273d:	e8 6e 18 00 00       	call   3fb0 <printf>
+  if(mkdir("12345678901234") != 0){
+    2742:	c7 04 24 7b 4e 00 00 	movl   $0x4e7b,(%esp)
+    2749:	e8 1a 17 00 00       	call   3e68 <mkdir>
+    274e:	83 c4 10             	add    $0x10,%esp
+    2751:	85 c0                	test   %eax,%eax
+    2753:	0f 85 97 00 00 00    	jne    27f0 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    2759:	83 ec 0c             	sub    $0xc,%esp
+    275c:	68 dc 56 00 00       	push   $0x56dc
+    2761:	e8 02 17 00 00       	call   3e68 <mkdir>
+    2766:	83 c4 10             	add    $0x10,%esp
+    2769:	85 c0                	test   %eax,%eax
+    276b:	0f 85 de 00 00 00    	jne    284f <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    2771:	83 ec 08             	sub    $0x8,%esp
+    2774:	68 00 02 00 00       	push   $0x200
+    2779:	68 2c 57 00 00       	push   $0x572c
+    277e:	e8 bd 16 00 00       	call   3e40 <open>
+  if(fd < 0){
+    2783:	83 c4 10             	add    $0x10,%esp
+    2786:	85 c0                	test   %eax,%eax
+    2788:	0f 88 ae 00 00 00    	js     283c <fourteen+0x10c>
+  close(fd);
+    278e:	83 ec 0c             	sub    $0xc,%esp
+    2791:	50                   	push   %eax
+    2792:	e8 91 16 00 00       	call   3e28 <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2797:	58                   	pop    %eax
+    2798:	5a                   	pop    %edx
+    2799:	6a 00                	push   $0x0
+    279b:	68 9c 57 00 00       	push   $0x579c
+    27a0:	e8 9b 16 00 00       	call   3e40 <open>
+  if(fd < 0){
+    27a5:	83 c4 10             	add    $0x10,%esp
+    27a8:	85 c0                	test   %eax,%eax
+    27aa:	78 7d                	js     2829 <fourteen+0xf9>
+  close(fd);
+    27ac:	83 ec 0c             	sub    $0xc,%esp
+    27af:	50                   	push   %eax
+    27b0:	e8 73 16 00 00       	call   3e28 <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    27b5:	c7 04 24 6c 4e 00 00 	movl   $0x4e6c,(%esp)
+    27bc:	e8 a7 16 00 00       	call   3e68 <mkdir>
+    27c1:	83 c4 10             	add    $0x10,%esp
+    27c4:	85 c0                	test   %eax,%eax
+    27c6:	74 4e                	je     2816 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    27c8:	83 ec 0c             	sub    $0xc,%esp
+    27cb:	68 38 58 00 00       	push   $0x5838
+    27d0:	e8 93 16 00 00       	call   3e68 <mkdir>
+    27d5:	83 c4 10             	add    $0x10,%esp
+    27d8:	85 c0                	test   %eax,%eax
+    27da:	74 27                	je     2803 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    27dc:	83 ec 08             	sub    $0x8,%esp
+    27df:	68 8a 4e 00 00       	push   $0x4e8a
+    27e4:	6a 01                	push   $0x1
+    27e6:	e8 c5 17 00 00       	call   3fb0 <printf>
+}
+    27eb:	83 c4 10             	add    $0x10,%esp
+    27ee:	c9                   	leave
+    27ef:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    27f0:	50                   	push   %eax
+    27f1:	50                   	push   %eax
+    27f2:	68 4f 4e 00 00       	push   $0x4e4f
+    27f7:	6a 01                	push   $0x1
+    27f9:	e8 b2 17 00 00       	call   3fb0 <printf>
+    exit();
+    27fe:	e8 fd 15 00 00       	call   3e00 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    2803:	50                   	push   %eax
+    2804:	50                   	push   %eax
+    2805:	68 58 58 00 00       	push   $0x5858
+    280a:	6a 01                	push   $0x1
+    280c:	e8 9f 17 00 00       	call   3fb0 <printf>
+    exit();
+    2811:	e8 ea 15 00 00       	call   3e00 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    2816:	52                   	push   %edx
+    2817:	52                   	push   %edx
+    2818:	68 08 58 00 00       	push   $0x5808
+    281d:	6a 01                	push   $0x1
+    281f:	e8 8c 17 00 00       	call   3fb0 <printf>
+    exit();
+    2824:	e8 d7 15 00 00       	call   3e00 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    2829:	51                   	push   %ecx
+    282a:	51                   	push   %ecx
+    282b:	68 cc 57 00 00       	push   $0x57cc
+    2830:	6a 01                	push   $0x1
+    2832:	e8 79 17 00 00       	call   3fb0 <printf>
+    exit();
+    2837:	e8 c4 15 00 00       	call   3e00 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    283c:	51                   	push   %ecx
+    283d:	51                   	push   %ecx
+    283e:	68 5c 57 00 00       	push   $0x575c
+    2843:	6a 01                	push   $0x1
+    2845:	e8 66 17 00 00       	call   3fb0 <printf>
+    exit();
+    284a:	e8 b1 15 00 00       	call   3e00 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    284f:	50                   	push   %eax
+    2850:	50                   	push   %eax
+    2851:	68 fc 56 00 00       	push   $0x56fc
+    2856:	6a 01                	push   $0x1
+    2858:	e8 53 17 00 00       	call   3fb0 <printf>
+    exit();
+    285d:	e8 9e 15 00 00       	call   3e00 <exit>
+    2862:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002870 <rmdot>:
+{
+    2870:	55                   	push   %ebp
+    2871:	89 e5                	mov    %esp,%ebp
+    2873:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    2876:	68 97 4e 00 00       	push   $0x4e97
+    287b:	6a 01                	push   $0x1
+    287d:	e8 2e 17 00 00       	call   3fb0 <printf>
+  if(mkdir("dots") != 0){
+    2882:	c7 04 24 a3 4e 00 00 	movl   $0x4ea3,(%esp)
+    2889:	e8 da 15 00 00       	call   3e68 <mkdir>
+    288e:	83 c4 10             	add    $0x10,%esp
+    2891:	85 c0                	test   %eax,%eax
+    2893:	0f 85 b0 00 00 00    	jne    2949 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    2899:	83 ec 0c             	sub    $0xc,%esp
+    289c:	68 a3 4e 00 00       	push   $0x4ea3
+    28a1:	e8 ca 15 00 00       	call   3e70 <chdir>
+    28a6:	83 c4 10             	add    $0x10,%esp
+    28a9:	85 c0                	test   %eax,%eax
+    28ab:	0f 85 1d 01 00 00    	jne    29ce <rmdot+0x15e>
+  if(unlink(".") == 0){
+    28b1:	83 ec 0c             	sub    $0xc,%esp
+    28b4:	68 4e 4b 00 00       	push   $0x4b4e
+    28b9:	e8 92 15 00 00       	call   3e50 <unlink>
+    28be:	83 c4 10             	add    $0x10,%esp
+    28c1:	85 c0                	test   %eax,%eax
+    28c3:	0f 84 f2 00 00 00    	je     29bb <rmdot+0x14b>
+  if(unlink("..") == 0){
+    28c9:	83 ec 0c             	sub    $0xc,%esp
+    28cc:	68 4d 4b 00 00       	push   $0x4b4d
+    28d1:	e8 7a 15 00 00       	call   3e50 <unlink>
+    28d6:	83 c4 10             	add    $0x10,%esp
+    28d9:	85 c0                	test   %eax,%eax
+    28db:	0f 84 c7 00 00 00    	je     29a8 <rmdot+0x138>
+  if(chdir("/") != 0){
+    28e1:	83 ec 0c             	sub    $0xc,%esp
+    28e4:	68 21 43 00 00       	push   $0x4321
+    28e9:	e8 82 15 00 00       	call   3e70 <chdir>
+    28ee:	83 c4 10             	add    $0x10,%esp
+    28f1:	85 c0                	test   %eax,%eax
+    28f3:	0f 85 9c 00 00 00    	jne    2995 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    28f9:	83 ec 0c             	sub    $0xc,%esp
+    28fc:	68 eb 4e 00 00       	push   $0x4eeb
+    2901:	e8 4a 15 00 00       	call   3e50 <unlink>
+    2906:	83 c4 10             	add    $0x10,%esp
+    2909:	85 c0                	test   %eax,%eax
+    290b:	74 75                	je     2982 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    290d:	83 ec 0c             	sub    $0xc,%esp
+    2910:	68 09 4f 00 00       	push   $0x4f09
+    2915:	e8 36 15 00 00       	call   3e50 <unlink>
+    291a:	83 c4 10             	add    $0x10,%esp
+    291d:	85 c0                	test   %eax,%eax
+    291f:	74 4e                	je     296f <rmdot+0xff>
+  if(unlink("dots") != 0){
+    2921:	83 ec 0c             	sub    $0xc,%esp
+    2924:	68 a3 4e 00 00       	push   $0x4ea3
+    2929:	e8 22 15 00 00       	call   3e50 <unlink>
+    292e:	83 c4 10             	add    $0x10,%esp
+    2931:	85 c0                	test   %eax,%eax
+    2933:	75 27                	jne    295c <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    2935:	83 ec 08             	sub    $0x8,%esp
+    2938:	68 3e 4f 00 00       	push   $0x4f3e
+    293d:	6a 01                	push   $0x1
+    293f:	e8 6c 16 00 00       	call   3fb0 <printf>
+}
+    2944:	83 c4 10             	add    $0x10,%esp
+    2947:	c9                   	leave
+    2948:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    2949:	50                   	push   %eax
+    294a:	50                   	push   %eax
+    294b:	68 a8 4e 00 00       	push   $0x4ea8
+    2950:	6a 01                	push   $0x1
+    2952:	e8 59 16 00 00       	call   3fb0 <printf>
+    exit();
+    2957:	e8 a4 14 00 00       	call   3e00 <exit>
+    printf(1, "unlink dots failed!\n");
+    295c:	50                   	push   %eax
+    295d:	50                   	push   %eax
+    295e:	68 29 4f 00 00       	push   $0x4f29
+    2963:	6a 01                	push   $0x1
+    2965:	e8 46 16 00 00       	call   3fb0 <printf>
+    exit();
+    296a:	e8 91 14 00 00       	call   3e00 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    296f:	52                   	push   %edx
+    2970:	52                   	push   %edx
+    2971:	68 11 4f 00 00       	push   $0x4f11
+    2976:	6a 01                	push   $0x1
+    2978:	e8 33 16 00 00       	call   3fb0 <printf>
+    exit();
+    297d:	e8 7e 14 00 00       	call   3e00 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    2982:	51                   	push   %ecx
+    2983:	51                   	push   %ecx
+    2984:	68 f2 4e 00 00       	push   $0x4ef2
+    2989:	6a 01                	push   $0x1
+    298b:	e8 20 16 00 00       	call   3fb0 <printf>
+    exit();
+    2990:	e8 6b 14 00 00       	call   3e00 <exit>
+    printf(1, "chdir / failed\n");
+    2995:	50                   	push   %eax
+    2996:	50                   	push   %eax
+    2997:	68 23 43 00 00       	push   $0x4323
+    299c:	6a 01                	push   $0x1
+    299e:	e8 0d 16 00 00       	call   3fb0 <printf>
+    exit();
+    29a3:	e8 58 14 00 00       	call   3e00 <exit>
+    printf(1, "rm .. worked!\n");
+    29a8:	50                   	push   %eax
+    29a9:	50                   	push   %eax
+    29aa:	68 dc 4e 00 00       	push   $0x4edc
+    29af:	6a 01                	push   $0x1
+    29b1:	e8 fa 15 00 00       	call   3fb0 <printf>
+    exit();
+    29b6:	e8 45 14 00 00       	call   3e00 <exit>
+    printf(1, "rm . worked!\n");
+    29bb:	50                   	push   %eax
+    29bc:	50                   	push   %eax
+    29bd:	68 ce 4e 00 00       	push   $0x4ece
+    29c2:	6a 01                	push   $0x1
+    29c4:	e8 e7 15 00 00       	call   3fb0 <printf>
+    exit();
+    29c9:	e8 32 14 00 00       	call   3e00 <exit>
+    printf(1, "chdir dots failed\n");
+    29ce:	50                   	push   %eax
+    29cf:	50                   	push   %eax
+    29d0:	68 bb 4e 00 00       	push   $0x4ebb
+    29d5:	6a 01                	push   $0x1
+    29d7:	e8 d4 15 00 00       	call   3fb0 <printf>
+    exit();
+    29dc:	e8 1f 14 00 00       	call   3e00 <exit>
+    29e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    29e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    29ef:	90                   	nop
+
+000029f0 <dirfile>:
+{
+    29f0:	55                   	push   %ebp
+    29f1:	89 e5                	mov    %esp,%ebp
+    29f3:	53                   	push   %ebx
+    29f4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    29f7:	68 48 4f 00 00       	push   $0x4f48
+    29fc:	6a 01                	push   $0x1
+    29fe:	e8 ad 15 00 00       	call   3fb0 <printf>
+  fd = open("dirfile", O_CREATE);
+    2a03:	5b                   	pop    %ebx
+    2a04:	58                   	pop    %eax
+    2a05:	68 00 02 00 00       	push   $0x200
+    2a0a:	68 55 4f 00 00       	push   $0x4f55
+    2a0f:	e8 2c 14 00 00       	call   3e40 <open>
+  if(fd < 0){
+    2a14:	83 c4 10             	add    $0x10,%esp
+    2a17:	85 c0                	test   %eax,%eax
+    2a19:	0f 88 43 01 00 00    	js     2b62 <dirfile+0x172>
+  close(fd);
+    2a1f:	83 ec 0c             	sub    $0xc,%esp
+    2a22:	50                   	push   %eax
+    2a23:	e8 00 14 00 00       	call   3e28 <close>
+  if(chdir("dirfile") == 0){
+    2a28:	c7 04 24 55 4f 00 00 	movl   $0x4f55,(%esp)
+    2a2f:	e8 3c 14 00 00       	call   3e70 <chdir>
+    2a34:	83 c4 10             	add    $0x10,%esp
+    2a37:	85 c0                	test   %eax,%eax
+    2a39:	0f 84 10 01 00 00    	je     2b4f <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    2a3f:	83 ec 08             	sub    $0x8,%esp
+    2a42:	6a 00                	push   $0x0
+    2a44:	68 8e 4f 00 00       	push   $0x4f8e
+    2a49:	e8 f2 13 00 00       	call   3e40 <open>
+  if(fd >= 0){
+    2a4e:	83 c4 10             	add    $0x10,%esp
+    2a51:	85 c0                	test   %eax,%eax
+    2a53:	0f 89 e3 00 00 00    	jns    2b3c <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    2a59:	83 ec 08             	sub    $0x8,%esp
+    2a5c:	68 00 02 00 00       	push   $0x200
+    2a61:	68 8e 4f 00 00       	push   $0x4f8e
+    2a66:	e8 d5 13 00 00       	call   3e40 <open>
+  if(fd >= 0){
+    2a6b:	83 c4 10             	add    $0x10,%esp
+    2a6e:	85 c0                	test   %eax,%eax
+    2a70:	0f 89 c6 00 00 00    	jns    2b3c <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    2a76:	83 ec 0c             	sub    $0xc,%esp
+    2a79:	68 8e 4f 00 00       	push   $0x4f8e
+    2a7e:	e8 e5 13 00 00       	call   3e68 <mkdir>
+    2a83:	83 c4 10             	add    $0x10,%esp
+    2a86:	85 c0                	test   %eax,%eax
+    2a88:	0f 84 46 01 00 00    	je     2bd4 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    2a8e:	83 ec 0c             	sub    $0xc,%esp
+    2a91:	68 8e 4f 00 00       	push   $0x4f8e
+    2a96:	e8 b5 13 00 00       	call   3e50 <unlink>
+    2a9b:	83 c4 10             	add    $0x10,%esp
+    2a9e:	85 c0                	test   %eax,%eax
+    2aa0:	0f 84 1b 01 00 00    	je     2bc1 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    2aa6:	83 ec 08             	sub    $0x8,%esp
+    2aa9:	68 8e 4f 00 00       	push   $0x4f8e
+    2aae:	68 f2 4f 00 00       	push   $0x4ff2
+    2ab3:	e8 a8 13 00 00       	call   3e60 <link>
+    2ab8:	83 c4 10             	add    $0x10,%esp
+    2abb:	85 c0                	test   %eax,%eax
+    2abd:	0f 84 eb 00 00 00    	je     2bae <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    2ac3:	83 ec 0c             	sub    $0xc,%esp
+    2ac6:	68 55 4f 00 00       	push   $0x4f55
+    2acb:	e8 80 13 00 00       	call   3e50 <unlink>
+    2ad0:	83 c4 10             	add    $0x10,%esp
+    2ad3:	85 c0                	test   %eax,%eax
+    2ad5:	0f 85 c0 00 00 00    	jne    2b9b <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    2adb:	83 ec 08             	sub    $0x8,%esp
+    2ade:	6a 02                	push   $0x2
+    2ae0:	68 4e 4b 00 00       	push   $0x4b4e
+    2ae5:	e8 56 13 00 00       	call   3e40 <open>
+  if(fd >= 0){
+    2aea:	83 c4 10             	add    $0x10,%esp
+    2aed:	85 c0                	test   %eax,%eax
+    2aef:	0f 89 93 00 00 00    	jns    2b88 <dirfile+0x198>
+  fd = open(".", 0);
+    2af5:	83 ec 08             	sub    $0x8,%esp
+    2af8:	6a 00                	push   $0x0
+    2afa:	68 4e 4b 00 00       	push   $0x4b4e
+    2aff:	e8 3c 13 00 00       	call   3e40 <open>
+  if(write(fd, "x", 1) > 0){
+    2b04:	83 c4 0c             	add    $0xc,%esp
+    2b07:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    2b09:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    2b0b:	68 31 4c 00 00       	push   $0x4c31
+    2b10:	50                   	push   %eax
+    2b11:	e8 0a 13 00 00       	call   3e20 <write>
+    2b16:	83 c4 10             	add    $0x10,%esp
+    2b19:	85 c0                	test   %eax,%eax
+    2b1b:	7f 58                	jg     2b75 <dirfile+0x185>
+  close(fd);
+    2b1d:	83 ec 0c             	sub    $0xc,%esp
+    2b20:	53                   	push   %ebx
+    2b21:	e8 02 13 00 00       	call   3e28 <close>
+  printf(1, "dir vs file OK\n");
+    2b26:	58                   	pop    %eax
+    2b27:	5a                   	pop    %edx
+    2b28:	68 25 50 00 00       	push   $0x5025
+    2b2d:	6a 01                	push   $0x1
+    2b2f:	e8 7c 14 00 00       	call   3fb0 <printf>
+}
+    2b34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2b37:	83 c4 10             	add    $0x10,%esp
+    2b3a:	c9                   	leave
+    2b3b:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    2b3c:	50                   	push   %eax
+    2b3d:	50                   	push   %eax
+    2b3e:	68 99 4f 00 00       	push   $0x4f99
+    2b43:	6a 01                	push   $0x1
+    2b45:	e8 66 14 00 00       	call   3fb0 <printf>
+    exit();
+    2b4a:	e8 b1 12 00 00       	call   3e00 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    2b4f:	52                   	push   %edx
+    2b50:	52                   	push   %edx
+    2b51:	68 74 4f 00 00       	push   $0x4f74
+    2b56:	6a 01                	push   $0x1
+    2b58:	e8 53 14 00 00       	call   3fb0 <printf>
+    exit();
+    2b5d:	e8 9e 12 00 00       	call   3e00 <exit>
+    printf(1, "create dirfile failed\n");
+    2b62:	51                   	push   %ecx
+    2b63:	51                   	push   %ecx
+    2b64:	68 5d 4f 00 00       	push   $0x4f5d
+    2b69:	6a 01                	push   $0x1
+    2b6b:	e8 40 14 00 00       	call   3fb0 <printf>
+    exit();
+    2b70:	e8 8b 12 00 00       	call   3e00 <exit>
+    printf(1, "write . succeeded!\n");
+    2b75:	51                   	push   %ecx
+    2b76:	51                   	push   %ecx
+    2b77:	68 11 50 00 00       	push   $0x5011
+    2b7c:	6a 01                	push   $0x1
+    2b7e:	e8 2d 14 00 00       	call   3fb0 <printf>
+    exit();
+    2b83:	e8 78 12 00 00       	call   3e00 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2b88:	53                   	push   %ebx
+    2b89:	53                   	push   %ebx
+    2b8a:	68 ac 58 00 00       	push   $0x58ac
+    2b8f:	6a 01                	push   $0x1
+    2b91:	e8 1a 14 00 00       	call   3fb0 <printf>
+    exit();
+    2b96:	e8 65 12 00 00       	call   3e00 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    2b9b:	50                   	push   %eax
+    2b9c:	50                   	push   %eax
+    2b9d:	68 f9 4f 00 00       	push   $0x4ff9
+    2ba2:	6a 01                	push   $0x1
+    2ba4:	e8 07 14 00 00       	call   3fb0 <printf>
+    exit();
+    2ba9:	e8 52 12 00 00       	call   3e00 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    2bae:	50                   	push   %eax
+    2baf:	50                   	push   %eax
+    2bb0:	68 8c 58 00 00       	push   $0x588c
+    2bb5:	6a 01                	push   $0x1
+    2bb7:	e8 f4 13 00 00       	call   3fb0 <printf>
+    exit();
+    2bbc:	e8 3f 12 00 00       	call   3e00 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2bc1:	50                   	push   %eax
+    2bc2:	50                   	push   %eax
+    2bc3:	68 d4 4f 00 00       	push   $0x4fd4
+    2bc8:	6a 01                	push   $0x1
+    2bca:	e8 e1 13 00 00       	call   3fb0 <printf>
+    exit();
+    2bcf:	e8 2c 12 00 00       	call   3e00 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2bd4:	50                   	push   %eax
+    2bd5:	50                   	push   %eax
+    2bd6:	68 b7 4f 00 00       	push   $0x4fb7
+    2bdb:	6a 01                	push   $0x1
+    2bdd:	e8 ce 13 00 00       	call   3fb0 <printf>
+    exit();
+    2be2:	e8 19 12 00 00       	call   3e00 <exit>
+    2be7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2bee:	66 90                	xchg   %ax,%ax
+
+00002bf0 <iref>:
+{
+    2bf0:	55                   	push   %ebp
+    2bf1:	89 e5                	mov    %esp,%ebp
+    2bf3:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    2bf4:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    2bf9:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    2bfc:	68 35 50 00 00       	push   $0x5035
+    2c01:	6a 01                	push   $0x1
+    2c03:	e8 a8 13 00 00       	call   3fb0 <printf>
+    2c08:	83 c4 10             	add    $0x10,%esp
+    2c0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2c0f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    2c10:	83 ec 0c             	sub    $0xc,%esp
+    2c13:	68 46 50 00 00       	push   $0x5046
+    2c18:	e8 4b 12 00 00       	call   3e68 <mkdir>
+    2c1d:	83 c4 10             	add    $0x10,%esp
+    2c20:	85 c0                	test   %eax,%eax
+    2c22:	0f 85 bb 00 00 00    	jne    2ce3 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    2c28:	83 ec 0c             	sub    $0xc,%esp
+    2c2b:	68 46 50 00 00       	push   $0x5046
+    2c30:	e8 3b 12 00 00       	call   3e70 <chdir>
+    2c35:	83 c4 10             	add    $0x10,%esp
+    2c38:	85 c0                	test   %eax,%eax
+    2c3a:	0f 85 b7 00 00 00    	jne    2cf7 <iref+0x107>
+    mkdir("");
+    2c40:	83 ec 0c             	sub    $0xc,%esp
+    2c43:	68 fb 46 00 00       	push   $0x46fb
+    2c48:	e8 1b 12 00 00       	call   3e68 <mkdir>
+    link("README", "");
+    2c4d:	59                   	pop    %ecx
+    2c4e:	58                   	pop    %eax
+    2c4f:	68 fb 46 00 00       	push   $0x46fb
+    2c54:	68 f2 4f 00 00       	push   $0x4ff2
+    2c59:	e8 02 12 00 00       	call   3e60 <link>
+    fd = open("", O_CREATE);
+    2c5e:	58                   	pop    %eax
+    2c5f:	5a                   	pop    %edx
+    2c60:	68 00 02 00 00       	push   $0x200
+    2c65:	68 fb 46 00 00       	push   $0x46fb
+    2c6a:	e8 d1 11 00 00       	call   3e40 <open>
+    if(fd >= 0)
+    2c6f:	83 c4 10             	add    $0x10,%esp
+    2c72:	85 c0                	test   %eax,%eax
+    2c74:	78 0c                	js     2c82 <iref+0x92>
+      close(fd);
+    2c76:	83 ec 0c             	sub    $0xc,%esp
+    2c79:	50                   	push   %eax
+    2c7a:	e8 a9 11 00 00       	call   3e28 <close>
+    2c7f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    2c82:	83 ec 08             	sub    $0x8,%esp
+    2c85:	68 00 02 00 00       	push   $0x200
+    2c8a:	68 30 4c 00 00       	push   $0x4c30
+    2c8f:	e8 ac 11 00 00       	call   3e40 <open>
+    if(fd >= 0)
+    2c94:	83 c4 10             	add    $0x10,%esp
+    2c97:	85 c0                	test   %eax,%eax
+    2c99:	78 0c                	js     2ca7 <iref+0xb7>
+      close(fd);
+    2c9b:	83 ec 0c             	sub    $0xc,%esp
+    2c9e:	50                   	push   %eax
+    2c9f:	e8 84 11 00 00       	call   3e28 <close>
+    2ca4:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    2ca7:	83 ec 0c             	sub    $0xc,%esp
+    2caa:	68 30 4c 00 00       	push   $0x4c30
+    2caf:	e8 9c 11 00 00       	call   3e50 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    2cb4:	83 c4 10             	add    $0x10,%esp
+    2cb7:	83 eb 01             	sub    $0x1,%ebx
+    2cba:	0f 85 50 ff ff ff    	jne    2c10 <iref+0x20>
+  chdir("/");
+    2cc0:	83 ec 0c             	sub    $0xc,%esp
+    2cc3:	68 21 43 00 00       	push   $0x4321
+    2cc8:	e8 a3 11 00 00       	call   3e70 <chdir>
+  printf(1, "empty file name OK\n");
+    2ccd:	58                   	pop    %eax
+    2cce:	5a                   	pop    %edx
+    2ccf:	68 74 50 00 00       	push   $0x5074
+    2cd4:	6a 01                	push   $0x1
+    2cd6:	e8 d5 12 00 00       	call   3fb0 <printf>
+}
+    2cdb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2cde:	83 c4 10             	add    $0x10,%esp
+    2ce1:	c9                   	leave
+    2ce2:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    2ce3:	83 ec 08             	sub    $0x8,%esp
+    2ce6:	68 4c 50 00 00       	push   $0x504c
+    2ceb:	6a 01                	push   $0x1
+    2ced:	e8 be 12 00 00       	call   3fb0 <printf>
+      exit();
+    2cf2:	e8 09 11 00 00       	call   3e00 <exit>
+      printf(1, "chdir irefd failed\n");
+    2cf7:	83 ec 08             	sub    $0x8,%esp
+    2cfa:	68 60 50 00 00       	push   $0x5060
+    2cff:	6a 01                	push   $0x1
+    2d01:	e8 aa 12 00 00       	call   3fb0 <printf>
+      exit();
+    2d06:	e8 f5 10 00 00       	call   3e00 <exit>
+    2d0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2d0f:	90                   	nop
+
+00002d10 <forktest>:
+{
+    2d10:	55                   	push   %ebp
+    2d11:	89 e5                	mov    %esp,%ebp
+    2d13:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    2d14:	31 db                	xor    %ebx,%ebx
+{
+    2d16:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    2d19:	68 88 50 00 00       	push   $0x5088
+    2d1e:	6a 01                	push   $0x1
+    2d20:	e8 8b 12 00 00       	call   3fb0 <printf>
+    2d25:	83 c4 10             	add    $0x10,%esp
+    2d28:	eb 13                	jmp    2d3d <forktest+0x2d>
+    2d2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    2d30:	74 4d                	je     2d7f <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    2d32:	83 c3 01             	add    $0x1,%ebx
+    2d35:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    2d3b:	74 6e                	je     2dab <forktest+0x9b>
+    pid = fork();
+    2d3d:	e8 b6 10 00 00       	call   3df8 <fork>
+    if(pid < 0)
+    2d42:	85 c0                	test   %eax,%eax
+    2d44:	79 ea                	jns    2d30 <forktest+0x20>
+  for(; n > 0; n--){
+    2d46:	85 db                	test   %ebx,%ebx
+    2d48:	74 14                	je     2d5e <forktest+0x4e>
+    2d4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    2d50:	e8 b3 10 00 00       	call   3e08 <wait>
+    2d55:	85 c0                	test   %eax,%eax
+    2d57:	78 2b                	js     2d84 <forktest+0x74>
+  for(; n > 0; n--){
+    2d59:	83 eb 01             	sub    $0x1,%ebx
+    2d5c:	75 f2                	jne    2d50 <forktest+0x40>
+  if(wait() != -1){
+    2d5e:	e8 a5 10 00 00       	call   3e08 <wait>
+    2d63:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2d66:	75 30                	jne    2d98 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    2d68:	83 ec 08             	sub    $0x8,%esp
+    2d6b:	68 ba 50 00 00       	push   $0x50ba
+    2d70:	6a 01                	push   $0x1
+    2d72:	e8 39 12 00 00       	call   3fb0 <printf>
+}
+    2d77:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2d7a:	83 c4 10             	add    $0x10,%esp
+    2d7d:	c9                   	leave
+    2d7e:	c3                   	ret
+      exit();
+    2d7f:	e8 7c 10 00 00       	call   3e00 <exit>
+      printf(1, "wait stopped early\n");
+    2d84:	83 ec 08             	sub    $0x8,%esp
+    2d87:	68 93 50 00 00       	push   $0x5093
+    2d8c:	6a 01                	push   $0x1
+    2d8e:	e8 1d 12 00 00       	call   3fb0 <printf>
+      exit();
+    2d93:	e8 68 10 00 00       	call   3e00 <exit>
+    printf(1, "wait got too many\n");
+    2d98:	50                   	push   %eax
+    2d99:	50                   	push   %eax
+    2d9a:	68 a7 50 00 00       	push   $0x50a7
+    2d9f:	6a 01                	push   $0x1
+    2da1:	e8 0a 12 00 00       	call   3fb0 <printf>
+    exit();
+    2da6:	e8 55 10 00 00       	call   3e00 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    2dab:	52                   	push   %edx
+    2dac:	52                   	push   %edx
+    2dad:	68 cc 58 00 00       	push   $0x58cc
+    2db2:	6a 01                	push   $0x1
+    2db4:	e8 f7 11 00 00       	call   3fb0 <printf>
+    exit();
+    2db9:	e8 42 10 00 00       	call   3e00 <exit>
+    2dbe:	66 90                	xchg   %ax,%ax
+
+00002dc0 <clonetest>:
+{
+    2dc0:	55                   	push   %ebp
+    2dc1:	89 e5                	mov    %esp,%ebp
+    2dc3:	57                   	push   %edi
+    2dc4:	56                   	push   %esi
+    2dc5:	53                   	push   %ebx
+    2dc6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "clone test\n");
+    2dc9:	68 c8 50 00 00       	push   $0x50c8
+    2dce:	6a 01                	push   $0x1
+    2dd0:	e8 db 11 00 00       	call   3fb0 <printf>
+  if((stack = malloc(4096)) == 0){
+    2dd5:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+    2ddc:	e8 0f 14 00 00       	call   41f0 <malloc>
+    2de1:	83 c4 10             	add    $0x10,%esp
+    2de4:	85 c0                	test   %eax,%eax
+    2de6:	0f 84 ad 00 00 00    	je     2e99 <clonetest+0xd9>
+  threadval = 1;
+    2dec:	c7 05 6c ae 00 00 01 	movl   $0x1,0xae6c
+    2df3:	00 00 00 
+    2df6:	89 c3                	mov    %eax,%ebx
+  if((pid = clone(threadadd, (void*)2, (void*)3, stack)) < 0){
+    2df8:	50                   	push   %eax
+    2df9:	6a 03                	push   $0x3
+    2dfb:	6a 02                	push   $0x2
+    2dfd:	68 30 01 00 00       	push   $0x130
+    2e02:	e8 e9 10 00 00       	call   3ef0 <clone>
+    2e07:	83 c4 10             	add    $0x10,%esp
+    2e0a:	89 c6                	mov    %eax,%esi
+    2e0c:	85 c0                	test   %eax,%eax
+    2e0e:	0f 88 f7 00 00 00    	js     2f0b <clonetest+0x14b>
+  if(join(&st) != pid){
+    2e14:	83 ec 0c             	sub    $0xc,%esp
+    2e17:	8d 7d e4             	lea    -0x1c(%ebp),%edi
+    2e1a:	57                   	push   %edi
+    2e1b:	e8 d8 10 00 00       	call   3ef8 <join>
+    2e20:	83 c4 10             	add    $0x10,%esp
+    2e23:	39 f0                	cmp    %esi,%eax
+    2e25:	0f 85 cd 00 00 00    	jne    2ef8 <clonetest+0x138>
+  if(st != stack){
+    2e2b:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+    2e2e:	0f 85 b1 00 00 00    	jne    2ee5 <clonetest+0x125>
+  if(threadval != 6){
+    2e34:	a1 6c ae 00 00       	mov    0xae6c,%eax
+    2e39:	83 f8 06             	cmp    $0x6,%eax
+    2e3c:	0f 85 90 00 00 00    	jne    2ed2 <clonetest+0x112>
+  if(join(&st) != -1){
+    2e42:	83 ec 0c             	sub    $0xc,%esp
+    2e45:	57                   	push   %edi
+    2e46:	e8 ad 10 00 00       	call   3ef8 <join>
+    2e4b:	83 c4 10             	add    $0x10,%esp
+    2e4e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2e51:	75 6c                	jne    2ebf <clonetest+0xff>
+  if(clone(threadadd, 0, 0, sbrk(0) - 100) != -1){
+    2e53:	83 ec 0c             	sub    $0xc,%esp
+    2e56:	6a 00                	push   $0x0
+    2e58:	e8 2b 10 00 00       	call   3e88 <sbrk>
+    2e5d:	83 e8 64             	sub    $0x64,%eax
+    2e60:	50                   	push   %eax
+    2e61:	6a 00                	push   $0x0
+    2e63:	6a 00                	push   $0x0
+    2e65:	68 30 01 00 00       	push   $0x130
+    2e6a:	e8 81 10 00 00       	call   3ef0 <clone>
+    2e6f:	83 c4 20             	add    $0x20,%esp
+    2e72:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2e75:	75 35                	jne    2eac <clonetest+0xec>
+  free(stack);
+    2e77:	83 ec 0c             	sub    $0xc,%esp
+    2e7a:	53                   	push   %ebx
+    2e7b:	e8 e0 12 00 00       	call   4160 <free>
+  printf(1, "clone test OK\n");
+    2e80:	58                   	pop    %eax
+    2e81:	5a                   	pop    %edx
+    2e82:	68 01 51 00 00       	push   $0x5101
+    2e87:	6a 01                	push   $0x1
+    2e89:	e8 22 11 00 00       	call   3fb0 <printf>
+}
+    2e8e:	83 c4 10             	add    $0x10,%esp
+    2e91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2e94:	5b                   	pop    %ebx
+    2e95:	5e                   	pop    %esi
+    2e96:	5f                   	pop    %edi
+    2e97:	5d                   	pop    %ebp
+    2e98:	c3                   	ret
+    printf(1, "malloc failed\n");
+    2e99:	50                   	push   %eax
+    2e9a:	50                   	push   %eax
+    2e9b:	68 d4 50 00 00       	push   $0x50d4
+    2ea0:	6a 01                	push   $0x1
+    2ea2:	e8 09 11 00 00       	call   3fb0 <printf>
+    exit();
+    2ea7:	e8 54 0f 00 00       	call   3e00 <exit>
+    printf(1, "clone with a stack past the end succeeded\n");
+    2eac:	51                   	push   %ecx
+    2ead:	51                   	push   %ecx
+    2eae:	68 54 59 00 00       	push   $0x5954
+    2eb3:	6a 01                	push   $0x1
+    2eb5:	e8 f6 10 00 00       	call   3fb0 <printf>
+    exit();
+    2eba:	e8 41 0f 00 00       	call   3e00 <exit>
+    printf(1, "join without threads succeeded\n");
+    2ebf:	53                   	push   %ebx
+    2ec0:	53                   	push   %ebx
+    2ec1:	68 34 59 00 00       	push   $0x5934
+    2ec6:	6a 01                	push   $0x1
+    2ec8:	e8 e3 10 00 00       	call   3fb0 <printf>
+    exit();
+    2ecd:	e8 2e 0f 00 00       	call   3e00 <exit>
+    printf(1, "clone: thread's memory not shared\n");
+    2ed2:	56                   	push   %esi
+    2ed3:	56                   	push   %esi
+    2ed4:	68 10 59 00 00       	push   $0x5910
+    2ed9:	6a 01                	push   $0x1
+    2edb:	e8 d0 10 00 00       	call   3fb0 <printf>
+    exit();
+    2ee0:	e8 1b 0f 00 00       	call   3e00 <exit>
+    printf(1, "join returned the wrong stack\n");
+    2ee5:	57                   	push   %edi
+    2ee6:	57                   	push   %edi
+    2ee7:	68 f0 58 00 00       	push   $0x58f0
+    2eec:	6a 01                	push   $0x1
+    2eee:	e8 bd 10 00 00       	call   3fb0 <printf>
+    exit();
+    2ef3:	e8 08 0f 00 00       	call   3e00 <exit>
+    printf(1, "join wrong pid\n");
+    2ef8:	50                   	push   %eax
+    2ef9:	50                   	push   %eax
+    2efa:	68 f1 50 00 00       	push   $0x50f1
+    2eff:	6a 01                	push   $0x1
+    2f01:	e8 aa 10 00 00       	call   3fb0 <printf>
+    exit();
+    2f06:	e8 f5 0e 00 00       	call   3e00 <exit>
+    printf(1, "clone failed\n");
+    2f0b:	50                   	push   %eax
+    2f0c:	50                   	push   %eax
+    2f0d:	68 e3 50 00 00       	push   $0x50e3
+    2f12:	6a 01                	push   $0x1
+    2f14:	e8 97 10 00 00       	call   3fb0 <printf>
+    exit();
+    2f19:	e8 e2 0e 00 00       	call   3e00 <exit>
+    2f1e:	66 90                	xchg   %ax,%ax
+
+00002f20 <clonesbrktest>:
+{
+    2f20:	55                   	push   %ebp
+    2f21:	89 e5                	mov    %esp,%ebp
+    2f23:	56                   	push   %esi
+    2f24:	53                   	push   %ebx
+    2f25:	83 ec 18             	sub    $0x18,%esp
+  printf(1, "clone sbrk test\n");
+    2f28:	68 10 51 00 00       	push   $0x5110
+    2f2d:	6a 01                	push   $0x1
+    2f2f:	e8 7c 10 00 00       	call   3fb0 <printf>
+  if(pipe(sbrkfds) < 0){
+    2f34:	c7 04 24 64 ae 00 00 	movl   $0xae64,(%esp)
+    2f3b:	e8 d0 0e 00 00       	call   3e10 <pipe>
+    2f40:	83 c4 10             	add    $0x10,%esp
+    2f43:	85 c0                	test   %eax,%eax
+    2f45:	0f 88 c5 00 00 00    	js     3010 <clonesbrktest+0xf0>
+  if((stack = malloc(4096)) == 0){
+    2f4b:	83 ec 0c             	sub    $0xc,%esp
+    2f4e:	68 00 10 00 00       	push   $0x1000
+    2f53:	e8 98 12 00 00       	call   41f0 <malloc>
+    2f58:	83 c4 10             	add    $0x10,%esp
+    2f5b:	89 c3                	mov    %eax,%ebx
+    2f5d:	85 c0                	test   %eax,%eax
+    2f5f:	0f 84 2e 01 00 00    	je     3093 <clonesbrktest+0x173>
+  if(clone(threadread, 0, 0, stack) < 0){
+    2f65:	50                   	push   %eax
+    2f66:	6a 00                	push   $0x0
+    2f68:	6a 00                	push   $0x0
+    2f6a:	68 50 01 00 00       	push   $0x150
+    2f6f:	e8 7c 0f 00 00       	call   3ef0 <clone>
+    2f74:	83 c4 10             	add    $0x10,%esp
+    2f77:	85 c0                	test   %eax,%eax
+    2f79:	0f 88 01 01 00 00    	js     3080 <clonesbrktest+0x160>
+  a = sbrk(4096);
+    2f7f:	83 ec 0c             	sub    $0xc,%esp
+    2f82:	68 00 10 00 00       	push   $0x1000
+    2f87:	e8 fc 0e 00 00       	call   3e88 <sbrk>
+    2f8c:	89 c6                	mov    %eax,%esi
+  if((pid = fork()) < 0){
+    2f8e:	e8 65 0e 00 00       	call   3df8 <fork>
+    2f93:	83 c4 10             	add    $0x10,%esp
+    2f96:	85 c0                	test   %eax,%eax
+    2f98:	0f 88 cf 00 00 00    	js     306d <clonesbrktest+0x14d>
+  if(pid == 0){
+    2f9e:	0f 84 a5 00 00 00    	je     3049 <clonesbrktest+0x129>
+  if(sbrk(-4096) != a + 4096){
+    2fa4:	83 ec 0c             	sub    $0xc,%esp
+    2fa7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    2fad:	68 00 f0 ff ff       	push   $0xfffff000
+    2fb2:	e8 d1 0e 00 00       	call   3e88 <sbrk>
+    2fb7:	83 c4 10             	add    $0x10,%esp
+    2fba:	39 c6                	cmp    %eax,%esi
+    2fbc:	75 78                	jne    3036 <clonesbrktest+0x116>
+  if(join(&st) < 0){
+    2fbe:	83 ec 0c             	sub    $0xc,%esp
+    2fc1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    2fc4:	50                   	push   %eax
+    2fc5:	e8 2e 0f 00 00       	call   3ef8 <join>
+    2fca:	83 c4 10             	add    $0x10,%esp
+    2fcd:	85 c0                	test   %eax,%eax
+    2fcf:	78 52                	js     3023 <clonesbrktest+0x103>
+  wait();
+    2fd1:	e8 32 0e 00 00       	call   3e08 <wait>
+  close(sbrkfds[0]);
+    2fd6:	83 ec 0c             	sub    $0xc,%esp
+    2fd9:	ff 35 64 ae 00 00    	push   0xae64
+    2fdf:	e8 44 0e 00 00       	call   3e28 <close>
+  close(sbrkfds[1]);
+    2fe4:	58                   	pop    %eax
+    2fe5:	ff 35 68 ae 00 00    	push   0xae68
+    2feb:	e8 38 0e 00 00       	call   3e28 <close>
+  free(stack);
+    2ff0:	89 1c 24             	mov    %ebx,(%esp)
+    2ff3:	e8 68 11 00 00       	call   4160 <free>
+  printf(1, "clone sbrk test OK\n");
+    2ff8:	5a                   	pop    %edx
+    2ff9:	59                   	pop    %ecx
+    2ffa:	68 3b 51 00 00       	push   $0x513b
+    2fff:	6a 01                	push   $0x1
+    3001:	e8 aa 0f 00 00       	call   3fb0 <printf>
+}
+    3006:	83 c4 10             	add    $0x10,%esp
+    3009:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    300c:	5b                   	pop    %ebx
+    300d:	5e                   	pop    %esi
+    300e:	5d                   	pop    %ebp
+    300f:	c3                   	ret
+    printf(1, "pipe failed\n");
+    3010:	50                   	push   %eax
+    3011:	50                   	push   %eax
+    3012:	68 21 51 00 00       	push   $0x5121
+    3017:	6a 01                	push   $0x1
+    3019:	e8 92 0f 00 00       	call   3fb0 <printf>
+    exit();
+    301e:	e8 dd 0d 00 00       	call   3e00 <exit>
+    printf(1, "join failed\n");
+    3023:	53                   	push   %ebx
+    3024:	53                   	push   %ebx
+    3025:	68 2e 51 00 00       	push   $0x512e
+    302a:	6a 01                	push   $0x1
+    302c:	e8 7f 0f 00 00       	call   3fb0 <printf>
+    exit();
+    3031:	e8 ca 0d 00 00       	call   3e00 <exit>
+    printf(1, "sbrk(-4096) with a blocked thread failed\n");
+    3036:	56                   	push   %esi
+    3037:	56                   	push   %esi
+    3038:	68 80 59 00 00       	push   $0x5980
+    303d:	6a 01                	push   $0x1
+    303f:	e8 6c 0f 00 00       	call   3fb0 <printf>
+    exit();
+    3044:	e8 b7 0d 00 00       	call   3e00 <exit>
+    sleep(5);   // the thread is most likely blocked in read() by now
+    3049:	83 ec 0c             	sub    $0xc,%esp
+    304c:	6a 05                	push   $0x5
+    304e:	e8 3d 0e 00 00       	call   3e90 <sleep>
+    write(sbrkfds[1], "x", 1);
+    3053:	83 c4 0c             	add    $0xc,%esp
+    3056:	6a 01                	push   $0x1
+    3058:	68 31 4c 00 00       	push   $0x4c31
+    305d:	ff 35 68 ae 00 00    	push   0xae68
+    3063:	e8 b8 0d 00 00       	call   3e20 <write>
+    exit();
+    3068:	e8 93 0d 00 00       	call   3e00 <exit>
+    printf(1, "fork failed\n");
+    306d:	50                   	push   %eax
+    306e:	50                   	push   %eax
+    306f:	68 bf 52 00 00       	push   $0x52bf
+    3074:	6a 01                	push   $0x1
+    3076:	e8 35 0f 00 00       	call   3fb0 <printf>
+    exit();
+    307b:	e8 80 0d 00 00       	call   3e00 <exit>
+    printf(1, "clone failed\n");
+    3080:	50                   	push   %eax
+    3081:	50                   	push   %eax
+    3082:	68 e3 50 00 00       	push   $0x50e3
+    3087:	6a 01                	push   $0x1
+    3089:	e8 22 0f 00 00       	call   3fb0 <printf>
+    exit();
+    308e:	e8 6d 0d 00 00       	call   3e00 <exit>
+    printf(1, "malloc failed\n");
+    3093:	50                   	push   %eax
+    3094:	50                   	push   %eax
+    3095:	68 d4 50 00 00       	push   $0x50d4
+    309a:	6a 01                	push   $0x1
+    309c:	e8 0f 0f 00 00       	call   3fb0 <printf>
+    exit();
+    30a1:	e8 5a 0d 00 00       	call   3e00 <exit>
+    30a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    30ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000030b0 <futextest>:
+{
+    30b0:	55                   	push   %ebp
+    30b1:	89 e5                	mov    %esp,%ebp
+    30b3:	53                   	push   %ebx
+    30b4:	83 ec 1c             	sub    $0x1c,%esp
+  printf(1, "futex test\n");
+    30b7:	68 4f 51 00 00       	push   $0x514f
+    30bc:	6a 01                	push   $0x1
+    30be:	e8 ed 0e 00 00       	call   3fb0 <printf>
+  futexword = 1;
+    30c3:	c7 05 60 ae 00 00 01 	movl   $0x1,0xae60
+    30ca:	00 00 00 
+  if(futex_wait(&futexword, 0) != -1){
+    30cd:	58                   	pop    %eax
+    30ce:	5a                   	pop    %edx
+    30cf:	6a 00                	push   $0x0
+    30d1:	68 60 ae 00 00       	push   $0xae60
+    30d6:	e8 25 0e 00 00       	call   3f00 <futex_wait>
+    30db:	83 c4 10             	add    $0x10,%esp
+    30de:	83 f8 ff             	cmp    $0xffffffff,%eax
+    30e1:	0f 85 fe 00 00 00    	jne    31e5 <futextest+0x135>
+  if(futex_wait((uint*)((char*)&futexword + 1), 0) != -1){
+    30e7:	83 ec 08             	sub    $0x8,%esp
+    30ea:	6a 00                	push   $0x0
+    30ec:	68 61 ae 00 00       	push   $0xae61
+    30f1:	e8 0a 0e 00 00       	call   3f00 <futex_wait>
+    30f6:	83 c4 10             	add    $0x10,%esp
+    30f9:	83 f8 ff             	cmp    $0xffffffff,%eax
+    30fc:	0f 85 d0 00 00 00    	jne    31d2 <futextest+0x122>
+  if((stack = malloc(4096)) == 0){
+    3102:	83 ec 0c             	sub    $0xc,%esp
+    3105:	68 00 10 00 00       	push   $0x1000
+    310a:	e8 e1 10 00 00       	call   41f0 <malloc>
+    310f:	83 c4 10             	add    $0x10,%esp
+    3112:	89 c3                	mov    %eax,%ebx
+    3114:	85 c0                	test   %eax,%eax
+    3116:	0f 84 a3 00 00 00    	je     31bf <futextest+0x10f>
+  futexword = 0;
+    311c:	c7 05 60 ae 00 00 00 	movl   $0x0,0xae60
+    3123:	00 00 00 
+  if(clone(futexwaiter, 0, 0, stack) < 0){
+    3126:	50                   	push   %eax
+    3127:	6a 00                	push   $0x0
+    3129:	6a 00                	push   $0x0
+    312b:	68 70 01 00 00       	push   $0x170
+    3130:	e8 bb 0d 00 00       	call   3ef0 <clone>
+    3135:	83 c4 10             	add    $0x10,%esp
+    3138:	85 c0                	test   %eax,%eax
+    313a:	78 70                	js     31ac <futextest+0xfc>
+  sleep(2);   // most likely asleep in futex_wait() by now
+    313c:	83 ec 0c             	sub    $0xc,%esp
+    313f:	6a 02                	push   $0x2
+    3141:	e8 4a 0d 00 00       	call   3e90 <sleep>
+  futexword = 1;
+    3146:	c7 05 60 ae 00 00 01 	movl   $0x1,0xae60
+    314d:	00 00 00 
+  futex_wake(&futexword, 1);
+    3150:	58                   	pop    %eax
+    3151:	5a                   	pop    %edx
+    3152:	6a 01                	push   $0x1
+    3154:	68 60 ae 00 00       	push   $0xae60
+    3159:	e8 aa 0d 00 00       	call   3f08 <futex_wake>
+  if(join(&st) < 0 || futexword != 2){
+    315e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    3161:	89 04 24             	mov    %eax,(%esp)
+    3164:	e8 8f 0d 00 00       	call   3ef8 <join>
+    3169:	83 c4 10             	add    $0x10,%esp
+    316c:	85 c0                	test   %eax,%eax
+    316e:	78 29                	js     3199 <futextest+0xe9>
+    3170:	a1 60 ae 00 00       	mov    0xae60,%eax
+    3175:	83 f8 02             	cmp    $0x2,%eax
+    3178:	75 1f                	jne    3199 <futextest+0xe9>
+  free(stack);
+    317a:	83 ec 0c             	sub    $0xc,%esp
+    317d:	53                   	push   %ebx
+    317e:	e8 dd 0f 00 00       	call   4160 <free>
+  printf(1, "futex test OK\n");
+    3183:	58                   	pop    %eax
+    3184:	5a                   	pop    %edx
+    3185:	68 78 51 00 00       	push   $0x5178
+    318a:	6a 01                	push   $0x1
+    318c:	e8 1f 0e 00 00       	call   3fb0 <printf>
+}
+    3191:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3194:	83 c4 10             	add    $0x10,%esp
+    3197:	c9                   	leave
+    3198:	c3                   	ret
+    printf(1, "futex waiter did not finish\n");
+    3199:	51                   	push   %ecx
+    319a:	51                   	push   %ecx
+    319b:	68 5b 51 00 00       	push   $0x515b
+    31a0:	6a 01                	push   $0x1
+    31a2:	e8 09 0e 00 00       	call   3fb0 <printf>
+    exit();
+    31a7:	e8 54 0c 00 00       	call   3e00 <exit>
+    printf(1, "clone failed\n");
+    31ac:	51                   	push   %ecx
+    31ad:	51                   	push   %ecx
+    31ae:	68 e3 50 00 00       	push   $0x50e3
+    31b3:	6a 01                	push   $0x1
+    31b5:	e8 f6 0d 00 00       	call   3fb0 <printf>
+    exit();
+    31ba:	e8 41 0c 00 00       	call   3e00 <exit>
+    printf(1, "malloc failed\n");
+    31bf:	53                   	push   %ebx
+    31c0:	53                   	push   %ebx
+    31c1:	68 d4 50 00 00       	push   $0x50d4
+    31c6:	6a 01                	push   $0x1
+    31c8:	e8 e3 0d 00 00       	call   3fb0 <printf>
+    exit();
+    31cd:	e8 2e 0c 00 00       	call   3e00 <exit>
+    printf(1, "futex_wait took an unaligned address\n");
+    31d2:	50                   	push   %eax
+    31d3:	50                   	push   %eax
+    31d4:	68 d4 59 00 00       	push   $0x59d4
+    31d9:	6a 01                	push   $0x1
+    31db:	e8 d0 0d 00 00       	call   3fb0 <printf>
+    exit();
+    31e0:	e8 1b 0c 00 00       	call   3e00 <exit>
+    printf(1, "futex_wait slept on a changed value\n");
+    31e5:	50                   	push   %eax
+    31e6:	50                   	push   %eax
+    31e7:	68 ac 59 00 00       	push   $0x59ac
+    31ec:	6a 01                	push   $0x1
+    31ee:	e8 bd 0d 00 00       	call   3fb0 <printf>
+    exit();
+    31f3:	e8 08 0c 00 00       	call   3e00 <exit>
+    31f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    31ff:	90                   	nop
+
+00003200 <sbrktest>:
+{
+    3200:	55                   	push   %ebp
+    3201:	89 e5                	mov    %esp,%ebp
+    3203:	57                   	push   %edi
+    3204:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    3205:	31 f6                	xor    %esi,%esi
+{
+    3207:	53                   	push   %ebx
+    3208:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    320b:	68 16 51 00 00       	push   $0x5116
+    3210:	ff 35 90 66 00 00    	push   0x6690
+    3216:	e8 95 0d 00 00       	call   3fb0 <printf>
+  oldbrk = sbrk(0);
+    321b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3222:	e8 61 0c 00 00       	call   3e88 <sbrk>
+    3227:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    322a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3231:	e8 52 0c 00 00       	call   3e88 <sbrk>
+    3236:	83 c4 10             	add    $0x10,%esp
+    3239:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    323b:	eb 05                	jmp    3242 <sbrktest+0x42>
+    323d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    3240:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    3242:	83 ec 0c             	sub    $0xc,%esp
+    3245:	6a 01                	push   $0x1
+    3247:	e8 3c 0c 00 00       	call   3e88 <sbrk>
+    if(b != a){
+    324c:	83 c4 10             	add    $0x10,%esp
+    324f:	39 d8                	cmp    %ebx,%eax
+    3251:	0f 85 9c 02 00 00    	jne    34f3 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    3257:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    325a:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    325d:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    3260:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    3266:	75 d8                	jne    3240 <sbrktest+0x40>
+  pid = fork();
+    3268:	e8 8b 0b 00 00       	call   3df8 <fork>
+    326d:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    326f:	85 c0                	test   %eax,%eax
+    3271:	0f 88 02 03 00 00    	js     3579 <sbrktest+0x379>
+  c = sbrk(1);
+    3277:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    327a:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    327d:	6a 01                	push   $0x1
+    327f:	e8 04 0c 00 00       	call   3e88 <sbrk>
+  c = sbrk(1);
+    3284:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    328b:	e8 f8 0b 00 00       	call   3e88 <sbrk>
+  if(c != a + 1){
+    3290:	83 c4 10             	add    $0x10,%esp
+    3293:	39 c3                	cmp    %eax,%ebx
+    3295:	0f 85 3b 03 00 00    	jne    35d6 <sbrktest+0x3d6>
+  if(pid == 0)
+    329b:	85 f6                	test   %esi,%esi
+    329d:	0f 84 2e 03 00 00    	je     35d1 <sbrktest+0x3d1>
+  wait();
+    32a3:	e8 60 0b 00 00       	call   3e08 <wait>
+  a = sbrk(0);
+    32a8:	83 ec 0c             	sub    $0xc,%esp
+    32ab:	6a 00                	push   $0x0
+    32ad:	e8 d6 0b 00 00       	call   3e88 <sbrk>
+    32b2:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    32b4:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    32b9:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    32bb:	89 04 24             	mov    %eax,(%esp)
+    32be:	e8 c5 0b 00 00       	call   3e88 <sbrk>
+  if (p != a) {
+    32c3:	83 c4 10             	add    $0x10,%esp
+    32c6:	39 c3                	cmp    %eax,%ebx
+    32c8:	0f 85 94 02 00 00    	jne    3562 <sbrktest+0x362>
+  a = sbrk(0);
+    32ce:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    32d1:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    32d8:	6a 00                	push   $0x0
+    32da:	e8 a9 0b 00 00       	call   3e88 <sbrk>
+  c = sbrk(-4096);
+    32df:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    32e6:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    32e8:	e8 9b 0b 00 00       	call   3e88 <sbrk>
+  if(c == (char*)0xffffffff){
+    32ed:	83 c4 10             	add    $0x10,%esp
+    32f0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    32f3:	0f 84 22 03 00 00    	je     361b <sbrktest+0x41b>
+  c = sbrk(0);
+    32f9:	83 ec 0c             	sub    $0xc,%esp
+    32fc:	6a 00                	push   $0x0
+    32fe:	e8 85 0b 00 00       	call   3e88 <sbrk>
+  if(c != a - 4096){
+    3303:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    3309:	83 c4 10             	add    $0x10,%esp
+    330c:	39 d0                	cmp    %edx,%eax
+    330e:	0f 85 f0 02 00 00    	jne    3604 <sbrktest+0x404>
+  a = sbrk(0);
+    3314:	83 ec 0c             	sub    $0xc,%esp
+    3317:	6a 00                	push   $0x0
+    3319:	e8 6a 0b 00 00       	call   3e88 <sbrk>
+  c = sbrk(4096);
+    331e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    3325:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    3327:	e8 5c 0b 00 00       	call   3e88 <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    332c:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    332f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    3331:	39 c3                	cmp    %eax,%ebx
+    3333:	0f 85 b4 02 00 00    	jne    35ed <sbrktest+0x3ed>
+    3339:	83 ec 0c             	sub    $0xc,%esp
+    333c:	6a 00                	push   $0x0
+    333e:	e8 45 0b 00 00       	call   3e88 <sbrk>
+    3343:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    3349:	83 c4 10             	add    $0x10,%esp
+    334c:	39 c2                	cmp    %eax,%edx
+    334e:	0f 85 99 02 00 00    	jne    35ed <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    3354:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    335b:	0f 84 2f 02 00 00    	je     3590 <sbrktest+0x390>
+  a = sbrk(0);
+    3361:	83 ec 0c             	sub    $0xc,%esp
+    3364:	6a 00                	push   $0x0
+    3366:	e8 1d 0b 00 00       	call   3e88 <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    336b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    3372:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3374:	e8 0f 0b 00 00       	call   3e88 <sbrk>
+    3379:	89 c2                	mov    %eax,%edx
+    337b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    337e:	29 d0                	sub    %edx,%eax
+    3380:	89 04 24             	mov    %eax,(%esp)
+    3383:	e8 00 0b 00 00       	call   3e88 <sbrk>
+  if(c != a){
+    3388:	83 c4 10             	add    $0x10,%esp
+    338b:	39 c3                	cmp    %eax,%ebx
+    338d:	0f 85 b8 01 00 00    	jne    354b <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3393:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    3398:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    339f:	90                   	nop
+    ppid = getpid();
+    33a0:	e8 db 0a 00 00       	call   3e80 <getpid>
+    33a5:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    33a7:	e8 4c 0a 00 00       	call   3df8 <fork>
+    if(pid < 0){
+    33ac:	85 c0                	test   %eax,%eax
+    33ae:	0f 88 5d 01 00 00    	js     3511 <sbrktest+0x311>
+    if(pid == 0){
+    33b4:	0f 84 6f 01 00 00    	je     3529 <sbrktest+0x329>
+    wait();
+    33ba:	e8 49 0a 00 00       	call   3e08 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    33bf:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    33c5:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    33cb:	75 d3                	jne    33a0 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    33cd:	83 ec 0c             	sub    $0xc,%esp
+    33d0:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    33d3:	50                   	push   %eax
+    33d4:	e8 37 0a 00 00       	call   3e10 <pipe>
+    33d9:	83 c4 10             	add    $0x10,%esp
+    33dc:	85 c0                	test   %eax,%eax
+    33de:	0f 85 da 01 00 00    	jne    35be <sbrktest+0x3be>
+    33e4:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    33e7:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    33ea:	89 df                	mov    %ebx,%edi
+    33ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    33f0:	e8 03 0a 00 00       	call   3df8 <fork>
+    33f5:	89 07                	mov    %eax,(%edi)
+    33f7:	85 c0                	test   %eax,%eax
+    33f9:	0f 84 91 00 00 00    	je     3490 <sbrktest+0x290>
+    if(pids[i] != -1)
+    33ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3402:	74 14                	je     3418 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    3404:	83 ec 04             	sub    $0x4,%esp
+    3407:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    340a:	6a 01                	push   $0x1
+    340c:	50                   	push   %eax
+    340d:	ff 75 b8             	push   -0x48(%ebp)
+    3410:	e8 03 0a 00 00       	call   3e18 <read>
+    3415:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3418:	83 c7 04             	add    $0x4,%edi
+    341b:	39 f7                	cmp    %esi,%edi
+    341d:	75 d1                	jne    33f0 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    341f:	83 ec 0c             	sub    $0xc,%esp
+    3422:	68 00 10 00 00       	push   $0x1000
+    3427:	e8 5c 0a 00 00       	call   3e88 <sbrk>
+    342c:	83 c4 10             	add    $0x10,%esp
+    342f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3431:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    3438:	8b 03                	mov    (%ebx),%eax
+    343a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    343d:	74 11                	je     3450 <sbrktest+0x250>
+    kill(pids[i]);
+    343f:	83 ec 0c             	sub    $0xc,%esp
+    3442:	50                   	push   %eax
+    3443:	e8 e8 09 00 00       	call   3e30 <kill>
+    wait();
+    3448:	e8 bb 09 00 00       	call   3e08 <wait>
+    344d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3450:	83 c3 04             	add    $0x4,%ebx
+    3453:	39 f3                	cmp    %esi,%ebx
+    3455:	75 e1                	jne    3438 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    3457:	83 ff ff             	cmp    $0xffffffff,%edi
+    345a:	0f 84 47 01 00 00    	je     35a7 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    3460:	83 ec 0c             	sub    $0xc,%esp
+    3463:	6a 00                	push   $0x0
+    3465:	e8 1e 0a 00 00       	call   3e88 <sbrk>
+    346a:	83 c4 10             	add    $0x10,%esp
+    346d:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    3470:	72 60                	jb     34d2 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    3472:	83 ec 08             	sub    $0x8,%esp
+    3475:	68 41 51 00 00       	push   $0x5141
+    347a:	ff 35 90 66 00 00    	push   0x6690
+    3480:	e8 2b 0b 00 00       	call   3fb0 <printf>
+}
+    3485:	83 c4 10             	add    $0x10,%esp
+    3488:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    348b:	5b                   	pop    %ebx
+    348c:	5e                   	pop    %esi
+    348d:	5f                   	pop    %edi
+    348e:	5d                   	pop    %ebp
+    348f:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    3490:	83 ec 0c             	sub    $0xc,%esp
+    3493:	6a 00                	push   $0x0
+    3495:	e8 ee 09 00 00       	call   3e88 <sbrk>
+    349a:	89 c2                	mov    %eax,%edx
+    349c:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    34a1:	29 d0                	sub    %edx,%eax
+    34a3:	89 04 24             	mov    %eax,(%esp)
+    34a6:	e8 dd 09 00 00       	call   3e88 <sbrk>
+      write(fds[1], "x", 1);
+    34ab:	83 c4 0c             	add    $0xc,%esp
+    34ae:	6a 01                	push   $0x1
+    34b0:	68 31 4c 00 00       	push   $0x4c31
+    34b5:	ff 75 bc             	push   -0x44(%ebp)
+    34b8:	e8 63 09 00 00       	call   3e20 <write>
+    34bd:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    34c0:	83 ec 0c             	sub    $0xc,%esp
+    34c3:	68 e8 03 00 00       	push   $0x3e8
+    34c8:	e8 c3 09 00 00       	call   3e90 <sleep>
+    34cd:	83 c4 10             	add    $0x10,%esp
+    34d0:	eb ee                	jmp    34c0 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    34d2:	83 ec 0c             	sub    $0xc,%esp
+    34d5:	6a 00                	push   $0x0
+    34d7:	e8 ac 09 00 00       	call   3e88 <sbrk>
+    34dc:	89 c2                	mov    %eax,%edx
+    34de:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    34e1:	29 d0                	sub    %edx,%eax
+    34e3:	89 04 24             	mov    %eax,(%esp)
+    34e6:	e8 9d 09 00 00       	call   3e88 <sbrk>
+    34eb:	83 c4 10             	add    $0x10,%esp
+    34ee:	e9 7f ff ff ff       	jmp    3472 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    34f3:	83 ec 0c             	sub    $0xc,%esp
+    34f6:	50                   	push   %eax
+    34f7:	53                   	push   %ebx
+    34f8:	56                   	push   %esi
+    34f9:	68 87 51 00 00       	push   $0x5187
+    34fe:	ff 35 90 66 00 00    	push   0x6690
+    3504:	e8 a7 0a 00 00       	call   3fb0 <printf>
+      exit();
+    3509:	83 c4 20             	add    $0x20,%esp
+    350c:	e8 ef 08 00 00       	call   3e00 <exit>
+      printf(stdout, "fork failed\n");
+    3511:	83 ec 08             	sub    $0x8,%esp
+    3514:	68 bf 52 00 00       	push   $0x52bf
+    3519:	ff 35 90 66 00 00    	push   0x6690
+    351f:	e8 8c 0a 00 00       	call   3fb0 <printf>
+      exit();
+    3524:	e8 d7 08 00 00       	call   3e00 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3529:	0f be 03             	movsbl (%ebx),%eax
+    352c:	50                   	push   %eax
+    352d:	53                   	push   %ebx
+    352e:	68 f0 51 00 00       	push   $0x51f0
+    3533:	ff 35 90 66 00 00    	push   0x6690
+    3539:	e8 72 0a 00 00       	call   3fb0 <printf>
+      kill(ppid);
+    353e:	89 34 24             	mov    %esi,(%esp)
+    3541:	e8 ea 08 00 00       	call   3e30 <kill>
+      exit();
+    3546:	e8 b5 08 00 00       	call   3e00 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    354b:	50                   	push   %eax
+    354c:	53                   	push   %ebx
+    354d:	68 cc 5a 00 00       	push   $0x5acc
+    3552:	ff 35 90 66 00 00    	push   0x6690
+    3558:	e8 53 0a 00 00       	call   3fb0 <printf>
+    exit();
+    355d:	e8 9e 08 00 00       	call   3e00 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3562:	56                   	push   %esi
+    3563:	56                   	push   %esi
+    3564:	68 fc 59 00 00       	push   $0x59fc
+    3569:	ff 35 90 66 00 00    	push   0x6690
+    356f:	e8 3c 0a 00 00       	call   3fb0 <printf>
+    exit();
+    3574:	e8 87 08 00 00       	call   3e00 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    3579:	50                   	push   %eax
+    357a:	50                   	push   %eax
+    357b:	68 a2 51 00 00       	push   $0x51a2
+    3580:	ff 35 90 66 00 00    	push   0x6690
+    3586:	e8 25 0a 00 00       	call   3fb0 <printf>
+    exit();
+    358b:	e8 70 08 00 00       	call   3e00 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3590:	51                   	push   %ecx
+    3591:	51                   	push   %ecx
+    3592:	68 9c 5a 00 00       	push   $0x5a9c
+    3597:	ff 35 90 66 00 00    	push   0x6690
+    359d:	e8 0e 0a 00 00       	call   3fb0 <printf>
+    exit();
+    35a2:	e8 59 08 00 00       	call   3e00 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    35a7:	50                   	push   %eax
+    35a8:	50                   	push   %eax
+    35a9:	68 09 52 00 00       	push   $0x5209
+    35ae:	ff 35 90 66 00 00    	push   0x6690
+    35b4:	e8 f7 09 00 00       	call   3fb0 <printf>
+    exit();
+    35b9:	e8 42 08 00 00       	call   3e00 <exit>
+    printf(1, "pipe() failed\n");
+    35be:	52                   	push   %edx
+    35bf:	52                   	push   %edx
+    35c0:	68 11 46 00 00       	push   $0x4611
+    35c5:	6a 01                	push   $0x1
+    35c7:	e8 e4 09 00 00       	call   3fb0 <printf>
+    exit();
+    35cc:	e8 2f 08 00 00       	call   3e00 <exit>
+    exit();
+    35d1:	e8 2a 08 00 00       	call   3e00 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    35d6:	57                   	push   %edi
+    35d7:	57                   	push   %edi
+    35d8:	68 b9 51 00 00       	push   $0x51b9
+    35dd:	ff 35 90 66 00 00    	push   0x6690
+    35e3:	e8 c8 09 00 00       	call   3fb0 <printf>
+    exit();
+    35e8:	e8 13 08 00 00       	call   3e00 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    35ed:	56                   	push   %esi
+    35ee:	53                   	push   %ebx
+    35ef:	68 74 5a 00 00       	push   $0x5a74
+    35f4:	ff 35 90 66 00 00    	push   0x6690
+    35fa:	e8 b1 09 00 00       	call   3fb0 <printf>
+    exit();
+    35ff:	e8 fc 07 00 00       	call   3e00 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3604:	50                   	push   %eax
+    3605:	53                   	push   %ebx
+    3606:	68 3c 5a 00 00       	push   $0x5a3c
+    360b:	ff 35 90 66 00 00    	push   0x6690
+    3611:	e8 9a 09 00 00       	call   3fb0 <printf>
+    exit();
+    3616:	e8 e5 07 00 00       	call   3e00 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    361b:	53                   	push   %ebx
+    361c:	53                   	push   %ebx
+    361d:	68 d5 51 00 00       	push   $0x51d5
+    3622:	ff 35 90 66 00 00    	push   0x6690
+    3628:	e8 83 09 00 00       	call   3fb0 <printf>
+    exit();
+    362d:	e8 ce 07 00 00       	call   3e00 <exit>
+    3632:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3639:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003640 <validateint>:
+}
+    3640:	c3                   	ret
+    3641:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    364f:	90                   	nop
+
+00003650 <validatetest>:
+{
+    3650:	55                   	push   %ebp
+    3651:	89 e5                	mov    %esp,%ebp
+    3653:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3654:	31 f6                	xor    %esi,%esi
+{
+    3656:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    3657:	83 ec 08             	sub    $0x8,%esp
+    365a:	68 24 52 00 00       	push   $0x5224
+    365f:	ff 35 90 66 00 00    	push   0x6690
+    3665:	e8 46 09 00 00       	call   3fb0 <printf>
+    366a:	83 c4 10             	add    $0x10,%esp
+    366d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    3670:	e8 83 07 00 00       	call   3df8 <fork>
+    3675:	89 c3                	mov    %eax,%ebx
+    3677:	85 c0                	test   %eax,%eax
+    3679:	74 63                	je     36de <validatetest+0x8e>
+    sleep(0);
+    367b:	83 ec 0c             	sub    $0xc,%esp
+    367e:	6a 00                	push   $0x0
+    3680:	e8 0b 08 00 00       	call   3e90 <sleep>
+    sleep(0);
+    3685:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    368c:	e8 ff 07 00 00       	call   3e90 <sleep>
+    kill(pid);
+    3691:	89 1c 24             	mov    %ebx,(%esp)
+    3694:	e8 97 07 00 00       	call   3e30 <kill>
+    wait();
+    3699:	e8 6a 07 00 00       	call   3e08 <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    369e:	58                   	pop    %eax
+    369f:	5a                   	pop    %edx
+    36a0:	56                   	push   %esi
+    36a1:	68 33 52 00 00       	push   $0x5233
+    36a6:	e8 b5 07 00 00       	call   3e60 <link>
+    36ab:	83 c4 10             	add    $0x10,%esp
+    36ae:	83 f8 ff             	cmp    $0xffffffff,%eax
+    36b1:	75 30                	jne    36e3 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    36b3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    36b9:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    36bf:	75 af                	jne    3670 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    36c1:	83 ec 08             	sub    $0x8,%esp
+    36c4:	68 57 52 00 00       	push   $0x5257
+    36c9:	ff 35 90 66 00 00    	push   0x6690
+    36cf:	e8 dc 08 00 00       	call   3fb0 <printf>
+}
+    36d4:	83 c4 10             	add    $0x10,%esp
+    36d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    36da:	5b                   	pop    %ebx
+    36db:	5e                   	pop    %esi
+    36dc:	5d                   	pop    %ebp
+    36dd:	c3                   	ret
+      exit();
+    36de:	e8 1d 07 00 00       	call   3e00 <exit>
+      printf(stdout, "link should not succeed\n");
+    36e3:	83 ec 08             	sub    $0x8,%esp
+    36e6:	68 3e 52 00 00       	push   $0x523e
+    36eb:	ff 35 90 66 00 00    	push   0x6690
+    36f1:	e8 ba 08 00 00       	call   3fb0 <printf>
+      exit();
+    36f6:	e8 05 07 00 00       	call   3e00 <exit>
+    36fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    36ff:	90                   	nop
+
+00003700 <bsstest>:
+{
+    3700:	55                   	push   %ebp
+    3701:	89 e5                	mov    %esp,%ebp
+    3703:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    3706:	68 64 52 00 00       	push   $0x5264
+    370b:	ff 35 90 66 00 00    	push   0x6690
+    3711:	e8 9a 08 00 00       	call   3fb0 <printf>
+    3716:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3719:	31 c0                	xor    %eax,%eax
+    371b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    371f:	90                   	nop
+    if(uninit[i] != '\0'){
+    3720:	80 b8 c0 66 00 00 00 	cmpb   $0x0,0x66c0(%eax)
+    3727:	75 22                	jne    374b <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    3729:	83 c0 01             	add    $0x1,%eax
+    372c:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    3731:	75 ed                	jne    3720 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    3733:	83 ec 08             	sub    $0x8,%esp
+    3736:	68 7f 52 00 00       	push   $0x527f
+    373b:	ff 35 90 66 00 00    	push   0x6690
+    3741:	e8 6a 08 00 00       	call   3fb0 <printf>
+}
+    3746:	83 c4 10             	add    $0x10,%esp
+    3749:	c9                   	leave
+    374a:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    374b:	83 ec 08             	sub    $0x8,%esp
+    374e:	68 6e 52 00 00       	push   $0x526e
+    3753:	ff 35 90 66 00 00    	push   0x6690
+    3759:	e8 52 08 00 00       	call   3fb0 <printf>
+      exit();
+    375e:	e8 9d 06 00 00       	call   3e00 <exit>
+    3763:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    376a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003770 <bigargtest>:
+{
+    3770:	55                   	push   %ebp
+    3771:	89 e5                	mov    %esp,%ebp
+    3773:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    3776:	68 8c 52 00 00       	push   $0x528c
+    377b:	e8 d0 06 00 00       	call   3e50 <unlink>
+  pid = fork();
+    3780:	e8 73 06 00 00       	call   3df8 <fork>
+  if(pid == 0){
+    3785:	83 c4 10             	add    $0x10,%esp
+    3788:	85 c0                	test   %eax,%eax
+    378a:	74 44                	je     37d0 <bigargtest+0x60>
+  } else if(pid < 0){
+    378c:	0f 88 c3 00 00 00    	js     3855 <bigargtest+0xe5>
+  wait();
+    3792:	e8 71 06 00 00       	call   3e08 <wait>
+  fd = open("bigarg-ok", 0);
+    3797:	83 ec 08             	sub    $0x8,%esp
+    379a:	6a 00                	push   $0x0
+    379c:	68 8c 52 00 00       	push   $0x528c
+    37a1:	e8 9a 06 00 00       	call   3e40 <open>
+  if(fd < 0){
+    37a6:	83 c4 10             	add    $0x10,%esp
+    37a9:	85 c0                	test   %eax,%eax
+    37ab:	0f 88 8d 00 00 00    	js     383e <bigargtest+0xce>
+  close(fd);
+    37b1:	83 ec 0c             	sub    $0xc,%esp
+    37b4:	50                   	push   %eax
+    37b5:	e8 6e 06 00 00       	call   3e28 <close>
+  unlink("bigarg-ok");
+    37ba:	c7 04 24 8c 52 00 00 	movl   $0x528c,(%esp)
+    37c1:	e8 8a 06 00 00       	call   3e50 <unlink>
+}
+    37c6:	83 c4 10             	add    $0x10,%esp
+    37c9:	c9                   	leave
+    37ca:	c3                   	ret
+    37cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    37cf:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    37d0:	c7 04 85 e0 ad 00 00 	movl   $0x5af0,0xade0(,%eax,4)
+    37d7:	f0 5a 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    37db:	83 c0 01             	add    $0x1,%eax
+    37de:	83 f8 1f             	cmp    $0x1f,%eax
+    37e1:	75 ed                	jne    37d0 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    37e3:	31 c9                	xor    %ecx,%ecx
+    37e5:	89 0d 5c ae 00 00    	mov    %ecx,0xae5c
+    printf(stdout, "bigarg test\n");
+    37eb:	50                   	push   %eax
+    37ec:	50                   	push   %eax
+    37ed:	68 96 52 00 00       	push   $0x5296
+    37f2:	ff 35 90 66 00 00    	push   0x6690
+    37f8:	e8 b3 07 00 00       	call   3fb0 <printf>
+    exec("echo", args);
+    37fd:	58                   	pop    %eax
+    37fe:	5a                   	pop    %edx
+    37ff:	68 e0 ad 00 00       	push   $0xade0
+    3804:	68 bd 43 00 00       	push   $0x43bd
+    3809:	e8 2a 06 00 00       	call   3e38 <exec>
+    printf(stdout, "bigarg test ok\n");
+    380e:	59                   	pop    %ecx
+    380f:	58                   	pop    %eax
+    3810:	68 a3 52 00 00       	push   $0x52a3
+    3815:	ff 35 90 66 00 00    	push   0x6690
+    381b:	e8 90 07 00 00       	call   3fb0 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    3820:	58                   	pop    %eax
+    3821:	5a                   	pop    %edx
+    3822:	68 00 02 00 00       	push   $0x200
+    3827:	68 8c 52 00 00       	push   $0x528c
+    382c:	e8 0f 06 00 00       	call   3e40 <open>
+    close(fd);
+    3831:	89 04 24             	mov    %eax,(%esp)
+    3834:	e8 ef 05 00 00       	call   3e28 <close>
+    exit();
+    3839:	e8 c2 05 00 00       	call   3e00 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    383e:	50                   	push   %eax
+    383f:	50                   	push   %eax
+    3840:	68 cc 52 00 00       	push   $0x52cc
+    3845:	ff 35 90 66 00 00    	push   0x6690
+    384b:	e8 60 07 00 00       	call   3fb0 <printf>
+    exit();
+    3850:	e8 ab 05 00 00       	call   3e00 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    3855:	52                   	push   %edx
+    3856:	52                   	push   %edx
+    3857:	68 b3 52 00 00       	push   $0x52b3
+    385c:	ff 35 90 66 00 00    	push   0x6690
+    3862:	e8 49 07 00 00       	call   3fb0 <printf>
+    exit();
+    3867:	e8 94 05 00 00       	call   3e00 <exit>
+    386c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003870 <fsfull>:
+{
+    3870:	55                   	push   %ebp
+    3871:	89 e5                	mov    %esp,%ebp
+    3873:	57                   	push   %edi
+    3874:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    3875:	31 f6                	xor    %esi,%esi
+{
+    3877:	53                   	push   %ebx
+    3878:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    387b:	68 e1 52 00 00       	push   $0x52e1
+    3880:	6a 01                	push   $0x1
+    3882:	e8 29 07 00 00       	call   3fb0 <printf>
+    3887:	83 c4 10             	add    $0x10,%esp
+    388a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    3890:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3895:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    389a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    389d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    38a1:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    38a3:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    38a7:	c1 ea 06             	shr    $0x6,%edx
+    38aa:	8d 42 30             	lea    0x30(%edx),%eax
+    38ad:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    38b0:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    38b6:	89 f2                	mov    %esi,%edx
+    38b8:	29 c2                	sub    %eax,%edx
+    38ba:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    38bf:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    38c1:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    38c6:	c1 ea 05             	shr    $0x5,%edx
+    38c9:	83 c2 30             	add    $0x30,%edx
+    38cc:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    38cf:	f7 e6                	mul    %esi
+    38d1:	c1 ea 05             	shr    $0x5,%edx
+    38d4:	6b c2 64             	imul   $0x64,%edx,%eax
+    38d7:	89 f2                	mov    %esi,%edx
+    38d9:	29 c2                	sub    %eax,%edx
+    38db:	89 d0                	mov    %edx,%eax
+    38dd:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    38df:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    38e1:	c1 ea 03             	shr    $0x3,%edx
+    38e4:	83 c2 30             	add    $0x30,%edx
+    38e7:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    38ea:	f7 e1                	mul    %ecx
+    38ec:	89 f0                	mov    %esi,%eax
+    38ee:	c1 ea 03             	shr    $0x3,%edx
+    38f1:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    38f4:	01 d2                	add    %edx,%edx
+    38f6:	29 d0                	sub    %edx,%eax
+    38f8:	83 c0 30             	add    $0x30,%eax
+    38fb:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    38fe:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3901:	50                   	push   %eax
+    3902:	68 ee 52 00 00       	push   $0x52ee
+    3907:	6a 01                	push   $0x1
+    3909:	e8 a2 06 00 00       	call   3fb0 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    390e:	58                   	pop    %eax
+    390f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3912:	5a                   	pop    %edx
+    3913:	68 02 02 00 00       	push   $0x202
+    3918:	50                   	push   %eax
+    3919:	e8 22 05 00 00       	call   3e40 <open>
+    if(fd < 0){
+    391e:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    3921:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    3923:	85 c0                	test   %eax,%eax
+    3925:	78 4f                	js     3976 <fsfull+0x106>
+    int total = 0;
+    3927:	31 db                	xor    %ebx,%ebx
+    3929:	eb 07                	jmp    3932 <fsfull+0xc2>
+    392b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    392f:	90                   	nop
+      total += cc;
+    3930:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    3932:	83 ec 04             	sub    $0x4,%esp
+    3935:	68 00 02 00 00       	push   $0x200
+    393a:	68 e0 8d 00 00       	push   $0x8de0
+    393f:	57                   	push   %edi
+    3940:	e8 db 04 00 00       	call   3e20 <write>
+      if(cc < 512)
+    3945:	83 c4 10             	add    $0x10,%esp
+    3948:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    394d:	7f e1                	jg     3930 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    394f:	83 ec 04             	sub    $0x4,%esp
+    3952:	53                   	push   %ebx
+    3953:	68 0a 53 00 00       	push   $0x530a
+    3958:	6a 01                	push   $0x1
+    395a:	e8 51 06 00 00       	call   3fb0 <printf>
+    close(fd);
+    395f:	89 3c 24             	mov    %edi,(%esp)
+    3962:	e8 c1 04 00 00       	call   3e28 <close>
+    if(total == 0)
+    3967:	83 c4 10             	add    $0x10,%esp
+    396a:	85 db                	test   %ebx,%ebx
+    396c:	74 1e                	je     398c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    396e:	83 c6 01             	add    $0x1,%esi
+    3971:	e9 1a ff ff ff       	jmp    3890 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    3976:	83 ec 04             	sub    $0x4,%esp
+    3979:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    397c:	50                   	push   %eax
+    397d:	68 fa 52 00 00       	push   $0x52fa
+    3982:	6a 01                	push   $0x1
+    3984:	e8 27 06 00 00       	call   3fb0 <printf>
+      break;
+    3989:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    398c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3991:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    3996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    399d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    39a0:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    39a2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    39a5:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    39a9:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    39ab:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    39af:	c1 ea 06             	shr    $0x6,%edx
+    39b2:	8d 42 30             	lea    0x30(%edx),%eax
+    39b5:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    39b8:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    39be:	89 f2                	mov    %esi,%edx
+    39c0:	29 c2                	sub    %eax,%edx
+    39c2:	89 d0                	mov    %edx,%eax
+    39c4:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    39c6:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    39c8:	c1 ea 05             	shr    $0x5,%edx
+    39cb:	83 c2 30             	add    $0x30,%edx
+    39ce:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    39d1:	f7 e3                	mul    %ebx
+    39d3:	c1 ea 05             	shr    $0x5,%edx
+    39d6:	6b ca 64             	imul   $0x64,%edx,%ecx
+    39d9:	89 f2                	mov    %esi,%edx
+    39db:	29 ca                	sub    %ecx,%edx
+    39dd:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    39e2:	89 d0                	mov    %edx,%eax
+    39e4:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    39e6:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    39e8:	c1 ea 03             	shr    $0x3,%edx
+    39eb:	83 c2 30             	add    $0x30,%edx
+    39ee:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    39f1:	f7 e1                	mul    %ecx
+    39f3:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    39f5:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    39f8:	c1 ea 03             	shr    $0x3,%edx
+    39fb:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    39fe:	01 d2                	add    %edx,%edx
+    3a00:	29 d0                	sub    %edx,%eax
+    3a02:	83 c0 30             	add    $0x30,%eax
+    3a05:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    3a08:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3a0b:	50                   	push   %eax
+    3a0c:	e8 3f 04 00 00       	call   3e50 <unlink>
+  while(nfiles >= 0){
+    3a11:	83 c4 10             	add    $0x10,%esp
+    3a14:	83 fe ff             	cmp    $0xffffffff,%esi
+    3a17:	75 87                	jne    39a0 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    3a19:	83 ec 08             	sub    $0x8,%esp
+    3a1c:	68 1a 53 00 00       	push   $0x531a
+    3a21:	6a 01                	push   $0x1
+    3a23:	e8 88 05 00 00       	call   3fb0 <printf>
+}
+    3a28:	83 c4 10             	add    $0x10,%esp
+    3a2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3a2e:	5b                   	pop    %ebx
+    3a2f:	5e                   	pop    %esi
+    3a30:	5f                   	pop    %edi
+    3a31:	5d                   	pop    %ebp
+    3a32:	c3                   	ret
+    3a33:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003a40 <uio>:
+{
+    3a40:	55                   	push   %ebp
+    3a41:	89 e5                	mov    %esp,%ebp
+    3a43:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    3a46:	68 30 53 00 00       	push   $0x5330
+    3a4b:	6a 01                	push   $0x1
+    3a4d:	e8 5e 05 00 00       	call   3fb0 <printf>
+  pid = fork();
+    3a52:	e8 a1 03 00 00       	call   3df8 <fork>
+  if(pid == 0){
+    3a57:	83 c4 10             	add    $0x10,%esp
+    3a5a:	85 c0                	test   %eax,%eax
+    3a5c:	74 1b                	je     3a79 <uio+0x39>
+  } else if(pid < 0){
+    3a5e:	78 3d                	js     3a9d <uio+0x5d>
+  wait();
+    3a60:	e8 a3 03 00 00       	call   3e08 <wait>
+  printf(1, "uio test done\n");
+    3a65:	83 ec 08             	sub    $0x8,%esp
+    3a68:	68 3a 53 00 00       	push   $0x533a
+    3a6d:	6a 01                	push   $0x1
+    3a6f:	e8 3c 05 00 00       	call   3fb0 <printf>
+}
+    3a74:	83 c4 10             	add    $0x10,%esp
+    3a77:	c9                   	leave
+    3a78:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    3a79:	b8 09 00 00 00       	mov    $0x9,%eax
+    3a7e:	ba 70 00 00 00       	mov    $0x70,%edx
+    3a83:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    3a84:	ba 71 00 00 00       	mov    $0x71,%edx
+    3a89:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    3a8a:	52                   	push   %edx
+    3a8b:	52                   	push   %edx
+    3a8c:	68 d0 5b 00 00       	push   $0x5bd0
+    3a91:	6a 01                	push   $0x1
+    3a93:	e8 18 05 00 00       	call   3fb0 <printf>
+    exit();
+    3a98:	e8 63 03 00 00       	call   3e00 <exit>
+    printf (1, "fork failed\n");
+    3a9d:	50                   	push   %eax
+    3a9e:	50                   	push   %eax
+    3a9f:	68 bf 52 00 00       	push   $0x52bf
+    3aa4:	6a 01                	push   $0x1
+    3aa6:	e8 05 05 00 00       	call   3fb0 <printf>
+    exit();
+    3aab:	e8 50 03 00 00       	call   3e00 <exit>
+
+00003ab0 <argptest>:
+{
+    3ab0:	55                   	push   %ebp
+    3ab1:	89 e5                	mov    %esp,%ebp
+    3ab3:	53                   	push   %ebx
+    3ab4:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    3ab7:	6a 00                	push   $0x0
+    3ab9:	68 49 53 00 00       	push   $0x5349
+    3abe:	e8 7d 03 00 00       	call   3e40 <open>
+  if (fd < 0) {
+    3ac3:	83 c4 10             	add    $0x10,%esp
+    3ac6:	85 c0                	test   %eax,%eax
+    3ac8:	78 39                	js     3b03 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    3aca:	83 ec 0c             	sub    $0xc,%esp
+    3acd:	89 c3                	mov    %eax,%ebx
+    3acf:	6a 00                	push   $0x0
+    3ad1:	e8 b2 03 00 00       	call   3e88 <sbrk>
+    3ad6:	83 c4 0c             	add    $0xc,%esp
+    3ad9:	83 e8 01             	sub    $0x1,%eax
+    3adc:	6a ff                	push   $0xffffffff
+    3ade:	50                   	push   %eax
+    3adf:	53                   	push   %ebx
+    3ae0:	e8 33 03 00 00       	call   3e18 <read>
+  close(fd);
+    3ae5:	89 1c 24             	mov    %ebx,(%esp)
+    3ae8:	e8 3b 03 00 00       	call   3e28 <close>
+  printf(1, "arg test passed\n");
+    3aed:	58                   	pop    %eax
+    3aee:	5a                   	pop    %edx
+    3aef:	68 5b 53 00 00       	push   $0x535b
+    3af4:	6a 01                	push   $0x1
+    3af6:	e8 b5 04 00 00       	call   3fb0 <printf>
+}
+    3afb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3afe:	83 c4 10             	add    $0x10,%esp
+    3b01:	c9                   	leave
+    3b02:	c3                   	ret
+    printf(2, "open failed\n");
+    3b03:	51                   	push   %ecx
+    3b04:	51                   	push   %ecx
+    3b05:	68 4e 53 00 00       	push   $0x534e
+    3b0a:	6a 02                	push   $0x2
+    3b0c:	e8 9f 04 00 00       	call   3fb0 <printf>
+    exit();
+    3b11:	e8 ea 02 00 00       	call   3e00 <exit>
+    3b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003b20 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    3b20:	69 05 8c 66 00 00 0d 	imul   $0x19660d,0x668c,%eax
+    3b27:	66 19 00 
+    3b2a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    3b2f:	a3 8c 66 00 00       	mov    %eax,0x668c
+}
+    3b34:	c3                   	ret
+    3b35:	66 90                	xchg   %ax,%ax
+    3b37:	66 90                	xchg   %ax,%ax
+    3b39:	66 90                	xchg   %ax,%ax
+    3b3b:	66 90                	xchg   %ax,%ax
+    3b3d:	66 90                	xchg   %ax,%ax
+    3b3f:	90                   	nop
+
+00003b40 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    3b40:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    3b41:	31 c0                	xor    %eax,%eax
+{
+    3b43:	89 e5                	mov    %esp,%ebp
+    3b45:	53                   	push   %ebx
+    3b46:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    3b49:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    3b4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    3b50:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    3b54:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    3b57:	83 c0 01             	add    $0x1,%eax
+    3b5a:	84 d2                	test   %dl,%dl
+    3b5c:	75 f2                	jne    3b50 <strcpy+0x10>
+    ;
+  return os;
+}
+    3b5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3b61:	89 c8                	mov    %ecx,%eax
+    3b63:	c9                   	leave
+    3b64:	c3                   	ret
+    3b65:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003b70 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    3b70:	55                   	push   %ebp
+    3b71:	89 e5                	mov    %esp,%ebp
+    3b73:	53                   	push   %ebx
+    3b74:	8b 55 08             	mov    0x8(%ebp),%edx
+    3b77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    3b7a:	0f b6 02             	movzbl (%edx),%eax
+    3b7d:	84 c0                	test   %al,%al
+    3b7f:	75 17                	jne    3b98 <strcmp+0x28>
+    3b81:	eb 3a                	jmp    3bbd <strcmp+0x4d>
+    3b83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3b87:	90                   	nop
+    3b88:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    3b8c:	83 c2 01             	add    $0x1,%edx
+    3b8f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    3b92:	84 c0                	test   %al,%al
+    3b94:	74 1a                	je     3bb0 <strcmp+0x40>
+    p++, q++;
+    3b96:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    3b98:	0f b6 19             	movzbl (%ecx),%ebx
+    3b9b:	38 c3                	cmp    %al,%bl
+    3b9d:	74 e9                	je     3b88 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    3b9f:	29 d8                	sub    %ebx,%eax
+}
+    3ba1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3ba4:	c9                   	leave
+    3ba5:	c3                   	ret
+    3ba6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3bad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    3bb0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    3bb4:	31 c0                	xor    %eax,%eax
+    3bb6:	29 d8                	sub    %ebx,%eax
+}
+    3bb8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3bbb:	c9                   	leave
+    3bbc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    3bbd:	0f b6 19             	movzbl (%ecx),%ebx
+    3bc0:	31 c0                	xor    %eax,%eax
+    3bc2:	eb db                	jmp    3b9f <strcmp+0x2f>
+    3bc4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3bcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3bcf:	90                   	nop
+
+00003bd0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    3bd0:	55                   	push   %ebp
+    3bd1:	89 e5                	mov    %esp,%ebp
+    3bd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    3bd6:	80 3a 00             	cmpb   $0x0,(%edx)
+    3bd9:	74 15                	je     3bf0 <strlen+0x20>
+    3bdb:	31 c0                	xor    %eax,%eax
+    3bdd:	8d 76 00             	lea    0x0(%esi),%esi
+    3be0:	83 c0 01             	add    $0x1,%eax
+    3be3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    3be7:	89 c1                	mov    %eax,%ecx
+    3be9:	75 f5                	jne    3be0 <strlen+0x10>
+    ;
+  return n;
+}
+    3beb:	89 c8                	mov    %ecx,%eax
+    3bed:	5d                   	pop    %ebp
+    3bee:	c3                   	ret
+    3bef:	90                   	nop
+  for(n = 0; s[n]; n++)
+    3bf0:	31 c9                	xor    %ecx,%ecx
+}
+    3bf2:	5d                   	pop    %ebp
+    3bf3:	89 c8                	mov    %ecx,%eax
+    3bf5:	c3                   	ret
+    3bf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3bfd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003c00 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    3c00:	55                   	push   %ebp
+    3c01:	89 e5                	mov    %esp,%ebp
+    3c03:	57                   	push   %edi
+    3c04:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    3c07:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    3c0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    3c0d:	89 d7                	mov    %edx,%edi
+    3c0f:	fc                   	cld
+    3c10:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    3c12:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    3c15:	89 d0                	mov    %edx,%eax
+    3c17:	c9                   	leave
+    3c18:	c3                   	ret
+    3c19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003c20 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    3c20:	55                   	push   %ebp
+    3c21:	89 e5                	mov    %esp,%ebp
+    3c23:	8b 45 08             	mov    0x8(%ebp),%eax
+    3c26:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    3c2a:	0f b6 10             	movzbl (%eax),%edx
+    3c2d:	84 d2                	test   %dl,%dl
+    3c2f:	75 12                	jne    3c43 <strchr+0x23>
+    3c31:	eb 1d                	jmp    3c50 <strchr+0x30>
+    3c33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3c37:	90                   	nop
+    3c38:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    3c3c:	83 c0 01             	add    $0x1,%eax
+    3c3f:	84 d2                	test   %dl,%dl
+    3c41:	74 0d                	je     3c50 <strchr+0x30>
+    if(*s == c)
+    3c43:	38 d1                	cmp    %dl,%cl
+    3c45:	75 f1                	jne    3c38 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    3c47:	5d                   	pop    %ebp
+    3c48:	c3                   	ret
+    3c49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    3c50:	31 c0                	xor    %eax,%eax
+}
+    3c52:	5d                   	pop    %ebp
+    3c53:	c3                   	ret
+    3c54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3c5f:	90                   	nop
+
+00003c60 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    3c60:	55                   	push   %ebp
+    3c61:	89 e5                	mov    %esp,%ebp
+    3c63:	57                   	push   %edi
+    3c64:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    3c65:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    3c68:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    3c69:	31 db                	xor    %ebx,%ebx
+{
+    3c6b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    3c6e:	eb 27                	jmp    3c97 <gets+0x37>
+    cc = read(0, &c, 1);
+    3c70:	83 ec 04             	sub    $0x4,%esp
+    3c73:	6a 01                	push   $0x1
+    3c75:	56                   	push   %esi
+    3c76:	6a 00                	push   $0x0
+    3c78:	e8 9b 01 00 00       	call   3e18 <read>
+    if(cc < 1)
+    3c7d:	83 c4 10             	add    $0x10,%esp
+    3c80:	85 c0                	test   %eax,%eax
+    3c82:	7e 1d                	jle    3ca1 <gets+0x41>
+      break;
+    buf[i++] = c;
+    3c84:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    3c88:	8b 55 08             	mov    0x8(%ebp),%edx
+    3c8b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    3c8f:	3c 0a                	cmp    $0xa,%al
+    3c91:	74 10                	je     3ca3 <gets+0x43>
+    3c93:	3c 0d                	cmp    $0xd,%al
+    3c95:	74 0c                	je     3ca3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    3c97:	89 df                	mov    %ebx,%edi
+    3c99:	83 c3 01             	add    $0x1,%ebx
+    3c9c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    3c9f:	7c cf                	jl     3c70 <gets+0x10>
+    3ca1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    3ca3:	8b 45 08             	mov    0x8(%ebp),%eax
+    3ca6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    3caa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3cad:	5b                   	pop    %ebx
+    3cae:	5e                   	pop    %esi
+    3caf:	5f                   	pop    %edi
+    3cb0:	5d                   	pop    %ebp
+    3cb1:	c3                   	ret
+    3cb2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3cb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003cc0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    3cc0:	55                   	push   %ebp
+    3cc1:	89 e5                	mov    %esp,%ebp
+    3cc3:	56                   	push   %esi
+    3cc4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    3cc5:	83 ec 08             	sub    $0x8,%esp
+    3cc8:	6a 00                	push   $0x0
+    3cca:	ff 75 08             	push   0x8(%ebp)
+    3ccd:	e8 6e 01 00 00       	call   3e40 <open>
+  if(fd < 0)
+    3cd2:	83 c4 10             	add    $0x10,%esp
+    3cd5:	85 c0                	test   %eax,%eax
+    3cd7:	78 27                	js     3d00 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    3cd9:	83 ec 08             	sub    $0x8,%esp
+    3cdc:	ff 75 0c             	push   0xc(%ebp)
+    3cdf:	89 c3                	mov    %eax,%ebx
+    3ce1:	50                   	push   %eax
+    3ce2:	e8 71 01 00 00       	call   3e58 <fstat>
+  close(fd);
+    3ce7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    3cea:	89 c6                	mov    %eax,%esi
+  close(fd);
+    3cec:	e8 37 01 00 00       	call   3e28 <close>
+  return r;
+    3cf1:	83 c4 10             	add    $0x10,%esp
+}
+    3cf4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3cf7:	89 f0                	mov    %esi,%eax
+    3cf9:	5b                   	pop    %ebx
+    3cfa:	5e                   	pop    %esi
+    3cfb:	5d                   	pop    %ebp
+    3cfc:	c3                   	ret
+    3cfd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    3d00:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    3d05:	eb ed                	jmp    3cf4 <stat+0x34>
+    3d07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d0e:	66 90                	xchg   %ax,%ax
+
+00003d10 <atoi>:
+
+int
+atoi(const char *s)
+{
+    3d10:	55                   	push   %ebp
+    3d11:	89 e5                	mov    %esp,%ebp
+    3d13:	53                   	push   %ebx
+    3d14:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    3d17:	0f be 02             	movsbl (%edx),%eax
+    3d1a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    3d1d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    3d20:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    3d25:	77 1e                	ja     3d45 <atoi+0x35>
+    3d27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d2e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    3d30:	83 c2 01             	add    $0x1,%edx
+    3d33:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    3d36:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    3d3a:	0f be 02             	movsbl (%edx),%eax
+    3d3d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    3d40:	80 fb 09             	cmp    $0x9,%bl
+    3d43:	76 eb                	jbe    3d30 <atoi+0x20>
+  return n;
+}
+    3d45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3d48:	89 c8                	mov    %ecx,%eax
+    3d4a:	c9                   	leave
+    3d4b:	c3                   	ret
+    3d4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003d50 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    3d50:	55                   	push   %ebp
+    3d51:	89 e5                	mov    %esp,%ebp
+    3d53:	57                   	push   %edi
+    3d54:	56                   	push   %esi
+    3d55:	8b 45 10             	mov    0x10(%ebp),%eax
+    3d58:	8b 55 08             	mov    0x8(%ebp),%edx
+    3d5b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    3d5e:	85 c0                	test   %eax,%eax
+    3d60:	7e 13                	jle    3d75 <memmove+0x25>
+    3d62:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    3d64:	89 d7                	mov    %edx,%edi
+    3d66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3d6d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    3d70:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    3d71:	39 f8                	cmp    %edi,%eax
+    3d73:	75 fb                	jne    3d70 <memmove+0x20>
+  return vdst;
+}
+    3d75:	5e                   	pop    %esi
+    3d76:	89 d0                	mov    %edx,%eax
+    3d78:	5f                   	pop    %edi
+    3d79:	5d                   	pop    %ebp
+    3d7a:	c3                   	ret
+    3d7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3d7f:	90                   	nop
+
+00003d80 <mutex_lock>:
+
+// Take and release m with atomic instructions, and enter the kernel
+// only to block while it is held or to wake a blocked thread.
+void
+mutex_lock(struct mutex *m)
+{
+    3d80:	55                   	push   %ebp
+  uint s;
+
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    3d81:	31 c0                	xor    %eax,%eax
+    3d83:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+    3d88:	89 e5                	mov    %esp,%ebp
+    3d8a:	56                   	push   %esi
+    3d8b:	53                   	push   %ebx
+    3d8c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    3d8f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+    3d93:	85 c0                	test   %eax,%eax
+    3d95:	74 30                	je     3dc7 <mutex_lock+0x47>
+    return;
+  // Contended: mark it so the holder knows to wake us.
+  if(s != 2)
+    3d97:	83 f8 02             	cmp    $0x2,%eax
+    3d9a:	74 0c                	je     3da8 <mutex_lock+0x28>
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    3d9c:	b8 02 00 00 00       	mov    $0x2,%eax
+    3da1:	f0 87 03             	lock xchg %eax,(%ebx)
+    s = xchg(&m->state, 2);
+  while(s != 0){
+    3da4:	85 c0                	test   %eax,%eax
+    3da6:	74 1f                	je     3dc7 <mutex_lock+0x47>
+    3da8:	be 02 00 00 00       	mov    $0x2,%esi
+    3dad:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+    3db0:	83 ec 08             	sub    $0x8,%esp
+    3db3:	6a 02                	push   $0x2
+    3db5:	53                   	push   %ebx
+    3db6:	e8 45 01 00 00       	call   3f00 <futex_wait>
+    3dbb:	89 f0                	mov    %esi,%eax
+    3dbd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(s != 0){
+    3dc0:	83 c4 10             	add    $0x10,%esp
+    3dc3:	85 c0                	test   %eax,%eax
+    3dc5:	75 e9                	jne    3db0 <mutex_lock+0x30>
+    s = xchg(&m->state, 2);
+  }
+}
+    3dc7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3dca:	5b                   	pop    %ebx
+    3dcb:	5e                   	pop    %esi
+    3dcc:	5d                   	pop    %ebp
+    3dcd:	c3                   	ret
+    3dce:	66 90                	xchg   %ax,%ax
+
+00003dd0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+    3dd0:	55                   	push   %ebp
+    3dd1:	31 c0                	xor    %eax,%eax
+    3dd3:	89 e5                	mov    %esp,%ebp
+    3dd5:	83 ec 08             	sub    $0x8,%esp
+    3dd8:	8b 55 08             	mov    0x8(%ebp),%edx
+    3ddb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+    3dde:	83 f8 02             	cmp    $0x2,%eax
+    3de1:	74 05                	je     3de8 <mutex_unlock+0x18>
+    futex_wake(&m->state, 1);
+}
+    3de3:	c9                   	leave
+    3de4:	c3                   	ret
+    3de5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->state, 1);
+    3de8:	83 ec 08             	sub    $0x8,%esp
+    3deb:	6a 01                	push   $0x1
+    3ded:	52                   	push   %edx
+    3dee:	e8 15 01 00 00       	call   3f08 <futex_wake>
+    3df3:	83 c4 10             	add    $0x10,%esp
+}
+    3df6:	c9                   	leave
+    3df7:	c3                   	ret
+
+00003df8 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    3df8:	b8 01 00 00 00       	mov    $0x1,%eax
+    3dfd:	cd 40                	int    $0x40
+    3dff:	c3                   	ret
+
+00003e00 <exit>:
+SYSCALL(exit)
+    3e00:	b8 02 00 00 00       	mov    $0x2,%eax
+    3e05:	cd 40                	int    $0x40
+    3e07:	c3                   	ret
+
+00003e08 <wait>:
+SYSCALL(wait)
+    3e08:	b8 03 00 00 00       	mov    $0x3,%eax
+    3e0d:	cd 40                	int    $0x40
+    3e0f:	c3                   	ret
+
+00003e10 <pipe>:
+SYSCALL(pipe)
+    3e10:	b8 04 00 00 00       	mov    $0x4,%eax
+    3e15:	cd 40                	int    $0x40
+    3e17:	c3                   	ret
+
+00003e18 <read>:
+SYSCALL(read)
+    3e18:	b8 05 00 00 00       	mov    $0x5,%eax
+    3e1d:	cd 40                	int    $0x40
+    3e1f:	c3                   	ret
+
+00003e20 <write>:
+SYSCALL(write)
+    3e20:	b8 10 00 00 00       	mov    $0x10,%eax
+    3e25:	cd 40                	int    $0x40
+    3e27:	c3                   	ret
+
+00003e28 <close>:
+SYSCALL(close)
+    3e28:	b8 15 00 00 00       	mov    $0x15,%eax
+    3e2d:	cd 40                	int    $0x40
+    3e2f:	c3                   	ret
+
+00003e30 <kill>:
+SYSCALL(kill)
+    3e30:	b8 06 00 00 00       	mov    $0x6,%eax
+    3e35:	cd 40                	int    $0x40
+    3e37:	c3                   	ret
+
+00003e38 <exec>:
+SYSCALL(exec)
+    3e38:	b8 07 00 00 00       	mov    $0x7,%eax
+    3e3d:	cd 40                	int    $0x40
+    3e3f:	c3                   	ret
+
+00003e40 <open>:
+SYSCALL(open)
+    3e40:	b8 0f 00 00 00       	mov    $0xf,%eax
+    3e45:	cd 40                	int    $0x40
+    3e47:	c3                   	ret
+
+00003e48 <mknod>:
+SYSCALL(mknod)
+    3e48:	b8 11 00 00 00       	mov    $0x11,%eax
+    3e4d:	cd 40                	int    $0x40
+    3e4f:	c3                   	ret
+
+00003e50 <unlink>:
+SYSCALL(unlink)
+    3e50:	b8 12 00 00 00       	mov    $0x12,%eax
+    3e55:	cd 40                	int    $0x40
+    3e57:	c3                   	ret
+
+00003e58 <fstat>:
+SYSCALL(fstat)
+    3e58:	b8 08 00 00 00       	mov    $0x8,%eax
+    3e5d:	cd 40                	int    $0x40
+    3e5f:	c3                   	ret
+
+00003e60 <link>:
+SYSCALL(link)
+    3e60:	b8 13 00 00 00       	mov    $0x13,%eax
+    3e65:	cd 40                	int    $0x40
+    3e67:	c3                   	ret
+
+00003e68 <mkdir>:
+SYSCALL(mkdir)
+    3e68:	b8 14 00 00 00       	mov    $0x14,%eax
+    3e6d:	cd 40                	int    $0x40
+    3e6f:	c3                   	ret
+
+00003e70 <chdir>:
+SYSCALL(chdir)
+    3e70:	b8 09 00 00 00       	mov    $0x9,%eax
+    3e75:	cd 40                	int    $0x40
+    3e77:	c3                   	ret
+
+00003e78 <dup>:
+SYSCALL(dup)
+    3e78:	b8 0a 00 00 00       	mov    $0xa,%eax
+    3e7d:	cd 40                	int    $0x40
+    3e7f:	c3                   	ret
+
+00003e80 <getpid>:
+SYSCALL(getpid)
+    3e80:	b8 0b 00 00 00       	mov    $0xb,%eax
+    3e85:	cd 40                	int    $0x40
+    3e87:	c3                   	ret
+
+00003e88 <sbrk>:
+SYSCALL(sbrk)
+    3e88:	b8 0c 00 00 00       	mov    $0xc,%eax
+    3e8d:	cd 40                	int    $0x40
+    3e8f:	c3                   	ret
+
+00003e90 <sleep>:
+SYSCALL(sleep)
+    3e90:	b8 0d 00 00 00       	mov    $0xd,%eax
+    3e95:	cd 40                	int    $0x40
+    3e97:	c3                   	ret
+
+00003e98 <uptime>:
+SYSCALL(uptime)
+    3e98:	b8 0e 00 00 00       	mov    $0xe,%eax
+    3e9d:	cd 40                	int    $0x40
+    3e9f:	c3                   	ret
+
+00003ea0 <ps>:
+SYSCALL(ps)
+    3ea0:	b8 16 00 00 00       	mov    $0x16,%eax
+    3ea5:	cd 40                	int    $0x40
+    3ea7:	c3                   	ret
+
+00003ea8 <getschedparams>:
+SYSCALL(getschedparams)
+    3ea8:	b8 17 00 00 00       	mov    $0x17,%eax
+    3ead:	cd 40                	int    $0x40
+    3eaf:	c3                   	ret
+
+00003eb0 <setschedparams>:
+SYSCALL(setschedparams)
+    3eb0:	b8 18 00 00 00       	mov    $0x18,%eax
+    3eb5:	cd 40                	int    $0x40
+    3eb7:	c3                   	ret
+
+00003eb8 <getpinfo>:
+SYSCALL(getpinfo)
+    3eb8:	b8 19 00 00 00       	mov    $0x19,%eax
+    3ebd:	cd 40                	int    $0x40
+    3ebf:	c3                   	ret
+
+00003ec0 <getlathist>:
+SYSCALL(getlathist)
+    3ec0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    3ec5:	cd 40                	int    $0x40
+    3ec7:	c3                   	ret
+
+00003ec8 <setpolicy>:
+SYSCALL(setpolicy)
+    3ec8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    3ecd:	cd 40                	int    $0x40
+    3ecf:	c3                   	ret
+
+00003ed0 <settickets>:
+SYSCALL(settickets)
+    3ed0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    3ed5:	cd 40                	int    $0x40
+    3ed7:	c3                   	ret
+
+00003ed8 <setaffinity>:
+SYSCALL(setaffinity)
+    3ed8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    3edd:	cd 40                	int    $0x40
+    3edf:	c3                   	ret
+
+00003ee0 <getaffinity>:
+SYSCALL(getaffinity)
+    3ee0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    3ee5:	cd 40                	int    $0x40
+    3ee7:	c3                   	ret
+
+00003ee8 <setrt>:
+SYSCALL(setrt)
+    3ee8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    3eed:	cd 40                	int    $0x40
+    3eef:	c3                   	ret
+
+00003ef0 <clone>:
+SYSCALL(clone)
+    3ef0:	b8 20 00 00 00       	mov    $0x20,%eax
+    3ef5:	cd 40                	int    $0x40
+    3ef7:	c3                   	ret
+
+00003ef8 <join>:
+SYSCALL(join)
+    3ef8:	b8 21 00 00 00       	mov    $0x21,%eax
+    3efd:	cd 40                	int    $0x40
+    3eff:	c3                   	ret
+
+00003f00 <futex_wait>:
+SYSCALL(futex_wait)
+    3f00:	b8 22 00 00 00       	mov    $0x22,%eax
+    3f05:	cd 40                	int    $0x40
+    3f07:	c3                   	ret
+
+00003f08 <futex_wake>:
+SYSCALL(futex_wake)
+    3f08:	b8 23 00 00 00       	mov    $0x23,%eax
+    3f0d:	cd 40                	int    $0x40
+    3f0f:	c3                   	ret
+
+00003f10 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    3f10:	55                   	push   %ebp
+    3f11:	89 e5                	mov    %esp,%ebp
+    3f13:	57                   	push   %edi
+    3f14:	56                   	push   %esi
+    3f15:	53                   	push   %ebx
+    3f16:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    3f18:	89 d1                	mov    %edx,%ecx
+{
+    3f1a:	83 ec 3c             	sub    $0x3c,%esp
+    3f1d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    3f20:	85 d2                	test   %edx,%edx
+    3f22:	0f 89 80 00 00 00    	jns    3fa8 <printint+0x98>
+    3f28:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    3f2c:	74 7a                	je     3fa8 <printint+0x98>
+    x = -xx;
+    3f2e:	f7 d9                	neg    %ecx
+    neg = 1;
+    3f30:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    3f35:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    3f38:	31 f6                	xor    %esi,%esi
+    3f3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    3f40:	89 c8                	mov    %ecx,%eax
+    3f42:	31 d2                	xor    %edx,%edx
+    3f44:	89 f7                	mov    %esi,%edi
+    3f46:	f7 f3                	div    %ebx
+    3f48:	8d 76 01             	lea    0x1(%esi),%esi
+    3f4b:	0f b6 92 80 5c 00 00 	movzbl 0x5c80(%edx),%edx
+    3f52:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    3f56:	89 ca                	mov    %ecx,%edx
+    3f58:	89 c1                	mov    %eax,%ecx
+    3f5a:	39 da                	cmp    %ebx,%edx
+    3f5c:	73 e2                	jae    3f40 <printint+0x30>
+  if(neg)
+    3f5e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    3f61:	85 c0                	test   %eax,%eax
+    3f63:	74 07                	je     3f6c <printint+0x5c>
+    buf[i++] = '-';
+    3f65:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    3f6a:	89 f7                	mov    %esi,%edi
+    3f6c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    3f6f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    3f72:	01 df                	add    %ebx,%edi
+    3f74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    3f78:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    3f7b:	83 ec 04             	sub    $0x4,%esp
+    3f7e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    3f81:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    3f84:	6a 01                	push   $0x1
+    3f86:	50                   	push   %eax
+    3f87:	56                   	push   %esi
+    3f88:	e8 93 fe ff ff       	call   3e20 <write>
+  while(--i >= 0)
+    3f8d:	89 f8                	mov    %edi,%eax
+    3f8f:	83 c4 10             	add    $0x10,%esp
+    3f92:	83 ef 01             	sub    $0x1,%edi
+    3f95:	39 d8                	cmp    %ebx,%eax
+    3f97:	75 df                	jne    3f78 <printint+0x68>
+}
+    3f99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3f9c:	5b                   	pop    %ebx
+    3f9d:	5e                   	pop    %esi
+    3f9e:	5f                   	pop    %edi
+    3f9f:	5d                   	pop    %ebp
+    3fa0:	c3                   	ret
+    3fa1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    3fa8:	31 c0                	xor    %eax,%eax
+    3faa:	eb 89                	jmp    3f35 <printint+0x25>
+    3fac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003fb0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    3fb0:	55                   	push   %ebp
+    3fb1:	89 e5                	mov    %esp,%ebp
+    3fb3:	57                   	push   %edi
+    3fb4:	56                   	push   %esi
+    3fb5:	53                   	push   %ebx
+    3fb6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    3fb9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    3fbc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    3fbf:	0f b6 1e             	movzbl (%esi),%ebx
+    3fc2:	83 c6 01             	add    $0x1,%esi
+    3fc5:	84 db                	test   %bl,%bl
+    3fc7:	74 67                	je     4030 <printf+0x80>
+    3fc9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    3fcc:	31 d2                	xor    %edx,%edx
+    3fce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    3fd1:	eb 34                	jmp    4007 <printf+0x57>
+    3fd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3fd7:	90                   	nop
+    3fd8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    3fdb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    3fe0:	83 f8 25             	cmp    $0x25,%eax
+    3fe3:	74 18                	je     3ffd <printf+0x4d>
+  write(fd, &c, 1);
+    3fe5:	83 ec 04             	sub    $0x4,%esp
+    3fe8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    3feb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    3fee:	6a 01                	push   $0x1
+    3ff0:	50                   	push   %eax
+    3ff1:	57                   	push   %edi
+    3ff2:	e8 29 fe ff ff       	call   3e20 <write>
+    3ff7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    3ffa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    3ffd:	0f b6 1e             	movzbl (%esi),%ebx
+    4000:	83 c6 01             	add    $0x1,%esi
+    4003:	84 db                	test   %bl,%bl
+    4005:	74 29                	je     4030 <printf+0x80>
+    c = fmt[i] & 0xff;
+    4007:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    400a:	85 d2                	test   %edx,%edx
+    400c:	74 ca                	je     3fd8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    400e:	83 fa 25             	cmp    $0x25,%edx
+    4011:	75 ea                	jne    3ffd <printf+0x4d>
+      if(c == 'd'){
+    4013:	83 f8 25             	cmp    $0x25,%eax
+    4016:	0f 84 24 01 00 00    	je     4140 <printf+0x190>
+    401c:	83 e8 63             	sub    $0x63,%eax
+    401f:	83 f8 15             	cmp    $0x15,%eax
+    4022:	77 1c                	ja     4040 <printf+0x90>
+    4024:	ff 24 85 28 5c 00 00 	jmp    *0x5c28(,%eax,4)
+    402b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    402f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    4030:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4033:	5b                   	pop    %ebx
+    4034:	5e                   	pop    %esi
+    4035:	5f                   	pop    %edi
+    4036:	5d                   	pop    %ebp
+    4037:	c3                   	ret
+    4038:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    403f:	90                   	nop
+  write(fd, &c, 1);
+    4040:	83 ec 04             	sub    $0x4,%esp
+    4043:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4046:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    404a:	6a 01                	push   $0x1
+    404c:	52                   	push   %edx
+    404d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    4050:	57                   	push   %edi
+    4051:	e8 ca fd ff ff       	call   3e20 <write>
+    4056:	83 c4 0c             	add    $0xc,%esp
+    4059:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    405c:	6a 01                	push   $0x1
+    405e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    4061:	52                   	push   %edx
+    4062:	57                   	push   %edi
+    4063:	e8 b8 fd ff ff       	call   3e20 <write>
+        putc(fd, c);
+    4068:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    406b:	31 d2                	xor    %edx,%edx
+    406d:	eb 8e                	jmp    3ffd <printf+0x4d>
+    406f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    4070:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4073:	83 ec 0c             	sub    $0xc,%esp
+    4076:	b9 10 00 00 00       	mov    $0x10,%ecx
+    407b:	8b 13                	mov    (%ebx),%edx
+    407d:	6a 00                	push   $0x0
+    407f:	89 f8                	mov    %edi,%eax
+        ap++;
+    4081:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    4084:	e8 87 fe ff ff       	call   3f10 <printint>
+        ap++;
+    4089:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    408c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    408f:	31 d2                	xor    %edx,%edx
+    4091:	e9 67 ff ff ff       	jmp    3ffd <printf+0x4d>
+    4096:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    409d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    40a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    40a3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    40a5:	83 c0 04             	add    $0x4,%eax
+    40a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    40ab:	85 db                	test   %ebx,%ebx
+    40ad:	0f 84 9d 00 00 00    	je     4150 <printf+0x1a0>
+        while(*s != 0){
+    40b3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    40b6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    40b8:	84 c0                	test   %al,%al
+    40ba:	0f 84 3d ff ff ff    	je     3ffd <printf+0x4d>
+    40c0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    40c3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    40c6:	89 de                	mov    %ebx,%esi
+    40c8:	89 d3                	mov    %edx,%ebx
+    40ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    40d0:	83 ec 04             	sub    $0x4,%esp
+    40d3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    40d6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    40d9:	6a 01                	push   $0x1
+    40db:	53                   	push   %ebx
+    40dc:	57                   	push   %edi
+    40dd:	e8 3e fd ff ff       	call   3e20 <write>
+        while(*s != 0){
+    40e2:	0f b6 06             	movzbl (%esi),%eax
+    40e5:	83 c4 10             	add    $0x10,%esp
+    40e8:	84 c0                	test   %al,%al
+    40ea:	75 e4                	jne    40d0 <printf+0x120>
+      state = 0;
+    40ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    40ef:	31 d2                	xor    %edx,%edx
+    40f1:	e9 07 ff ff ff       	jmp    3ffd <printf+0x4d>
+    40f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    40fd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    4100:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4103:	83 ec 0c             	sub    $0xc,%esp
+    4106:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    410b:	8b 13                	mov    (%ebx),%edx
+    410d:	6a 01                	push   $0x1
+    410f:	e9 6b ff ff ff       	jmp    407f <printf+0xcf>
+    4114:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    4118:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    411b:	83 ec 04             	sub    $0x4,%esp
+    411e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    4121:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    4123:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    4126:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    4129:	6a 01                	push   $0x1
+    412b:	52                   	push   %edx
+    412c:	57                   	push   %edi
+    412d:	e8 ee fc ff ff       	call   3e20 <write>
+        ap++;
+    4132:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4135:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4138:	31 d2                	xor    %edx,%edx
+    413a:	e9 be fe ff ff       	jmp    3ffd <printf+0x4d>
+    413f:	90                   	nop
+  write(fd, &c, 1);
+    4140:	83 ec 04             	sub    $0x4,%esp
+    4143:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4146:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4149:	6a 01                	push   $0x1
+    414b:	e9 11 ff ff ff       	jmp    4061 <printf+0xb1>
+    4150:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    4155:	bb 1e 5c 00 00       	mov    $0x5c1e,%ebx
+    415a:	e9 61 ff ff ff       	jmp    40c0 <printf+0x110>
+    415f:	90                   	nop
+
+00004160 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    4160:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4161:	a1 70 ae 00 00       	mov    0xae70,%eax
+{
+    4166:	89 e5                	mov    %esp,%ebp
+    4168:	57                   	push   %edi
+    4169:	56                   	push   %esi
+    416a:	53                   	push   %ebx
+    416b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    416e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4171:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4178:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    417a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    417c:	39 ca                	cmp    %ecx,%edx
+    417e:	73 30                	jae    41b0 <free+0x50>
+    4180:	39 c1                	cmp    %eax,%ecx
+    4182:	72 04                	jb     4188 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    4184:	39 c2                	cmp    %eax,%edx
+    4186:	72 f0                	jb     4178 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    4188:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    418b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    418e:	39 f8                	cmp    %edi,%eax
+    4190:	74 2e                	je     41c0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    4192:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    4195:	8b 42 04             	mov    0x4(%edx),%eax
+    4198:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    419b:	39 f1                	cmp    %esi,%ecx
+    419d:	74 38                	je     41d7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    419f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    41a1:	5b                   	pop    %ebx
+  freep = p;
+    41a2:	89 15 70 ae 00 00    	mov    %edx,0xae70
+}
+    41a8:	5e                   	pop    %esi
+    41a9:	5f                   	pop    %edi
+    41aa:	5d                   	pop    %ebp
+    41ab:	c3                   	ret
+    41ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    41b0:	39 c1                	cmp    %eax,%ecx
+    41b2:	72 d0                	jb     4184 <free+0x24>
+    41b4:	eb c2                	jmp    4178 <free+0x18>
+    41b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    41bd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    41c0:	03 70 04             	add    0x4(%eax),%esi
+    41c3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    41c6:	8b 02                	mov    (%edx),%eax
+    41c8:	8b 00                	mov    (%eax),%eax
+    41ca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    41cd:	8b 42 04             	mov    0x4(%edx),%eax
+    41d0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    41d3:	39 f1                	cmp    %esi,%ecx
+    41d5:	75 c8                	jne    419f <free+0x3f>
+    p->s.size += bp->s.size;
+    41d7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    41da:	89 15 70 ae 00 00    	mov    %edx,0xae70
+    p->s.size += bp->s.size;
+    41e0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    41e3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    41e6:	89 0a                	mov    %ecx,(%edx)
+}
+    41e8:	5b                   	pop    %ebx
+    41e9:	5e                   	pop    %esi
+    41ea:	5f                   	pop    %edi
+    41eb:	5d                   	pop    %ebp
+    41ec:	c3                   	ret
+    41ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000041f0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    41f0:	55                   	push   %ebp
+    41f1:	89 e5                	mov    %esp,%ebp
+    41f3:	57                   	push   %edi
+    41f4:	56                   	push   %esi
+    41f5:	53                   	push   %ebx
+    41f6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    41f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    41fc:	8b 15 70 ae 00 00    	mov    0xae70,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4202:	8d 78 07             	lea    0x7(%eax),%edi
+    4205:	c1 ef 03             	shr    $0x3,%edi
+    4208:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    420b:	85 d2                	test   %edx,%edx
+    420d:	0f 84 8d 00 00 00    	je     42a0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4213:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4215:	8b 48 04             	mov    0x4(%eax),%ecx
+    4218:	39 f9                	cmp    %edi,%ecx
+    421a:	73 64                	jae    4280 <malloc+0x90>
+  if(nu < 4096)
+    421c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    4221:	39 df                	cmp    %ebx,%edi
+    4223:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    4226:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    422d:	eb 0a                	jmp    4239 <malloc+0x49>
+    422f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4230:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4232:	8b 48 04             	mov    0x4(%eax),%ecx
+    4235:	39 f9                	cmp    %edi,%ecx
+    4237:	73 47                	jae    4280 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    4239:	89 c2                	mov    %eax,%edx
+    423b:	39 05 70 ae 00 00    	cmp    %eax,0xae70
+    4241:	75 ed                	jne    4230 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    4243:	83 ec 0c             	sub    $0xc,%esp
+    4246:	56                   	push   %esi
+    4247:	e8 3c fc ff ff       	call   3e88 <sbrk>
+  if(p == (char*)-1)
+    424c:	83 c4 10             	add    $0x10,%esp
+    424f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4252:	74 1c                	je     4270 <malloc+0x80>
+  hp->s.size = nu;
+    4254:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    4257:	83 ec 0c             	sub    $0xc,%esp
+    425a:	83 c0 08             	add    $0x8,%eax
+    425d:	50                   	push   %eax
+    425e:	e8 fd fe ff ff       	call   4160 <free>
+  return freep;
+    4263:	8b 15 70 ae 00 00    	mov    0xae70,%edx
+      if((p = morecore(nunits)) == 0)
+    4269:	83 c4 10             	add    $0x10,%esp
+    426c:	85 d2                	test   %edx,%edx
+    426e:	75 c0                	jne    4230 <malloc+0x40>
+        return 0;
+  }
+}
+    4270:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    4273:	31 c0                	xor    %eax,%eax
+}
+    4275:	5b                   	pop    %ebx
+    4276:	5e                   	pop    %esi
+    4277:	5f                   	pop    %edi
+    4278:	5d                   	pop    %ebp
+    4279:	c3                   	ret
+    427a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    4280:	39 cf                	cmp    %ecx,%edi
+    4282:	74 4c                	je     42d0 <malloc+0xe0>
+        p->s.size -= nunits;
+    4284:	29 f9                	sub    %edi,%ecx
+    4286:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    4289:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    428c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    428f:	89 15 70 ae 00 00    	mov    %edx,0xae70
+}
+    4295:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    4298:	83 c0 08             	add    $0x8,%eax
+}
+    429b:	5b                   	pop    %ebx
+    429c:	5e                   	pop    %esi
+    429d:	5f                   	pop    %edi
+    429e:	5d                   	pop    %ebp
+    429f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    42a0:	c7 05 70 ae 00 00 74 	movl   $0xae74,0xae70
+    42a7:	ae 00 00 
+    base.s.size = 0;
+    42aa:	b8 74 ae 00 00       	mov    $0xae74,%eax
+    base.s.ptr = freep = prevp = &base;
+    42af:	c7 05 74 ae 00 00 74 	movl   $0xae74,0xae74
+    42b6:	ae 00 00 
+    base.s.size = 0;
+    42b9:	c7 05 78 ae 00 00 00 	movl   $0x0,0xae78
+    42c0:	00 00 00 
+    if(p->s.size >= nunits){
+    42c3:	e9 54 ff ff ff       	jmp    421c <malloc+0x2c>
+    42c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    42cf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    42d0:	8b 08                	mov    (%eax),%ecx
+    42d2:	89 0a                	mov    %ecx,(%edx)
+    42d4:	eb b9                	jmp    428f <malloc+0x9f>
@@ -1411,6 +1411,170 @@ forktest(void)
   printf(1, "fork test OK\n");
 }
 
+static volatile int threadval;
+
+void
+threadadd(void *arg1, void *arg2)
+{
+  threadval += (int)arg1 + (int)arg2;
+  exit();
+}
+
+// clone() threads share memory with their creator, and join()
+// hands back the stack each was given.
+void
+clonetest(void)
+{
+  void *stack, *st;
+  int pid;
+
+  printf(1, "clone test\n");
+
+  if((stack = malloc(4096)) == 0){
+    printf(1, "malloc failed\n");
+    exit();
+  }
+  threadval = 1;
+  if((pid = clone(threadadd, (void*)2, (void*)3, stack)) < 0){
+    printf(1, "clone failed\n");
+    exit();
+  }
+  if(join(&st) != pid){
+    printf(1, "join wrong pid\n");
+    exit();
+  }
+  if(st != stack){
+    printf(1, "join returned the wrong stack\n");
+    exit();
+  }
+  if(threadval != 6){
+    printf(1, "clone: thread's memory not shared\n");
+    exit();
+  }
+  if(join(&st) != -1){
+    printf(1, "join without threads succeeded\n");
+    exit();
+  }
+  if(clone(threadadd, 0, 0, sbrk(0) - 100) != -1){
+    printf(1, "clone with a stack past the end succeeded\n");
+    exit();
+  }
+  free(stack);
+
+  printf(1, "clone test OK\n");
+}
+
+static int sbrkfds[2];
+
+void
+threadread(void *arg1, void *arg2)
+{
+  char c;
+
+  read(sbrkfds[0], &c, 1);
+  exit();
+}
+
+// Shrinking memory shared with a thread waits for the thread's system
+// call, here a blocked read(), to finish instead of failing.
+void
+clonesbrktest(void)
+{
+  void *stack, *st;
+  char *a;
+  int pid;
+
+  printf(1, "clone sbrk test\n");
+
+  if(pipe(sbrkfds) < 0){
+    printf(1, "pipe failed\n");
+    exit();
+  }
+  if((stack = malloc(4096)) == 0){
+    printf(1, "malloc failed\n");
+    exit();
+  }
+  if(clone(threadread, 0, 0, stack) < 0){
+    printf(1, "clone failed\n");
+    exit();
+  }
+  a = sbrk(4096);
+  if((pid = fork()) < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    sleep(5);   // the thread is most likely blocked in read() by now
+    write(sbrkfds[1], "x", 1);
+    exit();
+  }
+  if(sbrk(-4096) != a + 4096){
+    printf(1, "sbrk(-4096) with a blocked thread failed\n");
+    exit();
+  }
+  if(join(&st) < 0){
+    printf(1, "join failed\n");
+    exit();
+  }
+  wait();
+  close(sbrkfds[0]);
+  close(sbrkfds[1]);
+  free(stack);
+
+  printf(1, "clone sbrk test OK\n");
+}
+
+static volatile uint futexword;
+
+void
+futexwaiter(void *arg1, void *arg2)
+{
+  while(futexword == 0)
+    futex_wait(&futexword, 0);
+  futexword = 2;
+  exit();
+}
+
+// futex_wait() only sleeps while the word holds the expected value,
+// and futex_wake() gets a sleeper going again.
+void
+futextest(void)
+{
+  void *stack, *st;
+
+  printf(1, "futex test\n");
+
+  futexword = 1;
+  if(futex_wait(&futexword, 0) != -1){
+    printf(1, "futex_wait slept on a changed value\n");
+    exit();
+  }
+  if(futex_wait((uint*)((char*)&futexword + 1), 0) != -1){
+    printf(1, "futex_wait took an unaligned address\n");
+    exit();
+  }
+
+  if((stack = malloc(4096)) == 0){
+    printf(1, "malloc failed\n");
+    exit();
+  }
+  futexword = 0;
+  if(clone(futexwaiter, 0, 0, stack) < 0){
+    printf(1, "clone failed\n");
+    exit();
+  }
+  sleep(2);   // most likely asleep in futex_wait() by now
+  futexword = 1;
+  futex_wake(&futexword, 1);
+  if(join(&st) < 0 || futexword != 2){
+    printf(1, "futex waiter did not finish\n");
+    exit();
+  }
+  free(stack);
+
+  printf(1, "futex test OK\n");
+}
+
 void
 sbrktest(void)
 {
@@ -1793,6 +1957,9 @@ main(int argc, char *argv[])
   dirfile();
   iref();
   forktest();
+  clonetest();
+  clonesbrktest();
+  futextest();
   bigdir(); // slow
 
   uio();
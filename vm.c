@@ -42,10 +42,9 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   if(*pde & PTE_P){
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
-      return 0;
     // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
+    if(!alloc || (pgtab = (pte_t*)kalloc_zeroed()) == 0)
+      return 0;
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -121,9 +120,8 @@ setupkvm(void)
   pde_t *pgdir;
   struct kmap *k;
 
-  if((pgdir = (pde_t*)kalloc()) == 0)
+  if((pgdir = (pde_t*)kalloc_zeroed()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
   if (P2V(PHYSTOP) > (void*)DEVSPACE)
     panic("PHYSTOP too high");
   for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
@@ -160,7 +158,7 @@ switchuvm(struct proc *p)
     panic("switchuvm: no process");
   if(p->kstack == 0)
     panic("switchuvm: no kstack");
-  if(p->pgdir == 0)
+  if(p->vm == 0 || p->vm->pgdir == 0)
     panic("switchuvm: no pgdir");
 
   pushcli();
@@ -173,7 +171,7 @@ switchuvm(struct proc *p)
   // forbids I/O instructions (e.g., inb and outb) from user space
   mycpu()->ts.iomb = (ushort) 0xFFFF;
   ltr(SEG_TSS << 3);
-  lcr3(V2P(p->pgdir));  // switch to process's address space
+  lcr3(V2P(p->vm->pgdir));  // switch to process's address space
   popcli();
 }
 
@@ -186,8 +184,7 @@ inituvm(pde_t *pgdir, char *init, uint sz)
 
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = kalloc();
-  memset(mem, 0, PGSIZE);
+  mem = kalloc_zeroed();
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
   memmove(mem, init, sz);
 }
@@ -231,13 +228,12 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    mem = kalloc_zeroed();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
     if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
       cprintf("allocuvm out of memory (2)\n");
       deallocuvm(pgdir, newsz, oldsz);
@@ -273,11 +269,33 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
       char *v = P2V(pa);
       kfree(v);
       *pte = 0;
+    } else if(*pte != 0){
+      // Left by unmapuvm().
+      kfree(P2V(PTE_ADDR(*pte)));
+      *pte = 0;
     }
   }
   return newsz;
 }
 
+// Make the user pages from newsz up to oldsz not present, but keep
+// them for deallocuvm() to free.  For shrinking memory other CPUs may
+// still reach through their TLBs: flush those in between.
+void
+unmapuvm(pde_t *pgdir, uint oldsz, uint newsz)
+{
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDUP(newsz); a < oldsz; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else
+      *pte &= ~PTE_P;
+  }
+}
+
 // Free a page table and all the physical memory pages
 // in the user part.
 void
@@ -344,6 +362,94 @@ bad:
   return 0;
 }
 
+// Like copyuvm, but share the pages instead of copying them: writable
+// pages become read-only and PTE_COW in both page tables, and the
+// first write to one gets its writer a private copy (cowbreak).
+// The caller must flush pgdir's stale writable TLB entries.
+pde_t*
+cowuvm(pde_t *pgdir, uint sz)
+{
+  pde_t *d;
+  pte_t *pte;
+  uint pa, i;
+
+  if((d = setupkvm()) == 0)
+    return 0;
+  for(i = 0; i < sz; i += PGSIZE){
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
+      panic("cowuvm: pte should exist");
+    if(!(*pte & PTE_P))
+      panic("cowuvm: page not present");
+    if(*pte & PTE_W)
+      *pte = (*pte & ~PTE_W) | PTE_COW;
+    pa = PTE_ADDR(*pte);
+    if(mappages(d, (void*)i, PGSIZE, pa, PTE_FLAGS(*pte)) < 0)
+      goto bad;
+    kshare(P2V(pa));
+  }
+  return d;
+
+bad:
+  freevm(d);
+  return 0;
+}
+
+// Make the copy-on-write page at va in pgdir writable, copying it
+// if another page table still shares it.  Returns 1 if it did, 0 if
+// the page is not copy-on-write, and -1 if out of memory.
+int
+cowbreak(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  char *old, *mem;
+
+  va = PGROUNDDOWN(va);
+  if((pte = walkpgdir(pgdir, (void*)va, 0)) == 0 ||
+     (*pte & (PTE_P|PTE_COW)) != (PTE_P|PTE_COW))
+    return 0;
+  old = P2V(PTE_ADDR(*pte));
+  if(kshared(old)){
+    if((mem = kalloc()) == 0)
+      return -1;
+    memmove(mem, old, PGSIZE);
+    *pte = V2P(mem) | (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+    kfree(old);   // drop our share
+  } else {
+    // The others let go of it already.
+    *pte = (*pte & ~PTE_COW) | PTE_W;
+  }
+  if(rcr3() == V2P(pgdir))
+    invlpg((void*)va);
+  return 1;
+}
+
+// Break every copy-on-write page below sz, so that pgdir can be
+// shared by threads.  Returns -1 if out of memory.
+int
+cowbreakall(pde_t *pgdir, uint sz)
+{
+  uint i;
+
+  for(i = 0; i < sz; i += PGSIZE)
+    if(cowbreak(pgdir, i) < 0)
+      return -1;
+  return 0;
+}
+
+// Handle a write fault at va in the current process.  Returns 1 if
+// it was a copy-on-write page, which is now writable.  Takes no
+// sleeplocks: the kernel faults here too, with spinlocks held, when
+// it writes user memory directly (argptr() buffers, say).
+int
+cowfault(uint va)
+{
+  struct proc *p = myproc();
+
+  if(p == 0 || va >= p->vm->sz)
+    return 0;
+  return cowbreak(p->vm->pgdir, va) > 0;
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -371,6 +477,8 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    if(cowbreak(pgdir, va0) < 0)
+      return -1;
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;
@@ -0,0 +1,1441 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 28                	jg     51 <main+0x51>
+  29:	eb 54                	jmp    7f <main+0x7f>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+  35:	83 c6 01             	add    $0x1,%esi
+  38:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+  3b:	50                   	push   %eax
+  3c:	e8 5f 00 00 00       	call   a0 <wc>
+    close(fd);
+  41:	89 3c 24             	mov    %edi,(%esp)
+  44:	e8 1f 04 00 00       	call   468 <close>
+  for(i = 1; i < argc; i++){
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4f:	74 29                	je     7a <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+  51:	83 ec 08             	sub    $0x8,%esp
+  54:	6a 00                	push   $0x0
+  56:	ff 33                	push   (%ebx)
+  58:	e8 23 04 00 00       	call   480 <open>
+  5d:	83 c4 10             	add    $0x10,%esp
+  60:	89 c7                	mov    %eax,%edi
+  62:	85 c0                	test   %eax,%eax
+  64:	79 ca                	jns    30 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+  66:	50                   	push   %eax
+  67:	ff 33                	push   (%ebx)
+  69:	68 3b 09 00 00       	push   $0x93b
+  6e:	6a 01                	push   $0x1
+  70:	e8 7b 05 00 00       	call   5f0 <printf>
+      exit();
+  75:	e8 c6 03 00 00       	call   440 <exit>
+  }
+  exit();
+  7a:	e8 c1 03 00 00       	call   440 <exit>
+    wc(0, "");
+  7f:	52                   	push   %edx
+  80:	52                   	push   %edx
+  81:	68 2d 09 00 00       	push   $0x92d
+  86:	6a 00                	push   $0x0
+  88:	e8 13 00 00 00       	call   a0 <wc>
+    exit();
+  8d:	e8 ae 03 00 00       	call   440 <exit>
+  92:	66 90                	xchg   %ax,%ax
+  94:	66 90                	xchg   %ax,%ax
+  96:	66 90                	xchg   %ax,%ax
+  98:	66 90                	xchg   %ax,%ax
+  9a:	66 90                	xchg   %ax,%ax
+  9c:	66 90                	xchg   %ax,%ax
+  9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <wc>:
+{
+  a0:	55                   	push   %ebp
+  l = w = c = 0;
+  a1:	31 d2                	xor    %edx,%edx
+{
+  a3:	89 e5                	mov    %esp,%ebp
+  a5:	57                   	push   %edi
+  a6:	56                   	push   %esi
+  inword = 0;
+  a7:	31 f6                	xor    %esi,%esi
+{
+  a9:	53                   	push   %ebx
+  l = w = c = 0;
+  aa:	31 db                	xor    %ebx,%ebx
+{
+  ac:	83 ec 1c             	sub    $0x1c,%esp
+  l = w = c = 0;
+  af:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  c0:	83 ec 04             	sub    $0x4,%esp
+  c3:	68 00 02 00 00       	push   $0x200
+  c8:	68 e0 0c 00 00       	push   $0xce0
+  cd:	ff 75 08             	push   0x8(%ebp)
+  d0:	e8 83 03 00 00       	call   458 <read>
+  d5:	83 c4 10             	add    $0x10,%esp
+  d8:	89 c1                	mov    %eax,%ecx
+  da:	85 c0                	test   %eax,%eax
+  dc:	7e 62                	jle    140 <wc+0xa0>
+    for(i=0; i<n; i++){
+  de:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  e1:	31 ff                	xor    %edi,%edi
+  e3:	eb 0d                	jmp    f2 <wc+0x52>
+  e5:	8d 76 00             	lea    0x0(%esi),%esi
+        inword = 0;
+  e8:	31 f6                	xor    %esi,%esi
+    for(i=0; i<n; i++){
+  ea:	83 c7 01             	add    $0x1,%edi
+  ed:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  f0:	74 3e                	je     130 <wc+0x90>
+      if(buf[i] == '\n')
+  f2:	0f be 87 e0 0c 00 00 	movsbl 0xce0(%edi),%eax
+        l++;
+  f9:	31 c9                	xor    %ecx,%ecx
+  fb:	3c 0a                	cmp    $0xa,%al
+  fd:	0f 94 c1             	sete   %cl
+      if(strchr(" \r\t\n\v", buf[i]))
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	50                   	push   %eax
+        l++;
+ 104:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", buf[i]))
+ 106:	68 18 09 00 00       	push   $0x918
+ 10b:	e8 50 01 00 00       	call   260 <strchr>
+ 110:	83 c4 10             	add    $0x10,%esp
+ 113:	85 c0                	test   %eax,%eax
+ 115:	75 d1                	jne    e8 <wc+0x48>
+      else if(!inword){
+ 117:	85 f6                	test   %esi,%esi
+ 119:	75 cf                	jne    ea <wc+0x4a>
+        w++;
+ 11b:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+ 11f:	be 01 00 00 00       	mov    $0x1,%esi
+    for(i=0; i<n; i++){
+ 124:	83 c7 01             	add    $0x1,%edi
+ 127:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 12a:	75 c6                	jne    f2 <wc+0x52>
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c++;
+ 130:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 133:	01 4d dc             	add    %ecx,-0x24(%ebp)
+ 136:	eb 88                	jmp    c0 <wc+0x20>
+ 138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+  if(n < 0){
+ 140:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 143:	75 22                	jne    167 <wc+0xc7>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 145:	83 ec 08             	sub    $0x8,%esp
+ 148:	ff 75 0c             	push   0xc(%ebp)
+ 14b:	52                   	push   %edx
+ 14c:	ff 75 e0             	push   -0x20(%ebp)
+ 14f:	53                   	push   %ebx
+ 150:	68 2e 09 00 00       	push   $0x92e
+ 155:	6a 01                	push   $0x1
+ 157:	e8 94 04 00 00       	call   5f0 <printf>
+}
+ 15c:	83 c4 20             	add    $0x20,%esp
+ 15f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 162:	5b                   	pop    %ebx
+ 163:	5e                   	pop    %esi
+ 164:	5f                   	pop    %edi
+ 165:	5d                   	pop    %ebp
+ 166:	c3                   	ret
+    printf(1, "wc: read error\n");
+ 167:	50                   	push   %eax
+ 168:	50                   	push   %eax
+ 169:	68 1e 09 00 00       	push   $0x91e
+ 16e:	6a 01                	push   $0x1
+ 170:	e8 7b 04 00 00       	call   5f0 <printf>
+    exit();
+ 175:	e8 c6 02 00 00       	call   440 <exit>
+ 17a:	66 90                	xchg   %ax,%ax
+ 17c:	66 90                	xchg   %ax,%ax
+ 17e:	66 90                	xchg   %ax,%ax
+
+00000180 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 180:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 181:	31 c0                	xor    %eax,%eax
+{
+ 183:	89 e5                	mov    %esp,%ebp
+ 185:	53                   	push   %ebx
+ 186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 190:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 194:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 197:	83 c0 01             	add    $0x1,%eax
+ 19a:	84 d2                	test   %dl,%dl
+ 19c:	75 f2                	jne    190 <strcpy+0x10>
+    ;
+  return os;
+}
+ 19e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a1:	89 c8                	mov    %ecx,%eax
+ 1a3:	c9                   	leave
+ 1a4:	c3                   	ret
+ 1a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	53                   	push   %ebx
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1ba:	0f b6 02             	movzbl (%edx),%eax
+ 1bd:	84 c0                	test   %al,%al
+ 1bf:	75 17                	jne    1d8 <strcmp+0x28>
+ 1c1:	eb 3a                	jmp    1fd <strcmp+0x4d>
+ 1c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1c7:	90                   	nop
+ 1c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1cc:	83 c2 01             	add    $0x1,%edx
+ 1cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1d2:	84 c0                	test   %al,%al
+ 1d4:	74 1a                	je     1f0 <strcmp+0x40>
+    p++, q++;
+ 1d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1db:	38 c3                	cmp    %al,%bl
+ 1dd:	74 e9                	je     1c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1df:	29 d8                	sub    %ebx,%eax
+}
+ 1e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e4:	c9                   	leave
+ 1e5:	c3                   	ret
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1f4:	31 c0                	xor    %eax,%eax
+ 1f6:	29 d8                	sub    %ebx,%eax
+}
+ 1f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1fb:	c9                   	leave
+ 1fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 200:	31 c0                	xor    %eax,%eax
+ 202:	eb db                	jmp    1df <strcmp+0x2f>
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 216:	80 3a 00             	cmpb   $0x0,(%edx)
+ 219:	74 15                	je     230 <strlen+0x20>
+ 21b:	31 c0                	xor    %eax,%eax
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+ 220:	83 c0 01             	add    $0x1,%eax
+ 223:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 227:	89 c1                	mov    %eax,%ecx
+ 229:	75 f5                	jne    220 <strlen+0x10>
+    ;
+  return n;
+}
+ 22b:	89 c8                	mov    %ecx,%eax
+ 22d:	5d                   	pop    %ebp
+ 22e:	c3                   	ret
+ 22f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 230:	31 c9                	xor    %ecx,%ecx
+}
+ 232:	5d                   	pop    %ebp
+ 233:	89 c8                	mov    %ecx,%eax
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000240 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 247:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	89 d7                	mov    %edx,%edi
+ 24f:	fc                   	cld
+ 250:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 252:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 255:	89 d0                	mov    %edx,%eax
+ 257:	c9                   	leave
+ 258:	c3                   	ret
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 45 08             	mov    0x8(%ebp),%eax
+ 266:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 26a:	0f b6 10             	movzbl (%eax),%edx
+ 26d:	84 d2                	test   %dl,%dl
+ 26f:	75 12                	jne    283 <strchr+0x23>
+ 271:	eb 1d                	jmp    290 <strchr+0x30>
+ 273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 277:	90                   	nop
+ 278:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 27c:	83 c0 01             	add    $0x1,%eax
+ 27f:	84 d2                	test   %dl,%dl
+ 281:	74 0d                	je     290 <strchr+0x30>
+    if(*s == c)
+ 283:	38 d1                	cmp    %dl,%cl
+ 285:	75 f1                	jne    278 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 287:	5d                   	pop    %ebp
+ 288:	c3                   	ret
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 290:	31 c0                	xor    %eax,%eax
+}
+ 292:	5d                   	pop    %ebp
+ 293:	c3                   	ret
+ 294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2a9:	31 db                	xor    %ebx,%ebx
+{
+ 2ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ae:	eb 27                	jmp    2d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	6a 01                	push   $0x1
+ 2b5:	56                   	push   %esi
+ 2b6:	6a 00                	push   $0x0
+ 2b8:	e8 9b 01 00 00       	call   458 <read>
+    if(cc < 1)
+ 2bd:	83 c4 10             	add    $0x10,%esp
+ 2c0:	85 c0                	test   %eax,%eax
+ 2c2:	7e 1d                	jle    2e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2cf:	3c 0a                	cmp    $0xa,%al
+ 2d1:	74 10                	je     2e3 <gets+0x43>
+ 2d3:	3c 0d                	cmp    $0xd,%al
+ 2d5:	74 0c                	je     2e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2d7:	89 df                	mov    %ebx,%edi
+ 2d9:	83 c3 01             	add    $0x1,%ebx
+ 2dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2df:	7c cf                	jl     2b0 <gets+0x10>
+ 2e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ed:	5b                   	pop    %ebx
+ 2ee:	5e                   	pop    %esi
+ 2ef:	5f                   	pop    %edi
+ 2f0:	5d                   	pop    %ebp
+ 2f1:	c3                   	ret
+ 2f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	56                   	push   %esi
+ 304:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 305:	83 ec 08             	sub    $0x8,%esp
+ 308:	6a 00                	push   $0x0
+ 30a:	ff 75 08             	push   0x8(%ebp)
+ 30d:	e8 6e 01 00 00       	call   480 <open>
+  if(fd < 0)
+ 312:	83 c4 10             	add    $0x10,%esp
+ 315:	85 c0                	test   %eax,%eax
+ 317:	78 27                	js     340 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 319:	83 ec 08             	sub    $0x8,%esp
+ 31c:	ff 75 0c             	push   0xc(%ebp)
+ 31f:	89 c3                	mov    %eax,%ebx
+ 321:	50                   	push   %eax
+ 322:	e8 71 01 00 00       	call   498 <fstat>
+  close(fd);
+ 327:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 32a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 32c:	e8 37 01 00 00       	call   468 <close>
+  return r;
+ 331:	83 c4 10             	add    $0x10,%esp
+}
+ 334:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 337:	89 f0                	mov    %esi,%eax
+ 339:	5b                   	pop    %ebx
+ 33a:	5e                   	pop    %esi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 345:	eb ed                	jmp    334 <stat+0x34>
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	53                   	push   %ebx
+ 354:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 357:	0f be 02             	movsbl (%edx),%eax
+ 35a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 35d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 360:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 365:	77 1e                	ja     385 <atoi+0x35>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 370:	83 c2 01             	add    $0x1,%edx
+ 373:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 376:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 37a:	0f be 02             	movsbl (%edx),%eax
+ 37d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 380:	80 fb 09             	cmp    $0x9,%bl
+ 383:	76 eb                	jbe    370 <atoi+0x20>
+  return n;
+}
+ 385:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 388:	89 c8                	mov    %ecx,%eax
+ 38a:	c9                   	leave
+ 38b:	c3                   	ret
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+ 395:	8b 45 10             	mov    0x10(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 39e:	85 c0                	test   %eax,%eax
+ 3a0:	7e 13                	jle    3b5 <memmove+0x25>
+ 3a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3a4:	89 d7                	mov    %edx,%edi
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3b1:	39 f8                	cmp    %edi,%eax
+ 3b3:	75 fb                	jne    3b0 <memmove+0x20>
+  return vdst;
+}
+ 3b5:	5e                   	pop    %esi
+ 3b6:	89 d0                	mov    %edx,%eax
+ 3b8:	5f                   	pop    %edi
+ 3b9:	5d                   	pop    %ebp
+ 3ba:	c3                   	ret
+ 3bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+
+000003c0 <mutex_lock>:
+
+// Take and release m with atomic instructions, and enter the kernel
+// only to block while it is held or to wake a blocked thread.
+void
+mutex_lock(struct mutex *m)
+{
+ 3c0:	55                   	push   %ebp
+  uint s;
+
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 3c1:	31 c0                	xor    %eax,%eax
+ 3c3:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 3c8:	89 e5                	mov    %esp,%ebp
+ 3ca:	56                   	push   %esi
+ 3cb:	53                   	push   %ebx
+ 3cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 3cf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 3d3:	85 c0                	test   %eax,%eax
+ 3d5:	74 30                	je     407 <mutex_lock+0x47>
+    return;
+  // Contended: mark it so the holder knows to wake us.
+  if(s != 2)
+ 3d7:	83 f8 02             	cmp    $0x2,%eax
+ 3da:	74 0c                	je     3e8 <mutex_lock+0x28>
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 3dc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3e1:	f0 87 03             	lock xchg %eax,(%ebx)
+    s = xchg(&m->state, 2);
+  while(s != 0){
+ 3e4:	85 c0                	test   %eax,%eax
+ 3e6:	74 1f                	je     407 <mutex_lock+0x47>
+ 3e8:	be 02 00 00 00       	mov    $0x2,%esi
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+ 3f0:	83 ec 08             	sub    $0x8,%esp
+ 3f3:	6a 02                	push   $0x2
+ 3f5:	53                   	push   %ebx
+ 3f6:	e8 45 01 00 00       	call   540 <futex_wait>
+ 3fb:	89 f0                	mov    %esi,%eax
+ 3fd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(s != 0){
+ 400:	83 c4 10             	add    $0x10,%esp
+ 403:	85 c0                	test   %eax,%eax
+ 405:	75 e9                	jne    3f0 <mutex_lock+0x30>
+    s = xchg(&m->state, 2);
+  }
+}
+ 407:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 40a:	5b                   	pop    %ebx
+ 40b:	5e                   	pop    %esi
+ 40c:	5d                   	pop    %ebp
+ 40d:	c3                   	ret
+ 40e:	66 90                	xchg   %ax,%ax
+
+00000410 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 410:	55                   	push   %ebp
+ 411:	31 c0                	xor    %eax,%eax
+ 413:	89 e5                	mov    %esp,%ebp
+ 415:	83 ec 08             	sub    $0x8,%esp
+ 418:	8b 55 08             	mov    0x8(%ebp),%edx
+ 41b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 41e:	83 f8 02             	cmp    $0x2,%eax
+ 421:	74 05                	je     428 <mutex_unlock+0x18>
+    futex_wake(&m->state, 1);
+}
+ 423:	c9                   	leave
+ 424:	c3                   	ret
+ 425:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->state, 1);
+ 428:	83 ec 08             	sub    $0x8,%esp
+ 42b:	6a 01                	push   $0x1
+ 42d:	52                   	push   %edx
+ 42e:	e8 15 01 00 00       	call   548 <futex_wake>
+ 433:	83 c4 10             	add    $0x10,%esp
+}
+ 436:	c9                   	leave
+ 437:	c3                   	ret
+
+00000438 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 438:	b8 01 00 00 00       	mov    $0x1,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <exit>:
+SYSCALL(exit)
+ 440:	b8 02 00 00 00       	mov    $0x2,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <wait>:
+SYSCALL(wait)
+ 448:	b8 03 00 00 00       	mov    $0x3,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <pipe>:
+SYSCALL(pipe)
+ 450:	b8 04 00 00 00       	mov    $0x4,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <read>:
+SYSCALL(read)
+ 458:	b8 05 00 00 00       	mov    $0x5,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <write>:
+SYSCALL(write)
+ 460:	b8 10 00 00 00       	mov    $0x10,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <close>:
+SYSCALL(close)
+ 468:	b8 15 00 00 00       	mov    $0x15,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <kill>:
+SYSCALL(kill)
+ 470:	b8 06 00 00 00       	mov    $0x6,%eax
+ 475:	cd 40                	int    $0x40
+ 477:	c3                   	ret
+
+00000478 <exec>:
+SYSCALL(exec)
+ 478:	b8 07 00 00 00       	mov    $0x7,%eax
+ 47d:	cd 40                	int    $0x40
+ 47f:	c3                   	ret
+
+00000480 <open>:
+SYSCALL(open)
+ 480:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 485:	cd 40                	int    $0x40
+ 487:	c3                   	ret
+
+00000488 <mknod>:
+SYSCALL(mknod)
+ 488:	b8 11 00 00 00       	mov    $0x11,%eax
+ 48d:	cd 40                	int    $0x40
+ 48f:	c3                   	ret
+
+00000490 <unlink>:
+SYSCALL(unlink)
+ 490:	b8 12 00 00 00       	mov    $0x12,%eax
+ 495:	cd 40                	int    $0x40
+ 497:	c3                   	ret
+
+00000498 <fstat>:
+SYSCALL(fstat)
+ 498:	b8 08 00 00 00       	mov    $0x8,%eax
+ 49d:	cd 40                	int    $0x40
+ 49f:	c3                   	ret
+
+000004a0 <link>:
+SYSCALL(link)
+ 4a0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4a5:	cd 40                	int    $0x40
+ 4a7:	c3                   	ret
+
+000004a8 <mkdir>:
+SYSCALL(mkdir)
+ 4a8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4ad:	cd 40                	int    $0x40
+ 4af:	c3                   	ret
+
+000004b0 <chdir>:
+SYSCALL(chdir)
+ 4b0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4b5:	cd 40                	int    $0x40
+ 4b7:	c3                   	ret
+
+000004b8 <dup>:
+SYSCALL(dup)
+ 4b8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4bd:	cd 40                	int    $0x40
+ 4bf:	c3                   	ret
+
+000004c0 <getpid>:
+SYSCALL(getpid)
+ 4c0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4c5:	cd 40                	int    $0x40
+ 4c7:	c3                   	ret
+
+000004c8 <sbrk>:
+SYSCALL(sbrk)
+ 4c8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4cd:	cd 40                	int    $0x40
+ 4cf:	c3                   	ret
+
+000004d0 <sleep>:
+SYSCALL(sleep)
+ 4d0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4d5:	cd 40                	int    $0x40
+ 4d7:	c3                   	ret
+
+000004d8 <uptime>:
+SYSCALL(uptime)
+ 4d8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4dd:	cd 40                	int    $0x40
+ 4df:	c3                   	ret
+
+000004e0 <ps>:
+SYSCALL(ps)
+ 4e0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4e5:	cd 40                	int    $0x40
+ 4e7:	c3                   	ret
+
+000004e8 <getschedparams>:
+SYSCALL(getschedparams)
+ 4e8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4ed:	cd 40                	int    $0x40
+ 4ef:	c3                   	ret
+
+000004f0 <setschedparams>:
+SYSCALL(setschedparams)
+ 4f0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4f5:	cd 40                	int    $0x40
+ 4f7:	c3                   	ret
+
+000004f8 <getpinfo>:
+SYSCALL(getpinfo)
+ 4f8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4fd:	cd 40                	int    $0x40
+ 4ff:	c3                   	ret
+
+00000500 <getlathist>:
+SYSCALL(getlathist)
+ 500:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 505:	cd 40                	int    $0x40
+ 507:	c3                   	ret
+
+00000508 <setpolicy>:
+SYSCALL(setpolicy)
+ 508:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 50d:	cd 40                	int    $0x40
+ 50f:	c3                   	ret
+
+00000510 <settickets>:
+SYSCALL(settickets)
+ 510:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 515:	cd 40                	int    $0x40
+ 517:	c3                   	ret
+
+00000518 <setaffinity>:
+SYSCALL(setaffinity)
+ 518:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 51d:	cd 40                	int    $0x40
+ 51f:	c3                   	ret
+
+00000520 <getaffinity>:
+SYSCALL(getaffinity)
+ 520:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 525:	cd 40                	int    $0x40
+ 527:	c3                   	ret
+
+00000528 <setrt>:
+SYSCALL(setrt)
+ 528:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 52d:	cd 40                	int    $0x40
+ 52f:	c3                   	ret
+
+00000530 <clone>:
+SYSCALL(clone)
+ 530:	b8 20 00 00 00       	mov    $0x20,%eax
+ 535:	cd 40                	int    $0x40
+ 537:	c3                   	ret
+
+00000538 <join>:
+SYSCALL(join)
+ 538:	b8 21 00 00 00       	mov    $0x21,%eax
+ 53d:	cd 40                	int    $0x40
+ 53f:	c3                   	ret
+
+00000540 <futex_wait>:
+SYSCALL(futex_wait)
+ 540:	b8 22 00 00 00       	mov    $0x22,%eax
+ 545:	cd 40                	int    $0x40
+ 547:	c3                   	ret
+
+00000548 <futex_wake>:
+SYSCALL(futex_wake)
+ 548:	b8 23 00 00 00       	mov    $0x23,%eax
+ 54d:	cd 40                	int    $0x40
+ 54f:	c3                   	ret
+
+00000550 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 558:	89 d1                	mov    %edx,%ecx
+{
+ 55a:	83 ec 3c             	sub    $0x3c,%esp
+ 55d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 560:	85 d2                	test   %edx,%edx
+ 562:	0f 89 80 00 00 00    	jns    5e8 <printint+0x98>
+ 568:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 56c:	74 7a                	je     5e8 <printint+0x98>
+    x = -xx;
+ 56e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 570:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 575:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 578:	31 f6                	xor    %esi,%esi
+ 57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 580:	89 c8                	mov    %ecx,%eax
+ 582:	31 d2                	xor    %edx,%edx
+ 584:	89 f7                	mov    %esi,%edi
+ 586:	f7 f3                	div    %ebx
+ 588:	8d 76 01             	lea    0x1(%esi),%esi
+ 58b:	0f b6 92 b0 09 00 00 	movzbl 0x9b0(%edx),%edx
+ 592:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 596:	89 ca                	mov    %ecx,%edx
+ 598:	89 c1                	mov    %eax,%ecx
+ 59a:	39 da                	cmp    %ebx,%edx
+ 59c:	73 e2                	jae    580 <printint+0x30>
+  if(neg)
+ 59e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5a1:	85 c0                	test   %eax,%eax
+ 5a3:	74 07                	je     5ac <printint+0x5c>
+    buf[i++] = '-';
+ 5a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5aa:	89 f7                	mov    %esi,%edi
+ 5ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5b2:	01 df                	add    %ebx,%edi
+ 5b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5bb:	83 ec 04             	sub    $0x4,%esp
+ 5be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5c4:	6a 01                	push   $0x1
+ 5c6:	50                   	push   %eax
+ 5c7:	56                   	push   %esi
+ 5c8:	e8 93 fe ff ff       	call   460 <write>
+  while(--i >= 0)
+ 5cd:	89 f8                	mov    %edi,%eax
+ 5cf:	83 c4 10             	add    $0x10,%esp
+ 5d2:	83 ef 01             	sub    $0x1,%edi
+ 5d5:	39 d8                	cmp    %ebx,%eax
+ 5d7:	75 df                	jne    5b8 <printint+0x68>
+}
+ 5d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5dc:	5b                   	pop    %ebx
+ 5dd:	5e                   	pop    %esi
+ 5de:	5f                   	pop    %edi
+ 5df:	5d                   	pop    %ebp
+ 5e0:	c3                   	ret
+ 5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5e8:	31 c0                	xor    %eax,%eax
+ 5ea:	eb 89                	jmp    575 <printint+0x25>
+ 5ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	56                   	push   %esi
+ 5f5:	53                   	push   %ebx
+ 5f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 602:	83 c6 01             	add    $0x1,%esi
+ 605:	84 db                	test   %bl,%bl
+ 607:	74 67                	je     670 <printf+0x80>
+ 609:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 60c:	31 d2                	xor    %edx,%edx
+ 60e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 611:	eb 34                	jmp    647 <printf+0x57>
+ 613:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 617:	90                   	nop
+ 618:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 61b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 620:	83 f8 25             	cmp    $0x25,%eax
+ 623:	74 18                	je     63d <printf+0x4d>
+  write(fd, &c, 1);
+ 625:	83 ec 04             	sub    $0x4,%esp
+ 628:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 62b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 62e:	6a 01                	push   $0x1
+ 630:	50                   	push   %eax
+ 631:	57                   	push   %edi
+ 632:	e8 29 fe ff ff       	call   460 <write>
+ 637:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 63a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 63d:	0f b6 1e             	movzbl (%esi),%ebx
+ 640:	83 c6 01             	add    $0x1,%esi
+ 643:	84 db                	test   %bl,%bl
+ 645:	74 29                	je     670 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 647:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 64a:	85 d2                	test   %edx,%edx
+ 64c:	74 ca                	je     618 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 64e:	83 fa 25             	cmp    $0x25,%edx
+ 651:	75 ea                	jne    63d <printf+0x4d>
+      if(c == 'd'){
+ 653:	83 f8 25             	cmp    $0x25,%eax
+ 656:	0f 84 24 01 00 00    	je     780 <printf+0x190>
+ 65c:	83 e8 63             	sub    $0x63,%eax
+ 65f:	83 f8 15             	cmp    $0x15,%eax
+ 662:	77 1c                	ja     680 <printf+0x90>
+ 664:	ff 24 85 58 09 00 00 	jmp    *0x958(,%eax,4)
+ 66b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 66f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 670:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 673:	5b                   	pop    %ebx
+ 674:	5e                   	pop    %esi
+ 675:	5f                   	pop    %edi
+ 676:	5d                   	pop    %ebp
+ 677:	c3                   	ret
+ 678:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+  write(fd, &c, 1);
+ 680:	83 ec 04             	sub    $0x4,%esp
+ 683:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 686:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 68a:	6a 01                	push   $0x1
+ 68c:	52                   	push   %edx
+ 68d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 690:	57                   	push   %edi
+ 691:	e8 ca fd ff ff       	call   460 <write>
+ 696:	83 c4 0c             	add    $0xc,%esp
+ 699:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 69c:	6a 01                	push   $0x1
+ 69e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6a1:	52                   	push   %edx
+ 6a2:	57                   	push   %edi
+ 6a3:	e8 b8 fd ff ff       	call   460 <write>
+        putc(fd, c);
+ 6a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ab:	31 d2                	xor    %edx,%edx
+ 6ad:	eb 8e                	jmp    63d <printf+0x4d>
+ 6af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6b3:	83 ec 0c             	sub    $0xc,%esp
+ 6b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6bb:	8b 13                	mov    (%ebx),%edx
+ 6bd:	6a 00                	push   $0x0
+ 6bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6c4:	e8 87 fe ff ff       	call   550 <printint>
+        ap++;
+ 6c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6cf:	31 d2                	xor    %edx,%edx
+ 6d1:	e9 67 ff ff ff       	jmp    63d <printf+0x4d>
+ 6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6e5:	83 c0 04             	add    $0x4,%eax
+ 6e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6eb:	85 db                	test   %ebx,%ebx
+ 6ed:	0f 84 9d 00 00 00    	je     790 <printf+0x1a0>
+        while(*s != 0){
+ 6f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6f8:	84 c0                	test   %al,%al
+ 6fa:	0f 84 3d ff ff ff    	je     63d <printf+0x4d>
+ 700:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 703:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 706:	89 de                	mov    %ebx,%esi
+ 708:	89 d3                	mov    %edx,%ebx
+ 70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 716:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 719:	6a 01                	push   $0x1
+ 71b:	53                   	push   %ebx
+ 71c:	57                   	push   %edi
+ 71d:	e8 3e fd ff ff       	call   460 <write>
+        while(*s != 0){
+ 722:	0f b6 06             	movzbl (%esi),%eax
+ 725:	83 c4 10             	add    $0x10,%esp
+ 728:	84 c0                	test   %al,%al
+ 72a:	75 e4                	jne    710 <printf+0x120>
+      state = 0;
+ 72c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 72f:	31 d2                	xor    %edx,%edx
+ 731:	e9 07 ff ff ff       	jmp    63d <printf+0x4d>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 740:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 74b:	8b 13                	mov    (%ebx),%edx
+ 74d:	6a 01                	push   $0x1
+ 74f:	e9 6b ff ff ff       	jmp    6bf <printf+0xcf>
+ 754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 758:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 75b:	83 ec 04             	sub    $0x4,%esp
+ 75e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 761:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 763:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 766:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 769:	6a 01                	push   $0x1
+ 76b:	52                   	push   %edx
+ 76c:	57                   	push   %edi
+ 76d:	e8 ee fc ff ff       	call   460 <write>
+        ap++;
+ 772:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 775:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 778:	31 d2                	xor    %edx,%edx
+ 77a:	e9 be fe ff ff       	jmp    63d <printf+0x4d>
+ 77f:	90                   	nop
+  write(fd, &c, 1);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 786:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 789:	6a 01                	push   $0x1
+ 78b:	e9 11 ff ff ff       	jmp    6a1 <printf+0xb1>
+ 790:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 795:	bb 4f 09 00 00       	mov    $0x94f,%ebx
+ 79a:	e9 61 ff ff ff       	jmp    700 <printf+0x110>
+ 79f:	90                   	nop
+
+000007a0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7a1:	a1 e0 0e 00 00       	mov    0xee0,%eax
+{
+ 7a6:	89 e5                	mov    %esp,%ebp
+ 7a8:	57                   	push   %edi
+ 7a9:	56                   	push   %esi
+ 7aa:	53                   	push   %ebx
+ 7ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7ae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7b8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7ba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7bc:	39 ca                	cmp    %ecx,%edx
+ 7be:	73 30                	jae    7f0 <free+0x50>
+ 7c0:	39 c1                	cmp    %eax,%ecx
+ 7c2:	72 04                	jb     7c8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7c4:	39 c2                	cmp    %eax,%edx
+ 7c6:	72 f0                	jb     7b8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7c8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7cb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7ce:	39 f8                	cmp    %edi,%eax
+ 7d0:	74 2e                	je     800 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7d2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7d5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7d8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7db:	39 f1                	cmp    %esi,%ecx
+ 7dd:	74 38                	je     817 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7df:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7e1:	5b                   	pop    %ebx
+  freep = p;
+ 7e2:	89 15 e0 0e 00 00    	mov    %edx,0xee0
+}
+ 7e8:	5e                   	pop    %esi
+ 7e9:	5f                   	pop    %edi
+ 7ea:	5d                   	pop    %ebp
+ 7eb:	c3                   	ret
+ 7ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7f0:	39 c1                	cmp    %eax,%ecx
+ 7f2:	72 d0                	jb     7c4 <free+0x24>
+ 7f4:	eb c2                	jmp    7b8 <free+0x18>
+ 7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 800:	03 70 04             	add    0x4(%eax),%esi
+ 803:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 806:	8b 02                	mov    (%edx),%eax
+ 808:	8b 00                	mov    (%eax),%eax
+ 80a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 80d:	8b 42 04             	mov    0x4(%edx),%eax
+ 810:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 813:	39 f1                	cmp    %esi,%ecx
+ 815:	75 c8                	jne    7df <free+0x3f>
+    p->s.size += bp->s.size;
+ 817:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 81a:	89 15 e0 0e 00 00    	mov    %edx,0xee0
+    p->s.size += bp->s.size;
+ 820:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 823:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 826:	89 0a                	mov    %ecx,(%edx)
+}
+ 828:	5b                   	pop    %ebx
+ 829:	5e                   	pop    %esi
+ 82a:	5f                   	pop    %edi
+ 82b:	5d                   	pop    %ebp
+ 82c:	c3                   	ret
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000830 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	57                   	push   %edi
+ 834:	56                   	push   %esi
+ 835:	53                   	push   %ebx
+ 836:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 839:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 83c:	8b 15 e0 0e 00 00    	mov    0xee0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 842:	8d 78 07             	lea    0x7(%eax),%edi
+ 845:	c1 ef 03             	shr    $0x3,%edi
+ 848:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 84b:	85 d2                	test   %edx,%edx
+ 84d:	0f 84 8d 00 00 00    	je     8e0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 853:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 855:	8b 48 04             	mov    0x4(%eax),%ecx
+ 858:	39 f9                	cmp    %edi,%ecx
+ 85a:	73 64                	jae    8c0 <malloc+0x90>
+  if(nu < 4096)
+ 85c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 861:	39 df                	cmp    %ebx,%edi
+ 863:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 866:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 86d:	eb 0a                	jmp    879 <malloc+0x49>
+ 86f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 870:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 872:	8b 48 04             	mov    0x4(%eax),%ecx
+ 875:	39 f9                	cmp    %edi,%ecx
+ 877:	73 47                	jae    8c0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 879:	89 c2                	mov    %eax,%edx
+ 87b:	39 05 e0 0e 00 00    	cmp    %eax,0xee0
+ 881:	75 ed                	jne    870 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 883:	83 ec 0c             	sub    $0xc,%esp
+ 886:	56                   	push   %esi
+ 887:	e8 3c fc ff ff       	call   4c8 <sbrk>
+  if(p == (char*)-1)
+ 88c:	83 c4 10             	add    $0x10,%esp
+ 88f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 892:	74 1c                	je     8b0 <malloc+0x80>
+  hp->s.size = nu;
+ 894:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 897:	83 ec 0c             	sub    $0xc,%esp
+ 89a:	83 c0 08             	add    $0x8,%eax
+ 89d:	50                   	push   %eax
+ 89e:	e8 fd fe ff ff       	call   7a0 <free>
+  return freep;
+ 8a3:	8b 15 e0 0e 00 00    	mov    0xee0,%edx
+      if((p = morecore(nunits)) == 0)
+ 8a9:	83 c4 10             	add    $0x10,%esp
+ 8ac:	85 d2                	test   %edx,%edx
+ 8ae:	75 c0                	jne    870 <malloc+0x40>
+        return 0;
+  }
+}
+ 8b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8b3:	31 c0                	xor    %eax,%eax
+}
+ 8b5:	5b                   	pop    %ebx
+ 8b6:	5e                   	pop    %esi
+ 8b7:	5f                   	pop    %edi
+ 8b8:	5d                   	pop    %ebp
+ 8b9:	c3                   	ret
+ 8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8c0:	39 cf                	cmp    %ecx,%edi
+ 8c2:	74 4c                	je     910 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8c4:	29 f9                	sub    %edi,%ecx
+ 8c6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8c9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8cc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8cf:	89 15 e0 0e 00 00    	mov    %edx,0xee0
+}
+ 8d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8d8:	83 c0 08             	add    $0x8,%eax
+}
+ 8db:	5b                   	pop    %ebx
+ 8dc:	5e                   	pop    %esi
+ 8dd:	5f                   	pop    %edi
+ 8de:	5d                   	pop    %ebp
+ 8df:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8e0:	c7 05 e0 0e 00 00 e4 	movl   $0xee4,0xee0
+ 8e7:	0e 00 00 
+    base.s.size = 0;
+ 8ea:	b8 e4 0e 00 00       	mov    $0xee4,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8ef:	c7 05 e4 0e 00 00 e4 	movl   $0xee4,0xee4
+ 8f6:	0e 00 00 
+    base.s.size = 0;
+ 8f9:	c7 05 e8 0e 00 00 00 	movl   $0x0,0xee8
+ 900:	00 00 00 
+    if(p->s.size >= nunits){
+ 903:	e9 54 ff ff ff       	jmp    85c <malloc+0x2c>
+ 908:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 910:	8b 08                	mov    (%eax),%ecx
+ 912:	89 0a                	mov    %ecx,(%edx)
+ 914:	eb b9                	jmp    8cf <malloc+0x9f>
@@ -0,0 +1,2149 @@
+
+_workload:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	89 c8                	mov    %ecx,%eax
+   c:	55                   	push   %ebp
+   d:	89 e5                	mov    %esp,%ebp
+   f:	57                   	push   %edi
+  10:	56                   	push   %esi
+  11:	53                   	push   %ebx
+  12:	51                   	push   %ecx
+  13:	81 ec 88 00 00 00    	sub    $0x88,%esp
+  19:	8b 09                	mov    (%ecx),%ecx
+  1b:	8b 78 04             	mov    0x4(%eax),%edi
+  int count[NKIND] = { 2, 2, 2 };
+  1e:	c7 45 ac 02 00 00 00 	movl   $0x2,-0x54(%ebp)
+  25:	c7 45 b0 02 00 00 00 	movl   $0x2,-0x50(%ebp)
+  2c:	c7 45 b4 02 00 00 00 	movl   $0x2,-0x4c(%ebp)
+  struct pinfo *pi, *p;
+  struct worker *w;
+  void *stack;
+  uint d;
+
+  for(i = 1; i + 1 < argc; i += 2){
+  33:	83 f9 02             	cmp    $0x2,%ecx
+  36:	0f 8e b8 00 00 00    	jle    f4 <main+0xf4>
+  3c:	8d 71 fd             	lea    -0x3(%ecx),%esi
+  3f:	89 4d 90             	mov    %ecx,-0x70(%ebp)
+  42:	bb 01 00 00 00       	mov    $0x1,%ebx
+  47:	89 f8                	mov    %edi,%eax
+  49:	83 e6 fe             	and    $0xfffffffe,%esi
+  4c:	89 df                	mov    %ebx,%edi
+  4e:	89 c3                	mov    %eax,%ebx
+  50:	83 c6 03             	add    $0x3,%esi
+  53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  57:	90                   	nop
+    if(argv[i][0] != '-' || argv[i][2] != 0)
+  58:	8b 04 bb             	mov    (%ebx,%edi,4),%eax
+  5b:	80 38 2d             	cmpb   $0x2d,(%eax)
+  5e:	75 68                	jne    c8 <main+0xc8>
+  60:	80 78 02 00          	cmpb   $0x0,0x2(%eax)
+  64:	75 62                	jne    c8 <main+0xc8>
+      usage();
+    v = atoi(argv[i+1]);
+  66:	83 ec 0c             	sub    $0xc,%esp
+  69:	ff 74 bb 04          	push   0x4(%ebx,%edi,4)
+  6d:	e8 7e 09 00 00       	call   9f0 <atoi>
+    switch(argv[i][1]){
+  72:	83 c4 10             	add    $0x10,%esp
+    v = atoi(argv[i+1]);
+  75:	89 c1                	mov    %eax,%ecx
+    switch(argv[i][1]){
+  77:	8b 04 bb             	mov    (%ebx,%edi,4),%eax
+  7a:	0f b6 40 01          	movzbl 0x1(%eax),%eax
+  7e:	83 e8 62             	sub    $0x62,%eax
+  81:	3c 15                	cmp    $0x15,%al
+  83:	77 43                	ja     c8 <main+0xc8>
+  85:	0f b6 c0             	movzbl %al,%eax
+  88:	ff 24 85 f8 10 00 00 	jmp    *0x10f8(,%eax,4)
+    case 'c': count[CPU] = v; break;
+    case 'i': count[IO] = v; break;
+    case 'm': count[MIXED] = v; break;
+    case 'w': work = v; break;
+  8f:	89 0d 2c 15 00 00    	mov    %ecx,0x152c
+  95:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 1; i + 1 < argc; i += 2){
+  98:	83 c7 02             	add    $0x2,%edi
+  9b:	39 fe                	cmp    %edi,%esi
+  9d:	75 b9                	jne    58 <main+0x58>
+    case 's': sleepticks = v; break;
+    case 'b': burst = v; break;
+    default: usage();
+    }
+  }
+  if(i != argc || count[CPU] + count[IO] + count[MIXED] > MAXWORKERS)
+  9f:	8b 4d 90             	mov    -0x70(%ebp),%ecx
+  a2:	39 f1                	cmp    %esi,%ecx
+  a4:	75 22                	jne    c8 <main+0xc8>
+  a6:	8b 45 ac             	mov    -0x54(%ebp),%eax
+  a9:	8b 55 b0             	mov    -0x50(%ebp),%edx
+  ac:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  af:	89 45 8c             	mov    %eax,-0x74(%ebp)
+  b2:	01 d0                	add    %edx,%eax
+  b4:	01 f0                	add    %esi,%eax
+  b6:	89 55 88             	mov    %edx,-0x78(%ebp)
+  b9:	89 75 84             	mov    %esi,-0x7c(%ebp)
+  bc:	83 f8 20             	cmp    $0x20,%eax
+  bf:	7e 4d                	jle    10e <main+0x10e>
+  c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    default: usage();
+  c8:	e8 83 05 00 00       	call   650 <usage>
+    case 's': sleepticks = v; break;
+  cd:	89 0d 24 15 00 00    	mov    %ecx,0x1524
+  d3:	eb c3                	jmp    98 <main+0x98>
+    case 'r': rounds = v; break;
+  d5:	89 0d 28 15 00 00    	mov    %ecx,0x1528
+  db:	eb bb                	jmp    98 <main+0x98>
+    case 'm': count[MIXED] = v; break;
+  dd:	89 4d b4             	mov    %ecx,-0x4c(%ebp)
+  e0:	eb b6                	jmp    98 <main+0x98>
+    case 'i': count[IO] = v; break;
+  e2:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+  e5:	eb b1                	jmp    98 <main+0x98>
+    case 'c': count[CPU] = v; break;
+  e7:	89 4d ac             	mov    %ecx,-0x54(%ebp)
+  ea:	eb ac                	jmp    98 <main+0x98>
+    case 'b': burst = v; break;
+  ec:	89 0d 20 15 00 00    	mov    %ecx,0x1520
+  f2:	eb a4                	jmp    98 <main+0x98>
+  if(i != argc || count[CPU] + count[IO] + count[MIXED] > MAXWORKERS)
+  f4:	83 e9 01             	sub    $0x1,%ecx
+  f7:	75 cf                	jne    c8 <main+0xc8>
+  f9:	c7 45 84 02 00 00 00 	movl   $0x2,-0x7c(%ebp)
+ 100:	c7 45 88 02 00 00 00 	movl   $0x2,-0x78(%ebp)
+ 107:	c7 45 8c 02 00 00 00 	movl   $0x2,-0x74(%ebp)
+  start = uptime();
+ 10e:	e8 65 0a 00 00       	call   b78 <uptime>
+ 113:	89 c3                	mov    %eax,%ebx
+  while(uptime() == start)
+ 115:	e8 5e 0a 00 00       	call   b78 <uptime>
+ 11a:	39 c3                	cmp    %eax,%ebx
+ 11c:	74 f7                	je     115 <main+0x115>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 11e:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 120:	89 95 7c ff ff ff    	mov    %edx,-0x84(%ebp)
+  for(n = 0; uptime() < start + 10; n++)
+ 126:	31 f6                	xor    %esi,%esi
+  return ((uint64)hi << 32) | lo;
+ 128:	89 85 78 ff ff ff    	mov    %eax,-0x88(%ebp)
+  start = uptime();
+ 12e:	e8 45 0a 00 00       	call   b78 <uptime>
+  for(n = 0; uptime() < start + 10; n++)
+ 133:	8d 58 09             	lea    0x9(%eax),%ebx
+ 136:	e8 3d 0a 00 00       	call   b78 <uptime>
+ 13b:	39 c3                	cmp    %eax,%ebx
+ 13d:	7c 2c                	jl     16b <main+0x16b>
+  volatile uint x = 0;
+ 13f:	31 c0                	xor    %eax,%eax
+ 141:	ba e8 03 00 00       	mov    $0x3e8,%edx
+ 146:	89 45 a8             	mov    %eax,-0x58(%ebp)
+  while(n-- > 0)
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    x = x * 1664525 + 1013904223;
+ 150:	8b 45 a8             	mov    -0x58(%ebp),%eax
+ 153:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+ 159:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+ 15e:	89 45 a8             	mov    %eax,-0x58(%ebp)
+  while(n-- > 0)
+ 161:	83 ea 01             	sub    $0x1,%edx
+ 164:	75 ea                	jne    150 <main+0x150>
+  for(n = 0; uptime() < start + 10; n++)
+ 166:	83 c6 01             	add    $0x1,%esi
+ 169:	eb cb                	jmp    136 <main+0x136>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 16b:	89 75 80             	mov    %esi,-0x80(%ebp)
+ 16e:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 170:	89 85 70 ff ff ff    	mov    %eax,-0x90(%ebp)
+  tsc_per_tick = div64(rdtsc() - t0, 10);
+ 176:	8b b5 70 ff ff ff    	mov    -0x90(%ebp),%esi
+  for(i = 63; i >= 0; i--)
+ 17c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  tsc_per_tick = div64(rdtsc() - t0, 10);
+ 181:	2b b5 78 ff ff ff    	sub    -0x88(%ebp),%esi
+  return ((uint64)hi << 32) | lo;
+ 187:	89 95 74 ff ff ff    	mov    %edx,-0x8c(%ebp)
+  tsc_per_tick = div64(rdtsc() - t0, 10);
+ 18d:	8b bd 74 ff ff ff    	mov    -0x8c(%ebp),%edi
+ 193:	1b bd 7c ff ff ff    	sbb    -0x84(%ebp),%edi
+  uint64 q = 0;
+ 199:	31 c0                	xor    %eax,%eax
+ 19b:	89 45 90             	mov    %eax,-0x70(%ebp)
+ 19e:	89 45 94             	mov    %eax,-0x6c(%ebp)
+ 1a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if((n >> i) >= d){
+ 1a8:	89 f0                	mov    %esi,%eax
+ 1aa:	89 fa                	mov    %edi,%edx
+ 1ac:	31 db                	xor    %ebx,%ebx
+ 1ae:	d3 ea                	shr    %cl,%edx
+ 1b0:	0f ad f8             	shrd   %cl,%edi,%eax
+ 1b3:	f6 c1 20             	test   $0x20,%cl
+ 1b6:	0f 45 c2             	cmovne %edx,%eax
+ 1b9:	0f 45 d3             	cmovne %ebx,%edx
+ 1bc:	bb 09 00 00 00       	mov    $0x9,%ebx
+ 1c1:	39 c3                	cmp    %eax,%ebx
+ 1c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 1c8:	19 d3                	sbb    %edx,%ebx
+ 1ca:	73 32                	jae    1fe <main+0x1fe>
+      n -= d << i;
+ 1cc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 1d1:	31 d2                	xor    %edx,%edx
+ 1d3:	31 db                	xor    %ebx,%ebx
+ 1d5:	0f a5 c2             	shld   %cl,%eax,%edx
+ 1d8:	d3 e0                	shl    %cl,%eax
+ 1da:	f6 c1 20             	test   $0x20,%cl
+ 1dd:	0f 45 d0             	cmovne %eax,%edx
+ 1e0:	0f 45 c3             	cmovne %ebx,%eax
+ 1e3:	29 c6                	sub    %eax,%esi
+ 1e5:	19 d7                	sbb    %edx,%edi
+      q |= (uint64)1 << i;
+ 1e7:	31 c0                	xor    %eax,%eax
+ 1e9:	31 d2                	xor    %edx,%edx
+ 1eb:	f6 c1 20             	test   $0x20,%cl
+ 1ee:	0f 94 c0             	sete   %al
+ 1f1:	0f 95 c2             	setne  %dl
+ 1f4:	d3 e2                	shl    %cl,%edx
+ 1f6:	d3 e0                	shl    %cl,%eax
+ 1f8:	09 55 94             	or     %edx,-0x6c(%ebp)
+ 1fb:	09 45 90             	or     %eax,-0x70(%ebp)
+  for(i = 63; i >= 0; i--)
+ 1fe:	83 e9 01             	sub    $0x1,%ecx
+ 201:	73 a5                	jae    1a8 <main+0x1a8>
+  tsc_per_tick = div64(rdtsc() - t0, 10);
+ 203:	8b 55 94             	mov    -0x6c(%ebp),%edx
+    usage();
+
+  calibrate();
+  printf(1, "config policy %d cpu %d io %d mixed %d work %d rounds %d sleep %d burst %d\n",
+ 206:	83 ec 0c             	sub    $0xc,%esp
+  spins_per_tick = n * 100;   // 1000 spins per pass, 10 ticks
+ 209:	6b 7d 80 64          	imul   $0x64,-0x80(%ebp),%edi
+  tsc_per_tick = div64(rdtsc() - t0, 10);
+ 20d:	8b 45 90             	mov    -0x70(%ebp),%eax
+  printf(1, "config policy %d cpu %d io %d mixed %d work %d rounds %d sleep %d burst %d\n",
+ 210:	8b 35 28 15 00 00    	mov    0x1528,%esi
+  tsc_per_tick = div64(rdtsc() - t0, 10);
+ 216:	89 15 44 15 00 00    	mov    %edx,0x1544
+  printf(1, "config policy %d cpu %d io %d mixed %d work %d rounds %d sleep %d burst %d\n",
+ 21c:	8b 15 20 15 00 00    	mov    0x1520,%edx
+  spins_per_tick = n * 100;   // 1000 spins per pass, 10 ticks
+ 222:	89 3d 48 15 00 00    	mov    %edi,0x1548
+  printf(1, "config policy %d cpu %d io %d mixed %d work %d rounds %d sleep %d burst %d\n",
+ 228:	8b 1d 2c 15 00 00    	mov    0x152c,%ebx
+ 22e:	89 55 90             	mov    %edx,-0x70(%ebp)
+ 231:	8b 3d 24 15 00 00    	mov    0x1524,%edi
+ 237:	6a ff                	push   $0xffffffff
+  tsc_per_tick = div64(rdtsc() - t0, 10);
+ 239:	a3 40 15 00 00       	mov    %eax,0x1540
+  printf(1, "config policy %d cpu %d io %d mixed %d work %d rounds %d sleep %d burst %d\n",
+ 23e:	e8 65 09 00 00       	call   ba8 <setpolicy>
+ 243:	5a                   	pop    %edx
+ 244:	8b 55 90             	mov    -0x70(%ebp),%edx
+ 247:	59                   	pop    %ecx
+ 248:	52                   	push   %edx
+ 249:	57                   	push   %edi
+ 24a:	56                   	push   %esi
+         setpolicy(-1), count[CPU], count[IO], count[MIXED], work, rounds,
+         sleepticks, burst);
+
+  // Stacks first: only this thread may call malloc().
+  for(k = 0; k < NKIND; k++)
+ 24b:	31 f6                	xor    %esi,%esi
+  printf(1, "config policy %d cpu %d io %d mixed %d work %d rounds %d sleep %d burst %d\n",
+ 24d:	53                   	push   %ebx
+ 24e:	ff 75 84             	push   -0x7c(%ebp)
+ 251:	ff 75 88             	push   -0x78(%ebp)
+ 254:	ff 75 8c             	push   -0x74(%ebp)
+ 257:	50                   	push   %eax
+ 258:	68 fc 0f 00 00       	push   $0xffc
+ 25d:	6a 01                	push   $0x1
+ 25f:	e8 2c 0a 00 00       	call   c90 <printf>
+ 264:	83 c4 30             	add    $0x30,%esp
+    for(i = 0; i < count[k]; i++){
+ 267:	31 db                	xor    %ebx,%ebx
+ 269:	eb 3e                	jmp    2a9 <main+0x2a9>
+      w = &workers[nworkers++];
+ 26b:	a1 50 15 00 00       	mov    0x1550,%eax
+      w->kind = k;
+      w->idx = i;
+      if((w->stack = malloc(PGSIZE)) == 0){
+ 270:	83 ec 0c             	sub    $0xc,%esp
+      w = &workers[nworkers++];
+ 273:	8d 50 01             	lea    0x1(%eax),%edx
+      w->kind = k;
+ 276:	6b c0 28             	imul   $0x28,%eax,%eax
+      w = &workers[nworkers++];
+ 279:	89 15 50 15 00 00    	mov    %edx,0x1550
+      w->kind = k;
+ 27f:	8d b8 60 15 00 00    	lea    0x1560(%eax),%edi
+ 285:	89 b0 60 15 00 00    	mov    %esi,0x1560(%eax)
+      w->idx = i;
+ 28b:	89 5f 04             	mov    %ebx,0x4(%edi)
+      if((w->stack = malloc(PGSIZE)) == 0){
+ 28e:	68 00 10 00 00       	push   $0x1000
+ 293:	e8 38 0c 00 00       	call   ed0 <malloc>
+ 298:	83 c4 10             	add    $0x10,%esp
+ 29b:	89 47 24             	mov    %eax,0x24(%edi)
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	0f 84 f7 01 00 00    	je     49d <main+0x49d>
+    for(i = 0; i < count[k]; i++){
+ 2a6:	83 c3 01             	add    $0x1,%ebx
+ 2a9:	39 5c b5 ac          	cmp    %ebx,-0x54(%ebp,%esi,4)
+ 2ad:	7f bc                	jg     26b <main+0x26b>
+  for(k = 0; k < NKIND; k++)
+ 2af:	83 c6 01             	add    $0x1,%esi
+ 2b2:	83 fe 03             	cmp    $0x3,%esi
+ 2b5:	75 b0                	jne    267 <main+0x267>
+        printf(2, "workload: out of memory\n");
+        exit();
+      }
+    }
+  if((pi = malloc((NPROC + 1) * sizeof(*pi))) == 0){
+ 2b7:	83 ec 0c             	sub    $0xc,%esp
+ 2ba:	68 74 48 01 00       	push   $0x14874
+ 2bf:	e8 0c 0c 00 00       	call   ed0 <malloc>
+ 2c4:	83 c4 10             	add    $0x10,%esp
+ 2c7:	89 45 84             	mov    %eax,-0x7c(%ebp)
+ 2ca:	85 c0                	test   %eax,%eax
+ 2cc:	0f 84 cb 01 00 00    	je     49d <main+0x49d>
+    printf(2, "workload: out of memory\n");
+    exit();
+  }
+
+  for(w = workers; w < workers + nworkers; w++){
+ 2d2:	bb 60 15 00 00       	mov    $0x1560,%ebx
+ 2d7:	eb 29                	jmp    302 <main+0x302>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 2d9:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 2db:	89 43 0c             	mov    %eax,0xc(%ebx)
+ 2de:	89 53 10             	mov    %edx,0x10(%ebx)
+    w->launch = rdtsc();
+    if((w->pid = clone(run, w, 0, w->stack)) < 0){
+ 2e1:	ff 73 24             	push   0x24(%ebx)
+ 2e4:	6a 00                	push   $0x0
+ 2e6:	53                   	push   %ebx
+ 2e7:	68 70 06 00 00       	push   $0x670
+ 2ec:	e8 df 08 00 00       	call   bd0 <clone>
+ 2f1:	83 c4 10             	add    $0x10,%esp
+ 2f4:	89 43 08             	mov    %eax,0x8(%ebx)
+ 2f7:	85 c0                	test   %eax,%eax
+ 2f9:	0f 88 1d 02 00 00    	js     51c <main+0x51c>
+  for(w = workers; w < workers + nworkers; w++){
+ 2ff:	83 c3 28             	add    $0x28,%ebx
+ 302:	6b 05 50 15 00 00 28 	imul   $0x28,0x1550,%eax
+ 309:	05 60 15 00 00       	add    $0x1560,%eax
+ 30e:	39 c3                	cmp    %eax,%ebx
+ 310:	72 c7                	jb     2d9 <main+0x2d9>
+ 312:	eb 10                	jmp    324 <main+0x324>
+    }
+  }
+
+  // Snapshot the statistics while finished workers are still zombies.
+  while((d = ndone) < nworkers)
+    futex_wait(&ndone, d);
+ 314:	52                   	push   %edx
+ 315:	52                   	push   %edx
+ 316:	50                   	push   %eax
+ 317:	68 4c 15 00 00       	push   $0x154c
+ 31c:	e8 bf 08 00 00       	call   be0 <futex_wait>
+ 321:	83 c4 10             	add    $0x10,%esp
+  while((d = ndone) < nworkers)
+ 324:	a1 4c 15 00 00       	mov    0x154c,%eax
+ 329:	3b 05 50 15 00 00    	cmp    0x1550,%eax
+ 32f:	72 e3                	jb     314 <main+0x314>
+  if((n = getpinfo(pi, NPROC + 1)) < 0){
+ 331:	50                   	push   %eax
+    printf(2, "workload: getpinfo failed\n");
+    exit();
+  }
+  for(i = 0; i < nworkers; i++){
+ 332:	31 db                	xor    %ebx,%ebx
+    if(join(&stack) < 0){
+ 334:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+  if((n = getpinfo(pi, NPROC + 1)) < 0){
+ 337:	50                   	push   %eax
+ 338:	68 e9 03 00 00       	push   $0x3e9
+ 33d:	ff 75 84             	push   -0x7c(%ebp)
+ 340:	e8 53 08 00 00       	call   b98 <getpinfo>
+ 345:	83 c4 10             	add    $0x10,%esp
+ 348:	89 45 80             	mov    %eax,-0x80(%ebp)
+ 34b:	85 c0                	test   %eax,%eax
+ 34d:	79 2a                	jns    379 <main+0x379>
+ 34f:	e9 38 02 00 00       	jmp    58c <main+0x58c>
+    if(join(&stack) < 0){
+ 354:	83 ec 0c             	sub    $0xc,%esp
+ 357:	56                   	push   %esi
+ 358:	e8 7b 08 00 00       	call   bd8 <join>
+ 35d:	83 c4 10             	add    $0x10,%esp
+ 360:	85 c0                	test   %eax,%eax
+ 362:	0f 88 11 02 00 00    	js     579 <main+0x579>
+      printf(2, "workload: join failed\n");
+      exit();
+    }
+    free(stack);
+ 368:	83 ec 0c             	sub    $0xc,%esp
+ 36b:	ff 75 a4             	push   -0x5c(%ebp)
+  for(i = 0; i < nworkers; i++){
+ 36e:	83 c3 01             	add    $0x1,%ebx
+    free(stack);
+ 371:	e8 ca 0a 00 00       	call   e40 <free>
+  for(i = 0; i < nworkers; i++){
+ 376:	83 c4 10             	add    $0x10,%esp
+ 379:	39 1d 50 15 00 00    	cmp    %ebx,0x1550
+ 37f:	7f d3                	jg     354 <main+0x354>
+  }
+
+  for(k = 0; k < NKIND; k++)
+    sum_resp[k] = sum_turn[k] = max_turn[k] = sum_share[k] = 0;
+ 381:	31 f6                	xor    %esi,%esi
+ 383:	bf 60 15 00 00       	mov    $0x1560,%edi
+ 388:	89 75 dc             	mov    %esi,-0x24(%ebp)
+ 38b:	89 75 d0             	mov    %esi,-0x30(%ebp)
+ 38e:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ 391:	89 75 b8             	mov    %esi,-0x48(%ebp)
+ 394:	89 75 e0             	mov    %esi,-0x20(%ebp)
+ 397:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 39a:	89 75 c8             	mov    %esi,-0x38(%ebp)
+ 39d:	89 75 bc             	mov    %esi,-0x44(%ebp)
+ 3a0:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+ 3a3:	89 75 d8             	mov    %esi,-0x28(%ebp)
+ 3a6:	89 75 cc             	mov    %esi,-0x34(%ebp)
+ 3a9:	89 75 c0             	mov    %esi,-0x40(%ebp)
+  for(w = workers; w < workers + nworkers; w++){
+ 3ac:	6b 05 50 15 00 00 28 	imul   $0x28,0x1550,%eax
+ 3b3:	05 60 15 00 00       	add    $0x1560,%eax
+ 3b8:	39 c7                	cmp    %eax,%edi
+ 3ba:	0f 83 6f 01 00 00    	jae    52f <main+0x52f>
+    cpu = 0;
+    if((p = findpid(pi, n, w->pid)) != 0)
+ 3c0:	8b 77 08             	mov    0x8(%edi),%esi
+  for(int i = 0; i < n; i++)
+ 3c3:	8b 5d 84             	mov    -0x7c(%ebp),%ebx
+ 3c6:	31 c0                	xor    %eax,%eax
+ 3c8:	8b 4d 80             	mov    -0x80(%ebp),%ecx
+ 3cb:	eb 10                	jmp    3dd <main+0x3dd>
+    if(pi[i].pid == pid)
+ 3cd:	8d 53 54             	lea    0x54(%ebx),%edx
+ 3d0:	3b 33                	cmp    (%ebx),%esi
+ 3d2:	0f 84 d8 00 00 00    	je     4b0 <main+0x4b0>
+  for(int i = 0; i < n; i++)
+ 3d8:	83 c0 01             	add    $0x1,%eax
+ 3db:	89 d3                	mov    %edx,%ebx
+ 3dd:	39 c1                	cmp    %eax,%ecx
+ 3df:	75 ec                	jne    3cd <main+0x3cd>
+      for(i = 0; i < NMLFQ; i++)
+        cpu += p->ticks[i];
+    turn = mticks(w->done - w->launch);
+ 3e1:	8b 47 0c             	mov    0xc(%edi),%eax
+ 3e4:	8b 4f 1c             	mov    0x1c(%edi),%ecx
+ 3e7:	8b 57 10             	mov    0x10(%edi),%edx
+ 3ea:	8b 5f 20             	mov    0x20(%edi),%ebx
+ 3ed:	29 c1                	sub    %eax,%ecx
+ 3ef:	89 85 78 ff ff ff    	mov    %eax,-0x88(%ebp)
+ 3f5:	19 d3                	sbb    %edx,%ebx
+ 3f7:	89 95 7c ff ff ff    	mov    %edx,-0x84(%ebp)
+ 3fd:	89 c8                	mov    %ecx,%eax
+ 3ff:	89 da                	mov    %ebx,%edx
+    share = turn > 0 ? cpu * 100000 / turn : 0;
+    printf(1, "worker %s %d %d %d %d %d %d %d %d\n",
+ 401:	31 db                	xor    %ebx,%ebx
+    turn = mticks(w->done - w->launch);
+ 403:	e8 98 01 00 00       	call   5a0 <mticks>
+    printf(1, "worker %s %d %d %d %d %d %d %d %d\n",
+ 408:	31 d2                	xor    %edx,%edx
+    cpu = 0;
+ 40a:	31 c9                	xor    %ecx,%ecx
+    turn = mticks(w->done - w->launch);
+ 40c:	89 45 8c             	mov    %eax,-0x74(%ebp)
+    share = turn > 0 ? cpu * 100000 / turn : 0;
+ 40f:	31 c0                	xor    %eax,%eax
+ 411:	89 45 90             	mov    %eax,-0x70(%ebp)
+    printf(1, "worker %s %d %d %d %d %d %d %d %d\n",
+ 414:	89 55 88             	mov    %edx,-0x78(%ebp)
+ 417:	8b 47 14             	mov    0x14(%edi),%eax
+ 41a:	8b 57 18             	mov    0x18(%edi),%edx
+ 41d:	89 8d 70 ff ff ff    	mov    %ecx,-0x90(%ebp)
+ 423:	2b 85 78 ff ff ff    	sub    -0x88(%ebp),%eax
+ 429:	1b 95 7c ff ff ff    	sbb    -0x84(%ebp),%edx
+ 42f:	e8 6c 01 00 00       	call   5a0 <mticks>
+ 434:	51                   	push   %ecx
+ 435:	ff 75 90             	push   -0x70(%ebp)
+ 438:	ff 75 88             	push   -0x78(%ebp)
+ 43b:	53                   	push   %ebx
+ 43c:	8b 8d 70 ff ff ff    	mov    -0x90(%ebp),%ecx
+ 442:	51                   	push   %ecx
+ 443:	8b 5d 8c             	mov    -0x74(%ebp),%ebx
+ 446:	53                   	push   %ebx
+ 447:	50                   	push   %eax
+ 448:	56                   	push   %esi
+ 449:	ff 77 04             	push   0x4(%edi)
+ 44c:	8b 07                	mov    (%edi),%eax
+ 44e:	ff 34 85 50 11 00 00 	push   0x1150(,%eax,4)
+ 455:	68 48 10 00 00       	push   $0x1048
+ 45a:	6a 01                	push   $0x1
+ 45c:	e8 2f 08 00 00       	call   c90 <printf>
+           kinds[w->kind], w->idx, w->pid, mticks(w->first - w->launch), turn,
+           cpu, p ? p->waitticks : 0, p ? p->nsched : 0, share);
+    sum_resp[w->kind] += mticks(w->first - w->launch);
+ 461:	8b 47 14             	mov    0x14(%edi),%eax
+ 464:	8b 57 18             	mov    0x18(%edi),%edx
+ 467:	83 c4 30             	add    $0x30,%esp
+ 46a:	2b 47 0c             	sub    0xc(%edi),%eax
+ 46d:	1b 57 10             	sbb    0x10(%edi),%edx
+ 470:	e8 2b 01 00 00       	call   5a0 <mticks>
+ 475:	89 c2                	mov    %eax,%edx
+ 477:	8b 07                	mov    (%edi),%eax
+ 479:	01 54 85 b8          	add    %edx,-0x48(%ebp,%eax,4)
+    sum_turn[w->kind] += turn;
+ 47d:	8b 54 85 d0          	mov    -0x30(%ebp,%eax,4),%edx
+ 481:	01 5c 85 c4          	add    %ebx,-0x3c(%ebp,%eax,4)
+    if(turn > max_turn[w->kind])
+ 485:	39 da                	cmp    %ebx,%edx
+ 487:	0f 4c d3             	cmovl  %ebx,%edx
+  for(w = workers; w < workers + nworkers; w++){
+ 48a:	83 c7 28             	add    $0x28,%edi
+ 48d:	89 54 85 d0          	mov    %edx,-0x30(%ebp,%eax,4)
+      max_turn[w->kind] = turn;
+    sum_share[w->kind] += share;
+ 491:	8b 55 90             	mov    -0x70(%ebp),%edx
+ 494:	01 54 85 dc          	add    %edx,-0x24(%ebp,%eax,4)
+  for(w = workers; w < workers + nworkers; w++){
+ 498:	e9 0f ff ff ff       	jmp    3ac <main+0x3ac>
+        printf(2, "workload: out of memory\n");
+ 49d:	53                   	push   %ebx
+ 49e:	53                   	push   %ebx
+ 49f:	68 6b 10 00 00       	push   $0x106b
+ 4a4:	6a 02                	push   $0x2
+ 4a6:	e8 e5 07 00 00       	call   c90 <printf>
+        exit();
+ 4ab:	e8 30 06 00 00       	call   ae0 <exit>
+    turn = mticks(w->done - w->launch);
+ 4b0:	8b 47 0c             	mov    0xc(%edi),%eax
+ 4b3:	8b 4f 1c             	mov    0x1c(%edi),%ecx
+ 4b6:	89 5d 88             	mov    %ebx,-0x78(%ebp)
+ 4b9:	8b 57 10             	mov    0x10(%edi),%edx
+ 4bc:	8b 5f 20             	mov    0x20(%edi),%ebx
+ 4bf:	29 c1                	sub    %eax,%ecx
+ 4c1:	89 85 78 ff ff ff    	mov    %eax,-0x88(%ebp)
+ 4c7:	19 d3                	sbb    %edx,%ebx
+ 4c9:	89 95 7c ff ff ff    	mov    %edx,-0x84(%ebp)
+ 4cf:	89 c8                	mov    %ecx,%eax
+ 4d1:	89 da                	mov    %ebx,%edx
+ 4d3:	e8 c8 00 00 00       	call   5a0 <mticks>
+      for(i = 0; i < NMLFQ; i++)
+ 4d8:	8b 5d 88             	mov    -0x78(%ebp),%ebx
+    cpu = 0;
+ 4db:	31 c9                	xor    %ecx,%ecx
+    turn = mticks(w->done - w->launch);
+ 4dd:	89 45 8c             	mov    %eax,-0x74(%ebp)
+      for(i = 0; i < NMLFQ; i++)
+ 4e0:	31 c0                	xor    %eax,%eax
+        cpu += p->ticks[i];
+ 4e2:	03 4c 83 24          	add    0x24(%ebx,%eax,4),%ecx
+      for(i = 0; i < NMLFQ; i++)
+ 4e6:	83 c0 01             	add    $0x1,%eax
+ 4e9:	83 f8 08             	cmp    $0x8,%eax
+ 4ec:	75 f4                	jne    4e2 <main+0x4e2>
+    share = turn > 0 ? cpu * 100000 / turn : 0;
+ 4ee:	8b 55 8c             	mov    -0x74(%ebp),%edx
+ 4f1:	89 5d 88             	mov    %ebx,-0x78(%ebp)
+ 4f4:	31 db                	xor    %ebx,%ebx
+ 4f6:	89 5d 90             	mov    %ebx,-0x70(%ebp)
+ 4f9:	85 d2                	test   %edx,%edx
+ 4fb:	7e 0e                	jle    50b <main+0x50b>
+ 4fd:	69 c1 a0 86 01 00    	imul   $0x186a0,%ecx,%eax
+ 503:	89 d3                	mov    %edx,%ebx
+ 505:	99                   	cltd
+ 506:	f7 fb                	idiv   %ebx
+ 508:	89 45 90             	mov    %eax,-0x70(%ebp)
+    printf(1, "worker %s %d %d %d %d %d %d %d %d\n",
+ 50b:	8b 55 88             	mov    -0x78(%ebp),%edx
+ 50e:	8b 42 44             	mov    0x44(%edx),%eax
+ 511:	8b 5a 48             	mov    0x48(%edx),%ebx
+ 514:	89 45 88             	mov    %eax,-0x78(%ebp)
+ 517:	e9 fb fe ff ff       	jmp    417 <main+0x417>
+      printf(2, "workload: clone failed\n");
+ 51c:	51                   	push   %ecx
+ 51d:	51                   	push   %ecx
+ 51e:	68 84 10 00 00       	push   $0x1084
+ 523:	6a 02                	push   $0x2
+ 525:	e8 66 07 00 00       	call   c90 <printf>
+      exit();
+ 52a:	e8 b1 05 00 00       	call   ae0 <exit>
+  }
+  for(k = 0; k < NKIND; k++)
+ 52f:	31 db                	xor    %ebx,%ebx
+    if(count[k] > 0)
+ 531:	8b 4c 9d ac          	mov    -0x54(%ebp,%ebx,4),%ecx
+ 535:	85 c9                	test   %ecx,%ecx
+ 537:	7e 33                	jle    56c <main+0x56c>
+      printf(1, "summary %s %d %d %d %d %d\n", kinds[k], count[k],
+ 539:	8b 44 9d dc          	mov    -0x24(%ebp,%ebx,4),%eax
+ 53d:	99                   	cltd
+ 53e:	f7 f9                	idiv   %ecx
+ 540:	50                   	push   %eax
+ 541:	ff 74 9d d0          	push   -0x30(%ebp,%ebx,4)
+ 545:	8b 44 9d c4          	mov    -0x3c(%ebp,%ebx,4),%eax
+ 549:	99                   	cltd
+ 54a:	f7 f9                	idiv   %ecx
+ 54c:	50                   	push   %eax
+ 54d:	8b 44 9d b8          	mov    -0x48(%ebp,%ebx,4),%eax
+ 551:	99                   	cltd
+ 552:	f7 f9                	idiv   %ecx
+ 554:	50                   	push   %eax
+ 555:	51                   	push   %ecx
+ 556:	ff 34 9d 50 11 00 00 	push   0x1150(,%ebx,4)
+ 55d:	68 ce 10 00 00       	push   $0x10ce
+ 562:	6a 01                	push   $0x1
+ 564:	e8 27 07 00 00       	call   c90 <printf>
+ 569:	83 c4 20             	add    $0x20,%esp
+  for(k = 0; k < NKIND; k++)
+ 56c:	83 c3 01             	add    $0x1,%ebx
+ 56f:	83 fb 03             	cmp    $0x3,%ebx
+ 572:	75 bd                	jne    531 <main+0x531>
+             sum_resp[k] / count[k], sum_turn[k] / count[k], max_turn[k],
+             sum_share[k] / count[k]);
+  exit();
+ 574:	e8 67 05 00 00       	call   ae0 <exit>
+      printf(2, "workload: join failed\n");
+ 579:	57                   	push   %edi
+ 57a:	57                   	push   %edi
+ 57b:	68 b7 10 00 00       	push   $0x10b7
+ 580:	6a 02                	push   $0x2
+ 582:	e8 09 07 00 00       	call   c90 <printf>
+      exit();
+ 587:	e8 54 05 00 00       	call   ae0 <exit>
+    printf(2, "workload: getpinfo failed\n");
+ 58c:	50                   	push   %eax
+ 58d:	50                   	push   %eax
+ 58e:	68 9c 10 00 00       	push   $0x109c
+ 593:	6a 02                	push   $0x2
+ 595:	e8 f6 06 00 00       	call   c90 <printf>
+    exit();
+ 59a:	e8 41 05 00 00       	call   ae0 <exit>
+ 59f:	90                   	nop
+
+000005a0 <mticks>:
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	57                   	push   %edi
+ 5a4:	56                   	push   %esi
+ 5a5:	89 c6                	mov    %eax,%esi
+  return div64(d * 1000, tsc_per_tick);
+ 5a7:	b8 e8 03 00 00       	mov    $0x3e8,%eax
+{
+ 5ac:	53                   	push   %ebx
+ 5ad:	83 ec 14             	sub    $0x14,%esp
+  return div64(d * 1000, tsc_per_tick);
+ 5b0:	8b 0d 40 15 00 00    	mov    0x1540,%ecx
+ 5b6:	8b 1d 44 15 00 00    	mov    0x1544,%ebx
+  uint64 q = 0;
+ 5bc:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 5c3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  return div64(d * 1000, tsc_per_tick);
+ 5ca:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+ 5cd:	69 ca e8 03 00 00    	imul   $0x3e8,%edx,%ecx
+ 5d3:	f7 e6                	mul    %esi
+ 5d5:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+ 5d8:	89 d7                	mov    %edx,%edi
+ 5da:	89 c6                	mov    %eax,%esi
+ 5dc:	01 cf                	add    %ecx,%edi
+  for(i = 63; i >= 0; i--)
+ 5de:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+ 5e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5e7:	90                   	nop
+    if((n >> i) >= d){
+ 5e8:	89 f0                	mov    %esi,%eax
+ 5ea:	89 fa                	mov    %edi,%edx
+ 5ec:	31 db                	xor    %ebx,%ebx
+ 5ee:	d3 ea                	shr    %cl,%edx
+ 5f0:	0f ad f8             	shrd   %cl,%edi,%eax
+ 5f3:	f6 c1 20             	test   $0x20,%cl
+ 5f6:	0f 45 c2             	cmovne %edx,%eax
+ 5f9:	0f 45 d3             	cmovne %ebx,%edx
+ 5fc:	8b 5d e8             	mov    -0x18(%ebp),%ebx
+ 5ff:	39 d8                	cmp    %ebx,%eax
+ 601:	89 d3                	mov    %edx,%ebx
+ 603:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 606:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 609:	19 d3                	sbb    %edx,%ebx
+ 60b:	72 2b                	jb     638 <mticks+0x98>
+      n -= d << i;
+ 60d:	0f a5 c2             	shld   %cl,%eax,%edx
+ 610:	31 db                	xor    %ebx,%ebx
+ 612:	d3 e0                	shl    %cl,%eax
+ 614:	f6 c1 20             	test   $0x20,%cl
+ 617:	0f 45 d0             	cmovne %eax,%edx
+ 61a:	0f 45 c3             	cmovne %ebx,%eax
+ 61d:	29 c6                	sub    %eax,%esi
+ 61f:	19 d7                	sbb    %edx,%edi
+      q |= (uint64)1 << i;
+ 621:	31 c0                	xor    %eax,%eax
+ 623:	31 d2                	xor    %edx,%edx
+ 625:	f6 c1 20             	test   $0x20,%cl
+ 628:	0f 94 c0             	sete   %al
+ 62b:	0f 95 c2             	setne  %dl
+ 62e:	d3 e2                	shl    %cl,%edx
+ 630:	d3 e0                	shl    %cl,%eax
+ 632:	09 55 e4             	or     %edx,-0x1c(%ebp)
+ 635:	09 45 e0             	or     %eax,-0x20(%ebp)
+  for(i = 63; i >= 0; i--)
+ 638:	83 e9 01             	sub    $0x1,%ecx
+ 63b:	73 ab                	jae    5e8 <mticks+0x48>
+  return div64(d * 1000, tsc_per_tick);
+ 63d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+ 640:	83 c4 14             	add    $0x14,%esp
+ 643:	5b                   	pop    %ebx
+ 644:	5e                   	pop    %esi
+ 645:	5f                   	pop    %edi
+ 646:	5d                   	pop    %ebp
+ 647:	c3                   	ret
+ 648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+
+00000650 <usage>:
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	83 ec 10             	sub    $0x10,%esp
+  printf(2, "Usage: workload [-c n] [-i n] [-m n] [-w t] [-r n] [-s t] [-b t]\n");
+ 656:	68 b8 0f 00 00       	push   $0xfb8
+ 65b:	6a 02                	push   $0x2
+ 65d:	e8 2e 06 00 00       	call   c90 <printf>
+  exit();
+ 662:	e8 79 04 00 00       	call   ae0 <exit>
+ 667:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66e:	66 90                	xchg   %ax,%ax
+
+00000670 <run>:
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	57                   	push   %edi
+ 674:	56                   	push   %esi
+ 675:	53                   	push   %ebx
+ 676:	83 ec 1c             	sub    $0x1c,%esp
+ 679:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 67c:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 67e:	89 43 14             	mov    %eax,0x14(%ebx)
+  switch(w->kind){
+ 681:	8b 03                	mov    (%ebx),%eax
+  return ((uint64)hi << 32) | lo;
+ 683:	89 53 18             	mov    %edx,0x18(%ebx)
+  switch(w->kind){
+ 686:	83 f8 01             	cmp    $0x1,%eax
+ 689:	74 35                	je     6c0 <run+0x50>
+ 68b:	83 f8 02             	cmp    $0x2,%eax
+ 68e:	0f 84 f6 00 00 00    	je     78a <run+0x11a>
+ 694:	85 c0                	test   %eax,%eax
+ 696:	0f 84 8a 00 00 00    	je     726 <run+0xb6>
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+ 69c:	0f 31                	rdtsc
+  return ((uint64)hi << 32) | lo;
+ 69e:	89 43 1c             	mov    %eax,0x1c(%ebx)
+ 6a1:	89 53 20             	mov    %edx,0x20(%ebx)
+  __sync_add_and_fetch(&ndone, 1);
+ 6a4:	f0 83 05 4c 15 00 00 	lock addl $0x1,0x154c
+ 6ab:	01 
+  futex_wake(&ndone, 1);
+ 6ac:	83 ec 08             	sub    $0x8,%esp
+ 6af:	6a 01                	push   $0x1
+ 6b1:	68 4c 15 00 00       	push   $0x154c
+ 6b6:	e8 2d 05 00 00       	call   be8 <futex_wake>
+  exit();
+ 6bb:	e8 20 04 00 00       	call   ae0 <exit>
+    for(i = 0; i < rounds; i++){
+ 6c0:	31 ff                	xor    %edi,%edi
+ 6c2:	83 3d 28 15 00 00 00 	cmpl   $0x0,0x1528
+      spin(spins_per_tick / IO_BURST);
+ 6c9:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+    for(i = 0; i < rounds; i++){
+ 6ce:	7e cc                	jle    69c <run+0x2c>
+      sleep(sleepticks);
+ 6d0:	83 ec 0c             	sub    $0xc,%esp
+ 6d3:	ff 35 24 15 00 00    	push   0x1524
+ 6d9:	e8 92 04 00 00       	call   b70 <sleep>
+      spin(spins_per_tick / IO_BURST);
+ 6de:	8b 0d 48 15 00 00    	mov    0x1548,%ecx
+  volatile uint x = 0;
+ 6e4:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  while(n-- > 0)
+ 6eb:	83 c4 10             	add    $0x10,%esp
+      spin(spins_per_tick / IO_BURST);
+ 6ee:	89 c8                	mov    %ecx,%eax
+ 6f0:	f7 e6                	mul    %esi
+ 6f2:	c1 ea 04             	shr    $0x4,%edx
+  while(n-- > 0)
+ 6f5:	83 ea 01             	sub    $0x1,%edx
+ 6f8:	83 f9 13             	cmp    $0x13,%ecx
+ 6fb:	76 19                	jbe    716 <run+0xa6>
+ 6fd:	8d 76 00             	lea    0x0(%esi),%esi
+    x = x * 1664525 + 1013904223;
+ 700:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 703:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+ 709:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+ 70e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  while(n-- > 0)
+ 711:	83 ea 01             	sub    $0x1,%edx
+ 714:	73 ea                	jae    700 <run+0x90>
+    for(i = 0; i < rounds; i++){
+ 716:	83 c7 01             	add    $0x1,%edi
+ 719:	39 3d 28 15 00 00    	cmp    %edi,0x1528
+ 71f:	7f af                	jg     6d0 <run+0x60>
+ 721:	e9 76 ff ff ff       	jmp    69c <run+0x2c>
+    compute(work);
+ 726:	a1 2c 15 00 00       	mov    0x152c,%eax
+  while(ticks-- > 0)
+ 72b:	8d 48 ff             	lea    -0x1(%eax),%ecx
+ 72e:	85 c0                	test   %eax,%eax
+ 730:	0f 8e 66 ff ff ff    	jle    69c <run+0x2c>
+    spin(spins_per_tick);
+ 736:	a1 48 15 00 00       	mov    0x1548,%eax
+  while(n-- > 0)
+ 73b:	8d 70 ff             	lea    -0x1(%eax),%esi
+  volatile uint x = 0;
+ 73e:	31 d2                	xor    %edx,%edx
+ 740:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  while(n-- > 0)
+ 743:	85 c0                	test   %eax,%eax
+ 745:	74 39                	je     780 <run+0x110>
+ 747:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74e:	66 90                	xchg   %ax,%ax
+ 750:	89 f2                	mov    %esi,%edx
+ 752:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    x = x * 1664525 + 1013904223;
+ 758:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 75b:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+ 761:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+ 766:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  while(n-- > 0)
+ 769:	83 ea 01             	sub    $0x1,%edx
+ 76c:	73 ea                	jae    758 <run+0xe8>
+  while(ticks-- > 0)
+ 76e:	83 e9 01             	sub    $0x1,%ecx
+ 771:	0f 82 25 ff ff ff    	jb     69c <run+0x2c>
+  volatile uint x = 0;
+ 777:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  while(n-- > 0)
+ 77e:	eb d0                	jmp    750 <run+0xe0>
+  while(ticks-- > 0)
+ 780:	83 e9 01             	sub    $0x1,%ecx
+ 783:	73 b9                	jae    73e <run+0xce>
+ 785:	e9 12 ff ff ff       	jmp    69c <run+0x2c>
+    for(i = 0; i < rounds; i++){
+ 78a:	31 f6                	xor    %esi,%esi
+ 78c:	83 3d 28 15 00 00 00 	cmpl   $0x0,0x1528
+ 793:	0f 8e 03 ff ff ff    	jle    69c <run+0x2c>
+ 799:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      compute(burst);
+ 7a0:	a1 20 15 00 00       	mov    0x1520,%eax
+  while(ticks-- > 0)
+ 7a5:	8d 48 ff             	lea    -0x1(%eax),%ecx
+ 7a8:	85 c0                	test   %eax,%eax
+ 7aa:	7e 4c                	jle    7f8 <run+0x188>
+    spin(spins_per_tick);
+ 7ac:	a1 48 15 00 00       	mov    0x1548,%eax
+  while(n-- > 0)
+ 7b1:	8d 78 ff             	lea    -0x1(%eax),%edi
+  volatile uint x = 0;
+ 7b4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  while(n-- > 0)
+ 7bb:	85 c0                	test   %eax,%eax
+ 7bd:	74 2d                	je     7ec <run+0x17c>
+ 7bf:	90                   	nop
+ 7c0:	89 fa                	mov    %edi,%edx
+ 7c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    x = x * 1664525 + 1013904223;
+ 7c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7cb:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+ 7d1:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+ 7d6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  while(n-- > 0)
+ 7d9:	83 ea 01             	sub    $0x1,%edx
+ 7dc:	73 ea                	jae    7c8 <run+0x158>
+  while(ticks-- > 0)
+ 7de:	83 e9 01             	sub    $0x1,%ecx
+ 7e1:	72 15                	jb     7f8 <run+0x188>
+  volatile uint x = 0;
+ 7e3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  while(n-- > 0)
+ 7ea:	eb d4                	jmp    7c0 <run+0x150>
+  while(ticks-- > 0)
+ 7ec:	83 e9 01             	sub    $0x1,%ecx
+ 7ef:	73 c3                	jae    7b4 <run+0x144>
+ 7f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      sleep(sleepticks);
+ 7f8:	83 ec 0c             	sub    $0xc,%esp
+ 7fb:	ff 35 24 15 00 00    	push   0x1524
+    for(i = 0; i < rounds; i++){
+ 801:	83 c6 01             	add    $0x1,%esi
+      sleep(sleepticks);
+ 804:	e8 67 03 00 00       	call   b70 <sleep>
+    for(i = 0; i < rounds; i++){
+ 809:	83 c4 10             	add    $0x10,%esp
+ 80c:	39 35 28 15 00 00    	cmp    %esi,0x1528
+ 812:	7f 8c                	jg     7a0 <run+0x130>
+ 814:	e9 83 fe ff ff       	jmp    69c <run+0x2c>
+ 819:	66 90                	xchg   %ax,%ax
+ 81b:	66 90                	xchg   %ax,%ax
+ 81d:	66 90                	xchg   %ax,%ax
+ 81f:	90                   	nop
+
+00000820 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 820:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 821:	31 c0                	xor    %eax,%eax
+{
+ 823:	89 e5                	mov    %esp,%ebp
+ 825:	53                   	push   %ebx
+ 826:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 829:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 82c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 830:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 834:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 837:	83 c0 01             	add    $0x1,%eax
+ 83a:	84 d2                	test   %dl,%dl
+ 83c:	75 f2                	jne    830 <strcpy+0x10>
+    ;
+  return os;
+}
+ 83e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 841:	89 c8                	mov    %ecx,%eax
+ 843:	c9                   	leave
+ 844:	c3                   	ret
+ 845:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000850 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 850:	55                   	push   %ebp
+ 851:	89 e5                	mov    %esp,%ebp
+ 853:	53                   	push   %ebx
+ 854:	8b 55 08             	mov    0x8(%ebp),%edx
+ 857:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 85a:	0f b6 02             	movzbl (%edx),%eax
+ 85d:	84 c0                	test   %al,%al
+ 85f:	75 17                	jne    878 <strcmp+0x28>
+ 861:	eb 3a                	jmp    89d <strcmp+0x4d>
+ 863:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 867:	90                   	nop
+ 868:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 86c:	83 c2 01             	add    $0x1,%edx
+ 86f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 872:	84 c0                	test   %al,%al
+ 874:	74 1a                	je     890 <strcmp+0x40>
+    p++, q++;
+ 876:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 878:	0f b6 19             	movzbl (%ecx),%ebx
+ 87b:	38 c3                	cmp    %al,%bl
+ 87d:	74 e9                	je     868 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 87f:	29 d8                	sub    %ebx,%eax
+}
+ 881:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 884:	c9                   	leave
+ 885:	c3                   	ret
+ 886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 890:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 894:	31 c0                	xor    %eax,%eax
+ 896:	29 d8                	sub    %ebx,%eax
+}
+ 898:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 89b:	c9                   	leave
+ 89c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 89d:	0f b6 19             	movzbl (%ecx),%ebx
+ 8a0:	31 c0                	xor    %eax,%eax
+ 8a2:	eb db                	jmp    87f <strcmp+0x2f>
+ 8a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+
+000008b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 8b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 8b9:	74 15                	je     8d0 <strlen+0x20>
+ 8bb:	31 c0                	xor    %eax,%eax
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 8c0:	83 c0 01             	add    $0x1,%eax
+ 8c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 8c7:	89 c1                	mov    %eax,%ecx
+ 8c9:	75 f5                	jne    8c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 8cb:	89 c8                	mov    %ecx,%eax
+ 8cd:	5d                   	pop    %ebp
+ 8ce:	c3                   	ret
+ 8cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 8d0:	31 c9                	xor    %ecx,%ecx
+}
+ 8d2:	5d                   	pop    %ebp
+ 8d3:	89 c8                	mov    %ecx,%eax
+ 8d5:	c3                   	ret
+ 8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 8e0:	55                   	push   %ebp
+ 8e1:	89 e5                	mov    %esp,%ebp
+ 8e3:	57                   	push   %edi
+ 8e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 8e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8ed:	89 d7                	mov    %edx,%edi
+ 8ef:	fc                   	cld
+ 8f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 8f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 8f5:	89 d0                	mov    %edx,%eax
+ 8f7:	c9                   	leave
+ 8f8:	c3                   	ret
+ 8f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000900 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	8b 45 08             	mov    0x8(%ebp),%eax
+ 906:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 90a:	0f b6 10             	movzbl (%eax),%edx
+ 90d:	84 d2                	test   %dl,%dl
+ 90f:	75 12                	jne    923 <strchr+0x23>
+ 911:	eb 1d                	jmp    930 <strchr+0x30>
+ 913:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 917:	90                   	nop
+ 918:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 91c:	83 c0 01             	add    $0x1,%eax
+ 91f:	84 d2                	test   %dl,%dl
+ 921:	74 0d                	je     930 <strchr+0x30>
+    if(*s == c)
+ 923:	38 d1                	cmp    %dl,%cl
+ 925:	75 f1                	jne    918 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 927:	5d                   	pop    %ebp
+ 928:	c3                   	ret
+ 929:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 930:	31 c0                	xor    %eax,%eax
+}
+ 932:	5d                   	pop    %ebp
+ 933:	c3                   	ret
+ 934:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 93f:	90                   	nop
+
+00000940 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 940:	55                   	push   %ebp
+ 941:	89 e5                	mov    %esp,%ebp
+ 943:	57                   	push   %edi
+ 944:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 945:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 948:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 949:	31 db                	xor    %ebx,%ebx
+{
+ 94b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 94e:	eb 27                	jmp    977 <gets+0x37>
+    cc = read(0, &c, 1);
+ 950:	83 ec 04             	sub    $0x4,%esp
+ 953:	6a 01                	push   $0x1
+ 955:	56                   	push   %esi
+ 956:	6a 00                	push   $0x0
+ 958:	e8 9b 01 00 00       	call   af8 <read>
+    if(cc < 1)
+ 95d:	83 c4 10             	add    $0x10,%esp
+ 960:	85 c0                	test   %eax,%eax
+ 962:	7e 1d                	jle    981 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 964:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 968:	8b 55 08             	mov    0x8(%ebp),%edx
+ 96b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 96f:	3c 0a                	cmp    $0xa,%al
+ 971:	74 10                	je     983 <gets+0x43>
+ 973:	3c 0d                	cmp    $0xd,%al
+ 975:	74 0c                	je     983 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 977:	89 df                	mov    %ebx,%edi
+ 979:	83 c3 01             	add    $0x1,%ebx
+ 97c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 97f:	7c cf                	jl     950 <gets+0x10>
+ 981:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 983:	8b 45 08             	mov    0x8(%ebp),%eax
+ 986:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 98a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 98d:	5b                   	pop    %ebx
+ 98e:	5e                   	pop    %esi
+ 98f:	5f                   	pop    %edi
+ 990:	5d                   	pop    %ebp
+ 991:	c3                   	ret
+ 992:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 999:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	56                   	push   %esi
+ 9a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 9a5:	83 ec 08             	sub    $0x8,%esp
+ 9a8:	6a 00                	push   $0x0
+ 9aa:	ff 75 08             	push   0x8(%ebp)
+ 9ad:	e8 6e 01 00 00       	call   b20 <open>
+  if(fd < 0)
+ 9b2:	83 c4 10             	add    $0x10,%esp
+ 9b5:	85 c0                	test   %eax,%eax
+ 9b7:	78 27                	js     9e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 9b9:	83 ec 08             	sub    $0x8,%esp
+ 9bc:	ff 75 0c             	push   0xc(%ebp)
+ 9bf:	89 c3                	mov    %eax,%ebx
+ 9c1:	50                   	push   %eax
+ 9c2:	e8 71 01 00 00       	call   b38 <fstat>
+  close(fd);
+ 9c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 9ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 9cc:	e8 37 01 00 00       	call   b08 <close>
+  return r;
+ 9d1:	83 c4 10             	add    $0x10,%esp
+}
+ 9d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 9d7:	89 f0                	mov    %esi,%eax
+ 9d9:	5b                   	pop    %ebx
+ 9da:	5e                   	pop    %esi
+ 9db:	5d                   	pop    %ebp
+ 9dc:	c3                   	ret
+ 9dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 9e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 9e5:	eb ed                	jmp    9d4 <stat+0x34>
+ 9e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9ee:	66 90                	xchg   %ax,%ax
+
+000009f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	53                   	push   %ebx
+ 9f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 9f7:	0f be 02             	movsbl (%edx),%eax
+ 9fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 9fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ a00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ a05:	77 1e                	ja     a25 <atoi+0x35>
+ a07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ a10:	83 c2 01             	add    $0x1,%edx
+ a13:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ a16:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ a1a:	0f be 02             	movsbl (%edx),%eax
+ a1d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ a20:	80 fb 09             	cmp    $0x9,%bl
+ a23:	76 eb                	jbe    a10 <atoi+0x20>
+  return n;
+}
+ a25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ a28:	89 c8                	mov    %ecx,%eax
+ a2a:	c9                   	leave
+ a2b:	c3                   	ret
+ a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a30 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	57                   	push   %edi
+ a34:	56                   	push   %esi
+ a35:	8b 45 10             	mov    0x10(%ebp),%eax
+ a38:	8b 55 08             	mov    0x8(%ebp),%edx
+ a3b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ a3e:	85 c0                	test   %eax,%eax
+ a40:	7e 13                	jle    a55 <memmove+0x25>
+ a42:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ a44:	89 d7                	mov    %edx,%edi
+ a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ a50:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ a51:	39 f8                	cmp    %edi,%eax
+ a53:	75 fb                	jne    a50 <memmove+0x20>
+  return vdst;
+}
+ a55:	5e                   	pop    %esi
+ a56:	89 d0                	mov    %edx,%eax
+ a58:	5f                   	pop    %edi
+ a59:	5d                   	pop    %ebp
+ a5a:	c3                   	ret
+ a5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a5f:	90                   	nop
+
+00000a60 <mutex_lock>:
+
+// Take and release m with atomic instructions, and enter the kernel
+// only to block while it is held or to wake a blocked thread.
+void
+mutex_lock(struct mutex *m)
+{
+ a60:	55                   	push   %ebp
+  uint s;
+
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ a61:	31 c0                	xor    %eax,%eax
+ a63:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ a68:	89 e5                	mov    %esp,%ebp
+ a6a:	56                   	push   %esi
+ a6b:	53                   	push   %ebx
+ a6c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ a6f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ a73:	85 c0                	test   %eax,%eax
+ a75:	74 30                	je     aa7 <mutex_lock+0x47>
+    return;
+  // Contended: mark it so the holder knows to wake us.
+  if(s != 2)
+ a77:	83 f8 02             	cmp    $0x2,%eax
+ a7a:	74 0c                	je     a88 <mutex_lock+0x28>
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ a7c:	b8 02 00 00 00       	mov    $0x2,%eax
+ a81:	f0 87 03             	lock xchg %eax,(%ebx)
+    s = xchg(&m->state, 2);
+  while(s != 0){
+ a84:	85 c0                	test   %eax,%eax
+ a86:	74 1f                	je     aa7 <mutex_lock+0x47>
+ a88:	be 02 00 00 00       	mov    $0x2,%esi
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+ a90:	83 ec 08             	sub    $0x8,%esp
+ a93:	6a 02                	push   $0x2
+ a95:	53                   	push   %ebx
+ a96:	e8 45 01 00 00       	call   be0 <futex_wait>
+ a9b:	89 f0                	mov    %esi,%eax
+ a9d:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(s != 0){
+ aa0:	83 c4 10             	add    $0x10,%esp
+ aa3:	85 c0                	test   %eax,%eax
+ aa5:	75 e9                	jne    a90 <mutex_lock+0x30>
+    s = xchg(&m->state, 2);
+  }
+}
+ aa7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ aaa:	5b                   	pop    %ebx
+ aab:	5e                   	pop    %esi
+ aac:	5d                   	pop    %ebp
+ aad:	c3                   	ret
+ aae:	66 90                	xchg   %ax,%ax
+
+00000ab0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ ab0:	55                   	push   %ebp
+ ab1:	31 c0                	xor    %eax,%eax
+ ab3:	89 e5                	mov    %esp,%ebp
+ ab5:	83 ec 08             	sub    $0x8,%esp
+ ab8:	8b 55 08             	mov    0x8(%ebp),%edx
+ abb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ abe:	83 f8 02             	cmp    $0x2,%eax
+ ac1:	74 05                	je     ac8 <mutex_unlock+0x18>
+    futex_wake(&m->state, 1);
+}
+ ac3:	c9                   	leave
+ ac4:	c3                   	ret
+ ac5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->state, 1);
+ ac8:	83 ec 08             	sub    $0x8,%esp
+ acb:	6a 01                	push   $0x1
+ acd:	52                   	push   %edx
+ ace:	e8 15 01 00 00       	call   be8 <futex_wake>
+ ad3:	83 c4 10             	add    $0x10,%esp
+}
+ ad6:	c9                   	leave
+ ad7:	c3                   	ret
+
+00000ad8 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ ad8:	b8 01 00 00 00       	mov    $0x1,%eax
+ add:	cd 40                	int    $0x40
+ adf:	c3                   	ret
+
+00000ae0 <exit>:
+SYSCALL(exit)
+ ae0:	b8 02 00 00 00       	mov    $0x2,%eax
+ ae5:	cd 40                	int    $0x40
+ ae7:	c3                   	ret
+
+00000ae8 <wait>:
+SYSCALL(wait)
+ ae8:	b8 03 00 00 00       	mov    $0x3,%eax
+ aed:	cd 40                	int    $0x40
+ aef:	c3                   	ret
+
+00000af0 <pipe>:
+SYSCALL(pipe)
+ af0:	b8 04 00 00 00       	mov    $0x4,%eax
+ af5:	cd 40                	int    $0x40
+ af7:	c3                   	ret
+
+00000af8 <read>:
+SYSCALL(read)
+ af8:	b8 05 00 00 00       	mov    $0x5,%eax
+ afd:	cd 40                	int    $0x40
+ aff:	c3                   	ret
+
+00000b00 <write>:
+SYSCALL(write)
+ b00:	b8 10 00 00 00       	mov    $0x10,%eax
+ b05:	cd 40                	int    $0x40
+ b07:	c3                   	ret
+
+00000b08 <close>:
+SYSCALL(close)
+ b08:	b8 15 00 00 00       	mov    $0x15,%eax
+ b0d:	cd 40                	int    $0x40
+ b0f:	c3                   	ret
+
+00000b10 <kill>:
+SYSCALL(kill)
+ b10:	b8 06 00 00 00       	mov    $0x6,%eax
+ b15:	cd 40                	int    $0x40
+ b17:	c3                   	ret
+
+00000b18 <exec>:
+SYSCALL(exec)
+ b18:	b8 07 00 00 00       	mov    $0x7,%eax
+ b1d:	cd 40                	int    $0x40
+ b1f:	c3                   	ret
+
+00000b20 <open>:
+SYSCALL(open)
+ b20:	b8 0f 00 00 00       	mov    $0xf,%eax
+ b25:	cd 40                	int    $0x40
+ b27:	c3                   	ret
+
+00000b28 <mknod>:
+SYSCALL(mknod)
+ b28:	b8 11 00 00 00       	mov    $0x11,%eax
+ b2d:	cd 40                	int    $0x40
+ b2f:	c3                   	ret
+
+00000b30 <unlink>:
+SYSCALL(unlink)
+ b30:	b8 12 00 00 00       	mov    $0x12,%eax
+ b35:	cd 40                	int    $0x40
+ b37:	c3                   	ret
+
+00000b38 <fstat>:
+SYSCALL(fstat)
+ b38:	b8 08 00 00 00       	mov    $0x8,%eax
+ b3d:	cd 40                	int    $0x40
+ b3f:	c3                   	ret
+
+00000b40 <link>:
+SYSCALL(link)
+ b40:	b8 13 00 00 00       	mov    $0x13,%eax
+ b45:	cd 40                	int    $0x40
+ b47:	c3                   	ret
+
+00000b48 <mkdir>:
+SYSCALL(mkdir)
+ b48:	b8 14 00 00 00       	mov    $0x14,%eax
+ b4d:	cd 40                	int    $0x40
+ b4f:	c3                   	ret
+
+00000b50 <chdir>:
+SYSCALL(chdir)
+ b50:	b8 09 00 00 00       	mov    $0x9,%eax
+ b55:	cd 40                	int    $0x40
+ b57:	c3                   	ret
+
+00000b58 <dup>:
+SYSCALL(dup)
+ b58:	b8 0a 00 00 00       	mov    $0xa,%eax
+ b5d:	cd 40                	int    $0x40
+ b5f:	c3                   	ret
+
+00000b60 <getpid>:
+SYSCALL(getpid)
+ b60:	b8 0b 00 00 00       	mov    $0xb,%eax
+ b65:	cd 40                	int    $0x40
+ b67:	c3                   	ret
+
+00000b68 <sbrk>:
+SYSCALL(sbrk)
+ b68:	b8 0c 00 00 00       	mov    $0xc,%eax
+ b6d:	cd 40                	int    $0x40
+ b6f:	c3                   	ret
+
+00000b70 <sleep>:
+SYSCALL(sleep)
+ b70:	b8 0d 00 00 00       	mov    $0xd,%eax
+ b75:	cd 40                	int    $0x40
+ b77:	c3                   	ret
+
+00000b78 <uptime>:
+SYSCALL(uptime)
+ b78:	b8 0e 00 00 00       	mov    $0xe,%eax
+ b7d:	cd 40                	int    $0x40
+ b7f:	c3                   	ret
+
+00000b80 <ps>:
+SYSCALL(ps)
+ b80:	b8 16 00 00 00       	mov    $0x16,%eax
+ b85:	cd 40                	int    $0x40
+ b87:	c3                   	ret
+
+00000b88 <getschedparams>:
+SYSCALL(getschedparams)
+ b88:	b8 17 00 00 00       	mov    $0x17,%eax
+ b8d:	cd 40                	int    $0x40
+ b8f:	c3                   	ret
+
+00000b90 <setschedparams>:
+SYSCALL(setschedparams)
+ b90:	b8 18 00 00 00       	mov    $0x18,%eax
+ b95:	cd 40                	int    $0x40
+ b97:	c3                   	ret
+
+00000b98 <getpinfo>:
+SYSCALL(getpinfo)
+ b98:	b8 19 00 00 00       	mov    $0x19,%eax
+ b9d:	cd 40                	int    $0x40
+ b9f:	c3                   	ret
+
+00000ba0 <getlathist>:
+SYSCALL(getlathist)
+ ba0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ ba5:	cd 40                	int    $0x40
+ ba7:	c3                   	ret
+
+00000ba8 <setpolicy>:
+SYSCALL(setpolicy)
+ ba8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ bad:	cd 40                	int    $0x40
+ baf:	c3                   	ret
+
+00000bb0 <settickets>:
+SYSCALL(settickets)
+ bb0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ bb5:	cd 40                	int    $0x40
+ bb7:	c3                   	ret
+
+00000bb8 <setaffinity>:
+SYSCALL(setaffinity)
+ bb8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ bbd:	cd 40                	int    $0x40
+ bbf:	c3                   	ret
+
+00000bc0 <getaffinity>:
+SYSCALL(getaffinity)
+ bc0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ bc5:	cd 40                	int    $0x40
+ bc7:	c3                   	ret
+
+00000bc8 <setrt>:
+SYSCALL(setrt)
+ bc8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ bcd:	cd 40                	int    $0x40
+ bcf:	c3                   	ret
+
+00000bd0 <clone>:
+SYSCALL(clone)
+ bd0:	b8 20 00 00 00       	mov    $0x20,%eax
+ bd5:	cd 40                	int    $0x40
+ bd7:	c3                   	ret
+
+00000bd8 <join>:
+SYSCALL(join)
+ bd8:	b8 21 00 00 00       	mov    $0x21,%eax
+ bdd:	cd 40                	int    $0x40
+ bdf:	c3                   	ret
+
+00000be0 <futex_wait>:
+SYSCALL(futex_wait)
+ be0:	b8 22 00 00 00       	mov    $0x22,%eax
+ be5:	cd 40                	int    $0x40
+ be7:	c3                   	ret
+
+00000be8 <futex_wake>:
+SYSCALL(futex_wake)
+ be8:	b8 23 00 00 00       	mov    $0x23,%eax
+ bed:	cd 40                	int    $0x40
+ bef:	c3                   	ret
+
+00000bf0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ bf0:	55                   	push   %ebp
+ bf1:	89 e5                	mov    %esp,%ebp
+ bf3:	57                   	push   %edi
+ bf4:	56                   	push   %esi
+ bf5:	53                   	push   %ebx
+ bf6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ bf8:	89 d1                	mov    %edx,%ecx
+{
+ bfa:	83 ec 3c             	sub    $0x3c,%esp
+ bfd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ c00:	85 d2                	test   %edx,%edx
+ c02:	0f 89 80 00 00 00    	jns    c88 <printint+0x98>
+ c08:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ c0c:	74 7a                	je     c88 <printint+0x98>
+    x = -xx;
+ c0e:	f7 d9                	neg    %ecx
+    neg = 1;
+ c10:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ c15:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ c18:	31 f6                	xor    %esi,%esi
+ c1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ c20:	89 c8                	mov    %ecx,%eax
+ c22:	31 d2                	xor    %edx,%edx
+ c24:	89 f7                	mov    %esi,%edi
+ c26:	f7 f3                	div    %ebx
+ c28:	8d 76 01             	lea    0x1(%esi),%esi
+ c2b:	0f b6 92 bc 11 00 00 	movzbl 0x11bc(%edx),%edx
+ c32:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ c36:	89 ca                	mov    %ecx,%edx
+ c38:	89 c1                	mov    %eax,%ecx
+ c3a:	39 da                	cmp    %ebx,%edx
+ c3c:	73 e2                	jae    c20 <printint+0x30>
+  if(neg)
+ c3e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ c41:	85 c0                	test   %eax,%eax
+ c43:	74 07                	je     c4c <printint+0x5c>
+    buf[i++] = '-';
+ c45:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ c4a:	89 f7                	mov    %esi,%edi
+ c4c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ c4f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ c52:	01 df                	add    %ebx,%edi
+ c54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ c58:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ c5b:	83 ec 04             	sub    $0x4,%esp
+ c5e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ c61:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ c64:	6a 01                	push   $0x1
+ c66:	50                   	push   %eax
+ c67:	56                   	push   %esi
+ c68:	e8 93 fe ff ff       	call   b00 <write>
+  while(--i >= 0)
+ c6d:	89 f8                	mov    %edi,%eax
+ c6f:	83 c4 10             	add    $0x10,%esp
+ c72:	83 ef 01             	sub    $0x1,%edi
+ c75:	39 d8                	cmp    %ebx,%eax
+ c77:	75 df                	jne    c58 <printint+0x68>
+}
+ c79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c7c:	5b                   	pop    %ebx
+ c7d:	5e                   	pop    %esi
+ c7e:	5f                   	pop    %edi
+ c7f:	5d                   	pop    %ebp
+ c80:	c3                   	ret
+ c81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ c88:	31 c0                	xor    %eax,%eax
+ c8a:	eb 89                	jmp    c15 <printint+0x25>
+ c8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c90 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ c90:	55                   	push   %ebp
+ c91:	89 e5                	mov    %esp,%ebp
+ c93:	57                   	push   %edi
+ c94:	56                   	push   %esi
+ c95:	53                   	push   %ebx
+ c96:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ c99:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ c9c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ c9f:	0f b6 1e             	movzbl (%esi),%ebx
+ ca2:	83 c6 01             	add    $0x1,%esi
+ ca5:	84 db                	test   %bl,%bl
+ ca7:	74 67                	je     d10 <printf+0x80>
+ ca9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ cac:	31 d2                	xor    %edx,%edx
+ cae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ cb1:	eb 34                	jmp    ce7 <printf+0x57>
+ cb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ cb7:	90                   	nop
+ cb8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ cbb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ cc0:	83 f8 25             	cmp    $0x25,%eax
+ cc3:	74 18                	je     cdd <printf+0x4d>
+  write(fd, &c, 1);
+ cc5:	83 ec 04             	sub    $0x4,%esp
+ cc8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ ccb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ cce:	6a 01                	push   $0x1
+ cd0:	50                   	push   %eax
+ cd1:	57                   	push   %edi
+ cd2:	e8 29 fe ff ff       	call   b00 <write>
+ cd7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ cda:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ cdd:	0f b6 1e             	movzbl (%esi),%ebx
+ ce0:	83 c6 01             	add    $0x1,%esi
+ ce3:	84 db                	test   %bl,%bl
+ ce5:	74 29                	je     d10 <printf+0x80>
+    c = fmt[i] & 0xff;
+ ce7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ cea:	85 d2                	test   %edx,%edx
+ cec:	74 ca                	je     cb8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ cee:	83 fa 25             	cmp    $0x25,%edx
+ cf1:	75 ea                	jne    cdd <printf+0x4d>
+      if(c == 'd'){
+ cf3:	83 f8 25             	cmp    $0x25,%eax
+ cf6:	0f 84 24 01 00 00    	je     e20 <printf+0x190>
+ cfc:	83 e8 63             	sub    $0x63,%eax
+ cff:	83 f8 15             	cmp    $0x15,%eax
+ d02:	77 1c                	ja     d20 <printf+0x90>
+ d04:	ff 24 85 64 11 00 00 	jmp    *0x1164(,%eax,4)
+ d0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d0f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ d10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d13:	5b                   	pop    %ebx
+ d14:	5e                   	pop    %esi
+ d15:	5f                   	pop    %edi
+ d16:	5d                   	pop    %ebp
+ d17:	c3                   	ret
+ d18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d1f:	90                   	nop
+  write(fd, &c, 1);
+ d20:	83 ec 04             	sub    $0x4,%esp
+ d23:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ d26:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ d2a:	6a 01                	push   $0x1
+ d2c:	52                   	push   %edx
+ d2d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ d30:	57                   	push   %edi
+ d31:	e8 ca fd ff ff       	call   b00 <write>
+ d36:	83 c4 0c             	add    $0xc,%esp
+ d39:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ d3c:	6a 01                	push   $0x1
+ d3e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ d41:	52                   	push   %edx
+ d42:	57                   	push   %edi
+ d43:	e8 b8 fd ff ff       	call   b00 <write>
+        putc(fd, c);
+ d48:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ d4b:	31 d2                	xor    %edx,%edx
+ d4d:	eb 8e                	jmp    cdd <printf+0x4d>
+ d4f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ d50:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ d53:	83 ec 0c             	sub    $0xc,%esp
+ d56:	b9 10 00 00 00       	mov    $0x10,%ecx
+ d5b:	8b 13                	mov    (%ebx),%edx
+ d5d:	6a 00                	push   $0x0
+ d5f:	89 f8                	mov    %edi,%eax
+        ap++;
+ d61:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ d64:	e8 87 fe ff ff       	call   bf0 <printint>
+        ap++;
+ d69:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ d6c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ d6f:	31 d2                	xor    %edx,%edx
+ d71:	e9 67 ff ff ff       	jmp    cdd <printf+0x4d>
+ d76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d7d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ d80:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ d83:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ d85:	83 c0 04             	add    $0x4,%eax
+ d88:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ d8b:	85 db                	test   %ebx,%ebx
+ d8d:	0f 84 9d 00 00 00    	je     e30 <printf+0x1a0>
+        while(*s != 0){
+ d93:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ d96:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ d98:	84 c0                	test   %al,%al
+ d9a:	0f 84 3d ff ff ff    	je     cdd <printf+0x4d>
+ da0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ da3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ da6:	89 de                	mov    %ebx,%esi
+ da8:	89 d3                	mov    %edx,%ebx
+ daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ db0:	83 ec 04             	sub    $0x4,%esp
+ db3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ db6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ db9:	6a 01                	push   $0x1
+ dbb:	53                   	push   %ebx
+ dbc:	57                   	push   %edi
+ dbd:	e8 3e fd ff ff       	call   b00 <write>
+        while(*s != 0){
+ dc2:	0f b6 06             	movzbl (%esi),%eax
+ dc5:	83 c4 10             	add    $0x10,%esp
+ dc8:	84 c0                	test   %al,%al
+ dca:	75 e4                	jne    db0 <printf+0x120>
+      state = 0;
+ dcc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ dcf:	31 d2                	xor    %edx,%edx
+ dd1:	e9 07 ff ff ff       	jmp    cdd <printf+0x4d>
+ dd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ddd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ de0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ de3:	83 ec 0c             	sub    $0xc,%esp
+ de6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ deb:	8b 13                	mov    (%ebx),%edx
+ ded:	6a 01                	push   $0x1
+ def:	e9 6b ff ff ff       	jmp    d5f <printf+0xcf>
+ df4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ df8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ dfb:	83 ec 04             	sub    $0x4,%esp
+ dfe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ e01:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ e03:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ e06:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ e09:	6a 01                	push   $0x1
+ e0b:	52                   	push   %edx
+ e0c:	57                   	push   %edi
+ e0d:	e8 ee fc ff ff       	call   b00 <write>
+        ap++;
+ e12:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ e15:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ e18:	31 d2                	xor    %edx,%edx
+ e1a:	e9 be fe ff ff       	jmp    cdd <printf+0x4d>
+ e1f:	90                   	nop
+  write(fd, &c, 1);
+ e20:	83 ec 04             	sub    $0x4,%esp
+ e23:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ e26:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ e29:	6a 01                	push   $0x1
+ e2b:	e9 11 ff ff ff       	jmp    d41 <printf+0xb1>
+ e30:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ e35:	bb 5c 11 00 00       	mov    $0x115c,%ebx
+ e3a:	e9 61 ff ff ff       	jmp    da0 <printf+0x110>
+ e3f:	90                   	nop
+
+00000e40 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ e40:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ e41:	a1 60 1a 00 00       	mov    0x1a60,%eax
+{
+ e46:	89 e5                	mov    %esp,%ebp
+ e48:	57                   	push   %edi
+ e49:	56                   	push   %esi
+ e4a:	53                   	push   %ebx
+ e4b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ e4e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ e51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e58:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e5a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ e5c:	39 ca                	cmp    %ecx,%edx
+ e5e:	73 30                	jae    e90 <free+0x50>
+ e60:	39 c1                	cmp    %eax,%ecx
+ e62:	72 04                	jb     e68 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e64:	39 c2                	cmp    %eax,%edx
+ e66:	72 f0                	jb     e58 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ e68:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ e6b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ e6e:	39 f8                	cmp    %edi,%eax
+ e70:	74 2e                	je     ea0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ e72:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ e75:	8b 42 04             	mov    0x4(%edx),%eax
+ e78:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ e7b:	39 f1                	cmp    %esi,%ecx
+ e7d:	74 38                	je     eb7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ e7f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ e81:	5b                   	pop    %ebx
+  freep = p;
+ e82:	89 15 60 1a 00 00    	mov    %edx,0x1a60
+}
+ e88:	5e                   	pop    %esi
+ e89:	5f                   	pop    %edi
+ e8a:	5d                   	pop    %ebp
+ e8b:	c3                   	ret
+ e8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e90:	39 c1                	cmp    %eax,%ecx
+ e92:	72 d0                	jb     e64 <free+0x24>
+ e94:	eb c2                	jmp    e58 <free+0x18>
+ e96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e9d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ea0:	03 70 04             	add    0x4(%eax),%esi
+ ea3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ea6:	8b 02                	mov    (%edx),%eax
+ ea8:	8b 00                	mov    (%eax),%eax
+ eaa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ ead:	8b 42 04             	mov    0x4(%edx),%eax
+ eb0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ eb3:	39 f1                	cmp    %esi,%ecx
+ eb5:	75 c8                	jne    e7f <free+0x3f>
+    p->s.size += bp->s.size;
+ eb7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ eba:	89 15 60 1a 00 00    	mov    %edx,0x1a60
+    p->s.size += bp->s.size;
+ ec0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ec3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ec6:	89 0a                	mov    %ecx,(%edx)
+}
+ ec8:	5b                   	pop    %ebx
+ ec9:	5e                   	pop    %esi
+ eca:	5f                   	pop    %edi
+ ecb:	5d                   	pop    %ebp
+ ecc:	c3                   	ret
+ ecd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ed0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ ed0:	55                   	push   %ebp
+ ed1:	89 e5                	mov    %esp,%ebp
+ ed3:	57                   	push   %edi
+ ed4:	56                   	push   %esi
+ ed5:	53                   	push   %ebx
+ ed6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ed9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ edc:	8b 15 60 1a 00 00    	mov    0x1a60,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ee2:	8d 78 07             	lea    0x7(%eax),%edi
+ ee5:	c1 ef 03             	shr    $0x3,%edi
+ ee8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ eeb:	85 d2                	test   %edx,%edx
+ eed:	0f 84 8d 00 00 00    	je     f80 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ef3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ef5:	8b 48 04             	mov    0x4(%eax),%ecx
+ ef8:	39 f9                	cmp    %edi,%ecx
+ efa:	73 64                	jae    f60 <malloc+0x90>
+  if(nu < 4096)
+ efc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ f01:	39 df                	cmp    %ebx,%edi
+ f03:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ f06:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ f0d:	eb 0a                	jmp    f19 <malloc+0x49>
+ f0f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ f10:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ f12:	8b 48 04             	mov    0x4(%eax),%ecx
+ f15:	39 f9                	cmp    %edi,%ecx
+ f17:	73 47                	jae    f60 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ f19:	89 c2                	mov    %eax,%edx
+ f1b:	39 05 60 1a 00 00    	cmp    %eax,0x1a60
+ f21:	75 ed                	jne    f10 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ f23:	83 ec 0c             	sub    $0xc,%esp
+ f26:	56                   	push   %esi
+ f27:	e8 3c fc ff ff       	call   b68 <sbrk>
+  if(p == (char*)-1)
+ f2c:	83 c4 10             	add    $0x10,%esp
+ f2f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ f32:	74 1c                	je     f50 <malloc+0x80>
+  hp->s.size = nu;
+ f34:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ f37:	83 ec 0c             	sub    $0xc,%esp
+ f3a:	83 c0 08             	add    $0x8,%eax
+ f3d:	50                   	push   %eax
+ f3e:	e8 fd fe ff ff       	call   e40 <free>
+  return freep;
+ f43:	8b 15 60 1a 00 00    	mov    0x1a60,%edx
+      if((p = morecore(nunits)) == 0)
+ f49:	83 c4 10             	add    $0x10,%esp
+ f4c:	85 d2                	test   %edx,%edx
+ f4e:	75 c0                	jne    f10 <malloc+0x40>
+        return 0;
+  }
+}
+ f50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ f53:	31 c0                	xor    %eax,%eax
+}
+ f55:	5b                   	pop    %ebx
+ f56:	5e                   	pop    %esi
+ f57:	5f                   	pop    %edi
+ f58:	5d                   	pop    %ebp
+ f59:	c3                   	ret
+ f5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ f60:	39 cf                	cmp    %ecx,%edi
+ f62:	74 4c                	je     fb0 <malloc+0xe0>
+        p->s.size -= nunits;
+ f64:	29 f9                	sub    %edi,%ecx
+ f66:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ f69:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ f6c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ f6f:	89 15 60 1a 00 00    	mov    %edx,0x1a60
+}
+ f75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ f78:	83 c0 08             	add    $0x8,%eax
+}
+ f7b:	5b                   	pop    %ebx
+ f7c:	5e                   	pop    %esi
+ f7d:	5f                   	pop    %edi
+ f7e:	5d                   	pop    %ebp
+ f7f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ f80:	c7 05 60 1a 00 00 64 	movl   $0x1a64,0x1a60
+ f87:	1a 00 00 
+    base.s.size = 0;
+ f8a:	b8 64 1a 00 00       	mov    $0x1a64,%eax
+    base.s.ptr = freep = prevp = &base;
+ f8f:	c7 05 64 1a 00 00 64 	movl   $0x1a64,0x1a64
+ f96:	1a 00 00 
+    base.s.size = 0;
+ f99:	c7 05 68 1a 00 00 00 	movl   $0x0,0x1a68
+ fa0:	00 00 00 
+    if(p->s.size >= nunits){
+ fa3:	e9 54 ff ff ff       	jmp    efc <malloc+0x2c>
+ fa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ faf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ fb0:	8b 08                	mov    (%eax),%ecx
+ fb2:	89 0a                	mov    %ecx,(%edx)
+ fb4:	eb b9                	jmp    f6f <malloc+0x9f>
@@ -0,0 +1,266 @@
+#include "types.h"
+#include "stat.h"
+#include "param.h"
+#include "sched.h"
+#include "user.h"
+
+// Scheduler workload generator: runs a mix of CPU-bound, I/O-bound
+// and mixed-phase workers and reports how the scheduler treated each.
+// Usage:
+//   workload [-c n] [-i n] [-m n] [-w t] [-r n] [-s t] [-b t]
+//     -c n   CPU-bound workers: compute for w ticks          (default 2)
+//     -i n   I/O-bound workers: r times sleep s, compute a bit (default 2)
+//     -m n   mixed workers: r times compute b ticks, sleep s (default 2)
+//     -w t   work of a CPU-bound worker, in ticks of computing (100)
+//     -r n   rounds of the I/O-bound and mixed workers         (20)
+//     -s t   sleep per round, in ticks                          (1)
+//     -b t   compute per round of a mixed worker, in ticks      (5)
+// "Ticks of computing" are calibrated at startup, so the work done is
+// the same whatever the scheduler does with it.
+//
+// Workers are clone() threads, so results come back through shared
+// memory.  Times are measured with the TSC and reported in
+// thousandths of a tick:
+//   resp   launch until first run
+//   turn   launch until done
+//   cpu    ticks charged to it (getpinfo), share = cpu / turn in percent
+// Output is one line per worker and one per kind, for scripts:
+//   worker kind idx pid resp turn cpu wait nsched share
+//   summary kind n resp_avg turn_avg turn_max share_avg
+
+#define MAXWORKERS 32
+#define PGSIZE 4096
+#define IO_BURST 20        // an I/O worker computes 1/IO_BURST tick per round
+
+enum { CPU, IO, MIXED, NKIND };
+static char *kinds[] = { "cpu", "io", "mixed" };
+
+struct worker {
+  int kind;
+  int idx;
+  int pid;
+  uint64 launch;           // TSC before clone()
+  uint64 first;            // TSC when it first ran
+  uint64 done;             // TSC when it finished
+  void *stack;
+};
+
+static struct worker workers[MAXWORKERS];
+static int nworkers;
+static volatile uint ndone;
+
+static int work = 100, rounds = 20, sleepticks = 1, burst = 5;
+static uint spins_per_tick;
+static uint64 tsc_per_tick;
+
+static inline uint64
+rdtsc(void)
+{
+  uint lo, hi;
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  return ((uint64)hi << 32) | lo;
+}
+
+// n / d without libgcc's 64-bit division.
+static uint64
+div64(uint64 n, uint64 d)
+{
+  uint64 q = 0;
+  int i;
+
+  for(i = 63; i >= 0; i--)
+    if((n >> i) >= d){
+      n -= d << i;
+      q |= (uint64)1 << i;
+    }
+  return q;
+}
+
+static void
+spin(uint n)
+{
+  volatile uint x = 0;
+
+  while(n-- > 0)
+    x = x * 1664525 + 1013904223;
+}
+
+static void
+compute(int ticks)
+{
+  while(ticks-- > 0)
+    spin(spins_per_tick);
+}
+
+// Measure the TSC rate and how much spinning makes a tick, before any
+// worker competes for the CPU.
+static void
+calibrate(void)
+{
+  uint64 t0;
+  uint n;
+  int start;
+
+  start = uptime();
+  while(uptime() == start)
+    ;
+  t0 = rdtsc();
+  start = uptime();
+  for(n = 0; uptime() < start + 10; n++)
+    spin(1000);
+  tsc_per_tick = div64(rdtsc() - t0, 10);
+  spins_per_tick = n * 100;   // 1000 spins per pass, 10 ticks
+}
+
+// Thousandths of a tick in d TSC cycles.
+static int
+mticks(uint64 d)
+{
+  return div64(d * 1000, tsc_per_tick);
+}
+
+static void
+run(void *arg, void *unused)
+{
+  struct worker *w = arg;
+  int i;
+
+  (void)unused;
+  w->first = rdtsc();
+  switch(w->kind){
+  case CPU:
+    compute(work);
+    break;
+  case IO:
+    for(i = 0; i < rounds; i++){
+      sleep(sleepticks);
+      spin(spins_per_tick / IO_BURST);
+    }
+    break;
+  case MIXED:
+    for(i = 0; i < rounds; i++){
+      compute(burst);
+      sleep(sleepticks);
+    }
+    break;
+  }
+  w->done = rdtsc();
+  __sync_add_and_fetch(&ndone, 1);
+  futex_wake(&ndone, 1);
+  exit();
+}
+
+static struct pinfo*
+findpid(struct pinfo *pi, int n, int pid)
+{
+  for(int i = 0; i < n; i++)
+    if(pi[i].pid == pid)
+      return &pi[i];
+  return 0;
+}
+
+static void
+usage(void)
+{
+  printf(2, "Usage: workload [-c n] [-i n] [-m n] [-w t] [-r n] [-s t] [-b t]\n");
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int count[NKIND] = { 2, 2, 2 };
+  int i, k, n, v, cpu, turn, share;
+  int sum_resp[NKIND], sum_turn[NKIND], max_turn[NKIND], sum_share[NKIND];
+  struct pinfo *pi, *p;
+  struct worker *w;
+  void *stack;
+  uint d;
+
+  for(i = 1; i + 1 < argc; i += 2){
+    if(argv[i][0] != '-' || argv[i][2] != 0)
+      usage();
+    v = atoi(argv[i+1]);
+    switch(argv[i][1]){
+    case 'c': count[CPU] = v; break;
+    case 'i': count[IO] = v; break;
+    case 'm': count[MIXED] = v; break;
+    case 'w': work = v; break;
+    case 'r': rounds = v; break;
+    case 's': sleepticks = v; break;
+    case 'b': burst = v; break;
+    default: usage();
+    }
+  }
+  if(i != argc || count[CPU] + count[IO] + count[MIXED] > MAXWORKERS)
+    usage();
+
+  calibrate();
+  printf(1, "config policy %d cpu %d io %d mixed %d work %d rounds %d sleep %d burst %d\n",
+         setpolicy(-1), count[CPU], count[IO], count[MIXED], work, rounds,
+         sleepticks, burst);
+
+  // Stacks first: only this thread may call malloc().
+  for(k = 0; k < NKIND; k++)
+    for(i = 0; i < count[k]; i++){
+      w = &workers[nworkers++];
+      w->kind = k;
+      w->idx = i;
+      if((w->stack = malloc(PGSIZE)) == 0){
+        printf(2, "workload: out of memory\n");
+        exit();
+      }
+    }
+  if((pi = malloc((NPROC + 1) * sizeof(*pi))) == 0){
+    printf(2, "workload: out of memory\n");
+    exit();
+  }
+
+  for(w = workers; w < workers + nworkers; w++){
+    w->launch = rdtsc();
+    if((w->pid = clone(run, w, 0, w->stack)) < 0){
+      printf(2, "workload: clone failed\n");
+      exit();
+    }
+  }
+
+  // Snapshot the statistics while finished workers are still zombies.
+  while((d = ndone) < nworkers)
+    futex_wait(&ndone, d);
+  if((n = getpinfo(pi, NPROC + 1)) < 0){
+    printf(2, "workload: getpinfo failed\n");
+    exit();
+  }
+  for(i = 0; i < nworkers; i++){
+    if(join(&stack) < 0){
+      printf(2, "workload: join failed\n");
+      exit();
+    }
+    free(stack);
+  }
+
+  for(k = 0; k < NKIND; k++)
+    sum_resp[k] = sum_turn[k] = max_turn[k] = sum_share[k] = 0;
+  for(w = workers; w < workers + nworkers; w++){
+    cpu = 0;
+    if((p = findpid(pi, n, w->pid)) != 0)
+      for(i = 0; i < NMLFQ; i++)
+        cpu += p->ticks[i];
+    turn = mticks(w->done - w->launch);
+    share = turn > 0 ? cpu * 100000 / turn : 0;
+    printf(1, "worker %s %d %d %d %d %d %d %d %d\n",
+           kinds[w->kind], w->idx, w->pid, mticks(w->first - w->launch), turn,
+           cpu, p ? p->waitticks : 0, p ? p->nsched : 0, share);
+    sum_resp[w->kind] += mticks(w->first - w->launch);
+    sum_turn[w->kind] += turn;
+    if(turn > max_turn[w->kind])
+      max_turn[w->kind] = turn;
+    sum_share[w->kind] += share;
+  }
+  for(k = 0; k < NKIND; k++)
+    if(count[k] > 0)
+      printf(1, "summary %s %d %d %d %d %d\n", kinds[k], count[k],
+             sum_resp[k] / count[k], sum_turn[k] / count[k], max_turn[k],
+             sum_share[k] / count[k]);
+  exit();
+}
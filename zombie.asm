@@ -0,0 +1,1273 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 d2 02 00 00       	call   2e8 <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 5c 03 00 00       	call   380 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 c4 02 00 00       	call   2f0 <exit>
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  31:	31 c0                	xor    %eax,%eax
+{
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  47:	83 c0 01             	add    $0x1,%eax
+  4a:	84 d2                	test   %dl,%dl
+  4c:	75 f2                	jne    40 <strcpy+0x10>
+    ;
+  return os;
+}
+  4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  51:	89 c8                	mov    %ecx,%eax
+  53:	c9                   	leave
+  54:	c3                   	ret
+  55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	53                   	push   %ebx
+  64:	8b 55 08             	mov    0x8(%ebp),%edx
+  67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  6a:	0f b6 02             	movzbl (%edx),%eax
+  6d:	84 c0                	test   %al,%al
+  6f:	75 17                	jne    88 <strcmp+0x28>
+  71:	eb 3a                	jmp    ad <strcmp+0x4d>
+  73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  77:	90                   	nop
+  78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  7c:	83 c2 01             	add    $0x1,%edx
+  7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  82:	84 c0                	test   %al,%al
+  84:	74 1a                	je     a0 <strcmp+0x40>
+    p++, q++;
+  86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  88:	0f b6 19             	movzbl (%ecx),%ebx
+  8b:	38 c3                	cmp    %al,%bl
+  8d:	74 e9                	je     78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  8f:	29 d8                	sub    %ebx,%eax
+}
+  91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  94:	c9                   	leave
+  95:	c3                   	ret
+  96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  a4:	31 c0                	xor    %eax,%eax
+  a6:	29 d8                	sub    %ebx,%eax
+}
+  a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  ab:	c9                   	leave
+  ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ad:	0f b6 19             	movzbl (%ecx),%ebx
+  b0:	31 c0                	xor    %eax,%eax
+  b2:	eb db                	jmp    8f <strcmp+0x2f>
+  b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  bf:	90                   	nop
+
+000000c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c6:	80 3a 00             	cmpb   $0x0,(%edx)
+  c9:	74 15                	je     e0 <strlen+0x20>
+  cb:	31 c0                	xor    %eax,%eax
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  d0:	83 c0 01             	add    $0x1,%eax
+  d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  d7:	89 c1                	mov    %eax,%ecx
+  d9:	75 f5                	jne    d0 <strlen+0x10>
+    ;
+  return n;
+}
+  db:	89 c8                	mov    %ecx,%eax
+  dd:	5d                   	pop    %ebp
+  de:	c3                   	ret
+  df:	90                   	nop
+  for(n = 0; s[n]; n++)
+  e0:	31 c9                	xor    %ecx,%ecx
+}
+  e2:	5d                   	pop    %ebp
+  e3:	89 c8                	mov    %ecx,%eax
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	89 d7                	mov    %edx,%edi
+  ff:	fc                   	cld
+ 100:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 102:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 105:	89 d0                	mov    %edx,%eax
+ 107:	c9                   	leave
+ 108:	c3                   	ret
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 45 08             	mov    0x8(%ebp),%eax
+ 116:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 11a:	0f b6 10             	movzbl (%eax),%edx
+ 11d:	84 d2                	test   %dl,%dl
+ 11f:	75 12                	jne    133 <strchr+0x23>
+ 121:	eb 1d                	jmp    140 <strchr+0x30>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 12c:	83 c0 01             	add    $0x1,%eax
+ 12f:	84 d2                	test   %dl,%dl
+ 131:	74 0d                	je     140 <strchr+0x30>
+    if(*s == c)
+ 133:	38 d1                	cmp    %dl,%cl
+ 135:	75 f1                	jne    128 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 137:	5d                   	pop    %ebp
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 140:	31 c0                	xor    %eax,%eax
+}
+ 142:	5d                   	pop    %ebp
+ 143:	c3                   	ret
+ 144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 155:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 158:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 159:	31 db                	xor    %ebx,%ebx
+{
+ 15b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 15e:	eb 27                	jmp    187 <gets+0x37>
+    cc = read(0, &c, 1);
+ 160:	83 ec 04             	sub    $0x4,%esp
+ 163:	6a 01                	push   $0x1
+ 165:	56                   	push   %esi
+ 166:	6a 00                	push   $0x0
+ 168:	e8 9b 01 00 00       	call   308 <read>
+    if(cc < 1)
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	85 c0                	test   %eax,%eax
+ 172:	7e 1d                	jle    191 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 174:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 178:	8b 55 08             	mov    0x8(%ebp),%edx
+ 17b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 17f:	3c 0a                	cmp    $0xa,%al
+ 181:	74 10                	je     193 <gets+0x43>
+ 183:	3c 0d                	cmp    $0xd,%al
+ 185:	74 0c                	je     193 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 187:	89 df                	mov    %ebx,%edi
+ 189:	83 c3 01             	add    $0x1,%ebx
+ 18c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 18f:	7c cf                	jl     160 <gets+0x10>
+ 191:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 19a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 19d:	5b                   	pop    %ebx
+ 19e:	5e                   	pop    %esi
+ 19f:	5f                   	pop    %edi
+ 1a0:	5d                   	pop    %ebp
+ 1a1:	c3                   	ret
+ 1a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	56                   	push   %esi
+ 1b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1b5:	83 ec 08             	sub    $0x8,%esp
+ 1b8:	6a 00                	push   $0x0
+ 1ba:	ff 75 08             	push   0x8(%ebp)
+ 1bd:	e8 6e 01 00 00       	call   330 <open>
+  if(fd < 0)
+ 1c2:	83 c4 10             	add    $0x10,%esp
+ 1c5:	85 c0                	test   %eax,%eax
+ 1c7:	78 27                	js     1f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1c9:	83 ec 08             	sub    $0x8,%esp
+ 1cc:	ff 75 0c             	push   0xc(%ebp)
+ 1cf:	89 c3                	mov    %eax,%ebx
+ 1d1:	50                   	push   %eax
+ 1d2:	e8 71 01 00 00       	call   348 <fstat>
+  close(fd);
+ 1d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1dc:	e8 37 01 00 00       	call   318 <close>
+  return r;
+ 1e1:	83 c4 10             	add    $0x10,%esp
+}
+ 1e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1e7:	89 f0                	mov    %esi,%eax
+ 1e9:	5b                   	pop    %ebx
+ 1ea:	5e                   	pop    %esi
+ 1eb:	5d                   	pop    %ebp
+ 1ec:	c3                   	ret
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1f5:	eb ed                	jmp    1e4 <stat+0x34>
+ 1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 207:	0f be 02             	movsbl (%edx),%eax
+ 20a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 20d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 215:	77 1e                	ja     235 <atoi+0x35>
+ 217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 220:	83 c2 01             	add    $0x1,%edx
+ 223:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 226:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 22a:	0f be 02             	movsbl (%edx),%eax
+ 22d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 230:	80 fb 09             	cmp    $0x9,%bl
+ 233:	76 eb                	jbe    220 <atoi+0x20>
+  return n;
+}
+ 235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 238:	89 c8                	mov    %ecx,%eax
+ 23a:	c9                   	leave
+ 23b:	c3                   	ret
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+ 245:	8b 45 10             	mov    0x10(%ebp),%eax
+ 248:	8b 55 08             	mov    0x8(%ebp),%edx
+ 24b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 24e:	85 c0                	test   %eax,%eax
+ 250:	7e 13                	jle    265 <memmove+0x25>
+ 252:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 254:	89 d7                	mov    %edx,%edi
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 260:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 261:	39 f8                	cmp    %edi,%eax
+ 263:	75 fb                	jne    260 <memmove+0x20>
+  return vdst;
+}
+ 265:	5e                   	pop    %esi
+ 266:	89 d0                	mov    %edx,%eax
+ 268:	5f                   	pop    %edi
+ 269:	5d                   	pop    %ebp
+ 26a:	c3                   	ret
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <mutex_lock>:
+
+// Take and release m with atomic instructions, and enter the kernel
+// only to block while it is held or to wake a blocked thread.
+void
+mutex_lock(struct mutex *m)
+{
+ 270:	55                   	push   %ebp
+  uint s;
+
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 271:	31 c0                	xor    %eax,%eax
+ 273:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+ 278:	89 e5                	mov    %esp,%ebp
+ 27a:	56                   	push   %esi
+ 27b:	53                   	push   %ebx
+ 27c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if((s = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 27f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 283:	85 c0                	test   %eax,%eax
+ 285:	74 30                	je     2b7 <mutex_lock+0x47>
+    return;
+  // Contended: mark it so the holder knows to wake us.
+  if(s != 2)
+ 287:	83 f8 02             	cmp    $0x2,%eax
+ 28a:	74 0c                	je     298 <mutex_lock+0x28>
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 28c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 291:	f0 87 03             	lock xchg %eax,(%ebx)
+    s = xchg(&m->state, 2);
+  while(s != 0){
+ 294:	85 c0                	test   %eax,%eax
+ 296:	74 1f                	je     2b7 <mutex_lock+0x47>
+ 298:	be 02 00 00 00       	mov    $0x2,%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wait(&m->state, 2);
+ 2a0:	83 ec 08             	sub    $0x8,%esp
+ 2a3:	6a 02                	push   $0x2
+ 2a5:	53                   	push   %ebx
+ 2a6:	e8 45 01 00 00       	call   3f0 <futex_wait>
+ 2ab:	89 f0                	mov    %esi,%eax
+ 2ad:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(s != 0){
+ 2b0:	83 c4 10             	add    $0x10,%esp
+ 2b3:	85 c0                	test   %eax,%eax
+ 2b5:	75 e9                	jne    2a0 <mutex_lock+0x30>
+    s = xchg(&m->state, 2);
+  }
+}
+ 2b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2ba:	5b                   	pop    %ebx
+ 2bb:	5e                   	pop    %esi
+ 2bc:	5d                   	pop    %ebp
+ 2bd:	c3                   	ret
+ 2be:	66 90                	xchg   %ax,%ax
+
+000002c0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	31 c0                	xor    %eax,%eax
+ 2c3:	89 e5                	mov    %esp,%ebp
+ 2c5:	83 ec 08             	sub    $0x8,%esp
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2cb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 2ce:	83 f8 02             	cmp    $0x2,%eax
+ 2d1:	74 05                	je     2d8 <mutex_unlock+0x18>
+    futex_wake(&m->state, 1);
+}
+ 2d3:	c9                   	leave
+ 2d4:	c3                   	ret
+ 2d5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex_wake(&m->state, 1);
+ 2d8:	83 ec 08             	sub    $0x8,%esp
+ 2db:	6a 01                	push   $0x1
+ 2dd:	52                   	push   %edx
+ 2de:	e8 15 01 00 00       	call   3f8 <futex_wake>
+ 2e3:	83 c4 10             	add    $0x10,%esp
+}
+ 2e6:	c9                   	leave
+ 2e7:	c3                   	ret
+
+000002e8 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2e8:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2ed:	cd 40                	int    $0x40
+ 2ef:	c3                   	ret
+
+000002f0 <exit>:
+SYSCALL(exit)
+ 2f0:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2f5:	cd 40                	int    $0x40
+ 2f7:	c3                   	ret
+
+000002f8 <wait>:
+SYSCALL(wait)
+ 2f8:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2fd:	cd 40                	int    $0x40
+ 2ff:	c3                   	ret
+
+00000300 <pipe>:
+SYSCALL(pipe)
+ 300:	b8 04 00 00 00       	mov    $0x4,%eax
+ 305:	cd 40                	int    $0x40
+ 307:	c3                   	ret
+
+00000308 <read>:
+SYSCALL(read)
+ 308:	b8 05 00 00 00       	mov    $0x5,%eax
+ 30d:	cd 40                	int    $0x40
+ 30f:	c3                   	ret
+
+00000310 <write>:
+SYSCALL(write)
+ 310:	b8 10 00 00 00       	mov    $0x10,%eax
+ 315:	cd 40                	int    $0x40
+ 317:	c3                   	ret
+
+00000318 <close>:
+SYSCALL(close)
+ 318:	b8 15 00 00 00       	mov    $0x15,%eax
+ 31d:	cd 40                	int    $0x40
+ 31f:	c3                   	ret
+
+00000320 <kill>:
+SYSCALL(kill)
+ 320:	b8 06 00 00 00       	mov    $0x6,%eax
+ 325:	cd 40                	int    $0x40
+ 327:	c3                   	ret
+
+00000328 <exec>:
+SYSCALL(exec)
+ 328:	b8 07 00 00 00       	mov    $0x7,%eax
+ 32d:	cd 40                	int    $0x40
+ 32f:	c3                   	ret
+
+00000330 <open>:
+SYSCALL(open)
+ 330:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 335:	cd 40                	int    $0x40
+ 337:	c3                   	ret
+
+00000338 <mknod>:
+SYSCALL(mknod)
+ 338:	b8 11 00 00 00       	mov    $0x11,%eax
+ 33d:	cd 40                	int    $0x40
+ 33f:	c3                   	ret
+
+00000340 <unlink>:
+SYSCALL(unlink)
+ 340:	b8 12 00 00 00       	mov    $0x12,%eax
+ 345:	cd 40                	int    $0x40
+ 347:	c3                   	ret
+
+00000348 <fstat>:
+SYSCALL(fstat)
+ 348:	b8 08 00 00 00       	mov    $0x8,%eax
+ 34d:	cd 40                	int    $0x40
+ 34f:	c3                   	ret
+
+00000350 <link>:
+SYSCALL(link)
+ 350:	b8 13 00 00 00       	mov    $0x13,%eax
+ 355:	cd 40                	int    $0x40
+ 357:	c3                   	ret
+
+00000358 <mkdir>:
+SYSCALL(mkdir)
+ 358:	b8 14 00 00 00       	mov    $0x14,%eax
+ 35d:	cd 40                	int    $0x40
+ 35f:	c3                   	ret
+
+00000360 <chdir>:
+SYSCALL(chdir)
+ 360:	b8 09 00 00 00       	mov    $0x9,%eax
+ 365:	cd 40                	int    $0x40
+ 367:	c3                   	ret
+
+00000368 <dup>:
+SYSCALL(dup)
+ 368:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 36d:	cd 40                	int    $0x40
+ 36f:	c3                   	ret
+
+00000370 <getpid>:
+SYSCALL(getpid)
+ 370:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 375:	cd 40                	int    $0x40
+ 377:	c3                   	ret
+
+00000378 <sbrk>:
+SYSCALL(sbrk)
+ 378:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <sleep>:
+SYSCALL(sleep)
+ 380:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <uptime>:
+SYSCALL(uptime)
+ 388:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <ps>:
+SYSCALL(ps)
+ 390:	b8 16 00 00 00       	mov    $0x16,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <getschedparams>:
+SYSCALL(getschedparams)
+ 398:	b8 17 00 00 00       	mov    $0x17,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <setschedparams>:
+SYSCALL(setschedparams)
+ 3a0:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <getpinfo>:
+SYSCALL(getpinfo)
+ 3a8:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <getlathist>:
+SYSCALL(getlathist)
+ 3b0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <setpolicy>:
+SYSCALL(setpolicy)
+ 3b8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <settickets>:
+SYSCALL(settickets)
+ 3c0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <setaffinity>:
+SYSCALL(setaffinity)
+ 3c8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <getaffinity>:
+SYSCALL(getaffinity)
+ 3d0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <setrt>:
+SYSCALL(setrt)
+ 3d8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <clone>:
+SYSCALL(clone)
+ 3e0:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <join>:
+SYSCALL(join)
+ 3e8:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <futex_wait>:
+SYSCALL(futex_wait)
+ 3f0:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <futex_wake>:
+SYSCALL(futex_wake)
+ 3f8:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+ 405:	53                   	push   %ebx
+ 406:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 408:	89 d1                	mov    %edx,%ecx
+{
+ 40a:	83 ec 3c             	sub    $0x3c,%esp
+ 40d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 410:	85 d2                	test   %edx,%edx
+ 412:	0f 89 80 00 00 00    	jns    498 <printint+0x98>
+ 418:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 41c:	74 7a                	je     498 <printint+0x98>
+    x = -xx;
+ 41e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 420:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 425:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 428:	31 f6                	xor    %esi,%esi
+ 42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 430:	89 c8                	mov    %ecx,%eax
+ 432:	31 d2                	xor    %edx,%edx
+ 434:	89 f7                	mov    %esi,%edi
+ 436:	f7 f3                	div    %ebx
+ 438:	8d 76 01             	lea    0x1(%esi),%esi
+ 43b:	0f b6 92 28 08 00 00 	movzbl 0x828(%edx),%edx
+ 442:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 446:	89 ca                	mov    %ecx,%edx
+ 448:	89 c1                	mov    %eax,%ecx
+ 44a:	39 da                	cmp    %ebx,%edx
+ 44c:	73 e2                	jae    430 <printint+0x30>
+  if(neg)
+ 44e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 451:	85 c0                	test   %eax,%eax
+ 453:	74 07                	je     45c <printint+0x5c>
+    buf[i++] = '-';
+ 455:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 45a:	89 f7                	mov    %esi,%edi
+ 45c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 45f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 462:	01 df                	add    %ebx,%edi
+ 464:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 468:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 46b:	83 ec 04             	sub    $0x4,%esp
+ 46e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 471:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 474:	6a 01                	push   $0x1
+ 476:	50                   	push   %eax
+ 477:	56                   	push   %esi
+ 478:	e8 93 fe ff ff       	call   310 <write>
+  while(--i >= 0)
+ 47d:	89 f8                	mov    %edi,%eax
+ 47f:	83 c4 10             	add    $0x10,%esp
+ 482:	83 ef 01             	sub    $0x1,%edi
+ 485:	39 d8                	cmp    %ebx,%eax
+ 487:	75 df                	jne    468 <printint+0x68>
+}
+ 489:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 48c:	5b                   	pop    %ebx
+ 48d:	5e                   	pop    %esi
+ 48e:	5f                   	pop    %edi
+ 48f:	5d                   	pop    %ebp
+ 490:	c3                   	ret
+ 491:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 498:	31 c0                	xor    %eax,%eax
+ 49a:	eb 89                	jmp    425 <printint+0x25>
+ 49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	57                   	push   %edi
+ 4a4:	56                   	push   %esi
+ 4a5:	53                   	push   %ebx
+ 4a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4af:	0f b6 1e             	movzbl (%esi),%ebx
+ 4b2:	83 c6 01             	add    $0x1,%esi
+ 4b5:	84 db                	test   %bl,%bl
+ 4b7:	74 67                	je     520 <printf+0x80>
+ 4b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4bc:	31 d2                	xor    %edx,%edx
+ 4be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 4c1:	eb 34                	jmp    4f7 <printf+0x57>
+ 4c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4c7:	90                   	nop
+ 4c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 4cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 4d0:	83 f8 25             	cmp    $0x25,%eax
+ 4d3:	74 18                	je     4ed <printf+0x4d>
+  write(fd, &c, 1);
+ 4d5:	83 ec 04             	sub    $0x4,%esp
+ 4d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4de:	6a 01                	push   $0x1
+ 4e0:	50                   	push   %eax
+ 4e1:	57                   	push   %edi
+ 4e2:	e8 29 fe ff ff       	call   310 <write>
+ 4e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4ed:	0f b6 1e             	movzbl (%esi),%ebx
+ 4f0:	83 c6 01             	add    $0x1,%esi
+ 4f3:	84 db                	test   %bl,%bl
+ 4f5:	74 29                	je     520 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4fa:	85 d2                	test   %edx,%edx
+ 4fc:	74 ca                	je     4c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4fe:	83 fa 25             	cmp    $0x25,%edx
+ 501:	75 ea                	jne    4ed <printf+0x4d>
+      if(c == 'd'){
+ 503:	83 f8 25             	cmp    $0x25,%eax
+ 506:	0f 84 24 01 00 00    	je     630 <printf+0x190>
+ 50c:	83 e8 63             	sub    $0x63,%eax
+ 50f:	83 f8 15             	cmp    $0x15,%eax
+ 512:	77 1c                	ja     530 <printf+0x90>
+ 514:	ff 24 85 d0 07 00 00 	jmp    *0x7d0(,%eax,4)
+ 51b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 51f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 520:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 523:	5b                   	pop    %ebx
+ 524:	5e                   	pop    %esi
+ 525:	5f                   	pop    %edi
+ 526:	5d                   	pop    %ebp
+ 527:	c3                   	ret
+ 528:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52f:	90                   	nop
+  write(fd, &c, 1);
+ 530:	83 ec 04             	sub    $0x4,%esp
+ 533:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 536:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 53a:	6a 01                	push   $0x1
+ 53c:	52                   	push   %edx
+ 53d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 540:	57                   	push   %edi
+ 541:	e8 ca fd ff ff       	call   310 <write>
+ 546:	83 c4 0c             	add    $0xc,%esp
+ 549:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 54c:	6a 01                	push   $0x1
+ 54e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 551:	52                   	push   %edx
+ 552:	57                   	push   %edi
+ 553:	e8 b8 fd ff ff       	call   310 <write>
+        putc(fd, c);
+ 558:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 55b:	31 d2                	xor    %edx,%edx
+ 55d:	eb 8e                	jmp    4ed <printf+0x4d>
+ 55f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 560:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 563:	83 ec 0c             	sub    $0xc,%esp
+ 566:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 56b:	8b 13                	mov    (%ebx),%edx
+ 56d:	6a 00                	push   $0x0
+ 56f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 571:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 574:	e8 87 fe ff ff       	call   400 <printint>
+        ap++;
+ 579:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 57c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 57f:	31 d2                	xor    %edx,%edx
+ 581:	e9 67 ff ff ff       	jmp    4ed <printf+0x4d>
+ 586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 590:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 593:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 595:	83 c0 04             	add    $0x4,%eax
+ 598:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 59b:	85 db                	test   %ebx,%ebx
+ 59d:	0f 84 9d 00 00 00    	je     640 <printf+0x1a0>
+        while(*s != 0){
+ 5a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5a8:	84 c0                	test   %al,%al
+ 5aa:	0f 84 3d ff ff ff    	je     4ed <printf+0x4d>
+ 5b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5b6:	89 de                	mov    %ebx,%esi
+ 5b8:	89 d3                	mov    %edx,%ebx
+ 5ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 5c0:	83 ec 04             	sub    $0x4,%esp
+ 5c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 5c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 5c9:	6a 01                	push   $0x1
+ 5cb:	53                   	push   %ebx
+ 5cc:	57                   	push   %edi
+ 5cd:	e8 3e fd ff ff       	call   310 <write>
+        while(*s != 0){
+ 5d2:	0f b6 06             	movzbl (%esi),%eax
+ 5d5:	83 c4 10             	add    $0x10,%esp
+ 5d8:	84 c0                	test   %al,%al
+ 5da:	75 e4                	jne    5c0 <printf+0x120>
+      state = 0;
+ 5dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5df:	31 d2                	xor    %edx,%edx
+ 5e1:	e9 07 ff ff ff       	jmp    4ed <printf+0x4d>
+ 5e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5f3:	83 ec 0c             	sub    $0xc,%esp
+ 5f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5fb:	8b 13                	mov    (%ebx),%edx
+ 5fd:	6a 01                	push   $0x1
+ 5ff:	e9 6b ff ff ff       	jmp    56f <printf+0xcf>
+ 604:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 608:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 60b:	83 ec 04             	sub    $0x4,%esp
+ 60e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 611:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 613:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 616:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 619:	6a 01                	push   $0x1
+ 61b:	52                   	push   %edx
+ 61c:	57                   	push   %edi
+ 61d:	e8 ee fc ff ff       	call   310 <write>
+        ap++;
+ 622:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 625:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 628:	31 d2                	xor    %edx,%edx
+ 62a:	e9 be fe ff ff       	jmp    4ed <printf+0x4d>
+ 62f:	90                   	nop
+  write(fd, &c, 1);
+ 630:	83 ec 04             	sub    $0x4,%esp
+ 633:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 636:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 639:	6a 01                	push   $0x1
+ 63b:	e9 11 ff ff ff       	jmp    551 <printf+0xb1>
+ 640:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 645:	bb c8 07 00 00       	mov    $0x7c8,%ebx
+ 64a:	e9 61 ff ff ff       	jmp    5b0 <printf+0x110>
+ 64f:	90                   	nop
+
+00000650 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 650:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 651:	a1 14 0b 00 00       	mov    0xb14,%eax
+{
+ 656:	89 e5                	mov    %esp,%ebp
+ 658:	57                   	push   %edi
+ 659:	56                   	push   %esi
+ 65a:	53                   	push   %ebx
+ 65b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 65e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 668:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 66a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 66c:	39 ca                	cmp    %ecx,%edx
+ 66e:	73 30                	jae    6a0 <free+0x50>
+ 670:	39 c1                	cmp    %eax,%ecx
+ 672:	72 04                	jb     678 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 674:	39 c2                	cmp    %eax,%edx
+ 676:	72 f0                	jb     668 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 678:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 67b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 67e:	39 f8                	cmp    %edi,%eax
+ 680:	74 2e                	je     6b0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 682:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 685:	8b 42 04             	mov    0x4(%edx),%eax
+ 688:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 68b:	39 f1                	cmp    %esi,%ecx
+ 68d:	74 38                	je     6c7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 68f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 691:	5b                   	pop    %ebx
+  freep = p;
+ 692:	89 15 14 0b 00 00    	mov    %edx,0xb14
+}
+ 698:	5e                   	pop    %esi
+ 699:	5f                   	pop    %edi
+ 69a:	5d                   	pop    %ebp
+ 69b:	c3                   	ret
+ 69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6a0:	39 c1                	cmp    %eax,%ecx
+ 6a2:	72 d0                	jb     674 <free+0x24>
+ 6a4:	eb c2                	jmp    668 <free+0x18>
+ 6a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 6b0:	03 70 04             	add    0x4(%eax),%esi
+ 6b3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6b6:	8b 02                	mov    (%edx),%eax
+ 6b8:	8b 00                	mov    (%eax),%eax
+ 6ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 6bd:	8b 42 04             	mov    0x4(%edx),%eax
+ 6c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6c3:	39 f1                	cmp    %esi,%ecx
+ 6c5:	75 c8                	jne    68f <free+0x3f>
+    p->s.size += bp->s.size;
+ 6c7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 6ca:	89 15 14 0b 00 00    	mov    %edx,0xb14
+    p->s.size += bp->s.size;
+ 6d0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 6d3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6d6:	89 0a                	mov    %ecx,(%edx)
+}
+ 6d8:	5b                   	pop    %ebx
+ 6d9:	5e                   	pop    %esi
+ 6da:	5f                   	pop    %edi
+ 6db:	5d                   	pop    %ebp
+ 6dc:	c3                   	ret
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006e0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	57                   	push   %edi
+ 6e4:	56                   	push   %esi
+ 6e5:	53                   	push   %ebx
+ 6e6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 6ec:	8b 15 14 0b 00 00    	mov    0xb14,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6f2:	8d 78 07             	lea    0x7(%eax),%edi
+ 6f5:	c1 ef 03             	shr    $0x3,%edi
+ 6f8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 6fb:	85 d2                	test   %edx,%edx
+ 6fd:	0f 84 8d 00 00 00    	je     790 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 703:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 705:	8b 48 04             	mov    0x4(%eax),%ecx
+ 708:	39 f9                	cmp    %edi,%ecx
+ 70a:	73 64                	jae    770 <malloc+0x90>
+  if(nu < 4096)
+ 70c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 711:	39 df                	cmp    %ebx,%edi
+ 713:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 716:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 71d:	eb 0a                	jmp    729 <malloc+0x49>
+ 71f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 720:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 722:	8b 48 04             	mov    0x4(%eax),%ecx
+ 725:	39 f9                	cmp    %edi,%ecx
+ 727:	73 47                	jae    770 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 729:	89 c2                	mov    %eax,%edx
+ 72b:	39 05 14 0b 00 00    	cmp    %eax,0xb14
+ 731:	75 ed                	jne    720 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 733:	83 ec 0c             	sub    $0xc,%esp
+ 736:	56                   	push   %esi
+ 737:	e8 3c fc ff ff       	call   378 <sbrk>
+  if(p == (char*)-1)
+ 73c:	83 c4 10             	add    $0x10,%esp
+ 73f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 742:	74 1c                	je     760 <malloc+0x80>
+  hp->s.size = nu;
+ 744:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 747:	83 ec 0c             	sub    $0xc,%esp
+ 74a:	83 c0 08             	add    $0x8,%eax
+ 74d:	50                   	push   %eax
+ 74e:	e8 fd fe ff ff       	call   650 <free>
+  return freep;
+ 753:	8b 15 14 0b 00 00    	mov    0xb14,%edx
+      if((p = morecore(nunits)) == 0)
+ 759:	83 c4 10             	add    $0x10,%esp
+ 75c:	85 d2                	test   %edx,%edx
+ 75e:	75 c0                	jne    720 <malloc+0x40>
+        return 0;
+  }
+}
+ 760:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 763:	31 c0                	xor    %eax,%eax
+}
+ 765:	5b                   	pop    %ebx
+ 766:	5e                   	pop    %esi
+ 767:	5f                   	pop    %edi
+ 768:	5d                   	pop    %ebp
+ 769:	c3                   	ret
+ 76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 770:	39 cf                	cmp    %ecx,%edi
+ 772:	74 4c                	je     7c0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 774:	29 f9                	sub    %edi,%ecx
+ 776:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 779:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 77c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 77f:	89 15 14 0b 00 00    	mov    %edx,0xb14
+}
+ 785:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 788:	83 c0 08             	add    $0x8,%eax
+}
+ 78b:	5b                   	pop    %ebx
+ 78c:	5e                   	pop    %esi
+ 78d:	5f                   	pop    %edi
+ 78e:	5d                   	pop    %ebp
+ 78f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 790:	c7 05 14 0b 00 00 18 	movl   $0xb18,0xb14
+ 797:	0b 00 00 
+    base.s.size = 0;
+ 79a:	b8 18 0b 00 00       	mov    $0xb18,%eax
+    base.s.ptr = freep = prevp = &base;
+ 79f:	c7 05 18 0b 00 00 18 	movl   $0xb18,0xb18
+ 7a6:	0b 00 00 
+    base.s.size = 0;
+ 7a9:	c7 05 1c 0b 00 00 00 	movl   $0x0,0xb1c
+ 7b0:	00 00 00 
+    if(p->s.size >= nunits){
+ 7b3:	e9 54 ff ff ff       	jmp    70c <malloc+0x2c>
+ 7b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 7c0:	8b 08                	mov    (%eax),%ecx
+ 7c2:	89 0a                	mov    %ecx,(%edx)
+ 7c4:	eb b9                	jmp    77f <malloc+0x9f>